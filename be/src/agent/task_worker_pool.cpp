@@ -1437,6 +1437,12 @@ void* TaskWorkerPool::_report_tablet_worker_thread_callback(void* arg_this) {
     request.__set_backend(worker_pool_this->_backend);
     request.__isset.tablets = true;
     AgentStatus status = STARROCKS_SUCCESS;
+    // the last report accepted by the master, the report is skipped if neither the tablets nor the master
+    // changed since then, until the report_unchanged_tablets_interval_seconds passes
+    uint64_t last_fingerprint = 0;
+    int64_t last_report_version = -1;
+    int64_t last_report_ms = 0;
+    TNetworkAddress last_master_address;
 
     while ((!worker_pool_this->_stopped)) {
         if (worker_pool_this->_master_info.network_address.port == 0) {
@@ -1461,6 +1467,16 @@ void* TaskWorkerPool::_report_tablet_worker_thread_callback(void* arg_this) {
                          StarRocksMetrics::instance()->tablet_base_max_compaction_score.value());
         request.__set_tablet_max_compaction_score(max_compaction_score);
 
+        uint64_t fingerprint = TabletManager::tablets_info_fingerprint(request.tablets);
+        int64_t now_ms = MonotonicMillis();
+        if (fingerprint == last_fingerprint && request.report_version == last_report_version &&
+            worker_pool_this->_master_info.network_address == last_master_address &&
+            now_ms - last_report_ms < config::report_unchanged_tablets_interval_seconds * 1000L) {
+            VLOG(1) << "Skip reporting unchanged " << request.tablets.size() << " tablets";
+            StorageEngine::instance()->wait_for_report_notify(config::report_tablet_interval_seconds, true);
+            continue;
+        }
+
         TMasterResult result;
         status = worker_pool_this->_master_client->report(request, &result);
 
@@ -1469,6 +1485,11 @@ void* TaskWorkerPool::_report_tablet_worker_thread_callback(void* arg_this) {
             LOG(WARNING) << "Fail to report olap table state to "
                          << worker_pool_this->_master_info.network_address.hostname << ":"
                          << worker_pool_this->_master_info.network_address.port << ", err=" << status;
+        } else if (result.status.status_code == TStatusCode::OK) {
+            last_fingerprint = fingerprint;
+            last_report_version = request.report_version;
+            last_report_ms = now_ms;
+            last_master_address = worker_pool_this->_master_info.network_address;
         }
 
         // wait for notifying until timeout
@@ -9,6 +9,7 @@
 #include "gutil/bits.h"
 #include "gutil/casts.h"
 #include "gutil/strings/fastmem.h"
+#include "simd/filter.h"
 #include "util/mysql_row_buffer.h"
 
 namespace starrocks::vectorized {
@@ -249,75 +250,40 @@ size_t ArrayColumn::filter_range(const Column::Filter& filter, size_t from, size
     uint32_t elements_end = offsets[to];
     Filter element_filter(elements_end, 0);
 
-    auto check_offset = from;
-    auto result_offset = from;
-
-#ifdef __AVX2__
-    const uint8_t* f_data = filter.data();
-
-    constexpr size_t kBatchSize = /*width of AVX registers*/ 256 / 8;
-    const __m256i all0 = _mm256_setzero_si256();
-
-    while (check_offset + kBatchSize < to) {
-        __m256i f = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(f_data + check_offset));
-        uint32_t mask = _mm256_movemask_epi8(_mm256_cmpgt_epi8(f, all0));
-
-        if (mask == 0) {
-            // all no hit, pass
-        } else if (mask == 0xffffffff) {
-            // all hit, copy all
-            auto element_size = offsets[check_offset + kBatchSize] - offsets[check_offset];
-            memset(element_filter.data() + offsets[check_offset], 1, element_size);
-            if (result_offset != check_offset) {
-                DCHECK_LE(offsets[result_offset], offsets[check_offset]);
-                // Equivalent to the following code:
-                // ```
-                //   uint32_t array_sizes[kBatchSize];
-                //   for (int i = 0; i < kBatchSize; i++) {
-                //     array_sizes[i] = offsets[check_offset + i + 1] - offsets[check_offset + i];
-                //   }
-                //   for (int i = 0; i < kBatchSize; i++) {
-                //     offsets[result_offset + i + 1] = offsets[result_offset + i] + array_sizes[i];
-                //   }
-                // ```
-                auto delta = offsets[check_offset] - offsets[result_offset];
-                memmove(offsets + result_offset + 1, offsets + check_offset + 1, kBatchSize * sizeof(offsets[0]));
-                for (int i = 0; i < kBatchSize; i++) {
-                    offsets[result_offset + i + 1] -= delta;
-                }
-            }
-            result_offset += kBatchSize;
-        } else {
-            // skip not hit row, it's will reduce compare when filter layout is sparse,
-            // like "00010001...", but is ineffective when the filter layout is dense.
-
-            auto zero_count = Bits::CountTrailingZerosNonZero32(mask);
-            auto i = zero_count;
-            while (i < kBatchSize) {
-                mask = zero_count < 31 ? mask >> (zero_count + 1) : 0;
-
-                auto array_size = offsets[check_offset + i + 1] - offsets[check_offset + i];
-                memset(element_filter.data() + offsets[check_offset + i], 1, array_size);
+    size_t result_offset = from;
+    SIMD::for_each_selected(
+            filter.data(), from, to,
+            [&](size_t i) {
+                DCHECK_GE(offsets[i + 1], offsets[i]);
+                uint32_t array_size = offsets[i + 1] - offsets[i];
+                memset(element_filter.data() + offsets[i], 1, array_size);
                 offsets[result_offset + 1] = offsets[result_offset] + array_size;
-                zero_count = Bits::CountTrailingZeros32(mask);
-                result_offset += 1;
-                i += (zero_count + 1);
-            }
-        }
-        check_offset += kBatchSize;
-    }
-#endif
-
-    for (auto i = check_offset; i < to; ++i) {
-        if (filter[i]) {
-            DCHECK_GE(offsets[i + 1], offsets[i]);
-            uint32_t array_size = offsets[i + 1] - offsets[i];
-            memset(element_filter.data() + offsets[i], 1, array_size);
-            offsets[result_offset + 1] = offsets[result_offset] + array_size;
-
-            result_offset++;
-        }
-    }
+                result_offset++;
+            },
+            [&](size_t start) {
+                constexpr size_t kBatchSize = SIMD::kFilterBatchSize;
+                auto element_size = offsets[start + kBatchSize] - offsets[start];
+                memset(element_filter.data() + offsets[start], 1, element_size);
+                if (result_offset != start) {
+                    DCHECK_LE(offsets[result_offset], offsets[start]);
+                    // Equivalent to the following code:
+                    // ```
+                    //   uint32_t array_sizes[kBatchSize];
+                    //   for (int i = 0; i < kBatchSize; i++) {
+                    //     array_sizes[i] = offsets[start + i + 1] - offsets[start + i];
+                    //   }
+                    //   for (int i = 0; i < kBatchSize; i++) {
+                    //     offsets[result_offset + i + 1] = offsets[result_offset + i] + array_sizes[i];
+                    //   }
+                    // ```
+                    auto delta = offsets[start] - offsets[result_offset];
+                    memmove(offsets + result_offset + 1, offsets + start + 1, kBatchSize * sizeof(offsets[0]));
+                    for (size_t i = 0; i < kBatchSize; i++) {
+                        offsets[result_offset + i + 1] -= delta;
+                    }
+                }
+                result_offset += kBatchSize;
+            });
 
     auto ret = _elements->filter_range(element_filter, elements_start, elements_end);
     DCHECK_EQ(offsets[result_offset], ret);
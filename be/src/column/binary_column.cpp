@@ -11,6 +11,7 @@
 #include "gutil/bits.h"
 #include "gutil/casts.h"
 #include "gutil/strings/fastmem.h"
+#include "simd/filter.h"
 #include "util/coding.h"
 #include "util/hash_util.hpp"
 #include "util/mysql_row_buffer.h"
@@ -308,77 +309,30 @@ ColumnPtr BinaryColumnBase<T>::cut(size_t start, size_t length) const {
 
 template <typename T>
 size_t BinaryColumnBase<T>::filter_range(const Column::Filter& filter, size_t from, size_t to) {
-    auto start_offset = from;
-    auto result_offset = from;
-
+    size_t result_offset = from;
     uint8_t* data = _bytes.data();
-
-#ifdef __AVX2__
-    const uint8_t* f_data = filter.data();
-
-    int simd_bits = 256;
-    int batch_nums = simd_bits / (8 * (int)sizeof(uint8_t));
-    __m256i all0 = _mm256_setzero_si256();
-
-    while (start_offset + batch_nums < to) {
-        __m256i f = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(f_data + start_offset));
-        uint32_t mask = _mm256_movemask_epi8(_mm256_cmpgt_epi8(f, all0));
-
-        if (mask == 0) {
-            // all no hit, pass
-        } else if (mask == 0xffffffff) {
-            // all hit, copy all
-
-            // copy data
-            T size = _offsets[start_offset + batch_nums] - _offsets[start_offset];
-            memmove(data + _offsets[result_offset], data + _offsets[start_offset], size);
-
-            // set offsets, try vectorized
-            T* offset_data = _offsets.data();
-            for (int i = 0; i < batch_nums; ++i) {
-                // TODO: performance, all sub one same offset ?
-                offset_data[result_offset + i + 1] = offset_data[result_offset + i] +
-                                                     offset_data[start_offset + i + 1] - offset_data[start_offset + i];
-            }
-
-            result_offset += batch_nums;
-        } else {
-            // skip not hit row, it's will reduce compare when filter layout is sparse,
-            // like "00010001...", but is ineffective when the filter layout is dense.
-
-            uint32_t zero_count = Bits::CountTrailingZerosNonZero32(mask);
-            uint32_t i = zero_count;
-            while (i < batch_nums) {
-                mask = zero_count < 31 ? mask >> (zero_count + 1) : 0;
-
-                T size = _offsets[start_offset + i + 1] - _offsets[start_offset + i];
-                // copy date
-                memmove(data + _offsets[result_offset], data + _offsets[start_offset + i], size);
-
-                // set offsets
-                _offsets[result_offset + 1] = _offsets[result_offset] + size;
-                zero_count = Bits::CountTrailingZeros32(mask);
-                result_offset += 1;
-                i += (zero_count + 1);
-            }
-        }
-        start_offset += batch_nums;
-    }
-#endif
-
-    for (auto i = start_offset; i < to; ++i) {
-        if (filter[i]) {
-            DCHECK_GE(_offsets[i + 1], _offsets[i]);
-            T size = _offsets[i + 1] - _offsets[i];
-            // copy data
-            memmove(data + _offsets[result_offset], data + _offsets[i], size);
-
-            // set offsets
-            _offsets[result_offset + 1] = _offsets[result_offset] + size;
-
-            result_offset++;
-        }
-    }
+    T* offsets = _offsets.data();
+
+    SIMD::for_each_selected(
+            filter.data(), from, to,
+            [&](size_t i) {
+                DCHECK_GE(offsets[i + 1], offsets[i]);
+                T size = offsets[i + 1] - offsets[i];
+                memmove(data + offsets[result_offset], data + offsets[i], size);
+                offsets[result_offset + 1] = offsets[result_offset] + size;
+                result_offset++;
+            },
+            [&](size_t start) {
+                // All the rows of the batch are selected, move the bytes at once.
+                constexpr size_t kBatchSize = SIMD::kFilterBatchSize;
+                memmove(data + offsets[result_offset], data + offsets[start],
+                        offsets[start + kBatchSize] - offsets[start]);
+                for (size_t i = 0; i < kBatchSize; ++i) {
+                    offsets[result_offset + i + 1] =
+                            offsets[result_offset + i] + offsets[start + i + 1] - offsets[start + i];
+                }
+                result_offset += kBatchSize;
+            });
 
     this->resize(result_offset);
     return result_offset;
@@ -3,6 +3,7 @@
 #include "column/chunk.h"
 
 #include "column/column_helper.h"
+#include "column/column_pool.h"
 #include "column/datum_tuple.h"
 #include "column/fixed_length_column.h"
 #include "gen_cpp/data.pb.h"
@@ -57,7 +58,7 @@ bool Chunk::has_large_column() const {
 
 Chunk::Chunk(Columns columns, SchemaPtr schema) : _columns(std::move(columns)), _schema(std::move(schema)) {
     // bucket size cannot be 0.
-    _cid_to_index.reserve(std::max<size_t>(1, columns.size() * 2));
+    _cid_to_index.reserve(std::max<size_t>(1, _columns.size() * 2));
     _slot_id_to_index.reserve(std::max<size_t>(1, _columns.size() * 2));
     _tuple_id_to_index.reserve(1);
     rebuild_cid_index();
@@ -165,6 +166,17 @@ void Chunk::rebuild_cid_index() {
     }
 }
 
+static ColumnPtr clone_empty_column(const Column& column, size_t size) {
+    ColumnPtr res;
+    if (config::enable_pooled_clone_empty && !config::disable_column_pool) {
+        res = clone_empty_pooled(column, size);
+    } else {
+        res = column.clone_empty();
+    }
+    res->reserve(size);
+    return res;
+}
+
 std::unique_ptr<Chunk> Chunk::clone_empty() const {
     return clone_empty(num_rows());
 }
@@ -185,8 +197,7 @@ std::unique_ptr<Chunk> Chunk::clone_empty_with_slot(size_t size) const {
     DCHECK_EQ(_columns.size(), _slot_id_to_index.size());
     Columns columns(_slot_id_to_index.size());
     for (size_t i = 0; i < _slot_id_to_index.size(); i++) {
-        columns[i] = _columns[i]->clone_empty();
-        columns[i]->reserve(size);
+        columns[i] = clone_empty_column(*_columns[i], size);
     }
     return std::make_unique<Chunk>(columns, _slot_id_to_index);
 }
@@ -199,8 +210,7 @@ std::unique_ptr<Chunk> Chunk::clone_empty_with_schema() const {
 std::unique_ptr<Chunk> Chunk::clone_empty_with_schema(size_t size) const {
     Columns columns(_columns.size());
     for (size_t i = 0; i < _columns.size(); ++i) {
-        columns[i] = _columns[i]->clone_empty();
-        columns[i]->reserve(size);
+        columns[i] = clone_empty_column(*_columns[i], size);
     }
     return std::make_unique<Chunk>(columns, _schema);
 }
@@ -212,8 +222,7 @@ std::unique_ptr<Chunk> Chunk::clone_empty_with_tuple() const {
 std::unique_ptr<Chunk> Chunk::clone_empty_with_tuple(size_t size) const {
     Columns columns(_columns.size());
     for (size_t i = 0; i < _columns.size(); ++i) {
-        columns[i] = _columns[i]->clone_empty();
-        columns[i]->reserve(size);
+        columns[i] = clone_empty_column(*_columns[i], size);
     }
     return std::make_unique<Chunk>(columns, _slot_id_to_index, _tuple_id_to_index);
 }
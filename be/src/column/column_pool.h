@@ -6,6 +6,8 @@
 #include <butil/time.h> // NOLINT
 
 #include <atomic>
+#include <typeinfo>
+#include <utility>
 
 #include "common/compiler_util.h"
 DIAGNOSTIC_PUSH
@@ -17,6 +19,7 @@ DIAGNOSTIC_POP
 #include "column/const_column.h"
 #include "column/decimalv3_column.h"
 #include "column/fixed_length_column.h"
+#include "column/nullable_column.h"
 #include "column/object_column.h"
 #include "common/config.h"
 #include "common/type_list.h"
@@ -90,6 +93,10 @@ struct ColumnPoolInfo {
     size_t local_cnt = 0;
     size_t central_free_items = 0;
     size_t central_free_bytes = 0;
+    // the gets served by a pooled column and the ones that were not, of the exited threads and the
+    // threads having flushed their counts.
+    int64_t hit_cnt = 0;
+    int64_t miss_cnt = 0;
 };
 
 template <typename T>
@@ -115,16 +122,19 @@ class CACHELINE_ALIGNED ColumnPool {
                     delete _curr_free.ptrs[i];
                 }
             }
+            _flush_counts();
             _pool->_clear_from_destructor_of_local_pool();
         }
 
         T* get_object() {
             if (_curr_free.nfree == 0) {
                 if (!_pool->_pop_free_block(&_curr_free)) {
+                    _count_get(false);
                     return nullptr;
                 }
             }
             T* obj = _curr_free.ptrs[--_curr_free.nfree];
+            _count_get(true);
             ASAN_UNPOISON_MEMORY_REGION(obj, sizeof(T));
             auto bytes = column_bytes(obj);
             _curr_free.bytes -= bytes;
@@ -182,8 +192,26 @@ class CACHELINE_ALIGNED ColumnPool {
         static void delete_local_pool(void* arg) { delete (LocalPool*)arg; }
 
     private:
+        // the counts are flushed to the shared ones once per block of gets, to keep the gets off the
+        // cache line shared by the threads.
+        void _count_get(bool hit) {
+            (hit ? _hit_cnt : _miss_cnt)++;
+            if (_hit_cnt + _miss_cnt >= static_cast<int64_t>(kBlockSize)) {
+                _flush_counts();
+            }
+        }
+
+        void _flush_counts() {
+            _pool->_hit_cnt.fetch_add(_hit_cnt, std::memory_order_relaxed);
+            _pool->_miss_cnt.fetch_add(_miss_cnt, std::memory_order_relaxed);
+            _hit_cnt = 0;
+            _miss_cnt = 0;
+        }
+
         ColumnPool* _pool;
         FreeBlock _curr_free;
+        int64_t _hit_cnt = 0;
+        int64_t _miss_cnt = 0;
     };
 
 public:
@@ -261,9 +289,14 @@ public:
         }
     }
 
+    int64_t hit_count() const { return _hit_cnt.load(std::memory_order_relaxed); }
+    int64_t miss_count() const { return _miss_cnt.load(std::memory_order_relaxed); }
+
     ColumnPoolInfo describe_column_pool() {
         ColumnPoolInfo info;
         info.local_cnt = _nlocal.load(std::memory_order_relaxed);
+        info.hit_cnt = hit_count();
+        info.miss_cnt = miss_count();
         if (_free_blocks.empty()) {
             return info;
         }
@@ -370,6 +403,9 @@ private:
     mutable std::mutex _free_blocks_lock;
     std::vector<DynamicFreeBlock*> _free_blocks;
     int64_t _first_push_time = 0;
+
+    std::atomic<int64_t> _hit_cnt{0};
+    std::atomic<int64_t> _miss_cnt{0};
 };
 
 using ColumnPoolList =
@@ -428,6 +464,14 @@ inline void clear_columns() {
 template <typename T>
 struct HasColumnPool : public std::bool_constant<InList<ColumnPool<T>, ColumnPoolList>::value> {};
 
+// Returns the column to its pool instead of deleting it.
+template <typename T>
+struct ColumnPoolDeleter {
+    explicit ColumnPoolDeleter(uint32_t chunk_size) : chunk_size(chunk_size) {}
+    void operator()(Column* ptr) const { return_column<T>(down_cast<T*>(ptr), chunk_size); }
+    uint32_t chunk_size;
+};
+
 namespace detail {
 struct ClearColumnPool {
     template <typename Pool>
@@ -435,8 +479,79 @@ struct ClearColumnPool {
         Pool::singleton()->clear_columns();
     }
 };
+
+template <typename Pool>
+struct PooledColumnType;
+
+template <typename T>
+struct PooledColumnType<ColumnPool<T>> {
+    using Type = T;
+};
+
+// Takes an empty column of the same type as |source| from its pool, if there is a pool of the type.
+struct GetPooledColumn {
+    template <typename Pool>
+    void operator()() {
+        using T = typename PooledColumnType<Pool>::Type;
+        if (result != nullptr || typeid(*source) != typeid(T)) {
+            return;
+        }
+        T* ptr = get_column<T>();
+        if (UNLIKELY(ptr == nullptr)) {
+            return;
+        }
+        auto column = std::shared_ptr<T>(ptr, ColumnPoolDeleter<T>(chunk_size));
+        if constexpr (std::is_same_v<T, Decimal32Column> || std::is_same_v<T, Decimal64Column> ||
+                      std::is_same_v<T, Decimal128Column>) {
+            const auto* decimal = down_cast<const T*>(source);
+            column->set_precision(decimal->precision());
+            column->set_scale(decimal->scale());
+        }
+        result = std::move(column);
+    }
+
+    const Column* source;
+    uint32_t chunk_size;
+    ColumnPtr result;
+};
+
+struct SumColumnPoolReuse {
+    template <typename Pool>
+    void operator()() {
+        hit_cnt += Pool::singleton()->hit_count();
+        miss_cnt += Pool::singleton()->miss_count();
+    }
+    int64_t hit_cnt = 0;
+    int64_t miss_cnt = 0;
+};
 } // namespace detail
 
+// The hits and misses of all the column pools, see ColumnPoolInfo.
+inline std::pair<int64_t, int64_t> column_pool_reuse_counts() {
+    detail::SumColumnPoolReuse sum;
+    ForEach<ColumnPoolList>(sum);
+    return {sum.hit_cnt, sum.miss_cnt};
+}
+
+// Returns an empty column of the same type as |column|, which is taken from and returned to the column pools, so the
+// columns and their buffers reserved for |chunk_size| rows are reused across the chunks instead of being allocated
+// and freed for each chunk. The data column and the null column of a nullable column are pooled separately, and the
+// columns of the types without pools are cloned by clone_empty().
+inline ColumnPtr clone_empty_pooled(const Column& column, size_t chunk_size) {
+    if (column.is_nullable() && !column.is_constant()) {
+        const auto& nullable = down_cast<const NullableColumn&>(column);
+        return NullableColumn::create(clone_empty_pooled(*nullable.data_column(), chunk_size),
+                                      std::static_pointer_cast<NullColumn>(
+                                              clone_empty_pooled(*nullable.null_column(), chunk_size)));
+    }
+    detail::GetPooledColumn get{&column, static_cast<uint32_t>(chunk_size), nullptr};
+    ForEach<ColumnPoolList>(get);
+    if (get.result != nullptr) {
+        return std::move(get.result);
+    }
+    return column.clone_empty();
+}
+
 inline void TEST_clear_all_columns_this_thread() {
     ForEach<ColumnPoolList>(detail::ClearColumnPool());
 }
@@ -130,6 +130,32 @@ struct SliceKey16 {
     SliceKey16(SliceKey16&& x) noexcept { u.value = x.u.value; }
 };
 
+struct SliceKey32 {
+    union U {
+        struct {
+            char data[31];
+            uint8_t size;
+        } __attribute__((packed));
+        int128_t value[2];
+    } u;
+    static_assert(sizeof(u) == sizeof(u.value));
+    bool operator==(const SliceKey32& k) const { return u.value[0] == k.u.value[0] && u.value[1] == k.u.value[1]; }
+    SliceKey32() = default;
+    SliceKey32(const SliceKey32& x) {
+        u.value[0] = x.u.value[0];
+        u.value[1] = x.u.value[1];
+    }
+    SliceKey32& operator=(const SliceKey32& x) {
+        u.value[0] = x.u.value[0];
+        u.value[1] = x.u.value[1];
+        return *this;
+    }
+    SliceKey32(SliceKey32&& x) noexcept {
+        u.value[0] = x.u.value[0];
+        u.value[1] = x.u.value[1];
+    }
+};
+
 template <typename SliceKey, PhmapSeed seed>
 class FixedSizeSliceKeyHash {
 public:
@@ -138,9 +164,12 @@ public:
             return phmap_mix_with_seed<sizeof(size_t), seed>()(std::hash<int32_t>()(s.u.value));
         } else if constexpr (sizeof(SliceKey) == 8) {
             return phmap_mix_with_seed<sizeof(size_t), seed>()(std::hash<size_t>()(s.u.value));
-        } else {
+        } else if constexpr (sizeof(SliceKey) == 16) {
             static_assert(sizeof(s.u.value) == 16);
             return Hash128WithSeed<seed>()(s.u.value);
+        } else {
+            static_assert(sizeof(s.u.value) == 32);
+            return phmap_mix_with_seed<sizeof(size_t), seed>()(hash_128(hash_128(seed, s.u.value[0]), s.u.value[1]));
         }
     }
 };
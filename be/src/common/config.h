@@ -112,6 +112,9 @@ CONF_mInt32(report_task_interval_seconds, "10");
 CONF_mInt32(report_disk_state_interval_seconds, "60");
 // The interval time(seconds) for agent report olap table to FE.
 CONF_mInt32(report_tablet_interval_seconds, "60");
+// The interval time(seconds) for agent report olap table to FE even if none of the tablets changed since the last
+// report, the unchanged reports in between are skipped, 0 means never skip a report.
+CONF_mInt32(report_unchanged_tablets_interval_seconds, "600");
 // The interval time(seconds) for agent report workgroup to FE.
 CONF_mInt32(report_workgroup_interval_seconds, "5");
 // The max download speed(KB/s).
@@ -120,6 +123,9 @@ CONF_mInt32(max_download_speed_kbps, "50000");
 CONF_mInt32(download_low_speed_limit_kbps, "50");
 // The download low speed time(seconds).
 CONF_mInt32(download_low_speed_time, "300");
+// The count of threads to download the files of a tablet snapshot in parallel when cloning, the threads
+// share the max_download_speed_kbps.
+CONF_mInt32(clone_download_file_thread_num, "4");
 // The sleep time for one second.
 CONF_Int32(sleep_one_second, "1");
 // The sleep time for five seconds.
@@ -164,6 +170,9 @@ CONF_Bool(compress_rowbatches, "true");
 // Compress ratio when shuffle row_batches in network, not in storage engine.
 // If ratio is less than this value, use uncompressed data instead.
 CONF_mDouble(rpc_compress_ratio_threshold, "1.1");
+// Whether the pipeline exchange sink compresses the chunks adaptively. The chunks aren't compressed,
+// when compressing them costs more time than sending the saved bytes through the network, e.g. on a fast network.
+CONF_mBool(exchange_enable_adaptive_compression, "false");
 // Serialize and deserialize each returned row batch.
 CONF_Bool(serialize_batch, "false");
 // Interval between profile reports; in seconds.
@@ -215,10 +224,24 @@ CONF_mInt32(memory_limitation_per_thread_for_schema_change, "2");
 CONF_mDouble(memory_ratio_for_sorting_schema_change, "0.8");
 
 CONF_mInt32(update_cache_expire_sec, "360");
+// The percent of the update memory limit the cached primary indexes may use, beyond it the unused indexes are
+// evicted in LRU order, the ones backed by the persistent index first. 0 disables the eviction.
+CONF_mInt32(primary_index_cache_limit_percent, "80");
+// Load the primary indexes of the tablets in the background after the BE starts, until the cached indexes use
+// `primary_index_prewarm_limit_percent` of the update memory limit.
+CONF_Bool(enable_primary_index_prewarm, "true");
+CONF_mInt32(primary_index_prewarm_limit_percent, "30");
 CONF_mInt32(file_descriptor_cache_clean_interval, "3600");
 CONF_mInt32(disk_stat_monitor_interval, "5");
 CONF_mInt32(unused_rowset_monitor_interval, "30");
 CONF_String(storage_root_path, "${STARROCKS_HOME}/storage");
+// The storage root paths, separated by ';', whose segment files are read by mapping them into the memory instead of
+// by pread, which suits the local NVMe disks. The uncompressed pages of the mapped files are referenced in place,
+// and are not put into the page cache, as the OS page cache holds them already.
+CONF_String(mmap_read_storage_paths, "");
+// The storage root paths, separated by ';', whose compaction outputs are written by O_DIRECT, bypassing the OS page
+// cache, so the compactions do not evict the pages of the queries and do not cause the writeback storms.
+CONF_String(direct_io_write_storage_paths, "");
 // BE process will exit if the percentage of error disk reach this value.
 CONF_mInt32(max_percentage_of_error_disk, "0");
 // CONF_Int32(default_num_rows_per_data_block, "1024");
@@ -239,6 +262,10 @@ CONF_mInt32(trash_file_expire_time_sec, "259200");
 CONF_mBool(row_nums_check, "true");
 //file descriptors cache, by default, cache 16384 descriptors
 CONF_Int32(file_descriptor_cache_capacity, "16384");
+// Whether to keep the file handle of a local segment open as long as the Segment, so its readers share the handle
+// instead of looking it up from the file descriptor cache by the path. The pinned handles are not counted by
+// `file_descriptor_cache_capacity`, so the open files limit should cover the number of the loaded segments.
+CONF_Bool(pin_segment_file_handles, "true");
 // minimum file descriptor number
 // modify them upon necessity
 CONF_Int32(min_file_descriptor_number, "60000");
@@ -249,8 +276,49 @@ CONF_Int64(index_stream_cache_capacity, "10737418240");
 CONF_String(storage_page_cache_limit, "0");
 // whether to disable page cache feature in storage
 CONF_Bool(disable_storage_page_cache, "true");
+// Whether the page cache evicts the pages by the segmented LRU, which keeps the pages read more than once for a
+// long time, so that a large scan doesn't evict the hot pages.
+CONF_Bool(storage_page_cache_scan_resistant, "false");
+// The memory limit of the cache of the decoded columns of the small segments, e.g. the segments of the hot
+// dimension tables. The cache is disabled if it's 0.
+CONF_String(decoded_column_cache_limit, "0");
+// The segments of at most so many rows are kept in the decoded column cache.
+CONF_mInt32(decoded_column_cache_max_segment_rows, "65536");
+// The memory limit of the cache of the parsed footers of the parquet and orc files of the external tables, which
+// is shared by the queries on the BE. The cache is disabled if it's 0.
+CONF_String(footer_cache_limit, "0");
+// The memory limit of the cache of the partial aggregation results of the tablets, which is shared by the queries
+// on the BE. The cache is disabled if it's 0.
+CONF_String(query_cache_limit, "0");
+// The max bytes of the contiguous data pages of a column which are read in one IO when the pages are read
+// sequentially, which are kept by each column iterator. 0 means reading the pages one by one.
+CONF_mInt64(column_page_read_ahead_bytes, "262144");
+// The data pages of all the columns read by a segment iterator for the next row range are merged into ranges of
+// at most segment_read_coalesce_max_bytes bytes if their gaps are at most segment_read_coalesce_max_gap bytes, and
+// each range is read in one IO. 0 means reading the pages of the columns separately.
+CONF_mInt64(segment_read_coalesce_max_bytes, "4194304");
+CONF_mInt64(segment_read_coalesce_max_gap, "65536");
+// Whether to hint all the merged ranges of a segment iterator to the file before reading them one by one, so the
+// kernel submits their reads to the disk together instead of waiting for each one in turn.
+CONF_mBool(enable_segment_read_prefetch, "true");
+// Whether to encode the new segments of the TINYINT, SMALLINT, INT and BIGINT columns by the patched
+// frame-of-reference coding, instead of the default encoding.
+CONF_mBool(enable_pfor_encoding, "false");
+// The rows of each block zone map written along with the page zone maps, which prunes the rows inside a page for the
+// selective predicates. 0 means no block zone maps.
+CONF_mInt32(zone_map_block_rows, "0");
+// Whether to build an inverted index of the tokens for each CHAR/VARCHAR column, which is used to filter the rows by
+// the LIKE predicates, e.g. `msg LIKE '%timeout%'`.
+CONF_mBool(enable_string_inverted_index, "false");
+// The bytes of each gram of the n-gram bloom filters, which are written along with the bloom filters of the
+// CHAR/VARCHAR columns, and used to filter the pages by the LIKE predicates, e.g. `url LIKE '%/checkout%'`.
+// 0 means no n-gram bloom filters.
+CONF_mInt32(ngram_bloom_filter_gram_size, "0");
 // whether to disable column pool
 CONF_Bool(disable_column_pool, "false");
+// Whether to take the columns of the chunks created by Chunk::clone_empty() from the column pools, so the operators
+// creating many small chunks reuse the columns and their reserved buffers instead of allocating them for each chunk.
+CONF_mBool(enable_pooled_clone_empty, "false");
 
 CONF_mInt32(base_compaction_check_interval_seconds, "60");
 CONF_mInt64(min_base_compaction_num_singleton_deltas, "5");
@@ -277,6 +345,23 @@ CONF_mInt32(cumulative_compaction_skip_window_seconds, "30");
 CONF_mInt32(update_compaction_check_interval_seconds, "60");
 CONF_Int32(update_compaction_num_threads_per_disk, "1");
 CONF_Int32(update_compaction_per_tablet_min_interval_seconds, "120"); // 2min
+// Number of threads looking up the shards of the persistent indexes and generating the delete vectors of the old
+// segments in parallel while applying the loads into the primary key tablets. 0 means doing them one by one.
+CONF_Int32(update_apply_parallel_thread_num, "8");
+// The shards of a persistent index are looked up in parallel only for the batches of at least so many keys.
+CONF_mInt32(update_apply_parallel_min_keys, "16384");
+
+// Whether the in-memory primary indexes keep a 64-bit fingerprint of each key longer than 40 bytes in the hash table
+// and copy the full keys into a shared arena, instead of one std::string per key.
+CONF_mBool(enable_compact_primary_index, "true");
+// The l0 of a persistent index flushed to disk is merged into its l1, and the l1 is merged into the l2 below it
+// once the file of l1 is larger than 1/persistent_index_l2_merge_ratio of l2's, so each l0 flush only rewrites
+// a fraction of the index. 0 means never merging l1 into l2.
+CONF_mInt32(persistent_index_l2_merge_ratio, "10");
+// Whether to write a bloom filter for each shard of the persistent index files, so that looking up a new key
+// skips reading the shard from disk. The bloom filters are kept in memory, taking about one byte per key.
+// If false, only the l1 above an l2 has bloom filters.
+CONF_mBool(enable_persistent_index_bloom_filter, "true");
 
 // if compaction of a tablet failed, this tablet should not be chosen to
 // compaction until this interval passes.
@@ -303,6 +388,38 @@ CONF_mInt64(min_cumulative_compaction_size, "5368709120");
 // 20GB
 CONF_mInt64(min_base_compaction_size, "21474836480");
 
+// Whether the tablets without primary keys are compacted by the size-tiered policy instead of the base and cumulative
+// one. The size-tiered policy merges the consecutive rowsets of similar sizes, and schedules the tablets by the read
+// amplification removed per unit of the compaction I/O.
+CONF_mBool(enable_size_tiered_compaction_strategy, "false");
+// The max ratio of the largest rowset to the smallest one merged by a size-tiered compaction.
+CONF_mInt64(size_tiered_compaction_level_multiple, "5");
+// The rowsets smaller than this are of the same size tier.
+CONF_mInt64(size_tiered_compaction_min_level_size, "134217728");
+// The write amplification budget of the size-tiered compaction: a merge is worth it if it rewrites at most this many
+// bytes for each source it removes from the reads.
+CONF_mInt64(size_tiered_compaction_bytes_per_source, "67108864");
+// The tablets of more sources than this are compacted by the size-tiered policy regardless of the write budget.
+CONF_mInt64(size_tiered_compaction_max_read_amplification, "100");
+// The queried tablets are compacted first: the compaction score of a tablet is weighted by
+// 1 + log2(1 + heat / compaction_scan_heat_unit_bytes), where the heat is the bytes read by the queries of the tablet,
+// halved every compaction_scan_heat_half_life_seconds. 0 disables the weighting.
+CONF_mInt64(compaction_scan_heat_half_life_seconds, "3600");
+CONF_mInt64(compaction_scan_heat_unit_bytes, "1073741824");
+// Whether the compaction of a duplicate keys tablet links the segment files of its input rowsets into the output
+// rowset instead of rewriting them, if the key ranges of the input rowsets don't overlap.
+CONF_mBool(enable_compaction_segment_link, "true");
+// The min average size of the segments linked by a compaction, the smaller segments are merged.
+CONF_mInt64(compaction_segment_link_min_segment_size, "67108864");
+// Whether the bytes read by the compactions of a disk are limited by a rate adapting to the latency of the queries
+// reading the same disk.
+CONF_mBool(enable_compaction_io_throttle, "false");
+// The range of the compaction read rate of a disk, in bytes per second.
+CONF_mInt64(compaction_io_max_bytes_per_second, "209715200");
+CONF_mInt64(compaction_io_min_bytes_per_second, "10485760");
+// The compaction read rate of a disk is halved once the average latency of the query I/Os of the disk exceeds this.
+CONF_mInt64(compaction_io_target_latency_us, "10000");
+
 // Max row source mask memory bytes, default is 200M.
 // Should be smaller than compaction_mem_limit.
 // When the row source mask buffer exceeds this, it will be persisted to a temporary file on the disk.
@@ -328,6 +445,10 @@ CONF_Int32(number_tablet_writer_threads, "16");
 CONF_Double(dictionary_encoding_ratio, "0.7");
 // The minimum chunk size for dictionary encoding speculation
 CONF_Int32(dictionary_speculate_min_chunk_size, "10000");
+// The CHAR/VARCHAR columns of the segments loaded into a tablet are encoded as the previous segment of the tablet
+// without speculating the encoding again, and the encoding is speculated again every so many segments.
+// 0 means speculating the encoding of every segment.
+CONF_mInt32(dictionary_encoding_hint_segments, "16");
 
 // The maximum amount of data that can be processed by a stream load
 CONF_mInt64(streaming_load_max_mb, "10240");
@@ -404,6 +525,49 @@ CONF_String(pprof_profile_dir, "${STARROCKS_HOME}/log");
 // CONF_Bool(enable_partitioned_hash_join, "false")
 CONF_Bool(enable_partitioned_aggregation, "true");
 
+// When spilling is enabled by the query, the hash join build side is spilled to the storage paths and joined
+// partition by partition, once the memory of the query exceeds this percent of the query memory limit.
+CONF_mInt32(hash_join_spill_mem_limit_percent, "80");
+// The number of partitions which the build and probe inputs of the spilled hash join are split into.
+// It is rounded up to a power of two, and at most 1024.
+CONF_mInt32(hash_join_spill_num_partitions, "16");
+// When spilling is enabled by the query, the intermediate states of the blocking aggregation are spilled to the
+// storage paths and merged partition by partition, once the memory of the query exceeds this percent of the query
+// memory limit.
+CONF_mInt32(agg_spill_mem_limit_percent, "80");
+// The number of partitions which the spilled aggregation states are split into.
+// It is rounded up to a power of two, and at most 1024.
+CONF_mInt32(agg_spill_num_partitions, "16");
+// When spilling is enabled by the query, the sorted runs of the full sort are spilled to the storage paths and
+// merged from there, once the memory of the query exceeds this percent of the query memory limit.
+CONF_mInt32(sort_spill_mem_limit_percent, "80");
+// The spillable hash join builds, aggregations and full sorts of the queries enabling spilling also spill once all
+// the queries of the BE together use more than this percent of the query pool memory limit, so the memory is taken
+// back from them before the queries exceed the pool limit and get cancelled. 0 disables it.
+CONF_mInt32(spill_query_pool_mem_limit_percent, "90");
+// Whether to sort the leading fixed-width columns of a multi-column ORDER BY by normalized keys, which pack them
+// into a memcmp-able integer of at most 16 bytes.
+CONF_mBool(enable_sort_normalized_key, "true");
+// Whether the ORDER BY without limit is merged by all the drivers of the source pipeline, each of which merges a key
+// range split by the splitters sampled from the sorted runs, instead of a single driver.
+CONF_mBool(enable_sort_parallel_merge, "false");
+// Whether the sorted input of an analytic with PARTITION BY, which is output by a single driver, is shuffled by the
+// partition keys to all the drivers, so that the partitions are evaluated in parallel.
+CONF_mBool(enable_analytic_local_shuffle, "true");
+// Whether the top-n above an OLAP scan pushes the bound of its first ORDER BY column down to the scan, which
+// prunes the segments and pages by zone maps and filters the chunks being read.
+CONF_mBool(enable_topn_runtime_filter, "true");
+// The maximum bytes kept by the per-partition top-n sorters of a partition-wise top-n, e.g. ROW_NUMBER() <= K.
+// Beyond it the partition-wise top-n passes the input through, since it's only a pre-filter of the analytic.
+CONF_mInt64(local_partition_topn_max_buffered_bytes, "268435456");
+// Whether the aggregation grouping by the codes of a low-cardinality global dictionary indexes the agg states by
+// the codes directly, instead of hashing them.
+CONF_mBool(enable_agg_dict_code_hash_map, "true");
+// The count/sum distinct of a TINYINT/SMALLINT/INT/BIGINT column switches the hash set of a group to a bitmap once
+// it has more than this number of distinct values. The bitmap is also the intermediate state sent to the second
+// phase, which isn't understood by the BEs before this option is introduced. 0 disables the switch.
+CONF_mInt64(distinct_agg_bitmap_threshold, "4096");
+
 // to forward compatibility, will be removed later
 CONF_mBool(enable_token_check, "true");
 
@@ -411,6 +575,15 @@ CONF_mBool(enable_token_check, "true");
 CONF_Bool(enable_system_metrics, "true");
 
 CONF_mBool(enable_prefetch, "true");
+// The hash join probe prefetches the build rows only when the hash table has at least this number of rows, since
+// a smaller hash table is likely to fit in the CPU cache.
+CONF_mInt64(join_hash_table_prefetch_min_rows, "131072");
+// A single INT or BIGINT join key is looked up by direct mapping, that is, the buckets are indexed by the key minus
+// the min build key, when the range of the build keys is at most this multiple of the build rows. 0 disables it.
+CONF_mInt32(join_hash_table_direct_mapping_max_range_ratio, "2");
+// Whether to report the actual build rows, the estimated number of distinct build keys and the probe rows of the
+// hash joins to FE. Estimating the distinct keys costs hashing the build keys once more.
+CONF_mBool(report_join_statistics, "true");
 
 // Number of cores StarRocks will used, this will effect only when it's greater than 0.
 // Otherwise, StarRocks will use all cores returned from "/proc/cpuinfo".
@@ -456,6 +629,15 @@ CONF_mInt64(write_buffer_size, "104857600");
 CONF_Int64(load_process_max_memory_limit_bytes, "107374182400"); // 100GB
 CONF_Int32(load_process_max_memory_limit_percent, "30");         // 30%
 CONF_Bool(enable_new_load_on_memory_limit_exceeded, "false");
+// Whether a tablets channel flushes its largest MemTables when the memory limit of the load is exceeded,
+// instead of the MemTable of the tablet being written, which may be tiny with many buckets.
+CONF_mBool(load_flush_largest_memtables_on_memory_limit, "true");
+// The MemTables of at least this percent of write_buffer_size are flushed first on the memory limit of a load, and the
+// smaller ones only if the limit is still exceeded after the backpressure below, since they produce small segments.
+CONF_mInt32(load_flush_min_memtable_percent, "25");
+// The max milliseconds for which a load waits for the memory released by the flushes in progress on its memory limit,
+// before flushing its small MemTables early.
+CONF_mInt32(load_memory_backpressure_max_wait_ms, "200");
 CONF_Int64(compaction_max_memory_limit, "-1");
 CONF_Int32(compaction_max_memory_limit_percent, "100");
 CONF_Int64(compaction_memory_limit_per_worker, "2147483648"); // 2GB
@@ -494,6 +676,10 @@ CONF_Int32(routine_load_thread_pool_size, "10");
 // kafka reqeust timeout
 CONF_Int32(routine_load_kafka_timeout_second, "10");
 
+// The json objects consumed by a routine load are batched into one stream of documents of at most so many bytes,
+// which is parsed by the scanner at once instead of one document by one. 0 means no batching.
+CONF_mInt64(routine_load_json_batch_bytes, "65536");
+
 // Is set to true, index loading failure will not causing BE exit,
 // and the tablet will be marked as bad, so that FE will try to repair it.
 // CONF_Bool(auto_recover_index_loading_failure, "false");
@@ -540,6 +726,13 @@ CONF_mInt32(storage_flood_stage_usage_percent, "95"); // 95%
 CONF_mInt64(storage_flood_stage_left_capacity_bytes, "1073741824"); // 1GB
 // Number of thread for flushing memtable per store.
 CONF_Int32(flush_thread_num_per_store, "2");
+// Number of threads encoding and compressing the columns of the segments being flushed in parallel, which speeds up
+// the flushes of the wide tables. 0 means encoding the columns of a segment by the flush thread one by one.
+CONF_Int32(segment_write_parallel_thread_num, "8");
+// The columns of a chunk written into a segment are encoded in parallel only if it has at least so many columns and
+// segment_write_parallel_min_rows rows.
+CONF_mInt32(segment_write_parallel_min_columns, "32");
+CONF_mInt32(segment_write_parallel_min_rows, "4096");
 
 // Config for tablet meta checkpoint.
 CONF_mInt32(tablet_meta_checkpoint_min_new_rowsets_num, "10");
@@ -549,6 +742,14 @@ CONF_mInt32(tablet_meta_checkpoint_min_interval_secs, "600");
 CONF_Int64(brpc_max_body_size, "2147483648");
 // Max unwritten bytes in each socket, if the limit is reached, Socket.Write fails with EOVERCROWDED.
 CONF_Int64(brpc_socket_max_unwritten_bytes, "1073741824");
+// The exchange requests whose attachment is at least so many bytes are sent by the large payload transport,
+// instead of the connection shared with the small requests. 0 means disabling the large payload transport.
+CONF_mInt64(brpc_large_payload_bytes, "0");
+// The brpc connection type of the large payload transport, i.e. single, pooled or short.
+CONF_String(brpc_large_payload_connection_type, "pooled");
+// Whether the large payload transport uses RDMA, which requires brpc built with RDMA support.
+// It falls back to TCP if RDMA isn't supported or the RDMA channel cannot be initialized.
+CONF_Bool(brpc_large_payload_use_rdma, "false");
 
 // Max number of txns for every txn_partition_map in txn manager.
 // this is a self protection to avoid too many txns saving in manager.
@@ -571,6 +772,10 @@ CONF_Int32(txn_shard_size, "1024");
 // Whether to continue to start be when load tablet from header failed.
 CONF_Bool(ignore_load_tablet_failure, "false");
 
+// The number of threads of a data dir to create the tablets from their metas when be starts,
+// the tablets of the different data dirs are always loaded in parallel.
+CONF_Int32(load_tablet_meta_thread_num_per_data_dir, "8");
+
 // Whether to continue to start be when load tablet from header failed.
 CONF_Bool(ignore_rowset_stale_unconsistent_delete, "false");
 
@@ -613,6 +818,13 @@ CONF_mInt16(null_encoding, "0");
 
 // Do pre-aggregate if effect great than the factor, factor range:[1-100].
 CONF_Int16(pre_aggregate_factor, "80");
+// Whether the pipeline streaming pre-aggregation in the AUTO mode switches adaptively among aggregating all the rows,
+// aggregating only the rows hitting a hash table of limited size, and passing all the rows through, by the reduction
+// observed every pipeline_adaptive_preagg_window_chunks chunks.
+CONF_mBool(pipeline_enable_adaptive_preagg, "false");
+CONF_mInt32(pipeline_adaptive_preagg_window_chunks, "8");
+// After passing all the rows through for this number of windows, probe the hash table again for one window.
+CONF_mInt32(pipeline_adaptive_preagg_probe_windows, "16");
 
 #ifdef __x86_64__
 // Enable genearate minidump for crash.
@@ -649,12 +861,90 @@ CONF_Int64(pipeline_hdfs_scan_thread_pool_thread_num, "48");
 CONF_Int64(pipeline_scan_thread_pool_queue_size, "102400");
 // The number of execution threads for pipeline engine.
 CONF_Int64(pipeline_exec_thread_pool_thread_num, "0");
+// Whether to use WorkStealingDriverQueue, which has a local ready queue per execution thread
+// and steals drivers from the other threads, instead of the global QuerySharedDriverQueue.
+// It only takes effect for the pipeline executor without resource group.
+CONF_Bool(pipeline_enable_work_stealing_driver_queue, "false");
+// Whether to bind the pipeline execution threads and scan threads to NUMA nodes.
+// The i-th worker thread is bound to the (i % num_numa_nodes)-th NUMA node, and the WorkStealingDriverQueue
+// prefers to run a driver on the NUMA node which ran it the last time.
+CONF_Bool(enable_numa_aware_execution, "false");
+// The maximum time(us) the poller thread waits for an event which may make the blocked drivers ready,
+// when none of the blocked drivers is ready. 0 means that the poller thread spins without waiting.
+// The events include receiving chunks, freeing capacity of SinkBuffer, delivering runtime filters
+// and finishing scan io tasks.
+CONF_mInt64(pipeline_poller_max_wait_us, "0");
+// Whether to run the first round of the fragment which has only one driver on the RPC thread,
+// instead of waking up a pipeline worker thread. It reduces the latency of the short queries,
+// e.g. point lookups on primary key tables. It only takes effect when the resource group is disabled.
+CONF_mBool(pipeline_enable_short_query_inline_execution, "false");
+// Whether to fuse the adjacent project, select and limit operators of a pipeline into one operator,
+// to reduce the overhead of moving chunks between operators.
+CONF_mBool(pipeline_enable_operator_fusion, "false");
+// Whether to count the cpu cycles, instructions and last level cache misses of each pipeline operator by the
+// hardware counters of perf_event, and show them in the profile. It needs the permission of perf_event_open,
+// and adds a few reads of the counters to each pull_chunk and push_chunk.
+CONF_mBool(pipeline_enable_hardware_counters, "false");
+// Whether to record the timeline of each query, i.e. the driver states, the scan io tasks and the exchange rpcs,
+// which can be dumped in the Chrome trace event format by /api/query_trace/{query_id}.
+CONF_mBool(pipeline_enable_query_trace, "false");
+// The max number of the events recorded in the trace of a query, the events beyond it are dropped.
+CONF_mInt64(pipeline_query_trace_max_events, "1000000");
+// The max number of the query traces kept in memory, the oldest one is evicted beyond it.
+CONF_mInt32(pipeline_query_trace_max_num, "16");
+// The directory to capture the plan fragments received by this BE into, one sub-directory per query, which can
+// be replayed against a test BE by `starrocks_be fragment_replay`. Empty means that nothing is captured.
+CONF_mString(plan_fragment_capture_dir, "");
+// The max number of the plan fragments captured since BE starts, the fragments beyond it are not captured.
+CONF_mInt64(plan_fragment_capture_max_num, "10000");
+// The frequency of sampling the stacks of the threads running the queries, per second of the cpu time of each
+// thread, and the samples tagged with the query and the operator are served by /api/cpu_samples.
+// 0 means that the sampler is disabled.
+CONF_Int32(cpu_sampler_frequency_hz, "10");
+// The max number of the latest cpu samples kept in memory, each of which takes about 340 bytes.
+CONF_Int64(cpu_sampler_max_samples, "32768");
+// The average bytes allocated between the sampled allocations of each thread, and the stacks and the MemTrackers of
+// the live sampled allocations are served by /api/mem_samples. 0 means that the sampler is disabled.
+CONF_Int64(alloc_sampler_interval_bytes, "0");
+// The max number of the live sampled allocations, each of which takes about 390 bytes.
+CONF_Int64(alloc_sampler_max_samples, "65536");
+// The max number of the descriptor tables shared across the queries with the same descriptor table.
+// 0 means that the descriptor table is created for each query.
+CONF_Int64(descriptor_tbl_cache_capacity, "0");
+// Whether to schedule the scan io tasks of a resource group by the accumulated scan time and the deadline of
+// their queries, instead of in FIFO order, so that the short queries aren't queued behind the huge scans.
+CONF_Bool(pipeline_enable_priority_scan_task_queue, "false");
+// The scan io task of the query whose deadline is within this time(ms) is scheduled first.
+// 0 means that the deadlines of the queries aren't considered.
+CONF_mInt64(pipeline_scan_task_urgent_deadline_ms, "5000");
 // The buffer size of io task.
 CONF_Int64(pipeline_io_buffer_size, "64");
 // The buffer size of SinkBuffer.
 CONF_Int64(pipeline_sink_buffer_size, "64");
 // The degree of parallelism of brpc.
 CONF_Int64(pipeline_sink_brpc_dop, "8");
+// The max time(ms) the rows of a hash partitioned exchange sink are buffered before sent, even though they haven't
+// filled a chunk or a request yet. It's checked when the exchange sink receives a chunk. 0 means no limit.
+CONF_mInt64(pipeline_exchange_sink_max_buffer_delay_ms, "0");
+// A hash partitioned exchange sink samples the hash value of the partition keys every so many rows, to detect the
+// hot keys which are reported in the profile. 0 means disabling the detection.
+CONF_mInt32(pipeline_exchange_skew_detection_sample_interval, "0");
+// Whether SinkBuffer limits the bytes in flight to each receiver by the credit advertised in the transmit responses.
+CONF_mBool(pipeline_sink_enable_credit_flow_control, "false");
+// Whether the exchange sink passes through the chunks to the destination fragment instances on the same BE,
+// even though enable_exchange_pass_through isn't set by FE. The pass-through requests are delivered to
+// the local DataStreamRecvr directly without brpc.
+CONF_mBool(pipeline_enable_local_exchange_pass_through, "false");
+// Whether the hash table of broadcast join is built by the HashJoinBuildOperators of all the drivers in parallel,
+// instead of gathering the build side into a single HashJoinBuildOperator.
+CONF_mBool(pipeline_enable_parallel_broadcast_join_build, "false");
+// Whether CrossJoinLeftOperator evaluates the join conjuncts on tiles of candidate row pairs, which only
+// materialize the columns referenced by the conjuncts. All the columns are materialized for the matched pairs only.
+CONF_mBool(pipeline_cross_join_evaluate_in_tiles, "true");
+// Whether to finalize the blocking aggregation with group by in parallel without shuffling its input by the group by
+// keys locally. Each pipeline driver aggregates its input over all the keys, and then merges its own partition of the
+// intermediate states of all the drivers. It pays off when the aggregation reduces the rows a lot.
+CONF_mBool(pipeline_agg_parallel_merge, "false");
 // Used to reject coming fragment instances, when the number of running drivers
 // exceeds it*pipeline_exec_thread_pool_thread_num.
 CONF_Int64(pipeline_max_num_drivers_per_exec_thread, "10240");
@@ -671,6 +961,28 @@ CONF_Int64(tablet_internal_parallel_max_splitted_scan_bytes, "536870912");
 // Only when scan_dop is not less than min_scan_dop, this table can use tablet internal parallel,
 // where scan_dop = estimated_scan_rows / splitted_scan_rows.
 CONF_Int64(tablet_internal_parallel_min_scan_dop, "4");
+// Whether to shrink the morsels split from the tablets as the scan goes on, so that the drivers finish at about the
+// same time. Each morsel takes about 1/(2*scan_dop) of the rest rows, restricted in the range
+// [min_splitted_scan_rows, splitted_scan_rows].
+CONF_mBool(tablet_internal_parallel_guided_split, "true");
+
+// Whether to limit the degree of parallelism of the olap scan operator by the number of rows of the tablets to read,
+// so that the small query doesn't create a driver for each tablet.
+// The scan operator has at least one driver for every pipeline_adaptive_scan_dop_rows_per_driver rows.
+CONF_mBool(enable_pipeline_adaptive_scan_dop, "false");
+CONF_mInt64(pipeline_adaptive_scan_dop_rows_per_driver, "262144");
+
+// Whether the concurrent scans of the same tablet version and columns share the chunks read by one TabletReader.
+// Only the scans of whole tablets are shared, whose predicates are evaluated on the shared chunks by each scan.
+CONF_mBool(enable_shared_tablet_scan, "false");
+// The number of the recent chunks of a shared tablet scan buffered for the slower scans. A scan falling further behind
+// reads the rest of the tablet by itself.
+CONF_mInt32(shared_tablet_scan_max_buffered_chunks, "16");
+// Whether the queries reading a few full primary keys of a primary key tablet locate the rows by its primary index
+// in memory and read them through the column iterators of their segments, instead of scanning the tablet.
+CONF_mBool(enable_primary_key_point_lookup, "true");
+// The max number of the primary keys of a query served by the primary index.
+CONF_mInt32(primary_key_point_lookup_max_keys, "1024");
 
 // The bitmap serialize version.
 CONF_Int16(bitmap_serialize_version, "1");
@@ -683,6 +995,11 @@ CONF_Int64(max_segment_file_size, "1073741824");
 // This is necessary to use HDFS hedged reads (assuming the HDFS client is configured to do so).
 // hdfsPreadFully() are always enabled for object storage.
 CONF_Bool(use_hdfs_pread, "true");
+// The size of the thread pool of the HDFS client for the hedged reads, 0 means the hedged reads are disabled.
+// If a pread doesn't return in hdfs_client_hedged_read_threshold_millis, another read of the same range is issued to
+// another datanode, and the first response is taken, so a straggling datanode doesn't stall the scan.
+CONF_Int32(hdfs_client_hedged_read_threadpool_size, "0");
+CONF_Int32(hdfs_client_hedged_read_threshold_millis, "500");
 
 // Rewrite partial semgent or not.
 // if true, partial segment will be rewrite into new segment file first and append other column data
@@ -698,19 +1015,59 @@ CONF_String(object_storage_endpoint, "");
 // Tencent cos needs to add region information
 CONF_String(object_storage_region, "");
 CONF_Int64(object_storage_max_connection, "102400");
+// A read_at_fully of the object storage larger than the part size is split into the ranged GETs of the parts, which
+// are downloaded in parallel by at most object_storage_download_thread_num threads. 0 means no split.
+CONF_Int64(object_storage_download_part_size, "4194304");
+CONF_Int32(object_storage_download_thread_num, "32");
 
 CONF_Bool(enable_orc_late_materialization, "true");
 // orc reader, if RowGroup/Stripe/File size is less than this value, read all data.
 CONF_Int32(orc_file_cache_max_size, "2097152");
 // parquet reader, each column will reserve X bytes for read
 CONF_mInt32(parquet_buffer_stream_reserve_size, "1048576");
+// parquet reader, skip the pages whose min/max values of the page index(ColumnIndex) do not satisfy the conjuncts
+CONF_mBool(parquet_page_index_enable, "true");
+// parquet reader, skip the row groups whose bloom filters of column chunks do not contain the values of
+// the equality and IN conjuncts
+CONF_mBool(parquet_bloom_filter_enable, "true");
+// parquet reader, read the columns without conjuncts only for the rows selected by the conjuncts on the other columns
+CONF_mBool(parquet_late_materialization_enable, "true");
+// parquet reader, the column chunks of a row group to read are merged into ranges of at most
+// parquet_read_coalesce_max_bytes bytes if their gaps are at most parquet_read_coalesce_max_gap bytes, and each
+// range is read in one IO into a buffer shared by the column readers. 0 means reading the column chunks separately.
+CONF_mInt64(parquet_read_coalesce_max_bytes, "8388608");
+CONF_mInt64(parquet_read_coalesce_max_gap, "1048576");
+// parquet reader, the files of at most this size are read in one IO, including the footer. 0 disables it.
+CONF_mInt64(parquet_read_fully_max_file_bytes, "1048576");
+
+// Whether to cache the blocks of the remote files of the external tables, e.g. the files on HDFS or S3, in the memory
+// and on the local disk.
+CONF_Bool(block_cache_enable, "false");
+// The memory limit of the block cache, 0 means the blocks are cached on the disk only.
+CONF_String(block_cache_mem_size, "2147483648");
+// The directory of the blocks cached on the disk, which is cleared on startup. Empty means no disk cache.
+CONF_String(block_cache_disk_path, "");
+// The disk limit of the block cache.
+CONF_String(block_cache_disk_size, "107374182400");
+// The size of the blocks of the block cache.
+CONF_Int64(block_cache_block_size, "1048576");
+// The number of the threads writing the blocks into the disk cache.
+CONF_Int32(block_cache_populate_thread_num, "2");
 
 // default: 16MB
 CONF_mInt64(experimental_s3_max_single_part_size, "16777216");
 // default: 16MB
 CONF_mInt64(experimental_s3_min_upload_part_size, "16777216");
+// The parts of a multipart upload to the object storage are uploaded in the background while the writer keeps
+// writing, at most so many parts of an upload are buffered or being uploaded. 1 means uploading synchronously.
+CONF_mInt32(object_storage_upload_max_inflight_parts, "4");
+// The number of the threads uploading the parts, shared by all the uploads.
+CONF_Int32(object_storage_upload_thread_num, "32");
 
 CONF_Int64(max_load_dop, "16");
+// The max bytes of the chunk of a request sent by a tablet sink to a node. The chunk grows over the chunk size while
+// all the requests to the node are in flight, so that a busy node gets fewer but larger requests.
+CONF_mInt64(tablet_sink_max_chunk_bytes, "16777216");
 
 CONF_Int64(meta_threshold_to_manual_compact, "10737418240"); // 10G
 CONF_Bool(manual_compact_before_data_dir_load, "false");
@@ -721,6 +1078,9 @@ CONF_Int64(deliver_broadcast_rf_passthrough_bytes_limit, "131072");
 // in passthrough style, the number of inflight RPCs of parallel deliveries are issued is not exceeds this limit.
 CONF_Int64(deliver_broadcast_rf_passthrough_inflight_num, "10");
 CONF_Int64(send_rpc_runtime_filter_timeout_ms, "1000");
+// The number of chunks, out of every 32 probe chunks, on which every runtime bloom filter is evaluated to
+// measure its selectivity and cost. The filters that do not pay off are skipped until the next sampling.
+CONF_mInt32(runtime_filter_sample_chunk_num, "2");
 
 // enable optimized implementation of schema change
 CONF_Bool(enable_schema_change_v2, "true");
@@ -733,6 +1093,10 @@ CONF_Bool(enable_schema_change_v2, "true");
 // default: true
 CONF_Bool(enable_segment_overflow_read_chunk, "true");
 
+// Whether to read the predicate columns of a segment one by one, each only for the rows passed the predicates of the
+// previous ones. The columns rejecting more rows at a lower cost, measured while scanning, are read first.
+CONF_mBool(enable_segment_predicate_column_cascade, "false");
+
 CONF_Int32(max_batch_publish_latency_ms, "100");
 
 // Config for opentelemetry tracing.
@@ -24,6 +24,7 @@
 #include <thrift/protocol/TDebugProtocol.h>
 #include <unistd.h>
 
+#include <algorithm>
 #include <sstream>
 
 #include "column/column_helper.h"
@@ -582,6 +583,74 @@ Status eager_prune_eval_conjuncts(const std::vector<ExprContext*>& ctxs, vectori
     return Status::OK();
 }
 
+// Evaluate the conjuncts from the `from`th one only on the rows selected by filter, and merge their results
+// into filter. The selected rows of the columns used by these conjuncts are gathered into a narrow chunk, so
+// the other columns are not copied and the unselected rows are not evaluated.
+// Return false and leave filter unchanged if the conjuncts can't be evaluated this way.
+static StatusOr<bool> eval_conjuncts_on_selected_rows(const std::vector<ExprContext*>& ctxs, size_t from,
+                                                      vectorized::Chunk* chunk, vectorized::Column::Filter* filter) {
+    std::vector<SlotId> slot_ids;
+    for (size_t i = from; i < ctxs.size(); ++i) {
+        ctxs[i]->root()->get_slot_ids(&slot_ids);
+    }
+    if (slot_ids.empty()) {
+        return false;
+    }
+    std::sort(slot_ids.begin(), slot_ids.end());
+    slot_ids.erase(std::unique(slot_ids.begin(), slot_ids.end()), slot_ids.end());
+    for (SlotId slot_id : slot_ids) {
+        if (!chunk->is_slot_exist(slot_id)) {
+            return false;
+        }
+    }
+
+    vectorized::Buffer<uint32_t> selection;
+    selection.reserve(filter->size() - SIMD::count_zero(*filter));
+    for (uint32_t i = 0; i < filter->size(); ++i) {
+        if ((*filter)[i]) {
+            selection.emplace_back(i);
+        }
+    }
+
+    vectorized::Chunk selected_chunk;
+    for (SlotId slot_id : slot_ids) {
+        const ColumnPtr& column = chunk->get_column_by_slot_id(slot_id);
+        ColumnPtr selected_column;
+        if (column->is_constant()) {
+            selected_column = column->clone_shared();
+            selected_column->resize(selection.size());
+        } else {
+            selected_column = column->clone_empty();
+            selected_column->append_selective(*column, selection);
+        }
+        selected_chunk.append_column(std::move(selected_column), slot_id);
+    }
+
+    vectorized::Column::Filter selected_filter(selection.size(), 1);
+    for (size_t i = from; i < ctxs.size(); ++i) {
+        ASSIGN_OR_RETURN(ColumnPtr column, ctxs[i]->evaluate(&selected_chunk));
+        size_t true_count = vectorized::ColumnHelper::count_true_with_notnull(column);
+
+        if (true_count == column->size()) {
+            continue;
+        } else if (0 == true_count) {
+            selected_filter.assign(selection.size(), 0);
+            break;
+        } else {
+            bool all_zero = false;
+            vectorized::ColumnHelper::merge_two_filters(column, &selected_filter, &all_zero);
+            if (all_zero) {
+                break;
+            }
+        }
+    }
+
+    for (size_t i = 0; i < selection.size(); ++i) {
+        (*filter)[selection[i]] = selected_filter[i];
+    }
+    return true;
+}
+
 Status ExecNode::eval_conjuncts(const std::vector<ExprContext*>& ctxs, vectorized::Chunk* chunk,
                                 vectorized::FilterPtr* filter_ptr) {
     // No need to do expression if none rows
@@ -610,8 +679,15 @@ Status ExecNode::eval_conjuncts(const std::vector<ExprContext*>& ctxs, vectorize
     }
     vectorized::Column::Filter* raw_filter = filter.get();
 
-    for (auto* ctx : ctxs) {
-        ASSIGN_OR_RETURN(ColumnPtr column, ctx->evaluate(chunk));
+    // the chunk is too wide to prune eagerly, so once few rows are selected,
+    // the following conjuncts are evaluated only on the selected rows of the columns they use.
+    const float selected_eval_ratio = 0.8;
+    const int selected_eval_min_size = 1024;
+    const size_t selected_eval_threshold =
+            std::max<size_t>(chunk->num_rows() * selected_eval_ratio, selected_eval_min_size);
+
+    for (size_t i = 0; i < ctxs.size(); ++i) {
+        ASSIGN_OR_RETURN(ColumnPtr column, ctxs[i]->evaluate(chunk));
         size_t true_count = vectorized::ColumnHelper::count_true_with_notnull(column);
 
         if (true_count == column->size()) {
@@ -628,6 +704,16 @@ Status ExecNode::eval_conjuncts(const std::vector<ExprContext*>& ctxs, vectorize
                 chunk->set_num_rows(0);
                 return Status::OK();
             }
+            if (i + 1 < ctxs.size() && SIMD::count_zero(*raw_filter) > selected_eval_threshold) {
+                ASSIGN_OR_RETURN(bool evaluated, eval_conjuncts_on_selected_rows(ctxs, i + 1, chunk, raw_filter));
+                if (evaluated) {
+                    if (SIMD::count_nonzero(*raw_filter) == 0) {
+                        chunk->set_num_rows(0);
+                        return Status::OK();
+                    }
+                    break;
+                }
+            }
         }
     }
 
@@ -0,0 +1,127 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+namespace starrocks::pipeline {
+
+// AdaptivePreaggregation decides how AggregateStreamingSinkOperator handles the input chunks in the AUTO streaming
+// pre-aggregation mode, from the reduction observed over the recent windows of chunks.
+//
+// There are three modes:
+// - AGGREGATE: all the rows are aggregated into the hash table, which may grow.
+// - LIMITED: the hash table doesn't grow any more. The rows whose keys are already in the hash table are aggregated,
+//   and the others are passed through.
+// - STREAMING: all the rows are passed through without probing the hash table.
+//
+// At the end of each window, the observed reduction is compared with the minimum reduction required by the current
+// size of the hash table, which grows with the hash table for the cost of cache misses.
+// - AGGREGATE switches to LIMITED if the reduction, i.e. the aggregated rows per new group, is too small, or the
+//   hash table is full.
+// - LIMITED switches to STREAMING if few rows hit the hash table, and back to AGGREGATE if the hit rate implies
+//   enough reduction and the hash table isn't full.
+// - STREAMING switches to LIMITED every `probe_windows` windows to refresh the estimation, since the data may change.
+class AdaptivePreaggregation {
+public:
+    enum class Mode { AGGREGATE, LIMITED, STREAMING };
+
+    AdaptivePreaggregation(size_t window_chunks, size_t probe_windows)
+            : _window_chunks(std::max<size_t>(1, window_chunks)), _probe_windows(std::max<size_t>(1, probe_windows)) {}
+
+    Mode mode() const { return _mode; }
+
+    // Update the statistics with a chunk of `input_rows` rows, `aggregated_rows` of which are aggregated into the hash
+    // table and `new_groups` of which are inserted as new groups. Return true if the mode is switched.
+    bool update(size_t input_rows, size_t aggregated_rows, size_t new_groups, double min_reduction, bool ht_full) {
+        _window_input_rows += input_rows;
+        _window_aggregated_rows += aggregated_rows;
+        _window_new_groups += new_groups;
+
+        // A full hash table mustn't grow any more, so don't wait for the end of the window.
+        if (_mode == Mode::AGGREGATE && ht_full) {
+            return _switch_to(Mode::LIMITED);
+        }
+        if (++_window_num_chunks < _window_chunks) {
+            return false;
+        }
+
+        switch (_mode) {
+        case Mode::AGGREGATE:
+            if (_window_new_groups > 0 &&
+                static_cast<double>(_window_aggregated_rows) / _window_new_groups < min_reduction) {
+                return _switch_to(Mode::LIMITED);
+            }
+            break;
+        case Mode::LIMITED: {
+            const double hit_rate =
+                    _window_input_rows == 0 ? 0 : static_cast<double>(_window_aggregated_rows) / _window_input_rows;
+            if (hit_rate < MIN_HIT_RATE) {
+                return _switch_to(Mode::STREAMING);
+            }
+            // The missed rows are the upper bound of the new groups, so 1 / (1 - hit_rate) underestimates the
+            // reduction which would be got by growing the hash table.
+            if (!ht_full && (hit_rate >= 1 || 1 / (1 - hit_rate) >= min_reduction)) {
+                return _switch_to(Mode::AGGREGATE);
+            }
+            break;
+        }
+        case Mode::STREAMING:
+            if (++_num_streaming_windows >= _probe_windows) {
+                return _switch_to(Mode::LIMITED);
+            }
+            break;
+        }
+        _reset_window();
+        return false;
+    }
+
+    size_t num_switches() const { return _num_switches; }
+
+    static const char* mode_name(Mode mode) {
+        switch (mode) {
+        case Mode::AGGREGATE:
+            return "AGGREGATE";
+        case Mode::LIMITED:
+            return "LIMITED";
+        case Mode::STREAMING:
+            return "STREAMING";
+        }
+        return "UNKNOWN";
+    }
+
+    // The probing in the LIMITED mode doesn't pay off if fewer rows hit the hash table.
+    static constexpr double MIN_HIT_RATE = 0.1;
+
+private:
+    bool _switch_to(Mode mode) {
+        _mode = mode;
+        _num_switches++;
+        _num_streaming_windows = 0;
+        _reset_window();
+        return true;
+    }
+
+    void _reset_window() {
+        _window_num_chunks = 0;
+        _window_input_rows = 0;
+        _window_aggregated_rows = 0;
+        _window_new_groups = 0;
+    }
+
+    const size_t _window_chunks;
+    const size_t _probe_windows;
+
+    Mode _mode = Mode::AGGREGATE;
+    size_t _num_switches = 0;
+    size_t _num_streaming_windows = 0;
+
+    size_t _window_num_chunks = 0;
+    size_t _window_input_rows = 0;
+    size_t _window_aggregated_rows = 0;
+    size_t _window_new_groups = 0;
+};
+
+} // namespace starrocks::pipeline
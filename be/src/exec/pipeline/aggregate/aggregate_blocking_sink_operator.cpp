@@ -20,7 +20,12 @@ void AggregateBlockingSinkOperator::close(RuntimeState* state) {
 Status AggregateBlockingSinkOperator::set_finishing(RuntimeState* state) {
     _is_finished = true;
 
-    if (!_aggregator->is_none_group_by_exprs()) {
+    if (_aggregator->has_parallel_merger()) {
+        // The hash map is output by the source operator after merging its partition of all the aggregators.
+        RETURN_IF_ERROR(_aggregator->partition_for_parallel_merge());
+    } else if (!_aggregator->is_none_group_by_exprs()) {
+        // The spilled partitions are output one by one, beginning with the first non-empty one.
+        RETURN_IF_ERROR(_aggregator->finish_spill(state));
         COUNTER_SET(_aggregator->hash_table_size(), (int64_t)_aggregator->hash_map_variant().size());
         // If hash map is empty, we don't need to return value
         if (_aggregator->hash_map_variant().size() == 0) {
@@ -97,6 +102,9 @@ Status AggregateBlockingSinkOperator::push_chunk(RuntimeState* state, const vect
     }
     _aggregator->update_num_input_rows(chunk_size);
     RETURN_IF_ERROR(_aggregator->check_has_error());
+    if (!_aggregator->is_none_group_by_exprs()) {
+        RETURN_IF_ERROR(_aggregator->try_spill_hash_map(state));
+    }
 
     return Status::OK();
 }
@@ -7,11 +7,11 @@
 namespace starrocks::pipeline {
 
 bool AggregateBlockingSourceOperator::has_output() const {
-    return _aggregator->is_sink_complete() && !_aggregator->is_ht_eos();
+    return _aggregator->is_output_ready() && !_aggregator->is_ht_eos();
 }
 
 bool AggregateBlockingSourceOperator::is_finished() const {
-    return _aggregator->is_sink_complete() && _aggregator->is_ht_eos();
+    return _aggregator->is_output_ready() && _aggregator->is_ht_eos();
 }
 
 Status AggregateBlockingSourceOperator::set_finished(RuntimeState* state) {
@@ -29,6 +29,13 @@ StatusOr<vectorized::ChunkPtr> AggregateBlockingSourceOperator::pull_chunk(Runti
     int32_t chunk_size = state->chunk_size();
     vectorized::ChunkPtr chunk = std::make_shared<vectorized::Chunk>();
 
+    if (_aggregator->needs_parallel_merge()) {
+        RETURN_IF_ERROR(_aggregator->parallel_merge(state));
+        if (_aggregator->is_ht_eos()) {
+            return std::move(chunk);
+        }
+    }
+
     if (_aggregator->is_none_group_by_exprs()) {
         SCOPED_TIMER(_aggregator->get_results_timer());
         _aggregator->convert_to_chunk_no_groupby(&chunk);
@@ -41,6 +48,10 @@ StatusOr<vectorized::ChunkPtr> AggregateBlockingSourceOperator::pull_chunk(Runti
                     *_aggregator->hash_map_variant().NAME, chunk_size, &chunk);
         APPLY_FOR_AGG_VARIANT_ALL(HASH_MAP_METHOD)
 #undef HASH_MAP_METHOD
+
+        if (_aggregator->is_ht_eos() && _aggregator->is_spilled()) {
+            RETURN_IF_ERROR(_aggregator->load_next_spill_partition(state));
+        }
     }
 
     size_t old_size = chunk->num_rows();
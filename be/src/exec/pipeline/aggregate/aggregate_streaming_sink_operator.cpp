@@ -2,6 +2,7 @@
 
 #include "aggregate_streaming_sink_operator.h"
 
+#include "common/config.h"
 #include "runtime/current_thread.h"
 #include "simd/simd.h"
 namespace starrocks::pipeline {
@@ -9,6 +10,17 @@ namespace starrocks::pipeline {
 Status AggregateStreamingSinkOperator::prepare(RuntimeState* state) {
     RETURN_IF_ERROR(Operator::prepare(state));
     RETURN_IF_ERROR(_aggregator->prepare(state, state->obj_pool(), _unique_metrics.get(), _mem_tracker.get()));
+
+    if (_aggregator->streaming_preaggregation_mode() == TStreamingPreaggregationMode::AUTO &&
+        config::pipeline_enable_adaptive_preagg) {
+        _adaptive_preagg = std::make_unique<AdaptivePreaggregation>(config::pipeline_adaptive_preagg_window_chunks,
+                                                                    config::pipeline_adaptive_preagg_probe_windows);
+        _preagg_mode_switches_counter = ADD_COUNTER(_unique_metrics, "PreaggModeSwitches", TUnit::UNIT);
+        _preagg_aggregate_chunks_counter = ADD_COUNTER(_unique_metrics, "PreaggAggregateChunks", TUnit::UNIT);
+        _preagg_limited_chunks_counter = ADD_COUNTER(_unique_metrics, "PreaggLimitedChunks", TUnit::UNIT);
+        _preagg_streaming_chunks_counter = ADD_COUNTER(_unique_metrics, "PreaggStreamingChunks", TUnit::UNIT);
+    }
+
     return _aggregator->open(state);
 }
 
@@ -20,6 +32,11 @@ void AggregateStreamingSinkOperator::close(RuntimeState* state) {
 Status AggregateStreamingSinkOperator::set_finishing(RuntimeState* state) {
     _is_finished = true;
 
+    if (_adaptive_preagg != nullptr) {
+        _unique_metrics->add_info_string("PreaggFinalMode",
+                                         AdaptivePreaggregation::mode_name(_adaptive_preagg->mode()));
+    }
+
     if (_aggregator->hash_map_variant().size() == 0) {
         _aggregator->set_ht_eos();
     }
@@ -87,6 +104,10 @@ Status AggregateStreamingSinkOperator::_push_chunk_by_force_preaggregation(const
 }
 
 Status AggregateStreamingSinkOperator::_push_chunk_by_auto(const size_t chunk_size) {
+    if (_adaptive_preagg != nullptr) {
+        return _push_chunk_by_adaptive(chunk_size);
+    }
+
     // TODO: calc the real capacity of hashtable, will add one interface in the class of habletable
     size_t real_capacity = _aggregator->hash_map_variant().capacity() - _aggregator->hash_map_variant().capacity() / 8;
     size_t remain_size = real_capacity - _aggregator->hash_map_variant().size();
@@ -96,78 +117,87 @@ Status AggregateStreamingSinkOperator::_push_chunk_by_auto(const size_t chunk_si
                                                       _aggregator->mem_pool()->total_allocated_bytes(),
                                                       _aggregator->hash_map_variant().size())) {
         // hash table is not full or allow expand the hash table according reduction rate
+        return _push_chunk_by_force_preaggregation(chunk_size);
+    }
+
+    _push_chunk_by_selection(chunk_size);
+    return Status::OK();
+}
+
+Status AggregateStreamingSinkOperator::_push_chunk_by_adaptive(const size_t chunk_size) {
+    const size_t prev_ht_size = _aggregator->hash_map_variant().size();
+    size_t aggregated_rows = 0;
+    switch (_adaptive_preagg->mode()) {
+    case AdaptivePreaggregation::Mode::AGGREGATE:
+        RETURN_IF_ERROR(_push_chunk_by_force_preaggregation(chunk_size));
+        aggregated_rows = chunk_size;
+        COUNTER_UPDATE(_preagg_aggregate_chunks_counter, 1);
+        break;
+    case AdaptivePreaggregation::Mode::LIMITED:
+        aggregated_rows = _push_chunk_by_selection(chunk_size);
+        COUNTER_UPDATE(_preagg_limited_chunks_counter, 1);
+        break;
+    case AdaptivePreaggregation::Mode::STREAMING:
+        RETURN_IF_ERROR(_push_chunk_by_force_streaming());
+        COUNTER_UPDATE(_preagg_streaming_chunks_counter, 1);
+        break;
+    }
+
+    const size_t ht_size = _aggregator->hash_map_variant().size();
+    const double min_reduction =
+            Aggregator::streaming_ht_min_reduction(_aggregator->mem_pool()->total_allocated_bytes());
+    const bool ht_full = ht_size >= Aggregator::streaming_hash_table_size_threshold;
+    if (_adaptive_preagg->update(chunk_size, aggregated_rows, ht_size - prev_ht_size, min_reduction, ht_full)) {
+        COUNTER_UPDATE(_preagg_mode_switches_counter, 1);
+    }
+    return Status::OK();
+}
+
+size_t AggregateStreamingSinkOperator::_push_chunk_by_selection(const size_t chunk_size) {
+    {
         SCOPED_TIMER(_aggregator->agg_compute_timer());
         if (false) {
         }
-#define HASH_MAP_METHOD(NAME)                                                                                          \
-    else if (_aggregator->hash_map_variant().type == vectorized::AggHashMapVariant::Type::NAME) {                      \
-        TRY_CATCH_BAD_ALLOC(_aggregator->build_hash_map<decltype(_aggregator->hash_map_variant().NAME)::element_type>( \
-                *_aggregator->hash_map_variant().NAME, chunk_size));                                                   \
+#define HASH_MAP_METHOD(NAME)                                                                     \
+    else if (_aggregator->hash_map_variant().type == vectorized::AggHashMapVariant::Type::NAME) { \
+        TRY_CATCH_BAD_ALLOC(_aggregator->build_hash_map_with_selection<typename decltype(         \
+                                    _aggregator->hash_map_variant().NAME)::element_type>(         \
+                *_aggregator->hash_map_variant().NAME, chunk_size));                              \
     }
         APPLY_FOR_AGG_VARIANT_ALL(HASH_MAP_METHOD)
 #undef HASH_MAP_METHOD
         else {
             DCHECK(false);
         }
+    }
 
-        if (_aggregator->is_none_group_by_exprs()) {
-            _aggregator->compute_single_agg_state(chunk_size);
-        } else {
-            _aggregator->compute_batch_agg_states(chunk_size);
-        }
-
-        _mem_tracker->set(_aggregator->hash_map_variant().memory_usage() +
-                          _aggregator->mem_pool()->total_reserved_bytes());
-        TRY_CATCH_BAD_ALLOC(_aggregator->try_convert_to_two_level_map());
-
-        COUNTER_SET(_aggregator->hash_table_size(), (int64_t)_aggregator->hash_map_variant().size());
+    size_t zero_count = SIMD::count_zero(_aggregator->streaming_selection());
+    // very poor aggregation
+    if (zero_count == 0) {
+        SCOPED_TIMER(_aggregator->streaming_timer());
+        vectorized::ChunkPtr chunk = std::make_shared<vectorized::Chunk>();
+        _aggregator->output_chunk_by_streaming(&chunk);
+        _aggregator->offer_chunk_to_buffer(chunk);
+    }
+    // very high aggregation
+    else if (zero_count == _aggregator->streaming_selection().size()) {
+        SCOPED_TIMER(_aggregator->agg_compute_timer());
+        _aggregator->compute_batch_agg_states(chunk_size);
     } else {
+        // middle cases, first aggregate locally and output by stream
         {
             SCOPED_TIMER(_aggregator->agg_compute_timer());
-            if (false) {
-            }
-#define HASH_MAP_METHOD(NAME)                                                                     \
-    else if (_aggregator->hash_map_variant().type == vectorized::AggHashMapVariant::Type::NAME) { \
-        TRY_CATCH_BAD_ALLOC(_aggregator->build_hash_map_with_selection<typename decltype(         \
-                                    _aggregator->hash_map_variant().NAME)::element_type>(         \
-                *_aggregator->hash_map_variant().NAME, chunk_size));                              \
-    }
-            APPLY_FOR_AGG_VARIANT_ALL(HASH_MAP_METHOD)
-#undef HASH_MAP_METHOD
-            else {
-                DCHECK(false);
-            }
+            _aggregator->compute_batch_agg_states_with_selection(chunk_size);
         }
-
-        size_t zero_count = SIMD::count_zero(_aggregator->streaming_selection());
-        // very poor aggregation
-        if (zero_count == 0) {
+        {
             SCOPED_TIMER(_aggregator->streaming_timer());
             vectorized::ChunkPtr chunk = std::make_shared<vectorized::Chunk>();
-            _aggregator->output_chunk_by_streaming(&chunk);
+            _aggregator->output_chunk_by_streaming_with_selection(&chunk);
             _aggregator->offer_chunk_to_buffer(chunk);
         }
-        // very high aggregation
-        else if (zero_count == _aggregator->streaming_selection().size()) {
-            SCOPED_TIMER(_aggregator->agg_compute_timer());
-            _aggregator->compute_batch_agg_states(chunk_size);
-        } else {
-            // middle cases, first aggregate locally and output by stream
-            {
-                SCOPED_TIMER(_aggregator->agg_compute_timer());
-                _aggregator->compute_batch_agg_states_with_selection(chunk_size);
-            }
-            {
-                SCOPED_TIMER(_aggregator->streaming_timer());
-                vectorized::ChunkPtr chunk = std::make_shared<vectorized::Chunk>();
-                _aggregator->output_chunk_by_streaming_with_selection(&chunk);
-                _aggregator->offer_chunk_to_buffer(chunk);
-            }
-        }
-
-        COUNTER_SET(_aggregator->hash_table_size(), (int64_t)_aggregator->hash_map_variant().size());
     }
 
-    return Status::OK();
+    COUNTER_SET(_aggregator->hash_table_size(), (int64_t)_aggregator->hash_map_variant().size());
+    return zero_count;
 }
 } // namespace starrocks::pipeline
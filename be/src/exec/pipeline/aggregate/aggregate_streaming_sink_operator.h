@@ -4,6 +4,7 @@
 
 #include <utility>
 
+#include "exec/pipeline/aggregate/adaptive_preaggregation.h"
 #include "exec/pipeline/operator.h"
 #include "exec/vectorized/aggregator.h"
 
@@ -40,6 +41,13 @@ private:
     // Invoked by push_chunk  if current mode is TStreamingPreaggregationMode::AUTO
     Status _push_chunk_by_auto(const size_t chunk_size);
 
+    // Invoked by _push_chunk_by_auto if the adaptive pre-aggregation is enabled
+    Status _push_chunk_by_adaptive(const size_t chunk_size);
+
+    // Aggregate the rows whose keys are in the hash table, and pass the others through.
+    // Return the number of the aggregated rows.
+    size_t _push_chunk_by_selection(const size_t chunk_size);
+
     // It is used to perform aggregation algorithms shared by
     // AggregateStreamingSourceOperator. It is
     // - prepared at SinkOperator::prepare(),
@@ -48,6 +56,12 @@ private:
     AggregatorPtr _aggregator = nullptr;
     // Whether prev operator has no output
     bool _is_finished = false;
+
+    std::unique_ptr<AdaptivePreaggregation> _adaptive_preagg;
+    RuntimeProfile::Counter* _preagg_mode_switches_counter = nullptr;
+    RuntimeProfile::Counter* _preagg_aggregate_chunks_counter = nullptr;
+    RuntimeProfile::Counter* _preagg_limited_chunks_counter = nullptr;
+    RuntimeProfile::Counter* _preagg_streaming_chunks_counter = nullptr;
 };
 
 class AggregateStreamingSinkOperatorFactory final : public OperatorFactory {
@@ -28,13 +28,37 @@ bool RepeatOperator::has_output() const {
 }
 
 StatusOr<vectorized::ChunkPtr> RepeatOperator::pull_chunk(RuntimeState* state) {
-    ChunkPtr curr_chunk = _curr_chunk->clone_empty(_curr_chunk->num_rows());
-    curr_chunk->append_safe(*_curr_chunk, 0, _curr_chunk->num_rows());
+    ChunkPtr curr_chunk = make_repeat_chunk();
     extend_and_update_columns(&curr_chunk);
     eval_conjuncts_and_in_filters(_conjunct_ctxs, curr_chunk.get());
     return curr_chunk;
 }
 
+ChunkPtr RepeatOperator::make_repeat_chunk() {
+    // The repeated chunks share the columns of _curr_chunk instead of copying them. But the conjuncts and runtime
+    // in filters modify the columns in place, so the columns which are used by the following repeated chunks must
+    // be copied then, except the ones to be replaced by null columns.
+    Columns columns = _curr_chunk->columns();
+    const bool may_filter = !_conjunct_ctxs.empty() || !runtime_in_filters().empty();
+    if (may_filter && _repeat_times_last + 1 < _repeat_times_required) {
+        const std::vector<SlotId>& null_slot_ids = _null_slot_ids[_repeat_times_last];
+        std::vector<bool> is_null_column(columns.size(), false);
+        for (auto slot_id : null_slot_ids) {
+            auto iter = _curr_chunk->get_slot_id_to_index_map().find(slot_id);
+            if (iter != _curr_chunk->get_slot_id_to_index_map().end()) {
+                is_null_column[iter->second] = true;
+            }
+        }
+        for (size_t i = 0; i < columns.size(); ++i) {
+            if (!is_null_column[i]) {
+                columns[i] = columns[i]->clone_shared();
+            }
+        }
+    }
+    return std::make_shared<Chunk>(std::move(columns), _curr_chunk->get_slot_id_to_index_map(),
+                                   _curr_chunk->get_tuple_id_to_index_map());
+}
+
 void RepeatOperator::extend_and_update_columns(ChunkPtr* curr_chunk) {
     // extend virtual columns for gourping_id and grouping()/grouping_id() columns.
     for (int i = 0; i < _grouping_list.size(); ++i) {
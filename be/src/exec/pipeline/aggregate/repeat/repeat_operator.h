@@ -57,6 +57,8 @@ private:
         return ConstColumn::create(column, num_rows);
     }
 
+    // Make a chunk of the columns of _curr_chunk for the current repeat.
+    vectorized::ChunkPtr make_repeat_chunk();
     void extend_and_update_columns(vectorized::ChunkPtr* curr_chunk);
 
     /*
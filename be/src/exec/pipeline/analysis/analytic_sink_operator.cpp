@@ -2,6 +2,7 @@
 
 #include "analytic_sink_operator.h"
 
+#include "exprs/expr.h"
 #include "runtime/current_thread.h"
 #include "runtime/runtime_state.h"
 
@@ -44,6 +45,9 @@ Status AnalyticSinkOperator::prepare(RuntimeState* state) {
                         &AnalyticSinkOperator::
                                 _process_by_partition_for_unbounded_preceding_rows_frame_with_partition_end;
             }
+        } else if (window.__isset.window_end && !_analytor->has_lead_lag_function()) {
+            _process_by_partition_if_necessary =
+                    &AnalyticSinkOperator::_process_by_partition_if_necessary_for_sliding_frame_without_partition_end;
         } else {
             _process_by_partition_if_necessary = &AnalyticSinkOperator::_process_by_partition_if_necessary_for_other;
             _process_by_partition = &AnalyticSinkOperator::_process_by_partition_for_sliding_frame;
@@ -168,6 +172,33 @@ AnalyticSinkOperator::_process_by_partition_if_necessary_for_unbounded_preceding
     return Status::OK();
 }
 
+Status AnalyticSinkOperator::_process_by_partition_if_necessary_for_sliding_frame_without_partition_end() {
+    while (_analytor->has_output()) {
+        if (_analytor->reached_limit()) {
+            return Status::OK();
+        }
+
+        // reset state for the first partition
+        if (_analytor->current_row_position() == 0) {
+            _analytor->reset_window_state();
+        }
+
+        auto chunk_size = static_cast<int64_t>(_analytor->input_chunks()[_analytor->output_chunk_index()]->num_rows());
+        _analytor->create_agg_result_columns(chunk_size);
+
+        _process_by_partition_for_sliding_frame_without_partition_end(chunk_size);
+
+        // Wait for the following rows, which the frames of the remaining rows of the chunk end at.
+        if (_analytor->window_result_position() < chunk_size) {
+            return Status::OK();
+        }
+        vectorized::ChunkPtr chunk;
+        RETURN_IF_ERROR(_analytor->output_result_chunk(&chunk));
+        _analytor->offer_chunk_to_buffer(chunk);
+    }
+    return Status::OK();
+}
+
 void AnalyticSinkOperator::_process_by_partition_for_unbounded_frame(size_t chunk_size, bool is_new_partition) {
     if (is_new_partition) {
         _analytor->update_window_batch(_analytor->partition_start(), _analytor->partition_end(),
@@ -253,13 +284,38 @@ void AnalyticSinkOperator::_process_by_partition_for_unbounded_preceding_rows_fr
     } while (_analytor->window_result_position() < chunk_size);
 }
 
+void AnalyticSinkOperator::_process_by_partition_for_sliding_frame_without_partition_end(int64_t chunk_size) {
+    while (_analytor->window_result_position() < chunk_size) {
+        bool is_partition_end = _analytor->find_and_check_partition_end() || _analytor->input_eos();
+        // Before the partition end is found, a row can be processed only if the rows up to its frame end are received.
+        int64_t ready_end = _analytor->found_partition_end();
+        if (!is_partition_end) {
+            ready_end -= std::max<int64_t>(_analytor->rows_end_offset(), 0);
+        }
+
+        while (_analytor->current_row_position() < ready_end && _analytor->window_result_position() < chunk_size) {
+            _analytor->update_sliding_frame(_analytor->get_sliding_frame_range());
+
+            _analytor->update_window_result_position(1);
+            int64_t result_start = _analytor->get_total_position(_analytor->current_row_position()) -
+                                   _analytor->input_chunk_first_row_positions()[_analytor->output_chunk_index()];
+
+            DCHECK_GE(result_start, 0);
+            _analytor->get_window_function_result(result_start, _analytor->window_result_position());
+            _analytor->update_current_row_position(1);
+        }
+
+        if (!is_partition_end || _analytor->current_row_position() < _analytor->found_partition_end()) {
+            return;
+        }
+        _analytor->reset_state_for_next_partition();
+    }
+}
+
 void AnalyticSinkOperator::_process_by_partition_for_sliding_frame(size_t chunk_size, bool is_new_partition) {
     while (_analytor->current_row_position() < _analytor->partition_end() &&
            _analytor->window_result_position() < chunk_size) {
-        _analytor->reset_window_state();
-        FrameRange range = _analytor->get_sliding_frame_range();
-        _analytor->update_window_batch(_analytor->partition_start(), _analytor->partition_end(), range.start,
-                                       range.end);
+        _analytor->update_sliding_frame(_analytor->get_sliding_frame_range());
 
         _analytor->update_window_result_position(1);
         int64_t result_start = _analytor->get_total_position(_analytor->current_row_position()) -
@@ -271,4 +327,16 @@ void AnalyticSinkOperator::_process_by_partition_for_sliding_frame(size_t chunk_
     }
 }
 
+Status AnalyticSinkOperatorFactory::prepare(RuntimeState* state) {
+    RETURN_IF_ERROR(OperatorFactory::prepare(state));
+    RETURN_IF_ERROR(Expr::prepare(_partition_expr_ctxs, state));
+    RETURN_IF_ERROR(Expr::open(_partition_expr_ctxs, state));
+    return Status::OK();
+}
+
+void AnalyticSinkOperatorFactory::close(RuntimeState* state) {
+    Expr::close(_partition_expr_ctxs, state);
+    OperatorFactory::close(state);
+}
+
 } // namespace starrocks::pipeline
@@ -36,6 +36,9 @@ private:
     // As for the frame `ROWS BETWEEN UNBOUNDED PRECEDING AND CURRENT ROWS`, some window functions needn't
     // use the partition end. For them, we could process before the current partition is finished.
     Status _process_by_partition_if_necessary_for_unbounded_preceding_rows_frame_without_partition_end();
+    // As for the sliding frames with a bounded end, e.g. `ROWS BETWEEN 10 PRECEDING AND 1 FOLLOWING`, a row could be
+    // processed once the rows up to its frame end are received, so that a large partition is output while streaming.
+    Status _process_by_partition_if_necessary_for_sliding_frame_without_partition_end();
     ProcessByPartitionIfNecessaryFunc _process_by_partition_if_necessary = nullptr;
 
     void _process_by_partition_for_unbounded_frame(size_t chunk_size, bool is_new_partition);
@@ -44,6 +47,7 @@ private:
                                                                                      bool is_new_partition);
     void _process_by_partition_for_unbounded_preceding_rows_frame_without_partition_end(size_t chunk_size);
     void _process_by_partition_for_sliding_frame(size_t chunk_size, bool is_new_partition);
+    void _process_by_partition_for_sliding_frame_without_partition_end(int64_t chunk_size);
     ProcessByPartitionFunc _process_by_partition = nullptr;
 
     TPlanNode _tnode;
@@ -57,11 +61,18 @@ private:
 class AnalyticSinkOperatorFactory final : public OperatorFactory {
 public:
     AnalyticSinkOperatorFactory(int32_t id, int32_t plan_node_id, const TPlanNode& tnode,
-                                const AnalytorFactoryPtr& analytor_factory)
-            : OperatorFactory(id, "analytic_sink", plan_node_id), _tnode(tnode), _analytor_factory(analytor_factory) {}
+                                const AnalytorFactoryPtr& analytor_factory,
+                                std::vector<ExprContext*> partition_expr_ctxs = {})
+            : OperatorFactory(id, "analytic_sink", plan_node_id),
+              _tnode(tnode),
+              _analytor_factory(analytor_factory),
+              _partition_expr_ctxs(std::move(partition_expr_ctxs)) {}
 
     ~AnalyticSinkOperatorFactory() override = default;
 
+    Status prepare(RuntimeState* state) override;
+    void close(RuntimeState* state) override;
+
     OperatorPtr create(int32_t degree_of_parallelism, int32_t driver_sequence) override {
         auto analytor = _analytor_factory->create(driver_sequence);
         return std::make_shared<AnalyticSinkOperator>(this, _id, _plan_node_id, driver_sequence, _tnode,
@@ -71,5 +82,7 @@ public:
 private:
     TPlanNode _tnode;
     AnalytorFactoryPtr _analytor_factory;
+    // The PARTITION BY exprs of the local shuffle in front of the sink, if any.
+    std::vector<ExprContext*> _partition_expr_ctxs;
 };
 } // namespace starrocks::pipeline
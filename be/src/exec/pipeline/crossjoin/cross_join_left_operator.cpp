@@ -4,8 +4,11 @@
 
 #include "column/column_helper.h"
 #include "column/nullable_column.h"
+#include "common/config.h"
 #include "exec/exec_node.h"
+#include "exec/pipeline/driver_time_budget.h"
 #include "exprs/expr.h"
+#include "exprs/expr_context.h"
 #include "runtime/runtime_state.h"
 
 namespace starrocks::pipeline {
@@ -185,14 +188,151 @@ void CrossJoinLeftOperator::_select_build_chunk(const int32_t unprocessed_build_
         _beyond_threshold_build_rows_index = 0;
         _probe_chunk_index = 0;
         _probe_rows_index = 0;
+        _tile_probe_row = 0;
+        _tile_build_row = 0;
     }
 }
 
+void CrossJoinLeftOperator::_init_tiles() {
+    _is_tiles_inited = true;
+    if (!config::pipeline_cross_join_evaluate_in_tiles || _conjunct_ctxs.empty()) {
+        return;
+    }
+
+    _tile_conjunct_ctxs = _conjunct_ctxs;
+    const auto& in_filters = runtime_in_filters();
+    _tile_conjunct_ctxs.insert(_tile_conjunct_ctxs.end(), in_filters.begin(), in_filters.end());
+    for (ExprContext* ctx : _tile_conjunct_ctxs) {
+        std::vector<SlotId> slot_ids;
+        ctx->root()->get_slot_ids(&slot_ids);
+        _tile_slot_ids.insert(slot_ids.begin(), slot_ids.end());
+    }
+    // A tile without any column has no rows to evaluate the conjuncts on.
+    _join_in_tiles = !_tile_slot_ids.empty();
+}
+
+void CrossJoinLeftOperator::_append_selective_rows(vectorized::ColumnPtr& dest_col,
+                                                   const vectorized::ColumnPtr& src_col,
+                                                   const vectorized::Buffer<uint32_t>& indexes) {
+    const size_t count = indexes.size();
+    if (src_col->is_constant()) {
+        // current can't reach here
+        if (src_col->is_nullable()) {
+            dest_col->append_nulls(count);
+        } else {
+            auto* const_col = vectorized::ColumnHelper::as_raw_column<vectorized::ConstColumn>(src_col);
+            _buf_selective.assign(count, 0);
+            dest_col->append_selective(*const_col->data_column(), _buf_selective.data(), 0, count);
+        }
+    } else {
+        dest_col->append_selective(*src_col, indexes.data(), 0, count);
+    }
+}
+
+Status CrossJoinLeftOperator::_filter_tile(vectorized::Chunk* build_chunk) {
+    const size_t num_pairs = _tile_probe_indexes.size();
+    if (num_pairs == 0) {
+        return Status::OK();
+    }
+
+    vectorized::Chunk tile;
+    for (size_t i = 0; i < _probe_column_count + _build_column_count; i++) {
+        SlotDescriptor* slot = _col_types[i];
+        if (_tile_slot_ids.count(slot->id()) == 0) {
+            continue;
+        }
+        const bool is_probe = i < _probe_column_count;
+        const vectorized::ColumnPtr& src_col = is_probe ? _probe_chunk->get_column_by_slot_id(slot->id())
+                                                        : build_chunk->get_column_by_slot_id(slot->id());
+        vectorized::ColumnPtr dest_col = vectorized::ColumnHelper::create_column(slot->type(), src_col->is_nullable());
+        dest_col->reserve(num_pairs);
+        _append_selective_rows(dest_col, src_col, is_probe ? _tile_probe_indexes : _tile_build_indexes);
+        tile.append_column(std::move(dest_col), slot->id());
+    }
+
+    _tile_filter.assign(num_pairs, 1);
+    ASSIGN_OR_RETURN(size_t hit_count, ExecNode::eval_conjuncts_into_filter(_tile_conjunct_ctxs, &tile, &_tile_filter));
+    if (hit_count == 0) {
+        _tile_probe_indexes.clear();
+        _tile_build_indexes.clear();
+    } else if (hit_count < num_pairs) {
+        size_t num_hits = 0;
+        for (size_t i = 0; i < num_pairs; i++) {
+            _tile_probe_indexes[num_hits] = _tile_probe_indexes[i];
+            _tile_build_indexes[num_hits] = _tile_build_indexes[i];
+            num_hits += _tile_filter[i];
+        }
+        _tile_probe_indexes.resize(num_hits);
+        _tile_build_indexes.resize(num_hits);
+    }
+    return Status::OK();
+}
+
+StatusOr<vectorized::ChunkPtr> CrossJoinLeftOperator::_pull_chunk_in_tiles(RuntimeState* state) {
+    vectorized::ChunkPtr chunk = nullptr;
+    _init_chunk(&chunk, state);
+
+    const size_t chunk_size = state->chunk_size();
+    while (chunk->num_rows() < chunk_size && !_is_curr_probe_chunk_finished()) {
+        // Generate the candidate pairs of the tile from _curr_build_chunk. The tile is bounded by the free space
+        // of the output chunk, so that the output chunk never exceeds chunk_size rows.
+        const size_t tile_size = chunk_size - chunk->num_rows();
+        const size_t num_probe_rows = _probe_chunk->num_rows();
+        const size_t num_build_rows = _curr_build_chunk->num_rows();
+        _tile_probe_indexes.clear();
+        _tile_build_indexes.clear();
+        while (_tile_probe_indexes.size() < tile_size && _tile_probe_row < num_probe_rows) {
+            const size_t count = std::min(tile_size - _tile_probe_indexes.size(), num_build_rows - _tile_build_row);
+            _tile_probe_indexes.resize(_tile_probe_indexes.size() + count, _tile_probe_row);
+            for (size_t i = 0; i < count; i++) {
+                _tile_build_indexes.push_back(_tile_build_row + i);
+            }
+            _tile_build_row += count;
+            if (_tile_build_row == num_build_rows) {
+                _tile_probe_row++;
+                _tile_build_row = 0;
+            }
+        }
+
+        // Selecting the next build chunk changes _curr_build_chunk, so keep the one of this tile.
+        vectorized::Chunk* build_chunk = _curr_build_chunk;
+        if (_tile_probe_row >= num_probe_rows) {
+            _select_build_chunk(_curr_build_index + 1, state);
+        }
+
+        RETURN_IF_ERROR(_filter_tile(build_chunk));
+        if (!_tile_probe_indexes.empty()) {
+            for (size_t i = 0; i < _probe_column_count; i++) {
+                SlotDescriptor* slot = _col_types[i];
+                vectorized::ColumnPtr& dest_col = chunk->get_column_by_slot_id(slot->id());
+                _append_selective_rows(dest_col, _probe_chunk->get_column_by_slot_id(slot->id()), _tile_probe_indexes);
+            }
+            for (size_t i = 0; i < _build_column_count; i++) {
+                SlotDescriptor* slot = _col_types[_probe_column_count + i];
+                vectorized::ColumnPtr& dest_col = chunk->get_column_by_slot_id(slot->id());
+                _append_selective_rows(dest_col, build_chunk->get_column_by_slot_id(slot->id()), _tile_build_indexes);
+            }
+        }
+
+        // The partial chunk is output when the driver runs out of its time budget,
+        // and the remaining pairs are joined in the next pull_chunk.
+        if (DriverTimeBudget::exhausted()) {
+            break;
+        }
+    }
+
+    return chunk;
+}
+
 /*
  * This algorithm is the same as that CrossJoinNode,
  * and pull_chunk, need_input, push_chunk is splited from CrossJoinNode's get_next.
  */
 StatusOr<vectorized::ChunkPtr> CrossJoinLeftOperator::pull_chunk(RuntimeState* state) {
+    if (_join_in_tiles) {
+        return _pull_chunk_in_tiles(state);
+    }
+
     vectorized::ChunkPtr chunk = nullptr;
     // we need a valid probe chunk to initialize the new chunk.
     _init_chunk(&chunk, state);
@@ -294,7 +434,10 @@ StatusOr<vectorized::ChunkPtr> CrossJoinLeftOperator::pull_chunk(RuntimeState* s
 
         // When the chunk is full or the current probe chunk is finished
         // crossing join with build chunks, we can output this chunk.
-        if (chunk->num_rows() >= state->chunk_size() || _is_curr_probe_chunk_finished()) {
+        // The partial chunk is also output when the driver runs out of its time budget,
+        // and the remaining rows are joined in the next pull_chunk.
+        if (chunk->num_rows() >= state->chunk_size() || _is_curr_probe_chunk_finished() ||
+            DriverTimeBudget::exhausted()) {
             RETURN_IF_ERROR(eval_conjuncts_and_in_filters(_conjunct_ctxs, chunk.get()));
             break;
         }
@@ -304,6 +447,9 @@ StatusOr<vectorized::ChunkPtr> CrossJoinLeftOperator::pull_chunk(RuntimeState* s
 }
 
 Status CrossJoinLeftOperator::push_chunk(RuntimeState* state, const vectorized::ChunkPtr& chunk) {
+    if (!_is_tiles_inited) {
+        _init_tiles();
+    }
     _probe_chunk = chunk;
     _select_build_chunk(0, state);
 
@@ -2,6 +2,8 @@
 
 #pragma once
 
+#include <unordered_set>
+
 #include "column/chunk.h"
 #include "column/vectorized_fwd.h"
 #include "exec/pipeline/crossjoin/cross_join_context.h"
@@ -91,6 +93,14 @@ private:
 
     void _select_build_chunk(int32_t build_index, RuntimeState* state);
 
+    void _init_tiles();
+    StatusOr<vectorized::ChunkPtr> _pull_chunk_in_tiles(RuntimeState* state);
+    // Evaluate the conjuncts on the tile of _tile_probe_indexes x _tile_build_indexes,
+    // and keep the indexes of the matched pairs only.
+    Status _filter_tile(vectorized::Chunk* build_chunk);
+    void _append_selective_rows(vectorized::ColumnPtr& dest_col, const vectorized::ColumnPtr& src_col,
+                                const vectorized::Buffer<uint32_t>& indexes);
+
     void _init_chunk(vectorized::ChunkPtr* chunk, RuntimeState* state);
 
     void _copy_joined_rows_with_index_base_build(vectorized::ChunkPtr& chunk, size_t row_count, size_t probe_index,
@@ -146,6 +156,21 @@ private:
 
     std::vector<uint32_t> _buf_selective;
 
+    // Join in tiles when there are conjuncts: the candidate pairs of rows are generated as row indexes,
+    // the conjuncts are evaluated on a tile which only materializes the columns referenced by them,
+    // and only the matched pairs are materialized with all the columns.
+    bool _is_tiles_inited = false;
+    bool _join_in_tiles = false;
+    // _conjunct_ctxs and the runtime in filters.
+    std::vector<ExprContext*> _tile_conjunct_ctxs;
+    std::unordered_set<SlotId> _tile_slot_ids;
+    // The next pair of rows to join, in _probe_chunk and _curr_build_chunk.
+    size_t _tile_probe_row = 0;
+    size_t _tile_build_row = 0;
+    vectorized::Buffer<uint32_t> _tile_probe_indexes;
+    vectorized::Buffer<uint32_t> _tile_build_indexes;
+    vectorized::Filter _tile_filter;
+
     const std::shared_ptr<CrossJoinContext>& _cross_join_context;
 };
 
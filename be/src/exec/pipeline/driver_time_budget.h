@@ -0,0 +1,33 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+
+#include "util/time.h"
+
+namespace starrocks::pipeline {
+
+// DriverTimeBudget is the cooperative time budget of the driver running on the current executor thread.
+//
+// PipelineDriver::process() starts the budget before moving chunks between operators, and the driver yields when
+// the budget is exhausted. However, the driver can only check it between two calls of the operators, so an operator
+// which may loop for a long time in a single pull_chunk(), e.g. cross join producing the joined rows, should check
+// exhausted() in its loop and return the partial result early, so that a latency-sensitive workgroup isn't starved.
+//
+// exhausted() always returns false on the threads which aren't executing a driver.
+class DriverTimeBudget {
+public:
+    static void start(int64_t budget_ns) { tls_deadline_ns = MonotonicNanos() + budget_ns; }
+    static void stop() { tls_deadline_ns = std::numeric_limits<int64_t>::max(); }
+
+    static bool exhausted() {
+        return tls_deadline_ns != std::numeric_limits<int64_t>::max() && MonotonicNanos() >= tls_deadline_ns;
+    }
+
+private:
+    static inline thread_local int64_t tls_deadline_ns = std::numeric_limits<int64_t>::max();
+};
+
+} // namespace starrocks::pipeline
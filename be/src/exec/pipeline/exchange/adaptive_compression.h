@@ -0,0 +1,68 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+namespace starrocks::pipeline {
+
+// AdaptiveCompression decides whether to compress the chunk sent by ExchangeSinkOperator,
+// by comparing the throughput of compression with the throughput of the network.
+//
+// Compressing a chunk costs `size / compress_throughput` and saves `size * (1 - 1 / ratio) / network_throughput`.
+// On a fast network, e.g. between the BEs in the same rack, compression may cost more time than it saves,
+// while on a slow cross-AZ link it usually pays off.
+//
+// The compression ratio and throughput are estimated from the recently compressed chunks. When compression doesn't
+// pay off, a chunk is still compressed every PROBE_INTERVAL chunks to refresh the estimation, since the data
+// and the network may change.
+class AdaptiveCompression {
+public:
+    // network_bytes_per_ns <= 0 means that the network throughput is unknown yet.
+    bool should_compress(double network_bytes_per_ns) {
+        if (network_bytes_per_ns <= 0 || _compress_bytes_per_ns <= 0) {
+            return true;
+        }
+        const double saved_ratio = _compress_ratio > 1 ? 1 - 1 / _compress_ratio : 0;
+        if (saved_ratio * _compress_bytes_per_ns > network_bytes_per_ns) {
+            _num_skipped = 0;
+            return true;
+        }
+        if (++_num_skipped >= PROBE_INTERVAL) {
+            _num_skipped = 0;
+            return true;
+        }
+        return false;
+    }
+
+    void update(size_t uncompressed_size, size_t compressed_size, int64_t compress_time_ns) {
+        if (uncompressed_size == 0 || compressed_size == 0) {
+            return;
+        }
+        const double ratio = static_cast<double>(uncompressed_size) / compressed_size;
+        const double bytes_per_ns = static_cast<double>(uncompressed_size) / std::max<int64_t>(1, compress_time_ns);
+        if (_compress_bytes_per_ns <= 0) {
+            _compress_ratio = ratio;
+            _compress_bytes_per_ns = bytes_per_ns;
+        } else {
+            _compress_ratio = EWMA_ALPHA * ratio + (1 - EWMA_ALPHA) * _compress_ratio;
+            _compress_bytes_per_ns = EWMA_ALPHA * bytes_per_ns + (1 - EWMA_ALPHA) * _compress_bytes_per_ns;
+        }
+    }
+
+    double compress_ratio() const { return _compress_ratio; }
+    double compress_bytes_per_ns() const { return _compress_bytes_per_ns; }
+
+    static constexpr int PROBE_INTERVAL = 16;
+
+private:
+    static constexpr double EWMA_ALPHA = 0.2;
+
+    double _compress_ratio = 0;
+    double _compress_bytes_per_ns = 0;
+    int _num_skipped = 0;
+};
+
+} // namespace starrocks::pipeline
@@ -12,6 +12,7 @@
 #include "common/config.h"
 #include "exec/pipeline/exchange/sink_buffer.h"
 #include "exprs/expr.h"
+#include "fmt/format.h"
 #include "gen_cpp/Types_types.h"
 #include "runtime/data_stream_mgr.h"
 #include "runtime/descriptors.h"
@@ -25,6 +26,7 @@
 #include "util/compression_utils.h"
 #include "util/debug_util.h"
 #include "util/thrift_client.h"
+#include "util/time.h"
 
 namespace starrocks::pipeline {
 
@@ -69,6 +71,10 @@ public:
     Status add_rows_selective(vectorized::Chunk* chunk, int32_t driver_sequence, const uint32_t* row_indexes,
                               uint32_t from, uint32_t size, RuntimeState* state);
 
+    // Send the rows buffered by add_rows_selective() and the batched chunks, if the first of them
+    // has been buffered for more than max_delay_ns.
+    Status flush_if_expired(int64_t now_ns, int64_t max_delay_ns);
+
     // Flush buffered rows and close channel. This function don't wait the response
     // of close operation, client should call close_wait() to finish channel's close.
     // We split one close operation into two phases in order to make multiple channels
@@ -86,8 +92,16 @@ public:
 
 private:
     Status _close_internal(RuntimeState* state, FragmentContext* fragment_ctx);
+    void _send_request(bool eos);
 
     bool _check_use_pass_through();
+    doris::PBackendService_Stub* _select_brpc_stub(const butil::IOBuf& attachment) const {
+        if (_large_payload_brpc_stub != nullptr &&
+            static_cast<int64_t>(attachment.size()) >= config::brpc_large_payload_bytes) {
+            return _large_payload_brpc_stub;
+        }
+        return _brpc_stub;
+    }
     void _prepare_pass_through();
 
     ExchangeSinkOperator* _parent;
@@ -101,6 +115,8 @@ private:
 
     bool _is_first_chunk = true;
     doris::PBackendService_Stub* _brpc_stub = nullptr;
+    // The stub to send the requests with large attachments, or null if brpc_large_payload_bytes is 0.
+    doris::PBackendService_Stub* _large_payload_brpc_stub = nullptr;
 
     // If pipeline level shuffle is enable, the size of the _chunks
     // equals with dop of dest pipeline
@@ -108,14 +124,19 @@ private:
     // always be 1
     std::vector<std::unique_ptr<vectorized::Chunk>> _chunks;
     PTransmitChunkParamsPtr _chunk_request;
+    // The serialized data of the chunks in _chunk_request.
+    butil::IOBuf _attachment;
     size_t _current_request_bytes = 0;
+    // The time when the first row or chunk not sent yet is buffered, or -1 if there is no buffered data.
+    // It's only maintained when pipeline_exchange_sink_max_buffer_delay_ms > 0.
+    int64_t _buffered_since_ns = -1;
 
     bool _is_inited = false;
     bool _use_pass_through = false;
 };
 
 bool ExchangeSinkOperator::Channel::_check_use_pass_through() {
-    if (!_enable_exchange_pass_through) {
+    if (!_enable_exchange_pass_through && !config::pipeline_enable_local_exchange_pass_through) {
         return false;
     }
     if (BackendOptions::get_localhost() != _brpc_dest_addr.hostname) {
@@ -150,6 +171,9 @@ Status ExchangeSinkOperator::Channel::init(RuntimeState* state) {
         return Status::OK();
     }
     _brpc_stub = state->exec_env()->brpc_stub_cache()->get_stub(_brpc_dest_addr);
+    if (config::brpc_large_payload_bytes > 0) {
+        _large_payload_brpc_stub = state->exec_env()->brpc_stub_cache()->get_large_payload_stub(_brpc_dest_addr);
+    }
     _prepare_pass_through();
 
     _is_inited = true;
@@ -170,6 +194,26 @@ Status ExchangeSinkOperator::Channel::add_rows_selective(vectorized::Chunk* chun
     }
 
     _chunks[driver_sequence]->append_selective(*chunk, indexes, from, size);
+    if (_buffered_since_ns < 0 && config::pipeline_exchange_sink_max_buffer_delay_ms > 0) {
+        _buffered_since_ns = MonotonicNanos();
+    }
+    return Status::OK();
+}
+
+Status ExchangeSinkOperator::Channel::flush_if_expired(int64_t now_ns, int64_t max_delay_ns) {
+    if (_buffered_since_ns < 0 || now_ns - _buffered_since_ns < max_delay_ns) {
+        return Status::OK();
+    }
+    for (auto driver_sequence = 0; driver_sequence < _chunks.size(); ++driver_sequence) {
+        if (_chunks[driver_sequence] != nullptr && _chunks[driver_sequence]->num_rows() > 0) {
+            RETURN_IF_ERROR(send_one_chunk(_chunks[driver_sequence].get(), driver_sequence, false));
+            _chunks[driver_sequence]->set_num_rows(0);
+        }
+    }
+    if (_chunk_request != nullptr && _current_request_bytes > 0) {
+        _send_request(false);
+    }
+    _buffered_since_ns = -1;
     return Status::OK();
 }
 
@@ -207,28 +251,34 @@ Status ExchangeSinkOperator::Channel::send_one_chunk(const vectorized::Chunk* ch
                 _chunk_request->add_driver_sequences(driver_sequence);
             }
             auto pchunk = _chunk_request->add_chunks();
-            TRY_CATCH_BAD_ALLOC(RETURN_IF_ERROR(_parent->serialize_chunk(chunk, pchunk, &_is_first_chunk)));
-            _current_request_bytes += pchunk->data().size();
+            TRY_CATCH_BAD_ALLOC(
+                    RETURN_IF_ERROR(_parent->serialize_chunk(chunk, pchunk, &_attachment, &_is_first_chunk)));
+            _current_request_bytes += pchunk->data_size();
         }
     }
 
     // Try to accumulate enough bytes before sending a RPC. When eos is true we should send
     // last packet
     if (_current_request_bytes > config::max_transmit_batched_bytes || eos) {
-        _chunk_request->set_eos(eos);
-        _chunk_request->set_use_pass_through(_use_pass_through);
-        butil::IOBuf attachment;
-        _parent->construct_brpc_attachment(_chunk_request, attachment);
-        TransmitChunkInfo info = {this->_fragment_instance_id, _brpc_stub, std::move(_chunk_request), attachment};
-        _parent->_buffer->add_request(info);
-        _current_request_bytes = 0;
-        _chunk_request.reset();
+        _send_request(eos);
         *is_real_sent = true;
     }
 
     return Status::OK();
 }
 
+void ExchangeSinkOperator::Channel::_send_request(bool eos) {
+    _chunk_request->set_eos(eos);
+    _chunk_request->set_use_pass_through(_use_pass_through);
+    butil::IOBuf attachment;
+    attachment.swap(_attachment);
+    TransmitChunkInfo info = {this->_fragment_instance_id, _select_brpc_stub(attachment), std::move(_chunk_request),
+                              attachment};
+    _parent->_buffer->add_request(info);
+    _current_request_bytes = 0;
+    _chunk_request.reset();
+}
+
 Status ExchangeSinkOperator::Channel::send_chunk_request(PTransmitChunkParamsPtr chunk_request,
                                                          const butil::IOBuf& attachment) {
     chunk_request->set_node_id(_dest_node_id);
@@ -237,7 +287,8 @@ Status ExchangeSinkOperator::Channel::send_chunk_request(PTransmitChunkParamsPtr
     chunk_request->set_eos(false);
     chunk_request->set_use_pass_through(_use_pass_through);
 
-    TransmitChunkInfo info = {this->_fragment_instance_id, _brpc_stub, std::move(chunk_request), attachment};
+    TransmitChunkInfo info = {this->_fragment_instance_id, _select_brpc_stub(attachment), std::move(chunk_request),
+                              attachment};
     _parent->_buffer->add_request(info);
 
     return Status::OK();
@@ -338,6 +389,11 @@ Status ExchangeSinkOperator::prepare(RuntimeState* state) {
     if (_part_type == TPartitionType::HASH_PARTITIONED ||
         _part_type == TPartitionType::BUCKET_SHUFFLE_HASH_PARTITIONED) {
         _partitions_columns.resize(_partition_expr_ctxs.size());
+        _channel_rows.assign(_channels.size(), 0);
+        if (config::pipeline_exchange_skew_detection_sample_interval > 0) {
+            _shuffle_key_sample_interval = config::pipeline_exchange_skew_detection_sample_interval;
+            _shuffle_key_sketch = std::make_unique<SpaceSavingSketch<uint32_t>>(SHUFFLE_KEY_SKETCH_CAPACITY);
+        }
     }
 
     // Randomize the order we open/transmit to channels to avoid thundering herd problems.
@@ -348,6 +404,10 @@ Status ExchangeSinkOperator::prepare(RuntimeState* state) {
 
     _bytes_pass_through_counter = ADD_COUNTER(_unique_metrics, "BytesPassThrough", TUnit::BYTES);
     _uncompressed_bytes_counter = ADD_COUNTER(_unique_metrics, "UncompressedBytes", TUnit::BYTES);
+    _compress_skipped_chunks_counter = ADD_COUNTER(_unique_metrics, "CompressSkippedChunks", TUnit::UNIT);
+    if (_serialized_chunk_cache != nullptr) {
+        _shared_serialized_chunks_counter = ADD_COUNTER(_unique_metrics, "SharedSerializedChunks", TUnit::UNIT);
+    }
     _serialize_chunk_timer = ADD_TIMER(_unique_metrics, "SerializeChunkTime");
     _shuffle_hash_timer = ADD_TIMER(_unique_metrics, "ShuffleHashTime");
     _compress_timer = ADD_TIMER(_unique_metrics, "CompressTime");
@@ -421,20 +481,32 @@ Status ExchangeSinkOperator::push_chunk(RuntimeState* state, const vectorized::C
             // We use sender request to avoid serialize chunk many times.
             // 1. create a new chunk PB to serialize
             ChunkPB* pchunk = _chunk_request->add_chunks();
-            // 2. serialize input chunk to pchunk
-            TRY_CATCH_BAD_ALLOC(
-                    RETURN_IF_ERROR(serialize_chunk(send_chunk, pchunk, &_is_first_chunk, _channels.size())));
-            _current_request_bytes += pchunk->data().size();
+            // 2. serialize input chunk to pchunk, unless another consumer of the multi-cast sink has serialized it.
+            if (_serialized_chunk_cache == nullptr) {
+                TRY_CATCH_BAD_ALLOC(RETURN_IF_ERROR(
+                        serialize_chunk(send_chunk, pchunk, &_attachment, &_is_first_chunk, _channels.size())));
+            } else if (_serialized_chunk_cache->get(chunk.get(), _is_first_chunk, pchunk, &_attachment)) {
+                _is_first_chunk = false;
+                COUNTER_UPDATE(_shared_serialized_chunks_counter, 1);
+            } else {
+                const bool is_first_chunk = _is_first_chunk;
+                butil::IOBuf chunk_attachment;
+                TRY_CATCH_BAD_ALLOC(RETURN_IF_ERROR(serialize_chunk(send_chunk, pchunk, &chunk_attachment,
+                                                                    &_is_first_chunk, _channels.size())));
+                _serialized_chunk_cache->put(chunk, is_first_chunk, *pchunk, chunk_attachment);
+                _attachment.append(chunk_attachment);
+            }
+            _current_request_bytes += pchunk->data_size();
             // 3. if request bytes exceede the threshold, send current request
             if (_current_request_bytes > config::max_transmit_batched_bytes) {
-                butil::IOBuf attachment;
-                construct_brpc_attachment(_chunk_request, attachment);
+                // The copies of the attachment share the same serialized data.
                 for (auto idx : _channel_indices) {
                     if (!_channels[idx]->use_pass_through()) {
                         PTransmitChunkParamsPtr copy = std::make_shared<PTransmitChunkParams>(*_chunk_request);
-                        RETURN_IF_ERROR(_channels[idx]->send_chunk_request(copy, attachment));
+                        RETURN_IF_ERROR(_channels[idx]->send_chunk_request(copy, _attachment));
                     }
                 }
+                _attachment.clear();
                 _current_request_bytes = 0;
                 _chunk_request.reset();
             }
@@ -475,6 +547,10 @@ Status ExchangeSinkOperator::push_chunk(RuntimeState* state, const vectorized::C
                 }
             }
 
+            if (_shuffle_key_sketch != nullptr) {
+                _sample_shuffle_keys(num_rows);
+            }
+
             // Compute row indexes for each channel's each shuffle
             _channel_row_idx_start_points.assign(num_channels * _num_shuffles + 1, 0);
 
@@ -512,11 +588,22 @@ Status ExchangeSinkOperator::push_chunk(RuntimeState* state, const vectorized::C
                     // no data for this channel continue;
                     continue;
                 }
+                _channel_rows[channel_id] += size;
 
                 RETURN_IF_ERROR(_channels[channel_id]->add_rows_selective(send_chunk, driver_sequence,
                                                                           _row_indexes.data(), from, size, state));
             }
         }
+
+        // Each channel coalesces its rows into chunks of chunk_size rows, and the chunks into requests of
+        // max_transmit_batched_bytes, but it may take a long time to fill them when there are many destinations.
+        if (config::pipeline_exchange_sink_max_buffer_delay_ms > 0) {
+            const int64_t now_ns = MonotonicNanos();
+            const int64_t max_delay_ns = config::pipeline_exchange_sink_max_buffer_delay_ms * 1'000'000L;
+            for (int32_t channel_id : _channel_indices) {
+                RETURN_IF_ERROR(_channels[channel_id]->flush_if_expired(now_ns, max_delay_ns));
+            }
+        }
     }
     return Status::OK();
 }
@@ -525,12 +612,11 @@ Status ExchangeSinkOperator::set_finishing(RuntimeState* state) {
     _is_finished = true;
 
     if (_chunk_request != nullptr) {
-        butil::IOBuf attachment;
-        construct_brpc_attachment(_chunk_request, attachment);
         for (const auto& channel : _channels) {
             PTransmitChunkParamsPtr copy = std::make_shared<PTransmitChunkParams>(*_chunk_request);
-            channel->send_chunk_request(copy, attachment);
+            channel->send_chunk_request(copy, _attachment);
         }
+        _attachment.clear();
         _current_request_bytes = 0;
         _chunk_request.reset();
     }
@@ -545,40 +631,98 @@ Status ExchangeSinkOperator::set_finishing(RuntimeState* state) {
 
 void ExchangeSinkOperator::close(RuntimeState* state) {
     _buffer->update_profile(_unique_metrics.get());
+    _update_shuffle_skew_profile();
     Operator::close(state);
 }
 
-Status ExchangeSinkOperator::serialize_chunk(const vectorized::Chunk* src, ChunkPB* dst, bool* is_first_chunk,
-                                             int num_receivers) {
+void ExchangeSinkOperator::_sample_shuffle_keys(size_t num_rows) {
+    size_t i = _shuffle_key_sample_offset;
+    for (; i < num_rows; i += _shuffle_key_sample_interval) {
+        _shuffle_key_sketch->add(_hash_values[i]);
+    }
+    _shuffle_key_sample_offset = i - num_rows;
+}
+
+void ExchangeSinkOperator::_update_shuffle_skew_profile() {
+    if (_shuffle_key_sketch == nullptr || _shuffle_key_sketch->total() == 0) {
+        return;
+    }
+
+    int64_t max_channel_rows = 0;
+    int64_t total_rows = 0;
+    size_t num_used_channels = 0;
+    for (size_t i = 0; i < _channels.size(); ++i) {
+        // The pseudo destinations of bucket shuffle join never receive rows.
+        if (_channels[i]->get_fragment_instance_id().lo == -1) {
+            continue;
+        }
+        max_channel_rows = std::max(max_channel_rows, _channel_rows[i]);
+        total_rows += _channel_rows[i];
+        num_used_channels++;
+    }
+    const int64_t avg_channel_rows = total_rows / std::max<size_t>(1, num_used_channels);
+    COUNTER_SET(ADD_COUNTER(_unique_metrics, "ShuffleMaxChannelRows", TUnit::UNIT), max_channel_rows);
+    COUNTER_SET(ADD_COUNTER(_unique_metrics, "ShuffleAvgChannelRows", TUnit::UNIT), avg_channel_rows);
+
+    // A hot key is a single key whose rows exceed the fair share of a channel, which cannot be balanced
+    // by any hash function, since all the rows of the same key must be sent to the same channel.
+    const int64_t min_count = _shuffle_key_sketch->total() / std::max<size_t>(1, num_used_channels) + 1;
+    auto hot_keys = _shuffle_key_sketch->top(min_count);
+    if (hot_keys.empty()) {
+        return;
+    }
+    COUNTER_SET(ADD_COUNTER(_unique_metrics, "ShuffleHotKeys", TUnit::UNIT), static_cast<int64_t>(hot_keys.size()));
+    std::string hot_keys_str;
+    for (const auto& hot_key : hot_keys) {
+        if (!hot_keys_str.empty()) {
+            hot_keys_str += ", ";
+        }
+        // The number of rows of the key is estimated by the sampled rows.
+        const int64_t num_rows = (hot_key.count - hot_key.error) * _shuffle_key_sample_interval;
+        hot_keys_str += fmt::format("{}:{}", hot_key.key % _channels.size(), num_rows);
+    }
+    _unique_metrics->add_info_string("ShuffleHotKeyChannelAndRows", hot_keys_str);
+}
+
+Status ExchangeSinkOperator::serialize_chunk(const vectorized::Chunk* src, ChunkPB* dst, butil::IOBuf* attachment,
+                                             bool* is_first_chunk, int num_receivers) {
     VLOG_ROW << "[ExchangeSinkOperator] serializing " << src->num_rows() << " rows";
+    // The chunk data is serialized to the memory of `serialized` directly, and appended to the attachment
+    // without copying, unless it's compressed.
+    butil::IOBuf serialized;
+    Slice uncompressed_slice;
     {
         SCOPED_TIMER(_serialize_chunk_timer);
+        ASSIGN_OR_RETURN(uncompressed_slice,
+                         serde::ProtobufChunkSerde::serialize_without_meta_to_iobuf(*src, dst, &serialized));
         // We only serialize chunk meta for first chunk
         if (*is_first_chunk) {
-            StatusOr<ChunkPB> res = serde::ProtobufChunkSerde::serialize(*src);
-            RETURN_IF_ERROR(res);
-            res->Swap(dst);
+            serde::ProtobufChunkSerde::serialize_meta(*src, dst);
             *is_first_chunk = false;
-        } else {
-            StatusOr<ChunkPB> res = serde::ProtobufChunkSerde::serialize_without_meta(*src);
-            RETURN_IF_ERROR(res);
-            res->Swap(dst);
         }
     }
     DCHECK(dst->has_uncompressed_size());
-    DCHECK_EQ(dst->uncompressed_size(), dst->data().size());
-    const size_t uncompressed_size = dst->uncompressed_size();
+    DCHECK_EQ(dst->uncompressed_size(), uncompressed_slice.size);
+    const size_t uncompressed_size = uncompressed_slice.size;
 
     if (_compress_codec != nullptr && _compress_codec->exceed_max_input_size(uncompressed_size)) {
         return Status::InternalError(strings::Substitute("The input size for compression should be less than $0",
                                                          _compress_codec->max_input_size()));
     }
 
-    // try compress the ChunkPB data
-    if (_compress_codec != nullptr && uncompressed_size > 0) {
+    // try compress the chunk data
+    bool is_compressed = false;
+    bool need_compress = _compress_codec != nullptr && uncompressed_size > 0;
+    if (need_compress && config::exchange_enable_adaptive_compression &&
+        !_adaptive_compression.should_compress(_buffer->network_bytes_per_ns())) {
+        // Sending the uncompressed data costs less time than compressing it.
+        need_compress = false;
+        COUNTER_UPDATE(_compress_skipped_chunks_counter, 1);
+    }
+    if (need_compress) {
         SCOPED_TIMER(_compress_timer);
 
-        // Try compressing data to _compression_scratch, swap if compressed data is smaller
+        // Try compressing data to _compression_scratch, use it if compressed data is smaller
         int max_compressed_size = _compress_codec->max_compressed_len(uncompressed_size);
 
         if (_compression_scratch.size() < max_compressed_size) {
@@ -586,36 +730,28 @@ Status ExchangeSinkOperator::serialize_chunk(const vectorized::Chunk* src, Chunk
         }
 
         Slice compressed_slice{_compression_scratch.data(), _compression_scratch.size()};
-        _compress_codec->compress(dst->data(), &compressed_slice);
+        const int64_t compress_start_ns = MonotonicNanos();
+        _compress_codec->compress(uncompressed_slice, &compressed_slice);
+        _adaptive_compression.update(uncompressed_size, compressed_slice.size, MonotonicNanos() - compress_start_ns);
         double compress_ratio = (static_cast<double>(uncompressed_size)) / compressed_slice.size;
         if (LIKELY(compress_ratio > config::rpc_compress_ratio_threshold)) {
-            _compression_scratch.resize(compressed_slice.size);
-            dst->mutable_data()->swap(reinterpret_cast<std::string&>(_compression_scratch));
+            attachment->append(compressed_slice.data, compressed_slice.size);
+            dst->set_data_size(compressed_slice.size);
             dst->set_compress_type(_compress_type);
+            is_compressed = true;
         }
 
         VLOG_ROW << "uncompressed size: " << uncompressed_size << ", compressed size: " << compressed_slice.size;
     }
-    size_t chunk_size = dst->data().size();
-    VLOG_ROW << "chunk data size " << chunk_size;
+    if (!is_compressed) {
+        attachment->append(serialized);
+    }
+    VLOG_ROW << "chunk data size " << dst->data_size();
 
     COUNTER_UPDATE(_uncompressed_bytes_counter, uncompressed_size * num_receivers);
     return Status::OK();
 }
 
-void ExchangeSinkOperator::construct_brpc_attachment(PTransmitChunkParamsPtr chunk_request, butil::IOBuf& attachment) {
-    for (int i = 0; i < chunk_request->chunks().size(); ++i) {
-        auto chunk = chunk_request->mutable_chunks(i);
-        chunk->set_data_size(chunk->data().size());
-        attachment.append(chunk->data());
-        chunk->clear_data();
-        // If the request is too big, free the memory in order to avoid OOM
-        if (_is_large_chunk(chunk->data_size())) {
-            chunk->mutable_data()->shrink_to_fit();
-        }
-    }
-}
-
 ExchangeSinkOperatorFactory::ExchangeSinkOperatorFactory(
         int32_t id, int32_t plan_node_id, std::shared_ptr<SinkBuffer> buffer, TPartitionType::type part_type,
         const std::vector<TPlanFragmentDestination>& destinations, bool is_pipeline_level_shuffle, int32_t num_shuffles,
@@ -636,10 +772,12 @@ ExchangeSinkOperatorFactory::ExchangeSinkOperatorFactory(
           _output_columns(output_columns) {}
 
 OperatorPtr ExchangeSinkOperatorFactory::create(int32_t degree_of_parallelism, int32_t driver_sequence) {
-    return std::make_shared<ExchangeSinkOperator>(this, _id, _plan_node_id, driver_sequence, _buffer, _part_type,
-                                                  _destinations, _is_pipeline_level_shuffle, _num_shuffles, _sender_id,
-                                                  _dest_node_id, _partition_expr_ctxs, _enable_exchange_pass_through,
-                                                  _fragment_ctx, _output_columns);
+    auto op = std::make_shared<ExchangeSinkOperator>(this, _id, _plan_node_id, driver_sequence, _buffer, _part_type,
+                                                     _destinations, _is_pipeline_level_shuffle, _num_shuffles,
+                                                     _sender_id, _dest_node_id, _partition_expr_ctxs,
+                                                     _enable_exchange_pass_through, _fragment_ctx, _output_columns);
+    op->set_serialized_chunk_cache(_serialized_chunk_cache);
+    return op;
 }
 
 Status ExchangeSinkOperatorFactory::prepare(RuntimeState* state) {
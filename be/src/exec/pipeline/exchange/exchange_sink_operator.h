@@ -9,6 +9,8 @@
 #include "common/object_pool.h"
 #include "common/status.h"
 #include "exec/data_sink.h"
+#include "exec/pipeline/exchange/adaptive_compression.h"
+#include "exec/pipeline/exchange/serialized_chunk_cache.h"
 #include "exec/pipeline/exchange/sink_buffer.h"
 #include "exec/pipeline/fragment_context.h"
 #include "exec/pipeline/operator.h"
@@ -16,10 +18,7 @@
 #include "gen_cpp/internal_service.pb.h"
 #include "util/raw_container.h"
 #include "util/runtime_profile.h"
-
-namespace butil {
-class IOBuf;
-}
+#include "util/space_saving_sketch.h"
 
 namespace starrocks {
 
@@ -59,21 +58,26 @@ public:
 
     Status push_chunk(RuntimeState* state, const vectorized::ChunkPtr& chunk) override;
 
-    // For the first chunk , serialize the chunk data and meta to ChunkPB both.
-    // For other chunk, only serialize the chunk data to ChunkPB.
-    Status serialize_chunk(const vectorized::Chunk* chunk, ChunkPB* dst, bool* is_first_chunk, int num_receivers = 1);
-
-    void construct_brpc_attachment(PTransmitChunkParamsPtr _chunk_request, butil::IOBuf& attachment);
+    // Serialize the chunk data to the end of attachment, which is sent as the brpc attachment of the request.
+    // For the first chunk, also serialize the chunk meta to ChunkPB.
+    Status serialize_chunk(const vectorized::Chunk* chunk, ChunkPB* dst, butil::IOBuf* attachment, bool* is_first_chunk,
+                           int num_receivers = 1);
 
-private:
-    bool _is_large_chunk(size_t sz) const {
-        // ref olap_scan_node.cpp release_large_columns
-        return sz > runtime_state()->chunk_size() * 512;
+    void set_serialized_chunk_cache(std::shared_ptr<SerializedChunkCache> cache) {
+        _serialized_chunk_cache = std::move(cache);
     }
 
+private:
     class Channel;
 
     static const int32_t DEFAULT_DRIVER_SEQUENCE = 0;
+    // The number of the partition keys tracked by _shuffle_key_sketch.
+    static constexpr size_t SHUFFLE_KEY_SKETCH_CAPACITY = 32;
+
+    // Sample the hash values of the partition keys of the current chunk into _shuffle_key_sketch.
+    void _sample_shuffle_keys(size_t num_rows);
+    // Report the distribution of rows among channels and the hot partition keys.
+    void _update_shuffle_skew_profile();
 
     const std::shared_ptr<SinkBuffer>& _buffer;
 
@@ -106,24 +110,28 @@ private:
 
     // Only used when broadcast
     PTransmitChunkParamsPtr _chunk_request;
+    butil::IOBuf _attachment;
     size_t _current_request_bytes = 0;
+    // Shared by the ExchangeSinkOperators of a multi-cast sink to serialize each broadcast chunk once, or null.
+    std::shared_ptr<SerializedChunkCache> _serialized_chunk_cache;
 
     bool _is_first_chunk = true;
 
-    // String to write compressed chunk data in serialize().
-    // This is a string so we can swap() with the string in the ChunkPB we're serializing
-    // to (we don't compress directly into the ChunkPB in case the compressed data is
-    // longer than the uncompressed data).
+    // Buffer to write compressed chunk data in serialize_chunk(), which is reused across chunks.
+    // The compressed data is copied to the attachment only if it is much smaller than the uncompressed data.
     raw::RawString _compression_scratch;
 
     CompressionTypePB _compress_type = CompressionTypePB::NO_COMPRESSION;
     const BlockCompressionCodec* _compress_codec = nullptr;
+    AdaptiveCompression _adaptive_compression;
 
     RuntimeProfile::Counter* _serialize_chunk_timer = nullptr;
     RuntimeProfile::Counter* _shuffle_hash_timer = nullptr;
     RuntimeProfile::Counter* _compress_timer = nullptr;
     RuntimeProfile::Counter* _bytes_pass_through_counter = nullptr;
     RuntimeProfile::Counter* _uncompressed_bytes_counter = nullptr;
+    RuntimeProfile::Counter* _compress_skipped_chunks_counter = nullptr;
+    RuntimeProfile::Counter* _shared_serialized_chunks_counter = nullptr;
 
     std::atomic<bool> _is_finished = false;
     std::atomic<bool> _is_cancelled = false;
@@ -145,6 +153,15 @@ private:
     // the last.
     std::vector<uint32_t> _row_indexes;
 
+    // The heavy hitters of the hash values of the partition keys, sampled every _shuffle_key_sample_interval rows,
+    // which is null if pipeline_exchange_skew_detection_sample_interval is 0.
+    std::unique_ptr<SpaceSavingSketch<uint32_t>> _shuffle_key_sketch;
+    size_t _shuffle_key_sample_interval = 0;
+    // The index of the next sampled row in the next chunk.
+    size_t _shuffle_key_sample_offset = 0;
+    // The number of rows sent to each channel.
+    std::vector<int64_t> _channel_rows;
+
     FragmentContext* const _fragment_ctx;
 
     const std::vector<int32_t>& _output_columns;
@@ -168,6 +185,11 @@ public:
 
     void close(RuntimeState* state) override;
 
+    // The ExchangeSinkOperators of the consumers of a multi-cast sink share the serialized broadcast chunks by cache.
+    void set_serialized_chunk_cache(std::shared_ptr<SerializedChunkCache> cache) {
+        _serialized_chunk_cache = std::move(cache);
+    }
+
 private:
     std::shared_ptr<SinkBuffer> _buffer;
     const TPartitionType::type _part_type;
@@ -186,6 +208,8 @@ private:
     FragmentContext* const _fragment_ctx;
 
     const std::vector<int32_t> _output_columns;
+
+    std::shared_ptr<SerializedChunkCache> _serialized_chunk_cache;
 };
 
 } // namespace pipeline
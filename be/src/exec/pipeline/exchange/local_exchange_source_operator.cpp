@@ -108,6 +108,12 @@ vectorized::ChunkPtr LocalExchangeSourceOperator::_pull_shuffle_chunk(RuntimeSta
         _partition_rows_num -= rows_num;
     }
 
+    // All the rows of the input chunk belong to this partition, in the original order,
+    // because the row indexes of each partition are ascending. Use the input chunk without copying it.
+    if (selected_partition_chunks.size() == 1 && rows_num == selected_partition_chunks[0].chunk->num_rows()) {
+        return std::move(selected_partition_chunks[0].chunk);
+    }
+
     // Unlock during merging partition chunks into a full chunk.
     vectorized::ChunkPtr chunk = selected_partition_chunks[0].chunk->clone_empty_with_slot();
     chunk->reserve(rows_num);
@@ -0,0 +1,44 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "exec/pipeline/exchange/serialized_chunk_cache.h"
+
+#include "column/chunk.h"
+
+namespace starrocks::pipeline {
+
+bool SerializedChunkCache::get(const vectorized::Chunk* chunk, bool is_first_chunk, ChunkPB* pchunk,
+                               butil::IOBuf* attachment) {
+    std::lock_guard<std::mutex> l(_mutex);
+    for (auto it = _entries.begin(); it != _entries.end(); ++it) {
+        if (it->chunk.get() != chunk || it->is_first_chunk != is_first_chunk) {
+            continue;
+        }
+        *pchunk = it->pchunk;
+        attachment->append(it->attachment);
+        if (--it->num_remaining_consumers <= 0) {
+            _entries.erase(it);
+        }
+        return true;
+    }
+    return false;
+}
+
+void SerializedChunkCache::put(const vectorized::ChunkPtr& chunk, bool is_first_chunk, const ChunkPB& pchunk,
+                               const butil::IOBuf& attachment) {
+    if (_num_consumers <= 1) {
+        return;
+    }
+    std::lock_guard<std::mutex> l(_mutex);
+    for (const auto& entry : _entries) {
+        // Another consumer has serialized the same chunk concurrently.
+        if (entry.chunk == chunk && entry.is_first_chunk == is_first_chunk) {
+            return;
+        }
+    }
+    _entries.push_back({chunk, is_first_chunk, pchunk, attachment, _num_consumers - 1});
+    if (_entries.size() > MAX_NUM_ENTRIES) {
+        _entries.pop_front();
+    }
+}
+
+} // namespace starrocks::pipeline
@@ -0,0 +1,53 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <butil/iobuf.h>
+
+#include <list>
+#include <mutex>
+
+#include "column/vectorized_fwd.h"
+#include "gen_cpp/data.pb.h"
+
+namespace starrocks::pipeline {
+
+// SerializedChunkCache shares the serialized chunks among the ExchangeSinkOperators of a multi-cast sink.
+//
+// Every consumer of MultiCastLocalExchanger receives the same chunks in the same order, so the ExchangeSinkOperator
+// of each consumer would serialize and compress the same chunk again. Instead, the first consumer puts the
+// serialized chunk to the cache, and the other consumers take it from the cache. The serialized data is shared
+// by the reference count of butil::IOBuf, without copying.
+//
+// A miss of the cache is harmless, the consumer just serializes the chunk by itself. So the cache only keeps the
+// latest MAX_NUM_ENTRIES chunks, in case that some consumers are much slower than others or finish early.
+class SerializedChunkCache {
+public:
+    explicit SerializedChunkCache(int32_t num_consumers) : _num_consumers(num_consumers) {}
+
+    // Get the serialized chunk and append its data to attachment. Return false if it isn't cached.
+    // is_first_chunk must match, because the meta is serialized only for the first chunk.
+    bool get(const vectorized::Chunk* chunk, bool is_first_chunk, ChunkPB* pchunk, butil::IOBuf* attachment);
+
+    // Put the serialized chunk, which will be got by the other num_consumers-1 consumers.
+    void put(const vectorized::ChunkPtr& chunk, bool is_first_chunk, const ChunkPB& pchunk,
+             const butil::IOBuf& attachment);
+
+    static constexpr size_t MAX_NUM_ENTRIES = 64;
+
+private:
+    struct Entry {
+        // Hold the chunk, so that its address cannot be reused by another chunk while it's cached.
+        vectorized::ChunkPtr chunk;
+        bool is_first_chunk;
+        ChunkPB pchunk;
+        butil::IOBuf attachment;
+        int32_t num_remaining_consumers;
+    };
+
+    const int32_t _num_consumers;
+    std::mutex _mutex;
+    std::list<Entry> _entries;
+};
+
+} // namespace starrocks::pipeline
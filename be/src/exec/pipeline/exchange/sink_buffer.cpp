@@ -4,7 +4,12 @@
 
 #include <chrono>
 
+#include "exec/pipeline/poller_notifier.h"
+#include "exec/pipeline/query_context.h"
 #include "fmt/core.h"
+#include "runtime/data_stream_mgr.h"
+#include "runtime/exec_env.h"
+#include "util/starrocks_metrics.h"
 #include "util/time.h"
 #include "util/uid_util.h"
 
@@ -37,6 +42,8 @@ SinkBuffer::SinkBuffer(FragmentContext* fragment_ctx, const std::vector<TPlanFra
             _num_finished_rpcs[instance_id.lo] = 0;
             _num_in_flight_rpcs[instance_id.lo] = 0;
             _network_times[instance_id.lo] = TimeTrace{};
+            _credit_bytes[instance_id.lo] = -1;
+            _in_flight_bytes[instance_id.lo] = 0;
             _mutexes[instance_id.lo] = std::make_unique<Mutex>();
 
             PUniqueId finst_id;
@@ -50,6 +57,12 @@ SinkBuffer::SinkBuffer(FragmentContext* fragment_ctx, const std::vector<TPlanFra
     for (auto& [_, num] : _num_sinkers) {
         _num_remaining_eos += num;
     }
+
+    auto* query_ctx = fragment_ctx->runtime_state()->query_ctx();
+    if (query_ctx != nullptr && query_ctx->query_trace() != nullptr) {
+        _query_trace = query_ctx->query_trace();
+        _trace_pid = _query_trace->process_id(fragment_ctx->fragment_instance_id());
+    }
 }
 
 SinkBuffer::~SinkBuffer() {
@@ -136,6 +149,22 @@ void SinkBuffer::update_profile(RuntimeProfile* profile) {
     auto* request_sent_counter = ADD_COUNTER(profile, "RequestSent", TUnit::UNIT);
     COUNTER_SET(bytes_sent_counter, _bytes_sent);
     COUNTER_SET(request_sent_counter, _request_sent);
+    if (_num_credit_blocked > 0) {
+        auto* credit_blocked_counter = ADD_COUNTER(profile, "CreditBlockedCount", TUnit::UNIT);
+        COUNTER_SET(credit_blocked_counter, _num_credit_blocked);
+    }
+    if (_request_sent_locally > 0) {
+        auto* request_sent_locally_counter = ADD_COUNTER(profile, "RequestSentLocally", TUnit::UNIT);
+        COUNTER_SET(request_sent_locally_counter, _request_sent_locally);
+    }
+
+    // The effective batch size of the requests and chunks sent through the network.
+    auto* chunks_sent_counter = ADD_COUNTER(profile, "ChunksSent", TUnit::UNIT);
+    auto* avg_request_bytes_counter = ADD_COUNTER(profile, "AvgRequestBytes", TUnit::BYTES);
+    auto* avg_chunk_bytes_counter = ADD_COUNTER(profile, "AvgChunkBytes", TUnit::BYTES);
+    COUNTER_SET(chunks_sent_counter, _chunks_sent);
+    COUNTER_SET(avg_request_bytes_counter, _bytes_sent / std::max<int64_t>(1, _request_sent));
+    COUNTER_SET(avg_chunk_bytes_counter, _bytes_sent / std::max<int64_t>(1, _chunks_sent));
 
     if (_bytes_enqueued - _bytes_sent > 0) {
         auto* bytes_unsent_counter = ADD_COUNTER(profile, "BytesUnsent", TUnit::BYTES);
@@ -166,6 +195,16 @@ int64_t SinkBuffer::_network_time() {
     return max;
 }
 
+void SinkBuffer::_trace_rpc(const ClosureContext& ctx, bool success) {
+    // send_timestamp is the wall time, but the spans of the trace are in the monotonic time.
+    int64_t end_ns = MonotonicNanos();
+    int64_t start_ns = end_ns - std::max<int64_t>(GetCurrentTimeNanos() - ctx.send_timestamp, 0);
+    std::string name = fmt::format("{}{} to {}", ctx.params != nullptr ? "TransmitChunkLocally" : "TransmitChunk",
+                                   success ? "" : "Failed", print_id(ctx.instance_id));
+    int64_t id = HashUtil::hash64(&ctx.sequence, sizeof(ctx.sequence), ctx.instance_id.lo);
+    _query_trace->add_async_span(std::move(name), "exchange", _trace_pid, id, start_ns, end_ns);
+}
+
 void SinkBuffer::cancel_one_sinker() {
     if (--_num_uncancelled_sinkers == 0) {
         _is_finishing = true;
@@ -173,9 +212,27 @@ void SinkBuffer::cancel_one_sinker() {
 }
 
 void SinkBuffer::_update_network_time(const TUniqueId& instance_id, const int64_t send_timestamp,
-                                      const int64_t receive_timestamp) {
+                                      const int64_t receive_timestamp, const int64_t attachment_bytes) {
     int32_t concurrency = _num_in_flight_rpcs[instance_id.lo];
-    _network_times[instance_id.lo].update(receive_timestamp - send_timestamp, concurrency);
+    const int64_t network_time = receive_timestamp - send_timestamp;
+    _network_times[instance_id.lo].update(network_time, concurrency);
+    // The clocks of the sender and receiver may be not synchronized.
+    if (network_time > 0 && attachment_bytes > 0) {
+        _acked_bytes += attachment_bytes;
+        _acked_network_time_ns += network_time / std::max(1, concurrency + 1);
+    }
+}
+
+bool SinkBuffer::_exceeds_credit(const TUniqueId& instance_id, int64_t request_bytes) const {
+    if (!config::pipeline_sink_enable_credit_flow_control) {
+        return false;
+    }
+    const int64_t credit = _credit_bytes.at(instance_id.lo);
+    // There is always one request in flight at least, otherwise no ack will renew the credit.
+    if (credit < 0 || _num_in_flight_rpcs.at(instance_id.lo) == 0) {
+        return false;
+    }
+    return _in_flight_bytes.at(instance_id.lo) + request_bytes > credit;
 }
 
 void SinkBuffer::_process_send_window(const TUniqueId& instance_id, const int64_t sequence) {
@@ -195,15 +252,51 @@ void SinkBuffer::_process_send_window(const TUniqueId& instance_id, const int64_
 }
 
 void SinkBuffer::_try_to_send_rpc(const TUniqueId& instance_id, std::function<void()> pre_works) {
-    std::lock_guard<Mutex> l(*_mutexes[instance_id.lo]);
-    pre_works();
+    TransmitClosure* local_closure = nullptr;
+    {
+        std::lock_guard<Mutex> l(*_mutexes[instance_id.lo]);
+        pre_works();
+        local_closure = _try_to_send_rpc_locked(instance_id);
+    }
+    // The receiver may run the closure in place, whose handler acquires the mutex again,
+    // so the local transmission must be done after releasing the mutex.
+    if (local_closure != nullptr) {
+        _transmit_chunk_locally(local_closure);
+    }
+}
+
+void SinkBuffer::_transmit_chunk_locally(TransmitClosure* closure) {
+    // The same as PInternalServiceImplBase::transmit_chunk, except that there is no attachment to copy,
+    // since the chunks of a pass-through request are in PassThroughChunkBuffer.
+    // The closure may be run and destroyed by the receiver in another thread, once it's handed to the receiver.
+    const PTransmitChunkParamsPtr params = closure->context().params;
+    const TUniqueId instance_id = closure->context().instance_id;
+    closure->result.set_receive_timestamp(GetCurrentTimeNanos());
+    Status st;
+    st.to_protobuf(closure->result.mutable_status());
+    closure->result.set_credit_bytes(0);
+    int64_t credit_bytes = 0;
+    google::protobuf::Closure* done = closure;
+    st = _fragment_ctx->runtime_state()->exec_env()->stream_mgr()->transmit_chunk(*params, &done, &credit_bytes);
+    if (!st.ok()) {
+        LOG(WARNING) << "transmit chunk locally failed, message=" << st.get_error_msg()
+                     << ", fragment_instance_id=" << print_id(instance_id);
+    }
+    // The receiver holds the closure and runs it after consuming the chunks, if it has buffered too many chunks.
+    if (done != nullptr) {
+        st.to_protobuf(closure->result.mutable_status());
+        closure->result.set_credit_bytes(credit_bytes);
+        done->Run();
+    }
+}
 
+SinkBuffer::TransmitClosure* SinkBuffer::_try_to_send_rpc_locked(const TUniqueId& instance_id) {
     DeferOp decrease_defer([this]() { --_num_sending_rpc; });
     ++_num_sending_rpc;
 
     for (;;) {
         if (_is_finishing) {
-            return;
+            return nullptr;
         }
 
         auto& buffer = _buffers[instance_id.lo];
@@ -220,7 +313,11 @@ void SinkBuffer::_try_to_send_rpc(const TUniqueId& instance_id, std::function<vo
             too_much_brpc_process = _num_in_flight_rpcs[instance_id.lo] >= config::pipeline_sink_brpc_dop;
         }
         if (buffer.empty() || too_much_brpc_process) {
-            return;
+            return nullptr;
+        }
+        if (_exceeds_credit(instance_id, buffer.front().attachment.size())) {
+            _num_credit_blocked++;
+            return nullptr;
         }
 
         TransmitChunkInfo request = buffer.front();
@@ -237,7 +334,7 @@ void SinkBuffer::_try_to_send_rpc(const TUniqueId& instance_id, std::function<vo
         // But we must guarantee that first packet must be received first
         if (_num_finished_rpcs[instance_id.lo] == 0 && _num_in_flight_rpcs[instance_id.lo] > 0) {
             need_wait = true;
-            return;
+            return nullptr;
         }
         if (request.params->eos()) {
             DeferOp eos_defer([this, &instance_id, &need_wait]() {
@@ -264,7 +361,7 @@ void SinkBuffer::_try_to_send_rpc(const TUniqueId& instance_id, std::function<vo
                 // But we must guarantee that eos packent must be the last packet
                 if (_num_in_flight_rpcs[instance_id.lo] > 0) {
                     need_wait = true;
-                    return;
+                    return nullptr;
                 }
             }
         }
@@ -275,29 +372,47 @@ void SinkBuffer::_try_to_send_rpc(const TUniqueId& instance_id, std::function<vo
         if (!request.attachment.empty()) {
             _bytes_sent += request.attachment.size();
             _request_sent++;
+            _chunks_sent += request.params->chunks_size();
         }
 
-        auto* closure = new DisposableClosure<PTransmitChunkResult, ClosureContext>(
-                {instance_id, request.params->sequence(), GetCurrentTimeNanos()});
+        // The chunks of a pass-through request are appended to PassThroughChunkBuffer of this BE,
+        // so the request is delivered to the local DataStreamRecvr directly instead of by brpc.
+        const bool is_local = request.params->use_pass_through() && request.attachment.empty();
+        auto* closure = new TransmitClosure({instance_id, request.params->sequence(), GetCurrentTimeNanos(),
+                                             static_cast<int64_t>(request.attachment.size()),
+                                             is_local ? request.params : nullptr});
 
         closure->addFailedHandler([this](const ClosureContext& ctx) noexcept {
+            if (_query_trace != nullptr) {
+                _trace_rpc(ctx, false);
+            }
             _is_finishing = true;
             {
                 std::lock_guard<Mutex> l(*_mutexes[ctx.instance_id.lo]);
                 ++_num_finished_rpcs[ctx.instance_id.lo];
                 --_num_in_flight_rpcs[ctx.instance_id.lo];
+                _in_flight_bytes[ctx.instance_id.lo] -= ctx.attachment_bytes;
             }
             --_total_in_flight_rpc;
+            PollerNotifier::instance()->notify();
             std::string err_msg = fmt::format("transmit chunk rpc failed:{}", print_id(ctx.instance_id));
             _fragment_ctx->cancel(Status::InternalError(err_msg));
             LOG(WARNING) << err_msg;
         });
         closure->addSuccessHandler([this](const ClosureContext& ctx, const PTransmitChunkResult& result) noexcept {
+            if (_query_trace != nullptr) {
+                _trace_rpc(ctx, true);
+            }
+            if (ctx.params == nullptr) {
+                StarRocksMetrics::instance()->exchange_transmit_rpc_latency_us.observe(
+                        (GetCurrentTimeNanos() - ctx.send_timestamp) / 1000);
+            }
             Status status(result.status());
             {
                 std::lock_guard<Mutex> l(*_mutexes[ctx.instance_id.lo]);
                 ++_num_finished_rpcs[ctx.instance_id.lo];
                 --_num_in_flight_rpcs[ctx.instance_id.lo];
+                _in_flight_bytes[ctx.instance_id.lo] -= ctx.attachment_bytes;
             }
             if (!status.ok()) {
                 _is_finishing = true;
@@ -307,21 +422,32 @@ void SinkBuffer::_try_to_send_rpc(const TUniqueId& instance_id, std::function<vo
             } else {
                 _try_to_send_rpc(ctx.instance_id, [&]() {
                     _process_send_window(ctx.instance_id, ctx.sequence);
-                    _update_network_time(ctx.instance_id, ctx.send_timestamp, result.receive_timestamp());
+                    _update_network_time(ctx.instance_id, ctx.send_timestamp, result.receive_timestamp(),
+                                         ctx.attachment_bytes);
+                    if (result.has_credit_bytes()) {
+                        _credit_bytes[ctx.instance_id.lo] = result.credit_bytes();
+                    }
                 });
             }
             --_total_in_flight_rpc;
+            PollerNotifier::instance()->notify();
         });
 
         ++_total_in_flight_rpc;
         ++_num_in_flight_rpcs[instance_id.lo];
+        _in_flight_bytes[instance_id.lo] += request.attachment.size();
+
+        if (is_local) {
+            _request_sent_locally++;
+            return closure;
+        }
 
         closure->cntl.Reset();
         closure->cntl.set_timeout_ms(_brpc_timeout_ms);
         closure->cntl.request_attachment().append(request.attachment);
         request.brpc_stub->transmit_chunk(&closure->cntl, request.params.get(), &closure->result, closure);
 
-        return;
+        return nullptr;
     }
 }
 } // namespace starrocks::pipeline
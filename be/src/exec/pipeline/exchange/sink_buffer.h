@@ -12,6 +12,7 @@
 #include "bthread/mutex.h"
 #include "column/chunk.h"
 #include "exec/pipeline/fragment_context.h"
+#include "exec/pipeline/query_trace.h"
 #include "gen_cpp/BackendService.h"
 #include "runtime/current_thread.h"
 #include "runtime/runtime_state.h"
@@ -38,6 +39,10 @@ struct ClosureContext {
     TUniqueId instance_id;
     int64_t sequence;
     int64_t send_timestamp;
+    int64_t attachment_bytes;
+    // The pass-through request transmitted locally, which must be alive until the closure is run,
+    // since the local receiver may hold the closure. It's null for the request sent by brpc.
+    PTransmitChunkParamsPtr params;
 };
 
 // TimeTrace is introduced to estimate time more accurately.
@@ -76,24 +81,40 @@ public:
     // Add counters to the given profile
     void update_profile(RuntimeProfile* profile);
 
+    // The estimated throughput of the network to send the attachments, or 0 if it's unknown yet.
+    double network_bytes_per_ns() const {
+        const int64_t network_time = _acked_network_time_ns;
+        return network_time > 0 ? static_cast<double>(_acked_bytes) / network_time : 0;
+    }
+
     // When all the ExchangeSinkOperator shared this SinkBuffer are cancelled,
     // the rest chunk request and EOS request needn't be sent anymore.
     void cancel_one_sinker();
 
 private:
     using Mutex = bthread::Mutex;
+    using TransmitClosure = DisposableClosure<PTransmitChunkResult, ClosureContext>;
 
     void _update_network_time(const TUniqueId& instance_id, const int64_t send_timestamp,
-                              const int64_t receive_timestamp);
+                              const int64_t receive_timestamp, const int64_t attachment_bytes);
     // Update the discontinuous acked window, here are the invariants:
     // all acks received with sequence from [0, _max_continuous_acked_seqs[x]]
     // not all the acks received with sequence from [_max_continuous_acked_seqs[x]+1, _request_seqs[x]]
     // _discontinuous_acked_seqs[x] stored the received discontinuous acks
     void _process_send_window(const TUniqueId& instance_id, const int64_t sequence);
 
+    // Whether sending a request of request_bytes exceeds the credit advertised by the receiver.
+    bool _exceeds_credit(const TUniqueId& instance_id, int64_t request_bytes) const;
+
     // Try to send rpc if buffer is not empty and channel is not busy
     // And we need to put this function and other extra works(pre_works) together as an atomic operation
     void _try_to_send_rpc(const TUniqueId& instance_id, std::function<void()> pre_works);
+    // Send the requests of instance_id with the mutex held. Returns the closure of the pass-through request,
+    // which should be transmitted locally by _transmit_chunk_locally() after releasing the mutex, or null.
+    TransmitClosure* _try_to_send_rpc_locked(const TUniqueId& instance_id);
+    // Deliver the pass-through request to DataStreamRecvr of this BE without brpc. The flow control is the same
+    // as brpc, that is the closure is held by the receiver until the buffered chunks are consumed.
+    void _transmit_chunk_locally(TransmitClosure* closure);
 
     // Roughly estimate network time which is defined as the time between sending a and receiving a packet,
     // and the processing time of both sides are excluded
@@ -103,6 +124,9 @@ private:
     // And we just pick the maximum accumulated_network_time among all destination
     int64_t _network_time();
 
+    // Record the span of the rpc from sending it to receiving its response in the query trace.
+    void _trace_rpc(const ClosureContext& ctx, bool success);
+
     FragmentContext* _fragment_ctx;
     const MemTracker* _mem_tracker;
     const int32_t _brpc_timeout_ms;
@@ -134,6 +158,10 @@ private:
     phmap::flat_hash_map<int64_t, int32_t> _num_finished_rpcs;
     phmap::flat_hash_map<int64_t, int32_t> _num_in_flight_rpcs;
     phmap::flat_hash_map<int64_t, TimeTrace> _network_times;
+    // The last credit advertised by the receiver, or -1 if the receiver doesn't advertise credits,
+    // and the bytes of the in-flight attachments.
+    phmap::flat_hash_map<int64_t, int64_t> _credit_bytes;
+    phmap::flat_hash_map<int64_t, int64_t> _in_flight_bytes;
     phmap::flat_hash_map<int64_t, std::unique_ptr<Mutex>> _mutexes;
 
     // True means that SinkBuffer needn't input chunk and send chunk anymore,
@@ -155,10 +183,20 @@ private:
     std::atomic<int64_t> _request_enqueued = 0;
     std::atomic<int64_t> _bytes_sent = 0;
     std::atomic<int64_t> _request_sent = 0;
+    std::atomic<int64_t> _chunks_sent = 0;
+    std::atomic<int64_t> _request_sent_locally = 0;
+    std::atomic<int64_t> _num_credit_blocked = 0;
+    // The bytes of the acked attachments, and their network time divided by the number of concurrent RPCs.
+    std::atomic<int64_t> _acked_bytes = 0;
+    std::atomic<int64_t> _acked_network_time_ns = 0;
 
     int64_t _pending_timestamp = -1;
     mutable std::atomic<int64_t> _last_full_timestamp = -1;
     mutable std::atomic<int64_t> _full_time = 0;
+
+    // The trace of the query, the spans of the rpcs are recorded if it's not nullptr.
+    QueryTracePtr _query_trace;
+    int64_t _trace_pid = 0;
 }; // namespace starrocks::pipeline
 
 } // namespace starrocks::pipeline
@@ -92,6 +92,13 @@ TReportExecStatusParams ExecStateReporter::create_report_exec_status_params(Frag
             }
         }
 
+        if (done && status.ok()) {
+            auto join_statistics = runtime_state->join_statistics();
+            if (!join_statistics.empty()) {
+                params.__set_join_statistics(std::move(join_statistics));
+            }
+        }
+
         // Send new errors to coordinator
         runtime_state->get_unreported_errors(&(params.error_log));
         params.__isset.error_log = (params.error_log.size() > 0);
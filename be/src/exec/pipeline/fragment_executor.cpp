@@ -2,6 +2,7 @@
 
 #include "exec/pipeline/fragment_executor.h"
 
+#include <map>
 #include <unordered_map>
 
 #include "common/config.h"
@@ -10,6 +11,7 @@
 #include "exec/pipeline/exchange/multi_cast_local_exchange.h"
 #include "exec/pipeline/exchange/sink_buffer.h"
 #include "exec/pipeline/fragment_context.h"
+#include "exec/pipeline/fused_operator.h"
 #include "exec/pipeline/pipeline_builder.h"
 #include "exec/pipeline/pipeline_driver_executor.h"
 #include "exec/pipeline/result_sink_operator.h"
@@ -24,6 +26,7 @@
 #include "gutil/map_util.h"
 #include "runtime/data_stream_mgr.h"
 #include "runtime/data_stream_sender.h"
+#include "runtime/descriptor_tbl_cache.h"
 #include "runtime/descriptors.h"
 #include "runtime/exec_env.h"
 #include "runtime/multi_cast_data_stream_sink.h"
@@ -83,6 +86,7 @@ Status FragmentExecutor::_prepare_query_ctx(ExecEnv* exec_env, const TExecPlanFr
 
     // initialize query's deadline
     _query_ctx->extend_lifetime();
+    _query_ctx->init_query_deadline(_query_ctx->get_expire_seconds());
 
     return Status::OK();
 }
@@ -187,18 +191,35 @@ Status FragmentExecutor::_prepare_runtime_state(ExecEnv* exec_env, const TExecPl
                 return Status::Cancelled("Query terminates prematurely");
             }
         } else {
-            RETURN_IF_ERROR(DescriptorTbl::create(_query_ctx->object_pool(), t_desc_tbl, &desc_tbl,
-                                                  runtime_state->chunk_size()));
+            RETURN_IF_ERROR(_create_desc_tbl(exec_env, request, _query_ctx->object_pool(), &desc_tbl));
             _query_ctx->set_desc_tbl(desc_tbl);
         }
     } else {
-        RETURN_IF_ERROR(DescriptorTbl::create(obj_pool, t_desc_tbl, &desc_tbl, runtime_state->chunk_size()));
+        RETURN_IF_ERROR(_create_desc_tbl(exec_env, request, obj_pool, &desc_tbl));
     }
     runtime_state->set_desc_tbl(desc_tbl);
 
     return Status::OK();
 }
 
+Status FragmentExecutor::_create_desc_tbl(ExecEnv* exec_env, const TExecPlanFragmentParams& request, ObjectPool* pool,
+                                          DescriptorTbl** desc_tbl) {
+    const auto& t_desc_tbl = request.desc_tbl;
+    auto* runtime_state = _fragment_ctx->runtime_state();
+    auto* cache = exec_env->descriptor_tbl_cache();
+    // The slot descriptors are rewritten by the query with global dicts, so they cannot be shared.
+    bool has_global_dicts = request.fragment.__isset.query_global_dicts && !request.fragment.query_global_dicts.empty();
+    if (cache == nullptr || has_global_dicts || !DescriptorTblCache::is_cacheable(t_desc_tbl)) {
+        return DescriptorTbl::create(pool, t_desc_tbl, desc_tbl, runtime_state->chunk_size());
+    }
+
+    DescriptorTblCache::Handle handle;
+    RETURN_IF_ERROR(cache->get_or_create(t_desc_tbl, runtime_state->chunk_size(), desc_tbl, &handle));
+    // Keep the shared DescriptorTbl alive until the objects of pool are released.
+    pool->add(new DescriptorTblCache::Handle(std::move(handle)));
+    return Status::OK();
+}
+
 int32_t FragmentExecutor::_calc_dop(ExecEnv* exec_env, const TExecPlanFragmentParams& request) const {
     int32_t degree_of_parallelism = request.__isset.pipeline_dop ? request.pipeline_dop : 0;
     return exec_env->calc_pipeline_dop(degree_of_parallelism);
@@ -274,6 +295,12 @@ Status FragmentExecutor::_prepare_pipeline_driver(ExecEnv* exec_env, const TExec
         }
         _decompose_data_sink_to_operator(runtime_state, &context, fragment.output_sink, sink.get());
     }
+    if (config::pipeline_enable_operator_fusion) {
+        for (const auto& pipeline : pipelines) {
+            FusedOperatorFactory::fuse_operators(&pipeline->get_op_factories(),
+                                                 [&context]() { return context.next_operator_id(); });
+        }
+    }
     RETURN_IF_ERROR(_fragment_ctx->prepare_all_pipelines());
 
     size_t driver_id = 0;
@@ -399,6 +426,12 @@ Status FragmentExecutor::execute(ExecEnv* exec_env) {
 
     auto* executor =
             _fragment_ctx->enable_resource_group() ? exec_env->wg_driver_executor() : exec_env->driver_executor();
+    // For the short query, whose fragment consists of a single driver, run the driver on the RPC thread if possible.
+    if (config::pipeline_enable_short_query_inline_execution && !_fragment_ctx->enable_resource_group() &&
+        _fragment_ctx->drivers().size() == 1) {
+        executor->submit_inline(_fragment_ctx->drivers()[0].get());
+        return Status::OK();
+    }
     for (const auto& driver : _fragment_ctx->drivers()) {
         DCHECK(!_fragment_ctx->enable_resource_group() || driver->workgroup() != nullptr);
         executor->submit(driver.get());
@@ -493,6 +526,21 @@ void FragmentExecutor::_decompose_data_sink_to_operator(RuntimeState* runtime_st
             fragment_ctx->pipelines().back()->add_op_factory(sink_op);
         }
 
+        // The broadcast sinks with the same output columns receive and serialize the same chunks,
+        // so they share the serialized chunks.
+        std::map<std::vector<int32_t>, int32_t> num_broadcast_sinks;
+        for (const auto& sender : sinks) {
+            if (sender->get_partition_type() == TPartitionType::UNPARTITIONED) {
+                num_broadcast_sinks[sender->output_columns()]++;
+            }
+        }
+        std::map<std::vector<int32_t>, std::shared_ptr<SerializedChunkCache>> serialized_chunk_caches;
+        for (const auto& [output_columns, num_sinks] : num_broadcast_sinks) {
+            if (num_sinks > 1) {
+                serialized_chunk_caches[output_columns] = std::make_shared<SerializedChunkCache>(num_sinks);
+            }
+        }
+
         // ==== create source/sink pipelines ====
         for (size_t i = 0; i < sinks.size(); i++) {
             const auto& sender = sinks[i];
@@ -520,6 +568,12 @@ void FragmentExecutor::_decompose_data_sink_to_operator(RuntimeState* runtime_st
                     sender->destinations(), is_pipeline_level_shuffle, dest_dop, sender->sender_id(),
                     sender->get_dest_node_id(), sender->get_partition_exprs(),
                     sender->get_enable_exchange_pass_through(), fragment_ctx, sender->output_columns());
+            if (sender->get_partition_type() == TPartitionType::UNPARTITIONED) {
+                auto it = serialized_chunk_caches.find(sender->output_columns());
+                if (it != serialized_chunk_caches.end()) {
+                    sink_op->set_serialized_chunk_cache(it->second);
+                }
+            }
 
             ops.emplace_back(source_op);
             ops.emplace_back(sink_op);
@@ -9,7 +9,9 @@
 
 namespace starrocks {
 class DataSink;
+class DescriptorTbl;
 class ExecEnv;
+class ObjectPool;
 class RuntimeProfile;
 class TPlanFragmentExecParams;
 class RuntimeState;
@@ -41,6 +43,9 @@ private:
     Status _prepare_runtime_state(ExecEnv* exec_env, const TExecPlanFragmentParams& request);
     Status _prepare_exec_plan(ExecEnv* exec_env, const TExecPlanFragmentParams& request);
     Status _prepare_global_dict(const TExecPlanFragmentParams& request);
+    // Create the DescriptorTbl in pool, or share the cached one if possible.
+    Status _create_desc_tbl(ExecEnv* exec_env, const TExecPlanFragmentParams& request, ObjectPool* pool,
+                            DescriptorTbl** desc_tbl);
     Status _prepare_pipeline_driver(ExecEnv* exec_env, const TExecPlanFragmentParams& request);
 
     void _decompose_data_sink_to_operator(RuntimeState* state, PipelineBuilderContext* context,
@@ -0,0 +1,180 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "exec/pipeline/fused_operator.h"
+
+#include "column/chunk.h"
+#include "exec/pipeline/limit_operator.h"
+#include "exec/pipeline/project_operator.h"
+#include "exec/pipeline/select_operator.h"
+#include "runtime/runtime_state.h"
+
+namespace starrocks::pipeline {
+
+FusedOperator::FusedOperator(OperatorFactory* factory, int32_t id, int32_t plan_node_id, int32_t driver_sequence,
+                             Operators&& operators)
+        : Operator(factory, id, "fused", plan_node_id, driver_sequence), _operators(std::move(operators)) {
+    for (size_t i = 0; i < _operators.size(); ++i) {
+        if (typeid(*_operators[i]) == typeid(LimitOperator)) {
+            _limit_indexes.emplace_back(i);
+        }
+    }
+}
+
+Status FusedOperator::prepare(RuntimeState* state) {
+    RETURN_IF_ERROR(Operator::prepare(state));
+    for (auto& op : _operators) {
+        RETURN_IF_ERROR(op->prepare(state));
+        _unique_metrics->add_child(op->get_runtime_profile(), true, nullptr);
+    }
+    return Status::OK();
+}
+
+void FusedOperator::close(RuntimeState* state) {
+    for (auto& op : _operators) {
+        op->close(state);
+    }
+    Operator::close(state);
+}
+
+Status FusedOperator::set_finishing(RuntimeState* state) {
+    _is_finished = true;
+    return _flush(state);
+}
+
+StatusOr<vectorized::ChunkPtr> FusedOperator::pull_chunk(RuntimeState* state) {
+    // The operators following a reached LimitOperator don't receive chunks anymore,
+    // so flush the chunks buffered by them.
+    if (!_is_flushed && _is_limit_reached()) {
+        RETURN_IF_ERROR(_flush(state));
+    }
+    if (_output_chunks.empty()) {
+        return nullptr;
+    }
+    auto chunk = std::move(_output_chunks.front());
+    _output_chunks.pop();
+    return chunk;
+}
+
+Status FusedOperator::push_chunk(RuntimeState* state, const vectorized::ChunkPtr& chunk) {
+    return _transform(state, 0, chunk);
+}
+
+Status FusedOperator::_transform(RuntimeState* state, size_t start, vectorized::ChunkPtr chunk) {
+    for (size_t i = start; i < _operators.size(); ++i) {
+        if (chunk == nullptr || chunk->is_empty()) {
+            return Status::OK();
+        }
+        auto& op = _operators[i];
+        RETURN_IF_ERROR(op->push_chunk(state, chunk));
+        // Each fused operator is ready to output after receiving a chunk, although the output chunk may be
+        // empty, e.g. SelectOperator keeps the small chunk to merge it with the following ones.
+        DCHECK(op->has_output());
+        ASSIGN_OR_RETURN(chunk, op->pull_chunk(state));
+    }
+    if (chunk != nullptr && !chunk->is_empty()) {
+        _output_chunks.emplace(std::move(chunk));
+    }
+    return Status::OK();
+}
+
+Status FusedOperator::_flush(RuntimeState* state) {
+    if (_is_flushed) {
+        return Status::OK();
+    }
+    _is_flushed = true;
+    for (size_t i = 0; i < _operators.size(); ++i) {
+        auto& op = _operators[i];
+        RETURN_IF_ERROR(op->set_finishing(state));
+        while (op->has_output()) {
+            ASSIGN_OR_RETURN(auto chunk, op->pull_chunk(state));
+            RETURN_IF_ERROR(_transform(state, i + 1, std::move(chunk)));
+        }
+    }
+    return Status::OK();
+}
+
+bool FusedOperator::_is_limit_reached() const {
+    for (auto idx : _limit_indexes) {
+        if (_operators[idx]->is_finished()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+FusedOperatorFactory::FusedOperatorFactory(int32_t id, OpFactories&& factories)
+        : OperatorFactory(id, "fused", factories[0]->plan_node_id()), _factories(std::move(factories)) {}
+
+OperatorPtr FusedOperatorFactory::create(int32_t degree_of_parallelism, int32_t driver_sequence) {
+    Operators operators;
+    operators.reserve(_factories.size());
+    for (auto& factory : _factories) {
+        operators.emplace_back(factory->create(degree_of_parallelism, driver_sequence));
+    }
+    return std::make_shared<FusedOperator>(this, _id, _plan_node_id, driver_sequence, std::move(operators));
+}
+
+Status FusedOperatorFactory::prepare(RuntimeState* state) {
+    RETURN_IF_ERROR(OperatorFactory::prepare(state));
+    for (auto& factory : _factories) {
+        RETURN_IF_ERROR(factory->prepare(state));
+    }
+    return Status::OK();
+}
+
+void FusedOperatorFactory::close(RuntimeState* state) {
+    for (auto& factory : _factories) {
+        factory->close(state);
+    }
+    OperatorFactory::close(state);
+}
+
+bool FusedOperatorFactory::is_fusible(const OperatorFactory* factory) {
+    if (typeid(*factory) == typeid(ProjectOperatorFactory) || typeid(*factory) == typeid(LimitOperatorFactory)) {
+        return true;
+    }
+    if (typeid(*factory) == typeid(SelectOperatorFactory)) {
+        // The driver waits for the runtime filters of each operator before executing it, but the runtime filters
+        // of the fused operators are invisible to the driver, so SelectOperator with runtime filters isn't fused.
+        const auto* rf_collector = factory->get_runtime_bloom_filters();
+        return factory->rf_waiting_set().empty() && (rf_collector == nullptr || rf_collector->descriptors().empty());
+    }
+    return false;
+}
+
+void FusedOperatorFactory::fuse_operators(OpFactories* factories, const std::function<int32_t()>& next_operator_id) {
+    if (factories->size() <= 3) {
+        return;
+    }
+
+    OpFactories fused_factories;
+    fused_factories.reserve(factories->size());
+    OpFactories fusible_chain;
+    auto flush_chain = [&]() {
+        if (fusible_chain.size() >= 2) {
+            fused_factories.emplace_back(
+                    std::make_shared<FusedOperatorFactory>(next_operator_id(), std::move(fusible_chain)));
+        } else {
+            fused_factories.insert(fused_factories.end(), fusible_chain.begin(), fusible_chain.end());
+        }
+        fusible_chain.clear();
+    };
+
+    // factories[0] is the source operator, and factories.back() is the sink operator.
+    fused_factories.emplace_back((*factories)[0]);
+    for (size_t i = 1; i + 1 < factories->size(); ++i) {
+        auto& factory = (*factories)[i];
+        if (is_fusible(factory.get())) {
+            fusible_chain.emplace_back(factory);
+        } else {
+            flush_chain();
+            fused_factories.emplace_back(factory);
+        }
+    }
+    flush_chain();
+    fused_factories.emplace_back(factories->back());
+
+    *factories = std::move(fused_factories);
+}
+
+} // namespace starrocks::pipeline
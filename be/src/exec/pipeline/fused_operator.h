@@ -0,0 +1,78 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <functional>
+#include <queue>
+
+#include "exec/pipeline/operator.h"
+
+namespace starrocks::pipeline {
+
+// FusedOperator executes a chain of adjacent stateless operators, i.e. ProjectOperator, SelectOperator and
+// LimitOperator, in one operator.
+//
+// Each chunk pushed to FusedOperator is passed through the fused operators in a single loop, so that
+// PipelineDriver::process() doesn't need to move the chunk between them one by one, checking the states and
+// updating the counters of each operator for every chunk.
+//
+// The fused operators are still created by their own factories, so that they keep their behaviors. e.g.
+// SelectOperator still merges the small filtered chunks, and its buffered chunk is flushed when finishing.
+class FusedOperator final : public Operator {
+public:
+    FusedOperator(OperatorFactory* factory, int32_t id, int32_t plan_node_id, int32_t driver_sequence,
+                  Operators&& operators);
+
+    ~FusedOperator() override = default;
+
+    Status prepare(RuntimeState* state) override;
+    void close(RuntimeState* state) override;
+
+    // When the limit is reached, the chunks buffered by the fused operators should be flushed by pull_chunk().
+    bool has_output() const override { return !_output_chunks.empty() || (!_is_flushed && _is_limit_reached()); }
+    bool need_input() const override { return !_is_finished && _output_chunks.empty() && !_is_limit_reached(); }
+    bool is_finished() const override { return _is_flushed && _output_chunks.empty(); }
+
+    Status set_finishing(RuntimeState* state) override;
+
+    StatusOr<vectorized::ChunkPtr> pull_chunk(RuntimeState* state) override;
+    Status push_chunk(RuntimeState* state, const vectorized::ChunkPtr& chunk) override;
+
+private:
+    // Pass chunk through the operators starting from _operators[start].
+    Status _transform(RuntimeState* state, size_t start, vectorized::ChunkPtr chunk);
+    // Flush the chunks buffered by the operators, e.g. the small chunks merged by SelectOperator.
+    Status _flush(RuntimeState* state);
+    bool _is_limit_reached() const;
+
+    Operators _operators;
+    // The indexes of LimitOperators in _operators.
+    std::vector<size_t> _limit_indexes;
+    std::queue<vectorized::ChunkPtr> _output_chunks;
+    bool _is_finished = false;
+    bool _is_flushed = false;
+};
+
+class FusedOperatorFactory final : public OperatorFactory {
+public:
+    FusedOperatorFactory(int32_t id, OpFactories&& factories);
+
+    ~FusedOperatorFactory() override = default;
+
+    OperatorPtr create(int32_t degree_of_parallelism, int32_t driver_sequence) override;
+
+    Status prepare(RuntimeState* state) override;
+    void close(RuntimeState* state) override;
+
+    // Whether the operators created by the factory can be fused into FusedOperator.
+    static bool is_fusible(const OperatorFactory* factory);
+
+    // Replace each chain of at least two adjacent fusible operators in factories with a FusedOperatorFactory.
+    // The source and sink operators are never fused.
+    static void fuse_operators(OpFactories* factories, const std::function<int32_t()>& next_operator_id);
+
+private:
+    OpFactories _factories;
+};
+
+} // namespace starrocks::pipeline
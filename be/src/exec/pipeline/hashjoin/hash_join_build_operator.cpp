@@ -52,11 +52,14 @@ StatusOr<vectorized::ChunkPtr> HashJoinBuildOperator::pull_chunk(RuntimeState* s
 
 Status HashJoinBuildOperator::set_finishing(RuntimeState* state) {
     _is_finished = true;
+    // The hash table shared by multiple build operators is built by the last finished one.
+    if (!_join_builder->finish_builder()) {
+        return Status::OK();
+    }
     RETURN_IF_ERROR(_join_builder->build_ht(state));
 
-    size_t merger_index = _driver_sequence;
-    // Broadcast Join only has one build operator.
-    DCHECK(_distribution_mode != TJoinDistributionMode::BROADCAST || _driver_sequence == 0);
+    // Broadcast Join only has one hash table, even if it is built by multiple build operators.
+    size_t merger_index = _distribution_mode == TJoinDistributionMode::BROADCAST ? 0 : _driver_sequence;
 
     RETURN_IF_ERROR(_join_builder->create_runtime_filters(state));
 
@@ -128,9 +131,15 @@ OperatorPtr HashJoinBuildOperatorFactory::create(int32_t degree_of_parallelism,
     if (_string_key_columns.empty()) {
         _string_key_columns.resize(degree_of_parallelism);
     }
-    return std::make_shared<HashJoinBuildOperator>(
-            this, _id, _name, _plan_node_id, driver_sequence, _hash_joiner_factory->create_builder(driver_sequence),
-            _hash_joiner_factory->get_read_only_probers(), _partial_rf_merger.get(), _distribution_mode);
+    auto join_builder = _hash_joiner_factory->create_builder(driver_sequence);
+    if (_distribution_mode == TJoinDistributionMode::BROADCAST) {
+        // All the build operators of broadcast join share the same builder.
+        join_builder->set_num_builders(degree_of_parallelism);
+    }
+    return std::make_shared<HashJoinBuildOperator>(this, _id, _name, _plan_node_id, driver_sequence,
+                                                   std::move(join_builder),
+                                                   _hash_joiner_factory->get_read_only_probers(),
+                                                   _partial_rf_merger.get(), _distribution_mode);
 }
 
 void HashJoinBuildOperatorFactory::retain_string_key_columns(int32_t driver_sequence, vectorized::Columns&& columns) {
@@ -4,6 +4,7 @@
 
 #include <algorithm>
 
+#include "common/config.h"
 #include "exec/exec_node.h"
 #include "gutil/strings/substitute.h"
 #include "runtime/exec_env.h"
@@ -52,6 +53,11 @@ Status Operator::prepare(RuntimeState* state) {
     _push_row_num_counter = ADD_COUNTER(_common_metrics, "PushRowNum", TUnit::UNIT);
     _pull_chunk_num_counter = ADD_COUNTER(_common_metrics, "PullChunkNum", TUnit::UNIT);
     _pull_row_num_counter = ADD_COUNTER(_common_metrics, "PullRowNum", TUnit::UNIT);
+    if (config::pipeline_enable_hardware_counters) {
+        _cpu_cycles_counter = ADD_COUNTER(_common_metrics, "CpuCycles", TUnit::UNIT);
+        _instructions_counter = ADD_COUNTER(_common_metrics, "Instructions", TUnit::UNIT);
+        _llc_misses_counter = ADD_COUNTER(_common_metrics, "LLCMisses", TUnit::UNIT);
+    }
     return Status::OK();
 }
 
@@ -161,6 +167,7 @@ void Operator::_init_rf_counters(bool init_bloom) {
                 ADD_COUNTER(_common_metrics, "JoinRuntimeFilterOutputRows", TUnit::UNIT);
         _bloom_filter_eval_context.join_runtime_filter_eval_counter =
                 ADD_COUNTER(_common_metrics, "JoinRuntimeFilterEvaluate", TUnit::UNIT);
+        _bloom_filter_eval_context.runtime_profile = _common_metrics.get();
     }
 }
 
@@ -111,6 +111,8 @@ public:
         return strings::Substitute("$0_$1_$2($3)", _name, _plan_node_id, this, is_finished() ? "X" : "O");
     }
 
+    const std::string& get_raw_name() const { return _name; }
+
     const LocalRFWaitingSet& rf_waiting_set() const;
 
     RuntimeFilterHub* runtime_filter_hub();
@@ -188,6 +190,10 @@ protected:
     RuntimeProfile::Counter* _push_row_num_counter = nullptr;
     RuntimeProfile::Counter* _pull_chunk_num_counter = nullptr;
     RuntimeProfile::Counter* _pull_row_num_counter = nullptr;
+    // the hardware counters of push_chunk and pull_chunk, only set if pipeline_enable_hardware_counters
+    RuntimeProfile::Counter* _cpu_cycles_counter = nullptr;
+    RuntimeProfile::Counter* _instructions_counter = nullptr;
+    RuntimeProfile::Counter* _llc_misses_counter = nullptr;
     RuntimeProfile::Counter* _runtime_in_filter_num_counter = nullptr;
     RuntimeProfile::Counter* _runtime_bloom_filter_num_counter = nullptr;
     RuntimeProfile::Counter* _conjuncts_timer = nullptr;
@@ -7,13 +7,16 @@
 
 #include "column/chunk.h"
 #include "common/statusor.h"
+#include "exec/pipeline/driver_time_budget.h"
 #include "exec/pipeline/pipeline_driver_executor.h"
 #include "exec/pipeline/scan/olap_scan_operator.h"
 #include "exec/pipeline/source_operator.h"
 #include "exec/workgroup/work_group.h"
+#include "runtime/current_thread.h"
 #include "runtime/exec_env.h"
 #include "runtime/runtime_state.h"
 #include "util/defer_op.h"
+#include "util/perf_counters.h"
 
 namespace starrocks::pipeline {
 
@@ -34,6 +37,7 @@ Status PipelineDriver::prepare(RuntimeState* runtime_state) {
     _schedule_timer = ADD_TIMER(_runtime_profile, "ScheduleTime");
     _schedule_counter = ADD_COUNTER(_runtime_profile, "ScheduleCount", TUnit::UNIT);
     _yield_by_time_limit_counter = ADD_COUNTER(_runtime_profile, "YieldByTimeLimit", TUnit::UNIT);
+    _yield_by_preempt_counter = ADD_COUNTER(_runtime_profile, "YieldByPreempt", TUnit::UNIT);
     _block_by_precondition_counter = ADD_COUNTER(_runtime_profile, "BlockByPrecondition", TUnit::UNIT);
     _block_by_output_full_counter = ADD_COUNTER(_runtime_profile, "BlockByOutputFull", TUnit::UNIT);
     _block_by_input_empty_counter = ADD_COUNTER(_runtime_profile, "BlockByInputEmpty", TUnit::UNIT);
@@ -45,6 +49,13 @@ Status PipelineDriver::prepare(RuntimeState* runtime_state) {
     _followup_input_empty_timer = ADD_CHILD_TIMER(_runtime_profile, "FollowupInputEmptyTime", "InputEmptyTime");
     _output_full_timer = ADD_CHILD_TIMER(_runtime_profile, "OutputFullTime", "PendingTime");
 
+    if (_query_ctx != nullptr && _query_ctx->query_trace() != nullptr) {
+        _query_trace = _query_ctx->query_trace().get();
+        _trace_pid = _query_trace->process_id(_fragment_ctx->fragment_instance_id());
+        _query_trace->set_thread_name(_trace_pid, _driver_id, _runtime_profile->name());
+        _trace_state_start_ns = MonotonicNanos();
+    }
+
     DCHECK(_state == DriverState::NOT_READY);
 
     source_operator()->add_morsel_queue(_morsel_queue);
@@ -110,7 +121,13 @@ StatusOr<DriverState> PipelineDriver::process(RuntimeState* runtime_state, int w
     size_t total_rows_moved = 0;
     int64_t time_spent = 0;
     Status return_status = Status::OK();
+    // The driver running in the worker thread owned by other workgroup gets the shorter budget, so that the heavy
+    // operators checking the budget give back the core to the owner workgroup in time.
+    const bool may_preempt = _workgroup != nullptr &&
+                             workgroup::WorkGroupManager::instance()->should_yield_driver_worker(worker_id, _workgroup);
+    DriverTimeBudget::start(may_preempt ? YIELD_PREEMPT_MAX_TIME_SPENT : YIELD_MAX_TIME_SPENT);
     DeferOp defer([&]() {
+        DriverTimeBudget::stop();
         if (return_status.ok()) {
             _update_statistics(total_chunks_moved, total_rows_moved, time_spent);
         }
@@ -153,6 +170,10 @@ StatusOr<DriverState> PipelineDriver::process(RuntimeState* runtime_state, int w
                 StatusOr<vectorized::ChunkPtr> maybe_chunk;
                 {
                     SCOPED_TIMER(curr_op->_pull_timer);
+                    ScopedPerfCounters perf_counters(curr_op->_cpu_cycles_counter, curr_op->_instructions_counter,
+                                                     curr_op->_llc_misses_counter);
+                    CurrentThreadOperatorSetter operator_setter(curr_op->get_plan_node_id(),
+                                                                curr_op->get_raw_name().c_str());
                     maybe_chunk = curr_op->pull_chunk(runtime_state);
                 }
                 return_status = maybe_chunk.status();
@@ -172,6 +193,11 @@ StatusOr<DriverState> PipelineDriver::process(RuntimeState* runtime_state, int w
                         total_rows_moved += row_num;
                         {
                             SCOPED_TIMER(next_op->_push_timer);
+                            ScopedPerfCounters perf_counters(next_op->_cpu_cycles_counter,
+                                                             next_op->_instructions_counter,
+                                                             next_op->_llc_misses_counter);
+                            CurrentThreadOperatorSetter operator_setter(next_op->get_plan_node_id(),
+                                                                        next_op->get_raw_name().c_str());
                             return_status = next_op->push_chunk(runtime_state, maybe_chunk.value());
                         }
 
@@ -212,6 +238,8 @@ StatusOr<DriverState> PipelineDriver::process(RuntimeState* runtime_state, int w
                 workgroup::WorkGroupManager::instance()->should_yield_driver_worker(worker_id, _workgroup)) {
                 should_yield = true;
                 COUNTER_UPDATE(_yield_by_time_limit_counter, time_spent >= YIELD_MAX_TIME_SPENT);
+                COUNTER_UPDATE(_yield_by_preempt_counter, 1);
+                _workgroup->incr_num_preemptions();
                 break;
             }
         }
@@ -352,6 +380,12 @@ void PipelineDriver::finalize(RuntimeState* runtime_state, DriverState state) {
     }
 }
 
+void PipelineDriver::_trace_state() {
+    int64_t now = MonotonicNanos();
+    _query_trace->add_span(ds_to_string(_state), "driver", _trace_pid, _driver_id, _trace_state_start_ns, now);
+    _trace_state_start_ns = now;
+}
+
 void PipelineDriver::_update_overhead_timer() {
     int64_t overhead_time = _active_timer->value();
     RuntimeProfile* profile = _runtime_profile.get();
@@ -481,6 +515,9 @@ void PipelineDriver::_update_statistics(size_t total_chunks_moved, size_t total_
     driver_acct().update_last_chunks_moved(total_chunks_moved);
     driver_acct().update_accumulated_rows_moved(total_rows_moved);
     driver_acct().update_last_time_spent(time_spent);
+    if (_workgroup != nullptr) {
+        _workgroup->record_time_slice_ns(time_spent);
+    }
 
     // Update statistics of scan operator
     if (ScanOperator* scan = source_scan_operator()) {
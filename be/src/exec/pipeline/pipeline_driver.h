@@ -212,6 +212,9 @@ public:
             break;
         }
 
+        if (_query_trace != nullptr) {
+            _trace_state();
+        }
         _state = state;
     }
 
@@ -349,6 +352,14 @@ public:
     inline bool is_in_ready_queue() const { return _in_ready_queue.load(std::memory_order_acquire); }
     void set_in_ready_queue(bool v) { _in_ready_queue.store(v, std::memory_order_release); }
 
+    // The time when this driver is put into the ready queue of DriverQueueWithWorkGroup.
+    int64_t ready_queue_enter_ns() const { return _ready_queue_enter_ns; }
+    void set_ready_queue_enter_ns(int64_t enter_ns) { _ready_queue_enter_ns = enter_ns; }
+
+    // The index of the local queue of WorkStealingDriverQueue which this driver is put into.
+    size_t get_local_driver_queue_idx() const { return _local_driver_queue_idx.load(std::memory_order_acquire); }
+    void set_local_driver_queue_idx(size_t idx) { _local_driver_queue_idx.store(idx, std::memory_order_release); }
+
 private:
     // Yield PipelineDriver when maximum time in nano-seconds has spent in current execution round.
     static constexpr int64_t YIELD_MAX_TIME_SPENT = 100'000'000L;
@@ -367,6 +378,8 @@ private:
     // Update metrics when the driver yields.
     void _update_statistics(size_t total_chunks_moved, size_t total_rows_moved, size_t time_spent);
     void _update_overhead_timer();
+    // Record the span of the current state, which is ended by the state transition.
+    void _trace_state();
 
     RuntimeState* _runtime_state = nullptr;
     Operators _operators;
@@ -400,6 +413,13 @@ private:
     // The index of QuerySharedDriverQueue{WithoutLock}._queues which this driver belongs to.
     size_t _driver_queue_level = 0;
     std::atomic<bool> _in_ready_queue{false};
+    std::atomic<size_t> _local_driver_queue_idx{0};
+    int64_t _ready_queue_enter_ns = 0;
+
+    // The trace of the query, the spans of the driver states are recorded if it's not nullptr.
+    QueryTrace* _query_trace = nullptr;
+    int64_t _trace_pid = 0;
+    int64_t _trace_state_start_ns = 0;
 
     // metrics
     RuntimeProfile::Counter* _total_timer = nullptr;
@@ -410,6 +430,7 @@ private:
     // Schedule counters
     RuntimeProfile::Counter* _schedule_counter = nullptr;
     RuntimeProfile::Counter* _yield_by_time_limit_counter = nullptr;
+    RuntimeProfile::Counter* _yield_by_preempt_counter = nullptr;
     RuntimeProfile::Counter* _block_by_precondition_counter = nullptr;
     RuntimeProfile::Counter* _block_by_output_full_counter = nullptr;
     RuntimeProfile::Counter* _block_by_input_empty_counter = nullptr;
@@ -3,10 +3,14 @@
 #include "exec/pipeline/pipeline_driver_executor.h"
 
 #include <memory>
+#include <thread>
 
+#include "common/config.h"
+#include "exec/pipeline/poller_notifier.h"
 #include "exec/workgroup/work_group.h"
 #include "gutil/strings/substitute.h"
 #include "runtime/current_thread.h"
+#include "util/cpu_info.h"
 #include "util/defer_op.h"
 
 namespace starrocks::pipeline {
@@ -15,9 +19,7 @@ GlobalDriverExecutor::GlobalDriverExecutor(std::string name, std::unique_ptr<Thr
                                            bool enable_resource_group)
         : Base(name),
           _enable_resource_group(enable_resource_group),
-          _driver_queue(enable_resource_group
-                                ? std::unique_ptr<DriverQueue>(std::make_unique<DriverQueueWithWorkGroup>())
-                                : std::make_unique<QuerySharedDriverQueue>()),
+          _driver_queue(_create_driver_queue(enable_resource_group)),
           _thread_pool(std::move(thread_pool)),
           _blocked_driver_poller(new PipelineDriverPoller(_driver_queue.get())),
           _exec_state_reporter(new ExecStateReporter()) {}
@@ -34,6 +36,20 @@ GlobalDriverExecutor::~GlobalDriverExecutor() {
     _driver_queue->close();
 }
 
+DriverQueuePtr GlobalDriverExecutor::_create_driver_queue(bool enable_resource_group) {
+    if (enable_resource_group) {
+        return std::make_unique<DriverQueueWithWorkGroup>();
+    }
+    if (config::pipeline_enable_work_stealing_driver_queue) {
+        size_t num_local_queues = config::pipeline_exec_thread_pool_thread_num > 0
+                                          ? config::pipeline_exec_thread_pool_thread_num
+                                          : std::thread::hardware_concurrency();
+        size_t num_numa_nodes = config::enable_numa_aware_execution ? CpuInfo::get_max_num_numa_nodes() : 1;
+        return std::make_unique<WorkStealingDriverQueue>(num_local_queues, num_numa_nodes);
+    }
+    return std::make_unique<QuerySharedDriverQueue>();
+}
+
 void GlobalDriverExecutor::initialize(int num_threads) {
     {
         // regist pipeline metrics
@@ -74,6 +90,9 @@ void GlobalDriverExecutor::_finalize_driver(DriverRawPtr driver, RuntimeState* r
 
 void GlobalDriverExecutor::_worker_thread() {
     const int worker_id = _next_id++;
+    if (config::enable_numa_aware_execution && CpuInfo::get_max_num_numa_nodes() > 1) {
+        CpuInfo::bind_current_thread_to_numa_node(worker_id % CpuInfo::get_max_num_numa_nodes());
+    }
     while (true) {
         if (_num_threads_setter.should_shrink()) {
             break;
@@ -86,81 +105,89 @@ void GlobalDriverExecutor::_worker_thread() {
         auto driver = maybe_driver.value();
         DCHECK(driver != nullptr);
 
-        auto* query_ctx = driver->query_ctx();
-        auto* fragment_ctx = driver->fragment_ctx();
-        tls_thread_status.set_query_id(query_ctx->query_id());
-        tls_thread_status.set_fragment_instance_id(fragment_ctx->fragment_instance_id());
-        tls_thread_status.set_pipeline_driver_id(driver->driver_id());
-
-        // TODO(trueeyu): This writing is to ensure that MemTracker will not be destructed before the thread ends.
-        //  This writing method is a bit tricky, and when there is a better way, replace it
-        auto runtime_state_ptr = fragment_ctx->runtime_state_ptr();
-        auto* runtime_state = runtime_state_ptr.get();
-        {
-            SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(runtime_state->instance_mem_tracker());
-
-            if (fragment_ctx->is_canceled()) {
-                driver->cancel_operators(runtime_state);
-                if (driver->is_still_pending_finish()) {
-                    driver->set_driver_state(DriverState::PENDING_FINISH);
-                    _blocked_driver_poller->add_blocked_driver(driver);
-                } else {
-                    _finalize_driver(driver, runtime_state, DriverState::CANCELED);
-                }
-                continue;
-            }
-            // a blocked driver is canceled because of fragment cancellation or query expiration.
-            if (driver->is_finished()) {
-                _finalize_driver(driver, runtime_state, driver->driver_state());
-                continue;
-            }
+        _process_driver(driver, worker_id);
+    }
+}
 
-            auto maybe_state = driver->process(runtime_state, worker_id);
-            Status status = maybe_state.status();
-            this->_driver_queue->update_statistics(driver);
+void GlobalDriverExecutor::_process_driver(DriverRawPtr driver, int worker_id) {
+    auto* query_ctx = driver->query_ctx();
+    auto* fragment_ctx = driver->fragment_ctx();
+    tls_thread_status.set_query_id(query_ctx->query_id());
+    tls_thread_status.set_fragment_instance_id(fragment_ctx->fragment_instance_id());
+    tls_thread_status.set_pipeline_driver_id(driver->driver_id());
+    tls_thread_status.set_workgroup_id(driver->workgroup() != nullptr ? driver->workgroup()->id() : -1);
+
+    // TODO(trueeyu): This writing is to ensure that MemTracker will not be destructed before the thread ends.
+    //  This writing method is a bit tricky, and when there is a better way, replace it
+    auto runtime_state_ptr = fragment_ctx->runtime_state_ptr();
+    auto* runtime_state = runtime_state_ptr.get();
+    {
+        SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(runtime_state->instance_mem_tracker());
 
-            // Check big query
-            if (status.ok() && driver->workgroup()) {
-                status = driver->workgroup()->check_big_query(*query_ctx);
+        if (fragment_ctx->is_canceled()) {
+            driver->cancel_operators(runtime_state);
+            if (driver->is_still_pending_finish()) {
+                driver->set_driver_state(DriverState::PENDING_FINISH);
+                _blocked_driver_poller->add_blocked_driver(driver);
+            } else {
+                _finalize_driver(driver, runtime_state, DriverState::CANCELED);
             }
+            return;
+        }
+        // a blocked driver is canceled because of fragment cancellation or query expiration.
+        if (driver->is_finished()) {
+            _finalize_driver(driver, runtime_state, driver->driver_state());
+            return;
+        }
 
-            if (!status.ok()) {
-                LOG(WARNING) << "[Driver] Process error, query_id=" << print_id(driver->query_ctx()->query_id())
-                             << ", instance_id=" << print_id(driver->fragment_ctx()->fragment_instance_id())
-                             << ", status=" << status;
-                query_ctx->cancel(status);
-                driver->cancel_operators(runtime_state);
-                if (driver->is_still_pending_finish()) {
-                    driver->set_driver_state(DriverState::PENDING_FINISH);
-                    _blocked_driver_poller->add_blocked_driver(driver);
-                } else {
-                    _finalize_driver(driver, runtime_state, DriverState::INTERNAL_ERROR);
-                }
-                continue;
-            }
-            auto driver_state = maybe_state.value();
-            switch (driver_state) {
-            case READY:
-            case RUNNING: {
-                this->_driver_queue->put_back_from_executor(driver);
-                break;
-            }
-            case FINISH:
-            case CANCELED:
-            case INTERNAL_ERROR: {
-                _finalize_driver(driver, runtime_state, driver_state);
-                break;
-            }
-            case INPUT_EMPTY:
-            case OUTPUT_FULL:
-            case PENDING_FINISH:
-            case PRECONDITION_BLOCK: {
+        auto maybe_state = driver->process(runtime_state, worker_id);
+        Status status = maybe_state.status();
+        this->_driver_queue->update_statistics(driver);
+
+        // Check big query
+        if (status.ok() && driver->workgroup()) {
+            status = driver->workgroup()->check_big_query(*query_ctx);
+        }
+
+        if (!status.ok()) {
+            LOG(WARNING) << "[Driver] Process error, query_id=" << print_id(driver->query_ctx()->query_id())
+                         << ", instance_id=" << print_id(driver->fragment_ctx()->fragment_instance_id())
+                         << ", status=" << status;
+            query_ctx->cancel(status);
+            driver->cancel_operators(runtime_state);
+            if (driver->is_still_pending_finish()) {
+                driver->set_driver_state(DriverState::PENDING_FINISH);
                 _blocked_driver_poller->add_blocked_driver(driver);
-                break;
-            }
-            default:
-                DCHECK(false);
+            } else {
+                _finalize_driver(driver, runtime_state, DriverState::INTERNAL_ERROR);
             }
+            return;
+        }
+        auto driver_state = maybe_state.value();
+        // The progress of this driver, such as pushing chunks to the local exchanger or finishing the
+        // hash join build, may make the blocked drivers ready.
+        PollerNotifier::instance()->notify();
+        switch (driver_state) {
+        case READY:
+        case RUNNING: {
+            this->_driver_queue->put_back_from_executor(driver);
+            break;
+        }
+        case FINISH:
+        case CANCELED:
+        case INTERNAL_ERROR: {
+            _finalize_driver(driver, runtime_state, driver_state);
+            break;
+        }
+        case INPUT_EMPTY:
+        case OUTPUT_FULL:
+        case PENDING_FINISH:
+        case PRECONDITION_BLOCK: {
+            _blocked_driver_poller->add_blocked_driver(driver);
+            break;
+        }
+        default:
+            DCHECK(false);
         }
     }
 }
@@ -183,6 +210,22 @@ void GlobalDriverExecutor::submit(DriverRawPtr driver) {
     }
 }
 
+void GlobalDriverExecutor::submit_inline(DriverRawPtr driver) {
+    DCHECK(driver->workgroup() == nullptr);
+    if (driver->is_precondition_block() ||
+        (!driver->source_operator()->is_finished() && !driver->source_operator()->has_output())) {
+        submit(driver);
+        return;
+    }
+
+    // The driver is ready, so run the first round of it on the calling thread instead of waking up a worker.
+    // If it doesn't finish in this round, it is put back to the ready queue or the poller as usual.
+    driver->submit_operators();
+    _process_driver(driver, INLINE_WORKER_ID);
+    tls_thread_status.set_query_id(TUniqueId());
+    tls_thread_status.set_fragment_instance_id(TUniqueId());
+}
+
 void GlobalDriverExecutor::cancel(DriverRawPtr driver) {
     // if driver is already in ready queue, we should cancel it
     // otherwise, just ignore it and wait for the poller to schedule
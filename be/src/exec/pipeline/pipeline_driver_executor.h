@@ -29,6 +29,9 @@ public:
     virtual void initialize(int32_t num_threads) {}
     virtual void change_num_threads(int32_t num_threads) {}
     virtual void submit(DriverRawPtr driver) = 0;
+    // Submit the driver, and try to run it on the calling thread if it is ready.
+    // It is used by the short queries whose setup cost dominates the execution.
+    virtual void submit_inline(DriverRawPtr driver) { submit(driver); }
     virtual void cancel(DriverRawPtr driver) = 0;
 
     // When all the root drivers (the drivers have no successors in the same fragment) have finished,
@@ -49,12 +52,17 @@ public:
     void initialize(int32_t num_threads) override;
     void change_num_threads(int32_t num_threads) override;
     void submit(DriverRawPtr driver) override;
+    void submit_inline(DriverRawPtr driver) override;
     void cancel(DriverRawPtr driver) override;
     void report_exec_state(FragmentContext* fragment_ctx, const Status& status, bool done) override;
 
 private:
     using Base = FactoryMethod<DriverExecutor, GlobalDriverExecutor>;
+    // The worker id of the drivers run by submit_inline() on the calling thread.
+    static constexpr int INLINE_WORKER_ID = -1;
+    static DriverQueuePtr _create_driver_queue(bool enable_resource_group);
     void _worker_thread();
+    void _process_driver(DriverRawPtr driver, int worker_id);
     void _finalize_driver(DriverRawPtr driver, RuntimeState* runtime_state, DriverState state);
     void _update_profile_by_level(FragmentContext* fragment_ctx, bool done);
     void _remove_non_core_metrics(FragmentContext* fragment_ctx, std::vector<RuntimeProfile*>& driver_profiles);
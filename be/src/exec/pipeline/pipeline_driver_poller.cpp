@@ -3,6 +3,10 @@
 #include "pipeline_driver_poller.h"
 
 #include <chrono>
+
+#include "common/config.h"
+#include "exec/pipeline/poller_notifier.h"
+
 namespace starrocks::pipeline {
 
 void PipelineDriverPoller::start() {
@@ -21,6 +25,7 @@ void PipelineDriverPoller::shutdown() {
     if (this->_is_shutdown.load() == false && _polling_thread.get() != nullptr) {
         this->_is_shutdown.store(true, std::memory_order_release);
         _cond.notify_one();
+        PollerNotifier::instance()->notify();
         _polling_thread->join();
     }
 }
@@ -30,7 +35,11 @@ void PipelineDriverPoller::run_internal() {
     DriverList local_blocked_drivers;
     int spin_count = 0;
     std::vector<DriverRawPtr> ready_drivers;
+    auto* notifier = PollerNotifier::instance();
     while (!_is_shutdown.load(std::memory_order_acquire)) {
+        // Record the epoch before checking the blocked drivers, so that the event happened during checking
+        // is not missed when waiting for the next event.
+        uint64_t epoch = notifier->epoch();
         {
             std::unique_lock<std::mutex> lock(this->_mutex);
             local_blocked_drivers.splice(local_blocked_drivers.end(), _blocked_drivers);
@@ -113,6 +122,11 @@ void PipelineDriverPoller::run_internal() {
         }
 
         if (ready_drivers.empty()) {
+            int64_t max_wait_us = config::pipeline_poller_max_wait_us;
+            if (max_wait_us > 0) {
+                notifier->wait_for(epoch, max_wait_us);
+                continue;
+            }
             spin_count += 1;
         } else {
             spin_count = 0;
@@ -141,6 +155,8 @@ void PipelineDriverPoller::add_blocked_driver(const DriverRawPtr driver) {
     this->_blocked_drivers.push_back(driver);
     driver->_pending_timer_sw->reset();
     this->_cond.notify_one();
+    // The poller may be waiting for events with the non-empty blocked drivers.
+    PollerNotifier::instance()->notify();
 }
 
 void PipelineDriverPoller::remove_blocked_driver(DriverList& local_blocked_drivers, DriverList::iterator& driver_it) {
@@ -5,6 +5,7 @@
 #include "exec/pipeline/source_operator.h"
 #include "exec/workgroup/work_group.h"
 #include "gutil/strings/substitute.h"
+#include "util/time.h"
 
 namespace starrocks::pipeline {
 
@@ -280,6 +281,162 @@ DriverRawPtr SubQuerySharedDriverQueue::take() {
     return nullptr;
 }
 
+// The index of the local queue owned by the current executor thread, -1 means the current thread isn't an executor.
+static thread_local int tls_local_queue_idx = -1;
+
+WorkStealingDriverQueue::WorkStealingDriverQueue(size_t num_local_queues, size_t num_numa_nodes)
+        : _num_numa_nodes(std::max<size_t>(1, num_numa_nodes)) {
+    // Round up to a multiple of _num_numa_nodes, so that each NUMA node has the same number of local queues,
+    // and (worker_id % num_local_queues) is on the same NUMA node as (worker_id % _num_numa_nodes).
+    num_local_queues = std::max<size_t>(1, num_local_queues);
+    num_local_queues = (num_local_queues + _num_numa_nodes - 1) / _num_numa_nodes * _num_numa_nodes;
+    _local_queues.reserve(num_local_queues);
+    for (size_t i = 0; i < num_local_queues; ++i) {
+        _local_queues.emplace_back(std::make_unique<LocalQueue>());
+    }
+}
+
+void WorkStealingDriverQueue::close() {
+    std::lock_guard<std::mutex> lock(_wait_mutex);
+    _is_closed = true;
+    _cv.notify_all();
+}
+
+void WorkStealingDriverQueue::put_back(const DriverRawPtr driver) {
+    _put_back_to(_next_local_queue_idx(driver), driver);
+}
+
+void WorkStealingDriverQueue::put_back(const std::vector<DriverRawPtr>& drivers) {
+    for (const auto driver : drivers) {
+        _put_back_to(_next_local_queue_idx(driver), driver);
+    }
+}
+
+void WorkStealingDriverQueue::put_back_from_executor(const DriverRawPtr driver) {
+    if (tls_local_queue_idx < 0) {
+        put_back(driver);
+        return;
+    }
+    _put_back_to(tls_local_queue_idx, driver);
+}
+
+void WorkStealingDriverQueue::put_back_from_executor(const std::vector<DriverRawPtr>& drivers) {
+    for (const auto driver : drivers) {
+        put_back_from_executor(driver);
+    }
+}
+
+StatusOr<DriverRawPtr> WorkStealingDriverQueue::take(int worker_id) {
+    const size_t num_local_queues = _local_queues.size();
+    const size_t local_queue_idx = static_cast<size_t>(worker_id) % num_local_queues;
+    tls_local_queue_idx = local_queue_idx;
+
+    while (true) {
+        if (_is_closed.load(std::memory_order_acquire)) {
+            return Status::Cancelled("Shutdown");
+        }
+
+        // Take from the own local queue first, then steal from the local queues of the same NUMA node,
+        // and finally steal from the other NUMA nodes.
+        // Because num_local_queues is a multiple of _num_numa_nodes, (local_queue_idx + i) is on the same
+        // NUMA node as local_queue_idx iff i is a multiple of _num_numa_nodes.
+        for (size_t node_offset = 0; node_offset < _num_numa_nodes; ++node_offset) {
+            for (size_t i = node_offset; i < num_local_queues; i += _num_numa_nodes) {
+                auto* driver = _try_take_from((local_queue_idx + i) % num_local_queues);
+                if (driver != nullptr) {
+                    // Record the local queue of the thread which runs this driver.
+                    driver->set_local_driver_queue_idx(local_queue_idx);
+                    return driver;
+                }
+            }
+        }
+
+        // Increase _num_waiters before checking _num_drivers, and _put_back_to() increases _num_drivers
+        // before checking _num_waiters, so the notification cannot be lost.
+        std::unique_lock<std::mutex> lock(_wait_mutex);
+        ++_num_waiters;
+        _cv.wait(lock, [this] { return _is_closed.load() || _num_drivers.load() > 0; });
+        --_num_waiters;
+    }
+}
+
+void WorkStealingDriverQueue::cancel(DriverRawPtr driver) {
+    if (_is_closed.load(std::memory_order_acquire)) {
+        return;
+    }
+
+    while (true) {
+        size_t local_queue_idx = driver->get_local_driver_queue_idx();
+        auto& local_queue = _local_queues[local_queue_idx];
+        std::lock_guard<std::mutex> lock(local_queue->mutex);
+
+        // The driver is put to the local queue by first setting the index and then setting in_ready_queue,
+        // so in_ready_queue must be checked before the index.
+        if (!driver->is_in_ready_queue()) {
+            return;
+        }
+        if (driver->get_local_driver_queue_idx() != local_queue_idx) {
+            // The driver has moved to another local queue, retry.
+            continue;
+        }
+        local_queue->queue.cancel(driver);
+        return;
+    }
+}
+
+void WorkStealingDriverQueue::update_statistics(const DriverRawPtr driver) {
+    auto& local_queue = _local_queues[driver->get_local_driver_queue_idx()];
+    std::lock_guard<std::mutex> lock(local_queue->mutex);
+    local_queue->queue.update_statistics(driver);
+}
+
+void WorkStealingDriverQueue::_put_back_to(size_t local_queue_idx, const DriverRawPtr driver) {
+    auto& local_queue = _local_queues[local_queue_idx];
+    {
+        std::lock_guard<std::mutex> lock(local_queue->mutex);
+        driver->set_local_driver_queue_idx(local_queue_idx);
+        local_queue->queue.put_back(driver);
+        driver->set_in_ready_queue(true);
+        ++local_queue->num_drivers;
+    }
+
+    ++_num_drivers;
+    if (_num_waiters.load() > 0) {
+        std::lock_guard<std::mutex> lock(_wait_mutex);
+        _cv.notify_one();
+    }
+}
+
+size_t WorkStealingDriverQueue::_next_local_queue_idx(const DriverRawPtr driver) {
+    size_t next_idx = _next_put_idx.fetch_add(1, std::memory_order_relaxed);
+    if (_num_numa_nodes == 1 || driver->driver_acct().get_schedule_times() == 0) {
+        return next_idx % _local_queues.size();
+    }
+
+    // Prefer the NUMA node which ran this driver the last time, whose memory the driver's data is likely on.
+    size_t last_numa_node = driver->get_local_driver_queue_idx() % _num_numa_nodes;
+    size_t num_queues_per_node = _local_queues.size() / _num_numa_nodes;
+    return (next_idx % num_queues_per_node) * _num_numa_nodes + last_numa_node;
+}
+
+DriverRawPtr WorkStealingDriverQueue::_try_take_from(size_t local_queue_idx) {
+    auto& local_queue = _local_queues[local_queue_idx];
+    // Avoid locking the empty local queue.
+    if (local_queue->num_drivers.load(std::memory_order_acquire) == 0) {
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(local_queue->mutex);
+    if (local_queue->queue.size() == 0) {
+        return nullptr;
+    }
+    auto maybe_driver = local_queue->queue.take(local_queue_idx);
+    DCHECK(maybe_driver.ok());
+    --local_queue->num_drivers;
+    --_num_drivers;
+    return maybe_driver.value();
+}
+
 void DriverQueueWithWorkGroup::close() {
     std::lock_guard<std::mutex> lock(_global_mutex);
     _is_closed = true;
@@ -340,7 +497,11 @@ StatusOr<DriverRawPtr> DriverQueueWithWorkGroup::take(int worker_id) {
         _ready_wgs.erase(wg);
     }
 
-    return wg->driver_queue()->take(worker_id);
+    auto maybe_driver = wg->driver_queue()->take(worker_id);
+    if (maybe_driver.ok()) {
+        wg->record_schedule_latency_ns(MonotonicNanos() - maybe_driver.value()->ready_queue_enter_ns());
+    }
+    return maybe_driver;
 }
 
 void DriverQueueWithWorkGroup::cancel(DriverRawPtr driver) {
@@ -390,6 +551,7 @@ size_t DriverQueueWithWorkGroup::size() const {
 
 template <bool from_executor>
 void DriverQueueWithWorkGroup::_put_back(const DriverRawPtr driver) {
+    driver->set_ready_queue_enter_ns(MonotonicNanos());
     auto* wg = driver->workgroup();
     if (_ready_wgs.find(wg) == _ready_wgs.end()) {
         _sum_cpu_limit += wg->cpu_limit();
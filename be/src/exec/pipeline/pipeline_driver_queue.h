@@ -168,6 +168,70 @@ private:
     size_t _size = 0;
 };
 
+// WorkStealingDriverQueue splits the ready drivers into several local queues, one per executor thread,
+// to avoid the contention on the single global lock of QuerySharedDriverQueue.
+// - The driver put back by an executor thread goes to the local queue of this thread,
+//   and the driver put back by the poller or a new driver is dispatched to the local queues in round-robin.
+// - An executor thread takes driver from its own local queue first. If the local queue is empty,
+//   it steals driver from the other local queues, and waits only when there are no ready drivers at all.
+// Each local queue is a QuerySharedDriverQueueWithoutLock guarded by its own mutex, so the multi-level
+// feedback semantics of QuerySharedDriverQueue are kept inside each local queue.
+//
+// When num_numa_nodes > 1, the i-th local queue belongs to the (i % num_numa_nodes)-th NUMA node.
+// A thread steals drivers from the local queues of the same NUMA node first, and a driver put back
+// by the poller is dispatched to the NUMA node of the thread which ran it the last time.
+class WorkStealingDriverQueue : public FactoryMethod<DriverQueue, WorkStealingDriverQueue> {
+    friend class FactoryMethod<DriverQueue, WorkStealingDriverQueue>;
+
+public:
+    explicit WorkStealingDriverQueue(size_t num_local_queues, size_t num_numa_nodes = 1);
+    ~WorkStealingDriverQueue() override = default;
+    void close() override;
+
+    void put_back(const DriverRawPtr driver) override;
+    void put_back(const std::vector<DriverRawPtr>& drivers) override;
+    // Put the driver back to the local queue of the current executor thread.
+    void put_back_from_executor(const DriverRawPtr driver) override;
+    void put_back_from_executor(const std::vector<DriverRawPtr>& drivers) override;
+
+    // Return cancelled status, if the queue is closed.
+    StatusOr<DriverRawPtr> take(int worker_id) override;
+
+    void cancel(DriverRawPtr driver) override;
+
+    void update_statistics(const DriverRawPtr driver) override;
+
+    size_t size() const override { return _num_drivers.load(std::memory_order_acquire); }
+
+    size_t num_local_queues() const { return _local_queues.size(); }
+    size_t num_numa_nodes() const { return _num_numa_nodes; }
+
+private:
+    struct LocalQueue {
+        std::mutex mutex;
+        QuerySharedDriverQueueWithoutLock queue;
+        std::atomic<size_t> num_drivers = 0;
+    };
+
+    void _put_back_to(size_t local_queue_idx, const DriverRawPtr driver);
+    // Return nullptr, if the local queue is empty.
+    DriverRawPtr _try_take_from(size_t local_queue_idx);
+    // Choose the local queue for the driver put back by the non-executor thread.
+    size_t _next_local_queue_idx(const DriverRawPtr driver);
+
+    std::vector<std::unique_ptr<LocalQueue>> _local_queues;
+    size_t _num_numa_nodes = 1;
+    std::atomic<size_t> _next_put_idx = 0;
+    // The number of ready drivers in all the local queues.
+    std::atomic<size_t> _num_drivers = 0;
+
+    // _wait_mutex and _cv are only used to park the idle executor threads.
+    std::mutex _wait_mutex;
+    std::condition_variable _cv;
+    std::atomic<int> _num_waiters = 0;
+    std::atomic<bool> _is_closed = false;
+};
+
 // DriverQueueWithWorkGroup contains two levels of queues.
 // The first level is the work group queue, and the second level is the driver queue in a work group.
 class DriverQueueWithWorkGroup : public FactoryMethod<DriverQueue, DriverQueueWithWorkGroup> {
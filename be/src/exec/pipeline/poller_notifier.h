@@ -0,0 +1,56 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+
+namespace starrocks::pipeline {
+
+// PollerNotifier wakes up the idle PipelineDriverPoller, when an event which may make the blocked drivers ready
+// happens, e.g. DataStreamRecvr receives chunks, SinkBuffer frees capacity, a runtime filter is delivered,
+// or a scan io task finishes.
+//
+// Each event increases the epoch. The poller records the epoch before checking the blocked drivers,
+// and waits until the epoch changes if none of the blocked drivers is ready, instead of spinning.
+// notify() is cheap when there is no waiting poller, so it can be called in the hot path.
+class PollerNotifier {
+public:
+    static PollerNotifier* instance() {
+        static PollerNotifier notifier;
+        return &notifier;
+    }
+
+    void notify() {
+        _epoch.fetch_add(1);
+        // _epoch is increased before checking _num_waiters, and wait_for() increases _num_waiters before checking
+        // _epoch, so the notification cannot be lost.
+        if (_num_waiters.load() > 0) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _cv.notify_all();
+        }
+    }
+
+    uint64_t epoch() const { return _epoch.load(); }
+
+    // Wait until the epoch is not equal to the given epoch, or the timeout expires.
+    void wait_for(uint64_t epoch, int64_t timeout_us) {
+        std::unique_lock<std::mutex> lock(_mutex);
+        ++_num_waiters;
+        _cv.wait_for(lock, std::chrono::microseconds(timeout_us), [this, epoch] { return _epoch.load() != epoch; });
+        --_num_waiters;
+    }
+
+private:
+    PollerNotifier() = default;
+
+    std::atomic<uint64_t> _epoch = 0;
+    std::atomic<int> _num_waiters = 0;
+    std::mutex _mutex;
+    std::condition_variable _cv;
+};
+
+} // namespace starrocks::pipeline
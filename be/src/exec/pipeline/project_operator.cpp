@@ -34,6 +34,11 @@ Status ProjectOperator::push_chunk(RuntimeState* state, const vectorized::ChunkP
     vectorized::Columns result_columns(_column_ids.size());
     {
         for (size_t i = 0; i < _column_ids.size(); ++i) {
+            if (_same_expr_idxs[i] >= 0) {
+                // copy rather than share the column, the columns of a chunk are filtered one by one
+                result_columns[i] = result_columns[_same_expr_idxs[i]]->clone_shared();
+                continue;
+            }
             ASSIGN_OR_RETURN(result_columns[i], _expr_ctxs[i]->evaluate(chunk.get()));
 
             if (result_columns[i]->only_null()) {
@@ -81,7 +86,15 @@ Status ProjectOperatorFactory::prepare(RuntimeState* state) {
     };
 
     RETURN_IF_ERROR(init_dict_optimize(_common_sub_expr_ctxs, _common_sub_column_ids));
+    std::vector<ExprContext*> origin_expr_ctxs = _expr_ctxs;
     RETURN_IF_ERROR(init_dict_optimize(_expr_ctxs, _column_ids));
+    // the expression rewritten for the dict of its slot may not produce the same result as the others
+    for (size_t i = 0; i < _same_expr_idxs.size(); ++i) {
+        int32_t idx = _same_expr_idxs[i];
+        if (idx >= 0 && (_expr_ctxs[i] != origin_expr_ctxs[i] || _expr_ctxs[idx] != origin_expr_ctxs[idx])) {
+            _same_expr_idxs[i] = -1;
+        }
+    }
 
     return Status::OK();
 }
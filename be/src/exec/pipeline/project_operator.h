@@ -13,13 +13,14 @@ public:
     ProjectOperator(OperatorFactory* factory, int32_t id, int32_t plan_node_id, int32_t driver_sequence,
                     std::vector<int32_t>& column_ids, const std::vector<ExprContext*>& expr_ctxs,
                     const std::vector<bool>& type_is_nullable, const std::vector<int32_t>& common_sub_column_ids,
-                    const std::vector<ExprContext*>& common_sub_expr_ctxs)
+                    const std::vector<ExprContext*>& common_sub_expr_ctxs, const std::vector<int32_t>& same_expr_idxs)
             : Operator(factory, id, "project", plan_node_id, driver_sequence),
               _column_ids(column_ids),
               _expr_ctxs(expr_ctxs),
               _type_is_nullable(type_is_nullable),
               _common_sub_column_ids(common_sub_column_ids),
-              _common_sub_expr_ctxs(common_sub_expr_ctxs) {}
+              _common_sub_expr_ctxs(common_sub_expr_ctxs),
+              _same_expr_idxs(same_expr_idxs) {}
 
     ~ProjectOperator() override = default;
 
@@ -50,6 +51,9 @@ private:
     const std::vector<int32_t>& _common_sub_column_ids;
     const std::vector<ExprContext*>& _common_sub_expr_ctxs;
 
+    // see ProjectOperatorFactory::_same_expr_idxs
+    const std::vector<int32_t>& _same_expr_idxs;
+
     bool _is_finished = false;
     vectorized::ChunkPtr _cur_chunk = nullptr;
 };
@@ -59,19 +63,24 @@ public:
     ProjectOperatorFactory(int32_t id, int32_t plan_node_id, std::vector<int32_t>&& column_ids,
                            std::vector<ExprContext*>&& expr_ctxs, std::vector<bool>&& type_is_nullable,
                            std::vector<int32_t>&& common_sub_column_ids,
-                           std::vector<ExprContext*>&& common_sub_expr_ctxs)
+                           std::vector<ExprContext*>&& common_sub_expr_ctxs,
+                           std::vector<int32_t>&& same_expr_idxs = {})
             : OperatorFactory(id, "project", plan_node_id),
               _column_ids(std::move(column_ids)),
               _expr_ctxs(std::move(expr_ctxs)),
               _type_is_nullable(std::move(type_is_nullable)),
               _common_sub_column_ids(std::move(common_sub_column_ids)),
-              _common_sub_expr_ctxs(std::move(common_sub_expr_ctxs)) {}
+              _common_sub_expr_ctxs(std::move(common_sub_expr_ctxs)),
+              _same_expr_idxs(std::move(same_expr_idxs)) {
+        _same_expr_idxs.resize(_column_ids.size(), -1);
+    }
 
     ~ProjectOperatorFactory() override = default;
 
     OperatorPtr create(int32_t degree_of_parallelism, int32_t driver_sequence) override {
         return std::make_shared<ProjectOperator>(this, _id, _plan_node_id, driver_sequence, _column_ids, _expr_ctxs,
-                                                 _type_is_nullable, _common_sub_column_ids, _common_sub_expr_ctxs);
+                                                 _type_is_nullable, _common_sub_column_ids, _common_sub_expr_ctxs,
+                                                 _same_expr_idxs);
     }
 
     Status prepare(RuntimeState* state) override;
@@ -84,6 +93,9 @@ private:
 
     std::vector<int32_t> _common_sub_column_ids;
     std::vector<ExprContext*> _common_sub_expr_ctxs;
+    // the index of the first output with the same expression, its result is copied instead of evaluated
+    // again, -1 if there is none
+    std::vector<int32_t> _same_expr_idxs;
     vectorized::DictOptimizeParser _dict_optimize_parser;
 };
 
@@ -0,0 +1,85 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "exec/pipeline/query_cache.h"
+
+#include "column/chunk.h"
+#include "runtime/current_thread.h"
+#include "runtime/mem_tracker.h"
+#include "util/defer_op.h"
+
+namespace starrocks::pipeline {
+
+QueryCache* QueryCache::_s_instance = nullptr;
+
+void QueryCache::create_global_cache(MemTracker* mem_tracker, size_t capacity) {
+    if (_s_instance == nullptr) {
+        _s_instance = new QueryCache(mem_tracker, capacity);
+    }
+}
+
+void QueryCache::release_global_cache() {
+    if (_s_instance != nullptr) {
+        delete _s_instance;
+        _s_instance = nullptr;
+    }
+}
+
+std::string QueryCache::_encode_key(const std::string& digest, int64_t tablet_id) {
+    std::string key(digest);
+    key.append(reinterpret_cast<const char*>(&tablet_id), sizeof(tablet_id));
+    return key;
+}
+
+QueryCache::QueryCache(MemTracker* mem_tracker, size_t capacity)
+        : _mem_tracker(mem_tracker), _cache(new_lru_cache(capacity)) {}
+
+QueryCache::~QueryCache() = default;
+
+QueryCache::EntryPtr QueryCache::lookup(const std::string& digest, int64_t tablet_id, int64_t version) {
+    auto* handle = _cache->lookup(CacheKey(_encode_key(digest, tablet_id)));
+    if (handle == nullptr) {
+        return nullptr;
+    }
+    auto entry = *reinterpret_cast<EntryPtr*>(_cache->value(handle));
+#ifndef BE_TEST
+    MemTracker* prev_tracker = tls_thread_status.set_mem_tracker(_mem_tracker);
+    DeferOp op([&] { tls_thread_status.set_mem_tracker(prev_tracker); });
+#endif
+    _cache->release(handle);
+    // the tablet is read at a version older than the cached one
+    if (entry->version > version) {
+        return nullptr;
+    }
+    return entry;
+}
+
+void QueryCache::insert(const std::string& digest, int64_t tablet_id, int64_t version,
+                        std::vector<vectorized::ChunkPtr> chunks) {
+    std::string key = _encode_key(digest, tablet_id);
+    if (auto* handle = _cache->lookup(CacheKey(key)); handle != nullptr) {
+        int64_t cached_version = (*reinterpret_cast<EntryPtr*>(_cache->value(handle)))->version;
+        _cache->release(handle);
+        if (cached_version >= version) {
+            return;
+        }
+    }
+
+    size_t charge = 0;
+    for (const auto& chunk : chunks) {
+        charge += chunk->memory_usage();
+    }
+#ifndef BE_TEST
+    // The chunks are owned by the cache from now on.
+    tls_thread_status.mem_release(charge);
+    MemTracker* prev_tracker = tls_thread_status.set_mem_tracker(_mem_tracker);
+    tls_thread_status.mem_consume(charge);
+    DeferOp op([&] { tls_thread_status.set_mem_tracker(prev_tracker); });
+#endif
+
+    auto deleter = [](const starrocks::CacheKey& key, void* value) { delete reinterpret_cast<EntryPtr*>(value); };
+    auto* value = new EntryPtr(std::make_shared<const Entry>(Entry{version, std::move(chunks)}));
+    auto* handle = _cache->insert(CacheKey(key), value, charge, deleter);
+    _cache->release(handle);
+}
+
+} // namespace starrocks::pipeline
@@ -0,0 +1,68 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "column/vectorized_fwd.h"
+#include "util/lru_cache.h"
+
+namespace starrocks {
+
+class MemTracker;
+
+namespace pipeline {
+
+// Cache of the partial aggregation results of the tablets, shared by the queries on the BE, so that the dashboards
+// rerunning the same aggregations over the partitions which are seldom loaded don't scan and aggregate the same
+// tablets again.
+// An entry is identified by the digest of the plan fragment computing the result and the tablet id, and records the
+// visible version of the tablet which the result is computed at. A lookup at a newer version still returns the
+// entry, so that the caller only computes the rows of the versions loaded after the cached one and merges them with
+// the cached result, which is valid only if these versions just append rows, e.g. they have no delete predicate
+// and the tablet isn't of the primary key model.
+// Like FooterCache, it's not created unless `query_cache_limit` is set.
+class QueryCache {
+public:
+    struct Entry {
+        int64_t version;
+        std::vector<vectorized::ChunkPtr> chunks;
+    };
+    using EntryPtr = std::shared_ptr<const Entry>;
+
+    // Create global instance of this class
+    static void create_global_cache(MemTracker* mem_tracker, size_t capacity);
+
+    static void release_global_cache();
+
+    // Return global instance, or nullptr if the cache is disabled.
+    static QueryCache* instance() { return _s_instance; }
+
+    QueryCache(MemTracker* mem_tracker, size_t capacity);
+    ~QueryCache();
+
+    // Return the cached result of |tablet_id| by the fragment of |digest| whose version is not newer than |version|,
+    // or nullptr if it's not found.
+    // The returned chunks are shared and must not be modified.
+    EntryPtr lookup(const std::string& digest, int64_t tablet_id, int64_t version);
+
+    // Cache |chunks| as the result of |tablet_id| at |version| by the fragment of |digest|, which must not be
+    // modified anymore. The cached result of a newer version is kept.
+    void insert(const std::string& digest, int64_t tablet_id, int64_t version,
+                std::vector<vectorized::ChunkPtr> chunks);
+
+    size_t memory_usage() const { return _cache->get_memory_usage(); }
+
+private:
+    static std::string _encode_key(const std::string& digest, int64_t tablet_id);
+
+    static QueryCache* _s_instance;
+
+    MemTracker* _mem_tracker = nullptr;
+    std::unique_ptr<Cache> _cache;
+};
+
+} // namespace pipeline
+} // namespace starrocks
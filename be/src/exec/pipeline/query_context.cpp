@@ -3,6 +3,7 @@
 
 #include <memory>
 
+#include "common/config.h"
 #include "exec/pipeline/fragment_context.h"
 #include "exec/workgroup/work_group.h"
 #include "runtime/current_thread.h"
@@ -201,6 +202,9 @@ QueryContext* QueryContextManager::get_or_register(const TUniqueId& query_id) {
         auto&& ctx = std::make_shared<QueryContext>();
         auto* ctx_raw_ptr = ctx.get();
         ctx_raw_ptr->set_query_id(query_id);
+        if (config::pipeline_enable_query_trace) {
+            ctx_raw_ptr->set_query_trace(QueryTraceManager::instance()->create(query_id));
+        }
         ctx_raw_ptr->increment_num_fragments();
         context_map.emplace(query_id, std::move(ctx));
         return ctx_raw_ptr;
@@ -4,13 +4,16 @@
 
 #include <atomic>
 #include <chrono>
+#include <limits>
 #include <mutex>
 #include <unordered_map>
 
 #include "exec/pipeline/fragment_context.h"
 #include "exec/pipeline/pipeline_fwd.h"
+#include "exec/pipeline/query_trace.h"
 #include "gen_cpp/InternalService_types.h" // for TQueryOptions
 #include "gen_cpp/Types_types.h"           // for TUniqueId
+#include "io/io_profiler.h"
 #include "runtime/runtime_state.h"
 #include "util/hash_util.hpp"
 #include "util/time.h"
@@ -93,6 +96,16 @@ public:
     int64_t cur_scan_rows_num() const { return _cur_scan_rows_num; }
     void incr_cur_scan_bytes(int64_t scan_bytes) { _cur_scan_bytes += scan_bytes; }
     int64_t get_scan_bytes() const { return _cur_scan_bytes; }
+    // The accumulated cpu time of the scan io tasks, used to schedule the scan io tasks.
+    void incr_scan_time_ns(int64_t scan_time_ns) { _cur_scan_time_ns += scan_time_ns; }
+    int64_t scan_time_ns() const { return _cur_scan_time_ns; }
+    // The bytes read by the scan io tasks from each io tier.
+    void incr_io_stats(const io::IOStats& io_stats) {
+        for (int i = 0; i < io::NUM_IO_TIERS; i++) {
+            _cur_io_read_bytes[i] += io_stats.read_bytes[i];
+        }
+    }
+    int64_t io_read_bytes(io::IOTier tier) const { return _cur_io_read_bytes[tier]; }
 
     // Record the cpu time of the query run, for big query checking
     int64_t init_wg_cpu_cost() const { return _init_wg_cpu_cost; }
@@ -103,6 +116,19 @@ public:
     int64_t query_begin_time() const { return _query_begin_time; }
     void init_query_begin_time() { _query_begin_time = MonotonicNanos(); }
 
+    // The time point in MonotonicNanos() when the query is expected to be timeout, which is initialized by
+    // the first fragment instance of the query on this BE.
+    void init_query_deadline(int timeout_seconds) {
+        int64_t expected = std::numeric_limits<int64_t>::max();
+        _query_deadline_ns.compare_exchange_strong(expected, MonotonicNanos() + timeout_seconds * NANOS_PER_SEC);
+    }
+    int64_t query_deadline_ns() const { return _query_deadline_ns; }
+
+    // The trace of the query, which is nullptr unless config::pipeline_enable_query_trace is on
+    // when the query context is created.
+    void set_query_trace(QueryTracePtr query_trace) { _query_trace = std::move(query_trace); }
+    const QueryTracePtr& query_trace() const { return _query_trace; }
+
 private:
     ExecEnv* _exec_env = nullptr;
     TUniqueId _query_id;
@@ -124,8 +150,13 @@ private:
     std::atomic<int64_t> _cur_cpu_cost_ns = 0;
     std::atomic<int64_t> _cur_scan_rows_num = 0;
     std::atomic<int64_t> _cur_scan_bytes = 0;
+    std::atomic<int64_t> _cur_scan_time_ns = 0;
+    std::atomic<int64_t> _cur_io_read_bytes[io::NUM_IO_TIERS] = {};
+    std::atomic<int64_t> _query_deadline_ns = std::numeric_limits<int64_t>::max();
 
     int64_t _init_wg_cpu_cost = 0;
+
+    QueryTracePtr _query_trace;
 };
 
 class QueryContextManager {
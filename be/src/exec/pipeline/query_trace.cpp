@@ -0,0 +1,162 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "exec/pipeline/query_trace.h"
+
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
+#include <algorithm>
+
+#include "common/config.h"
+#include "util/time.h"
+#include "util/uid_util.h"
+
+namespace starrocks::pipeline {
+
+QueryTrace::QueryTrace(const TUniqueId& query_id, size_t max_events)
+        : _query_id(query_id), _max_events(max_events), _start_ns(MonotonicNanos()) {}
+
+int64_t QueryTrace::process_id(const TUniqueId& fragment_instance_id) {
+    std::lock_guard<std::mutex> l(_mutex);
+    auto it = _process_ids.find(fragment_instance_id);
+    if (it != _process_ids.end()) {
+        return it->second;
+    }
+    int64_t pid = _process_ids.size() + 1;
+    _process_ids.emplace(fragment_instance_id, pid);
+    return pid;
+}
+
+void QueryTrace::set_thread_name(int64_t pid, int64_t tid, std::string name) {
+    std::lock_guard<std::mutex> l(_mutex);
+    _thread_names[{pid, tid}] = std::move(name);
+}
+
+void QueryTrace::add_span(std::string name, const char* category, int64_t pid, int64_t tid, int64_t start_ns,
+                          int64_t end_ns) {
+    _add_event({std::move(name), category, pid, tid, start_ns, end_ns, false});
+}
+
+void QueryTrace::add_async_span(std::string name, const char* category, int64_t pid, int64_t id, int64_t start_ns,
+                                int64_t end_ns) {
+    _add_event({std::move(name), category, pid, id, start_ns, end_ns, true});
+}
+
+void QueryTrace::_add_event(Event&& event) {
+    std::lock_guard<std::mutex> l(_mutex);
+    if (_events.size() >= _max_events) {
+        _num_dropped_events++;
+        return;
+    }
+    _events.emplace_back(std::move(event));
+}
+
+size_t QueryTrace::num_events() const {
+    std::lock_guard<std::mutex> l(_mutex);
+    return _events.size();
+}
+
+std::string QueryTrace::to_json() const {
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    // The timestamps of the Chrome trace event format are in microseconds.
+    auto write_ts = [&](const char* key, int64_t ns) {
+        writer.Key(key);
+        writer.Double(static_cast<double>(ns) / 1000);
+    };
+    auto write_metadata = [&](const char* name, int64_t pid, const int64_t* tid, const std::string& value) {
+        writer.StartObject();
+        writer.Key("name");
+        writer.String(name);
+        writer.Key("ph");
+        writer.String("M");
+        writer.Key("pid");
+        writer.Int64(pid);
+        if (tid != nullptr) {
+            writer.Key("tid");
+            writer.Int64(*tid);
+        }
+        writer.Key("args");
+        writer.StartObject();
+        writer.Key("name");
+        writer.String(value.data(), value.size());
+        writer.EndObject();
+        writer.EndObject();
+    };
+    auto write_event = [&](const Event& event, const char* phase, int64_t ts_ns, int64_t dur_ns) {
+        writer.StartObject();
+        writer.Key("name");
+        writer.String(event.name.data(), event.name.size());
+        writer.Key("cat");
+        writer.String(event.category);
+        writer.Key("ph");
+        writer.String(phase);
+        write_ts("ts", ts_ns - _start_ns);
+        if (dur_ns >= 0) {
+            write_ts("dur", dur_ns);
+        }
+        writer.Key("pid");
+        writer.Int64(event.pid);
+        writer.Key(event.is_async ? "id" : "tid");
+        writer.Int64(event.id);
+        writer.EndObject();
+    };
+
+    std::lock_guard<std::mutex> l(_mutex);
+    writer.StartObject();
+    writer.Key("traceEvents");
+    writer.StartArray();
+    for (const auto& [fragment_instance_id, pid] : _process_ids) {
+        write_metadata("process_name", pid, nullptr, "FragmentInstance " + print_id(fragment_instance_id));
+    }
+    for (const auto& [key, name] : _thread_names) {
+        write_metadata("thread_name", key.first, &key.second, name);
+    }
+    for (const auto& event : _events) {
+        if (event.is_async) {
+            write_event(event, "b", event.start_ns, -1);
+            write_event(event, "e", event.end_ns, -1);
+        } else {
+            write_event(event, "X", event.start_ns, std::max<int64_t>(event.end_ns - event.start_ns, 0));
+        }
+    }
+    writer.EndArray();
+    writer.Key("displayTimeUnit");
+    writer.String("ns");
+    writer.Key("otherData");
+    writer.StartObject();
+    writer.Key("query_id");
+    std::string query_id = print_id(_query_id);
+    writer.String(query_id.data(), query_id.size());
+    writer.Key("dropped_events");
+    writer.Uint64(_num_dropped_events);
+    writer.EndObject();
+    writer.EndObject();
+    return {buffer.GetString(), buffer.GetSize()};
+}
+
+QueryTracePtr QueryTraceManager::create(const TUniqueId& query_id) {
+    auto trace = std::make_shared<QueryTrace>(query_id, config::pipeline_query_trace_max_events);
+    std::lock_guard<std::mutex> l(_mutex);
+    _traces.erase(std::remove_if(_traces.begin(), _traces.end(),
+                                 [&](const QueryTracePtr& t) { return t->query_id() == query_id; }),
+                  _traces.end());
+    _traces.emplace_back(trace);
+    const auto max_num = static_cast<size_t>(std::max<int32_t>(config::pipeline_query_trace_max_num, 1));
+    while (_traces.size() > max_num) {
+        _traces.pop_front();
+    }
+    return trace;
+}
+
+QueryTracePtr QueryTraceManager::get(const TUniqueId& query_id) {
+    std::lock_guard<std::mutex> l(_mutex);
+    for (auto it = _traces.rbegin(); it != _traces.rend(); ++it) {
+        if ((*it)->query_id() == query_id) {
+            return *it;
+        }
+    }
+    return nullptr;
+}
+
+} // namespace starrocks::pipeline
@@ -0,0 +1,101 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <atomic>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "gen_cpp/Types_types.h" // for TUniqueId
+#include "util/hash_util.hpp"
+
+namespace starrocks::pipeline {
+
+// QueryTrace records the timeline of a query on this BE, i.e. the spans of the driver states, the scan io tasks
+// and the exchange rpcs, and dumps it in the Chrome trace event format, which can be loaded by chrome://tracing
+// or https://ui.perfetto.dev.
+//
+// Each fragment instance is shown as a process, and each driver or scan io task slot is shown as a thread of it.
+// The events beyond the max number of events are dropped and counted.
+class QueryTrace {
+public:
+    QueryTrace(const TUniqueId& query_id, size_t max_events);
+
+    const TUniqueId& query_id() const { return _query_id; }
+
+    // Returns the process id of the fragment instance in the trace, which is assigned on the first call.
+    int64_t process_id(const TUniqueId& fragment_instance_id);
+    void set_thread_name(int64_t pid, int64_t tid, std::string name);
+
+    // Records the span [start_ns, end_ns] of MonotonicNanos() on the thread |tid| of the process |pid|.
+    // The spans of the same thread should not overlap.
+    void add_span(std::string name, const char* category, int64_t pid, int64_t tid, int64_t start_ns,
+                  int64_t end_ns);
+    // Records the span which may overlap with the other spans of the process, e.g. an rpc in flight.
+    // It's shown as an async event identified by |id| in the process.
+    void add_async_span(std::string name, const char* category, int64_t pid, int64_t id, int64_t start_ns,
+                        int64_t end_ns);
+
+    size_t num_events() const;
+    size_t num_dropped_events() const { return _num_dropped_events; }
+
+    std::string to_json() const;
+
+private:
+    struct Event {
+        std::string name;
+        const char* category;
+        int64_t pid;
+        // The thread id of a span, or the id of an async span.
+        int64_t id;
+        int64_t start_ns;
+        int64_t end_ns;
+        bool is_async;
+    };
+
+    void _add_event(Event&& event);
+
+    const TUniqueId _query_id;
+    const size_t _max_events;
+    // The timestamps of the trace are relative to the creation of the trace.
+    const int64_t _start_ns;
+
+    mutable std::mutex _mutex;
+    std::vector<Event> _events;
+    std::unordered_map<TUniqueId, int64_t> _process_ids;
+    std::map<std::pair<int64_t, int64_t>, std::string> _thread_names;
+    std::atomic<size_t> _num_dropped_events{0};
+};
+
+using QueryTracePtr = std::shared_ptr<QueryTrace>;
+
+// QueryTraceManager keeps the traces of the latest queries on this BE, so that the trace of a query can be
+// dumped after the query finishes. The oldest trace is evicted if there are more than
+// config::pipeline_query_trace_max_num traces.
+class QueryTraceManager {
+public:
+    static QueryTraceManager* instance() {
+        static QueryTraceManager manager;
+        return &manager;
+    }
+
+    // Creates the trace of the query, which replaces the existing trace of the same query.
+    QueryTracePtr create(const TUniqueId& query_id);
+    // Returns nullptr if the trace of the query doesn't exist or has been evicted.
+    QueryTracePtr get(const TUniqueId& query_id);
+
+private:
+    QueryTraceManager() = default;
+
+    std::mutex _mutex;
+    // From the oldest to the latest.
+    std::deque<QueryTracePtr> _traces;
+};
+
+} // namespace starrocks::pipeline
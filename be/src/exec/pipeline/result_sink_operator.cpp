@@ -49,6 +49,10 @@ void ResultSinkOperator::close(RuntimeState* state) {
             auto query_statistic = std::make_shared<QueryStatistics>();
             QueryContext* query_ctx = state->query_ctx();
             query_statistic->add_scan_stats(query_ctx->cur_scan_rows_num(), query_ctx->get_scan_bytes());
+            for (int i = 0; i < io::NUM_IO_TIERS; i++) {
+                auto tier = static_cast<io::IOTier>(i);
+                query_statistic->add_io_read_bytes(tier, query_ctx->io_read_bytes(tier));
+            }
             query_statistic->add_cpu_costs(query_ctx->cpu_cost());
             query_statistic->add_mem_costs(query_ctx->mem_cost_bytes());
             query_statistic->set_returned_rows(_num_written_rows);
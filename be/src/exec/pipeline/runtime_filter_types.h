@@ -5,6 +5,7 @@
 #include <mutex>
 
 #include "common/statusor.h"
+#include "exec/pipeline/poller_notifier.h"
 #include "exec/vectorized/hash_join_node.h"
 #include "exprs/expr_context.h"
 #include "exprs/predicate.h"
@@ -94,6 +95,7 @@ public:
     void set_collector(RuntimeFilterCollectorPtr&& collector) {
         _collector_ownership = std::move(collector);
         _collector.store(_collector_ownership.get(), std::memory_order_release);
+        PollerNotifier::instance()->notify();
     }
     RuntimeFilterCollector* get_collector() { return _collector.load(std::memory_order_acquire); }
     bool is_ready() { return get_collector() != nullptr; }
@@ -78,16 +78,27 @@ ConnectorChunkSource::~ConnectorChunkSource() {
 }
 
 Status ConnectorChunkSource::prepare(RuntimeState* state) {
-    // semantics of `prepare` in ChunkSource is identical to `open`
+    // semantics of `prepare` in ChunkSource is identical to `open`.
+    // Opening the data source is deferred to the first io task, because it usually reads the remote storage,
+    // e.g. opening the HDFS file and reading the footer, which shouldn't block the pipeline execution thread.
     _runtime_state = state;
-    RETURN_IF_ERROR(_data_source->open(state));
     return Status::OK();
 }
 
 void ConnectorChunkSource::close(RuntimeState* state) {
     if (_closed) return;
     _closed = true;
-    _data_source->close(state);
+    if (_opened) {
+        _data_source->close(state);
+    }
+}
+
+Status ConnectorChunkSource::_open_data_source_if_needed() {
+    if (_opened) {
+        return Status::OK();
+    }
+    _opened = true;
+    return _data_source->open(_runtime_state);
 }
 
 bool ConnectorChunkSource::has_next_chunk() const {
@@ -114,6 +125,10 @@ Status ConnectorChunkSource::buffer_next_batch_chunks_blocking(size_t batch_size
     if (!_status.ok()) {
         return _status;
     }
+    _status = _open_data_source_if_needed();
+    if (!_status.ok()) {
+        return _status;
+    }
 
     for (size_t i = 0; i < batch_size && !state->is_cancelled(); ++i) {
         vectorized::ChunkPtr chunk;
@@ -137,6 +152,13 @@ Status ConnectorChunkSource::buffer_next_batch_chunks_blocking_for_workgroup(siz
     }
 
     int64_t time_spent = 0;
+    {
+        SCOPED_RAW_TIMER(&time_spent);
+        _status = _open_data_source_if_needed();
+        if (!_status.ok()) {
+            return _status;
+        }
+    }
     for (size_t i = 0; i < batch_size && !state->is_cancelled(); ++i) {
         {
             SCOPED_RAW_TIMER(&time_spent);
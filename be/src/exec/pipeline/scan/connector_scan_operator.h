@@ -64,6 +64,8 @@ public:
 
 private:
     Status _read_chunk(vectorized::ChunkPtr* chunk);
+    // Open the data source in the io task at the first time.
+    Status _open_data_source_if_needed();
 
     // Yield scan io task when maximum time in nano-seconds has spent in current execution round.
     static constexpr int64_t YIELD_MAX_TIME_SPENT = 100'000'000L;
@@ -84,6 +86,7 @@ private:
     // =========================
     RuntimeState* _runtime_state = nullptr;
     Status _status = Status::OK();
+    bool _opened = false;
     bool _closed = false;
     uint64_t _rows_read = 0;
     UnboundedBlockingQueue<vectorized::ChunkPtr> _chunk_buffer;
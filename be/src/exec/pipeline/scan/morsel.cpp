@@ -2,6 +2,7 @@
 
 #include "exec/pipeline/scan/morsel.h"
 
+#include "common/config.h"
 #include "exec/olap_utils.h"
 #include "storage/chunk_helper.h"
 #include "storage/range.h"
@@ -25,6 +26,26 @@ void LogicalSplitScanMorsel::init_tablet_reader_params(vectorized::TabletReaderP
 }
 
 /// MorselQueue.
+static int64_t _sum_tablet_rows(const std::vector<TabletSharedPtr>& tablets) {
+    int64_t num_rows = 0;
+    for (const auto& tablet : tablets) {
+        num_rows += static_cast<int64_t>(tablet->num_rows());
+    }
+    return num_rows;
+}
+
+// Guided self-scheduling: the morsels are large at first to reduce the overhead of seeking,
+// and get smaller near the end, so that the last morsels of the drivers finish at about the same time.
+static int64_t _guided_splitted_scan_rows(int64_t num_rest_rows, int64_t degree_of_parallelism,
+                                          int64_t splitted_scan_rows) {
+    if (!config::tablet_internal_parallel_guided_split) {
+        return splitted_scan_rows;
+    }
+    int64_t rows = num_rest_rows / std::max<int64_t>(2 * degree_of_parallelism, 1);
+    rows = std::max(rows, config::tablet_internal_parallel_min_splitted_scan_rows);
+    return std::min(rows, splitted_scan_rows);
+}
+
 std::vector<TInternalScanRange*> _convert_morsels_to_olap_scan_ranges(const Morsels& morsels) {
     std::vector<TInternalScanRange*> scan_ranges;
     scan_ranges.reserve(morsels.size());
@@ -98,14 +119,16 @@ StatusOr<MorselPtr> PhysicalSplitMorselQueue::try_get() {
         RETURN_IF_ERROR(_init_segment());
     }
 
+    const int64_t splitted_scan_rows = _next_splitted_scan_rows();
     vectorized::SparseRange taken_range;
-    _segment_range_iter.next_range(_splitted_scan_rows, &taken_range);
+    _segment_range_iter.next_range(splitted_scan_rows, &taken_range);
     _num_segment_rest_rows -= taken_range.span_size();
-    if (_num_segment_rest_rows < _splitted_scan_rows) {
+    if (_num_segment_rest_rows < splitted_scan_rows) {
         // If there are too few rows left in the segment, take them all this time.
-        _segment_range_iter.next_range(_splitted_scan_rows, &taken_range);
+        _segment_range_iter.next_range(splitted_scan_rows, &taken_range);
         _num_segment_rest_rows = 0;
     }
+    _num_rest_rows = std::max<int64_t>(_num_rest_rows - taken_range.span_size(), 0);
 
     auto* scan_morsel = _cur_scan_morsel();
     auto* rowset = _cur_rowset();
@@ -153,6 +176,13 @@ rowid_t PhysicalSplitMorselQueue::_upper_bound_ordinal(Segment* segment, const v
     return end;
 }
 
+int64_t PhysicalSplitMorselQueue::_next_splitted_scan_rows() {
+    if (_num_rest_rows < 0) {
+        _num_rest_rows = _sum_tablet_rows(_tablets);
+    }
+    return _guided_splitted_scan_rows(_num_rest_rows, _degree_of_parallelism, _splitted_scan_rows);
+}
+
 ScanMorsel* PhysicalSplitMorselQueue::_cur_scan_morsel() {
     return down_cast<ScanMorsel*>(_morsels[_tablet_idx].get());
 }
@@ -314,6 +344,7 @@ StatusOr<MorselPtr> LogicalSplitMorselQueue::try_get() {
     // The short keys of index 1 and 4 are both 22, so use index 5 as the range upper.
     // As for morsel5, it trys to take index 2~4 firstly, but there will be only 1 block left.
     // Therefore, morsel5 and morsel6 each takes 2 morsel.
+    _sample_splitted_scan_blocks = _next_splitted_scan_blocks();
     size_t num_taken_blocks = 0;
     std::vector<vectorized::ShortKeyRangeOptionPtr> short_key_ranges;
     vectorized::ShortKeyOptionPtr _cur_range_lower = nullptr;
@@ -367,6 +398,8 @@ StatusOr<MorselPtr> LogicalSplitMorselQueue::try_get() {
     }
     DCHECK(_cur_range_lower == nullptr);
     DCHECK(_cur_range_upper == nullptr);
+    const int64_t num_taken_rows = num_taken_blocks * _tablets[_tablet_idx]->num_rows() / _segment_group->num_blocks();
+    _num_rest_rows = std::max<int64_t>(_num_rest_rows - num_taken_rows, 0);
 
     auto* scan_morsel = down_cast<ScanMorsel*>(_morsels[_tablet_idx].get());
     auto morsel = std::make_unique<LogicalSplitScanMorsel>(
@@ -432,6 +465,15 @@ vectorized::ShortKeyOptionPtr LogicalSplitMorselQueue::_create_range_upper() con
     }
 }
 
+int64_t LogicalSplitMorselQueue::_next_splitted_scan_blocks() {
+    if (_num_rest_rows < 0) {
+        _num_rest_rows = _sum_tablet_rows(_tablets);
+    }
+    const int64_t rows = _guided_splitted_scan_rows(_num_rest_rows, _degree_of_parallelism, _splitted_scan_rows);
+    const int64_t blocks = rows * _segment_group->num_blocks() / _tablets[_tablet_idx]->num_rows();
+    return std::max<int64_t>(blocks, 1);
+}
+
 bool LogicalSplitMorselQueue::_cur_tablet_finished() const {
     return _range_idx >= _block_ranges_per_seek_range.size();
 }
@@ -519,9 +561,6 @@ Status LogicalSplitMorselQueue::_init_tablet() {
 
     _short_key_schema = std::make_shared<vectorized::Schema>(
             vectorized::ChunkHelper::get_short_key_schema_with_format_v2(_tablets[_tablet_idx]->tablet_schema()));
-    _sample_splitted_scan_blocks =
-            _splitted_scan_rows * _segment_group->num_blocks() / _tablets[_tablet_idx]->num_rows();
-    _sample_splitted_scan_blocks = std::max<int64_t>(_sample_splitted_scan_blocks, 1);
 
     if (_tablet_seek_ranges.empty()) {
         _block_ranges_per_seek_range.emplace_back(_segment_group->begin(), _segment_group->end());
@@ -2,6 +2,8 @@
 
 #pragma once
 
+#include <algorithm>
+#include <limits>
 #include <optional>
 
 #include "gen_cpp/InternalService_types.h"
@@ -120,6 +122,14 @@ public:
     virtual std::string name() const = 0;
 
     virtual bool need_rebalance() const { return false; }
+
+    // The upper bound of the degree of parallelism of the scan operator reading this morsel queue,
+    // which is used to avoid creating too many drivers for the small amount of data.
+    size_t max_degree_of_parallelism() const { return std::min(_max_degree_of_parallelism, num_morsels()); }
+    void set_max_degree_of_parallelism(size_t max_dop) { _max_degree_of_parallelism = std::max<size_t>(1, max_dop); }
+
+private:
+    size_t _max_degree_of_parallelism = std::numeric_limits<size_t>::max();
 };
 
 // The morsel queue with a fixed number of morsels, which is determined in the constructor.
@@ -186,6 +196,8 @@ private:
     // Load the meta of the new rowset and the index of the new segment,
     // and find the rowid range of each key range in this segment.
     Status _init_segment();
+    // The number of rows to pick up from the current segment this time.
+    int64_t _next_splitted_scan_rows();
 
 private:
     std::mutex _mutex;
@@ -218,6 +230,8 @@ private:
     vectorized::SparseRangeIterator _segment_range_iter;
     // The number of unprocessed rows of the current segment.
     size_t _num_segment_rest_rows = 0;
+    // The estimated number of unprocessed rows of all the tablets, -1 means it hasn't been initialized.
+    int64_t _num_rest_rows = -1;
 
     MemPool _mempool;
 };
@@ -261,6 +275,9 @@ private:
     ShortKeyIndexGroupIterator _lower_bound_ordinal(const vectorized::SeekTuple& key, bool lower) const;
     ShortKeyIndexGroupIterator _upper_bound_ordinal(const vectorized::SeekTuple& key, bool lower) const;
 
+    // The number of blocks to pick up from the current tablet this time.
+    int64_t _next_splitted_scan_blocks();
+
 private:
     std::mutex _mutex;
 
@@ -293,6 +310,8 @@ private:
     SegmentGroupPtr _segment_group = nullptr;
     vectorized::SchemaPtr _short_key_schema = nullptr;
     int64_t _sample_splitted_scan_blocks = 0;
+    // The estimated number of unprocessed rows of all the tablets, -1 means it hasn't been initialized.
+    int64_t _num_rest_rows = -1;
 
     std::vector<std::pair<ShortKeyIndexGroupIterator, ShortKeyIndexGroupIterator>> _block_ranges_per_seek_range;
     std::vector<size_t> _num_rest_blocks_per_seek_range;
@@ -17,9 +17,13 @@
 #include "runtime/primitive_type.h"
 #include "storage/chunk_helper.h"
 #include "storage/column_predicate_rewriter.h"
+#include "storage/data_dir.h"
 #include "storage/predicate_parser.h"
+#include "storage/primary_key_lookup.h"
 #include "storage/projection_iterator.h"
+#include "storage/shared_tablet_scan.h"
 #include "storage/storage_engine.h"
+#include "util/defer_op.h"
 
 namespace starrocks::pipeline {
 using namespace vectorized;
@@ -79,6 +83,9 @@ void OlapChunkSource::_init_counter(RuntimeState* state) {
     _read_pages_num_counter = ADD_COUNTER(_runtime_profile, "ReadPagesNum", TUnit::UNIT);
     _cached_pages_num_counter = ADD_COUNTER(_runtime_profile, "CachedPagesNum", TUnit::UNIT);
     _pushdown_predicates_counter = ADD_COUNTER(_runtime_profile, "PushdownPredicates", TUnit::UNIT);
+    if (_scan_node->topn_runtime_filter() != nullptr) {
+        _topn_filter_counter = ADD_COUNTER(_runtime_profile, "TopnRuntimeFilterRows", TUnit::UNIT);
+    }
 
     // SegmentInit
     _seg_init_timer = ADD_TIMER(_runtime_profile, "SegmentInit");
@@ -112,9 +119,10 @@ void OlapChunkSource::_init_counter(RuntimeState* state) {
 }
 
 Status OlapChunkSource::_get_tablet(const TInternalScanRange* scan_range) {
-    _version = strtoul(scan_range->version.c_str(), nullptr, 10);
-
     ASSIGN_OR_RETURN(_tablet, vectorized::OlapScanNode::get_tablet(scan_range));
+    ASSIGN_OR_RETURN(Version version, vectorized::OlapScanNode::get_read_version(scan_range, _tablet));
+    _begin_version = version.first;
+    _version = version.second;
 
     return Status::OK();
 }
@@ -144,6 +152,9 @@ Status OlapChunkSource::_init_reader_params(const std::vector<std::unique_ptr<Ol
     _params.profile = _runtime_profile;
     _params.runtime_state = _runtime_state;
     _params.use_page_cache = !config::disable_storage_page_cache;
+    if (thrift_olap_scan_node.__isset.fill_page_cache) {
+        _params.fill_page_cache = thrift_olap_scan_node.fill_page_cache;
+    }
     _morsel->init_tablet_reader_params(&_params);
     _decide_chunk_size();
 
@@ -158,6 +169,14 @@ Status OlapChunkSource::_init_reader_params(const std::vector<std::unique_ptr<Ol
         }
         _predicate_free_pool.emplace_back(std::move(p));
     }
+    // The latest bound of the top-n above is pushed down, so the segments and pages are pruned by the zone maps.
+    if (_scan_node->topn_runtime_filter() != nullptr) {
+        ColumnPredicate* topn_pred = _new_topn_predicate(&_topn_filter_version);
+        if (topn_pred != nullptr) {
+            _params.predicates.push_back(topn_pred);
+            _predicate_free_pool.emplace_back(topn_pred);
+        }
+    }
 
     {
         vectorized::ConjunctivePredicatesRewriter not_pushdown_predicate_rewriter(_not_push_down_predicates,
@@ -254,16 +273,29 @@ Status OlapChunkSource::_init_olap_reader(RuntimeState* runtime_state) {
     starrocks::vectorized::Schema child_schema =
             ChunkHelper::convert_schema_to_format_v2(tablet_schema, reader_columns);
 
-    _reader = std::make_shared<TabletReader>(_tablet, Version(0, _version), std::move(child_schema));
+    _reader = std::make_shared<TabletReader>(_tablet, Version(_begin_version, _version), child_schema);
+    ChunkIteratorPtr reader_iter = _reader;
+    // the point lookups and the shared scans always read all the versions
+    _point_lookup = _begin_version == 0 && _try_lookup_primary_keys();
+    _shared_scan = _begin_version == 0 && !_point_lookup && _try_share_scan();
+    // |_reader| is never opened by a point lookup or a shared scan, and its stats are always empty.
+    if (_point_lookup) {
+        reader_iter = new_primary_key_lookup_iterator(_tablet, _version, std::move(child_schema), _params);
+        _runtime_profile->add_info_string("PrimaryKeyLookup", "true");
+    } else if (_shared_scan) {
+        reader_iter = new_shared_tablet_scan_iterator(_tablet, Version(0, _version), std::move(child_schema), _params);
+        _runtime_profile->add_info_string("SharedTabletScan", "true");
+    }
     if (reader_columns.size() == scanner_columns.size()) {
-        _prj_iter = _reader;
+        _prj_iter = reader_iter;
     } else {
         starrocks::vectorized::Schema output_schema =
                 ChunkHelper::convert_schema_to_format_v2(tablet_schema, scanner_columns);
-        _prj_iter = new_projection_iterator(output_schema, _reader);
+        _prj_iter = new_projection_iterator(output_schema, reader_iter);
     }
 
-    if (!_scan_ctx->not_push_down_conjuncts().empty() || !_not_push_down_predicates.empty()) {
+    if (!_scan_ctx->not_push_down_conjuncts().empty() || !_not_push_down_predicates.empty() ||
+        _scan_node->topn_runtime_filter() != nullptr) {
         _expr_filter_timer = ADD_TIMER(_runtime_profile, "ExprFilterTime");
     }
 
@@ -271,12 +303,43 @@ Status OlapChunkSource::_init_olap_reader(RuntimeState* runtime_state) {
     RETURN_IF_ERROR(_prj_iter->init_encoded_schema(*_params.global_dictmaps));
     RETURN_IF_ERROR(_prj_iter->init_output_schema(*_params.unused_output_column_ids));
 
-    RETURN_IF_ERROR(_reader->prepare());
-    RETURN_IF_ERROR(_reader->open(_params));
+    if (!_shared_scan && !_point_lookup) {
+        RETURN_IF_ERROR(_reader->prepare());
+        RETURN_IF_ERROR(_reader->open(_params));
+    }
 
     return Status::OK();
 }
 
+bool OlapChunkSource::_try_lookup_primary_keys() {
+    if (!can_lookup_primary_keys(_tablet.get(), _params)) {
+        return false;
+    }
+    // The predicates are evaluated on the rows looked up instead of the storage.
+    for (const ColumnPredicate* pred : _params.predicates) {
+        _not_push_down_predicates.add(pred);
+    }
+    _params.predicates.clear();
+    return true;
+}
+
+bool OlapChunkSource::_try_share_scan() {
+    if (!config::enable_shared_tablet_scan || _limit != -1 || _scan_node->topn_runtime_filter() != nullptr) {
+        return false;
+    }
+    // The predicates are evaluated on the shared chunks by each scan instead of the storage.
+    std::vector<const ColumnPredicate*> predicates = std::move(_params.predicates);
+    _params.predicates.clear();
+    if (!can_share_tablet_scan(_params)) {
+        _params.predicates = std::move(predicates);
+        return false;
+    }
+    for (const ColumnPredicate* pred : predicates) {
+        _not_push_down_predicates.add(pred);
+    }
+    return true;
+}
+
 bool OlapChunkSource::has_next_chunk() const {
     // If we need and could get next chunk from storage engine,
     // the _status must be ok.
@@ -392,6 +455,12 @@ Status OlapChunkSource::_read_chunk_from_storage(RuntimeState* state, vectorized
     }
 
     SCOPED_TIMER(_scan_timer);
+    const io::IOStats io_stats_start = io::IOProfiler::thread_stats();
+    DeferOp update_data_dir_read_stats([&]() {
+        if (auto* data_dir = _tablet->data_dir(); data_dir != nullptr) {
+            data_dir->add_read_stats(io::IOProfiler::thread_stats() - io_stats_start);
+        }
+    });
     do {
         RETURN_IF_ERROR(state->check_mem_limit("read chunk from storage"));
         RETURN_IF_ERROR(_prj_iter->get_next(chunk));
@@ -416,6 +485,9 @@ Status OlapChunkSource::_read_chunk_from_storage(RuntimeState* state, vectorized
             RETURN_IF_ERROR(ExecNode::eval_conjuncts(_scan_ctx->not_push_down_conjuncts(), chunk));
             DCHECK_CHUNK(chunk);
         }
+        if (_scan_node->topn_runtime_filter() != nullptr) {
+            RETURN_IF_ERROR(_filter_by_topn_runtime_filter(chunk));
+        }
         TRY_CATCH_ALLOC_SCOPE_END()
 
     } while (chunk->num_rows() == 0);
@@ -427,6 +499,40 @@ Status OlapChunkSource::_read_chunk_from_storage(RuntimeState* state, vectorized
     return Status::OK();
 }
 
+ColumnPredicate* OlapChunkSource::_new_topn_predicate(int64_t* version) {
+    TCondition condition;
+    *version = _scan_node->topn_runtime_filter()->get_condition(&condition);
+    if (*version == 0) {
+        return nullptr;
+    }
+    PredicateParser parser(_tablet->tablet_schema());
+    PredicatePtr pred(parser.parse_thrift_cond(condition));
+    // The value columns of the aggregate tables are filtered after aggregating, like the other predicates on them.
+    if (pred == nullptr || !parser.can_pushdown(pred.get())) {
+        return nullptr;
+    }
+    return pred.release();
+}
+
+Status OlapChunkSource::_filter_by_topn_runtime_filter(vectorized::Chunk* chunk) {
+    // The bound tightened after opening the reader is only checked on the chunks.
+    if (_scan_node->topn_runtime_filter()->version() > _topn_filter_version) {
+        _topn_predicate.reset(_new_topn_predicate(&_topn_filter_version));
+    }
+    const size_t nrows = chunk->num_rows();
+    if (_topn_predicate == nullptr || nrows == 0) {
+        return Status::OK();
+    }
+    SCOPED_TIMER(_expr_filter_timer);
+    _selection.resize(nrows);
+    const Column* column = chunk->get_column_by_id(_topn_predicate->column_id()).get();
+    RETURN_IF_ERROR(_topn_predicate->evaluate(column, _selection.data(), 0, nrows));
+    const size_t num_filtered_rows = nrows - chunk->filter(_selection);
+    COUNTER_UPDATE(_topn_filter_counter, num_filtered_rows);
+    DCHECK_CHUNK(chunk);
+    return Status::OK();
+}
+
 int64_t OlapChunkSource::last_spent_cpu_time_ns() {
     int64_t time_ns = _last_spent_cpu_time_ns;
     _last_spent_cpu_time_ns += _reader->stats().decompress_ns;
@@ -72,9 +72,19 @@ private:
     void _init_counter(RuntimeState* state);
     Status _init_global_dicts(vectorized::TabletReaderParams* params);
     Status _read_chunk_from_storage([[maybe_unused]] RuntimeState* state, vectorized::Chunk* chunk);
+    // Return the predicate of the latest bound of the top-n runtime filter, or nullptr if it has no bound or the
+    // predicate can't be pushed down. |version| is set to the version of the bound.
+    vectorized::ColumnPredicate* _new_topn_predicate(int64_t* version);
+    Status _filter_by_topn_runtime_filter(vectorized::Chunk* chunk);
     void _update_counter();
     void _update_realtime_counter(vectorized::Chunk* chunk);
     void _decide_chunk_size();
+    // Return true if the scan can share the chunks read by the concurrent scans of the same tablet, and move the
+    // predicates pushed down to |_not_push_down_predicates|.
+    bool _try_share_scan();
+    // Return true if the rows of the scan can be looked up by the primary index of the tablet, and move the
+    // predicates pushed down to |_not_push_down_predicates|.
+    bool _try_lookup_primary_keys();
 
 private:
     vectorized::TabletReaderParams _params{};
@@ -91,6 +101,8 @@ private:
 
     ObjectPool _obj_pool;
     TabletSharedPtr _tablet;
+    // the rowsets of the versions in [_begin_version, _version] are read
+    int64_t _begin_version = 0;
     int64_t _version = 0;
 
     RuntimeState* _runtime_state = nullptr;
@@ -99,11 +111,18 @@ private:
     // For release memory.
     using PredicatePtr = std::unique_ptr<vectorized::ColumnPredicate>;
     std::vector<PredicatePtr> _predicate_free_pool;
+    // The predicate of the bound of the top-n runtime filter tightened after opening the reader, which is evaluated
+    // on the chunks read from the storage.
+    PredicatePtr _topn_predicate;
+    int64_t _topn_filter_version = 0;
 
     // NOTE: _reader may reference the _predicate_free_pool, it should be released before the _predicate_free_pool
     std::shared_ptr<vectorized::TabletReader> _reader;
     // projection iterator, doing the job of choosing |_scanner_columns| from |_reader_columns|.
     std::shared_ptr<vectorized::ChunkIterator> _prj_iter;
+    // whether |_prj_iter| reads from a shared tablet scan instead of |_reader|.
+    bool _shared_scan = false;
+    bool _point_lookup = false;
 
     const std::vector<std::string>* _unused_output_columns = nullptr;
     std::unordered_set<uint32_t> _unused_output_column_ids;
@@ -131,6 +150,7 @@ private:
     RuntimeProfile::Counter* _read_uncompressed_counter = nullptr;
     RuntimeProfile::Counter* _raw_rows_counter = nullptr;
     RuntimeProfile::Counter* _pred_filter_counter = nullptr;
+    RuntimeProfile::Counter* _topn_filter_counter = nullptr;
     RuntimeProfile::Counter* _del_vec_filter_counter = nullptr;
     RuntimeProfile::Counter* _pred_filter_timer = nullptr;
     RuntimeProfile::Counter* _chunk_copy_timer = nullptr;
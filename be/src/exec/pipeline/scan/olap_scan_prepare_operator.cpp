@@ -65,13 +65,13 @@ Status OlapScanPrepareOperator::_capture_tablet_rowsets() {
     for (int i = 0; i < olap_scan_ranges.size(); ++i) {
         auto* scan_range = olap_scan_ranges[i];
 
-        int64_t version = strtoul(scan_range->version.c_str(), nullptr, 10);
         ASSIGN_OR_RETURN(TabletSharedPtr tablet, vectorized::OlapScanNode::get_tablet(scan_range));
+        ASSIGN_OR_RETURN(Version version, vectorized::OlapScanNode::get_read_version(scan_range, tablet));
 
         // Capture row sets of this version tablet.
         {
             std::shared_lock l(tablet->get_header_lock());
-            RETURN_IF_ERROR(tablet->capture_consistent_rowsets(Version(0, version), &_tablet_rowsets[i]));
+            RETURN_IF_ERROR(tablet->capture_consistent_rowsets(version, &_tablet_rowsets[i]));
         }
 
         _tablets[i] = std::move(tablet);
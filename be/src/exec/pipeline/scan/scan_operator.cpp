@@ -3,14 +3,18 @@
 #include "exec/pipeline/scan/scan_operator.h"
 
 #include "column/chunk.h"
+#include "common/config.h"
 #include "exec/pipeline/limit_operator.h"
 #include "exec/pipeline/pipeline_builder.h"
+#include "exec/pipeline/poller_notifier.h"
+#include "exec/pipeline/query_context.h"
 #include "exec/pipeline/scan/connector_scan_operator.h"
 #include "exec/vectorized/olap_scan_node.h"
 #include "exec/workgroup/scan_executor.h"
 #include "exec/workgroup/work_group.h"
 #include "runtime/current_thread.h"
 #include "runtime/exec_env.h"
+#include "util/starrocks_metrics.h"
 
 namespace starrocks::pipeline {
 
@@ -50,6 +54,12 @@ Status ScanOperator::prepare(RuntimeState* state) {
     _unique_metrics->add_info_string("MorselQueueType", _morsel_queue->name());
     auto* max_scan_concurrency_counter = ADD_COUNTER(_unique_metrics, "MaxScanConcurrency", TUnit::UNIT);
     COUNTER_SET(max_scan_concurrency_counter, static_cast<int64_t>(_max_scan_concurrency));
+    static const char* const io_tier_prefixes[io::NUM_IO_TIERS] = {"PageCache", "LocalDisk", "Remote", "BlockCache"};
+    for (int i = 0; i < io::NUM_IO_TIERS; i++) {
+        _io_read_bytes_counters[i] =
+                ADD_COUNTER(_unique_metrics, strings::Substitute("$0ReadBytes", io_tier_prefixes[i]), TUnit::BYTES);
+        _io_read_timers[i] = ADD_TIMER(_unique_metrics, strings::Substitute("$0ReadTime", io_tier_prefixes[i]));
+    }
 
     if (_workgroup == nullptr) {
         DCHECK(_io_threads != nullptr);
@@ -62,11 +72,56 @@ Status ScanOperator::prepare(RuntimeState* state) {
         }
     }
 
+    if (state->query_ctx() != nullptr && state->query_ctx()->query_trace() != nullptr) {
+        auto* query_trace = state->query_ctx()->query_trace().get();
+        _trace_pid = query_trace->process_id(state->fragment_instance_id());
+        for (int i = 0; i < MAX_IO_TASKS_PER_OP; i++) {
+            query_trace->set_thread_name(_trace_pid, _trace_tid(i),
+                                         strings::Substitute("ScanIoTask (plan_node_id=$0, driver=$1, index=$2)",
+                                                             _plan_node_id, _driver_sequence, i));
+        }
+    }
+
     RETURN_IF_ERROR(do_prepare(state));
 
     return Status::OK();
 }
 
+int64_t ScanOperator::_trace_tid(int chunk_source_index) const {
+    // Above the driver ids, which are the thread ids of the drivers.
+    static constexpr int64_t kTidBase = 1L << 32;
+    return kTidBase + (static_cast<int64_t>(_plan_node_id) * 65536 + _driver_sequence) * MAX_IO_TASKS_PER_OP +
+           chunk_source_index;
+}
+
+void ScanOperator::_update_io_stats(QueryContext* query_ctx, const io::IOStats& io_stats) {
+    for (int i = 0; i < io::NUM_IO_TIERS; i++) {
+        COUNTER_UPDATE(_io_read_bytes_counters[i], io_stats.read_bytes[i]);
+        COUNTER_UPDATE(_io_read_timers[i], io_stats.read_ns[i]);
+    }
+    query_ctx->incr_io_stats(io_stats);
+}
+
+void ScanOperator::_set_thread_status(QueryContext* query_ctx, int64_t workgroup_id) {
+    // The io threads are shared by the queries, so the query and the operator tag the samples of CpuSampler.
+    tls_thread_status.set_query_id(query_ctx->query_id());
+    tls_thread_status.set_workgroup_id(workgroup_id);
+}
+
+void ScanOperator::_record_io_task(QueryContext* query_ctx, int chunk_source_index, int64_t submit_ns,
+                                  int64_t start_ns) {
+    const int64_t end_ns = MonotonicNanos();
+    StarRocksMetrics::instance()->scan_task_pending_time_us.observe((start_ns - submit_ns) / 1000);
+    StarRocksMetrics::instance()->scan_task_running_time_us.observe((end_ns - start_ns) / 1000);
+    auto* query_trace = query_ctx->query_trace().get();
+    if (query_trace == nullptr) {
+        return;
+    }
+    int64_t tid = _trace_tid(chunk_source_index);
+    query_trace->add_span("IO_TASK_PENDING", "scan", _trace_pid, tid, submit_ns, start_ns);
+    query_trace->add_span("IO_TASK_RUNNING", "scan", _trace_pid, tid, start_ns, end_ns);
+}
+
 void ScanOperator::close(RuntimeState* state) {
     if (_workgroup == nullptr) {
         state->exec_env()->decrement_num_scan_operators(1);
@@ -232,10 +287,14 @@ Status ScanOperator::_trigger_next_scan(RuntimeState* state, int chunk_source_in
         _query_ctx = state->exec_env()->query_context_mgr()->get(state->query_id());
     }
     if (_workgroup != nullptr) {
-        workgroup::ScanTask task = workgroup::ScanTask(_workgroup, [wp = _query_ctx, this, state,
-                                                                    chunk_source_index](int worker_id) {
+        workgroup::ScanTask task = workgroup::ScanTask(_workgroup, [wp = _query_ctx, this, state, chunk_source_index,
+                                                                    submit_ns = MonotonicNanos()](int worker_id) {
             if (auto sp = wp.lock()) {
+                int64_t start_ns = MonotonicNanos();
+                const io::IOStats io_stats_start = io::IOProfiler::thread_stats();
                 {
+                    _set_thread_status(sp.get(), _workgroup->id());
+                    CurrentThreadOperatorSetter operator_setter(_plan_node_id, _name.c_str());
                     SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(state->instance_mem_tracker());
                     size_t num_read_chunks = 0;
                     Status status = _chunk_sources[chunk_source_index]->buffer_next_batch_chunks_blocking_for_workgroup(
@@ -246,17 +305,25 @@ Status ScanOperator::_trigger_next_scan(RuntimeState* state, int chunk_source_in
                     // TODO (by laotan332): More detailed information is needed
                     _workgroup->incr_period_scaned_chunk_num(num_read_chunks);
                     _workgroup->increment_real_runtime_ns(_chunk_sources[chunk_source_index]->last_spent_cpu_time_ns());
+                    sp->incr_scan_time_ns(_chunk_sources[chunk_source_index]->last_spent_cpu_time_ns());
 
                     _last_growth_cpu_time_ns += _chunk_sources[chunk_source_index]->last_spent_cpu_time_ns();
                     _last_scan_rows_num += _chunk_sources[chunk_source_index]->last_scan_rows_num();
                     _last_scan_bytes += _chunk_sources[chunk_source_index]->last_scan_bytes();
                 }
+                _update_io_stats(sp.get(), io::IOProfiler::thread_stats() - io_stats_start);
+                _record_io_task(sp.get(), chunk_source_index, submit_ns, start_ns);
 
                 _decrease_committed_scan_tasks();
                 _num_running_io_tasks--;
                 _is_io_task_running[chunk_source_index] = false;
+                PollerNotifier::instance()->notify();
             }
         });
+        if (auto query_ctx = _query_ctx.lock()) {
+            task.query_scan_time_ns = query_ctx->scan_time_ns();
+            task.query_deadline_ns = query_ctx->query_deadline_ns();
+        }
 
         if (dynamic_cast<ConnectorScanOperator*>(this) != nullptr) {
             offer_task_success = ExecEnv::GetInstance()->hdfs_scan_executor()->submit(std::move(task));
@@ -265,9 +332,13 @@ Status ScanOperator::_trigger_next_scan(RuntimeState* state, int chunk_source_in
         }
     } else {
         PriorityThreadPool::Task task;
-        task.work_function = [wp = _query_ctx, this, state, chunk_source_index]() {
+        task.work_function = [wp = _query_ctx, this, state, chunk_source_index, submit_ns = MonotonicNanos()]() {
             if (auto sp = wp.lock()) {
+                int64_t start_ns = MonotonicNanos();
+                const io::IOStats io_stats_start = io::IOProfiler::thread_stats();
                 {
+                    _set_thread_status(sp.get(), -1);
+                    CurrentThreadOperatorSetter operator_setter(_plan_node_id, _name.c_str());
                     SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(state->instance_mem_tracker());
                     Status status =
                             _chunk_sources[chunk_source_index]->buffer_next_batch_chunks_blocking(_buffer_size, state);
@@ -277,15 +348,25 @@ Status ScanOperator::_trigger_next_scan(RuntimeState* state, int chunk_source_in
                     _last_growth_cpu_time_ns += _chunk_sources[chunk_source_index]->last_spent_cpu_time_ns();
                     _last_scan_rows_num += _chunk_sources[chunk_source_index]->last_scan_rows_num();
                     _last_scan_bytes += _chunk_sources[chunk_source_index]->last_scan_bytes();
+                    sp->incr_scan_time_ns(_chunk_sources[chunk_source_index]->last_spent_cpu_time_ns());
                 }
+                _update_io_stats(sp.get(), io::IOProfiler::thread_stats() - io_stats_start);
+                _record_io_task(sp.get(), chunk_source_index, submit_ns, start_ns);
 
                 _decrease_committed_scan_tasks();
                 _num_running_io_tasks--;
                 _is_io_task_running[chunk_source_index] = false;
+                PollerNotifier::instance()->notify();
             }
         };
         // TODO(by satanson): set a proper priority
         task.priority = 20;
+        if (config::pipeline_enable_priority_scan_task_queue) {
+            // Prefer the io tasks of the queries which have used less scan time, the same as PriorityScanTaskQueue.
+            if (auto query_ctx = _query_ctx.lock()) {
+                task.priority -= 2 * workgroup::PriorityScanTaskQueue::compute_level(query_ctx->scan_time_ns());
+            }
+        }
 
         offer_task_success = _io_threads->try_offer(task);
     }
@@ -387,10 +468,11 @@ pipeline::OpFactories decompose_scan_node_to_pipeline(std::shared_ptr<ScanOperat
 
     const auto* morsel_queue = context->morsel_queue_of_source_operator(scan_operator.get());
 
-    // ScanOperator's degree_of_parallelism is not more than the number of morsels
+    // ScanOperator's degree_of_parallelism is not more than the number of morsels and the max degree of parallelism
+    // of the morsel queue, which may be limited by the amount of data to read.
     // If table is empty, then morsel size is zero and we still set degree of parallelism to 1
-    const auto degree_of_parallelism =
-            std::min<size_t>(std::max<size_t>(1, morsel_queue->num_morsels()), context->degree_of_parallelism());
+    const auto degree_of_parallelism = std::min<size_t>(std::max<size_t>(1, morsel_queue->max_degree_of_parallelism()),
+                                                        context->degree_of_parallelism());
     scan_operator->set_degree_of_parallelism(degree_of_parallelism);
 
     ops.emplace_back(std::move(scan_operator));
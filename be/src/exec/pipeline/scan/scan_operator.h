@@ -4,6 +4,7 @@
 
 #include "exec/pipeline/source_operator.h"
 #include "exec/workgroup/work_group_fwd.h"
+#include "io/io_profiler.h"
 #include "util/spinlock.h"
 
 namespace starrocks {
@@ -68,6 +69,13 @@ private:
     Status _trigger_next_scan(RuntimeState* state, int chunk_source_index);
     Status _try_to_trigger_next_scan(RuntimeState* state);
     void _merge_chunk_source_profiles();
+    // The thread id in the query trace of the io tasks of the chunk source.
+    int64_t _trace_tid(int chunk_source_index) const;
+    void _set_thread_status(QueryContext* query_ctx, int64_t workgroup_id);
+    // Record the pending and running time of an io task in the metrics and the query trace.
+    void _record_io_task(QueryContext* query_ctx, int chunk_source_index, int64_t submit_ns, int64_t start_ns);
+    // Account the reads of an io task in the profile and the query context.
+    void _update_io_stats(QueryContext* query_ctx, const io::IOStats& io_stats);
 
     inline void _set_scan_status(const Status& status) {
         std::lock_guard<SpinLock> l(_scan_status_mutex);
@@ -118,6 +126,13 @@ private:
     workgroup::WorkGroupPtr _workgroup = nullptr;
     std::atomic_int64_t _last_scan_rows_num = 0;
     std::atomic_int64_t _last_scan_bytes = 0;
+
+    // The process id of the fragment instance in the query trace.
+    int64_t _trace_pid = 0;
+
+    // The bytes and time of the reads of each io tier.
+    RuntimeProfile::Counter* _io_read_bytes_counters[io::NUM_IO_TIERS] = {};
+    RuntimeProfile::Counter* _io_read_timers[io::NUM_IO_TIERS] = {};
 };
 
 class ScanOperatorFactory : public SourceOperatorFactory {
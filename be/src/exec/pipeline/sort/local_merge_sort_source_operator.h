@@ -13,7 +13,8 @@ class SortContext;
 
 /*
  * LocalMergeSortSourceOperator is used to merge multiple sorted datas from partion sort sink operator.
- * It is one instance and Execute in single threaded mode,  
+ * It is one instance and Execute in single threaded mode, unless config::enable_sort_parallel_merge splits
+ * the merge into key ranges, each of which is merged by one instance, and all are output by instance 0 in order.
  * It completely depends on SortContext with a heap to Dynamically filter out the smallest or largest data.
  */
 class LocalMergeSortSourceOperator final : public SourceOperator {
@@ -2,13 +2,16 @@
 
 #include "exec/pipeline/sort/local_partition_topn_context.h"
 
+#include <algorithm>
 #include <exec/vectorized/partition/chunks_partitioner.h>
 
+#include "common/config.h"
 #include "exec/vectorized/chunks_sorter_topn.h"
 
 namespace starrocks::pipeline {
 
 const int32_t LocalPartitionTopnContext::MAX_PARTITION_NUM = 4096;
+const int64_t LocalPartitionTopnContext::MAX_BUFFERED_CHUNKS = 64;
 
 LocalPartitionTopnContext::LocalPartitionTopnContext(
         const std::vector<TExpr>& t_partition_exprs, SortExecExprs& sort_exec_exprs, std::vector<bool> is_asc_order,
@@ -53,41 +56,65 @@ Status LocalPartitionTopnContext::prepare(RuntimeState* state) {
 
 Status LocalPartitionTopnContext::push_one_chunk_to_partitioner(RuntimeState* state,
                                                                 const vectorized::ChunkPtr& chunk) {
-    const auto num_partitions = _chunks_partitioner->num_partitions();
-    if (!_is_downgrade && num_partitions < MAX_PARTITION_NUM) {
-        return _chunks_partitioner->offer(chunk);
-    } else {
-        transfer_all_chunks_from_partitioner_to_sorters(state);
-        {
-            std::lock_guard<std::mutex> l(_buffer_lock);
-            _downgrade_buffer.push(chunk);
-        }
-        _is_downgrade = true;
+    if (_is_downgrade) {
+        std::lock_guard<std::mutex> l(_buffer_lock);
+        _downgrade_buffer.push(chunk);
         return Status::OK();
     }
+
+    RETURN_IF_ERROR(_chunks_partitioner->offer(chunk));
+    // The buffered chunks are moved to the sorters of their partitions from time to time, which keep at most
+    // partition_limit rows of each partition, so the memory is bounded by the partitions instead of the input.
+    if (_chunks_partitioner->num_buffered_rows() >= MAX_BUFFERED_CHUNKS * state->chunk_size()) {
+        RETURN_IF_ERROR(flush_partitioner_to_sorters(state));
+    }
+
+    // Too many partitions or too much memory kept by the sorters, pass through the following input instead
+    if (_chunks_partitioner->num_partitions() >= MAX_PARTITION_NUM ||
+        _sorters_mem_usage >= config::local_partition_topn_max_buffered_bytes) {
+        RETURN_IF_ERROR(transfer_all_chunks_from_partitioner_to_sorters(state));
+        _is_downgrade = true;
+    }
+    return Status::OK();
 }
 
 void LocalPartitionTopnContext::sink_complete() {
     _is_sink_complete = true;
 }
 
+Status LocalPartitionTopnContext::flush_partitioner_to_sorters(RuntimeState* state) {
+    _chunks_sorters.resize(std::max<size_t>(_chunks_sorters.size(), _chunks_partitioner->num_partitions()));
+    RETURN_IF_ERROR(_chunks_partitioner->consume_buffered_chunks(
+            [this, state](int32_t partition_idx, const vectorized::ChunkPtr& chunk) {
+                DCHECK_LT(partition_idx, _chunks_sorters.size());
+                auto& chunks_sorter = _chunks_sorters[partition_idx];
+                if (chunks_sorter == nullptr) {
+                    chunks_sorter = std::make_shared<vectorized::ChunksSorterTopn>(
+                            state, &_sort_exec_exprs.lhs_ordering_expr_ctxs(), &_is_asc_order, &_is_null_first,
+                            _sort_keys, _offset, _partition_limit, _topn_type,
+                            vectorized::ChunksSorterTopn::tunning_buffered_chunks(_partition_limit));
+                }
+                return chunks_sorter->update(state, chunk);
+            }));
+
+    _sorters_mem_usage = 0;
+    for (const auto& chunks_sorter : _chunks_sorters) {
+        if (chunks_sorter != nullptr) {
+            _sorters_mem_usage += chunks_sorter->mem_usage();
+        }
+    }
+    return Status::OK();
+}
+
 Status LocalPartitionTopnContext::transfer_all_chunks_from_partitioner_to_sorters(RuntimeState* state) {
     if (_is_transfered) {
         return Status::OK();
     }
-    const auto num_partitions = _chunks_partitioner->num_partitions();
-    _chunks_sorters.resize(num_partitions);
-    for (int i = 0; i < num_partitions; ++i) {
-        _chunks_sorters[i] = std::make_shared<vectorized::ChunksSorterTopn>(
-                state, &_sort_exec_exprs.lhs_ordering_expr_ctxs(), &_is_asc_order, &_is_null_first, _sort_keys, _offset,
-                _partition_limit, _topn_type, vectorized::ChunksSorterTopn::tunning_buffered_chunks(_partition_limit));
-    }
-    RETURN_IF_ERROR(
-            _chunks_partitioner->accept([this, state](int32_t partition_idx, const vectorized::ChunkPtr& chunk) {
-                _chunks_sorters[partition_idx]->update(state, chunk);
-                return true;
-            }));
+    RETURN_IF_ERROR(flush_partitioner_to_sorters(state));
 
+    // The partitions without any chunk have no sorter, e.g. the input rows of the serialized keys aren't buffered
+    auto it = std::remove(_chunks_sorters.begin(), _chunks_sorters.end(), nullptr);
+    _chunks_sorters.erase(it, _chunks_sorters.end());
     for (auto& chunks_sorter : _chunks_sorters) {
         RETURN_IF_ERROR(chunks_sorter->done(state));
     }
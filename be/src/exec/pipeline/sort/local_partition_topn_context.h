@@ -59,8 +59,14 @@ private:
     // The output chunk stream is unordered
     StatusOr<vectorized::ChunkPtr> pull_one_chunk_from_sorters();
 
+    // Move the chunks buffered in the partitioner to the sorters of their partitions, which discard the rows
+    // beyond partition_limit, and refresh the memory usage of the sorters
+    Status flush_partitioner_to_sorters(RuntimeState* state);
+
     // TODO(hcf) set this value properly, maybe based on cache size
     static const int32_t MAX_PARTITION_NUM;
+    // The chunks buffered in the partitioner are flushed to the sorters once they exceed this number of chunks
+    static const int64_t MAX_BUFFERED_CHUNKS;
 
     bool _is_downgrade = false;
     // We simply offer chunk to this buffer when number of partition reaches the threshould MAX_PARTITION_NUM
@@ -78,8 +84,9 @@ private:
     vectorized::ChunksPartitionerPtr _chunks_partitioner;
     bool _is_transfered = false;
 
-    // Every partition holds a chunks_sorter
+    // Every partition holds a chunks_sorter, indexed by the order in which the partition is created
     vectorized::ChunksSorters _chunks_sorters;
+    int64_t _sorters_mem_usage = 0;
     SortExecExprs _sort_exec_exprs;
     std::vector<bool> _is_asc_order;
     std::vector<bool> _is_null_first;
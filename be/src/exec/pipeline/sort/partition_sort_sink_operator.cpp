@@ -77,10 +77,13 @@ OperatorPtr PartitionSortSinkOperatorFactory::create(int32_t dop, int32_t driver
                     runtime_state(), &(_sort_exec_exprs.lhs_ordering_expr_ctxs()), &_is_asc_order, &_is_null_first,
                     _sort_keys, _offset, _limit, _topn_type, max_buffered_chunks);
         }
+        chunks_sorter->set_topn_runtime_filter(_topn_runtime_filter);
     } else {
-        chunks_sorter = std::make_unique<vectorized::ChunksSorterFullSort>(runtime_state(),
-                                                                           &(_sort_exec_exprs.lhs_ordering_expr_ctxs()),
-                                                                           &_is_asc_order, &_is_null_first, _sort_keys);
+        auto full_sorter = std::make_unique<vectorized::ChunksSorterFullSort>(
+                runtime_state(), &(_sort_exec_exprs.lhs_ordering_expr_ctxs()), &_is_asc_order, &_is_null_first,
+                _sort_keys);
+        full_sorter->enable_spill(_materialized_tuple_desc);
+        chunks_sorter = std::move(full_sorter);
     }
     auto sort_context = _sort_context_factory->create(driver_sequence);
 
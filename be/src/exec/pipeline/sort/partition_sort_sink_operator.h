@@ -112,6 +112,9 @@ public:
     Status prepare(RuntimeState* state) override;
     void close(RuntimeState* state) override;
 
+    // The top-n sorters of all the drivers publish their bounds to |filter|.
+    void set_topn_runtime_filter(vectorized::TopnRuntimeFilterPtr filter) { _topn_runtime_filter = std::move(filter); }
+
 private:
     std::shared_ptr<SortContextFactory> _sort_context_factory;
     // _sort_exec_exprs contains the ordering expressions
@@ -131,6 +134,7 @@ private:
     const RowDescriptor& _parent_node_row_desc;
     const RowDescriptor& _parent_node_child_row_desc;
     std::vector<ExprContext*> _analytic_partition_exprs;
+    vectorized::TopnRuntimeFilterPtr _topn_runtime_filter;
 };
 
 } // namespace pipeline
@@ -5,6 +5,7 @@
 #include "column/vectorized_fwd.h"
 #include "exec/vectorized/sorting/merge.h"
 #include "exec/vectorized/sorting/sorting.h"
+#include "runtime/chunk_cursor.h"
 
 namespace starrocks::pipeline {
 
@@ -12,49 +13,283 @@ using vectorized::Permutation;
 using vectorized::Columns;
 using vectorized::SortedRun;
 using vectorized::SortedRuns;
+using vectorized::ChunkProvider;
+using vectorized::ChunkUniquePtr;
+using vectorized::SimpleChunkSortCursor;
 
-StatusOr<ChunkPtr> SortContext::pull_chunk() {
-    if (!_is_merge_finish) {
-        _merge_inputs();
-        _is_merge_finish = true;
+bool SortContext::has_output(int32_t driver_sequence) const {
+    if (!is_partition_sort_finished() || is_output_finished(driver_sequence)) {
+        return false;
     }
-    if (_merged_runs.num_chunks() == 0) {
+    if (driver_sequence != 0 || !_is_prepared.load(std::memory_order_acquire) || _spill_merger != nullptr) {
+        return true;
+    }
+    // Wait for the driver which is merging the range to output.
+    return _output_range >= _num_used_ranges ||
+           _merge_range_states[_output_range].load(std::memory_order_acquire) != RANGE_MERGING;
+}
+
+bool SortContext::is_output_finished(int32_t driver_sequence) const {
+    if (!is_partition_sort_finished() || !_is_prepared.load(std::memory_order_acquire)) {
+        return false;
+    }
+    if (driver_sequence != 0) {
+        return static_cast<size_t>(driver_sequence) >= _num_used_ranges ||
+               _merge_range_states[driver_sequence].load(std::memory_order_acquire) != RANGE_PENDING;
+    }
+    if (_spill_merger != nullptr) {
+        return _spill_merger->is_eos() && _spill_output_run.empty();
+    }
+    return _output_range >= _num_used_ranges;
+}
+
+StatusOr<ChunkPtr> SortContext::pull_chunk(int32_t driver_sequence) {
+    if (!_is_prepared.load(std::memory_order_acquire)) {
+        std::lock_guard<std::mutex> l(_prepare_lock);
+        if (!_is_prepared.load(std::memory_order_relaxed)) {
+            _prepare_status = _prepare_merge();
+            _is_prepared.store(true, std::memory_order_release);
+        }
+    }
+    RETURN_IF_ERROR(_prepare_status);
+
+    if (driver_sequence != 0) {
+        if (static_cast<size_t>(driver_sequence) < _num_used_ranges) {
+            RETURN_IF_ERROR(_try_merge_range(driver_sequence));
+        }
         return nullptr;
     }
-    size_t required_rows = _state->chunk_size();
-    required_rows = std::min<size_t>(required_rows, _total_rows);
-    if (_limit > 0 && _topn_type == TTopNType::ROW_NUMBER) {
-        required_rows = std::min<size_t>(required_rows, _limit);
+
+    if (_spill_merger != nullptr) {
+        return _pull_spilled_chunk();
+    }
+    while (_output_range < _num_used_ranges) {
+        // Merge the range by driver 0 itself, if its driver hasn't started yet.
+        ASSIGN_OR_RETURN(bool is_merged, _try_merge_range(_output_range));
+        if (!is_merged) {
+            return nullptr;
+        }
+        SortedRuns& merged_runs = _merged_ranges[_output_range];
+        if (merged_runs.num_chunks() == 0) {
+            _output_range++;
+            continue;
+        }
+
+        size_t required_rows = _state->chunk_size();
+        required_rows = std::min<size_t>(required_rows, _total_rows);
+        if (_limit > 0 && _topn_type == TTopNType::ROW_NUMBER) {
+            required_rows = std::min<size_t>(required_rows, _limit);
+        }
+
+        SortedRun& run = merged_runs.front();
+        ChunkPtr res = run.steal_chunk(required_rows);
+        if (res != nullptr) {
+            RETURN_IF_ERROR(res->downgrade());
+        }
+
+        if (run.empty()) {
+            merged_runs.pop_front();
+        }
+        if (merged_runs.num_chunks() == 0) {
+            _output_range++;
+        }
+        return res;
+    }
+    return nullptr;
+}
+
+Status SortContext::_prepare_merge() {
+    for (auto& partition_sorter : _chunks_sorter_partions) {
+        if (partition_sorter->is_spilled()) {
+            return _init_spill_merger();
+        }
     }
 
-    SortedRun& run = _merged_runs.front();
-    ChunkPtr res = run.steal_chunk(required_rows);
-    if (res != nullptr) {
-        RETURN_IF_ERROR(res->downgrade());
+    std::vector<SortedRuns> partial_sorted_runs;
+    for (int i = 0; i < _num_partition_sinkers; ++i) {
+        auto& partition_sorter = _chunks_sorter_partions[i];
+        partial_sorted_runs.push_back(partition_sorter->get_sorted_runs());
     }
 
-    if (run.empty()) {
-        _merged_runs.pop_front();
+    // The ranges are only split when all the rows are kept, and each range has enough rows to merge.
+    const int64_t total_rows = _total_rows.load(std::memory_order_relaxed);
+    const int64_t min_split_rows = static_cast<int64_t>(_num_merge_ranges) * _state->chunk_size();
+    if (_num_merge_ranges > 1 && _limit < 0 && total_rows >= min_split_rows) {
+        _split_merge_ranges(partial_sorted_runs);
+    } else {
+        _merge_range_inputs.emplace_back(std::move(partial_sorted_runs));
     }
-    return res;
+    _num_used_ranges = _merge_range_inputs.size();
+    _merged_ranges.resize(_num_used_ranges);
+    return Status::OK();
 }
 
-Status SortContext::_merge_inputs() {
-    int64_t total_rows = _total_rows.load(std::memory_order_relaxed);
+// A row of the sorted runs, which is sampled as a splitter.
+struct SampledRow {
+    const SortedRun* run;
+    size_t row;
+};
+
+// The position of a row in SortedRuns, i.e. the index of the run and the index of the row in the chunk of the run.
+using RunsPosition = std::pair<size_t, size_t>;
+
+// Return the position of the first row which is greater than the splitter, from the position |from|.
+static RunsPosition upper_bound_of(const SortDescs& sort_desc, const SortedRuns& runs, const RunsPosition& from,
+                                   const SampledRow& splitter) {
+    for (size_t i = from.first; i < runs.num_chunks(); i++) {
+        const SortedRun& run = runs.chunks[i];
+        size_t low = (i == from.first) ? std::max(from.second, run.start_index()) : run.start_index();
+        size_t high = run.end_index();
+        if (low >= high || run.compare_row(sort_desc, *splitter.run, high - 1, splitter.row) <= 0) {
+            continue;
+        }
+        while (low < high) {
+            size_t mid = low + (high - low) / 2;
+            if (run.compare_row(sort_desc, *splitter.run, mid, splitter.row) <= 0) {
+                low = mid + 1;
+            } else {
+                high = mid;
+            }
+        }
+        return {i, low};
+    }
+    return {runs.num_chunks(), 0};
+}
+
+void SortContext::_split_merge_ranges(const std::vector<SortedRuns>& partial_sorted_runs) {
+    // Sample the rows evenly from each partial sorter, so the splitters are the quantiles of all the rows.
+    static constexpr size_t SAMPLES_PER_RANGE = 32;
+    const size_t num_samples_per_sorter = SAMPLES_PER_RANGE * _num_merge_ranges;
+    std::vector<SampledRow> samples;
+    for (const auto& runs : partial_sorted_runs) {
+        const size_t num_rows = runs.num_rows();
+        if (num_rows == 0) {
+            continue;
+        }
+        const size_t step = std::max<size_t>(1, num_rows / num_samples_per_sorter);
+        size_t next_sample = step / 2;
+        size_t offset = 0;
+        for (const auto& run : runs.chunks) {
+            while (next_sample < offset + run.num_rows()) {
+                samples.push_back({&run, run.start_index() + next_sample - offset});
+                next_sample += step;
+            }
+            offset += run.num_rows();
+        }
+    }
+    std::sort(samples.begin(), samples.end(), [this](const SampledRow& lhs, const SampledRow& rhs) {
+        return lhs.run->compare_row(_sort_desc, *rhs.run, lhs.row, rhs.row) < 0;
+    });
+
+    // The rows equal to a splitter are all put into the range before it, so the ranges don't intersect, and
+    // concatenating the merged ranges in order is the total order.
+    std::vector<RunsPosition> begins(partial_sorted_runs.size(), RunsPosition(0, 0));
+    _merge_range_inputs.resize(_num_merge_ranges);
+    for (int32_t range = 0; range < _num_merge_ranges; range++) {
+        const bool is_last_range = (range == _num_merge_ranges - 1);
+        const SampledRow* splitter = nullptr;
+        if (!is_last_range) {
+            splitter = &samples[samples.size() * (range + 1) / _num_merge_ranges];
+        }
+        for (size_t i = 0; i < partial_sorted_runs.size(); i++) {
+            const SortedRuns& runs = partial_sorted_runs[i];
+            RunsPosition end = is_last_range ? RunsPosition(runs.num_chunks(), 0)
+                                             : upper_bound_of(_sort_desc, runs, begins[i], *splitter);
+            SortedRuns slice;
+            for (size_t run_index = begins[i].first; run_index < runs.num_chunks() && run_index <= end.first;
+                 run_index++) {
+                const SortedRun& run = runs.chunks[run_index];
+                size_t slice_start = (run_index == begins[i].first) ? std::max(begins[i].second, run.start_index())
+                                                                     : run.start_index();
+                size_t slice_end = (run_index == end.first) ? end.second : run.end_index();
+                if (slice_start >= slice_end) {
+                    continue;
+                }
+                if (slice_start == 0 && slice_end == run.chunk->num_rows()) {
+                    slice.chunks.push_back(run);
+                } else {
+                    // The merge reads the whole chunk of each run, so the slice is copied.
+                    ChunkPtr chunk(SortedRun(run, slice_start, slice_end).clone_slice().release());
+                    slice.chunks.emplace_back(chunk, &_sort_exprs);
+                }
+            }
+            _merge_range_inputs[range].emplace_back(std::move(slice));
+            begins[i] = end;
+        }
+    }
+}
+
+StatusOr<bool> SortContext::_try_merge_range(size_t range) {
+    int32_t state = RANGE_PENDING;
+    if (!_merge_range_states[range].compare_exchange_strong(state, RANGE_MERGING, std::memory_order_acq_rel)) {
+        return state == RANGE_MERGED;
+    }
 
     // Keep all the data if topn type is RANK or DENSE_RANK
+    int64_t total_rows = _total_rows.load(std::memory_order_relaxed);
     int64_t require_rows = total_rows;
     if (_topn_type == TTopNType::ROW_NUMBER) {
         require_rows = ((_limit < 0) ? total_rows : std::min(_limit, total_rows));
     }
+    RETURN_IF_ERROR(merge_sorted_chunks(_sort_desc, &_sort_exprs, _merge_range_inputs[range], &_merged_ranges[range],
+                                        require_rows));
+    _merge_range_inputs[range].clear();
+    _merge_range_states[range].store(RANGE_MERGED, std::memory_order_release);
+    return true;
+}
 
-    std::vector<SortedRuns> partial_sorted_runs;
-    for (int i = 0; i < _num_partition_sinkers; ++i) {
-        auto& partition_sorter = _chunks_sorter_partions[i];
-        partial_sorted_runs.push_back(partition_sorter->get_sorted_runs());
+Status SortContext::_init_spill_merger() {
+    // Only the full sort spills, so all the rows are kept, and the output of each partial sorter is a sorted stream.
+    std::vector<std::unique_ptr<SimpleChunkSortCursor>> cursors;
+    cursors.reserve(_chunks_sorter_partions.size());
+    for (auto& partition_sorter : _chunks_sorter_partions) {
+        ChunksSorter* sorter = partition_sorter.get();
+        ChunkProvider provider = [this, sorter](ChunkUniquePtr* output, bool* eos) -> bool {
+            // The partial sorters are done.
+            if (output == nullptr || eos == nullptr) {
+                return true;
+            }
+            ChunkPtr chunk;
+            Status status = sorter->get_next(&chunk, eos);
+            if (!status.ok()) {
+                if (_spill_status.ok()) {
+                    _spill_status = status;
+                }
+                *eos = true;
+                return false;
+            }
+            if (chunk == nullptr) {
+                return false;
+            }
+            *output = std::make_unique<vectorized::Chunk>(std::move(*chunk));
+            return true;
+        };
+        cursors.emplace_back(std::make_unique<SimpleChunkSortCursor>(std::move(provider), &_sort_exprs));
     }
 
-    return merge_sorted_chunks(_sort_desc, &_sort_exprs, partial_sorted_runs, &_merged_runs, require_rows);
+    _spill_merger = std::make_unique<vectorized::MergeCursorsCascade>();
+    RETURN_IF_ERROR(_spill_merger->init(_sort_desc, std::move(cursors)));
+    // Mark all the cursors ready.
+    CHECK(_spill_merger->is_data_ready());
+    return Status::OK();
+}
+
+StatusOr<ChunkPtr> SortContext::_pull_spilled_chunk() {
+    // The merged chunks may be larger than chunk_size, so each of them is output in pieces.
+    while (_spill_output_run.empty() && !_spill_merger->is_eos()) {
+        ChunkUniquePtr merged = _spill_merger->try_get_next();
+        RETURN_IF_ERROR(_spill_status);
+        if (merged != nullptr && !merged->is_empty()) {
+            _spill_output_run = SortedRun(ChunkPtr(merged.release()), Columns());
+        }
+    }
+    RETURN_IF_ERROR(_spill_status);
+    if (_spill_output_run.empty()) {
+        return nullptr;
+    }
+    ChunkPtr res = _spill_output_run.steal_chunk(_state->chunk_size());
+    RETURN_IF_ERROR(res->downgrade());
+    return res;
 }
 
 SortContextFactory::SortContextFactory(RuntimeState* state, const TTopNType::type topn_type, bool is_merging,
@@ -77,7 +312,8 @@ SortContextPtr SortContextFactory::create(int32_t idx) {
     DCHECK_LE(actual_idx, _sort_contexts.size());
     if (!_sort_contexts[actual_idx]) {
         _sort_contexts[actual_idx] =
-                std::make_shared<SortContext>(_state, _topn_type, _limit, num_sinkers, _sort_exprs, _sort_descs);
+                std::make_shared<SortContext>(_state, _topn_type, _limit, num_sinkers, _sort_exprs, _sort_descs,
+                                              _is_merging ? _num_merge_ranges : 1);
     }
     return _sort_contexts[actual_idx];
 }
@@ -5,6 +5,8 @@
 #include <algorithm>
 #include <atomic>
 #include <memory>
+#include <mutex>
+#include <vector>
 
 #include "column/chunk.h"
 #include "column/vectorized_fwd.h"
@@ -26,13 +28,15 @@ class SortContext final : public ContextWithDependency {
 public:
     explicit SortContext(RuntimeState* state, const TTopNType::type topn_type, int64_t limit,
                          const int32_t num_right_sinkers, const std::vector<ExprContext*> sort_exprs,
-                         const SortDescs& sort_descs)
+                         const SortDescs& sort_descs, int32_t num_merge_ranges = 1)
             : _state(state),
               _topn_type(topn_type),
               _limit(limit),
               _num_partition_sinkers(num_right_sinkers),
               _sort_exprs(sort_exprs),
-              _sort_desc(sort_descs) {
+              _sort_desc(sort_descs),
+              _num_merge_ranges(std::max(1, num_merge_ranges)),
+              _merge_range_states(_num_merge_ranges) {
         _chunks_sorter_partions.reserve(num_right_sinkers);
     }
 
@@ -51,14 +55,25 @@ public:
         return _num_partition_finished.load(std::memory_order_acquire) == _num_partition_sinkers;
     }
 
-    bool is_output_finished() const {
-        return is_partition_sort_finished() && _is_merge_finish && _merged_runs.num_chunks() == 0;
-    }
+    // The merged rows are output by the source driver 0 in order. With multiple merge ranges, every other source
+    // driver only merges the range of its driver sequence, and outputs nothing.
+    bool has_output(int32_t driver_sequence) const;
+    bool is_output_finished(int32_t driver_sequence) const;
 
-    StatusOr<ChunkPtr> pull_chunk();
+    StatusOr<ChunkPtr> pull_chunk(int32_t driver_sequence);
 
 private:
-    Status _merge_inputs();
+    enum MergeRangeState : int32_t { RANGE_PENDING = 0, RANGE_MERGING = 1, RANGE_MERGED = 2 };
+
+    // Called once by the first source driver which pulls, after all the partial sorters are finished.
+    Status _prepare_merge();
+    // Split the sorted runs of the partial sorters into _merge_range_inputs, by the splitters sampled from them.
+    void _split_merge_ranges(const std::vector<SortedRuns>& partial_sorted_runs);
+    // Merge the range if no driver has claimed it yet. Return false if another driver is merging it.
+    StatusOr<bool> _try_merge_range(size_t range);
+    // Merge the outputs of the partial sorters as cursors, when any of them has spilled its sorted runs.
+    Status _init_spill_merger();
+    StatusOr<ChunkPtr> _pull_spilled_chunk();
 
     RuntimeState* _state;
     const TTopNType::type _topn_type;
@@ -71,9 +86,23 @@ private:
     std::atomic<int32_t> _num_partition_finished = 0;
 
     std::vector<std::shared_ptr<ChunksSorter>> _chunks_sorter_partions; // Partial sorters
-    bool _is_merge_finish = false;
 
-    SortedRuns _merged_runs;
+    // The merge is split into at most _num_merge_ranges key ranges, whose inputs are the slices of the sorted runs
+    // of all the partial sorters in the range. The number of the used ranges is decided by _prepare_merge(),
+    // which is 1 if the ranges aren't worth splitting.
+    const int32_t _num_merge_ranges;
+    std::mutex _prepare_lock;
+    std::atomic<bool> _is_prepared = false;
+    Status _prepare_status;
+    size_t _num_used_ranges = 0;
+    std::vector<std::vector<SortedRuns>> _merge_range_inputs;
+    std::vector<SortedRuns> _merged_ranges;
+    std::vector<std::atomic<int32_t>> _merge_range_states;
+    size_t _output_range = 0; // The range being output by driver 0
+
+    std::unique_ptr<vectorized::MergeCursorsCascade> _spill_merger;
+    vectorized::SortedRun _spill_output_run; // The merged chunk being output
+    Status _spill_status;                    // The first error of the partial sorters in the merger
 };
 
 class SortContextFactory {
@@ -84,6 +113,8 @@ public:
 
     SortContextPtr create(int32_t idx);
 
+    void set_num_merge_ranges(int32_t num_merge_ranges) { _num_merge_ranges = num_merge_ranges; }
+
 private:
     RuntimeState* _state;
     const TTopNType::type _topn_type;
@@ -97,6 +128,9 @@ private:
     const int32_t _num_right_sinkers;
     const std::vector<ExprContext*> _sort_exprs;
     const SortDescs _sort_descs;
+    // The number of the key ranges which the merge is split into, i.e. the degree of parallelism of
+    // LocalMergeSortSourceOperator, when _is_merging is true.
+    int32_t _num_merge_ranges = 1;
 };
 
 } // namespace starrocks::pipeline
@@ -265,27 +265,32 @@ Status NodeChannel::add_chunk(vectorized::Chunk* input, const int64_t* tablet_id
             _cur_request.add_tablet_ids(tablet_ids[indexes[from + i]]);
         }
 
-        if (_cur_chunk->num_rows() < _runtime_state->chunk_size()) {
+        const size_t chunk_bytes = _cur_chunk->bytes_usage();
+        const auto max_chunk_bytes = static_cast<size_t>(config::tablet_sink_max_chunk_bytes);
+        if (_cur_chunk->num_rows() < _runtime_state->chunk_size() && chunk_bytes < max_chunk_bytes) {
             // 2. chunk not full
             if (_chunk_queue.size() == 0) {
                 return Status::OK();
             }
             // passthrough: try to send data if queue not empty
+        } else if (chunk_bytes < max_chunk_bytes && _chunk_queue.empty() && !_check_prev_request_done()) {
+            // 3. keep batching the rows into the full chunk while all the requests are in flight
+            return Status::OK();
         } else {
-            // 3. chunk full push back to queue
+            // 4. chunk full push back to queue
             _mem_tracker->consume(_cur_chunk->memory_usage());
             _chunk_queue.emplace_back(std::move(_cur_chunk), _cur_request);
             _cur_chunk = input->clone_empty_with_slot();
             _cur_request.clear_tablet_ids();
         }
 
-        // 4. check last request
+        // 5. check last request
         if (!_check_prev_request_done()) {
             if (_chunk_queue.size() > _max_chunk_queue_size || _mem_tracker->limit()) {
-                // 4.1 wait if queue full
+                // 5.1 wait if queue full
                 RETURN_IF_ERROR(_wait_one_prev_request());
             } else {
-                // 4.2 noblock here so that channel cant send data
+                // 5.2 noblock here so that channel cant send data
                 return Status::OK();
             }
         }
@@ -14,6 +14,7 @@
 #include "exec/vectorized/aggregate/agg_hash_set.h"
 #include "gutil/casts.h"
 #include "gutil/strings/fastmem.h"
+#include "runtime/global_dict/config.h"
 #include "runtime/mem_pool.h"
 #include "util/fixed_hash_map.h"
 #include "util/hash_util.hpp"
@@ -30,6 +31,9 @@ using AggDataPtr = uint8_t*;
 // one level agg hash map
 template <PhmapSeed seed>
 using Int8AggHashMap = SmallFixedSizeHashMap<int8_t, AggDataPtr>;
+// The dictionary codes of a low-cardinality string column index the agg states directly, without hashing and probing.
+template <PhmapSeed seed>
+using DictCodeAggHashMap = SmallFixedSizeHashMap<int32_t, AggDataPtr, DICT_DECODE_MAX_SIZE + 1>;
 template <PhmapSeed seed>
 using Int16AggHashMap = phmap::flat_hash_map<int16_t, AggDataPtr, StdHashWithSeed<int16_t, seed>>;
 template <PhmapSeed seed>
@@ -54,6 +58,9 @@ using FixedSize8SliceAggHashMap = phmap::flat_hash_map<SliceKey8, AggDataPtr, Fi
 template <PhmapSeed seed>
 using FixedSize16SliceAggHashMap =
         phmap::flat_hash_map<SliceKey16, AggDataPtr, FixedSizeSliceKeyHash<SliceKey16, seed>>;
+template <PhmapSeed seed>
+using FixedSize32SliceAggHashMap =
+        phmap::flat_hash_map<SliceKey32, AggDataPtr, FixedSizeSliceKeyHash<SliceKey32, seed>>;
 
 // =====================
 // two level agg hash map
@@ -107,6 +114,9 @@ struct AggHashMapWithOneNumberKey {
 
     AggDataPtr get_null_key_data() { return nullptr; }
 
+    // The input sorted by the group by key, e.g. scanned from the tablets sorted by it, comes in runs of the same
+    // key, so the rows equal to the previous row share its agg state without probing the hash map.
+
     // prefetch branch better performance in case with larger hash tables
     template <typename THashMap, typename Func>
     static void compute_agg_prefetch(THashMap& hash_map, ColumnType* column, Buffer<AggDataPtr>* agg_states,
@@ -116,6 +126,10 @@ struct AggHashMapWithOneNumberKey {
             AGG_HASH_MAP_PREFETCH_HASH_VALUE();
 
             FieldType key = column->get_data()[i];
+            if (i > 0 && key == column->get_data()[i - 1]) {
+                (*agg_states)[i] = (*agg_states)[i - 1];
+                continue;
+            }
             auto iter = hash_map.lazy_emplace_with_hash(key, hash_values[i], [&](const auto& ctor) {
                 AggDataPtr pv = allocate_func();
                 ctor(key, pv);
@@ -131,6 +145,10 @@ struct AggHashMapWithOneNumberKey {
         size_t num_rows = column->size();
         for (size_t i = 0; i < num_rows; i++) {
             FieldType key = column->get_data()[i];
+            if (i > 0 && key == column->get_data()[i - 1]) {
+                (*agg_states)[i] = (*agg_states)[i - 1];
+                continue;
+            }
             auto iter = hash_map.lazy_emplace(key, [&](const auto& ctor) { ctor(key, allocate_func()); });
             (*agg_states)[i] = iter->second;
         }
@@ -320,6 +338,7 @@ struct AggHashMapWithOneStringKey {
 
     AggDataPtr get_null_key_data() { return nullptr; }
 
+    // Like AggHashMapWithOneNumberKey, the rows equal to the previous row share its agg state.
     template <typename THashMap, typename Func>
     static void compute_agg_prefetch(THashMap& hash_map, BinaryColumn* column, Buffer<AggDataPtr>* agg_states,
                                      MemPool* pool, Func&& allocate_func) {
@@ -327,6 +346,10 @@ struct AggHashMapWithOneStringKey {
         for (size_t i = 0; i < column_size; i++) {
             AGG_HASH_MAP_PREFETCH_HASH_VALUE();
             auto key = column->get_slice(i);
+            if (i > 0 && key == column->get_slice(i - 1)) {
+                (*agg_states)[i] = (*agg_states)[i - 1];
+                continue;
+            }
             auto iter = hash_map.lazy_emplace_with_hash(key, hash_values[i], [&](const auto& ctor) {
                 uint8_t* pos = pool->allocate(key.size);
                 strings::memcpy_inlined(pos, key.data, key.size);
@@ -344,6 +367,10 @@ struct AggHashMapWithOneStringKey {
         size_t num_rows = column->size();
         for (size_t i = 0; i < num_rows; i++) {
             auto key = column->get_slice(i);
+            if (i > 0 && key == column->get_slice(i - 1)) {
+                (*agg_states)[i] = (*agg_states)[i - 1];
+                continue;
+            }
             auto iter = hash_map.lazy_emplace(key, [&](const auto& ctor) {
                 uint8_t* pos = pool->allocate(key.size);
                 strings::memcpy_inlined(pos, key.data, key.size);
@@ -692,6 +719,11 @@ struct AggHashMapWithSerializedKeyFixedSize {
                 hash_map.prefetch_hash(caches[__prefetch_index++].hashval);
             }
             FixedSizeSliceKey& key = caches[i].key;
+            // Like AggHashMapWithOneNumberKey, the rows equal to the previous row share its agg state.
+            if (i > 0 && key == caches[i - 1].key) {
+                (*agg_states)[i] = (*agg_states)[i - 1];
+                continue;
+            }
             auto iter = hash_map.lazy_emplace_with_hash(key, caches[i].hashval, [&](const auto& ctor) {
                 AggDataPtr pv = allocate_func();
                 ctor(key, pv);
@@ -715,6 +747,10 @@ struct AggHashMapWithSerializedKeyFixedSize {
             }
         }
         for (size_t i = 0; i < chunk_size; ++i) {
+            if (i > 0 && key[i] == key[i - 1]) {
+                (*agg_states)[i] = (*agg_states)[i - 1];
+                continue;
+            }
             auto iter = hash_map.lazy_emplace(key[i], [&](const auto& ctor) { ctor(key[i], allocate_func()); });
             (*agg_states)[i] = iter->second;
         }
@@ -7,6 +7,7 @@
 #include "column/hash_set.h"
 #include "column/type_traits.h"
 #include "gutil/casts.h"
+#include "runtime/global_dict/config.h"
 #include "runtime/mem_pool.h"
 #include "runtime/runtime_state.h"
 #include "util/fixed_hash_map.h"
@@ -20,6 +21,8 @@ namespace starrocks::vectorized {
 template <PhmapSeed seed>
 using Int8AggHashSet = SmallFixedSizeHashSet<int8_t>;
 template <PhmapSeed seed>
+using DictCodeAggHashSet = SmallFixedSizeHashSet<int32_t, DICT_DECODE_MAX_SIZE + 1>;
+template <PhmapSeed seed>
 using Int16AggHashSet = phmap::flat_hash_set<int16_t, StdHashWithSeed<int16_t, seed>>;
 template <PhmapSeed seed>
 using Int32AggHashSet = phmap::flat_hash_set<int32_t, StdHashWithSeed<int32_t, seed>>;
@@ -43,6 +46,8 @@ template <PhmapSeed seed>
 using FixedSize8SliceAggHashSet = phmap::flat_hash_set<SliceKey8, FixedSizeSliceKeyHash<SliceKey8, seed>>;
 template <PhmapSeed seed>
 using FixedSize16SliceAggHashSet = phmap::flat_hash_set<SliceKey16, FixedSizeSliceKeyHash<SliceKey16, seed>>;
+template <PhmapSeed seed>
+using FixedSize32SliceAggHashSet = phmap::flat_hash_set<SliceKey32, FixedSizeSliceKeyHash<SliceKey32, seed>>;
 
 // =====================
 // two level agg hash set
@@ -16,6 +16,7 @@ namespace starrocks::vectorized {
     M(phase1_int8)                        \
     M(phase1_int16)                       \
     M(phase1_int32)                       \
+    M(phase1_dict_code)                   \
     M(phase1_int64)                       \
     M(phase1_int128)                      \
     M(phase1_decimal32)                   \
@@ -31,6 +32,7 @@ namespace starrocks::vectorized {
     M(phase2_int8)                        \
     M(phase2_int16)                       \
     M(phase2_int32)                       \
+    M(phase2_dict_code)                   \
     M(phase2_int64)                       \
     M(phase2_decimal32)                   \
     M(phase2_decimal64)                   \
@@ -45,15 +47,18 @@ namespace starrocks::vectorized {
     M(phase1_slice_fx4)                   \
     M(phase1_slice_fx8)                   \
     M(phase1_slice_fx16)                  \
+    M(phase1_slice_fx32)                  \
     M(phase2_slice_fx4)                   \
     M(phase2_slice_fx8)                   \
-    M(phase2_slice_fx16)
+    M(phase2_slice_fx16)                  \
+    M(phase2_slice_fx32)
 
 #define APPLY_FOR_AGG_VARIANT_NULL(M) \
     M(phase1_null_uint8)              \
     M(phase1_null_int8)               \
     M(phase1_null_int16)              \
     M(phase1_null_int32)              \
+    M(phase1_null_dict_code)          \
     M(phase1_null_int64)              \
     M(phase1_null_int128)             \
     M(phase1_null_decimal32)          \
@@ -66,6 +71,7 @@ namespace starrocks::vectorized {
     M(phase2_null_int8)               \
     M(phase2_null_int16)              \
     M(phase2_null_int32)              \
+    M(phase2_null_dict_code)          \
     M(phase2_null_int64)              \
     M(phase2_null_int128)             \
     M(phase2_null_decimal32)          \
@@ -80,6 +86,7 @@ namespace starrocks::vectorized {
     M(phase1_int8)                   \
     M(phase1_int16)                  \
     M(phase1_int32)                  \
+    M(phase1_dict_code)              \
     M(phase1_int64)                  \
     M(phase1_int128)                 \
     M(phase1_decimal32)              \
@@ -93,6 +100,7 @@ namespace starrocks::vectorized {
     M(phase1_null_int8)              \
     M(phase1_null_int16)             \
     M(phase1_null_int32)             \
+    M(phase1_null_dict_code)         \
     M(phase1_null_int64)             \
     M(phase1_null_int128)            \
     M(phase1_null_decimal32)         \
@@ -107,6 +115,7 @@ namespace starrocks::vectorized {
     M(phase2_int8)                   \
     M(phase2_int16)                  \
     M(phase2_int32)                  \
+    M(phase2_dict_code)              \
     M(phase2_int64)                  \
     M(phase2_int128)                 \
     M(phase2_decimal32)              \
@@ -120,6 +129,7 @@ namespace starrocks::vectorized {
     M(phase2_null_int8)              \
     M(phase2_null_int16)             \
     M(phase2_null_int32)             \
+    M(phase2_null_dict_code)         \
     M(phase2_null_int64)             \
     M(phase2_null_int128)            \
     M(phase2_null_decimal32)         \
@@ -133,9 +143,11 @@ namespace starrocks::vectorized {
     M(phase1_slice_fx4)              \
     M(phase1_slice_fx8)              \
     M(phase1_slice_fx16)             \
+    M(phase1_slice_fx32)             \
     M(phase2_slice_fx4)              \
     M(phase2_slice_fx8)              \
-    M(phase2_slice_fx16)
+    M(phase2_slice_fx16)             \
+    M(phase2_slice_fx32)
 
 // Hash maps for phase1
 template <PhmapSeed seed>
@@ -147,6 +159,8 @@ using Int16AggHashMapWithOneNumberKey = AggHashMapWithOneNumberKey<TYPE_SMALLINT
 template <PhmapSeed seed>
 using Int32AggHashMapWithOneNumberKey = AggHashMapWithOneNumberKey<TYPE_INT, Int32AggHashMap<seed>>;
 template <PhmapSeed seed>
+using DictCodeAggHashMapWithOneNumberKey = AggHashMapWithOneNumberKey<TYPE_INT, DictCodeAggHashMap<seed>>;
+template <PhmapSeed seed>
 using Int64AggHashMapWithOneNumberKey = AggHashMapWithOneNumberKey<TYPE_BIGINT, Int64AggHashMap<seed>>;
 template <PhmapSeed seed>
 using Int128AggHashMapWithOneNumberKey = AggHashMapWithOneNumberKey<TYPE_LARGEINT, Int128AggHashMap<seed>>;
@@ -171,6 +185,9 @@ using NullInt16AggHashMapWithOneNumberKey = AggHashMapWithOneNullableNumberKey<T
 template <PhmapSeed seed>
 using NullInt32AggHashMapWithOneNumberKey = AggHashMapWithOneNullableNumberKey<TYPE_INT, Int32AggHashMap<seed>>;
 template <PhmapSeed seed>
+using NullDictCodeAggHashMapWithOneNumberKey =
+        AggHashMapWithOneNullableNumberKey<TYPE_INT, DictCodeAggHashMap<seed>>;
+template <PhmapSeed seed>
 using NullInt64AggHashMapWithOneNumberKey = AggHashMapWithOneNullableNumberKey<TYPE_BIGINT, Int64AggHashMap<seed>>;
 template <PhmapSeed seed>
 using NullInt128AggHashMapWithOneNumberKey = AggHashMapWithOneNullableNumberKey<TYPE_LARGEINT, Int128AggHashMap<seed>>;
@@ -209,6 +226,8 @@ template <PhmapSeed seed>
 using SerializedKeyFixedSize8AggHashMap = AggHashMapWithSerializedKeyFixedSize<FixedSize8SliceAggHashMap<seed>>;
 template <PhmapSeed seed>
 using SerializedKeyFixedSize16AggHashMap = AggHashMapWithSerializedKeyFixedSize<FixedSize16SliceAggHashMap<seed>>;
+template <PhmapSeed seed>
+using SerializedKeyFixedSize32AggHashMap = AggHashMapWithSerializedKeyFixedSize<FixedSize32SliceAggHashMap<seed>>;
 
 // 1) For different group by columns type, size, cardinality, volume, we should choose different
 // hash functions and different hashmaps.
@@ -228,6 +247,7 @@ struct AggHashMapVariant {
         phase1_int8,
         phase1_int16,
         phase1_int32,
+        phase1_dict_code,
         phase1_int64,
         phase1_int128,
         phase1_decimal32,
@@ -240,6 +260,7 @@ struct AggHashMapVariant {
         phase1_null_int8,
         phase1_null_int16,
         phase1_null_int32,
+        phase1_null_dict_code,
         phase1_null_int64,
         phase1_null_int128,
         phase1_null_decimal32,
@@ -255,11 +276,13 @@ struct AggHashMapVariant {
         phase1_slice_fx4,
         phase1_slice_fx8,
         phase1_slice_fx16,
+        phase1_slice_fx32,
 
         phase2_uint8,
         phase2_int8,
         phase2_int16,
         phase2_int32,
+        phase2_dict_code,
         phase2_int64,
         phase2_int128,
         phase2_decimal32,
@@ -272,6 +295,7 @@ struct AggHashMapVariant {
         phase2_null_int8,
         phase2_null_int16,
         phase2_null_int32,
+        phase2_null_dict_code,
         phase2_null_int64,
         phase2_null_int128,
         phase2_null_decimal32,
@@ -287,6 +311,7 @@ struct AggHashMapVariant {
         phase2_slice_fx4,
         phase2_slice_fx8,
         phase2_slice_fx16,
+        phase2_slice_fx32,
     };
     Type type = Type::phase1_slice;
 
@@ -294,6 +319,7 @@ struct AggHashMapVariant {
     std::unique_ptr<Int8AggHashMapWithOneNumberKey<PhmapSeed1>> phase1_int8;
     std::unique_ptr<Int16AggHashMapWithOneNumberKey<PhmapSeed1>> phase1_int16;
     std::unique_ptr<Int32AggHashMapWithOneNumberKey<PhmapSeed1>> phase1_int32;
+    std::unique_ptr<DictCodeAggHashMapWithOneNumberKey<PhmapSeed1>> phase1_dict_code;
     std::unique_ptr<Int64AggHashMapWithOneNumberKey<PhmapSeed1>> phase1_int64;
     std::unique_ptr<Int128AggHashMapWithOneNumberKey<PhmapSeed1>> phase1_int128;
     std::unique_ptr<Decimal32AggHashMapWithOneNumberKey<PhmapSeed1>> phase1_decimal32;
@@ -308,6 +334,7 @@ struct AggHashMapVariant {
     std::unique_ptr<NullInt8AggHashMapWithOneNumberKey<PhmapSeed1>> phase1_null_int8;
     std::unique_ptr<NullInt16AggHashMapWithOneNumberKey<PhmapSeed1>> phase1_null_int16;
     std::unique_ptr<NullInt32AggHashMapWithOneNumberKey<PhmapSeed1>> phase1_null_int32;
+    std::unique_ptr<NullDictCodeAggHashMapWithOneNumberKey<PhmapSeed1>> phase1_null_dict_code;
     std::unique_ptr<NullInt64AggHashMapWithOneNumberKey<PhmapSeed1>> phase1_null_int64;
     std::unique_ptr<NullInt128AggHashMapWithOneNumberKey<PhmapSeed1>> phase1_null_int128;
 
@@ -325,11 +352,13 @@ struct AggHashMapVariant {
     std::unique_ptr<SerializedKeyFixedSize4AggHashMap<PhmapSeed1>> phase1_slice_fx4;
     std::unique_ptr<SerializedKeyFixedSize8AggHashMap<PhmapSeed1>> phase1_slice_fx8;
     std::unique_ptr<SerializedKeyFixedSize16AggHashMap<PhmapSeed1>> phase1_slice_fx16;
+    std::unique_ptr<SerializedKeyFixedSize32AggHashMap<PhmapSeed1>> phase1_slice_fx32;
 
     std::unique_ptr<UInt8AggHashMapWithOneNumberKey<PhmapSeed2>> phase2_uint8;
     std::unique_ptr<Int8AggHashMapWithOneNumberKey<PhmapSeed2>> phase2_int8;
     std::unique_ptr<Int16AggHashMapWithOneNumberKey<PhmapSeed2>> phase2_int16;
     std::unique_ptr<Int32AggHashMapWithOneNumberKey<PhmapSeed2>> phase2_int32;
+    std::unique_ptr<DictCodeAggHashMapWithOneNumberKey<PhmapSeed2>> phase2_dict_code;
     std::unique_ptr<Int64AggHashMapWithOneNumberKey<PhmapSeed2>> phase2_int64;
     std::unique_ptr<Int128AggHashMapWithOneNumberKey<PhmapSeed2>> phase2_int128;
 
@@ -344,6 +373,7 @@ struct AggHashMapVariant {
     std::unique_ptr<NullInt8AggHashMapWithOneNumberKey<PhmapSeed2>> phase2_null_int8;
     std::unique_ptr<NullInt16AggHashMapWithOneNumberKey<PhmapSeed2>> phase2_null_int16;
     std::unique_ptr<NullInt32AggHashMapWithOneNumberKey<PhmapSeed2>> phase2_null_int32;
+    std::unique_ptr<NullDictCodeAggHashMapWithOneNumberKey<PhmapSeed2>> phase2_null_dict_code;
     std::unique_ptr<NullInt64AggHashMapWithOneNumberKey<PhmapSeed2>> phase2_null_int64;
     std::unique_ptr<NullInt128AggHashMapWithOneNumberKey<PhmapSeed2>> phase2_null_int128;
 
@@ -361,6 +391,7 @@ struct AggHashMapVariant {
     std::unique_ptr<SerializedKeyFixedSize4AggHashMap<PhmapSeed2>> phase2_slice_fx4;
     std::unique_ptr<SerializedKeyFixedSize8AggHashMap<PhmapSeed2>> phase2_slice_fx8;
     std::unique_ptr<SerializedKeyFixedSize16AggHashMap<PhmapSeed2>> phase2_slice_fx16;
+    std::unique_ptr<SerializedKeyFixedSize32AggHashMap<PhmapSeed2>> phase2_slice_fx32;
 
     void init(RuntimeState* state, Type type_) {
         type = type_;
@@ -374,6 +405,13 @@ struct AggHashMapVariant {
         }
     }
 
+    // Release all the hash maps, including the single level one left by the conversion to a two level one.
+    void reset() {
+#define M(NAME) NAME.reset();
+        APPLY_FOR_AGG_VARIANT_ALL(M)
+#undef M
+    }
+
     size_t capacity() const {
         switch (type) {
 #define M(NAME)      \
@@ -424,6 +462,8 @@ using Int16AggHashSetOfOneNumberKey = AggHashSetOfOneNumberKey<TYPE_SMALLINT, In
 template <PhmapSeed seed>
 using Int32AggHashSetOfOneNumberKey = AggHashSetOfOneNumberKey<TYPE_INT, Int32AggHashSet<seed>>;
 template <PhmapSeed seed>
+using DictCodeAggHashSetOfOneNumberKey = AggHashSetOfOneNumberKey<TYPE_INT, DictCodeAggHashSet<seed>>;
+template <PhmapSeed seed>
 using Int64AggHashSetOfOneNumberKey = AggHashSetOfOneNumberKey<TYPE_BIGINT, Int64AggHashSet<seed>>;
 template <PhmapSeed seed>
 using Int128AggHashSetOfOneNumberKey = AggHashSetOfOneNumberKey<TYPE_LARGEINT, Int128AggHashSet<seed>>;
@@ -448,6 +488,9 @@ using NullInt16AggHashSetOfOneNumberKey = AggHashSetOfOneNullableNumberKey<TYPE_
 template <PhmapSeed seed>
 using NullInt32AggHashSetOfOneNumberKey = AggHashSetOfOneNullableNumberKey<TYPE_INT, Int32AggHashSet<seed>>;
 template <PhmapSeed seed>
+using NullDictCodeAggHashSetOfOneNumberKey =
+        AggHashSetOfOneNullableNumberKey<TYPE_INT, DictCodeAggHashSet<seed>>;
+template <PhmapSeed seed>
 using NullInt64AggHashSetOfOneNumberKey = AggHashSetOfOneNullableNumberKey<TYPE_BIGINT, Int64AggHashSet<seed>>;
 template <PhmapSeed seed>
 using NullInt128AggHashSetOfOneNumberKey = AggHashSetOfOneNullableNumberKey<TYPE_LARGEINT, Int128AggHashSet<seed>>;
@@ -487,6 +530,9 @@ using SerializedKeyAggHashSetFixedSize8 = AggHashSetOfSerializedKeyFixedSize<Fix
 template <PhmapSeed seed>
 using SerializedKeyAggHashSetFixedSize16 = AggHashSetOfSerializedKeyFixedSize<FixedSize16SliceAggHashSet<seed>>;
 
+template <PhmapSeed seed>
+using SerializedKeyAggHashSetFixedSize32 = AggHashSetOfSerializedKeyFixedSize<FixedSize32SliceAggHashSet<seed>>;
+
 // 1) AggHashSetVariant is alike HashMapVariant, while a set only holds keys, no associated value.
 //
 // 2) Distributed aggregation is divided into two stages.
@@ -501,6 +547,7 @@ struct AggHashSetVariant {
         phase1_int8,
         phase1_int16,
         phase1_int32,
+        phase1_dict_code,
         phase1_int64,
         phase1_int128,
         phase1_decimal32,
@@ -513,6 +560,7 @@ struct AggHashSetVariant {
         phase1_null_int8,
         phase1_null_int16,
         phase1_null_int32,
+        phase1_null_dict_code,
         phase1_null_int64,
         phase1_null_int128,
         phase1_null_decimal32,
@@ -528,6 +576,7 @@ struct AggHashSetVariant {
         phase2_int8,
         phase2_int16,
         phase2_int32,
+        phase2_dict_code,
         phase2_int64,
         phase2_int128,
         phase2_decimal32,
@@ -540,6 +589,7 @@ struct AggHashSetVariant {
         phase2_null_int8,
         phase2_null_int16,
         phase2_null_int32,
+        phase2_null_dict_code,
         phase2_null_int64,
         phase2_null_int128,
         phase2_null_decimal32,
@@ -555,9 +605,11 @@ struct AggHashSetVariant {
         phase1_slice_fx4,
         phase1_slice_fx8,
         phase1_slice_fx16,
+        phase1_slice_fx32,
         phase2_slice_fx4,
         phase2_slice_fx8,
         phase2_slice_fx16,
+        phase2_slice_fx32,
     };
     Type type = Type::phase1_slice;
 
@@ -565,6 +617,7 @@ struct AggHashSetVariant {
     std::unique_ptr<Int8AggHashSetOfOneNumberKey<PhmapSeed1>> phase1_int8;
     std::unique_ptr<Int16AggHashSetOfOneNumberKey<PhmapSeed1>> phase1_int16;
     std::unique_ptr<Int32AggHashSetOfOneNumberKey<PhmapSeed1>> phase1_int32;
+    std::unique_ptr<DictCodeAggHashSetOfOneNumberKey<PhmapSeed1>> phase1_dict_code;
     std::unique_ptr<Int64AggHashSetOfOneNumberKey<PhmapSeed1>> phase1_int64;
     std::unique_ptr<Int128AggHashSetOfOneNumberKey<PhmapSeed1>> phase1_int128;
 
@@ -580,6 +633,7 @@ struct AggHashSetVariant {
     std::unique_ptr<NullInt8AggHashSetOfOneNumberKey<PhmapSeed1>> phase1_null_int8;
     std::unique_ptr<NullInt16AggHashSetOfOneNumberKey<PhmapSeed1>> phase1_null_int16;
     std::unique_ptr<NullInt32AggHashSetOfOneNumberKey<PhmapSeed1>> phase1_null_int32;
+    std::unique_ptr<NullDictCodeAggHashSetOfOneNumberKey<PhmapSeed1>> phase1_null_dict_code;
     std::unique_ptr<NullInt64AggHashSetOfOneNumberKey<PhmapSeed1>> phase1_null_int64;
     std::unique_ptr<NullInt128AggHashSetOfOneNumberKey<PhmapSeed1>> phase1_null_int128;
 
@@ -599,6 +653,7 @@ struct AggHashSetVariant {
     std::unique_ptr<Int8AggHashSetOfOneNumberKey<PhmapSeed2>> phase2_int8;
     std::unique_ptr<Int16AggHashSetOfOneNumberKey<PhmapSeed2>> phase2_int16;
     std::unique_ptr<Int32AggHashSetOfOneNumberKey<PhmapSeed2>> phase2_int32;
+    std::unique_ptr<DictCodeAggHashSetOfOneNumberKey<PhmapSeed2>> phase2_dict_code;
     std::unique_ptr<Int64AggHashSetOfOneNumberKey<PhmapSeed2>> phase2_int64;
     std::unique_ptr<Int128AggHashSetOfOneNumberKey<PhmapSeed2>> phase2_int128;
 
@@ -614,6 +669,7 @@ struct AggHashSetVariant {
     std::unique_ptr<NullInt8AggHashSetOfOneNumberKey<PhmapSeed2>> phase2_null_int8;
     std::unique_ptr<NullInt16AggHashSetOfOneNumberKey<PhmapSeed2>> phase2_null_int16;
     std::unique_ptr<NullInt32AggHashSetOfOneNumberKey<PhmapSeed2>> phase2_null_int32;
+    std::unique_ptr<NullDictCodeAggHashSetOfOneNumberKey<PhmapSeed2>> phase2_null_dict_code;
     std::unique_ptr<NullInt64AggHashSetOfOneNumberKey<PhmapSeed2>> phase2_null_int64;
     std::unique_ptr<NullInt128AggHashSetOfOneNumberKey<PhmapSeed2>> phase2_null_int128;
 
@@ -632,9 +688,11 @@ struct AggHashSetVariant {
     std::unique_ptr<SerializedKeyAggHashSetFixedSize4<PhmapSeed1>> phase1_slice_fx4;
     std::unique_ptr<SerializedKeyAggHashSetFixedSize8<PhmapSeed1>> phase1_slice_fx8;
     std::unique_ptr<SerializedKeyAggHashSetFixedSize16<PhmapSeed1>> phase1_slice_fx16;
+    std::unique_ptr<SerializedKeyAggHashSetFixedSize32<PhmapSeed1>> phase1_slice_fx32;
     std::unique_ptr<SerializedKeyAggHashSetFixedSize4<PhmapSeed2>> phase2_slice_fx4;
     std::unique_ptr<SerializedKeyAggHashSetFixedSize8<PhmapSeed2>> phase2_slice_fx8;
     std::unique_ptr<SerializedKeyAggHashSetFixedSize16<PhmapSeed2>> phase2_slice_fx16;
+    std::unique_ptr<SerializedKeyAggHashSetFixedSize32<PhmapSeed2>> phase2_slice_fx32;
 
     void init(RuntimeState* state, Type type_) {
         type = type_;
@@ -2,6 +2,9 @@
 
 #include "exec/vectorized/aggregate/aggregate_blocking_node.h"
 
+#include <algorithm>
+
+#include "common/config.h"
 #include "exec/pipeline/aggregate/aggregate_blocking_sink_operator.h"
 #include "exec/pipeline/aggregate/aggregate_blocking_source_operator.h"
 #include "exec/pipeline/exchange/exchange_source_operator.h"
@@ -172,6 +175,7 @@ std::vector<std::shared_ptr<pipeline::OperatorFactory> > AggregateBlockingNode::
     using namespace pipeline;
     OpFactories operators_with_sink = _children[0]->decompose_to_pipeline(context);
     auto& agg_node = _tnode.agg_node;
+    bool parallel_merge = false;
     if (agg_node.need_finalize) {
         // If finalize aggregate with group by clause, then it can be paralized
         if (agg_node.__isset.grouping_exprs && !_tnode.agg_node.grouping_exprs.empty()) {
@@ -191,7 +195,13 @@ std::vector<std::shared_ptr<pipeline::OperatorFactory> > AggregateBlockingNode::
                     need_local_shuffle = false;
                 }
             }
-            if (need_local_shuffle) {
+            if (need_local_shuffle && _can_merge_in_parallel()) {
+                // Each aggregator aggregates the input rows of its own over all the keys, and the intermediate
+                // states are merged in parallel after sinking, instead of shuffling the input rows by the keys.
+                parallel_merge = true;
+                operators_with_sink = context->maybe_interpolate_local_passthrough_exchange(
+                        runtime_state(), operators_with_sink, context->degree_of_parallelism());
+            } else if (need_local_shuffle) {
                 std::vector<ExprContext*> group_by_expr_ctxs;
                 Expr::create_expr_trees(_pool, _tnode.agg_node.grouping_exprs, &group_by_expr_ctxs);
                 operators_with_sink = context->maybe_interpolate_local_shuffle_exchange(
@@ -209,6 +219,9 @@ std::vector<std::shared_ptr<pipeline::OperatorFactory> > AggregateBlockingNode::
 
     // shared by sink operator and source operator
     AggregatorFactoryPtr aggregator_factory = std::make_shared<AggregatorFactory>(_tnode);
+    if (parallel_merge && degree_of_parallelism > 1) {
+        aggregator_factory->enable_parallel_merge(degree_of_parallelism);
+    }
 
     // Create a shared RefCountedRuntimeFilterCollector
     auto&& rc_rf_probe_collector = std::make_shared<RcRfProbeCollector>(2, std::move(this->runtime_filter_collector()));
@@ -235,4 +248,20 @@ std::vector<std::shared_ptr<pipeline::OperatorFactory> > AggregateBlockingNode::
     return operators_with_source;
 }
 
+bool AggregateBlockingNode::_can_merge_in_parallel() const {
+    if (!config::pipeline_agg_parallel_merge) {
+        return false;
+    }
+    // The group by with limit stops inserting new keys into the hash map once it holds enough keys, which is only
+    // correct when the keys are partitioned among the aggregators.
+    if (limit() != -1) {
+        return false;
+    }
+    // The states of UDAF are serialized in JNI.
+    const auto& agg_fns = _tnode.agg_node.aggregate_functions;
+    return std::none_of(agg_fns.begin(), agg_fns.end(), [](const TExpr& expr) {
+        return expr.nodes[0].fn.binary_type == TFunctionBinaryType::SRJAR;
+    });
+}
+
 } // namespace starrocks::vectorized
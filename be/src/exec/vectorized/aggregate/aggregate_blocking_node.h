@@ -20,5 +20,9 @@ public:
 
     std::vector<std::shared_ptr<pipeline::OperatorFactory>> decompose_to_pipeline(
             pipeline::PipelineBuilderContext* context) override;
+
+private:
+    // Whether the aggregators of the pipeline can be finalized by AggregatorParallelMerger.
+    bool _can_merge_in_parallel() const;
 };
 } // namespace starrocks::vectorized
@@ -5,13 +5,19 @@
 #include <algorithm>
 
 #include "column/chunk.h"
+#include "common/config.h"
 #include "common/status.h"
 #include "exprs/anyval_util.h"
+#include "exprs/vectorized/column_ref.h"
 #include "gen_cpp/PlanNodes_types.h"
 #include "runtime/current_thread.h"
 #include "runtime/descriptors.h"
+#include "runtime/global_dict/config.h"
 #include "runtime/primitive_type.h"
+#include "storage/data_dir.h"
+#include "storage/storage_engine.h"
 #include "udf/java/utils.h"
+#include "util/hash_util.hpp"
 
 namespace starrocks {
 namespace vectorized {
@@ -78,6 +84,7 @@ Status Aggregator::open(RuntimeState* state) {
     } else {
         TRY_CATCH_BAD_ALLOC(_init_agg_hash_variant(_hash_map_variant));
     }
+    _is_spillable = _check_spillable(state);
 
     RETURN_IF_ERROR(check_has_error());
 
@@ -347,13 +354,6 @@ bool Aggregator::should_expand_preagg_hash_tables(size_t prev_row_returned, size
         return true;
     }
 
-    // Find the appropriate reduction factor in our table for the current hash table sizes.
-    int cache_level = 0;
-    while (cache_level + 1 < STREAMING_HT_MIN_REDUCTION_SIZE &&
-           ht_mem >= STREAMING_HT_MIN_REDUCTION[cache_level + 1].min_ht_mem) {
-        cache_level++;
-    }
-
     // Compare the number of rows in the hash table with the number of input rows that
     // were aggregated into it. Exclude passed through rows from this calculation since
     // they were not in hash tables.
@@ -370,8 +370,17 @@ bool Aggregator::should_expand_preagg_hash_tables(size_t prev_row_returned, size
     // set, N is the number of input rows, excluding passed-through rows, and n is the
     // number of rows inserted or merged into the hash tables. This is a very rough
     // approximation but is good enough to be useful.
-    double min_reduction = STREAMING_HT_MIN_REDUCTION[cache_level].streaming_ht_min_reduction;
-    return current_reduction > min_reduction;
+    return current_reduction > streaming_ht_min_reduction(ht_mem);
+}
+
+double Aggregator::streaming_ht_min_reduction(int64_t ht_mem) {
+    // Find the appropriate reduction factor in our table for the current hash table sizes.
+    int cache_level = 0;
+    while (cache_level + 1 < STREAMING_HT_MIN_REDUCTION_SIZE &&
+           ht_mem >= STREAMING_HT_MIN_REDUCTION[cache_level + 1].min_ht_mem) {
+        cache_level++;
+    }
+    return STREAMING_HT_MIN_REDUCTION[cache_level].streaming_ht_min_reduction;
 }
 
 void Aggregator::compute_single_agg_state(size_t chunk_size) {
@@ -568,6 +577,331 @@ void Aggregator::try_convert_to_two_level_set() {
     }
 }
 
+Status Aggregator::try_spill_hash_map(RuntimeState* state) {
+    if (!_is_spillable || _hash_map_variant.size() == 0 || !_exceeds_spill_mem_limit(state)) {
+        return Status::OK();
+    }
+
+    if (!_is_spilled) {
+        int num_partition_bits = 1;
+        while ((1 << num_partition_bits) < config::agg_spill_num_partitions &&
+               num_partition_bits < MAX_SPILL_PARTITION_BITS) {
+            num_partition_bits++;
+        }
+        _num_spill_partitions = 1 << num_partition_bits;
+        for (size_t i = 0; i < _num_spill_partitions; i++) {
+            // Spread the partitions over the storage paths.
+            const std::string& path = _spill_storage_paths[i % _spill_storage_paths.size()];
+            _spill_files.emplace_back(std::make_unique<vectorized::ChunkSpillFile>(path, "agg"));
+        }
+        _spill_buffer_chunks.assign(_num_spill_partitions, nullptr);
+        _spill_row_desc = std::make_unique<RowDescriptor>(_intermediate_tuple_desc, false);
+        _is_spilled = true;
+    }
+
+    RETURN_IF_ERROR(_serialize_hash_map([this](const vectorized::Columns& group_by_columns,
+                                               const vectorized::ChunkPtr& chunk) {
+        return _spill_intermediate_chunk(group_by_columns, chunk);
+    }));
+    // the memory is spilled to release it.
+    _reset_hash_map(true);
+    return Status::OK();
+}
+
+Status Aggregator::finish_spill(RuntimeState* state) {
+    if (!_is_spilled) {
+        return Status::OK();
+    }
+    RETURN_IF_ERROR(_serialize_hash_map([this](const vectorized::Columns& group_by_columns,
+                                               const vectorized::ChunkPtr& chunk) {
+        return _spill_intermediate_chunk(group_by_columns, chunk);
+    }));
+    for (size_t partition = 0; partition < _num_spill_partitions; partition++) {
+        RETURN_IF_ERROR(_flush_spill_partition(partition));
+        RETURN_IF_ERROR(_spill_files[partition]->flip_to_read());
+    }
+    _spill_buffer_chunks.clear();
+    COUNTER_SET(_spill_partition_counter, static_cast<int64_t>(_num_spill_partitions));
+    return load_next_spill_partition(state);
+}
+
+Status Aggregator::load_next_spill_partition(RuntimeState* state) {
+    while (_next_spill_partition < _num_spill_partitions) {
+        auto& file = _spill_files[_next_spill_partition++];
+        // the spilled partitions are of similar sizes, so their agg states reuse the chunks.
+        _reset_hash_map(false);
+        while (true) {
+            ASSIGN_OR_RETURN(vectorized::ChunkPtr chunk, file->read(*_spill_row_desc));
+            if (chunk == nullptr) {
+                break;
+            }
+            RETURN_IF_CANCELLED(state);
+            TRY_CATCH_BAD_ALLOC(_merge_intermediate_chunk(chunk));
+            RETURN_IF_ERROR(check_has_error());
+        }
+        // The agg states of the partition are in the hash map now.
+        file.reset();
+
+        if (_hash_map_variant.size() > 0) {
+            _reset_hash_map_iterator();
+            _is_ht_eos = false;
+            break;
+        }
+    }
+    return Status::OK();
+}
+
+Status Aggregator::partition_for_parallel_merge() {
+    DCHECK(_parallel_merger != nullptr);
+    const size_t num_partitions = _parallel_merger->num_partitions();
+    const size_t chunk_size = _state->chunk_size();
+    std::vector<vectorized::Chunks> partitions(num_partitions);
+    RETURN_IF_ERROR(_serialize_hash_map([&](const vectorized::Columns& group_by_columns,
+                                            const vectorized::ChunkPtr& chunk) {
+        _partition_rows(group_by_columns, chunk->num_rows(), num_partitions);
+        for (size_t partition = 0; partition < num_partitions; partition++) {
+            const auto& indexes = _partition_indexes[partition];
+            if (indexes.empty()) {
+                continue;
+            }
+            // The small partitioned chunks are merged, and are no larger than the chunk size.
+            auto& chunks = partitions[partition];
+            if (chunks.empty() || chunks.back()->num_rows() + indexes.size() > chunk_size) {
+                chunks.emplace_back(chunk->clone_empty_with_slot(chunk_size));
+            }
+            chunks.back()->append_selective(*chunk, indexes.data(), 0, indexes.size());
+        }
+        return Status::OK();
+    }));
+    // the partition merged into this aggregator reuses the chunks.
+    _reset_hash_map(false);
+    _parallel_merger->add_partitions(std::move(partitions));
+    return Status::OK();
+}
+
+Status Aggregator::parallel_merge(RuntimeState* state) {
+    DCHECK(_parallel_merger != nullptr && _parallel_merger->is_ready());
+    _is_parallel_merged = true;
+    vectorized::Chunks chunks = _parallel_merger->take_partition(_parallel_merge_partition);
+    for (auto& chunk : chunks) {
+        RETURN_IF_CANCELLED(state);
+        TRY_CATCH_BAD_ALLOC(_merge_intermediate_chunk(chunk));
+        RETURN_IF_ERROR(check_has_error());
+        chunk.reset();
+    }
+    COUNTER_SET(_hash_table_size, static_cast<int64_t>(_hash_map_variant.size()));
+    _reset_hash_map_iterator();
+    if (_hash_map_variant.size() == 0) {
+        _is_ht_eos = true;
+    }
+    return Status::OK();
+}
+
+bool Aggregator::_check_spillable(RuntimeState* state) {
+    if (!state->enable_spill() || config::agg_spill_mem_limit_percent <= 0) {
+        return false;
+    }
+    // The hash map is handed over to the parallel merger in memory after sinking.
+    if (_parallel_merger != nullptr) {
+        return false;
+    }
+    // The group by with limit stops inserting new keys into the hash map once it holds enough keys, and the states
+    // of UDAF are serialized in JNI, so neither of them is spilled.
+    if (_group_by_expr_ctxs.empty() || _is_only_group_by_columns || _limit != -1 || _has_udaf) {
+        return false;
+    }
+
+    StorageEngine* storage_engine = StorageEngine::instance();
+    if (storage_engine == nullptr) {
+        return false;
+    }
+    for (DataDir* store : storage_engine->get_stores()) {
+        _spill_storage_paths.emplace_back(store->path());
+    }
+    if (_spill_storage_paths.empty()) {
+        return false;
+    }
+    _spill_rows_counter = ADD_COUNTER(_runtime_profile, "SpillRows", TUnit::UNIT);
+    _spill_bytes_counter = ADD_COUNTER(_runtime_profile, "SpillBytes", TUnit::BYTES);
+    _spill_partition_counter = ADD_COUNTER(_runtime_profile, "SpillPartitions", TUnit::UNIT);
+    return true;
+}
+
+bool Aggregator::_exceeds_spill_mem_limit(RuntimeState* state) const {
+    return state->exceeds_spill_mem_limit(config::agg_spill_mem_limit_percent);
+}
+
+void Aggregator::_reset_hash_map(bool release_mem_pool) {
+    if (false) {
+    }
+#define HASH_MAP_METHOD(NAME)                                                     \
+    else if (_hash_map_variant.type == vectorized::AggHashMapVariant::Type::NAME) \
+            _release_agg_memory<decltype(_hash_map_variant.NAME)::element_type>(_hash_map_variant.NAME.get());
+    APPLY_FOR_AGG_VARIANT_ALL(HASH_MAP_METHOD)
+#undef HASH_MAP_METHOD
+
+    if (release_mem_pool) {
+        _mem_pool->free_all();
+    } else {
+        _mem_pool->clear();
+    }
+    _hash_map_variant.reset();
+    _init_agg_hash_variant(_hash_map_variant);
+    _mem_tracker->set(_hash_map_variant.memory_usage() + _mem_pool->total_reserved_bytes());
+}
+
+void Aggregator::_reset_hash_map_iterator() {
+    if (false) {
+    }
+#define HASH_MAP_METHOD(NAME)                                                     \
+    else if (_hash_map_variant.type == vectorized::AggHashMapVariant::Type::NAME) \
+            _it_hash = _hash_map_variant.NAME->hash_map.begin();
+    APPLY_FOR_AGG_VARIANT_ALL(HASH_MAP_METHOD)
+#undef HASH_MAP_METHOD
+}
+
+template <typename Consume>
+Status Aggregator::_serialize_hash_map(Consume&& consume) {
+    if (_hash_map_variant.size() == 0) {
+        return Status::OK();
+    }
+    if (false) {
+    }
+#define HASH_MAP_METHOD(NAME)                                                         \
+    else if (_hash_map_variant.type == vectorized::AggHashMapVariant::Type::NAME) {   \
+        using HashMapWithKey = decltype(_hash_map_variant.NAME)::element_type;        \
+        return _serialize_hash_map<HashMapWithKey>(*_hash_map_variant.NAME, consume); \
+    }
+    APPLY_FOR_AGG_VARIANT_ALL(HASH_MAP_METHOD)
+#undef HASH_MAP_METHOD
+    return Status::OK();
+}
+
+template <typename HashMapWithKey, typename Consume>
+Status Aggregator::_serialize_hash_map(HashMapWithKey& hash_map_with_key, Consume&& consume) {
+    const int32_t chunk_size = _state->chunk_size();
+    auto it = hash_map_with_key.hash_map.begin();
+    auto end = hash_map_with_key.hash_map.end();
+    hash_map_with_key.results.resize(chunk_size);
+    while (it != end) {
+        vectorized::Columns group_by_columns = _create_group_by_columns();
+        vectorized::Columns agg_intermediate_columns = _create_agg_intermediate_columns();
+        int32_t read_index = 0;
+        while (it != end && read_index < chunk_size) {
+            hash_map_with_key.results[read_index] = it->first;
+            _tmp_agg_states[read_index] = it->second;
+            ++read_index;
+            ++it;
+        }
+        hash_map_with_key.insert_keys_to_columns(hash_map_with_key.results, group_by_columns, read_index);
+        for (size_t i = 0; i < _agg_fn_ctxs.size(); i++) {
+            _agg_functions[i]->batch_serialize(_agg_fn_ctxs[i], read_index, _tmp_agg_states, _agg_states_offsets[i],
+                                               agg_intermediate_columns[i].get());
+        }
+        RETURN_IF_ERROR(
+                consume(group_by_columns, _create_intermediate_chunk(group_by_columns, agg_intermediate_columns)));
+    }
+
+    if constexpr (HashMapWithKey::has_single_null_key) {
+        if (hash_map_with_key.null_key_data != nullptr) {
+            vectorized::Columns group_by_columns = _create_group_by_columns();
+            vectorized::Columns agg_intermediate_columns = _create_agg_intermediate_columns();
+            DCHECK(group_by_columns.size() == 1);
+            DCHECK(group_by_columns[0]->is_nullable());
+            group_by_columns[0]->append_default();
+            _serialize_to_chunk(hash_map_with_key.null_key_data, agg_intermediate_columns);
+            RETURN_IF_ERROR(
+                    consume(group_by_columns, _create_intermediate_chunk(group_by_columns, agg_intermediate_columns)));
+        }
+    }
+    return Status::OK();
+}
+
+Status Aggregator::_spill_intermediate_chunk(const vectorized::Columns& group_by_columns,
+                                             const vectorized::ChunkPtr& chunk) {
+    _partition_rows(group_by_columns, chunk->num_rows(), _num_spill_partitions);
+
+    const size_t chunk_size = _state->chunk_size();
+    for (size_t partition = 0; partition < _num_spill_partitions; partition++) {
+        const auto& indexes = _partition_indexes[partition];
+        if (indexes.empty()) {
+            continue;
+        }
+        auto& buffer_chunk = _spill_buffer_chunks[partition];
+        // Keep the spilled chunks no larger than the chunk size, which the hash map is sized for when merging.
+        if (buffer_chunk != nullptr && buffer_chunk->num_rows() + indexes.size() > chunk_size) {
+            RETURN_IF_ERROR(_flush_spill_partition(partition));
+        }
+        if (buffer_chunk == nullptr) {
+            buffer_chunk = chunk->clone_empty_with_slot(chunk_size);
+        }
+        buffer_chunk->append_selective(*chunk, indexes.data(), 0, indexes.size());
+    }
+    return Status::OK();
+}
+
+void Aggregator::_partition_rows(const vectorized::Columns& group_by_columns, uint32_t num_rows,
+                                 size_t num_partitions) {
+    _partition_hash_values.assign(num_rows, HashUtil::FNV_SEED);
+    for (const vectorized::ColumnPtr& column : group_by_columns) {
+        column->fnv_hash(_partition_hash_values.data(), 0, num_rows);
+    }
+    _partition_indexes.resize(num_partitions);
+    for (auto& indexes : _partition_indexes) {
+        indexes.clear();
+    }
+    for (uint32_t i = 0; i < num_rows; i++) {
+        // The hash values are mixed by the golden ratio before being mapped to the partitions by the high bits,
+        // because the rows may have been shuffled to this aggregator by the same hash values modulo the number
+        // of instances.
+        const uint32_t hash = _partition_hash_values[i] * 0x9E3779B1U;
+        const size_t partition = (static_cast<uint64_t>(hash) * num_partitions) >> 32;
+        _partition_indexes[partition].emplace_back(i);
+    }
+}
+
+Status Aggregator::_flush_spill_partition(size_t partition) {
+    auto& buffer_chunk = _spill_buffer_chunks[partition];
+    if (buffer_chunk == nullptr || buffer_chunk->is_empty()) {
+        return Status::OK();
+    }
+    auto& file = _spill_files[partition];
+    const size_t num_bytes = file->num_bytes();
+    RETURN_IF_ERROR(file->write(*buffer_chunk));
+    COUNTER_UPDATE(_spill_rows_counter, buffer_chunk->num_rows());
+    COUNTER_UPDATE(_spill_bytes_counter, file->num_bytes() - num_bytes);
+    buffer_chunk.reset();
+    return Status::OK();
+}
+
+void Aggregator::_merge_intermediate_chunk(const vectorized::ChunkPtr& chunk) {
+    const size_t chunk_size = chunk->num_rows();
+    const size_t group_by_size = _group_by_columns.size();
+    for (size_t i = 0; i < group_by_size; i++) {
+        _group_by_columns[i] = chunk->get_column_by_slot_id(_intermediate_tuple_desc->slots()[i]->id());
+    }
+
+    if (false) {
+    }
+#define HASH_MAP_METHOD(NAME)                                                                                   \
+    else if (_hash_map_variant.type == vectorized::AggHashMapVariant::Type::NAME) {                             \
+        build_hash_map<decltype(_hash_map_variant.NAME)::element_type>(*_hash_map_variant.NAME, chunk_size);    \
+    }
+    APPLY_FOR_AGG_VARIANT_ALL(HASH_MAP_METHOD)
+#undef HASH_MAP_METHOD
+
+    for (size_t i = 0; i < _agg_fn_ctxs.size(); i++) {
+        const auto& column = chunk->get_column_by_slot_id(_intermediate_tuple_desc->slots()[group_by_size + i]->id());
+        _agg_functions[i]->merge_batch(_agg_fn_ctxs[i], chunk_size, _agg_states_offsets[i], column.get(),
+                                       _tmp_agg_states.data());
+    }
+    for (size_t i = 0; i < group_by_size; i++) {
+        _group_by_columns[i] = nullptr;
+    }
+    _mem_tracker->set(_hash_map_variant.memory_usage() + _mem_pool->total_reserved_bytes());
+    try_convert_to_two_level_map();
+}
+
 Status Aggregator::check_has_error() {
     for (const auto* ctx : _agg_fn_ctxs) {
         if (ctx->has_error()) {
@@ -592,15 +926,21 @@ vectorized::Columns Aggregator::_create_agg_result_columns() {
             agg_result_columns[i]->reserve(_state->chunk_size());
         }
     } else {
-        for (size_t i = 0; i < _agg_fn_types.size(); ++i) {
-            agg_result_columns[i] = vectorized::ColumnHelper::create_column(_agg_fn_types[i].serde_type,
-                                                                            _agg_fn_types[i].has_nullable_child);
-            agg_result_columns[i]->reserve(_state->chunk_size());
-        }
+        agg_result_columns = _create_agg_intermediate_columns();
     }
     return agg_result_columns;
 }
 
+vectorized::Columns Aggregator::_create_agg_intermediate_columns() {
+    vectorized::Columns agg_intermediate_columns(_agg_fn_types.size());
+    for (size_t i = 0; i < _agg_fn_types.size(); ++i) {
+        agg_intermediate_columns[i] = vectorized::ColumnHelper::create_column(_agg_fn_types[i].serde_type,
+                                                                              _agg_fn_types[i].has_nullable_child);
+        agg_intermediate_columns[i]->reserve(_state->chunk_size());
+    }
+    return agg_intermediate_columns;
+}
+
 vectorized::Columns Aggregator::_create_group_by_columns() {
     vectorized::Columns group_by_columns(_group_by_types.size());
     for (size_t i = 0; i < _group_by_types.size(); ++i) {
@@ -611,6 +951,19 @@ vectorized::Columns Aggregator::_create_group_by_columns() {
     return group_by_columns;
 }
 
+vectorized::ChunkPtr Aggregator::_create_intermediate_chunk(const vectorized::Columns& group_by_columns,
+                                                           const vectorized::Columns& agg_intermediate_columns) {
+    vectorized::ChunkPtr chunk = std::make_shared<vectorized::Chunk>();
+    for (size_t i = 0; i < group_by_columns.size(); i++) {
+        chunk->append_column(group_by_columns[i], _intermediate_tuple_desc->slots()[i]->id());
+    }
+    for (size_t i = 0; i < agg_intermediate_columns.size(); i++) {
+        size_t id = group_by_columns.size() + i;
+        chunk->append_column(agg_intermediate_columns[i], _intermediate_tuple_desc->slots()[id]->id());
+    }
+    return chunk;
+}
+
 void Aggregator::_serialize_to_chunk(vectorized::ConstAggDataPtr __restrict state,
                                      const vectorized::Columns& agg_result_columns) {
     for (size_t i = 0; i < _agg_fn_ctxs.size(); i++) {
@@ -710,6 +1063,25 @@ bool is_group_columns_fixed_size(std::vector<ExprContext*>& group_by_expr_ctxs,
     return true;
 }
 
+bool Aggregator::_is_group_by_dict_code() const {
+    if (!config::enable_agg_dict_code_hash_map || _group_by_expr_ctxs.size() != 1) {
+        return false;
+    }
+    const Expr* root = _group_by_expr_ctxs[0]->root();
+    if (!root->is_slotref() || root->type().type != vectorized::LowCardDictType) {
+        return false;
+    }
+    const auto& global_dicts = _state->get_query_global_dict_map();
+    auto iter = global_dicts.find(down_cast<const vectorized::ColumnRef*>(root)->slot_id());
+    if (iter == global_dicts.end()) {
+        return false;
+    }
+    const auto& rdict = iter->second.second;
+    return std::all_of(rdict.begin(), rdict.end(), [](const auto& entry) {
+        return entry.first >= 0 && entry.first <= vectorized::DICT_DECODE_MAX_SIZE;
+    });
+}
+
 #define CHECK_AGGR_PHASE_DEFAULT()                                                                                    \
     {                                                                                                                 \
         type = _aggr_phase == AggrPhase1 ? HashVariantType::Type::phase1_slice : HashVariantType::Type::phase2_slice; \
@@ -792,6 +1164,20 @@ void Aggregator::_init_agg_hash_variant(HashVariantType& hash_variant) {
         }
     }
 
+    // The dictionary codes index the agg states directly, without hashing and probing, and are decoded after
+    // the aggregation as before.
+    if (_is_group_by_dict_code()) {
+        if (type == HashVariantType::Type::phase1_int32) {
+            type = HashVariantType::Type::phase1_dict_code;
+        } else if (type == HashVariantType::Type::phase1_null_int32) {
+            type = HashVariantType::Type::phase1_null_dict_code;
+        } else if (type == HashVariantType::Type::phase2_int32) {
+            type = HashVariantType::Type::phase2_dict_code;
+        } else if (type == HashVariantType::Type::phase2_null_int32) {
+            type = HashVariantType::Type::phase2_null_dict_code;
+        }
+    }
+
     bool has_null_column = false;
     int fixed_byte_size = 0;
     // this optimization don't need to be limited to multi-column group by.
@@ -809,6 +1195,9 @@ void Aggregator::_init_agg_hash_variant(HashVariantType& hash_variant) {
             } else if (max_size < 16 || (!has_null_column && max_size == 16)) {
                 type = _aggr_phase == AggrPhase1 ? HashVariantType::Type::phase1_slice_fx16
                                                  : HashVariantType::Type::phase2_slice_fx16;
+            } else if (max_size < 32 || (!has_null_column && max_size == 32)) {
+                type = _aggr_phase == AggrPhase1 ? HashVariantType::Type::phase1_slice_fx32
+                                                 : HashVariantType::Type::phase2_slice_fx32;
             }
             if (!has_null_column) {
                 fixed_byte_size = max_size;
@@ -827,9 +1216,11 @@ void Aggregator::_init_agg_hash_variant(HashVariantType& hash_variant) {
     SET_FIXED_SLICE_HASH_MAP_FIELD(phase1_slice_fx4);
     SET_FIXED_SLICE_HASH_MAP_FIELD(phase1_slice_fx8);
     SET_FIXED_SLICE_HASH_MAP_FIELD(phase1_slice_fx16);
+    SET_FIXED_SLICE_HASH_MAP_FIELD(phase1_slice_fx32);
     SET_FIXED_SLICE_HASH_MAP_FIELD(phase2_slice_fx4);
     SET_FIXED_SLICE_HASH_MAP_FIELD(phase2_slice_fx8);
     SET_FIXED_SLICE_HASH_MAP_FIELD(phase2_slice_fx16);
+    SET_FIXED_SLICE_HASH_MAP_FIELD(phase2_slice_fx32);
 #undef SET_FIXED_SLICE_HASH_MAP_FIELD
 
 } // namespace starrocks
@@ -13,6 +13,7 @@
 #include "column/vectorized_fwd.h"
 #include "exec/pipeline/context_with_dependency.h"
 #include "exec/vectorized/aggregate/agg_hash_variant.h"
+#include "exec/vectorized/chunk_spill_file.h"
 #include "exprs/agg/aggregate_factory.h"
 #include "exprs/expr.h"
 #include "gutil/strings/substitute.h"
@@ -54,6 +55,47 @@ static const int STREAMING_HT_MIN_REDUCTION_SIZE =
 class Aggregator;
 using AggregatorPtr = std::shared_ptr<Aggregator>;
 
+// AggregatorParallelMerger finalizes the blocking aggregation with group by in parallel, without shuffling the input
+// rows to the aggregators by the group by keys. Each aggregator builds a private hash map over all the keys, and after
+// sinking partitions its intermediate agg states by the hash of the group by keys, one partition per aggregator.
+// Once all the aggregators have sunk, each aggregator merges its own partition of all the aggregators, so that
+// the merging scales with the number of aggregators.
+class AggregatorParallelMerger {
+public:
+    explicit AggregatorParallelMerger(size_t num_aggregators)
+            : _partitions(num_aggregators), _num_unfinished_aggregators(num_aggregators) {}
+
+    size_t num_partitions() const { return _partitions.size(); }
+
+    // Called by each aggregator once after sinking, with the intermediate chunks of each partition.
+    void add_partitions(std::vector<vectorized::Chunks>&& partitions) {
+        DCHECK_EQ(partitions.size(), _partitions.size());
+        {
+            std::lock_guard<std::mutex> l(_mutex);
+            for (size_t i = 0; i < partitions.size(); i++) {
+                _partitions[i].insert(_partitions[i].end(), std::make_move_iterator(partitions[i].begin()),
+                                      std::make_move_iterator(partitions[i].end()));
+            }
+        }
+        _num_unfinished_aggregators.fetch_sub(1, std::memory_order_acq_rel);
+    }
+
+    bool is_ready() const { return _num_unfinished_aggregators.load(std::memory_order_acquire) == 0; }
+
+    // Take the chunks of a partition, after all the aggregators have sunk.
+    vectorized::Chunks take_partition(size_t partition) {
+        DCHECK(is_ready());
+        std::lock_guard<std::mutex> l(_mutex);
+        return std::move(_partitions[partition]);
+    }
+
+private:
+    std::mutex _mutex;
+    std::vector<vectorized::Chunks> _partitions;
+    std::atomic<size_t> _num_unfinished_aggregators;
+};
+using AggregatorParallelMergerPtr = std::shared_ptr<AggregatorParallelMerger>;
+
 // Component used to process aggregation including bloking aggregate and streaming aggregate
 // it contains common data struct and algorithm of aggregation
 class Aggregator final : public pipeline::ContextWithDependency {
@@ -82,6 +124,10 @@ public:
     bool is_ht_eos() { return _is_ht_eos; }
     void set_ht_eos() { _is_ht_eos = true; }
     bool is_sink_complete() { return _is_sink_complete.load(std::memory_order_acquire); }
+    // The hash map can be output after sinking, and after all the aggregators have sunk in case of parallel merge.
+    bool is_output_ready() {
+        return is_sink_complete() && (_parallel_merger == nullptr || _parallel_merger->is_ready());
+    }
     int64_t num_input_rows() { return _num_input_rows; }
     int64_t num_rows_returned() { return _num_rows_returned; }
     void update_num_rows_returned(int64_t increment) { _num_rows_returned += increment; };
@@ -111,6 +157,8 @@ public:
 
     bool should_expand_preagg_hash_tables(size_t prev_row_returned, size_t input_chunk_size, int64_t ht_mem,
                                           int64_t ht_rows) const;
+    // The minimum reduction for the streaming pre-aggregation to pay off, with a hash table of |ht_mem| bytes.
+    static double streaming_ht_min_reduction(int64_t ht_mem);
 
     // For aggregate without group by
     void compute_single_agg_state(size_t chunk_size);
@@ -142,6 +190,32 @@ public:
 
     Status check_has_error();
 
+    // Spilling of the blocking aggregation with group by. When the memory of the query exceeds
+    // config::agg_spill_mem_limit_percent of its limit, the intermediate agg states of the hash map are serialized
+    // and spilled to the partitions by the hash of the group by keys, and the hash map is reset.
+    // After sinking, the partitions are loaded and merged into the hash map one by one.
+    bool is_spilled() const { return _is_spilled; }
+    // Spill the hash map if it's spillable and the memory of the query exceeds the limit.
+    Status try_spill_hash_map(RuntimeState* state);
+    // Called after sinking. Spill the rest of the hash map and load the first non-empty partition.
+    Status finish_spill(RuntimeState* state);
+    // Load the next non-empty partition into the hash map after the current one is output, and make the iterator
+    // point to its beginning. The hash map is left at eos if there is no more partition.
+    Status load_next_spill_partition(RuntimeState* state);
+
+    // Parallel merge, see AggregatorParallelMerger. The aggregator merges the partition of its index.
+    void set_parallel_merger(AggregatorParallelMergerPtr parallel_merger, size_t partition) {
+        _parallel_merger = std::move(parallel_merger);
+        _parallel_merge_partition = partition;
+    }
+    bool has_parallel_merger() const { return _parallel_merger != nullptr; }
+    // Called after sinking. Partition the agg states of the hash map, and hand them over to the parallel merger.
+    Status partition_for_parallel_merge();
+    bool needs_parallel_merge() const { return _parallel_merger != nullptr && !_is_parallel_merged; }
+    // Called once all the aggregators have sunk. Merge the partition of this aggregator into the hash map, and make
+    // the iterator point to its beginning.
+    Status parallel_merge(RuntimeState* state);
+
 #ifdef NDEBUG
     static constexpr size_t two_level_memory_threshold = 33554432; // 32M, L3 Cache
     static constexpr size_t streaming_hash_table_size_threshold = 10000000;
@@ -255,6 +329,29 @@ private:
     RuntimeProfile::Counter* _expr_compute_timer{};
     RuntimeProfile::Counter* _expr_release_timer{};
 
+    static constexpr int MAX_SPILL_PARTITION_BITS = 10;
+    bool _is_spillable = false;
+    bool _is_spilled = false;
+    std::vector<std::string> _spill_storage_paths;
+    size_t _num_spill_partitions = 0;
+    // The next partition to be loaded into the hash map after sinking.
+    size_t _next_spill_partition = 0;
+    std::vector<std::unique_ptr<vectorized::ChunkSpillFile>> _spill_files;
+    // The small partitioned chunks are merged before being written to the files.
+    std::vector<vectorized::ChunkPtr> _spill_buffer_chunks;
+    // The row indexes of each partition, used by both spilling and parallel merge.
+    std::vector<uint32_t> _partition_hash_values;
+    std::vector<std::vector<uint32_t>> _partition_indexes;
+    // The spilled chunks are in the layout of the intermediate tuple.
+    std::unique_ptr<RowDescriptor> _spill_row_desc;
+    RuntimeProfile::Counter* _spill_rows_counter{};
+    RuntimeProfile::Counter* _spill_bytes_counter{};
+    RuntimeProfile::Counter* _spill_partition_counter{};
+
+    AggregatorParallelMergerPtr _parallel_merger;
+    size_t _parallel_merge_partition = 0;
+    bool _is_parallel_merged = false;
+
 public:
     template <typename HashMapWithKey>
     void build_hash_map(HashMapWithKey& hash_map_with_key, size_t chunk_size, bool agg_group_by_with_limit = false) {
@@ -465,7 +562,10 @@ private:
 
     // Create new aggregate function result column by type
     vectorized::Columns _create_agg_result_columns();
+    vectorized::Columns _create_agg_intermediate_columns();
     vectorized::Columns _create_group_by_columns();
+    vectorized::ChunkPtr _create_intermediate_chunk(const vectorized::Columns& group_by_columns,
+                                                    const vectorized::Columns& agg_intermediate_columns);
 
     void _serialize_to_chunk(vectorized::ConstAggDataPtr __restrict state,
                              const vectorized::Columns& agg_result_columns);
@@ -475,6 +575,29 @@ private:
     void _reset_exprs(vectorized::Chunk* chunk);
     Status _evaluate_exprs(vectorized::Chunk* chunk);
 
+    bool _check_spillable(RuntimeState* state);
+    bool _exceeds_spill_mem_limit(RuntimeState* state) const;
+    // Destroy the agg states and empty the hash map. The chunks of the mem pool are freed if |release_mem_pool|,
+    // otherwise they are kept for the agg states of the next round, which saves allocating them chunk by chunk again.
+    void _reset_hash_map(bool release_mem_pool);
+    void _reset_hash_map_iterator();
+    // Serialize the agg states of the hash map into the chunks of the intermediate tuple, and call
+    // `consume(group_by_columns, chunk)` for each of them.
+    template <typename Consume>
+    Status _serialize_hash_map(Consume&& consume);
+    template <typename HashMapWithKey, typename Consume>
+    Status _serialize_hash_map(HashMapWithKey& hash_map_with_key, Consume&& consume);
+    // Split the rows into the partitions by the hash of the group by keys, and output the row indexes of
+    // each partition to _partition_indexes.
+    void _partition_rows(const vectorized::Columns& group_by_columns, uint32_t num_rows, size_t num_partitions);
+    Status _spill_intermediate_chunk(const vectorized::Columns& group_by_columns, const vectorized::ChunkPtr& chunk);
+    Status _flush_spill_partition(size_t partition);
+    // Merge the intermediate agg states of a chunk into the hash map.
+    void _merge_intermediate_chunk(const vectorized::ChunkPtr& chunk);
+
+    // Whether the only group by column holds the codes of a global dictionary, which are small enough to index the
+    // agg states directly.
+    bool _is_group_by_dict_code() const;
     // Choose different agg hash map/set by different group by column's count, type, nullable
     template <typename HashVariantType>
     void _init_agg_hash_variant(HashVariantType& hash_variant);
@@ -508,12 +631,20 @@ class AggregatorFactory {
 public:
     AggregatorFactory(const TPlanNode& tnode) : _tnode(tnode) {}
 
+    // The aggregators are finalized in parallel, see AggregatorParallelMerger.
+    void enable_parallel_merge(size_t num_aggregators) {
+        _parallel_merger = std::make_shared<AggregatorParallelMerger>(num_aggregators);
+    }
+
     AggregatorPtr get_or_create(size_t id) {
         auto it = _aggregators.find(id);
         if (it != _aggregators.end()) {
             return it->second;
         }
         auto aggregator = std::make_shared<Aggregator>(_tnode);
+        if (_parallel_merger != nullptr) {
+            aggregator->set_parallel_merger(_parallel_merger, id);
+        }
         _aggregators[id] = aggregator;
         return aggregator;
     }
@@ -521,6 +652,7 @@ public:
 private:
     const TPlanNode& _tnode;
     std::unordered_map<size_t, AggregatorPtr> _aggregators;
+    AggregatorParallelMergerPtr _parallel_merger;
 };
 
 } // namespace starrocks
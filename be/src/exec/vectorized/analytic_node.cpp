@@ -7,6 +7,7 @@
 #include <memory>
 
 #include "column/chunk.h"
+#include "common/config.h"
 #include "exec/pipeline/analysis/analytic_sink_operator.h"
 #include "exec/pipeline/analysis/analytic_source_operator.h"
 #include "exec/pipeline/limit_operator.h"
@@ -52,6 +53,7 @@ AnalyticNode::AnalyticNode(ObjectPool* pool, const TPlanNode& tnode, const Descr
 Status AnalyticNode::init(const TPlanNode& tnode, RuntimeState* state) {
     RETURN_IF_ERROR(ExecNode::init(tnode, state));
     DCHECK(_conjunct_ctxs.empty());
+    RETURN_IF_ERROR(Expr::create_expr_trees(_pool, tnode.analytic_node.partition_exprs, &_partition_expr_ctxs));
 
     return Status::OK();
 }
@@ -223,10 +225,7 @@ Status AnalyticNode::_get_next_for_sliding_frame(RuntimeState* state, ChunkPtr*
 
         while (_analytor->current_row_position() < _analytor->partition_end() &&
                _analytor->window_result_position() < chunk_size) {
-            _analytor->reset_window_state();
-            FrameRange range = _analytor->get_sliding_frame_range();
-            _analytor->update_window_batch(_analytor->partition_start(), _analytor->partition_end(), range.start,
-                                           range.end);
+            _analytor->update_sliding_frame(_analytor->get_sliding_frame_range());
             _analytor->update_window_result_position(1);
             int64_t result_start = _analytor->get_total_position(_analytor->current_row_position()) -
                                    _analytor->input_chunk_first_row_positions()[_analytor->output_chunk_index()];
@@ -348,6 +347,16 @@ std::vector<std::shared_ptr<pipeline::OperatorFactory> > AnalyticNode::decompose
     if (_tnode.analytic_node.partition_exprs.empty()) {
         operators_with_sink =
                 context->maybe_interpolate_local_passthrough_exchange(runtime_state(), operators_with_sink);
+    } else if (down_cast<SourceOperatorFactory*>(operators_with_sink[0].get())->degree_of_parallelism() == 1 &&
+               config::enable_analytic_local_shuffle) {
+        // The sorted input is output by a single driver, e.g. a merging sort or exchange. Each partition is sent to
+        // a single driver in the original order, so the partitions can be evaluated by all the drivers in parallel.
+        bool can_shuffle = std::all_of(_partition_expr_ctxs.begin(), _partition_expr_ctxs.end(),
+                                       [](ExprContext* ctx) { return ctx->root()->type().support_groupby(); });
+        if (can_shuffle) {
+            operators_with_sink = context->maybe_interpolate_local_shuffle_exchange(
+                    runtime_state(), operators_with_sink, _partition_expr_ctxs);
+        }
     }
     auto degree_of_parallelism =
             down_cast<SourceOperatorFactory*>(operators_with_sink[0].get())->degree_of_parallelism();
@@ -360,7 +369,8 @@ std::vector<std::shared_ptr<pipeline::OperatorFactory> > AnalyticNode::decompose
     auto&& rc_rf_probe_collector = std::make_shared<RcRfProbeCollector>(2, std::move(this->runtime_filter_collector()));
 
     operators_with_sink.emplace_back(
-            std::make_shared<AnalyticSinkOperatorFactory>(context->next_operator_id(), id(), _tnode, analytor_factory));
+            std::make_shared<AnalyticSinkOperatorFactory>(context->next_operator_id(), id(), _tnode, analytor_factory,
+                                                          _partition_expr_ctxs));
     // Initialize OperatorFactory's fields involving runtime filters.
     this->init_runtime_filter_for_operator(operators_with_sink.back().get(), context, rc_rf_probe_collector);
     context->add_pipeline(operators_with_sink);
@@ -377,11 +377,47 @@ void Analytor::update_window_batch(int64_t peer_group_start, int64_t peer_group_
     }
 }
 
+void Analytor::update_sliding_frame(const FrameRange& range) {
+    // The frame_start and frame_end of lead and lag are not the rows to be aggregated.
+    if (_has_lead_lag_function) {
+        reset_window_state();
+        _update_window_batch_lead_lag(_partition_start, _partition_end, range.start, range.end);
+        return;
+    }
+
+    int64_t frame_start = std::max<int64_t>(range.start, _partition_start);
+    int64_t frame_end = std::min<int64_t>(range.end, _found_partition_end);
+    // Both bounds of the frame only move forward in a partition, so the state can be slid if the new frame
+    // overlaps or follows the previous one.
+    bool is_slidable = _sliding_frame_start < _sliding_frame_end && frame_start < frame_end &&
+                       _sliding_frame_start <= frame_start && frame_start <= _sliding_frame_end &&
+                       _sliding_frame_end <= frame_end;
+    for (size_t i = 0; i < _agg_fn_ctxs.size(); i++) {
+        const vectorized::Column* agg_column = _agg_intput_columns[i][0].get();
+        vectorized::AggDataPtr state = _managed_fn_states[0]->mutable_data() + _agg_states_offsets[i];
+        if (is_slidable && _agg_functions[i]->is_removable()) {
+            _agg_functions[i]->update_batch_single_state(_agg_fn_ctxs[i], state, &agg_column, _partition_start,
+                                                         _partition_end, _sliding_frame_end, frame_end);
+            if (_agg_functions[i]->remove_batch_single_state(_agg_fn_ctxs[i], state, &agg_column,
+                                                             _sliding_frame_start, frame_start, frame_end)) {
+                continue;
+            }
+        }
+        _agg_functions[i]->reset(_agg_fn_ctxs[i], _agg_intput_columns[i], state);
+        _agg_functions[i]->update_batch_single_state(_agg_fn_ctxs[i], state, &agg_column, _partition_start,
+                                                     _partition_end, frame_start, frame_end);
+    }
+    _sliding_frame_start = frame_start;
+    _sliding_frame_end = frame_end;
+}
+
 void Analytor::reset_window_state() {
     for (size_t i = 0; i < _agg_fn_ctxs.size(); i++) {
         _agg_functions[i]->reset(_agg_fn_ctxs[i], _agg_intput_columns[i],
                                  _managed_fn_states[0]->mutable_data() + _agg_states_offsets[i]);
     }
+    _sliding_frame_start = 0;
+    _sliding_frame_end = 0;
 }
 
 void Analytor::get_window_function_result(size_t start, size_t end) {
@@ -569,6 +605,8 @@ void Analytor::remove_unused_buffer_values(RuntimeState* state) {
     _current_row_position -= remove_count;
     _peer_group_start -= remove_count;
     _peer_group_end -= remove_count;
+    _sliding_frame_start -= remove_count;
+    _sliding_frame_end -= remove_count;
 
     _removed_chunk_index += BUFFER_CHUNK_NUMBER;
 
@@ -99,6 +99,10 @@ public:
     FrameRange get_sliding_frame_range();
 
     void update_window_batch(int64_t peer_group_start, int64_t peer_group_end, int64_t frame_start, int64_t frame_end);
+    // Update the window state from the frame of the previous row to the sliding frame of the current row.
+    // The removable functions remove the rows leaving the frame and add the rows entering it, and the others are
+    // reset and updated by all the rows in the frame.
+    void update_sliding_frame(const FrameRange& range);
     void reset_window_state();
     void get_window_function_result(size_t start, size_t end);
 
@@ -121,6 +125,9 @@ public:
         return _need_partition_boundary_for_unbounded_preceding_rows_frame;
     }
 
+    bool has_lead_lag_function() const { return _has_lead_lag_function; }
+    int64_t rows_end_offset() const { return _rows_end_offset; }
+
 #ifdef NDEBUG
     static constexpr int32_t BUFFER_CHUNK_NUMBER = 1000;
 #else
@@ -186,6 +193,11 @@ private:
     int64_t _rows_start_offset = 0;
     int64_t _rows_end_offset = 0;
 
+    // The frame [start, end) of the window state updated by update_sliding_frame, which is empty after
+    // the state is reset.
+    int64_t _sliding_frame_start = 0;
+    int64_t _sliding_frame_end = 0;
+
     // The offset of the n-th window function in a row of window functions.
     std::vector<size_t> _agg_states_offsets;
     // The total size of the row for the window function state.
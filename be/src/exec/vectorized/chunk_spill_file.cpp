@@ -0,0 +1,153 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "exec/vectorized/chunk_spill_file.h"
+
+#include <unistd.h>
+
+#include <cerrno>
+#include <sstream>
+
+#include "column/chunk.h"
+#include "column/column_helper.h"
+#include "common/logging.h"
+#include "gutil/strings/substitute.h"
+#include "serde/protobuf_serde.h"
+#include "storage/olap_define.h"
+
+namespace starrocks::vectorized {
+
+ChunkSpillFile::ChunkSpillFile(std::string storage_root_path, std::string prefix)
+        : _storage_root_path(std::move(storage_root_path)), _prefix(std::move(prefix)) {}
+
+ChunkSpillFile::~ChunkSpillFile() {
+    if (_tmp_file_fd >= 0) {
+        ::close(_tmp_file_fd);
+    }
+}
+
+Status ChunkSpillFile::write(const Chunk& chunk) {
+    DCHECK(!_is_reading);
+    if (chunk.is_empty()) {
+        return Status::OK();
+    }
+    if (_tmp_file_fd < 0) {
+        RETURN_IF_ERROR(_create_tmp_file());
+    }
+
+    // The const columns are deserialized as ordinary columns, so unpack them before serializing.
+    Columns columns = chunk.columns();
+    for (auto& column : columns) {
+        if (column->is_constant()) {
+            column = ColumnHelper::unpack_and_duplicate_const_column(chunk.num_rows(), column);
+        }
+    }
+    Chunk unpacked_chunk(std::move(columns), chunk.get_slot_id_to_index_map(), chunk.get_tuple_id_to_index_map());
+
+    ASSIGN_OR_RETURN(auto chunk_pb, serde::ProtobufChunkSerde::serialize(unpacked_chunk));
+    const std::string data = chunk_pb.SerializeAsString();
+    const uint64_t size = data.size();
+    RETURN_IF_ERROR(_write_fully(&size, sizeof(size)));
+    RETURN_IF_ERROR(_write_fully(data.data(), data.size()));
+
+    _num_chunks++;
+    _num_rows += chunk.num_rows();
+    _num_bytes += sizeof(size) + data.size();
+    return Status::OK();
+}
+
+Status ChunkSpillFile::flip_to_read() {
+    _is_reading = true;
+    _num_read_chunks = 0;
+    if (_tmp_file_fd >= 0) {
+        off_t offset = lseek(_tmp_file_fd, 0, SEEK_SET);
+        if (offset != 0) {
+            PLOG(WARNING) << "fail to seek to offset 0. offset=" << offset;
+            return Status::InternalError("fail to seek to offset 0");
+        }
+    }
+    return Status::OK();
+}
+
+StatusOr<ChunkPtr> ChunkSpillFile::read(const RowDescriptor& row_desc) {
+    DCHECK(_is_reading);
+    if (_num_read_chunks >= _num_chunks) {
+        return nullptr;
+    }
+
+    uint64_t size = 0;
+    ASSIGN_OR_RETURN(bool has_data, _read_fully(&size, sizeof(size)));
+    if (!has_data) {
+        return Status::InternalError(strings::Substitute("spill file ends at chunk $0 of $1 chunks",
+                                                         _num_read_chunks, _num_chunks));
+    }
+    _read_buffer.resize(size);
+    ASSIGN_OR_RETURN(has_data, _read_fully(_read_buffer.data(), size));
+    if (!has_data && size > 0) {
+        return Status::InternalError("spill file ends in the middle of a chunk");
+    }
+
+    ChunkPB chunk_pb;
+    if (!chunk_pb.ParseFromString(_read_buffer)) {
+        return Status::InternalError("fail to parse ChunkPB from spill file");
+    }
+    ASSIGN_OR_RETURN(auto chunk, serde::ProtobufChunkSerde::deserialize(row_desc, chunk_pb));
+    _num_read_chunks++;
+    return std::make_shared<Chunk>(std::move(chunk));
+}
+
+Status ChunkSpillFile::_create_tmp_file() {
+    std::stringstream tmp_file_path_s;
+    // storage/tmp/spill_hash_join_build.abcdef
+    tmp_file_path_s << _storage_root_path << TMP_PREFIX << "/"
+                    << "spill_" << _prefix << ".XXXXXX";
+    std::string tmp_file_path = tmp_file_path_s.str();
+    _tmp_file_fd = mkstemp(tmp_file_path.data());
+    if (_tmp_file_fd < 0) {
+        PLOG(WARNING) << "fail to create spill tmp file. path=" << tmp_file_path;
+        return Status::InternalError("fail to create spill tmp file");
+    }
+    unlink(tmp_file_path.data());
+    return Status::OK();
+}
+
+Status ChunkSpillFile::_write_fully(const void* data, size_t size) {
+    const auto* cur = static_cast<const char*>(data);
+    while (size > 0) {
+        ssize_t w_size = ::write(_tmp_file_fd, cur, size);
+        if (w_size < 0 && errno == EINTR) {
+            continue;
+        }
+        if (w_size <= 0) {
+            PLOG(WARNING) << "fail to write spill file. write size=" << w_size;
+            return Status::InternalError("fail to write spill file");
+        }
+        cur += w_size;
+        size -= w_size;
+    }
+    return Status::OK();
+}
+
+StatusOr<bool> ChunkSpillFile::_read_fully(void* data, size_t size) {
+    auto* cur = static_cast<char*>(data);
+    size_t read_size = 0;
+    while (read_size < size) {
+        ssize_t r_size = ::read(_tmp_file_fd, cur + read_size, size - read_size);
+        if (r_size < 0 && errno == EINTR) {
+            continue;
+        }
+        if (r_size < 0) {
+            PLOG(WARNING) << "fail to read spill file. read size=" << r_size;
+            return Status::InternalError("fail to read spill file");
+        }
+        if (r_size == 0) {
+            if (read_size == 0) {
+                return false;
+            }
+            return Status::InternalError("spill file is truncated");
+        }
+        read_size += r_size;
+    }
+    return true;
+}
+
+} // namespace starrocks::vectorized
@@ -0,0 +1,73 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <string>
+
+#include "column/vectorized_fwd.h"
+#include "common/statusor.h"
+
+namespace starrocks {
+class RowDescriptor;
+}
+
+namespace starrocks::vectorized {
+
+// ChunkSpillFile spills chunks to a temporary file under the storage root path, and reads them back in the
+// order they are written. The file is unlinked once created, so it is removed when the ChunkSpillFile is
+// destroyed, even if the process crashes.
+//
+// Each chunk is written as a record of the size of the serialized ChunkPB followed by the ChunkPB itself.
+//
+// Usage Example:
+//     ChunkSpillFile file(storage_root_path, "hash_join_build");
+//     file.write(chunk1);
+//     file.write(chunk2);
+//     ...
+//     file.flip_to_read();
+//     while ((chunk = file.read(row_desc).value()) != nullptr) {
+//         ...
+//     }
+//
+class ChunkSpillFile {
+public:
+    ChunkSpillFile(std::string storage_root_path, std::string prefix);
+    ~ChunkSpillFile();
+
+    ChunkSpillFile(const ChunkSpillFile&) = delete;
+    ChunkSpillFile& operator=(const ChunkSpillFile&) = delete;
+
+    // The temporary file is created on the first write of a non-empty chunk.
+    Status write(const Chunk& chunk);
+
+    // Rewind to the first chunk. The chunks cannot be written after flipping to read.
+    Status flip_to_read();
+
+    // Return the next chunk, whose columns are typed by |row_desc|, or nullptr after the last chunk.
+    StatusOr<ChunkPtr> read(const RowDescriptor& row_desc);
+
+    size_t num_chunks() const { return _num_chunks; }
+    size_t num_rows() const { return _num_rows; }
+    size_t num_bytes() const { return _num_bytes; }
+
+private:
+    Status _create_tmp_file();
+    Status _write_fully(const void* data, size_t size);
+    // Return false if the end of file is reached before any byte is read.
+    StatusOr<bool> _read_fully(void* data, size_t size);
+
+    const std::string _storage_root_path;
+    const std::string _prefix;
+    int _tmp_file_fd = -1;
+    bool _is_reading = false;
+
+    size_t _num_chunks = 0;
+    size_t _num_rows = 0;
+    size_t _num_bytes = 0;
+
+    // for read
+    size_t _num_read_chunks = 0;
+    std::string _read_buffer;
+};
+
+} // namespace starrocks::vectorized
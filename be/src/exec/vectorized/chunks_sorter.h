@@ -6,6 +6,7 @@
 #include "exec/sort_exec_exprs.h"
 #include "exec/vectorized/sorting/sort_permute.h"
 #include "exec/vectorized/sorting/sorting.h"
+#include "exec/vectorized/topn_runtime_filter.h"
 #include "exprs/expr_context.h"
 #include "runtime/descriptors.h"
 #include "util/runtime_profile.h"
@@ -107,6 +108,13 @@ public:
     // Return accurate output rows of this operator
     virtual size_t get_output_rows() const = 0;
 
+    // Whether the sorted data is spilled to disk, in which case it can only be read by get_next().
+    virtual bool is_spilled() const { return false; }
+
+    // Publish the bound of the first ORDER BY column to |filter| once enough rows are kept.
+    // Only the top-n sorters publish the bound.
+    void set_topn_runtime_filter(TopnRuntimeFilterPtr filter) { _topn_runtime_filter = std::move(filter); }
+
     Status finish(RuntimeState* state);
 
     bool sink_complete();
@@ -134,6 +142,8 @@ protected:
     RuntimeProfile::Counter* _output_timer = nullptr;
 
     std::atomic<bool> _is_sink_complete = false;
+
+    TopnRuntimeFilterPtr _topn_runtime_filter;
 };
 
 } // namespace starrocks::vectorized
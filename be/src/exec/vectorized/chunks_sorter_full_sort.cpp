@@ -2,11 +2,17 @@
 
 #include "chunks_sorter_full_sort.h"
 
+#include "common/config.h"
 #include "exec/vectorized/sorting/merge.h"
 #include "exec/vectorized/sorting/sort_permute.h"
 #include "exec/vectorized/sorting/sorting.h"
 #include "exprs/expr.h"
+#include "runtime/chunk_cursor.h"
+#include "runtime/descriptors.h"
+#include "runtime/mem_tracker.h"
 #include "runtime/runtime_state.h"
+#include "storage/data_dir.h"
+#include "storage/storage_engine.h"
 #include "util/stopwatch.hpp"
 
 namespace starrocks::vectorized {
@@ -18,10 +24,29 @@ ChunksSorterFullSort::ChunksSorterFullSort(RuntimeState* state, const std::vecto
 
 ChunksSorterFullSort::~ChunksSorterFullSort() = default;
 
+void ChunksSorterFullSort::setup_runtime(RuntimeProfile* profile) {
+    ChunksSorter::setup_runtime(profile);
+    if (_spill_tuple_desc != nullptr) {
+        _spill_rows_counter = ADD_COUNTER(profile, "SpillRows", TUnit::UNIT);
+        _spill_bytes_counter = ADD_COUNTER(profile, "SpillBytes", TUnit::BYTES);
+        _spill_runs_counter = ADD_COUNTER(profile, "SpillRuns", TUnit::UNIT);
+    }
+}
+
+void ChunksSorterFullSort::enable_spill(TupleDescriptor* materialized_tuple_desc) {
+    _spill_tuple_desc = materialized_tuple_desc;
+}
+
 Status ChunksSorterFullSort::update(RuntimeState* state, const ChunkPtr& chunk) {
     _merge_unsorted(state, chunk);
     _partial_sort(state, false);
 
+    // Spill the sorted runs as soon as they are produced under memory pressure, so only the unsorted chunk being
+    // accumulated is kept in memory.
+    if (_spill_tuple_desc != nullptr && !_sorted_chunks.empty() && _exceeds_spill_mem_limit(state)) {
+        RETURN_IF_ERROR(_spill_sorted_chunks(state));
+    }
+
     return Status::OK();
 }
 
@@ -76,14 +101,131 @@ Status ChunksSorterFullSort::_merge_sorted(RuntimeState* state) {
     return Status::OK();
 }
 
+bool ChunksSorterFullSort::_exceeds_spill_mem_limit(RuntimeState* state) const {
+    if (!state->enable_spill() || config::sort_spill_mem_limit_percent <= 0) {
+        return false;
+    }
+    return state->exceeds_spill_mem_limit(config::sort_spill_mem_limit_percent);
+}
+
+Status ChunksSorterFullSort::_spill_sorted_chunks(RuntimeState* state) {
+    if (_spill_storage_paths.empty()) {
+        StorageEngine* storage_engine = StorageEngine::instance();
+        if (storage_engine != nullptr) {
+            for (DataDir* store : storage_engine->get_stores()) {
+                _spill_storage_paths.emplace_back(store->path());
+            }
+        }
+        if (_spill_storage_paths.empty()) {
+            // Nowhere to spill, keep sorting in memory.
+            _spill_tuple_desc = nullptr;
+            return Status::OK();
+        }
+        _spill_row_desc = std::make_unique<RowDescriptor>(_spill_tuple_desc, false);
+    }
+
+    // Each sorted chunk is written in pieces of chunk_size rows, which are read back one by one when merging.
+    const size_t chunk_size = state->chunk_size();
+    for (auto& sorted_chunk : _sorted_chunks) {
+        // Spread the runs over the storage paths.
+        const std::string& path = _spill_storage_paths[_spill_files.size() % _spill_storage_paths.size()];
+        auto file = std::make_unique<ChunkSpillFile>(path, "sort");
+        for (size_t offset = 0; offset < sorted_chunk->num_rows(); offset += chunk_size) {
+            size_t num_rows = std::min(chunk_size, sorted_chunk->num_rows() - offset);
+            ChunkPtr piece = sorted_chunk->clone_empty(num_rows);
+            piece->append(*sorted_chunk, offset, num_rows);
+            RETURN_IF_ERROR(piece->downgrade());
+            RETURN_IF_ERROR(file->write(*piece));
+        }
+        if (_spill_rows_counter != nullptr) {
+            COUNTER_UPDATE(_spill_rows_counter, file->num_rows());
+            COUNTER_UPDATE(_spill_bytes_counter, file->num_bytes());
+        }
+        _spill_files.emplace_back(std::move(file));
+    }
+    if (_spill_runs_counter != nullptr) {
+        COUNTER_SET(_spill_runs_counter, static_cast<int64_t>(_spill_files.size()));
+    }
+    _sorted_chunks.clear();
+    return Status::OK();
+}
+
+Status ChunksSorterFullSort::_init_spill_merger(RuntimeState* state) {
+    SCOPED_TIMER(_merge_timer);
+
+    std::vector<std::unique_ptr<SimpleChunkSortCursor>> cursors;
+    cursors.reserve(_spill_files.size());
+    for (auto& file : _spill_files) {
+        RETURN_IF_ERROR(file->flip_to_read());
+        ChunkSpillFile* spill_file = file.get();
+        ChunkProvider provider = [this, spill_file](ChunkUniquePtr* output, bool* eos) -> bool {
+            // The spilled chunks are always ready to read.
+            if (output == nullptr || eos == nullptr) {
+                return true;
+            }
+            auto chunk = spill_file->read(*_spill_row_desc);
+            if (!chunk.ok()) {
+                if (_spill_status.ok()) {
+                    _spill_status = chunk.status();
+                }
+                *eos = true;
+                return false;
+            }
+            if (chunk.value() == nullptr) {
+                *eos = true;
+                return false;
+            }
+            *output = std::make_unique<Chunk>(std::move(*chunk.value()));
+            return true;
+        };
+        cursors.emplace_back(std::make_unique<SimpleChunkSortCursor>(std::move(provider), _sort_exprs));
+    }
+
+    SortDescs sort_desc(_sort_order_flag, _null_first_flag);
+    _spill_merger = std::make_unique<MergeCursorsCascade>();
+    RETURN_IF_ERROR(_spill_merger->init(sort_desc, std::move(cursors)));
+    // Mark all the cursors ready.
+    CHECK(_spill_merger->is_data_ready());
+    return Status::OK();
+}
+
 Status ChunksSorterFullSort::done(RuntimeState* state) {
     RETURN_IF_ERROR(_partial_sort(state, true));
+    if (is_spilled()) {
+        // The runs left in memory are spilled as well, so that all the runs are merged in the same way.
+        RETURN_IF_ERROR(_spill_sorted_chunks(state));
+        return _init_spill_merger(state);
+    }
     RETURN_IF_ERROR(_merge_sorted(state));
     return Status::OK();
 }
 
+Status ChunksSorterFullSort::_get_next_spilled(ChunkPtr* chunk, bool* eos) {
+    // The merged chunks may be larger than chunk_size, so each of them is output in pieces.
+    while (_spill_output_run.empty() && !_spill_merger->is_eos()) {
+        ChunkUniquePtr merged = _spill_merger->try_get_next();
+        RETURN_IF_ERROR(_spill_status);
+        if (merged != nullptr && !merged->is_empty()) {
+            _spill_output_run = SortedRun(ChunkPtr(merged.release()), Columns());
+        }
+    }
+    RETURN_IF_ERROR(_spill_status);
+    if (_spill_output_run.empty()) {
+        *chunk = nullptr;
+        *eos = true;
+        return Status::OK();
+    }
+    *chunk = _spill_output_run.steal_chunk(_state->chunk_size());
+    RETURN_IF_ERROR((*chunk)->downgrade());
+    *eos = false;
+    return Status::OK();
+}
+
 Status ChunksSorterFullSort::get_next(ChunkPtr* chunk, bool* eos) {
     SCOPED_TIMER(_output_timer);
+    if (_spill_merger != nullptr) {
+        return _get_next_spilled(chunk, eos);
+    }
     if (_merged_runs.num_chunks() == 0) {
         *chunk = nullptr;
         *eos = true;
@@ -103,10 +245,14 @@ Status ChunksSorterFullSort::get_next(ChunkPtr* chunk, bool* eos) {
 }
 
 SortedRuns ChunksSorterFullSort::get_sorted_runs() {
+    DCHECK(!is_spilled());
     return _merged_runs;
 }
 
 size_t ChunksSorterFullSort::get_output_rows() const {
+    if (is_spilled()) {
+        return _total_rows;
+    }
     return _merged_runs.num_rows();
 }
 
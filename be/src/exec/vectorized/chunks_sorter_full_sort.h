@@ -2,12 +2,18 @@
 
 #pragma once
 
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "exec/vectorized/chunk_spill_file.h"
 #include "exec/vectorized/chunks_sorter.h"
 #include "exec/vectorized/sorting/merge.h"
 #include "gtest/gtest_prod.h"
 
 namespace starrocks {
 class ExprContext;
+class RowDescriptor;
 
 namespace vectorized {
 
@@ -35,6 +41,16 @@ public:
 
     int64_t mem_usage() const override;
 
+    void setup_runtime(RuntimeProfile* profile) override;
+
+    // Allow the sorted runs to be spilled to disk, when the query enables spilling and its memory exceeds
+    // config::sort_spill_mem_limit_percent of the limit. The input chunks must be of |materialized_tuple_desc|,
+    // which is used to read the spilled chunks back.
+    // The spilled runs are merged by cascade merging of the cursors over the spill files, and only get_next() can
+    // output them.
+    void enable_spill(TupleDescriptor* materialized_tuple_desc);
+    bool is_spilled() const override { return !_spill_files.empty(); }
+
 private:
     // Three stages of sorting procedure:
     // 1. Accumulate input chunks into a big chunk(but not exceed the kMaxBufferedChunkSize), to reduce the memory copy during merge
@@ -44,12 +60,30 @@ private:
     Status _partial_sort(RuntimeState* state, bool done);
     Status _merge_sorted(RuntimeState* state);
 
+    bool _exceeds_spill_mem_limit(RuntimeState* state) const;
+    // Write each of the sorted chunks to its own spill file as a sorted run, and release them.
+    Status _spill_sorted_chunks(RuntimeState* state);
+    Status _init_spill_merger(RuntimeState* state);
+    Status _get_next_spilled(ChunkPtr* chunk, bool* eos);
+
     size_t _total_rows = 0;               // Total rows of sorting data
     Permutation _sort_permutation;        // Temp permutation for sorting
     ChunkPtr _unsorted_chunk;             // Unsorted chunk, accumulate it to a larger chunk
     std::vector<ChunkPtr> _sorted_chunks; // Partial sorted, but not merged
     SortedRuns _merged_runs;              // After merge
 
+    // Spill the sorted runs, which are merged from the spill files after done().
+    TupleDescriptor* _spill_tuple_desc = nullptr;
+    std::unique_ptr<RowDescriptor> _spill_row_desc;
+    std::vector<std::string> _spill_storage_paths;
+    std::vector<std::unique_ptr<ChunkSpillFile>> _spill_files;
+    std::unique_ptr<MergeCursorsCascade> _spill_merger;
+    SortedRun _spill_output_run; // The merged chunk being output
+    Status _spill_status;        // The first error of reading the spill files in the merger
+    RuntimeProfile::Counter* _spill_rows_counter = nullptr;
+    RuntimeProfile::Counter* _spill_bytes_counter = nullptr;
+    RuntimeProfile::Counter* _spill_runs_counter = nullptr;
+
     // TODO: further tunning the buffer parameter
     static constexpr size_t kMaxBufferedChunkSize = 1024000;   // Max buffer 1024000 rows
     static constexpr size_t kMaxBufferedChunkBytes = 16 << 20; // Max buffer 16MB bytes
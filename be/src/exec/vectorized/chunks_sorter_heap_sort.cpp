@@ -94,6 +94,11 @@ Status ChunksSorterHeapSort::update(RuntimeState* state, const ChunkPtr& chunk)
             }
         }
     }
+    // The top of the full heap is the last row to keep.
+    if (_topn_runtime_filter != nullptr && _number_of_rows_to_sort() == _sort_heap->size()) {
+        const auto& top = _sort_heap->top();
+        _topn_runtime_filter->update(*top.data_segment()->order_by_columns[0], top.row_id());
+    }
     // TODO: merge chunk if necessary
     return Status::OK();
 }
@@ -138,6 +138,11 @@ Status ChunksSorterTopn::_sort_chunks(RuntimeState* state) {
     // the result is _merged_segment as [BEFORE, IN].
     RETURN_IF_ERROR(_merge_sort_data_as_merged_segment(state, permutations, segments));
 
+    // The merged segment keeps the rows to sort first, so the last of them is the bound.
+    const size_t rows_to_sort = _get_number_of_rows_to_sort();
+    if (_topn_runtime_filter != nullptr && _merged_segment.chunk->num_rows() >= rows_to_sort) {
+        _topn_runtime_filter->update(*_merged_segment.order_by_columns[0], rows_to_sort - 1);
+    }
     return Status::OK();
 }
 
@@ -334,22 +339,29 @@ Status ChunksSorterTopn::_merge_sort_data_as_merged_segment(RuntimeState* state,
 
 // take rows_to_sort rows from permutation_second merge-sort with _merged_segment.
 // And take result datas into big_chunk.
+// Only the order by columns of the rows in permutation_second are materialized for merging, and the other columns
+// are materialized after merging for the kept rows only, which are much fewer for a small limit on a wide table.
 Status ChunksSorterTopn::_merge_sort_common(ChunkPtr& big_chunk, DataSegments& segments, const size_t rows_to_keep,
                                             size_t sorted_size, size_t permutation_size,
                                             Permutation& permutation_second) {
-    // Assemble the permutated segments into a chunk
-    std::vector<ChunkPtr> right_chunks;
-    for (auto& segment : segments) {
-        right_chunks.push_back(segment.chunk);
-    }
-    ChunkPtr right_chunk = big_chunk->clone_empty(permutation_second.size());
-    append_by_permutation(right_chunk.get(), right_chunks, permutation_second);
+    // Assemble the permutated order by columns of segments
     Columns right_columns;
-    for (auto expr : *_sort_exprs) {
-        auto maybe_column = expr->evaluate(right_chunk.get());
-        RETURN_IF_ERROR(maybe_column);
-        right_columns.push_back(maybe_column.value());
+    right_columns.reserve(_sort_exprs->size());
+    for (size_t col_index = 0; col_index < _sort_exprs->size(); col_index++) {
+        Columns segment_columns;
+        segment_columns.reserve(segments.size());
+        for (auto& segment : segments) {
+            segment_columns.push_back(segment.order_by_columns[col_index]);
+        }
+        ColumnPtr right_column = segment_columns[0]->clone_empty();
+        append_by_permutation(right_column.get(), segment_columns, permutation_second);
+        right_columns.push_back(std::move(right_column));
+    }
+    Chunk::SlotHashMap slot_map;
+    for (size_t col_index = 0; col_index < right_columns.size(); col_index++) {
+        slot_map[col_index] = col_index;
     }
+    auto right_chunk = std::make_shared<Chunk>(right_columns, slot_map);
 
     ChunkPtr left_chunk = _merged_segment.chunk;
     Columns left_columns = _merged_segment.order_by_columns;
@@ -363,7 +375,20 @@ Status ChunksSorterTopn::_merge_sort_common(ChunkPtr& big_chunk, DataSegments& s
     CHECK_GE(merged_perm.size(), rows_to_keep);
     merged_perm.resize(rows_to_keep);
 
-    std::vector<ChunkPtr> chunks{left_chunk, right_chunk};
+    // Map the rows of right side back to the segments, which follow the left chunk. The rows of left side are
+    // output by merge_sorted_chunks_two_way with chunk index 0.
+    std::vector<ChunkPtr> chunks;
+    chunks.reserve(segments.size() + 1);
+    chunks.push_back(left_chunk);
+    for (auto& segment : segments) {
+        chunks.push_back(segment.chunk);
+    }
+    for (auto& item : merged_perm) {
+        if (item.chunk_index != 0) {
+            const auto& right_item = permutation_second[item.index_in_chunk];
+            item = PermutationItem(right_item.chunk_index + 1, right_item.index_in_chunk);
+        }
+    }
     append_by_permutation(big_chunk.get(), chunks, merged_perm);
     return Status::OK();
 }
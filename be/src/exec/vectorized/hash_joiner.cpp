@@ -9,6 +9,7 @@
 #include "column/column_helper.h"
 #include "column/fixed_length_column.h"
 #include "column/vectorized_fwd.h"
+#include "common/config.h"
 #include "exprs/expr.h"
 #include "exprs/vectorized/column_ref.h"
 #include "exprs/vectorized/in_const_predicate.hpp"
@@ -17,7 +18,11 @@
 #include "runtime/current_thread.h"
 #include "runtime/runtime_filter_worker.h"
 #include "simd/simd.h"
+#include "storage/data_dir.h"
+#include "storage/storage_engine.h"
+#include "types/hll.h"
 #include "util/debug_util.h"
+#include "util/hash_util.hpp"
 #include "util/runtime_profile.h"
 
 namespace starrocks::vectorized {
@@ -25,6 +30,7 @@ namespace starrocks::vectorized {
 HashJoiner::HashJoiner(const HashJoinerParam& param, const std::vector<HashJoinerPtr>& read_only_join_probers)
         : _hash_join_node(param._hash_join_node),
           _pool(param._pool),
+          _plan_node_id(param._node_id),
           _join_type(param._hash_join_node.join_op),
           _is_null_safes(param._is_null_safes),
           _build_expr_ctxs(param._build_expr_ctxs),
@@ -58,6 +64,11 @@ Status HashJoiner::prepare_builder(RuntimeState* state, RuntimeProfile* runtime_
     if (_runtime_state == nullptr) {
         _runtime_state = state;
     }
+    // The builder shared by multiple HashJoinBuildOperators is prepared only once.
+    if (_is_builder_prepared) {
+        return Status::OK();
+    }
+    _is_builder_prepared = true;
 
     if (_hash_join_node.__isset.sql_join_predicates) {
         runtime_profile->add_info_string("JoinPredicates", _hash_join_node.sql_join_predicates);
@@ -74,6 +85,10 @@ Status HashJoiner::prepare_builder(RuntimeState* state, RuntimeProfile* runtime_
     _build_conjunct_evaluate_timer = ADD_TIMER(runtime_profile, "BuildConjunctEvaluateTime");
     _build_buckets_counter = ADD_COUNTER(runtime_profile, "BuildBuckets", TUnit::UNIT);
     _runtime_filter_num = ADD_COUNTER(runtime_profile, "RuntimeFilterNum", TUnit::UNIT);
+    _spill_build_rows_counter = ADD_COUNTER(runtime_profile, "SpillBuildRows", TUnit::UNIT);
+    _spill_build_bytes_counter = ADD_COUNTER(runtime_profile, "SpillBuildBytes", TUnit::BYTES);
+
+    _is_spillable = _check_spillable(state);
 
     HashTableParam param;
     _init_hash_table_param(&param);
@@ -102,6 +117,8 @@ Status HashJoiner::prepare_prober(RuntimeState* state, RuntimeProfile* runtime_p
     _probe_conjunct_evaluate_timer = ADD_TIMER(runtime_profile, "ProbeConjunctEvaluateTime");
     _other_join_conjunct_evaluate_timer = ADD_TIMER(runtime_profile, "OtherJoinConjunctEvaluateTime");
     _where_conjunct_evaluate_timer = ADD_TIMER(runtime_profile, "WhereConjunctEvaluateTime");
+    _spill_probe_rows_counter = ADD_COUNTER(runtime_profile, "SpillProbeRows", TUnit::UNIT);
+    _spill_probe_bytes_counter = ADD_COUNTER(runtime_profile, "SpillProbeBytes", TUnit::BYTES);
 
     return Status::OK();
 }
@@ -149,6 +166,34 @@ Status HashJoiner::append_chunk_to_ht(RuntimeState* state, const ChunkPtr& chunk
     if (!chunk || chunk->is_empty()) {
         return Status::OK();
     }
+    if (_is_spilled) {
+        return _spill_chunk(state, chunk, _build_expr_ctxs, &_build_spill_partitions, nullptr);
+    }
+
+    RETURN_IF_ERROR(_append_chunk_to_ht(state, chunk));
+    if (_is_spillable && _exceeds_spill_mem_limit(state)) {
+        RETURN_IF_ERROR(_spill_hash_table(state));
+    }
+    return Status::OK();
+}
+
+Status HashJoiner::_append_chunk_to_ht(RuntimeState* state, const ChunkPtr& chunk) {
+    if (_num_builders > 1) {
+        // The key columns are evaluated by each builder in parallel, and only the appending is serialized.
+        Columns key_columns;
+        {
+            SCOPED_TIMER(_build_conjunct_evaluate_timer);
+            _prepare_key_columns(key_columns, chunk, _build_expr_ctxs);
+        }
+        std::lock_guard<std::mutex> l(_build_mutex);
+        if (UNLIKELY(_ht.get_row_count() + chunk->num_rows() >= UINT32_MAX)) {
+            return Status::NotSupported(strings::Substitute("row count of right table in hash join > $0", UINT32_MAX));
+        }
+        SCOPED_TIMER(_copy_right_table_chunk_timer);
+        TRY_CATCH_BAD_ALLOC(_ht.append_chunk(state, chunk, key_columns));
+        return Status::OK();
+    }
+
     if (UNLIKELY(_ht.get_row_count() + chunk->num_rows() >= UINT32_MAX)) {
         return Status::NotSupported(strings::Substitute("row count of right table in hash join > $0", UINT32_MAX));
     }
@@ -166,8 +211,19 @@ Status HashJoiner::append_chunk_to_ht(RuntimeState* state, const ChunkPtr& chunk
 
 Status HashJoiner::build_ht(RuntimeState* state) {
     if (_phase == HashJoinPhase::BUILD) {
-        RETURN_IF_ERROR(_build(state));
+        if (_is_spilled) {
+            RETURN_IF_ERROR(_flush_spill_partitions(&_build_spill_partitions));
+            _init_spill_partitions(&_probe_spill_partitions, "hash_join_probe");
+            _probe_spill_partitions.rows_counter = _spill_probe_rows_counter;
+            _probe_spill_partitions.bytes_counter = _spill_probe_bytes_counter;
+            RETURN_IF_ERROR(_load_spill_partition(state, 0));
+        } else {
+            RETURN_IF_ERROR(_build(state));
+        }
         COUNTER_SET(_build_buckets_counter, static_cast<int64_t>(_ht.get_bucket_size()));
+        if (config::report_join_statistics) {
+            _update_build_statistics();
+        }
     }
 
     return Status::OK();
@@ -197,18 +253,32 @@ bool HashJoiner::has_output() const {
     return false;
 }
 
-void HashJoiner::push_chunk(RuntimeState* state, ChunkPtr&& chunk) {
+Status HashJoiner::push_chunk(RuntimeState* state, ChunkPtr&& chunk) {
     DCHECK(chunk && !chunk->is_empty());
     DCHECK(!_probe_input_chunk);
+    _num_probe_rows += chunk->num_rows();
+
+    if (_is_spilled) {
+        // Only the rows of the partition in the hash table are probed now, and the others are spilled.
+        ChunkPtr partition_chunk;
+        RETURN_IF_ERROR(_spill_chunk(state, chunk, _probe_expr_ctxs, &_probe_spill_partitions, &partition_chunk));
+        if (partition_chunk == nullptr) {
+            return Status::OK();
+        }
+        chunk = std::move(partition_chunk);
+    }
 
     _probe_input_chunk = std::move(chunk);
     _ht_has_remain = true;
     _prepare_probe_key_columns();
+    return Status::OK();
 }
 
 StatusOr<ChunkPtr> HashJoiner::pull_chunk(RuntimeState* state) {
     DCHECK(_phase != HashJoinPhase::BUILD);
-    return _pull_probe_output_chunk(state);
+    ASSIGN_OR_RETURN(auto chunk, _pull_probe_output_chunk(state));
+    _num_output_rows += chunk->num_rows();
+    return chunk;
 }
 
 StatusOr<ChunkPtr> HashJoiner::_pull_probe_output_chunk(RuntimeState* state) {
@@ -216,6 +286,14 @@ StatusOr<ChunkPtr> HashJoiner::_pull_probe_output_chunk(RuntimeState* state) {
 
     auto chunk = std::make_shared<Chunk>();
 
+    if (_phase == HashJoinPhase::POST_PROBE && _is_spilled && _probe_input_chunk == nullptr) {
+        RETURN_IF_ERROR(_read_spilled_probe_chunk(state));
+        if (_probe_input_chunk == nullptr) {
+            enter_eos_phase();
+            return chunk;
+        }
+    }
+
     if (_phase == HashJoinPhase::PROBE || _probe_input_chunk != nullptr) {
         DCHECK(_ht_has_remain && _probe_input_chunk);
 
@@ -250,6 +328,12 @@ StatusOr<ChunkPtr> HashJoiner::_pull_probe_output_chunk(RuntimeState* state) {
 }
 
 void HashJoiner::close(RuntimeState* state) {
+    if (!_is_closed) {
+        _is_closed = true;
+        if (config::report_join_statistics) {
+            _report_join_statistics(state);
+        }
+    }
     _ht.close();
 }
 
@@ -258,6 +342,13 @@ Status HashJoiner::create_runtime_filters(RuntimeState* state) {
         return Status::OK();
     }
 
+    if (_is_spilled) {
+        // The hash table only holds the first partition of the build side, so the runtime filters built from it
+        // would filter out the probe rows of the other partitions.
+        _runtime_bloom_filter_build_params.resize(_build_runtime_filters.size());
+        return Status::OK();
+    }
+
     uint64_t runtime_join_filter_pushdown_limit = 1024000;
     if (state->query_options().__isset.runtime_join_filter_pushdown_limit) {
         runtime_join_filter_pushdown_limit = state->query_options().runtime_join_filter_pushdown_limit;
@@ -319,6 +410,242 @@ Status HashJoiner::_build(RuntimeState* state) {
     return Status::OK();
 }
 
+void HashJoiner::_update_build_statistics() {
+    _join_statistics.__set_build_rows(get_ht_row_count());
+    // The hash table only holds the first partition after spilling.
+    if (!_is_spilled) {
+        _join_statistics.__set_build_key_ndv(_estimate_build_key_ndv());
+    }
+}
+
+int64_t HashJoiner::_estimate_build_key_ndv() const {
+    const Columns& key_columns = _ht.get_key_columns();
+    const uint32_t row_count = _ht.get_row_count();
+    if (key_columns.empty() || row_count == 0) {
+        return 0;
+    }
+
+    // The row 0 of the hash table is reserved. The two 32-bit hashes are mixed into a 64-bit hash, since HyperLogLog
+    // needs more than 32 bits to estimate a large cardinality.
+    std::vector<uint32_t> crc32_hashes(row_count + 1, 0);
+    std::vector<uint32_t> fnv_hashes(row_count + 1, HashUtil::FNV_SEED);
+    for (const auto& column : key_columns) {
+        column->crc32_hash(crc32_hashes.data(), 1, row_count + 1);
+        column->fnv_hash(fnv_hashes.data(), 1, row_count + 1);
+    }
+    HyperLogLog hll;
+    for (uint32_t i = 1; i < row_count + 1; i++) {
+        const uint64_t hash = (static_cast<uint64_t>(fnv_hashes[i]) << 32) | crc32_hashes[i];
+        hll.update(HashUtil::murmur_hash64A(&hash, sizeof(hash), HashUtil::MURMUR_SEED));
+    }
+    return hll.estimate_cardinality();
+}
+
+void HashJoiner::_report_join_statistics(RuntimeState* state) {
+    if (state == nullptr) {
+        return;
+    }
+    // The readonly probers of broadcast join only report the probe side, and the build side is reported by the builder.
+    _join_statistics.__set_plan_node_id(_plan_node_id);
+    _join_statistics.__set_probe_rows(_num_probe_rows);
+    _join_statistics.__set_output_rows(_num_output_rows);
+    state->update_join_statistics(_join_statistics);
+}
+
+void HashJoiner::_reset_hash_table() {
+    _ht.close();
+    HashTableParam param;
+    _init_hash_table_param(&param);
+    _ht.create(param);
+}
+
+bool HashJoiner::_check_spillable(RuntimeState* state) {
+    if (!state->enable_spill() || config::hash_join_spill_mem_limit_percent <= 0) {
+        return false;
+    }
+    // The hash table of broadcast join is shared by the read-only probers, which probe it concurrently.
+    if (_hash_join_node.distribution_mode == TJoinDistributionMode::BROADCAST || !_read_only_join_probers.empty()) {
+        return false;
+    }
+    // The other join types either output the build rows in POST_PROBE phase, or depend on whether there is
+    // any null in the whole build side, so they cannot be joined partition by partition.
+    if (_join_type != TJoinOp::INNER_JOIN && _join_type != TJoinOp::LEFT_OUTER_JOIN &&
+        _join_type != TJoinOp::LEFT_SEMI_JOIN && _join_type != TJoinOp::LEFT_ANTI_JOIN) {
+        return false;
+    }
+
+    StorageEngine* storage_engine = StorageEngine::instance();
+    if (storage_engine == nullptr) {
+        return false;
+    }
+    for (DataDir* store : storage_engine->get_stores()) {
+        _spill_storage_paths.emplace_back(store->path());
+    }
+    return !_spill_storage_paths.empty();
+}
+
+bool HashJoiner::_exceeds_spill_mem_limit(RuntimeState* state) const {
+    return state->exceeds_spill_mem_limit(config::hash_join_spill_mem_limit_percent);
+}
+
+void HashJoiner::_init_spill_partitions(SpillPartitions* partitions, const std::string& prefix) {
+    partitions->files.clear();
+    for (size_t i = 0; i < _num_spill_partitions; i++) {
+        // Spread the partitions over the storage paths.
+        const std::string& path = _spill_storage_paths[i % _spill_storage_paths.size()];
+        partitions->files.emplace_back(std::make_unique<ChunkSpillFile>(path, prefix));
+    }
+    partitions->buffer_chunks.assign(_num_spill_partitions, nullptr);
+}
+
+Status HashJoiner::_spill_hash_table(RuntimeState* state) {
+    int num_partition_bits = 1;
+    while ((1 << num_partition_bits) < config::hash_join_spill_num_partitions &&
+           num_partition_bits < MAX_SPILL_PARTITION_BITS) {
+        num_partition_bits++;
+    }
+    _num_spill_partitions = 1 << num_partition_bits;
+    _spill_partition_shift = 32 - num_partition_bits;
+    _spill_partition_indexes.resize(_num_spill_partitions);
+
+    _is_spilled = true;
+    _init_spill_partitions(&_build_spill_partitions, "hash_join_build");
+    _build_spill_partitions.rows_counter = _spill_build_rows_counter;
+    _build_spill_partitions.bytes_counter = _spill_build_bytes_counter;
+
+    // The first row of the build chunk is reserved by the hash table.
+    const ChunkPtr& build_chunk = _ht.get_build_chunk();
+    const size_t num_rows = _ht.get_row_count();
+    const size_t chunk_size = state->chunk_size();
+    for (size_t from = 1; from <= num_rows; from += chunk_size) {
+        ChunkPtr chunk = build_chunk->clone_empty_with_slot();
+        chunk->append(*build_chunk, from, std::min(chunk_size, num_rows + 1 - from));
+        RETURN_IF_ERROR(_spill_chunk(state, chunk, _build_expr_ctxs, &_build_spill_partitions, nullptr));
+    }
+    _reset_hash_table();
+    return Status::OK();
+}
+
+Status HashJoiner::_spill_chunk(RuntimeState* state, const ChunkPtr& chunk, const std::vector<ExprContext*>& expr_ctxs,
+                                SpillPartitions* partitions, ChunkPtr* current_partition_chunk) {
+    Columns key_columns;
+    _prepare_key_columns(key_columns, chunk, expr_ctxs);
+
+    const uint32_t num_rows = chunk->num_rows();
+    _spill_hash_values.assign(num_rows, HashUtil::FNV_SEED);
+    for (const ColumnPtr& column : key_columns) {
+        column->fnv_hash(_spill_hash_values.data(), 0, num_rows);
+    }
+    for (auto& indexes : _spill_partition_indexes) {
+        indexes.clear();
+    }
+    for (uint32_t i = 0; i < num_rows; i++) {
+        // The hash values are mixed by the golden ratio before taking the high bits, because the rows may have been
+        // shuffled to this joiner by the same hash values modulo the number of instances.
+        const uint32_t partition = (_spill_hash_values[i] * 0x9E3779B1U) >> _spill_partition_shift;
+        _spill_partition_indexes[partition].emplace_back(i);
+    }
+
+    if (partitions == &_build_spill_partitions) {
+        _num_spilled_build_rows += num_rows;
+    }
+
+    for (size_t partition = 0; partition < _num_spill_partitions; partition++) {
+        const auto& indexes = _spill_partition_indexes[partition];
+        if (indexes.empty()) {
+            continue;
+        }
+        if (current_partition_chunk != nullptr && partition == _spill_partition) {
+            if (indexes.size() == num_rows) {
+                *current_partition_chunk = chunk;
+            } else {
+                *current_partition_chunk = chunk->clone_empty_with_slot(indexes.size());
+                (*current_partition_chunk)->append_selective(*chunk, indexes.data(), 0, indexes.size());
+            }
+            continue;
+        }
+
+        auto& buffer_chunk = partitions->buffer_chunks[partition];
+        if (buffer_chunk == nullptr) {
+            buffer_chunk = chunk->clone_empty_with_slot(state->chunk_size());
+        }
+        buffer_chunk->append_selective(*chunk, indexes.data(), 0, indexes.size());
+        if (buffer_chunk->num_rows() >= state->chunk_size()) {
+            RETURN_IF_ERROR(_flush_spill_partition(partitions, partition));
+        }
+    }
+    return Status::OK();
+}
+
+Status HashJoiner::_flush_spill_partition(SpillPartitions* partitions, size_t partition) {
+    auto& buffer_chunk = partitions->buffer_chunks[partition];
+    if (buffer_chunk == nullptr || buffer_chunk->is_empty()) {
+        return Status::OK();
+    }
+    auto& file = partitions->files[partition];
+    const size_t num_bytes = file->num_bytes();
+    RETURN_IF_ERROR(file->write(*buffer_chunk));
+    COUNTER_UPDATE(partitions->rows_counter, buffer_chunk->num_rows());
+    COUNTER_UPDATE(partitions->bytes_counter, file->num_bytes() - num_bytes);
+    buffer_chunk.reset();
+    return Status::OK();
+}
+
+Status HashJoiner::_flush_spill_partitions(SpillPartitions* partitions) {
+    for (size_t partition = 0; partition < _num_spill_partitions; partition++) {
+        RETURN_IF_ERROR(_flush_spill_partition(partitions, partition));
+        RETURN_IF_ERROR(partitions->files[partition]->flip_to_read());
+    }
+    return Status::OK();
+}
+
+Status HashJoiner::_load_spill_partition(RuntimeState* state, size_t partition) {
+    _spill_partition = partition;
+    _reset_hash_table();
+
+    auto& file = _build_spill_partitions.files[partition];
+    while (true) {
+        ASSIGN_OR_RETURN(ChunkPtr chunk, file->read(_build_row_descriptor));
+        if (chunk == nullptr) {
+            break;
+        }
+        RETURN_IF_ERROR(_append_chunk_to_ht(state, chunk));
+    }
+    // The build rows are in the hash table now.
+    file.reset();
+
+    return _build(state);
+}
+
+Status HashJoiner::_read_spilled_probe_chunk(RuntimeState* state) {
+    if (!_is_probe_spill_flushed) {
+        RETURN_IF_ERROR(_flush_spill_partitions(&_probe_spill_partitions));
+        _is_probe_spill_flushed = true;
+    }
+
+    while (true) {
+        auto& file = _probe_spill_partitions.files[_spill_partition];
+        // INNER JOIN and LEFT SEMI JOIN output nothing for the partition without build rows.
+        const bool is_skippable = _ht.get_row_count() == 0 &&
+                                  (_join_type == TJoinOp::INNER_JOIN || _join_type == TJoinOp::LEFT_SEMI_JOIN);
+        if (file != nullptr && !is_skippable) {
+            ASSIGN_OR_RETURN(ChunkPtr chunk, file->read(_probe_row_descriptor));
+            if (chunk != nullptr) {
+                _probe_input_chunk = std::move(chunk);
+                _ht_has_remain = true;
+                _prepare_probe_key_columns();
+                return Status::OK();
+            }
+        }
+        file.reset();
+
+        if (_spill_partition + 1 >= _num_spill_partitions) {
+            return Status::OK();
+        }
+        RETURN_IF_ERROR(_load_spill_partition(state, _spill_partition + 1));
+    }
+}
+
 Status HashJoiner::_calc_filter_for_other_conjunct(ChunkPtr* chunk, Column::Filter& filter, bool& filter_all,
                                                    bool& hit_all) {
     filter_all = false;
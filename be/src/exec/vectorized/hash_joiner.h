@@ -2,12 +2,15 @@
 
 #pragma once
 
+#include <mutex>
+
 #include "column/chunk.h"
 #include "column/fixed_length_column.h"
 #include "common/statusor.h"
 #include "exec/exec_node.h"
 #include "exec/pipeline/context_with_dependency.h"
 #include "exec/pipeline/runtime_filter_types.h"
+#include "exec/vectorized/chunk_spill_file.h"
 #include "exec/vectorized/hash_join_node.h"
 #include "exec/vectorized/join_hash_map.h"
 #include "exprs/vectorized/in_const_predicate.hpp"
@@ -37,6 +40,11 @@ using HashJoinerPtr = std::shared_ptr<HashJoiner>;
 //   processed.
 // 4.DONE: all input streams have been processed.
 //
+// When spilling is enabled by the query, HashJoiner switches to grace hash join once the memory of the query exceeds
+// hash_join_spill_mem_limit_percent of its limit in BUILD phase. Both the build and probe inputs are partitioned by
+// the hash of the join keys and spilled to the storage paths, except that the probe rows of the first partition are
+// probed as usual. The other partitions are loaded into the hash table and probed one by one in POST_PROBE phase.
+//
 enum HashJoinPhase {
     BUILD = 0,
     PROBE = 1,
@@ -137,7 +145,7 @@ public:
     Status append_chunk_to_ht(RuntimeState* state, const ChunkPtr& chunk);
     Status build_ht(RuntimeState* state);
     // probe phase
-    void push_chunk(RuntimeState* state, ChunkPtr&& chunk);
+    Status push_chunk(RuntimeState* state, ChunkPtr&& chunk);
     StatusOr<ChunkPtr> pull_chunk(RuntimeState* state);
 
     pipeline::RuntimeInFilters& get_runtime_in_filters() { return _runtime_in_filters; }
@@ -145,7 +153,7 @@ public:
     pipeline::OptRuntimeBloomFilterBuildParams& get_runtime_bloom_filter_build_params() {
         return _runtime_bloom_filter_build_params;
     }
-    size_t get_ht_row_count() { return _ht.get_row_count(); }
+    size_t get_ht_row_count() { return _is_spilled ? _num_spilled_build_rows : _ht.get_row_count(); }
 
     Status create_runtime_filters(RuntimeState* state);
 
@@ -153,6 +161,15 @@ public:
 
     bool is_buildable() const { return _is_buildable; }
 
+    // The hash table of broadcast join may be built by multiple HashJoinBuildOperators in parallel,
+    // which append chunks to the hash table concurrently, and the last finished one builds it.
+    void set_num_builders(size_t num_builders) {
+        _num_builders = num_builders;
+        _num_unfinished_builders = num_builders;
+    }
+    // Return true if all the builders are finished, and the hash table can be built.
+    bool finish_builder() { return --_num_unfinished_builders == 0; }
+
     // These two methods are used only by the hash join builder.
     void set_builder_finished();
     void set_prober_finished();
@@ -192,6 +209,11 @@ private:
     }
 
     void _short_circuit_break() {
+        // The hash table only holds the first partition of the spilled build side.
+        if (_is_spilled) {
+            return;
+        }
+
         // special cases of short-circuit break.
         if (_ht.get_row_count() == 0 &&
             (_join_type == TJoinOp::INNER_JOIN || _join_type == TJoinOp::LEFT_SEMI_JOIN ||
@@ -216,11 +238,44 @@ private:
         }
     }
 
+    Status _append_chunk_to_ht(RuntimeState* state, const ChunkPtr& chunk);
     Status _build(RuntimeState* state);
+    void _update_build_statistics();
+    // Estimate the number of distinct build keys with HyperLogLog.
+    int64_t _estimate_build_key_ndv() const;
+    void _report_join_statistics(RuntimeState* state);
+    void _reset_hash_table();
     Status _probe(RuntimeState* state, ScopedTimer<MonotonicStopWatch>& probe_timer, ChunkPtr* chunk, bool& eos);
 
     StatusOr<ChunkPtr> _pull_probe_output_chunk(RuntimeState* state);
 
+    struct SpillPartitions {
+        std::vector<std::unique_ptr<ChunkSpillFile>> files;
+        // The small partitioned chunks are merged before being written to the files.
+        std::vector<ChunkPtr> buffer_chunks;
+        RuntimeProfile::Counter* rows_counter = nullptr;
+        RuntimeProfile::Counter* bytes_counter = nullptr;
+    };
+
+    bool _check_spillable(RuntimeState* state);
+    bool _exceeds_spill_mem_limit(RuntimeState* state) const;
+    void _init_spill_partitions(SpillPartitions* partitions, const std::string& prefix);
+    // Spill the build rows in the hash table, and spill all the following build chunks.
+    Status _spill_hash_table(RuntimeState* state);
+    // Partition chunk by the hash of the keys evaluated by expr_ctxs, and spill the rows of each partition.
+    // If current_partition_chunk isn't nullptr, the rows of the partition in the hash table are output to it
+    // instead of being spilled.
+    Status _spill_chunk(RuntimeState* state, const ChunkPtr& chunk, const std::vector<ExprContext*>& expr_ctxs,
+                        SpillPartitions* partitions, ChunkPtr* current_partition_chunk);
+    Status _flush_spill_partition(SpillPartitions* partitions, size_t partition);
+    // Flush all the buffered chunks, and flip the files to read.
+    Status _flush_spill_partitions(SpillPartitions* partitions);
+    // Build the hash table from the spilled build rows of partition.
+    Status _load_spill_partition(RuntimeState* state, size_t partition);
+    // Read the next spilled probe chunk into _probe_input_chunk, and load the next partition into the hash table
+    // when the probe chunks of the current partition are exhausted.
+    Status _read_spilled_probe_chunk(RuntimeState* state);
+
     Status _calc_filter_for_other_conjunct(ChunkPtr* chunk, Column::Filter& filter, bool& filter_all, bool& hit_all);
     static void _process_row_for_other_conjunct(ChunkPtr* chunk, size_t start_column, size_t column_count,
                                                 bool filter_all, bool hit_all, const Column::Filter& filter);
@@ -321,6 +376,7 @@ private:
 private:
     const THashJoinNode& _hash_join_node;
     ObjectPool* _pool;
+    const TPlanNodeId _plan_node_id;
 
     RuntimeState* _runtime_state = nullptr;
 
@@ -374,6 +430,33 @@ private:
     const std::vector<HashJoinerPtr>& _read_only_join_probers;
     std::atomic<size_t> _num_unfinished_probers = 0;
 
+    // The statistics reported to FE, see config::report_join_statistics.
+    TJoinStatistics _join_statistics;
+    size_t _num_probe_rows = 0;
+    size_t _num_output_rows = 0;
+
+    size_t _num_builders = 1;
+    std::atomic<size_t> _num_unfinished_builders = 1;
+    bool _is_builder_prepared = false;
+    // Protect _ht from the concurrent appending of multiple builders.
+    std::mutex _build_mutex;
+
+    // Grace hash join.
+    static constexpr int MAX_SPILL_PARTITION_BITS = 10;
+    bool _is_spillable = false;
+    bool _is_spilled = false;
+    bool _is_probe_spill_flushed = false;
+    std::vector<std::string> _spill_storage_paths;
+    size_t _num_spill_partitions = 0;
+    int _spill_partition_shift = 0;
+    // The partition held by the hash table.
+    size_t _spill_partition = 0;
+    size_t _num_spilled_build_rows = 0;
+    SpillPartitions _build_spill_partitions;
+    SpillPartitions _probe_spill_partitions;
+    std::vector<uint32_t> _spill_hash_values;
+    std::vector<std::vector<uint32_t>> _spill_partition_indexes;
+
     // Profile for hash join builder.
     RuntimeProfile::Counter* _build_ht_timer = nullptr;
     RuntimeProfile::Counter* _copy_right_table_chunk_timer = nullptr;
@@ -381,6 +464,8 @@ private:
     RuntimeProfile::Counter* _output_build_column_timer = nullptr;
     RuntimeProfile::Counter* _build_buckets_counter = nullptr;
     RuntimeProfile::Counter* _runtime_filter_num = nullptr;
+    RuntimeProfile::Counter* _spill_build_rows_counter = nullptr;
+    RuntimeProfile::Counter* _spill_build_bytes_counter = nullptr;
 
     // Profile for hash join prober.
     RuntimeProfile::Counter* _search_ht_timer = nullptr;
@@ -390,6 +475,8 @@ private:
     RuntimeProfile::Counter* _probe_conjunct_evaluate_timer = nullptr;
     RuntimeProfile::Counter* _other_join_conjunct_evaluate_timer = nullptr;
     RuntimeProfile::Counter* _where_conjunct_evaluate_timer = nullptr;
+    RuntimeProfile::Counter* _spill_probe_rows_counter = nullptr;
+    RuntimeProfile::Counter* _spill_probe_bytes_counter = nullptr;
 };
 
 } // namespace vectorized
@@ -4,6 +4,8 @@
 
 #include "column/column_helper.h"
 #include "exec/exec_node.h"
+#include "io/block_cache.h"
+#include "io/cache_input_stream.h"
 
 namespace starrocks::vectorized {
 
@@ -111,6 +113,7 @@ Status HdfsScanner::open(RuntimeState* runtime_state) {
     }
     CHECK(_file == nullptr) << "File has already been opened";
     ASSIGN_OR_RETURN(_file, _scanner_params.fs->new_random_access_file(_scanner_params.path));
+    RETURN_IF_ERROR(_open_block_cache_file());
     _build_scanner_context();
     auto status = do_open(runtime_state);
     if (status.ok()) {
@@ -123,6 +126,29 @@ Status HdfsScanner::open(RuntimeState* runtime_state) {
     return status;
 }
 
+Status HdfsScanner::_open_block_cache_file() {
+    auto* cache = io::BlockCache::instance();
+    if (cache == nullptr || _scanner_params.scan_ranges.empty()) {
+        return Status::OK();
+    }
+    // the local files are not worth caching.
+    auto fs_type = _scanner_params.fs->type();
+    if (fs_type == FileSystem::POSIX || fs_type == FileSystem::MEMORY) {
+        return Status::OK();
+    }
+    const THdfsScanRange* scan_range = _scanner_params.scan_ranges[0];
+    int64_t file_size = scan_range->file_length;
+    if (file_size <= 0) {
+        ASSIGN_OR_RETURN(file_size, _file->get_size());
+    }
+    // the file length identifies the version of the file if the modification time is unknown.
+    int64_t version = scan_range->__isset.modification_time ? scan_range->modification_time : file_size;
+    auto stream = std::make_shared<io::CacheInputStream>(_file->stream(), cache, _scanner_params.path, version,
+                                                         file_size);
+    _file = std::make_unique<RandomAccessFile>(std::move(stream), _file->filename());
+    return Status::OK();
+}
+
 void HdfsScanner::close(RuntimeState* runtime_state) noexcept {
     DCHECK(!has_pending_token());
     if (_is_closed) {
@@ -241,6 +267,13 @@ StatusOr<bool> HdfsScannerContext::should_skip_by_evaluating_not_existed_slots()
     return !(chunk->has_rows());
 }
 
+int64_t HdfsScannerContext::file_modification_time() const {
+    if (scan_ranges.empty() || !scan_ranges[0]->__isset.modification_time) {
+        return 0;
+    }
+    return scan_ranges[0]->modification_time;
+}
+
 void HdfsScannerContext::append_partition_column_to_chunk(vectorized::ChunkPtr* chunk, size_t row_count) {
     if (partition_columns.size() == 0) return;
 
@@ -39,11 +39,23 @@ struct HdfsScanStats {
     int64_t page_read_ns = 0;
     // reader init
     int64_t footer_read_ns = 0;
+    int64_t footer_cache_hit_count = 0;
     int64_t column_reader_init_ns = 0;
     // dict filter
     int64_t group_chunk_read_ns = 0;
     int64_t group_dict_filter_ns = 0;
     int64_t group_dict_decode_ns = 0;
+    // page index
+    int64_t page_index_read_ns = 0;
+    int64_t page_skip_rows = 0;
+    // bloom filter
+    int64_t bloom_filter_read_ns = 0;
+    // late materialization
+    int64_t late_materialize_skip_rows = 0;
+    // coalesced reads of the shared buffers
+    int64_t shared_io_count = 0;
+    int64_t shared_io_bytes = 0;
+    int64_t shared_io_ns = 0;
 };
 
 class HdfsParquetProfile;
@@ -165,6 +177,9 @@ struct HdfsScannerContext {
     std::vector<SlotDescriptor*> not_existed_slots;
     std::vector<ExprContext*> conjunct_ctxs_of_non_existed_slots;
 
+    // the modification time of the file to scan, or 0 if it's unknown.
+    int64_t file_modification_time() const;
+
     // other helper functions.
     void append_partition_column_to_chunk(vectorized::ChunkPtr* chunk, size_t row_count);
     bool can_use_dict_filter_on_slot(SlotDescriptor* slot) const;
@@ -231,6 +246,8 @@ private:
     bool _is_closed = false;
     bool _keep_priority = false;
     Status _build_scanner_context();
+    // read the remote file through the block cache if it's enabled
+    Status _open_block_cache_file();
     MonotonicStopWatch _pending_queue_sw;
     void update_hdfs_counter(HdfsScanProfile* profile);
 
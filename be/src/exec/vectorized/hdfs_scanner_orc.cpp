@@ -5,6 +5,7 @@
 #include <utility>
 
 #include "exec/exec_node.h"
+#include "formats/footer_cache.h"
 #include "fs/fs.h"
 #include "gen_cpp/orc_proto.pb.h"
 #include "storage/chunk_helper.h"
@@ -379,9 +380,29 @@ Status HdfsOrcScanner::do_open(RuntimeState* runtime_state) {
             std::make_unique<ORCHdfsFileStream>(_file.get(), _scanner_params.scan_ranges[0]->file_length, &_stats);
     SCOPED_RAW_TIMER(&_stats.reader_init_ns);
     std::unique_ptr<orc::Reader> reader;
+    auto* footer_cache = FooterCache::instance();
+    std::string footer_cache_key;
+    std::shared_ptr<const std::string> file_tail;
+    if (footer_cache != nullptr) {
+        footer_cache_key = FooterCache::encode_key("orc", _scanner_params.path,
+                                                   _scanner_params.scan_ranges[0]->file_length,
+                                                   _scanner_ctx.file_modification_time());
+        file_tail = footer_cache->lookup<std::string>(footer_cache_key);
+        if (file_tail != nullptr) {
+            _stats.footer_cache_hit_count++;
+        }
+    }
     try {
         orc::ReaderOptions options;
+        if (file_tail != nullptr) {
+            // the reader parses the cached file tail instead of reading it from the file.
+            options.setSerializedFileTail(*file_tail);
+        }
         reader = orc::createReader(std::move(input_stream), options);
+        if (footer_cache != nullptr && file_tail == nullptr) {
+            auto tail = std::make_shared<const std::string>(reader->getSerializedFileTail());
+            footer_cache->insert<std::string>(footer_cache_key, tail, tail->size());
+        }
     } catch (std::exception& e) {
         auto s = strings::Substitute("HdfsOrcScanner::do_open failed. reason = $0", e.what());
         LOG(WARNING) << s;
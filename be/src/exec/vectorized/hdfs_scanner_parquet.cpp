@@ -16,6 +16,7 @@ public:
 
     // reader init
     RuntimeProfile::Counter* footer_read_timer = nullptr;
+    RuntimeProfile::Counter* footer_cache_hit_counter = nullptr;
     RuntimeProfile::Counter* column_reader_init_timer = nullptr;
 
     // dict filter
@@ -23,6 +24,21 @@ public:
     RuntimeProfile::Counter* group_dict_filter_timer = nullptr;
     RuntimeProfile::Counter* group_dict_decode_timer = nullptr;
 
+    // page index
+    RuntimeProfile::Counter* page_index_read_timer = nullptr;
+    RuntimeProfile::Counter* page_skip_rows_counter = nullptr;
+
+    // bloom filter
+    RuntimeProfile::Counter* bloom_filter_read_timer = nullptr;
+
+    // late materialization
+    RuntimeProfile::Counter* late_materialize_skip_rows_counter = nullptr;
+
+    // shared buffers
+    RuntimeProfile::Counter* shared_io_count = nullptr;
+    RuntimeProfile::Counter* shared_io_bytes = nullptr;
+    RuntimeProfile::Counter* shared_io_timer = nullptr;
+
     void init(RuntimeProfile* root);
 };
 
@@ -35,11 +51,24 @@ void HdfsParquetProfile::init(RuntimeProfile* root) {
 
     page_read_timer = ADD_CHILD_TIMER(root, "PageReadTime", kParquetProfileSectionPrefix);
     footer_read_timer = ADD_CHILD_TIMER(root, "ReaderInitFooterRead", kParquetProfileSectionPrefix);
+    footer_cache_hit_counter = ADD_CHILD_COUNTER(root, "FooterCacheHit", TUnit::UNIT, kParquetProfileSectionPrefix);
     column_reader_init_timer = ADD_CHILD_TIMER(root, "ReaderInitColumnReaderInit", kParquetProfileSectionPrefix);
 
     group_chunk_read_timer = ADD_CHILD_TIMER(root, "GroupChunkRead", kParquetProfileSectionPrefix);
     group_dict_filter_timer = ADD_CHILD_TIMER(root, "GroupDictFilter", kParquetProfileSectionPrefix);
     group_dict_decode_timer = ADD_CHILD_TIMER(root, "GroupDictDecode", kParquetProfileSectionPrefix);
+
+    page_index_read_timer = ADD_CHILD_TIMER(root, "PageIndexRead", kParquetProfileSectionPrefix);
+    page_skip_rows_counter = ADD_CHILD_COUNTER(root, "PageSkipRows", TUnit::UNIT, kParquetProfileSectionPrefix);
+
+    bloom_filter_read_timer = ADD_CHILD_TIMER(root, "BloomFilterRead", kParquetProfileSectionPrefix);
+
+    late_materialize_skip_rows_counter =
+            ADD_CHILD_COUNTER(root, "LateMaterializeSkipRows", TUnit::UNIT, kParquetProfileSectionPrefix);
+
+    shared_io_count = ADD_CHILD_COUNTER(root, "SharedIOCount", TUnit::UNIT, kParquetProfileSectionPrefix);
+    shared_io_bytes = ADD_CHILD_COUNTER(root, "SharedIOBytes", TUnit::BYTES, kParquetProfileSectionPrefix);
+    shared_io_timer = ADD_CHILD_TIMER(root, "SharedIOTime", kParquetProfileSectionPrefix);
 }
 
 Status HdfsParquetScanner::do_init(RuntimeState* runtime_state, const HdfsScannerParams& scanner_params) {
@@ -59,10 +88,18 @@ void HdfsParquetScanner::do_update_counter(HdfsScanProfile* profile) {
         COUNTER_UPDATE(parquet_profile->level_decode_timer, _stats.level_decode_ns);
         COUNTER_UPDATE(parquet_profile->page_read_timer, _stats.page_read_ns);
         COUNTER_UPDATE(parquet_profile->footer_read_timer, _stats.footer_read_ns);
+        COUNTER_UPDATE(parquet_profile->footer_cache_hit_counter, _stats.footer_cache_hit_count);
         COUNTER_UPDATE(parquet_profile->column_reader_init_timer, _stats.column_reader_init_ns);
         COUNTER_UPDATE(parquet_profile->group_chunk_read_timer, _stats.group_chunk_read_ns);
         COUNTER_UPDATE(parquet_profile->group_dict_filter_timer, _stats.group_dict_filter_ns);
         COUNTER_UPDATE(parquet_profile->group_dict_decode_timer, _stats.group_dict_decode_ns);
+        COUNTER_UPDATE(parquet_profile->page_index_read_timer, _stats.page_index_read_ns);
+        COUNTER_UPDATE(parquet_profile->page_skip_rows_counter, _stats.page_skip_rows);
+        COUNTER_UPDATE(parquet_profile->bloom_filter_read_timer, _stats.bloom_filter_read_ns);
+        COUNTER_UPDATE(parquet_profile->late_materialize_skip_rows_counter, _stats.late_materialize_skip_rows);
+        COUNTER_UPDATE(parquet_profile->shared_io_count, _stats.shared_io_count);
+        COUNTER_UPDATE(parquet_profile->shared_io_bytes, _stats.shared_io_bytes);
+        COUNTER_UPDATE(parquet_profile->shared_io_timer, _stats.shared_io_ns);
     }
 }
 
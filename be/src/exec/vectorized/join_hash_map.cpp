@@ -6,6 +6,10 @@
 #include <gen_cpp/PlanNodes_types.h>
 #include <runtime/descriptors.h>
 
+#include <algorithm>
+#include <limits>
+
+#include "common/config.h"
 #include "exec/vectorized/hash_join_node.h"
 #include "serde/column_array_serde.h"
 #include "simd/simd.h"
@@ -14,9 +18,10 @@ namespace starrocks::vectorized {
 
 void SerializedJoinBuildFunc::prepare(RuntimeState* state, JoinHashTableItems* table_items) {
     table_items->bucket_size = JoinHashMapHelper::calc_bucket_size(table_items->row_count + 1);
-    table_items->first.resize(table_items->bucket_size, 0);
-    table_items->next.resize(table_items->row_count + 1, 0);
+    resize_on_huge_pages(&table_items->first, table_items->bucket_size, 0);
+    resize_on_huge_pages(&table_items->next, table_items->row_count + 1, 0);
     table_items->build_slice.resize(table_items->row_count + 1);
+    table_items->build_slice_hash.resize(table_items->row_count + 1, 0);
     table_items->build_pool = std::make_unique<MemPool>();
 }
 
@@ -74,8 +79,9 @@ void SerializedJoinBuildFunc::_build_columns(JoinHashTableItems* table_items, Ha
                                              uint8_t** ptr) {
     for (size_t i = 0; i < count; i++) {
         table_items->build_slice[start + i] = JoinHashMapHelper::get_hash_key(data_columns, start + i, *ptr);
-        probe_state->buckets[i] = JoinHashMapHelper::calc_bucket_num<Slice>(table_items->build_slice[start + i],
-                                                                            table_items->bucket_size);
+        table_items->build_slice_hash[start + i] =
+                JoinHashMapHelper::calc_hash<Slice>(table_items->build_slice[start + i]);
+        probe_state->buckets[i] = table_items->build_slice_hash[start + i] & (table_items->bucket_size - 1);
         *ptr += table_items->build_slice[start + i].size;
     }
 
@@ -100,8 +106,9 @@ void SerializedJoinBuildFunc::_build_nullable_columns(JoinHashTableItems* table_
     for (size_t i = 0; i < count; i++) {
         if (probe_state->is_nulls[i] == 0) {
             table_items->build_slice[start + i] = JoinHashMapHelper::get_hash_key(data_columns, start + i, *ptr);
-            probe_state->buckets[i] = JoinHashMapHelper::calc_bucket_num<Slice>(table_items->build_slice[start + i],
-                                                                                table_items->bucket_size);
+            table_items->build_slice_hash[start + i] =
+                    JoinHashMapHelper::calc_hash<Slice>(table_items->build_slice[start + i]);
+            probe_state->buckets[i] = table_items->build_slice_hash[start + i] & (table_items->bucket_size - 1);
             *ptr += table_items->build_slice[start + i].size;
         }
     }
@@ -154,15 +161,25 @@ void SerializedJoinProbeFunc::_probe_column(const JoinHashTableItems& table_item
                                             const Columns& data_columns, uint8_t* ptr) {
     uint32_t row_count = probe_state->probe_row_count;
 
+    // Serialize and hash all the rows first, so that the buckets can be prefetched ahead of the lookups.
     for (uint32_t i = 0; i < row_count; i++) {
         probe_state->probe_slice[i] = JoinHashMapHelper::get_hash_key(data_columns, i, ptr);
-        probe_state->buckets[i] =
-                JoinHashMapHelper::calc_bucket_num<Slice>(probe_state->probe_slice[i], table_items.bucket_size);
+        probe_state->probe_slice_hash[i] = JoinHashMapHelper::calc_hash<Slice>(probe_state->probe_slice[i]);
+        probe_state->buckets[i] = probe_state->probe_slice_hash[i] & (table_items.bucket_size - 1);
         ptr += probe_state->probe_slice[i].size;
     }
 
-    for (uint32_t i = 0; i < row_count; i++) {
-        probe_state->next[i] = table_items.first[probe_state->buckets[i]];
+    if (table_items.enable_prefetch) {
+        for (uint32_t i = 0; i < row_count; i++) {
+            if (i + BUCKET_PREFETCH_DISTANCE < row_count) {
+                PREFETCH(&table_items.first[probe_state->buckets[i + BUCKET_PREFETCH_DISTANCE]]);
+            }
+            probe_state->next[i] = table_items.first[probe_state->buckets[i]];
+        }
+    } else {
+        for (uint32_t i = 0; i < row_count; i++) {
+            probe_state->next[i] = table_items.first[probe_state->buckets[i]];
+        }
     }
 }
 
@@ -189,12 +206,18 @@ void SerializedJoinProbeFunc::_probe_nullable_column(const JoinHashTableItems& t
 
     for (uint32_t i = 0; i < row_count; i++) {
         if (probe_state->is_nulls[i] == 0) {
-            probe_state->buckets[i] =
-                    JoinHashMapHelper::calc_bucket_num<Slice>(probe_state->probe_slice[i], table_items.bucket_size);
-            probe_state->next[i] = table_items.first[probe_state->buckets[i]];
+            probe_state->probe_slice_hash[i] = JoinHashMapHelper::calc_hash<Slice>(probe_state->probe_slice[i]);
+            probe_state->buckets[i] = probe_state->probe_slice_hash[i] & (table_items.bucket_size - 1);
         } else {
-            probe_state->next[i] = 0;
+            probe_state->buckets[i] = 0;
+        }
+    }
+
+    for (uint32_t i = 0; i < row_count; i++) {
+        if (table_items.enable_prefetch && i + BUCKET_PREFETCH_DISTANCE < row_count) {
+            PREFETCH(&table_items.first[probe_state->buckets[i + BUCKET_PREFETCH_DISTANCE]]);
         }
+        probe_state->next[i] = probe_state->is_nulls[i] == 0 ? table_items.first[probe_state->buckets[i]] : 0;
     }
 }
 
@@ -368,6 +391,8 @@ Status JoinHashTable::build(RuntimeState* state) {
     RETURN_IF_ERROR(_upgrade_key_columns_if_overflow());
 
     _hash_map_type = _choose_join_hash_map();
+    _table_items->enable_prefetch =
+            config::enable_prefetch && _table_items->row_count >= config::join_hash_table_prefetch_min_rows;
 
     switch (_hash_map_type) {
     case JoinHashMapType::empty:
@@ -519,6 +544,55 @@ Status JoinHashTable::_upgrade_key_columns_if_overflow() {
     return Status::OK();
 }
 
+template <PrimitiveType PT>
+bool JoinHashTable::_init_range_direct_mapping() {
+    using ColumnType = typename RunTimeTypeTraits<PT>::ColumnType;
+    using CppType = typename RunTimeTypeTraits<PT>::CppType;
+
+    const int64_t max_range_ratio = config::join_hash_table_direct_mapping_max_range_ratio;
+    const uint32_t row_count = _table_items->row_count;
+    if (max_range_ratio <= 0 || row_count == 0) {
+        return false;
+    }
+
+    const Column* key_column = _table_items->key_columns[0].get();
+    const uint8_t* nulls = nullptr;
+    if (key_column->is_nullable()) {
+        const auto* nullable_column = down_cast<const NullableColumn*>(key_column);
+        nulls = nullable_column->null_column()->get_data().data();
+        key_column = nullable_column->data_column().get();
+    }
+    const auto& data = down_cast<const ColumnType*>(key_column)->get_data();
+
+    // The row 0 is reserved by the hash table.
+    CppType min_value = std::numeric_limits<CppType>::max();
+    CppType max_value = std::numeric_limits<CppType>::min();
+    bool has_value = false;
+    for (size_t i = 1; i < row_count + 1; i++) {
+        if (nulls == nullptr || nulls[i] == 0) {
+            min_value = std::min(min_value, data[i]);
+            max_value = std::max(max_value, data[i]);
+            has_value = true;
+        }
+    }
+    if (!has_value) {
+        return false;
+    }
+
+    // In uint64_t, since the range of BIGINT keys may overflow int64_t.
+    const uint64_t range = static_cast<uint64_t>(static_cast<int64_t>(max_value)) -
+                           static_cast<uint64_t>(static_cast<int64_t>(min_value));
+    const uint64_t max_range = std::min<uint64_t>(JoinHashMapHelper::MAX_BUCKET_SIZE - 1,
+                                                  static_cast<uint64_t>(row_count) * max_range_ratio);
+    if (range >= max_range) {
+        return false;
+    }
+
+    _table_items->min_key_value = min_value;
+    _table_items->max_key_value = max_value;
+    return true;
+}
+
 JoinHashMapType JoinHashTable::_choose_join_hash_map() {
     size_t size = _table_items->join_keys.size();
     DCHECK_GT(size, 0);
@@ -538,9 +612,9 @@ JoinHashMapType JoinHashTable::_choose_join_hash_map() {
         case PrimitiveType::TYPE_SMALLINT:
             return JoinHashMapType::key16;
         case PrimitiveType::TYPE_INT:
-            return JoinHashMapType::key32;
+            return _init_range_direct_mapping<TYPE_INT>() ? JoinHashMapType::keyrange32 : JoinHashMapType::key32;
         case PrimitiveType::TYPE_BIGINT:
-            return JoinHashMapType::key64;
+            return _init_range_direct_mapping<TYPE_BIGINT>() ? JoinHashMapType::keyrange64 : JoinHashMapType::key64;
         case PrimitiveType::TYPE_LARGEINT:
             return JoinHashMapType::key128;
         case PrimitiveType::TYPE_FLOAT:
@@ -7,10 +7,13 @@
 #include <runtime/runtime_state.h>
 
 #include <cstdint>
+#include <type_traits>
 
 #include "column/chunk.h"
 #include "column/column_hash.h"
 #include "column/column_helper.h"
+#include "common/compiler_util.h"
+#include "util/huge_page.h"
 #include "util/phmap/phmap.h"
 
 #if defined(__aarch64__)
@@ -27,6 +30,8 @@ class ColumnRef;
     M(key32)                       \
     M(key64)                       \
     M(key128)                      \
+    M(keyrange32)                  \
+    M(keyrange64)                  \
     M(keyfloat)                    \
     M(keydouble)                   \
     M(keystring)                   \
@@ -49,6 +54,8 @@ enum class JoinHashMapType {
     key32,
     key64,
     key128,
+    keyrange32,
+    keyrange64,
     keyfloat,
     keydouble,
     keystring,
@@ -96,6 +103,9 @@ struct JoinHashTableItems {
     Buffer<uint32_t> first;
     Buffer<uint32_t> next;
     Buffer<Slice> build_slice;
+    // The hash values of build_slice, which are compared before the key bytes of build_slice during probing,
+    // so that most of the mismatched keys in a bucket are skipped without touching the key bytes.
+    Buffer<uint32_t> build_slice_hash;
     ColumnPtr build_key_column;
     uint32_t bucket_size = 0;
     uint32_t row_count = 0; // real row count
@@ -106,6 +116,12 @@ struct JoinHashTableItems {
     bool left_to_nullable = false;
     bool right_to_nullable = false;
     bool has_large_column = false;
+    // The min and max non-null build keys of the range direct mapping hash maps, i.e. keyrange32 and keyrange64.
+    int64_t min_key_value = 0;
+    int64_t max_key_value = 0;
+    // Whether to prefetch the build rows during probing, which pays off only when the hash table is too large to
+    // fit in the CPU cache.
+    bool enable_prefetch = false;
 
     TJoinOp::type join_type = TJoinOp::INNER_JOIN;
 
@@ -123,6 +139,7 @@ struct HashTableProbeState {
     Buffer<uint32_t> probe_index;
     Buffer<uint32_t> next;
     Buffer<Slice> probe_slice;
+    Buffer<uint32_t> probe_slice_hash;
     Buffer<uint8_t>* null_array = nullptr;
     ColumnPtr probe_key_column;
     const Columns* key_columns = nullptr;
@@ -167,6 +184,7 @@ struct HashTableProbeState {
               probe_index(rhs.probe_index),
               next(rhs.next),
               probe_slice(rhs.probe_slice),
+              probe_slice_hash(rhs.probe_slice_hash),
               null_array(rhs.null_array),
               probe_key_column(rhs.probe_key_column == nullptr ? nullptr : rhs.probe_key_column->clone()),
               key_columns(rhs.key_columns),
@@ -264,6 +282,13 @@ public:
         return HashFunc()(value) & (bucket_size - 1);
     }
 
+    template <typename CppType>
+    static uint32_t calc_hash(const CppType& value) {
+        using HashFunc = JoinKeyHash<CppType>;
+
+        return HashFunc()(value);
+    }
+
     template <typename CppType>
     static void calc_bucket_nums(const Buffer<CppType>& data, uint32_t bucket_size, Buffer<uint32_t>* buckets,
                                  uint32_t start, uint32_t count) {
@@ -323,6 +348,22 @@ public:
                                      HashTableProbeState* probe_state);
 };
 
+// Direct mapping for the keys in [min_key_value, max_key_value] of JoinHashTableItems, whose range is not much
+// larger than the number of build rows, e.g. the dense surrogate keys of a dimension table.
+template <PrimitiveType PT>
+class RangeDirectMappingJoinBuildFunc {
+public:
+    using CppType = typename RunTimeTypeTraits<PT>::CppType;
+    using ColumnType = typename RunTimeTypeTraits<PT>::ColumnType;
+
+    static void prepare(RuntimeState* runtime, JoinHashTableItems* table_items);
+    static const Buffer<CppType>& get_key_data(const JoinHashTableItems& table_items) {
+        return DirectMappingJoinBuildFunc<PT>::get_key_data(table_items);
+    }
+    static void construct_hash_table(RuntimeState* state, JoinHashTableItems* table_items,
+                                     HashTableProbeState* probe_state);
+};
+
 template <PrimitiveType PT>
 class FixedSizeJoinBuildFunc {
 public:
@@ -386,6 +427,21 @@ public:
     static bool equal(const CppType& x, const CppType& y) { return true; }
 };
 
+template <PrimitiveType PT>
+class RangeDirectMappingJoinProbeFunc {
+public:
+    using CppType = typename RunTimeTypeTraits<PT>::CppType;
+    using ColumnType = typename RunTimeTypeTraits<PT>::ColumnType;
+
+    static void prepare(RuntimeState* state, HashTableProbeState* probe_state) {}
+    // The keys out of [min_key_value, max_key_value] are not matched.
+    static void lookup_init(const JoinHashTableItems& table_items, HashTableProbeState* probe_state);
+    static const Buffer<CppType>& get_key_data(const HashTableProbeState& probe_state) {
+        return DirectMappingJoinProbeFunc<PT>::get_key_data(probe_state);
+    }
+    static bool equal(const CppType& x, const CppType& y) { return true; }
+};
+
 template <PrimitiveType PT>
 class FixedSizeJoinProbeFunc {
 public:
@@ -420,6 +476,7 @@ public:
     static void prepare(RuntimeState* state, HashTableProbeState* probe_state) {
         probe_state->probe_pool = std::make_unique<MemPool>();
         probe_state->probe_slice.resize(state->chunk_size());
+        probe_state->probe_slice_hash.resize(state->chunk_size());
         probe_state->is_nulls.resize(state->chunk_size());
     }
 
@@ -428,6 +485,9 @@ public:
     static bool equal(const Slice& x, const Slice& y) { return x == y; }
 
 private:
+    // How many rows ahead the bucket of a probe row is prefetched.
+    static constexpr uint32_t BUCKET_PREFETCH_DISTANCE = 16;
+
     static void _probe_column(const JoinHashTableItems& table_items, HashTableProbeState* probe_state,
                               const Columns& data_columns, uint8_t* ptr);
     static void _probe_nullable_column(const JoinHashTableItems& table_items, HashTableProbeState* probe_state,
@@ -473,6 +533,31 @@ private:
     template <bool first_probe>
     void _search_ht_impl(RuntimeState* state, const Buffer<CppType>& build_data, const Buffer<CppType>& data);
 
+    // Prefetch the first build row in the bucket of the probe row PREFETCH_DISTANCE rows after the current one,
+    // so that its cache misses overlap with the probing of the current rows.
+    void _prefetch_build_row(const Buffer<CppType>& build_data, size_t i) const {
+        if (_table_items->enable_prefetch && i + PREFETCH_DISTANCE < _probe_state->probe_row_count) {
+            const uint32_t build_index = _probe_state->next[i + PREFETCH_DISTANCE];
+            PREFETCH(&build_data[build_index]);
+            PREFETCH(&_table_items->next[build_index]);
+            if constexpr (std::is_same_v<ProbeFunc, SerializedJoinProbeFunc>) {
+                PREFETCH(&_table_items->build_slice_hash[build_index]);
+            }
+        }
+    }
+
+    // The serialized keys are compared by their hash values first, which are much cheaper to load and compare
+    // than the scattered key bytes.
+    bool _equal(const Buffer<CppType>& build_data, uint32_t build_index, const Buffer<CppType>& probe_data,
+                uint32_t probe_index) const {
+        if constexpr (std::is_same_v<ProbeFunc, SerializedJoinProbeFunc>) {
+            if (_table_items->build_slice_hash[build_index] != _probe_state->probe_slice_hash[probe_index]) {
+                return false;
+            }
+        }
+        return ProbeFunc().equal(build_data[build_index], probe_data[probe_index]);
+    }
+
     // for one key inner join
     template <bool first_probe>
     void _probe_from_ht(RuntimeState* state, const Buffer<CppType>& build_data, const Buffer<CppType>& probe_data);
@@ -547,12 +632,16 @@ private:
     void _probe_from_ht_for_full_outer_join_with_other_conjunct(RuntimeState* state, const Buffer<CppType>& build_data,
                                                                 const Buffer<CppType>& probe_data);
 
+    static constexpr size_t PREFETCH_DISTANCE = 16;
+
     JoinHashTableItems* _table_items = nullptr;
     HashTableProbeState* _probe_state = nullptr;
 };
 
 #define JoinHashMapForOneKey(PT) JoinHashMap<PT, JoinBuildFunc<PT>, JoinProbeFunc<PT>>
 #define JoinHashMapForDirectMapping(PT) JoinHashMap<PT, DirectMappingJoinBuildFunc<PT>, DirectMappingJoinProbeFunc<PT>>
+#define JoinHashMapForRangeDirectMapping(PT) \
+    JoinHashMap<PT, RangeDirectMappingJoinBuildFunc<PT>, RangeDirectMappingJoinProbeFunc<PT>>
 #define JoinHashMapForFixedSizeKey(PT) JoinHashMap<PT, FixedSizeJoinBuildFunc<PT>, FixedSizeJoinProbeFunc<PT>>
 #define JoinHashMapForSerializedKey(PT) JoinHashMap<PT, SerializedJoinBuildFunc, SerializedJoinProbeFunc>
 
@@ -585,6 +674,7 @@ public:
 
     const ChunkPtr& get_build_chunk() const { return _table_items->build_chunk; }
     Columns& get_key_columns() { return _table_items->key_columns; }
+    const Columns& get_key_columns() const { return _table_items->key_columns; }
     uint32_t get_row_count() const { return _table_items->row_count; }
     size_t get_probe_column_count() const { return _table_items->probe_column_count; }
     size_t get_build_column_count() const { return _table_items->build_column_count; }
@@ -596,6 +686,9 @@ public:
 
 private:
     JoinHashMapType _choose_join_hash_map();
+    // Return whether the build keys of PT fit the range direct mapping, and save their min and max if so.
+    template <PrimitiveType PT>
+    bool _init_range_direct_mapping();
     static size_t _get_size_of_fixed_and_contiguous_type(PrimitiveType data_type);
 
     Status _upgrade_key_columns_if_overflow();
@@ -614,6 +707,8 @@ private:
     std::unique_ptr<JoinHashMapForOneKey(TYPE_INT)> _key32 = nullptr;
     std::unique_ptr<JoinHashMapForOneKey(TYPE_BIGINT)> _key64 = nullptr;
     std::unique_ptr<JoinHashMapForOneKey(TYPE_LARGEINT)> _key128 = nullptr;
+    std::unique_ptr<JoinHashMapForRangeDirectMapping(TYPE_INT)> _keyrange32 = nullptr;
+    std::unique_ptr<JoinHashMapForRangeDirectMapping(TYPE_BIGINT)> _keyrange64 = nullptr;
     std::unique_ptr<JoinHashMapForOneKey(TYPE_FLOAT)> _keyfloat = nullptr;
     std::unique_ptr<JoinHashMapForOneKey(TYPE_DOUBLE)> _keydouble = nullptr;
     std::unique_ptr<JoinHashMapForOneKey(TYPE_VARCHAR)> _keystring = nullptr;
@@ -6,8 +6,8 @@ namespace starrocks::vectorized {
 template <PrimitiveType PT>
 void JoinBuildFunc<PT>::prepare(RuntimeState* runtime, JoinHashTableItems* table_items) {
     table_items->bucket_size = JoinHashMapHelper::calc_bucket_size(table_items->row_count + 1);
-    table_items->first.resize(table_items->bucket_size, 0);
-    table_items->next.resize(table_items->row_count + 1, 0);
+    resize_on_huge_pages(&table_items->first, table_items->bucket_size, 0);
+    resize_on_huge_pages(&table_items->next, table_items->row_count + 1, 0);
 }
 
 template <PrimitiveType PT>
@@ -60,8 +60,8 @@ void DirectMappingJoinBuildFunc<PT>::prepare(RuntimeState* runtime, JoinHashTabl
     static constexpr size_t BUCKET_SIZE =
             (int64_t)(RunTimeTypeLimits<PT>::max_value()) - (int64_t)(RunTimeTypeLimits<PT>::min_value()) + 1L;
     table_items->bucket_size = BUCKET_SIZE;
-    table_items->first.resize(table_items->bucket_size, 0);
-    table_items->next.resize(table_items->row_count + 1, 0);
+    resize_on_huge_pages(&table_items->first, table_items->bucket_size, 0);
+    resize_on_huge_pages(&table_items->next, table_items->row_count + 1, 0);
 }
 
 template <PrimitiveType PT>
@@ -100,11 +100,50 @@ void DirectMappingJoinBuildFunc<PT>::construct_hash_table(RuntimeState* state, J
     }
 }
 
+// The offsets are computed in uint64_t to avoid the overflow of int64_t, which also maps the keys less than
+// min_key_value to the offsets larger than the bucket size.
+template <typename CppType>
+static inline uint64_t range_direct_mapping_offset(CppType value, int64_t min_key_value) {
+    return static_cast<uint64_t>(static_cast<int64_t>(value)) - static_cast<uint64_t>(min_key_value);
+}
+
+template <PrimitiveType PT>
+void RangeDirectMappingJoinBuildFunc<PT>::prepare(RuntimeState* runtime, JoinHashTableItems* table_items) {
+    table_items->bucket_size =
+            range_direct_mapping_offset(table_items->max_key_value, table_items->min_key_value) + 1;
+    resize_on_huge_pages(&table_items->first, table_items->bucket_size, 0);
+    resize_on_huge_pages(&table_items->next, table_items->row_count + 1, 0);
+}
+
+template <PrimitiveType PT>
+void RangeDirectMappingJoinBuildFunc<PT>::construct_hash_table(RuntimeState* state, JoinHashTableItems* table_items,
+                                                               HashTableProbeState* probe_state) {
+    const int64_t min_key_value = table_items->min_key_value;
+    auto& data = get_key_data(*table_items);
+    if (table_items->key_columns[0]->is_nullable()) {
+        auto* nullable_column = ColumnHelper::as_raw_column<NullableColumn>(table_items->key_columns[0]);
+        auto& null_array = nullable_column->null_column()->get_data();
+        for (size_t i = 1; i < table_items->row_count + 1; i++) {
+            if (null_array[i] == 0) {
+                const uint64_t bucket = range_direct_mapping_offset(data[i], min_key_value);
+                table_items->next[i] = table_items->first[bucket];
+                table_items->first[bucket] = i;
+            }
+        }
+    } else {
+        for (size_t i = 1; i < table_items->row_count + 1; i++) {
+            const uint64_t bucket = range_direct_mapping_offset(data[i], min_key_value);
+            table_items->next[i] = table_items->first[bucket];
+            table_items->first[bucket] = i;
+        }
+    }
+}
+
 template <PrimitiveType PT>
 void FixedSizeJoinBuildFunc<PT>::prepare(RuntimeState* state, JoinHashTableItems* table_items) {
     table_items->bucket_size = JoinHashMapHelper::calc_bucket_size(table_items->row_count + 1);
-    table_items->first.resize(table_items->bucket_size, 0);
-    table_items->next.resize(table_items->row_count + 1, 0);
+    resize_on_huge_pages(&table_items->first, table_items->bucket_size, 0);
+    resize_on_huge_pages(&table_items->next, table_items->row_count + 1, 0);
     table_items->build_key_column = ColumnType::create(table_items->row_count + 1);
 }
 
@@ -226,6 +265,34 @@ void DirectMappingJoinProbeFunc<PT>::lookup_init(const JoinHashTableItems& table
     probe_state->null_array = nullptr;
 }
 
+template <PrimitiveType PT>
+void RangeDirectMappingJoinProbeFunc<PT>::lookup_init(const JoinHashTableItems& table_items,
+                                                      HashTableProbeState* probe_state) {
+    const int64_t min_key_value = table_items.min_key_value;
+    const uint64_t bucket_size = table_items.bucket_size;
+    size_t probe_row_count = probe_state->probe_row_count;
+    auto& data = get_key_data(*probe_state);
+
+    for (size_t i = 0; i < probe_row_count; i++) {
+        const uint64_t offset = range_direct_mapping_offset(data[i], min_key_value);
+        probe_state->next[i] = offset < bucket_size ? table_items.first[offset] : 0;
+    }
+
+    probe_state->null_array = nullptr;
+    if ((*probe_state->key_columns)[0]->is_nullable()) {
+        auto* nullable_column = ColumnHelper::as_raw_column<NullableColumn>((*probe_state->key_columns)[0]);
+        if (nullable_column->has_null()) {
+            auto& null_array = nullable_column->null_column()->get_data();
+            for (size_t i = 0; i < probe_row_count; i++) {
+                if (null_array[i] != 0) {
+                    probe_state->next[i] = 0;
+                }
+            }
+            probe_state->null_array = &null_array;
+        }
+    }
+}
+
 template <PrimitiveType PT>
 const Buffer<typename DirectMappingJoinProbeFunc<PT>::CppType>& DirectMappingJoinProbeFunc<PT>::get_key_data(
         const HashTableProbeState& probe_state) {
@@ -917,13 +984,14 @@ void JoinHashMap<PT, BuildFunc, ProbeFunc>::_probe_from_ht(RuntimeState* state,
 
     size_t probe_row_count = _probe_state->probe_row_count;
     for (; i < probe_row_count; i++) {
+        _prefetch_build_row(build_data, i);
         if constexpr (first_probe) {
             _probe_state->probe_match_filter[i] = 0;
         }
         size_t build_index = _probe_state->next[i];
         if (build_index != 0) {
             do {
-                if (ProbeFunc().equal(build_data[build_index], probe_data[i])) {
+                if (_equal(build_data, build_index, probe_data, i)) {
                     _probe_state->probe_index[match_count] = i;
                     _probe_state->build_index[match_count] = build_index;
                     match_count++;
@@ -977,6 +1045,7 @@ void JoinHashMap<PT, BuildFunc, ProbeFunc>::_probe_from_ht_for_left_outer_join(R
 
     size_t probe_row_count = _probe_state->probe_row_count;
     for (; i < probe_row_count; i++) {
+        _prefetch_build_row(build_data, i);
         size_t build_index = _probe_state->next[i];
         if (build_index == 0) {
             _probe_state->probe_index[match_count] = i;
@@ -987,7 +1056,7 @@ void JoinHashMap<PT, BuildFunc, ProbeFunc>::_probe_from_ht_for_left_outer_join(R
             RETURN_IF_CHUNK_FULL()
         } else {
             while (build_index != 0) {
-                if (ProbeFunc().equal(build_data[build_index], probe_data[i])) {
+                if (_equal(build_data, build_index, probe_data, i)) {
                     _probe_state->probe_index[match_count] = i;
                     _probe_state->build_index[match_count] = build_index;
                     match_count++;
@@ -1029,13 +1098,14 @@ void JoinHashMap<PT, BuildFunc, ProbeFunc>::_probe_from_ht_for_left_semi_join(Ru
     size_t match_count = 0;
     size_t probe_row_count = _probe_state->probe_row_count;
     for (size_t i = 0; i < probe_row_count; i++) {
+        _prefetch_build_row(build_data, i);
         size_t index = _probe_state->next[i];
         if (index == 0) {
             continue;
         }
 
         while (index != 0) {
-            if (ProbeFunc().equal(build_data[index], probe_data[i])) {
+            if (_equal(build_data, index, probe_data, i)) {
                 _probe_state->probe_index[match_count] = i;
                 match_count++;
                 break;
@@ -1060,6 +1130,7 @@ void JoinHashMap<PT, BuildFunc, ProbeFunc>::_probe_from_ht_for_left_anti_join(Ru
         _table_items->row_count != 0) {
         // process left anti join from not in
         for (size_t i = 0; i < probe_row_count; i++) {
+            _prefetch_build_row(build_data, i);
             size_t index = _probe_state->next[i];
             if ((*_probe_state->null_array)[i] == 1) {
                 continue;
@@ -1073,7 +1144,7 @@ void JoinHashMap<PT, BuildFunc, ProbeFunc>::_probe_from_ht_for_left_anti_join(Ru
 
             bool found = false;
             while (index != 0) {
-                if (ProbeFunc().equal(build_data[index], probe_data[i])) {
+                if (_equal(build_data, index, probe_data, i)) {
                     found = true;
                     break;
                 }
@@ -1086,6 +1157,7 @@ void JoinHashMap<PT, BuildFunc, ProbeFunc>::_probe_from_ht_for_left_anti_join(Ru
         }
     } else {
         for (size_t i = 0; i < probe_row_count; i++) {
+            _prefetch_build_row(build_data, i);
             size_t index = _probe_state->next[i];
             if (index == 0) {
                 _probe_state->probe_index[match_count] = i;
@@ -1094,7 +1166,7 @@ void JoinHashMap<PT, BuildFunc, ProbeFunc>::_probe_from_ht_for_left_anti_join(Ru
             }
             bool found = false;
             while (index != 0) {
-                if (ProbeFunc().equal(build_data[index], probe_data[i])) {
+                if (_equal(build_data, index, probe_data, i)) {
                     found = true;
                     break;
                 }
@@ -1130,13 +1202,14 @@ void JoinHashMap<PT, BuildFunc, ProbeFunc>::_probe_from_ht_for_right_outer_join(
 
     size_t probe_row_count = _probe_state->probe_row_count;
     for (; i < probe_row_count; i++) {
+        _prefetch_build_row(build_data, i);
         size_t build_index = _probe_state->next[i];
         if (build_index == 0) {
             continue;
         }
 
         while (build_index != 0) {
-            if (ProbeFunc().equal(build_data[build_index], probe_data[i])) {
+            if (_equal(build_data, build_index, probe_data, i)) {
                 _probe_state->probe_index[match_count] = i;
                 _probe_state->build_index[match_count] = build_index;
                 _probe_state->build_match_index[build_index] = 1;
@@ -1168,13 +1241,14 @@ void JoinHashMap<PT, BuildFunc, ProbeFunc>::_probe_from_ht_for_right_semi_join(R
 
     size_t probe_row_count = _probe_state->probe_row_count;
     for (; i < probe_row_count; i++) {
+        _prefetch_build_row(build_data, i);
         size_t build_index = _probe_state->next[i];
         if (build_index == 0) {
             continue;
         }
 
         while (build_index != 0) {
-            if (ProbeFunc().equal(build_data[build_index], probe_data[i])) {
+            if (_equal(build_data, build_index, probe_data, i)) {
                 if (_probe_state->build_match_index[build_index] == 0) {
                     _probe_state->probe_index[match_count] = i;
                     _probe_state->build_index[match_count] = build_index;
@@ -1198,13 +1272,14 @@ void JoinHashMap<PT, BuildFunc, ProbeFunc>::_probe_from_ht_for_right_anti_join(R
                                                                                const Buffer<CppType>& probe_data) {
     size_t probe_row_count = _probe_state->probe_row_count;
     for (size_t i = 0; i < probe_row_count; i++) {
+        _prefetch_build_row(build_data, i);
         size_t index = _probe_state->next[i];
         if (index == 0) {
             continue;
         }
 
         while (index != 0) {
-            if (ProbeFunc().equal(build_data[index], probe_data[i])) {
+            if (_equal(build_data, index, probe_data, i)) {
                 _probe_state->build_match_index[index] = 1;
             }
             index = _table_items->next[index];
@@ -1235,6 +1310,7 @@ void JoinHashMap<PT, BuildFunc, ProbeFunc>::_probe_from_ht_for_full_outer_join(R
 
     size_t probe_row_count = _probe_state->probe_row_count;
     for (; i < probe_row_count; i++) {
+        _prefetch_build_row(build_data, i);
         size_t build_index = _probe_state->next[i];
         if (build_index == 0) {
             _probe_state->probe_index[match_count] = i;
@@ -1244,7 +1320,7 @@ void JoinHashMap<PT, BuildFunc, ProbeFunc>::_probe_from_ht_for_full_outer_join(R
             RETURN_IF_CHUNK_FULL()
         } else {
             while (build_index != 0) {
-                if (ProbeFunc().equal(build_data[build_index], probe_data[i])) {
+                if (_equal(build_data, build_index, probe_data, i)) {
                     _probe_state->probe_index[match_count] = i;
                     _probe_state->build_index[match_count] = build_index;
                     _probe_state->build_match_index[build_index] = 1;
@@ -1293,6 +1369,7 @@ void JoinHashMap<PT, BuildFunc, ProbeFunc>::_probe_from_ht_for_left_outer_join_w
 
     size_t probe_row_count = _probe_state->probe_row_count;
     for (; i < probe_row_count; i++) {
+        _prefetch_build_row(build_data, i);
         size_t build_index = _probe_state->next[i];
         if (build_index == 0) {
             _probe_state->probe_index[match_count] = i;
@@ -1304,7 +1381,7 @@ void JoinHashMap<PT, BuildFunc, ProbeFunc>::_probe_from_ht_for_left_outer_join_w
         }
 
         while (build_index != 0) {
-            if (ProbeFunc().equal(build_data[build_index], probe_data[i])) {
+            if (_equal(build_data, build_index, probe_data, i)) {
                 _probe_state->probe_index[match_count] = i;
                 _probe_state->build_index[match_count] = build_index;
                 _probe_state->probe_match_index[i]++;
@@ -1352,13 +1429,14 @@ void JoinHashMap<PT, BuildFunc, ProbeFunc>::_probe_from_ht_for_left_semi_join_wi
 
     size_t probe_row_count = _probe_state->probe_row_count;
     for (; i < probe_row_count; i++) {
+        _prefetch_build_row(build_data, i);
         size_t build_index = _probe_state->next[i];
         if (build_index == 0) {
             continue;
         }
 
         while (build_index != 0) {
-            if (ProbeFunc().equal(build_data[build_index], probe_data[i])) {
+            if (_equal(build_data, build_index, probe_data, i)) {
                 _probe_state->probe_index[match_count] = i;
                 _probe_state->build_index[match_count] = build_index;
                 match_count++;
@@ -1397,6 +1475,7 @@ void JoinHashMap<PT, BuildFunc, ProbeFunc>::_probe_from_ht_for_left_anti_join_wi
 
     size_t probe_row_count = _probe_state->probe_row_count;
     for (; i < probe_row_count; i++) {
+        _prefetch_build_row(build_data, i);
         size_t build_index = _probe_state->next[i];
         if (build_index == 0) {
             _probe_state->probe_index[match_count] = i;
@@ -1408,7 +1487,7 @@ void JoinHashMap<PT, BuildFunc, ProbeFunc>::_probe_from_ht_for_left_anti_join_wi
         }
 
         while (build_index != 0) {
-            if (ProbeFunc().equal(build_data[build_index], probe_data[i])) {
+            if (_equal(build_data, build_index, probe_data, i)) {
                 _probe_state->probe_index[match_count] = i;
                 _probe_state->build_index[match_count] = build_index;
                 _probe_state->probe_match_index[i]++;
@@ -1444,13 +1523,14 @@ void JoinHashMap<PT, BuildFunc, ProbeFunc>::_probe_from_ht_for_right_outer_join_
 
     size_t probe_row_count = _probe_state->probe_row_count;
     for (; i < probe_row_count; i++) {
+        _prefetch_build_row(build_data, i);
         size_t build_index = _probe_state->next[i];
         if (build_index == 0) {
             continue;
         }
 
         while (build_index != 0) {
-            if (ProbeFunc().equal(build_data[build_index], probe_data[i])) {
+            if (_equal(build_data, build_index, probe_data, i)) {
                 _probe_state->probe_index[match_count] = i;
                 _probe_state->build_index[match_count] = build_index;
                 match_count++;
@@ -1475,13 +1555,14 @@ void JoinHashMap<PT, BuildFunc, ProbeFunc>::_probe_from_ht_for_right_semi_join_w
 
     size_t probe_row_count = _probe_state->probe_row_count;
     for (; i < probe_row_count; i++) {
+        _prefetch_build_row(build_data, i);
         size_t build_index = _probe_state->next[i];
         if (build_index == 0) {
             continue;
         }
 
         while (build_index != 0) {
-            if (ProbeFunc().equal(build_data[build_index], probe_data[i])) {
+            if (_equal(build_data, build_index, probe_data, i)) {
                 _probe_state->probe_index[match_count] = i;
                 _probe_state->build_index[match_count] = build_index;
                 match_count++;
@@ -1506,13 +1587,14 @@ void JoinHashMap<PT, BuildFunc, ProbeFunc>::_probe_from_ht_for_right_anti_join_w
 
     size_t probe_row_count = _probe_state->probe_row_count;
     for (; i < probe_row_count; i++) {
+        _prefetch_build_row(build_data, i);
         size_t build_index = _probe_state->next[i];
         if (build_index == 0) {
             continue;
         }
 
         while (build_index != 0) {
-            if (ProbeFunc().equal(build_data[build_index], probe_data[i])) {
+            if (_equal(build_data, build_index, probe_data, i)) {
                 _probe_state->probe_index[match_count] = i;
                 _probe_state->build_index[match_count] = build_index;
                 match_count++;
@@ -1550,6 +1632,7 @@ void JoinHashMap<PT, BuildFunc, ProbeFunc>::_probe_from_ht_for_full_outer_join_w
 
     size_t probe_row_count = _probe_state->probe_row_count;
     for (; i < probe_row_count; i++) {
+        _prefetch_build_row(build_data, i);
         size_t build_index = _probe_state->next[i];
         if (build_index == 0) {
             _probe_state->probe_index[match_count] = i;
@@ -1559,7 +1642,7 @@ void JoinHashMap<PT, BuildFunc, ProbeFunc>::_probe_from_ht_for_full_outer_join_w
             RETURN_IF_CHUNK_FULL()
         } else {
             while (build_index != 0) {
-                if (ProbeFunc().equal(build_data[build_index], probe_data[i])) {
+                if (_equal(build_data, build_index, probe_data, i)) {
                     _probe_state->probe_index[match_count] = i;
                     _probe_state->build_index[match_count] = build_index;
                     _probe_state->probe_match_index[i]++;
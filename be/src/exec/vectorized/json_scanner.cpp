@@ -321,6 +321,8 @@ Status JsonReader::open() {
 
     if (_scanner->_json_paths.empty() && _scanner->_root_paths.empty()) {
         RETURN_IF_ERROR(_build_slot_descs());
+    } else if (!_scanner->_json_paths.empty()) {
+        _build_json_path_order();
     }
 
     _closed = false;
@@ -571,12 +573,8 @@ Status JsonReader::_construct_row(simdjson::ondemand::object* row, Chunk* chunk)
     } else {
         // With json path.
 
-        size_t slot_size = _slot_descs.size();
         size_t jsonpath_size = _scanner->_json_paths.size();
-        for (size_t i = 0; i < slot_size; i++) {
-            if (_slot_descs[i] == nullptr) {
-                continue;
-            }
+        for (size_t i : _json_path_order) {
             const char* column_name = _slot_descs[i]->col_name().c_str();
 
             // The columns in JsonReader's chunk are all in NullableColumn type;
@@ -686,6 +684,49 @@ Status JsonReader::_build_slot_descs() {
     return Status::OK();
 }
 
+void JsonReader::_build_json_path_order() {
+    // the slots of each top-level key.
+    std::unordered_map<std::string, std::vector<size_t>> top_level_slots;
+    std::vector<size_t> other_slots;
+    const auto& json_paths = _scanner->_json_paths;
+    for (size_t i = 0; i < _slot_descs.size(); i++) {
+        if (_slot_descs[i] == nullptr) {
+            continue;
+        }
+        if (i < json_paths.size() && json_paths[i].size() == 2 && json_paths[i][1].is_valid &&
+            json_paths[i][1].idx == -1) {
+            top_level_slots[json_paths[i][1].key].push_back(i);
+        } else {
+            other_slots.push_back(i);
+        }
+    }
+
+    _json_path_order.clear();
+    // The json root is extracted from the first row by the parser, so the keys of the first row are not known here.
+    simdjson::ondemand::object obj;
+    if (_scanner->_root_paths.empty() && _parser->get_current(&obj).ok()) {
+        std::ostringstream oss;
+        try {
+            for (auto field : obj) {
+                oss << field.key();
+                auto itr = top_level_slots.find(oss.str());
+                oss.str("");
+                if (itr != top_level_slots.end()) {
+                    _json_path_order.insert(_json_path_order.end(), itr->second.begin(), itr->second.end());
+                    top_level_slots.erase(itr);
+                }
+            }
+        } catch (simdjson::simdjson_error& e) {
+            // The error would be reported when the row is constructed.
+        }
+    }
+    // the top-level keys not in the first object.
+    for (const auto& kv : top_level_slots) {
+        _json_path_order.insert(_json_path_order.end(), kv.second.begin(), kv.second.end());
+    }
+    _json_path_order.insert(_json_path_order.end(), other_slots.begin(), other_slots.end());
+}
+
 // read one json string from file read and parse it to json doc.
 Status JsonReader::_read_and_parse_json() {
     uint8_t* data{};
@@ -94,6 +94,9 @@ private:
     // _build_slot_descs builds _slot_descs as the order of first json object and builds _slot_desc_dict;
     Status _build_slot_descs();
 
+    // _build_json_path_order builds _json_path_order with the top-level jsonpaths as the order of first json object.
+    void _build_json_path_order();
+
 private:
     RuntimeState* _state = nullptr;
     ScannerCounter* _counter = nullptr;
@@ -104,6 +107,11 @@ private:
     bool _closed;
     std::vector<SlotDescriptor*> _slot_descs;
     std::unordered_map<std::string, SlotDescriptor*> _slot_desc_dict;
+    // The indexes of the slots extracted by the jsonpaths, in the order of extraction.
+    // The slots of the top-level jsonpaths, e.g. "$.k1", come first in the key order of the first json object, so
+    // that the fields of a row with the same key order are found in one pass over the object, instead of a lookup
+    // from the beginning of the object for each field out of order.
+    std::vector<size_t> _json_path_order;
 
     // For performance reason, the simdjson parser should be reused over several files.
     //https://github.com/simdjson/simdjson/blob/master/doc/performance.md
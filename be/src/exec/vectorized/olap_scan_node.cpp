@@ -17,6 +17,7 @@
 #include "exprs/expr_context.h"
 #include "exprs/vectorized/runtime_filter_bank.h"
 #include "glog/logging.h"
+#include "gutil/strings/substitute.h"
 #include "runtime/current_thread.h"
 #include "runtime/descriptors.h"
 #include "runtime/exec_env.h"
@@ -350,14 +351,14 @@ StatusOr<pipeline::MorselQueuePtr> OlapScanNode::convert_scan_range_to_morsel_qu
     bool enable =
             query_options.__isset.enable_tablet_internal_parallel && query_options.enable_tablet_internal_parallel;
     if (!enable) {
-        return std::make_unique<pipeline::FixedMorselQueue>(std::move(morsels));
+        return _create_fixed_morsel_queue(std::move(morsels), scan_ranges);
     }
 
     int64_t scan_dop;
     int64_t splitted_scan_rows;
     ASSIGN_OR_RETURN(auto could, _could_tablet_internal_parallel(scan_ranges, request, &scan_dop, &splitted_scan_rows));
     if (!could) {
-        return std::make_unique<pipeline::FixedMorselQueue>(std::move(morsels));
+        return _create_fixed_morsel_queue(std::move(morsels), scan_ranges);
     }
 
     // Split tablet physically.
@@ -369,6 +370,25 @@ StatusOr<pipeline::MorselQueuePtr> OlapScanNode::convert_scan_range_to_morsel_qu
     return std::make_unique<pipeline::LogicalSplitMorselQueue>(std::move(morsels), scan_dop, splitted_scan_rows);
 }
 
+StatusOr<pipeline::MorselQueuePtr> OlapScanNode::_create_fixed_morsel_queue(
+        pipeline::Morsels&& morsels, const std::vector<TScanRangeParams>& scan_ranges) const {
+    pipeline::MorselQueuePtr morsel_queue = std::make_unique<pipeline::FixedMorselQueue>(std::move(morsels));
+    if (!config::enable_pipeline_adaptive_scan_dop || config::pipeline_adaptive_scan_dop_rows_per_driver <= 0) {
+        return morsel_queue;
+    }
+
+    int64_t num_table_rows = 0;
+    for (const auto& tablet_scan_range : scan_ranges) {
+        ASSIGN_OR_RETURN(TabletSharedPtr tablet, get_tablet(&(tablet_scan_range.scan_range.internal_scan_range)));
+        num_table_rows += static_cast<int64_t>(tablet->num_rows());
+    }
+    // Round up, so that each driver reads at most pipeline_adaptive_scan_dop_rows_per_driver rows on average.
+    int64_t max_dop = (num_table_rows + config::pipeline_adaptive_scan_dop_rows_per_driver - 1) /
+                      config::pipeline_adaptive_scan_dop_rows_per_driver;
+    morsel_queue->set_max_degree_of_parallelism(max_dop);
+    return morsel_queue;
+}
+
 StatusOr<bool> OlapScanNode::_could_tablet_internal_parallel(const std::vector<TScanRangeParams>& scan_ranges,
                                                              const TExecPlanFragmentParams& request, int64_t* scan_dop,
                                                              int64_t* splitted_scan_rows) const {
@@ -632,6 +652,30 @@ StatusOr<TabletSharedPtr> OlapScanNode::get_tablet(const TInternalScanRange* sca
     return tablet;
 }
 
+StatusOr<Version> OlapScanNode::get_read_version(const TInternalScanRange* scan_range, const TabletSharedPtr& tablet) {
+    int64_t version = strtoul(scan_range->version.c_str(), nullptr, 10);
+    if (!scan_range->__isset.begin_version || scan_range->begin_version <= 0) {
+        return Version(0, version);
+    }
+
+    int64_t begin_version = scan_range->begin_version;
+    if (begin_version > version) {
+        return Status::InvalidArgument(strings::Substitute("begin version $0 is greater than version $1 of tablet $2",
+                                                           begin_version, version, tablet->tablet_id()));
+    }
+    if (tablet->keys_type() == PRIMARY_KEYS) {
+        return Status::NotSupported("reading the delta versions of the primary key tablets is not supported");
+    }
+    std::shared_lock l(tablet->get_header_lock());
+    for (const DeletePredicatePB& pred : tablet->delete_predicates()) {
+        if (pred.version() >= begin_version && pred.version() <= version) {
+            return Status::NotSupported(strings::Substitute("tablet $0 has a delete in the versions [$1, $2]",
+                                                            tablet->tablet_id(), begin_version, version));
+        }
+    }
+    return Version(begin_version, version);
+}
+
 int OlapScanNode::max_scan_concurrency() const {
     int64_t query_limit = runtime_state()->query_mem_tracker_ptr()->limit();
 
@@ -652,13 +696,13 @@ Status OlapScanNode::_capture_tablet_rowsets() {
     for (int i = 0; i < _scan_ranges.size(); ++i) {
         const auto& scan_range = _scan_ranges[i];
 
-        int64_t version = strtoul(scan_range->version.c_str(), nullptr, 10);
         ASSIGN_OR_RETURN(TabletSharedPtr tablet, get_tablet(scan_range.get()));
+        ASSIGN_OR_RETURN(Version version, get_read_version(scan_range.get(), tablet));
 
         // Capture row sets of this version tablet.
         {
             std::shared_lock l(tablet->get_header_lock());
-            RETURN_IF_ERROR(tablet->capture_consistent_rowsets(Version(0, version), &_tablet_rowsets[i]));
+            RETURN_IF_ERROR(tablet->capture_consistent_rowsets(version, &_tablet_rowsets[i]));
         }
     }
 
@@ -12,6 +12,7 @@
 #include "exec/scan_node.h"
 #include "exec/vectorized/olap_scan_prepare.h"
 #include "exec/vectorized/tablet_scanner.h"
+#include "exec/vectorized/topn_runtime_filter.h"
 #include "runtime/global_dict/parser.h"
 
 namespace starrocks {
@@ -73,8 +74,17 @@ public:
 
     static StatusOr<TabletSharedPtr> get_tablet(const TInternalScanRange* scan_range);
 
+    // The versions of |tablet| read by |scan_range|, which are [0, version] unless the scan range reads the rows
+    // loaded since its begin_version. Reading the delta versions is not supported if they can't be read without
+    // the rows of the previous versions, i.e. the tablet is of the primary key model or the versions have deletes.
+    static StatusOr<Version> get_read_version(const TInternalScanRange* scan_range, const TabletSharedPtr& tablet);
+
     int max_scan_concurrency() const override;
 
+    // The dynamic bound of the top-n above this node, which is pushed down to the chunk sources of pipeline.
+    void set_topn_runtime_filter(TopnRuntimeFilterPtr filter) { _topn_runtime_filter = std::move(filter); }
+    const TopnRuntimeFilterPtr& topn_runtime_filter() const { return _topn_runtime_filter; }
+
 private:
     friend class TabletScanner;
 
@@ -137,6 +147,9 @@ private:
                                                    const TExecPlanFragmentParams& request, int64_t* scan_dop,
                                                    int64_t* splitted_scan_rows) const;
     StatusOr<bool> _could_split_tablet_physically(const std::vector<TScanRangeParams>& scan_ranges) const;
+    // Use the number of rows of the tablets to limit the degree of parallelism of the scan operator.
+    StatusOr<pipeline::MorselQueuePtr> _create_fixed_morsel_queue(pipeline::Morsels&& morsels,
+                                                                  const std::vector<TScanRangeParams>& scan_ranges) const;
 
 private:
     TOlapScanNode _olap_scan_node;
@@ -170,6 +183,8 @@ private:
 
     std::vector<std::string> _unused_output_columns;
 
+    TopnRuntimeFilterPtr _topn_runtime_filter;
+
     // The row sets of tablets will become stale and be deleted, if compaction occurs
     // and these row sets aren't referenced, which will typically happen when the tablets
     // of the left table are compacted at building the right hash table. Therefore, reference
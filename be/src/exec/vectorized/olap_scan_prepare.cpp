@@ -371,7 +371,13 @@ void OlapScanConjunctsManager::normalize_join_runtime_filter(const SlotDescripto
         }
     }
 
-    // bloom runtime filter
+    normalize_join_runtime_bloom_filter<SlotType, RangeValueType>(slot, range, false);
+}
+
+template <PrimitiveType SlotType, typename RangeValueType>
+void OlapScanConjunctsManager::normalize_join_runtime_bloom_filter(const SlotDescriptor& slot,
+                                                                   ColumnValueRange<RangeValueType>* range,
+                                                                   bool late_only) {
     for (const auto it : runtime_filters->descriptors()) {
         const RuntimeFilterProbeDescriptor* desc = it.second;
         const JoinRuntimeFilter* rf = desc->runtime_filter();
@@ -382,6 +388,11 @@ void OlapScanConjunctsManager::normalize_join_runtime_filter(const SlotDescripto
         if (rf == nullptr || rf->has_null()) continue;
         // probe expr is slot ref and slot id matches.
         if (!desc->is_probe_slot_ref(&slot_id) || slot_id != slot.id()) continue;
+        if (late_only) {
+            if (normalized_runtime_filter_ids.count(desc->filter_id()) > 0) continue;
+        } else {
+            normalized_runtime_filter_ids.insert(desc->filter_id());
+        }
 
         const RuntimeBloomFilter<SlotType>* filter = down_cast<const RuntimeBloomFilter<SlotType>*>(rf);
         // For some cases such as in bucket shuffle, some hash join node may not have any input chunk from right table.
@@ -498,6 +509,34 @@ void OlapScanConjunctsManager::normalize_predicate(const SlotDescriptor& slot,
     normalize_join_runtime_filter<SlotType, RangeValueType>(slot, range);
 }
 
+struct LateRuntimeFilterRangeBuilder {
+    template <PrimitiveType ptype>
+    std::nullptr_t operator()(OlapScanConjunctsManager* cm, const SlotDescriptor* slot,
+                              std::vector<TCondition>* filters) {
+        if constexpr (ptype == TYPE_TIME || ptype == TYPE_NULL || ptype == TYPE_JSON || pt_is_float<ptype>) {
+            return nullptr;
+        } else {
+            // The same type mapping as ColumnRangeBuilder.
+            constexpr PrimitiveType limit_type = ptype == TYPE_TINYINT || ptype == TYPE_BOOLEAN ? TYPE_INT : ptype;
+            constexpr PrimitiveType mapping_type = ptype == TYPE_CHAR ? TYPE_VARCHAR : ptype;
+            using value_type = typename RunTimeTypeLimits<limit_type>::value_type;
+
+            ColumnValueRange<value_type> range(slot->col_name(), ptype, RunTimeTypeLimits<ptype>::min_value(),
+                                               RunTimeTypeLimits<ptype>::max_value());
+            if constexpr (pt_is_decimal<limit_type>) {
+                range.set_precision(slot->type().precision);
+                range.set_scale(slot->type().scale);
+            }
+            cm->normalize_join_runtime_bloom_filter<mapping_type, value_type>(*slot, &range, true);
+            // An empty range is left to the row-wise runtime filter, which filters out all the rows anyway.
+            if (!range.is_init_state() && !range.is_empty_value_range()) {
+                range.to_olap_filter(*filters);
+            }
+            return nullptr;
+        }
+    }
+};
+
 struct ColumnRangeBuilder {
     template <PrimitiveType ptype>
     std::nullptr_t operator()(OlapScanConjunctsManager* cm, const SlotDescriptor* slot,
@@ -643,6 +682,26 @@ Status OlapScanConjunctsManager::get_column_predicates(PredicateParser* parser,
             preds->emplace_back(std::move(p));
         }
     }
+    return get_late_runtime_filter_predicates(parser, preds);
+}
+
+Status OlapScanConjunctsManager::get_late_runtime_filter_predicates(
+        PredicateParser* parser, std::vector<std::unique_ptr<ColumnPredicate>>* preds) {
+    if (runtime_filters == nullptr) {
+        return Status::OK();
+    }
+    std::vector<TCondition> filters;
+    for (auto& slot : tuple_desc->decoded_slots()) {
+        type_dispatch_predicate<std::nullptr_t>(slot->type().type, false, LateRuntimeFilterRangeBuilder(), this, slot,
+                                                &filters);
+    }
+    for (auto& f : filters) {
+        std::unique_ptr<ColumnPredicate> p(parser->parse_thrift_cond(f));
+        RETURN_IF(!p, Status::RuntimeError("invalid filter"));
+        // The rows are still filtered by the runtime filter itself after decoding.
+        p->set_index_filter_only(true);
+        preds->emplace_back(std::move(p));
+    }
     return Status::OK();
 }
 
@@ -34,6 +34,7 @@ private:
     std::vector<TCondition> olap_filters;                             // from _column_value_ranges
     std::vector<TCondition> is_null_vector;                           // from conjunct_ctxs
     std::map<int, std::vector<ExprContext*>> slot_index_to_expr_ctxs; // from conjunct_ctxs
+    std::set<int32_t> normalized_runtime_filter_ids;                  // from runtime_filters
 
 public:
     static Status eval_const_conjuncts(const std::vector<ExprContext*>& conjunct_ctxs, Status* status);
@@ -49,6 +50,7 @@ public:
 
 private:
     friend struct ColumnRangeBuilder;
+    friend struct LateRuntimeFilterRangeBuilder;
     friend class ConjunctiveTestFixture;
 
     Status normalize_conjuncts();
@@ -67,6 +69,19 @@ private:
     template <PrimitiveType SlotType, typename RangeValueType>
     void normalize_join_runtime_filter(const SlotDescriptor& slot, ColumnValueRange<RangeValueType>* range);
 
+    // Narrow |range| by the min/max values of the join runtime bloom filters on |slot|.
+    // If |late_only| is true, only the runtime filters which are not yet arrived when parsing the conjuncts are
+    // handled, and this manager is not modified, so that it can be called by multiple scanners concurrently.
+    template <PrimitiveType SlotType, typename RangeValueType>
+    void normalize_join_runtime_bloom_filter(const SlotDescriptor& slot, ColumnValueRange<RangeValueType>* range,
+                                             bool late_only);
+
+    // The join runtime filters may arrive after the conjuncts are parsed, e.g. when the build side of the join
+    // finishes after the scan starts. Build the index-only min/max predicates of these late filters, so that
+    // the tablets opened afterwards can still skip the pages by zone map before decoding them.
+    Status get_late_runtime_filter_predicates(PredicateParser* parser,
+                                              std::vector<std::unique_ptr<ColumnPredicate>>* preds);
+
     template <PrimitiveType SlotType, typename RangeValueType>
     void normalize_not_in_or_not_equal_predicate(const SlotDescriptor& slot, ColumnValueRange<RangeValueType>* range);
 
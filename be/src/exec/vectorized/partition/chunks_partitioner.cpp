@@ -42,6 +42,7 @@ Status ChunksPartitioner::offer(const ChunkPtr& chunk) {
     APPLY_FOR_PARTITION_VARIANT_ALL(HASH_MAP_METHOD)
 #undef HASH_MAP_METHOD
 
+    _num_buffered_rows += chunk->num_rows();
     return Status::OK();
 }
 
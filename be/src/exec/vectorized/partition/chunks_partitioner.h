@@ -36,6 +36,41 @@ public:
     // Number of partitions
     int32_t num_partitions();
 
+    // Number of rows buffered in the hash map since the last consume_buffered_chunks
+    int64_t num_buffered_rows() const { return _num_buffered_rows; }
+
+    // Consume all the buffered chunks and release them from the hash map, while the partitions are kept, so that the
+    // consumer can bound the memory of each partition, e.g. by a top-n sorter per partition.
+    // method signature is: Status consumer(int32_t partition_idx, const ChunkPtr& chunk)
+    // Unlike accept, the partition_idx is the order in which the partition is created, which remains the same
+    // across the invocations. It must not be mixed with accept.
+    template <typename Consumer>
+    Status consume_buffered_chunks(Consumer&& consumer) {
+        DCHECK(!_partition_it.has_value());
+        if (false) {
+        }
+#define HASH_MAP_METHOD(NAME)                                                 \
+    else if (_hash_map_variant.type == PartitionHashMapVariant::Type::NAME) { \
+        for (auto& [key, value] : _hash_map_variant.NAME->hash_map) {         \
+            RETURN_IF_ERROR(consume_chunks_of_partition(*value, consumer));   \
+        }                                                                     \
+    }
+        APPLY_FOR_PARTITION_VARIANT_ALL(HASH_MAP_METHOD)
+#undef HASH_MAP_METHOD
+
+        if (false) {
+        }
+#define HASH_MAP_METHOD(NAME)                                                                           \
+    else if (_hash_map_variant.type == PartitionHashMapVariant::Type::NAME) {                           \
+        RETURN_IF_ERROR(consume_chunks_of_partition(_hash_map_variant.NAME->null_key_value, consumer)); \
+    }
+        APPLY_FOR_PARTITION_VARIANT_NULL(HASH_MAP_METHOD)
+#undef HASH_MAP_METHOD
+
+        _num_buffered_rows = 0;
+        return Status::OK();
+    }
+
     // Consumers consume from the hash map
     // method signature is: bool consumer(int32_t partition_idx, const ChunkPtr& chunk)
     // The return value of the consumer denote whether to continue or not
@@ -77,6 +112,17 @@ private:
         hash_map_with_key.append_chunk(chunk, _partition_columns, _mem_pool.get(), _obj_pool);
     }
 
+    template <typename Consumer>
+    Status consume_chunks_of_partition(PartitionChunks& value, Consumer&& consumer) {
+        for (const auto& chunk : value.chunks) {
+            RETURN_IF_ERROR(consumer(value.partition_idx, chunk));
+        }
+        value.chunks.clear();
+        value.select_indexes.clear();
+        value.remain_size = 0;
+        return Status::OK();
+    }
+
     // Fetch chunks from hash map, return true if reaches eos
     template <typename HashMapWithKey, typename Consumer>
     bool fetch_chunks_from_hash_map(HashMapWithKey& hash_map_with_key, Consumer&& consumer) {
@@ -176,6 +222,7 @@ private:
     Columns _partition_columns;
     // Hash map which holds chunks of different partitions
     PartitionHashMapVariant _hash_map_variant;
+    int64_t _num_buffered_rows = 0;
 
     // Iterator of partitions
     std::any _partition_it;
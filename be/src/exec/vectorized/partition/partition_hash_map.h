@@ -24,6 +24,8 @@ struct PartitionChunks {
     // Used to save the remain size of last chunk in chunks
     // Avoid virtual function call `chunks->back()->num_rows()`
     int32_t remain_size = 0;
+    // The order in which the partition is created, which is stable even if the buffered chunks are released
+    int32_t partition_idx = -1;
 };
 
 // =====================
@@ -60,11 +62,16 @@ using FixedSize16SlicePartitionHashMap =
 
 struct PartitionHashMapBase {
     const int32_t chunk_size;
+    // Number of the partitions created so far, including the one of null key
+    int32_t num_created_partitions = 0;
 
     PartitionHashMapBase(int32_t chunk_size) : chunk_size(chunk_size) {}
 
 protected:
     void alloc_new_buffer(PartitionChunks& value, const ChunkPtr& chunk) {
+        if (value.partition_idx < 0) {
+            value.partition_idx = num_created_partitions++;
+        }
         static size_t reserve_size = 1;
         // Cause we don't know the cardinality of the partition columns, so we
         // shouldn't reserve too much space for the buffered chunk
@@ -257,7 +257,7 @@ struct PartitionHashMapVariant {
         switch (type) {
 #define M(NAME)      \
     case Type::NAME: \
-        return NAME->hash_map.size() + (NAME->null_key_value.chunks.empty() ? 0 : 1);
+        return NAME->hash_map.size() + (NAME->null_key_value.partition_idx < 0 ? 0 : 1);
             APPLY_FOR_PARTITION_VARIANT_NULL(M)
 #undef M
 
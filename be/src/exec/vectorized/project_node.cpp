@@ -29,6 +29,23 @@
 
 namespace starrocks::vectorized {
 
+// the results of these expressions differ between evaluations, so the outputs can't share them
+static bool is_deterministic(const TExpr& texpr) {
+    for (const auto& node : texpr.nodes) {
+        if (!node.__isset.fn) {
+            continue;
+        }
+        if (node.fn.binary_type != TFunctionBinaryType::BUILTIN) {
+            return false;
+        }
+        const auto& name = node.fn.name.function_name;
+        if (name == "rand" || name == "random" || name == "uuid" || name == "uuid_numeric" || name == "sleep") {
+            return false;
+        }
+    }
+    return true;
+}
+
 ProjectNode::ProjectNode(starrocks::ObjectPool* pool, const starrocks::TPlanNode& node,
                          const starrocks::DescriptorTbl& desc)
         : ExecNode(pool, node, desc) {}
@@ -51,12 +68,26 @@ Status ProjectNode::init(const TPlanNode& tnode, RuntimeState* state) {
         slot_null_mapping[slot->id()] = slot->is_nullable();
     }
 
+    std::vector<const TExpr*> texprs;
     for (auto const& [key, val] : tnode.project_node.slot_map) {
         _slot_ids.emplace_back(key);
         ExprContext* context;
         RETURN_IF_ERROR(Expr::create_expr_tree(_pool, val, &context));
         _expr_ctxs.emplace_back(context);
         _type_is_nullable.emplace_back(slot_null_mapping[key]);
+
+        // the column refs and the literals are cheaper to evaluate than to copy
+        int32_t same_expr_idx = -1;
+        if (val.nodes.size() > 1 && is_deterministic(val)) {
+            for (size_t i = 0; i < texprs.size(); ++i) {
+                if (*texprs[i] == val && _type_is_nullable[i] == _type_is_nullable.back()) {
+                    same_expr_idx = static_cast<int32_t>(i);
+                    break;
+                }
+            }
+        }
+        _same_expr_idxs.emplace_back(same_expr_idx);
+        texprs.emplace_back(&val);
     }
 
     size_t common_sub_column_size = tnode.project_node.common_slot_map.size();
@@ -102,7 +133,15 @@ Status ProjectNode::open(RuntimeState* state) {
     };
 
     RETURN_IF_ERROR(init_dict_optimize(_common_sub_expr_ctxs, _common_sub_slot_ids));
+    std::vector<ExprContext*> origin_expr_ctxs = _expr_ctxs;
     RETURN_IF_ERROR(init_dict_optimize(_expr_ctxs, _slot_ids));
+    // the expression rewritten for the dict of its slot may not produce the same result as the others
+    for (size_t i = 0; i < _same_expr_idxs.size(); ++i) {
+        int32_t idx = _same_expr_idxs[i];
+        if (idx >= 0 && (_expr_ctxs[i] != origin_expr_ctxs[i] || _expr_ctxs[idx] != origin_expr_ctxs[idx])) {
+            _same_expr_idxs[i] = -1;
+        }
+    }
     return Status::OK();
 }
 
@@ -142,6 +181,11 @@ Status ProjectNode::get_next(RuntimeState* state, ChunkPtr* chunk, bool* eos) {
     {
         SCOPED_TIMER(_expr_compute_timer);
         for (size_t i = 0; i < _slot_ids.size(); ++i) {
+            if (_same_expr_idxs[i] >= 0) {
+                // copy rather than share the column, the columns of a chunk are filtered one by one
+                result_columns[i] = result_columns[_same_expr_idxs[i]]->clone_shared();
+                continue;
+            }
             ASSIGN_OR_RETURN(result_columns[i], _expr_ctxs[i]->evaluate((*chunk).get()));
 
             if (result_columns[i]->only_null()) {
@@ -302,7 +346,8 @@ pipeline::OpFactories ProjectNode::decompose_to_pipeline(pipeline::PipelineBuild
 
     operators.emplace_back(std::make_shared<ProjectOperatorFactory>(
             context->next_operator_id(), id(), std::move(_slot_ids), std::move(_expr_ctxs),
-            std::move(_type_is_nullable), std::move(_common_sub_slot_ids), std::move(_common_sub_expr_ctxs)));
+            std::move(_type_is_nullable), std::move(_common_sub_slot_ids), std::move(_common_sub_expr_ctxs),
+            std::move(_same_expr_idxs)));
     // Initialize OperatorFactory's fields involving runtime filters.
     this->init_runtime_filter_for_operator(operators.back().get(), context, rc_rf_probe_collector);
     if (limit() != -1) {
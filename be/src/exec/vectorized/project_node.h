@@ -35,6 +35,9 @@ private:
     std::vector<SlotId> _slot_ids;
     std::vector<ExprContext*> _expr_ctxs;
     std::vector<bool> _type_is_nullable;
+    // the index of the first output with the same expression, its result is copied instead of evaluated
+    // again, -1 if there is none
+    std::vector<int32_t> _same_expr_idxs;
 
     std::vector<SlotId> _common_sub_slot_ids;
     std::vector<ExprContext*> _common_sub_expr_ctxs;
@@ -78,8 +78,8 @@ Status RepeatNode::open(RuntimeState* state) {
  *
  * first time(_repeat_times_last == 0):
  * step 1:
- * move A as curr_chunk
- * copy curr_chunk as _curr_chunk.
+ * keep A as _curr_chunk,
+ * and make curr_chunk over the columns of _curr_chunk.
  *
  * step 2:
  * Extend multiple virtual columns for curr_chunk,
@@ -92,10 +92,12 @@ Status RepeatNode::open(RuntimeState* state) {
  *
  * non-first time, it measn _repeat_times_last in [1, _repeat_times_required):
  * step 1:
- * copy _curr_chunk as curr_chunk.
+ * make curr_chunk over the columns of _curr_chunk.
  *
  * step 2/step 3 is the same as first time.
  *
+ * The columns of _curr_chunk are shared by all the repeated chunks instead of being copied for each of them,
+ * unless the repeated chunks are filtered in place by the conjuncts or runtime filters.
  */
 Status RepeatNode::get_next(RuntimeState* state, ChunkPtr* chunk, bool* eos) {
     SCOPED_TIMER(_runtime_profile->total_time_counter());
@@ -105,12 +107,7 @@ Status RepeatNode::get_next(RuntimeState* state, ChunkPtr* chunk, bool* eos) {
         // if _repeat_times_last < _repeat_times_required
         // continue access old chunk.
         if (_repeat_times_last < _repeat_times_required) {
-            ChunkPtr curr_chunk = _curr_chunk->clone_empty(_curr_chunk->num_rows());
-            {
-                SCOPED_TIMER(_copy_column_timer);
-                curr_chunk->append_safe(*_curr_chunk, 0, _curr_chunk->num_rows());
-            }
-
+            ChunkPtr curr_chunk = make_repeat_chunk();
             extend_and_update_columns(&curr_chunk, chunk);
 
             ++_repeat_times_last;
@@ -128,15 +125,10 @@ Status RepeatNode::get_next(RuntimeState* state, ChunkPtr* chunk, bool* eos) {
             } else {
                 // got a new chunk.
                 _repeat_times_last = 0;
-                auto curr_chunk = std::move(*chunk);
-
-                {
-                    SCOPED_TIMER(_copy_column_timer);
-                    // Used for next time.
-                    _curr_chunk = curr_chunk->clone_empty(curr_chunk->num_rows());
-                    _curr_chunk->append_safe(*curr_chunk, 0, curr_chunk->num_rows());
-                }
+                // Used for next time.
+                _curr_chunk = std::move(*chunk);
 
+                ChunkPtr curr_chunk = make_repeat_chunk();
                 extend_and_update_columns(&curr_chunk, chunk);
 
                 ++_repeat_times_last;
@@ -154,6 +146,32 @@ Status RepeatNode::get_next(RuntimeState* state, ChunkPtr* chunk, bool* eos) {
     return Status::OK();
 }
 
+ChunkPtr RepeatNode::make_repeat_chunk() {
+    SCOPED_TIMER(_copy_column_timer);
+    Columns columns = _curr_chunk->columns();
+    // The filters of conjuncts and runtime filters modify the columns in place, so the columns which are used by
+    // the following repeated chunks must be copied, except the ones to be replaced by null columns.
+    const bool may_filter =
+            !_conjunct_ctxs.empty() || !_runtime_filter_collector.empty() || !_filter_null_value_columns.empty();
+    if (may_filter && _repeat_times_last + 1 < _repeat_times_required) {
+        const std::vector<SlotId>& null_slot_ids = _null_slot_ids[_repeat_times_last];
+        std::vector<bool> is_null_column(columns.size(), false);
+        for (auto slot_id : null_slot_ids) {
+            auto iter = _curr_chunk->get_slot_id_to_index_map().find(slot_id);
+            if (iter != _curr_chunk->get_slot_id_to_index_map().end()) {
+                is_null_column[iter->second] = true;
+            }
+        }
+        for (size_t i = 0; i < columns.size(); ++i) {
+            if (!is_null_column[i]) {
+                columns[i] = columns[i]->clone_shared();
+            }
+        }
+    }
+    return std::make_shared<Chunk>(std::move(columns), _curr_chunk->get_slot_id_to_index_map(),
+                                   _curr_chunk->get_tuple_id_to_index_map());
+}
+
 void RepeatNode::extend_and_update_columns(ChunkPtr* curr_chunk, ChunkPtr* chunk) {
     {
         SCOPED_TIMER(_extend_column_timer);
@@ -36,6 +36,8 @@ private:
         return ConstColumn::create(ptr, num_rows);
     }
 
+    // Make a chunk of the columns of _curr_chunk for the current repeat.
+    ChunkPtr make_repeat_chunk();
     void extend_and_update_columns(ChunkPtr* curr_chunk, ChunkPtr* chunk);
 
     // Slot id set used to indicate those slots need to set to null.
@@ -11,6 +11,7 @@
 #include "column/fixed_length_column_base.h"
 #include "column/json_column.h"
 #include "column/nullable_column.h"
+#include "common/config.h"
 #include "exec/vectorized/sorting/sort_helper.h"
 #include "exec/vectorized/sorting/sort_permute.h"
 #include "exec/vectorized/sorting/sorting.h"
@@ -362,7 +363,12 @@ Status sort_and_tie_columns(const bool cancel, const Columns& columns, const std
     std::pair<int, int> range{0, num_rows};
     SmallPermutation small_perm = create_small_permutation(num_rows);
 
-    for (int col_index = 0; col_index < columns.size(); col_index++) {
+    size_t num_sorted_columns = 0;
+    if (config::enable_sort_normalized_key) {
+        ASSIGN_OR_RETURN(num_sorted_columns, sort_and_tie_columns_by_normalized_keys(cancel, columns, sort_orders,
+                                                                                     null_firsts, small_perm, tie));
+    }
+    for (int col_index = num_sorted_columns; col_index < columns.size(); col_index++) {
         ColumnPtr column = columns[col_index];
         bool is_asc_order = (sort_orders[col_index] == 1);
         bool is_null_first = is_asc_order ? (null_firsts[col_index] == -1) : (null_firsts[col_index] == 1);
@@ -0,0 +1,278 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include <cstring>
+#include <type_traits>
+
+#include "column/column.h"
+#include "column/fixed_length_column_base.h"
+#include "column/nullable_column.h"
+#include "exec/vectorized/sorting/sort_permute.h"
+#include "exec/vectorized/sorting/sorting.h"
+#include "types/date_value.hpp"
+#include "types/timestamp_value.h"
+#include "util/orlp/pdqsort.h"
+#include "util/radix_sort.h"
+
+namespace starrocks::vectorized {
+
+// A normalized key packs the leading sort columns of a row into an unsigned integer, whose order is the same as the
+// order of the rows on these columns. Each column takes the bytes of its value, and a leading null byte if it has
+// null. Like the KeyCoder of storage, the values are encoded as big-endian unsigned integers:
+// - the sign bit of the signed integers is flipped;
+// - the bits of the negative floats are all flipped, and only the sign bit of the others;
+// - the bits of the value are flipped for the descending order, but not the null byte.
+// The rows are then sorted by the keys, instead of column by column.
+// The 16-byte values, e.g. LARGEINT and DECIMAL128, are not normalized, since at least two columns must fit in a key.
+using NormalizedKey = uint128_t;
+
+static constexpr size_t MAX_NORMALIZED_KEY_BYTES = sizeof(NormalizedKey);
+
+template <class T>
+struct NormalizedValue {
+    using Unsigned = std::make_unsigned_t<T>;
+    static Unsigned encode(T value) {
+        return static_cast<Unsigned>(value) ^ (static_cast<Unsigned>(1) << (sizeof(T) * 8 - 1));
+    }
+};
+
+template <>
+struct NormalizedValue<uint8_t> {
+    using Unsigned = uint8_t;
+    static Unsigned encode(uint8_t value) { return value; }
+};
+
+template <class T, class Bits>
+struct NormalizedFloatValue {
+    using Unsigned = Bits;
+    static Unsigned encode(T value) {
+        // -0.0 equals 0.0, so they must have the same key.
+        if (value == 0) {
+            value = 0;
+        }
+        Bits bits;
+        memcpy(&bits, &value, sizeof(bits));
+        constexpr Bits sign = static_cast<Bits>(1) << (sizeof(Bits) * 8 - 1);
+        return (bits & sign) ? ~bits : (bits ^ sign);
+    }
+};
+
+template <>
+struct NormalizedValue<float> : NormalizedFloatValue<float, uint32_t> {};
+template <>
+struct NormalizedValue<double> : NormalizedFloatValue<double, uint64_t> {};
+
+template <>
+struct NormalizedValue<DateValue> {
+    using Unsigned = uint32_t;
+    static Unsigned encode(DateValue value) { return NormalizedValue<int32_t>::encode(value.julian()); }
+};
+
+template <>
+struct NormalizedValue<TimestampValue> {
+    using Unsigned = uint64_t;
+    static Unsigned encode(TimestampValue value) { return NormalizedValue<int64_t>::encode(value.timestamp()); }
+};
+
+// Append the encoded values of |column| to the lower bytes of the keys.
+template <class T>
+static void append_normalized_values(const FixedLengthColumnBase<T>& column, const NullData* null_data,
+                                     bool is_asc_order, bool is_null_first, std::vector<NormalizedKey>& keys) {
+    using Unsigned = typename NormalizedValue<T>::Unsigned;
+    constexpr size_t value_bits = sizeof(Unsigned) * 8;
+    const Unsigned value_mask = is_asc_order ? 0 : static_cast<Unsigned>(~static_cast<Unsigned>(0));
+    const auto& data = column.get_data();
+    const size_t num_rows = keys.size();
+
+    if (null_data == nullptr) {
+        for (size_t i = 0; i < num_rows; i++) {
+            NormalizedKey value = NormalizedValue<T>::encode(data[i]) ^ value_mask;
+            keys[i] = (keys[i] << value_bits) | value;
+        }
+        return;
+    }
+
+    // The null byte puts the nulls before or after all the values, and the values of the nulls are all zero.
+    const NormalizedKey null_byte = is_null_first ? 0 : 1;
+    const NormalizedKey not_null_byte = is_null_first ? 1 : 0;
+    for (size_t i = 0; i < num_rows; i++) {
+        NormalizedKey value;
+        if ((*null_data)[i]) {
+            value = null_byte << value_bits;
+        } else {
+            value = (not_null_byte << value_bits) | (NormalizedValue<T>::encode(data[i]) ^ value_mask);
+        }
+        keys[i] = (keys[i] << (value_bits + 8)) | value;
+    }
+}
+
+// Return the bytes of |column| in the normalized key, or 0 if it cannot be normalized.
+template <class T>
+static size_t normalized_bytes_of(const Column* data_column, bool has_null) {
+    if (dynamic_cast<const FixedLengthColumnBase<T>*>(data_column) == nullptr) {
+        return 0;
+    }
+    return sizeof(typename NormalizedValue<T>::Unsigned) + (has_null ? 1 : 0);
+}
+
+template <class T>
+static bool try_append_normalized_values(const Column* data_column, const NullData* null_data, bool is_asc_order,
+                                         bool is_null_first, std::vector<NormalizedKey>& keys) {
+    const auto* column = dynamic_cast<const FixedLengthColumnBase<T>*>(data_column);
+    if (column == nullptr) {
+        return false;
+    }
+    append_normalized_values<T>(*column, null_data, is_asc_order, is_null_first, keys);
+    return true;
+}
+
+#define APPLY_FOR_NORMALIZED_TYPES(M) \
+    M(int8_t)                         \
+    M(uint8_t)                        \
+    M(int16_t)                        \
+    M(int32_t)                        \
+    M(int64_t)                        \
+    M(float)                          \
+    M(double)                         \
+    M(DateValue)                      \
+    M(TimestampValue)
+
+static size_t normalized_bytes_of(const Column* column) {
+    bool has_null = false;
+    if (column->is_nullable()) {
+        const auto* nullable = down_cast<const NullableColumn*>(column);
+        has_null = nullable->has_null();
+        column = nullable->data_column().get();
+    }
+    size_t bytes = 0;
+#define M(T)                                               \
+    if (bytes == 0) {                                      \
+        bytes = normalized_bytes_of<T>(column, has_null); \
+    }
+    APPLY_FOR_NORMALIZED_TYPES(M)
+#undef M
+    return bytes;
+}
+
+static void append_normalized_values(const Column* column, bool is_asc_order, bool is_null_first,
+                                     std::vector<NormalizedKey>& keys) {
+    const NullData* null_data = nullptr;
+    if (column->is_nullable()) {
+        const auto* nullable = down_cast<const NullableColumn*>(column);
+        if (nullable->has_null()) {
+            null_data = &nullable->immutable_null_column_data();
+        }
+        column = nullable->data_column().get();
+    }
+    bool appended = false;
+#define M(T)                                                                                                \
+    if (!appended) {                                                                                        \
+        appended = try_append_normalized_values<T>(column, null_data, is_asc_order, is_null_first, keys); \
+    }
+    APPLY_FOR_NORMALIZED_TYPES(M)
+#undef M
+    DCHECK(appended);
+}
+
+#undef APPLY_FOR_NORMALIZED_TYPES
+
+template <class KeyType>
+struct NormalizedKeyRadixSortTraits {
+    using Element = InlinePermuteItem<KeyType>;
+    using Key = KeyType;
+    using CountType = uint32_t;
+    using KeyBits = KeyType;
+
+    static constexpr size_t PART_SIZE_BITS = 8;
+
+    using Transform = RadixSortIdentityTransform<KeyBits>;
+    using Allocator = RadixSortMallocAllocator;
+
+    static Key& extractKey(Element& elem) { return elem.inline_value; }
+
+    static bool less(Key x, Key y) { return x < y; }
+};
+
+// The radix sort is used for the keys of at most 8 bytes, since its passes are proportional to the key width.
+static constexpr size_t MIN_RADIX_SORT_ROWS = 256;
+
+template <class Key>
+static Status sort_normalized_keys(const bool& cancel, const std::vector<NormalizedKey>& keys,
+                                   SmallPermutation& permutation, Tie& tie) {
+    const size_t num_rows = keys.size();
+    InlinePermutation<Key> inlined(num_rows);
+    for (size_t i = 0; i < num_rows; i++) {
+        inlined[i].inline_value = static_cast<Key>(keys[i]);
+        inlined[i].index_in_chunk = i;
+    }
+
+    bool is_sorted = false;
+    if constexpr (sizeof(Key) <= sizeof(uint64_t)) {
+        if (num_rows >= MIN_RADIX_SORT_ROWS) {
+            RadixSort<NormalizedKeyRadixSortTraits<Key>>::executeLSD(inlined.data(), num_rows);
+            is_sorted = true;
+        }
+    }
+    if (!is_sorted) {
+        ::pdqsort(cancel, inlined.begin(), inlined.end(),
+                  [](const InlinePermuteItem<Key>& lhs, const InlinePermuteItem<Key>& rhs) {
+                      return lhs.inline_value < rhs.inline_value;
+                  });
+    }
+    if (UNLIKELY(cancel)) {
+        return Status::Cancelled("Sort cancelled");
+    }
+
+    restore_inline_permutation(inlined, permutation);
+    tie[0] = 0;
+    for (size_t i = 1; i < num_rows; i++) {
+        tie[i] = inlined[i - 1].inline_value == inlined[i].inline_value;
+    }
+    return Status::OK();
+}
+
+StatusOr<size_t> sort_and_tie_columns_by_normalized_keys(const bool& cancel, const Columns& columns,
+                                                         const std::vector<int>& sort_orders,
+                                                         const std::vector<int>& null_firsts,
+                                                         SmallPermutation& permutation, Tie& tie) {
+    const size_t num_rows = permutation.size();
+    if (num_rows <= 1) {
+        return 0;
+    }
+
+    // Find the leading columns which fit in the key.
+    size_t num_normalized_columns = 0;
+    size_t key_bytes = 0;
+    for (const auto& column : columns) {
+        if (column->is_constant()) {
+            break;
+        }
+        size_t bytes = normalized_bytes_of(column.get());
+        if (bytes == 0 || key_bytes + bytes > MAX_NORMALIZED_KEY_BYTES) {
+            break;
+        }
+        key_bytes += bytes;
+        num_normalized_columns++;
+    }
+    // A single column is sorted as fast by the column-wise sort, which inlines the values into the permutation.
+    if (num_normalized_columns < 2) {
+        return 0;
+    }
+
+    std::vector<NormalizedKey> keys(num_rows, 0);
+    for (size_t col_index = 0; col_index < num_normalized_columns; col_index++) {
+        bool is_asc_order = (sort_orders[col_index] == 1);
+        bool is_null_first = is_asc_order ? (null_firsts[col_index] == -1) : (null_firsts[col_index] == 1);
+        append_normalized_values(columns[col_index].get(), is_asc_order, is_null_first, keys);
+    }
+
+    if (key_bytes <= sizeof(uint32_t)) {
+        RETURN_IF_ERROR(sort_normalized_keys<uint32_t>(cancel, keys, permutation, tie));
+    } else if (key_bytes <= sizeof(uint64_t)) {
+        RETURN_IF_ERROR(sort_normalized_keys<uint64_t>(cancel, keys, permutation, tie));
+    } else {
+        RETURN_IF_ERROR(sort_normalized_keys<NormalizedKey>(cancel, keys, permutation, tie));
+    }
+    return num_normalized_columns;
+}
+
+} // namespace starrocks::vectorized
@@ -5,6 +5,7 @@
 #include "column/chunk.h"
 #include "column/datum.h"
 #include "common/status.h"
+#include "common/statusor.h"
 #include "exec/vectorized/sorting/sort_permute.h"
 #include "runtime/chunk_cursor.h"
 
@@ -24,6 +25,14 @@ Status sort_and_tie_column(const bool cancel, const ColumnPtr& column, const boo
 Status sort_and_tie_columns(const bool cancel, const Columns& columns, const std::vector<int>& sort_orders,
                             const std::vector<int>& null_firsts, Permutation* permutation);
 
+// Sort the leading columns which are fixed-width by normalized keys, which pack the values of these columns of each
+// row into a memcmp-able integer, and build tie for the next column
+// @return the number of sorted columns, 0 if the columns are not sorted since fewer than two columns fit in the key
+StatusOr<size_t> sort_and_tie_columns_by_normalized_keys(const bool& cancel, const Columns& columns,
+                                                         const std::vector<int>& sort_orders,
+                                                         const std::vector<int>& null_firsts,
+                                                         SmallPermutation& permutation, Tie& tie);
+
 // Sort multiple columns, and stable
 Status stable_sort_and_tie_columns(const bool cancel, const Columns& columns, const std::vector<int>& sort_orders,
                                    const std::vector<int>& null_firsts, SmallPermutation* permutation);
@@ -42,7 +42,7 @@ Status TabletScanner::init(RuntimeState* runtime_state, const TabletScannerParam
     RETURN_IF_ERROR(_init_reader_params(params.key_ranges));
     const TabletSchema& tablet_schema = _tablet->tablet_schema();
     Schema child_schema = ChunkHelper::convert_schema_to_format_v2(tablet_schema, _reader_columns);
-    _reader = std::make_shared<TabletReader>(_tablet, Version(0, _version), std::move(child_schema));
+    _reader = std::make_shared<TabletReader>(_tablet, _version, std::move(child_schema));
     if (_reader_columns.size() == _scanner_columns.size()) {
         _prj_iter = _reader;
     } else {
@@ -106,7 +106,6 @@ Status TabletScanner::close(RuntimeState* state) {
 
 Status TabletScanner::_get_tablet(const TInternalScanRange* scan_range) {
     TTabletId tablet_id = scan_range->tablet_id;
-    _version = strtoul(scan_range->version.c_str(), nullptr, 10);
 
     std::string err;
     _tablet = StorageEngine::instance()->tablet_manager()->get_tablet(tablet_id, true, &err);
@@ -115,6 +114,7 @@ Status TabletScanner::_get_tablet(const TInternalScanRange* scan_range) {
         LOG(WARNING) << msg;
         return Status::InternalError(msg);
     }
+    ASSIGN_OR_RETURN(_version, OlapScanNode::get_read_version(scan_range, _tablet));
     return Status::OK();
 }
 
@@ -128,6 +128,10 @@ Status TabletScanner::_init_reader_params(const std::vector<OlapScanRange*>* key
     // to avoid the unnecessary SerDe and improve query performance
     _params.need_agg_finalize = _need_agg_finalize;
     _params.use_page_cache = !config::disable_storage_page_cache;
+    const TOlapScanNode& thrift_olap_scan_node = _parent->thrift_olap_scan_node();
+    if (thrift_olap_scan_node.__isset.fill_page_cache) {
+        _params.fill_page_cache = thrift_olap_scan_node.fill_page_cache;
+    }
     // Improve for select * from table limit x, x is small
     if (_parent->_limit != -1 && _parent->_limit < runtime_state()->chunk_size()) {
         _params.chunk_size = _parent->_limit;
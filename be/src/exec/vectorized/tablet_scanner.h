@@ -88,7 +88,7 @@ private:
     std::shared_ptr<TabletReader> _reader;
 
     TabletSharedPtr _tablet;
-    int64_t _version = 0;
+    Version _version{0, 0};
 
     // output columns of `this` TabletScanner, i.e, the final output columns of `get_chunk`.
     std::vector<uint32_t> _scanner_columns;
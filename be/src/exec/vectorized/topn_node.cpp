@@ -6,6 +6,7 @@
 #include <memory>
 
 #include "column/column_helper.h"
+#include "common/config.h"
 #include "exec/pipeline/exchange/local_exchange_source_operator.h"
 #include "exec/pipeline/limit_operator.h"
 #include "exec/pipeline/pipeline_builder.h"
@@ -19,6 +20,9 @@
 #include "exec/vectorized/chunks_sorter_full_sort.h"
 #include "exec/vectorized/chunks_sorter_heap_sort.h"
 #include "exec/vectorized/chunks_sorter_topn.h"
+#include "exec/vectorized/olap_scan_node.h"
+#include "exec/vectorized/topn_runtime_filter.h"
+#include "exprs/vectorized/column_ref.h"
 #include "gutil/casts.h"
 #include "runtime/current_thread.h"
 
@@ -164,8 +168,10 @@ Status TopNNode::_consume_chunks(RuntimeState* state, ExecNode* child) {
         }
 
     } else {
-        _chunks_sorter = std::make_unique<ChunksSorterFullSort>(state, &(_sort_exec_exprs.lhs_ordering_expr_ctxs()),
-                                                                &_is_asc_order, &_is_null_first, _sort_keys);
+        auto full_sorter = std::make_unique<ChunksSorterFullSort>(state, &(_sort_exec_exprs.lhs_ordering_expr_ctxs()),
+                                                                  &_is_asc_order, &_is_null_first, _sort_keys);
+        full_sorter->enable_spill(_materialized_tuple_desc);
+        _chunks_sorter = std::move(full_sorter);
     }
 
     bool eos = false;
@@ -191,6 +197,48 @@ Status TopNNode::_consume_chunks(RuntimeState* state, ExecNode* child) {
     return Status::OK();
 }
 
+std::shared_ptr<TopnRuntimeFilter> TopNNode::_create_topn_runtime_filter() {
+    const auto topn_type = _tnode.sort_node.__isset.topn_type ? _tnode.sort_node.topn_type : TTopNType::ROW_NUMBER;
+    if (!config::enable_topn_runtime_filter || _limit <= 0 || topn_type == TTopNType::DENSE_RANK) {
+        return nullptr;
+    }
+    auto* scan_node = dynamic_cast<OlapScanNode*>(_children[0]);
+    if (scan_node == nullptr) {
+        return nullptr;
+    }
+
+    const auto& ordering_expr_ctxs = _sort_exec_exprs.lhs_ordering_expr_ctxs();
+    if (ordering_expr_ctxs.empty() || !ordering_expr_ctxs[0]->root()->is_slotref()) {
+        return nullptr;
+    }
+    SlotId slot_id = down_cast<ColumnRef*>(ordering_expr_ctxs[0]->root())->slot_id();
+    // The ordering exprs reference the materialized tuple, whose slots are evaluated by the sort tuple slot exprs.
+    const auto& slot_expr_ctxs = _sort_exec_exprs.sort_tuple_slot_expr_ctxs();
+    if (!slot_expr_ctxs.empty()) {
+        const auto& slots = _materialized_tuple_desc->slots();
+        auto it = std::find_if(slots.begin(), slots.end(),
+                               [&](const SlotDescriptor* slot) { return slot->id() == slot_id; });
+        if (it == slots.end() || !slot_expr_ctxs[it - slots.begin()]->root()->is_slotref()) {
+            return nullptr;
+        }
+        slot_id = down_cast<ColumnRef*>(slot_expr_ctxs[it - slots.begin()]->root())->slot_id();
+    }
+
+    const SlotDescriptor* scan_slot = runtime_state()->desc_tbl().get_slot_descriptor(slot_id);
+    if (scan_slot == nullptr || scan_slot->parent() != scan_node->thrift_olap_scan_node().tuple_id ||
+        !TopnRuntimeFilter::is_supported_type(scan_slot->type().type)) {
+        return nullptr;
+    }
+    // The predicate of the bound drops the nulls, so they must be sorted after all the values.
+    if (scan_slot->is_nullable() && _is_null_first[0]) {
+        return nullptr;
+    }
+
+    auto filter = std::make_shared<TopnRuntimeFilter>(scan_slot->col_name(), scan_slot->type().type, _is_asc_order[0]);
+    scan_node->set_topn_runtime_filter(filter);
+    return filter;
+}
+
 pipeline::OpFactories TopNNode::decompose_to_pipeline(pipeline::PipelineBuilderContext* context) {
     using namespace pipeline;
 
@@ -233,10 +281,14 @@ pipeline::OpFactories TopNNode::decompose_to_pipeline(pipeline::PipelineBuilderC
                                                                                 local_partition_topn_context_factory);
     } else {
         const auto& sort_context_factory = std::any_cast<std::shared_ptr<SortContextFactory>>(context_factory);
-        sink_operator = std::make_shared<PartitionSortSinkOperatorFactory>(
+        auto sort_sink_operator = std::make_shared<PartitionSortSinkOperatorFactory>(
                 context->next_operator_id(), id(), sort_context_factory, _sort_exec_exprs, _is_asc_order,
                 _is_null_first, _sort_keys, _offset, _limit, _tnode.sort_node.topn_type, _order_by_types,
                 _materialized_tuple_desc, child(0)->row_desc(), _row_descriptor, _analytic_partition_exprs);
+        if (is_merging) {
+            sort_sink_operator->set_topn_runtime_filter(_create_topn_runtime_filter());
+        }
+        sink_operator = std::move(sort_sink_operator);
     }
     // Initialize OperatorFactory's fields involving runtime filters.
     this->init_runtime_filter_for_operator(sink_operator.get(), context, rc_rf_probe_collector);
@@ -261,6 +313,11 @@ pipeline::OpFactories TopNNode::decompose_to_pipeline(pipeline::PipelineBuilderC
     if (is_merging) {
         if (is_partition) {
             source_operator->set_degree_of_parallelism(degree_of_parallelism);
+        } else if (config::enable_sort_parallel_merge && _limit < 0 && degree_of_parallelism > 1) {
+            // Each instance merges a key range, and instance 0 outputs all the ranges in order.
+            const auto& sort_context_factory = std::any_cast<std::shared_ptr<SortContextFactory>>(context_factory);
+            sort_context_factory->set_num_merge_ranges(degree_of_parallelism);
+            source_operator->set_degree_of_parallelism(degree_of_parallelism);
         } else {
             // source_operator's instance count must be 1
             source_operator->set_degree_of_parallelism(1);
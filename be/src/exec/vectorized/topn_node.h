@@ -8,6 +8,7 @@
 namespace starrocks::vectorized {
 
 class ChunksSorter;
+class TopnRuntimeFilter;
 
 // Node for in-memory TopN (ORDER BY ... LIMIT).
 //
@@ -31,6 +32,9 @@ public:
 
 private:
     Status _consume_chunks(RuntimeState* state, ExecNode* child);
+    // Create the runtime filter of the bound of the first ORDER BY column, and push it down to the child
+    // OlapScanNode. Return nullptr if the bound can't be pushed down.
+    std::shared_ptr<TopnRuntimeFilter> _create_topn_runtime_filter();
     const TPlanNode& _tnode;
 
     // Only used for profile
@@ -0,0 +1,84 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "exec/vectorized/topn_runtime_filter.h"
+
+#include "column/datum.h"
+#include "types/date_value.h"
+#include "types/timestamp_value.h"
+
+namespace starrocks::vectorized {
+
+bool TopnRuntimeFilter::is_supported_type(PrimitiveType type) {
+    switch (type) {
+    case TYPE_TINYINT:
+    case TYPE_SMALLINT:
+    case TYPE_INT:
+    case TYPE_BIGINT:
+    case TYPE_DATE:
+    case TYPE_DATETIME:
+        return true;
+    default:
+        return false;
+    }
+}
+
+void TopnRuntimeFilter::update(const Column& column, size_t row) {
+    Datum datum = column.get(row);
+    if (datum.is_null()) {
+        return;
+    }
+
+    int64_t value = 0;
+    switch (_type) {
+    case TYPE_TINYINT:
+        value = datum.get_int8();
+        break;
+    case TYPE_SMALLINT:
+        value = datum.get_int16();
+        break;
+    case TYPE_INT:
+        value = datum.get_int32();
+        break;
+    case TYPE_BIGINT:
+        value = datum.get_int64();
+        break;
+    case TYPE_DATE:
+        value = datum.get_date().julian();
+        break;
+    case TYPE_DATETIME:
+        value = datum.get_timestamp().timestamp();
+        break;
+    default:
+        DCHECK(false) << "unsupported type of topn runtime filter: " << _type;
+        return;
+    }
+
+    std::lock_guard<std::mutex> l(_lock);
+    const int64_t version = _version.load(std::memory_order_relaxed);
+    if (version > 0 && (_is_asc_order ? value >= _bound : value <= _bound)) {
+        return;
+    }
+    _bound = value;
+    if (_type == TYPE_DATE) {
+        _bound_string = datum.get_date().to_string();
+    } else if (_type == TYPE_DATETIME) {
+        _bound_string = datum.get_timestamp().to_string();
+    } else {
+        _bound_string = std::to_string(value);
+    }
+    _version.store(version + 1, std::memory_order_release);
+}
+
+int64_t TopnRuntimeFilter::get_condition(TCondition* condition) const {
+    std::lock_guard<std::mutex> l(_lock);
+    const int64_t version = _version.load(std::memory_order_relaxed);
+    if (version == 0) {
+        return 0;
+    }
+    condition->column_name = _column_name;
+    condition->condition_op = _is_asc_order ? "<=" : ">=";
+    condition->condition_values = {_bound_string};
+    return version;
+}
+
+} // namespace starrocks::vectorized
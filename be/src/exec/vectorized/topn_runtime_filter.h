@@ -0,0 +1,57 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "column/column.h"
+#include "gen_cpp/InternalService_types.h"
+#include "runtime/primitive_type.h"
+
+namespace starrocks::vectorized {
+
+// TopnRuntimeFilter is a dynamic filter on the first ORDER BY column of a top-n, which is pushed down to the
+// OlapScanNode below it.
+// Once a partial sorter keeps enough rows, the value of its last kept row is a bound: the rows whose values are worse
+// than the bound can't be in the result. The bound gets tighter as the sorters find better rows, and only the tightest
+// bound of all the sorters is kept.
+// The scan turns the bound into a storage predicate when opening each tablet, which is pruned by the zone maps, and
+// re-checks the chunks of the tablets being read whenever the bound is tightened.
+// The rows equal to the bound are kept, so that it also works for RANK.
+class TopnRuntimeFilter {
+public:
+    TopnRuntimeFilter(std::string column_name, PrimitiveType type, bool is_asc_order)
+            : _column_name(std::move(column_name)), _type(type), _is_asc_order(is_asc_order) {}
+
+    // The types whose values are compared as integers and converted to the conditions losslessly.
+    static bool is_supported_type(PrimitiveType type);
+
+    const std::string& column_name() const { return _column_name; }
+
+    // Tighten the bound by the value of |column| at |row|. Null is ignored.
+    void update(const Column& column, size_t row);
+
+    // The version is increased each time the bound is tightened, and it's 0 before any bound is published.
+    int64_t version() const { return _version.load(std::memory_order_acquire); }
+
+    // Fill |condition| with the current bound, e.g. `ts >= '2022-01-01 00:00:00'` for the descending order.
+    // Return the version of the bound, or 0 if there is no bound.
+    int64_t get_condition(TCondition* condition) const;
+
+private:
+    const std::string _column_name;
+    const PrimitiveType _type;
+    const bool _is_asc_order;
+
+    mutable std::mutex _lock;
+    int64_t _bound = 0; // The bound as an integer of the same order, e.g. the julian of DATE
+    std::string _bound_string;
+    std::atomic<int64_t> _version = 0;
+};
+
+using TopnRuntimeFilterPtr = std::shared_ptr<TopnRuntimeFilter>;
+
+} // namespace starrocks::vectorized
@@ -2,8 +2,10 @@
 
 #include "exec/workgroup/scan_executor.h"
 
+#include "common/config.h"
 #include "exec/workgroup/scan_task_queue.h"
 #include "runtime/exec_env.h"
+#include "util/cpu_info.h"
 
 namespace starrocks::workgroup {
 
@@ -33,6 +35,9 @@ void ScanExecutor::change_num_threads(int32_t num_threads) {
 
 void ScanExecutor::worker_thread() {
     const int worker_id = _next_id++;
+    if (config::enable_numa_aware_execution && CpuInfo::get_max_num_numa_nodes() > 1) {
+        CpuInfo::bind_current_thread_to_numa_node(worker_id % CpuInfo::get_max_num_numa_nodes());
+    }
     while (true) {
         if (_num_threads_setter.should_shrink()) {
             break;
@@ -2,8 +2,10 @@
 
 #include "exec/workgroup/scan_task_queue.h"
 
+#include "common/config.h"
 #include "exec/workgroup/work_group.h"
 #include "exec/workgroup/work_group_fwd.h"
+#include "util/time.h"
 
 namespace starrocks::workgroup {
 
@@ -18,6 +20,49 @@ bool FifoScanTaskQueue::try_offer(ScanTask task) {
     return true;
 }
 
+int PriorityScanTaskQueue::compute_level(int64_t scan_time_ns) {
+    int64_t level_end_ns = 0;
+    for (int i = 0; i < NUM_LEVELS - 1; ++i) {
+        level_end_ns += (i + 1) * LEVEL_TIME_SLICE_BASE_NS;
+        if (scan_time_ns < level_end_ns) {
+            return i;
+        }
+    }
+    return NUM_LEVELS - 1;
+}
+
+StatusOr<ScanTask> PriorityScanTaskQueue::take(int worker_id) {
+    DCHECK(!_tasks.empty());
+
+    uint64_t seq = _level_index.begin()->second;
+    const int64_t urgent_window_ns = config::pipeline_scan_task_urgent_deadline_ms * 1'000'000L;
+    if (urgent_window_ns > 0 && !_deadline_index.empty() &&
+        _deadline_index.begin()->first - MonotonicNanos() <= urgent_window_ns) {
+        seq = _deadline_index.begin()->second;
+    }
+
+    auto it = _tasks.find(seq);
+    DCHECK(it != _tasks.end());
+    auto task = std::move(it->second.task);
+    _level_index.erase({it->second.level, seq});
+    if (task.query_deadline_ns != std::numeric_limits<int64_t>::max()) {
+        _deadline_index.erase({task.query_deadline_ns, seq});
+    }
+    _tasks.erase(it);
+    return task;
+}
+
+bool PriorityScanTaskQueue::try_offer(ScanTask task) {
+    const uint64_t seq = _next_seq++;
+    const int level = compute_level(task.query_scan_time_ns);
+    _level_index.emplace(level, seq);
+    if (task.query_deadline_ns != std::numeric_limits<int64_t>::max()) {
+        _deadline_index.emplace(task.query_deadline_ns, seq);
+    }
+    _tasks.emplace(seq, Entry{std::move(task), level});
+    return true;
+}
+
 void ScanTaskQueueWithWorkGroup::close() {
     std::lock_guard<std::mutex> lock(_global_mutex);
 
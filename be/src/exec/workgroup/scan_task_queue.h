@@ -4,8 +4,11 @@
 
 #include <atomic>
 #include <condition_variable>
+#include <limits>
 #include <mutex>
 #include <queue>
+#include <set>
+#include <unordered_map>
 #include <unordered_set>
 
 #include "common/statusor.h"
@@ -31,6 +34,12 @@ public:
 
     WorkGroupPtr workgroup;
     WorkFunction work_function;
+
+    // The scheduling hints used by PriorityScanTaskQueue.
+    // The accumulated scan time of the query, when the task is submitted.
+    int64_t query_scan_time_ns = 0;
+    // The deadline of the query in MonotonicNanos(), or std::numeric_limits<int64_t>::max() if it has no deadline.
+    int64_t query_deadline_ns = std::numeric_limits<int64_t>::max();
 };
 
 class ScanTaskQueue {
@@ -63,6 +72,52 @@ private:
     std::queue<ScanTask> _queue;
 };
 
+// PriorityScanTaskQueue prefers the scan tasks of the short queries.
+//
+// Like QuerySharedDriverQueue, the tasks are put into multiple levels by the accumulated scan time of their queries,
+// and the tasks of a lower level are taken first, so that the first io task of a new short query isn't queued behind
+// all the io tasks of a few huge scans. The tasks of the same level are taken in FIFO order.
+//
+// Besides, the tasks of the queries whose deadlines are within pipeline_scan_task_urgent_deadline_ms are taken before
+// all the others in the order of deadlines, so that the long query close to its timeout isn't starved.
+//
+// The same as FifoScanTaskQueue, it isn't thread-safe and is guarded by the lock of ScanTaskQueueWithWorkGroup.
+class PriorityScanTaskQueue final : public ScanTaskQueue {
+public:
+    PriorityScanTaskQueue() = default;
+    ~PriorityScanTaskQueue() override = default;
+
+    // This method do nothing.
+    void close() override {}
+
+    StatusOr<ScanTask> take(int worker_id) override;
+    bool try_offer(ScanTask task) override;
+
+    size_t size() const override { return _tasks.size(); }
+
+    // The level of the task whose query has used scan_time_ns.
+    // The time slice of the i-th level is (i+1)*LEVEL_TIME_SLICE_BASE_NS, so the query moves to the next level
+    // when its scan time exceeds 0.2s, 0.6s, 1.2s, 2s, 3s, 4.2s and 5.6s.
+    static int compute_level(int64_t scan_time_ns);
+
+    static constexpr int NUM_LEVELS = 8;
+    static constexpr int64_t LEVEL_TIME_SLICE_BASE_NS = 200'000'000L;
+
+private:
+    struct Entry {
+        ScanTask task;
+        int level;
+    };
+
+    // The sequence number of the next offered task, which keeps the FIFO order in the same level.
+    uint64_t _next_seq = 0;
+    std::unordered_map<uint64_t, Entry> _tasks;
+    // Sorted by (level, seq).
+    std::set<std::pair<int, uint64_t>> _level_index;
+    // Sorted by (deadline, seq), which only contains the tasks with deadlines.
+    std::set<std::pair<int64_t, uint64_t>> _deadline_index;
+};
+
 class ScanTaskQueueWithWorkGroup final : public ScanTaskQueue {
 public:
     ScanTaskQueueWithWorkGroup(ScanExecutorType type) : _type(type) {}
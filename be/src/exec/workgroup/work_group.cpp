@@ -91,7 +91,11 @@ void WorkGroup::init() {
     _mem_tracker = std::make_shared<starrocks::MemTracker>(_memory_limit_bytes, _name,
                                                            ExecEnv::GetInstance()->query_pool_mem_tracker());
     _driver_queue = std::make_unique<pipeline::QuerySharedDriverQueueWithoutLock>();
-    _scan_task_queue = std::make_unique<FifoScanTaskQueue>();
+    if (config::pipeline_enable_priority_scan_task_queue) {
+        _scan_task_queue = std::make_unique<PriorityScanTaskQueue>();
+    } else {
+        _scan_task_queue = std::make_unique<FifoScanTaskQueue>();
+    }
 }
 
 double WorkGroup::get_cpu_expected_use_ratio() const {
@@ -191,6 +195,24 @@ void WorkGroupManager::add_metrics(const WorkGroupPtr& wg) {
                                                                  MetricLabels().add("name", wg->name()),
                                                                  resource_group_bigquery_count.get());
 
+        // schedule latency of drivers
+        auto resource_group_schedule_latency_p99_us = std::make_unique<IntGauge>(MetricUnit::MICROSECONDS);
+        StarRocksMetrics::instance()->metrics()->register_metric("resource_group_schedule_latency_p99_us",
+                                                                 MetricLabels().add("name", wg->name()),
+                                                                 resource_group_schedule_latency_p99_us.get());
+
+        // time slice of drivers
+        auto resource_group_time_slice_p99_us = std::make_unique<IntGauge>(MetricUnit::MICROSECONDS);
+        StarRocksMetrics::instance()->metrics()->register_metric("resource_group_time_slice_p99_us",
+                                                                 MetricLabels().add("name", wg->name()),
+                                                                 resource_group_time_slice_p99_us.get());
+
+        // preemptions
+        auto resource_group_num_preemptions = std::make_unique<IntGauge>(MetricUnit::NOUNIT);
+        StarRocksMetrics::instance()->metrics()->register_metric("resource_group_preemption_count",
+                                                                 MetricLabels().add("name", wg->name()),
+                                                                 resource_group_num_preemptions.get());
+
         _wg_cpu_limit_metrics.emplace(wg->name(), std::move(resource_group_cpu_limit_ratio));
         _wg_cpu_metrics.emplace(wg->name(), std::move(resource_group_cpu_use_ratio));
         _wg_mem_limit_metrics.emplace(wg->name(), std::move(resource_group_mem_limit_bytes));
@@ -199,6 +221,9 @@ void WorkGroupManager::add_metrics(const WorkGroupPtr& wg) {
         _wg_total_queries.emplace(wg->name(), std::move(resource_group_total_queries));
         _wg_concurrency_overflow_count.emplace(wg->name(), std::move(resource_group_concurrency_overflow));
         _wg_bigquery_count.emplace(wg->name(), std::move(resource_group_bigquery_count));
+        _wg_schedule_latency_p99_us.emplace(wg->name(), std::move(resource_group_schedule_latency_p99_us));
+        _wg_time_slice_p99_us.emplace(wg->name(), std::move(resource_group_time_slice_p99_us));
+        _wg_num_preemptions.emplace(wg->name(), std::move(resource_group_num_preemptions));
     }
     _wg_metrics.emplace(wg->name(), wg->unique_id());
 }
@@ -216,6 +241,9 @@ void WorkGroupManager::update_metrics_unlocked() {
             _wg_total_queries[name]->set_value(wg->second->num_total_queries());
             _wg_concurrency_overflow_count[name]->set_value(wg->second->concurrency_overflow_count());
             _wg_bigquery_count[name]->set_value(wg->second->bigquery_count());
+            _wg_schedule_latency_p99_us[name]->set_value(wg->second->schedule_latency_percentile_us(0.99));
+            _wg_time_slice_p99_us[name]->set_value(wg->second->time_slice_percentile_us(0.99));
+            _wg_num_preemptions[name]->set_value(wg->second->num_preemptions());
         } else {
             _wg_cpu_limit_metrics[name]->set_value(0);
             _wg_cpu_metrics[name]->set_value(0);
@@ -225,6 +253,9 @@ void WorkGroupManager::update_metrics_unlocked() {
             _wg_total_queries[name]->set_value(0);
             _wg_concurrency_overflow_count[name]->set_value(0);
             _wg_bigquery_count[name]->set_value(0);
+            _wg_schedule_latency_p99_us[name]->set_value(0);
+            _wg_time_slice_p99_us[name]->set_value(0);
+            _wg_num_preemptions[name]->set_value(0);
         }
     }
 }
@@ -1,6 +1,8 @@
 // This file is licensed under the Elastic License 2.0. Copyright 2021-present StarRocks Limited.
 
 #pragma once
+#include <bvar/bvar.h>
+
 #include <atomic>
 #include <memory>
 #include <mutex>
@@ -126,6 +128,19 @@ public:
         return now > _vacuum_ttl;
     }
 
+    // The time in nano-seconds which a driver of this workgroup waits in the ready queue before being executed.
+    void record_schedule_latency_ns(int64_t latency_ns) { _schedule_latency_us << latency_ns / 1000; }
+    // The time in nano-seconds which a driver of this workgroup spends in a single PipelineDriver::process().
+    void record_time_slice_ns(int64_t time_slice_ns) { _time_slice_us << time_slice_ns / 1000; }
+    int64_t schedule_latency_percentile_us(double ratio) const {
+        return _schedule_latency_us.latency_percentile(ratio);
+    }
+    int64_t time_slice_percentile_us(double ratio) const { return _time_slice_us.latency_percentile(ratio); }
+
+    // Increase when a driver of this workgroup yields the worker thread owned by other workgroup.
+    void incr_num_preemptions() { ++_num_preemptions; }
+    int64_t num_preemptions() const { return _num_preemptions; }
+
     int64_t total_cpu_cost() const { return _total_cpu_cost.load(); }
     void incr_total_cpu_cost(int64_t cpu_cost) { _total_cpu_cost.fetch_add(cpu_cost); }
 
@@ -199,6 +214,10 @@ private:
 
     std::atomic<int64_t> _total_cpu_cost = 0;
 
+    bvar::LatencyRecorder _schedule_latency_us;
+    bvar::LatencyRecorder _time_slice_us;
+    std::atomic<int64_t> _num_preemptions = 0;
+
     double _cpu_actual_use_ratio = 0;
 
     std::atomic<int64_t> _num_running_queries = 0;
@@ -302,6 +321,9 @@ private:
     std::unordered_map<std::string, std::unique_ptr<starrocks::IntGauge>> _wg_total_queries;
     std::unordered_map<std::string, std::unique_ptr<starrocks::IntGauge>> _wg_concurrency_overflow_count;
     std::unordered_map<std::string, std::unique_ptr<starrocks::IntGauge>> _wg_bigquery_count;
+    std::unordered_map<std::string, std::unique_ptr<starrocks::IntGauge>> _wg_schedule_latency_p99_us;
+    std::unordered_map<std::string, std::unique_ptr<starrocks::IntGauge>> _wg_time_slice_p99_us;
+    std::unordered_map<std::string, std::unique_ptr<starrocks::IntGauge>> _wg_num_preemptions;
 
     void add_metrics(const WorkGroupPtr& wg);
     void update_metrics_unlocked();
@@ -2,7 +2,9 @@
 
 #pragma once
 
+#include "column/binary_column.h"
 #include "column/column.h"
+#include "gutil/casts.h"
 
 namespace starrocks_udf {
 class FunctionContext;
@@ -58,6 +60,19 @@ public:
     virtual void batch_serialize(FunctionContext* ctx, size_t chunk_size, const Buffer<AggDataPtr>& agg_states,
                                  size_t state_offsets, Column* to) const = 0;
 
+    // The functions whose intermediate states are serialized into a BinaryColumn may support serializing a batch of
+    // states contiguously, see serialize_states_to_binary: the bytes of the column are resized once by the sum of
+    // serialize_size of the states, and then each state is written in place by serialize_to_bytes.
+    virtual bool support_serialize_to_bytes() const { return false; }
+
+    // Return the upper bound of the size of the serialized |state|.
+    virtual size_t serialize_size(FunctionContext* ctx, ConstAggDataPtr __restrict state) const { return 0; }
+
+    // Serialize |state| to |dst|, which has serialize_size(state) bytes at least, and return the actual size.
+    virtual size_t serialize_to_bytes(FunctionContext* ctx, ConstAggDataPtr __restrict state, uint8_t* dst) const {
+        return 0;
+    }
+
     // Change the aggregation state to final result if necessary
     virtual void finalize_to_column(FunctionContext* ctx, ConstAggDataPtr __restrict state, Column* to) const = 0;
 
@@ -111,6 +126,21 @@ public:
     virtual void update_single_state_null(FunctionContext* ctx, AggDataPtr __restrict state, int64_t peer_group_start,
                                           int64_t peer_group_end) const {}
 
+    // For window functions with sliding frames
+    // Whether the rows added by update_batch_single_state can be removed by remove_batch_single_state, so that a
+    // sliding frame is updated by the rows entering and leaving it, instead of all the rows in it.
+    virtual bool is_removable() const { return false; }
+
+    // For window functions with sliding frames
+    // Shrink the frame of the state from [prev_frame_start, frame_end) to [frame_start, frame_end), by removing the
+    // rows in [prev_frame_start, frame_start).
+    // Return false if the rows can't be removed, e.g. the maximum of max is removed, then the state must be reset
+    // and updated by all the rows in the frame.
+    virtual bool remove_batch_single_state(FunctionContext* ctx, AggDataPtr __restrict state, const Column** columns,
+                                           int64_t prev_frame_start, int64_t frame_start, int64_t frame_end) const {
+        return false;
+    }
+
     // Contains a loop with calls to "merge" function.
     // You can collect arguments into array "states"
     // and do a single call to "merge_batch" for devirtualization and inlining.
@@ -127,6 +157,54 @@ public:
                                           AggDataPtr __restrict state) const = 0;
 };
 
+// Call `func(state, start, end)` for each run of the consecutive rows in [0, chunk_size) which update the same state.
+// The rows of a low-cardinality group by key are often clustered, e.g. when the input is sorted or partitioned by the
+// key, so a run can be reduced in registers with a vectorizable loop and written to the state once, instead of
+// loading and storing the state for every row.
+template <typename Func>
+inline void for_each_state_run(size_t chunk_size, const AggDataPtr* states, Func&& func) {
+    size_t start = 0;
+    while (start < chunk_size) {
+        size_t end = start + 1;
+        while (end < chunk_size && states[end] == states[start]) {
+            ++end;
+        }
+        func(states[start], start, end);
+        start = end;
+    }
+}
+
+// Serialize the states of a batch of |chunk_size| rows into |column| contiguously, by serialize_size and
+// serialize_to_bytes of |func|. |state_at(i)| returns the state of the i-th row, or nullptr if the row is an empty
+// value, e.g. the null rows of a nullable column.
+template <typename Func, typename StateAt>
+inline void serialize_states_to_binary(const Func* func, FunctionContext* ctx, size_t chunk_size, StateAt&& state_at,
+                                       BinaryColumn* column) {
+    Bytes& bytes = column->get_bytes();
+    auto& offsets = column->get_offset();
+    size_t cursor = bytes.size();
+    size_t max_size = cursor;
+    for (size_t i = 0; i < chunk_size; ++i) {
+        ConstAggDataPtr state = state_at(i);
+        if (state != nullptr) {
+            max_size += func->serialize_size(ctx, state);
+        }
+    }
+    bytes.resize(max_size);
+
+    const size_t old_rows = offsets.size();
+    offsets.resize(old_rows + chunk_size);
+    for (size_t i = 0; i < chunk_size; ++i) {
+        ConstAggDataPtr state = state_at(i);
+        if (state != nullptr) {
+            cursor += func->serialize_to_bytes(ctx, state, bytes.data() + cursor);
+        }
+        offsets[old_rows + i] = cursor;
+    }
+    DCHECK_LE(cursor, max_size);
+    bytes.resize(cursor);
+}
+
 template <typename State>
 class AggregateFunctionStateHelper : public AggregateFunction {
 protected:
@@ -206,6 +284,22 @@ class AggregateFunctionBatchHelper : public AggregateFunctionStateHelper<State>
             static_cast<const Derived*>(this)->finalize_to_column(ctx, agg_states[i] + state_offset, to);
         }
     }
+
+protected:
+    // For the functions supporting serialize_to_bytes, whose |to| is a BinaryColumn.
+    void batch_serialize_to_binary(FunctionContext* ctx, size_t chunk_size, const Buffer<AggDataPtr>& agg_states,
+                                   size_t state_offset, Column* to) const {
+        serialize_states_to_binary(
+                static_cast<const Derived*>(this), ctx, chunk_size,
+                [&](size_t i) -> ConstAggDataPtr { return agg_states[i] + state_offset; },
+                down_cast<BinaryColumn*>(to));
+    }
+
+    void serialize_to_binary(FunctionContext* ctx, ConstAggDataPtr __restrict state, Column* to) const {
+        serialize_states_to_binary(
+                static_cast<const Derived*>(this), ctx, 1, [&](size_t i) -> ConstAggDataPtr { return state; },
+                down_cast<BinaryColumn*>(to));
+    }
 };
 
 using AggregateFunctionPtr = std::shared_ptr<AggregateFunction>;
@@ -77,6 +77,26 @@ public:
         this->data(state).count++;
     }
 
+    void update_batch(FunctionContext* ctx, size_t chunk_size, size_t state_offset, const Column** columns,
+                      AggDataPtr* states) const override {
+        if constexpr (pt_is_arithmetic<PT> || pt_is_decimal<PT> || pt_is_decimalv2<PT>) {
+            DCHECK(!columns[0]->is_nullable());
+            const auto* data = down_cast<const InputColumnType*>(columns[0])->get_data().data();
+            for_each_state_run(chunk_size, states, [&](AggDataPtr state, size_t start, size_t end) {
+                ImmediateType sum{};
+                for (size_t i = start; i < end; ++i) {
+                    sum += data[i];
+                }
+                this->data(state + state_offset).sum += sum;
+                this->data(state + state_offset).count += end - start;
+            });
+        } else {
+            for (size_t i = 0; i < chunk_size; ++i) {
+                update(ctx, columns, states[i] + state_offset, i);
+            }
+        }
+    }
+
     void update_batch_single_state(FunctionContext* ctx, AggDataPtr __restrict state, const Column** columns,
                                    int64_t peer_group_start, int64_t peer_group_end, int64_t frame_start,
                                    int64_t frame_end) const override {
@@ -85,6 +105,26 @@ public:
         }
     }
 
+    // The integers are summed into a double exactly below 2^53, so they are removable, but not the floats, whose
+    // rounding errors would be accumulated by the removal.
+    bool is_removable() const override { return pt_is_integral<PT> || pt_is_decimal<PT> || pt_is_decimalv2<PT>; }
+
+    bool remove_batch_single_state(FunctionContext* ctx, AggDataPtr __restrict state, const Column** columns,
+                                   int64_t prev_frame_start, int64_t frame_start, int64_t frame_end) const override {
+        if constexpr (pt_is_integral<PT> || pt_is_decimal<PT> || pt_is_decimalv2<PT>) {
+            const auto* data = down_cast<const InputColumnType*>(columns[0])->get_data().data();
+            ImmediateType removed{};
+            for (size_t i = prev_frame_start; i < frame_start; ++i) {
+                removed += data[i];
+            }
+            this->data(state).sum = this->data(state).sum - removed;
+            this->data(state).count -= frame_start - prev_frame_start;
+            return true;
+        } else {
+            return false;
+        }
+    }
+
     void merge(FunctionContext* ctx, const Column* column, AggDataPtr __restrict state, size_t row_num) const override {
         DCHECK(column->is_binary());
         Slice slice = column->get(row_num).get_slice();
@@ -24,6 +24,15 @@ public:
         }
     }
 
+    void update_batch_single_state(FunctionContext* ctx, size_t chunk_size, const Column** columns,
+                                   AggDataPtr __restrict state) const override {
+        if constexpr (std::is_integral_v<T>) {
+            const auto& data = static_cast<const InputColumnType&>(*columns[0]).get_data();
+            std::vector<uint64_t> values(data.begin(), data.begin() + chunk_size);
+            this->data(state).add_many(values.size(), values.data());
+        }
+    }
+
     void merge(FunctionContext* ctx, const Column* column, AggDataPtr __restrict state, size_t row_num) const override {
         DCHECK(column->is_object());
         const BitmapColumn* col = down_cast<const BitmapColumn*>(column);
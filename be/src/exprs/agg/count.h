@@ -25,6 +25,13 @@ public:
         ++this->data(state).count;
     }
 
+    void update_batch(FunctionContext* ctx, size_t chunk_size, size_t state_offset, const Column** columns,
+                      AggDataPtr* states) const override {
+        for_each_state_run(chunk_size, states, [&](AggDataPtr state, size_t start, size_t end) {
+            this->data(state + state_offset).count += end - start;
+        });
+    }
+
     void update_batch_single_state(FunctionContext* ctx, size_t chunk_size, const Column** columns,
                                    AggDataPtr __restrict state) const override {
         this->data(state).count += chunk_size;
@@ -36,6 +43,14 @@ public:
         this->data(state).count += (frame_end - frame_start);
     }
 
+    bool is_removable() const override { return true; }
+
+    bool remove_batch_single_state(FunctionContext* ctx, AggDataPtr __restrict state, const Column** columns,
+                                   int64_t prev_frame_start, int64_t frame_start, int64_t frame_end) const override {
+        this->data(state).count -= (frame_start - prev_frame_start);
+        return true;
+    }
+
     void merge(FunctionContext* ctx, const Column* column, AggDataPtr __restrict state, size_t row_num) const override {
         DCHECK(column->is_numeric());
         const auto* input_column = down_cast<const Int64Column*>(column);
@@ -92,6 +107,25 @@ public:
         this->data(state).count += !columns[0]->is_null(row_num);
     }
 
+    void update_batch(FunctionContext* ctx, size_t chunk_size, size_t state_offset, const Column** columns,
+                      AggDataPtr* states) const override {
+        if (columns[0]->is_nullable() && columns[0]->has_null()) {
+            const auto* nullable_column = down_cast<const NullableColumn*>(columns[0]);
+            const uint8_t* null_data = nullable_column->immutable_null_column_data().data();
+            for_each_state_run(chunk_size, states, [&](AggDataPtr state, size_t start, size_t end) {
+                int64_t count = 0;
+                for (size_t i = start; i < end; ++i) {
+                    count += !null_data[i];
+                }
+                this->data(state + state_offset).count += count;
+            });
+        } else {
+            for_each_state_run(chunk_size, states, [&](AggDataPtr state, size_t start, size_t end) {
+                this->data(state + state_offset).count += end - start;
+            });
+        }
+    }
+
     void update_batch_single_state(FunctionContext* ctx, size_t chunk_size, const Column** columns,
                                    AggDataPtr __restrict state) const override {
         if (columns[0]->is_nullable()) {
@@ -127,6 +161,24 @@ public:
         }
     }
 
+    bool is_removable() const override { return true; }
+
+    bool remove_batch_single_state(FunctionContext* ctx, AggDataPtr __restrict state, const Column** columns,
+                                   int64_t prev_frame_start, int64_t frame_start, int64_t frame_end) const override {
+        if (columns[0]->is_nullable()) {
+            const auto* nullable_column = down_cast<const NullableColumn*>(columns[0]);
+            if (nullable_column->has_null()) {
+                const uint8_t* null_data = nullable_column->immutable_null_column_data().data();
+                for (size_t i = prev_frame_start; i < frame_start; ++i) {
+                    this->data(state).count -= !null_data[i];
+                }
+                return true;
+            }
+        }
+        this->data(state).count -= (frame_start - prev_frame_start);
+        return true;
+    }
+
     void merge(FunctionContext* ctx, const Column* column, AggDataPtr __restrict state, size_t row_num) const override {
         DCHECK(column->is_numeric());
         const auto* input_column = down_cast<const Int64Column*>(column);
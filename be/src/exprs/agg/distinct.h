@@ -5,8 +5,10 @@
 #include <algorithm>
 #include <cstring>
 #include <limits>
+#include <memory>
 #include <string>
 #include <type_traits>
+#include <vector>
 
 #include "column/array_column.h"
 #include "column/binary_column.h"
@@ -14,6 +16,7 @@
 #include "column/hash_set.h"
 #include "column/type_traits.h"
 #include "column/vectorized_fwd.h"
+#include "common/config.h"
 #include "exprs/agg/aggregate.h"
 #include "exprs/agg/sum.h"
 #include "gen_cpp/Data_types.h"
@@ -21,6 +24,7 @@
 #include "gutil/casts.h"
 #include "runtime/mem_pool.h"
 #include "thrift/protocol/TJSONProtocol.h"
+#include "types/bitmap_value.h"
 #include "udf/udf.h"
 #include "udf/udf_internal.h"
 #include "util/phmap/phmap_dump.h"
@@ -35,49 +39,132 @@ static const size_t MIN_SIZE_OF_HASH_SET_SERIALIZED_DATA = 24;
 template <PrimitiveType PT, PrimitiveType SumPT, typename = guard::Guard>
 struct DistinctAggregateState {};
 
+// The serialized bitmap begins with this value, which is never the size of a serialized hash set.
+static const size_t DISTINCT_BITMAP_SERIALIZED_MAGIC = std::numeric_limits<size_t>::max();
+
 template <PrimitiveType PT, PrimitiveType SumPT>
 struct DistinctAggregateState<PT, SumPT, FixedLengthPTGuard<PT>> {
     using T = RunTimeCppType<PT>;
     using SumType = RunTimeCppType<SumPT>;
 
+    // The integers which fit in 64 bits are switched from the hash set to a bitmap when there are many distinct
+    // values, which is much more compact for the dense values and cheaper to merge.
+    static constexpr bool can_use_bitmap = pt_is_integer<PT> && PT != TYPE_LARGEINT;
+
     size_t update(T key) {
+        if constexpr (can_use_bitmap) {
+            if (bitmap != nullptr) {
+                bitmap->add(key);
+                return 0;
+            }
+        }
         auto pair = set.insert(key);
+        if constexpr (can_use_bitmap) {
+            if (pair.second) {
+                _try_convert_to_bitmap();
+            }
+        }
         return pair.second * phmap::item_serialize_size<HashSet<T>>::value;
     }
 
     size_t update_with_hash([[maybe_unused]] MemPool* mempool, T key, size_t hash) {
+        if constexpr (can_use_bitmap) {
+            if (bitmap != nullptr) {
+                bitmap->add(key);
+                return 0;
+            }
+        }
         auto pair = set.emplace_with_hash(hash, key);
+        if constexpr (can_use_bitmap) {
+            if (pair.second) {
+                _try_convert_to_bitmap();
+            }
+        }
         return pair.second * phmap::item_serialize_size<HashSet<T>>::value;
     }
 
     void prefetch(T key) { set.prefetch(key); }
 
-    int64_t disctint_count() const { return set.size(); }
+    int64_t disctint_count() const {
+        if constexpr (can_use_bitmap) {
+            if (bitmap != nullptr) {
+                return bitmap->cardinality();
+            }
+        }
+        return set.size();
+    }
 
     size_t serialize_size() const {
+        if constexpr (can_use_bitmap) {
+            if (bitmap != nullptr) {
+                return std::max(sizeof(size_t) + bitmap->getSizeInBytes(), MIN_SIZE_OF_HASH_SET_SERIALIZED_DATA);
+            }
+        }
         size_t size = set.dump_bound();
         DCHECK(size >= MIN_SIZE_OF_HASH_SET_SERIALIZED_DATA);
         return size;
     }
 
-    void serialize(uint8_t* dst) const {
+    // Return the serialized size.
+    size_t serialize(uint8_t* dst) const {
+        if constexpr (can_use_bitmap) {
+            if (bitmap != nullptr) {
+                memcpy(dst, &DISTINCT_BITMAP_SERIALIZED_MAGIC, sizeof(size_t));
+                size_t bitmap_size = bitmap->getSizeInBytes();
+                bitmap->write(reinterpret_cast<char*>(dst + sizeof(size_t)));
+                // Pad up to MIN_SIZE_OF_HASH_SET_SERIALIZED_DATA, which is ignored by the deserialization.
+                size_t size = sizeof(size_t) + bitmap_size;
+                if (size < MIN_SIZE_OF_HASH_SET_SERIALIZED_DATA) {
+                    memset(dst + size, 0, MIN_SIZE_OF_HASH_SET_SERIALIZED_DATA - size);
+                    size = MIN_SIZE_OF_HASH_SET_SERIALIZED_DATA;
+                }
+                return size;
+            }
+        }
         phmap::InMemoryOutput output(reinterpret_cast<char*>(dst));
         set.dump(output);
         DCHECK(output.length() == set.dump_bound());
+        return set.dump_bound();
     }
 
     size_t deserialize_and_merge(const uint8_t* src, size_t len) {
+        if constexpr (can_use_bitmap) {
+            size_t magic = 0;
+            memcpy(&magic, src, sizeof(size_t));
+            if (magic == DISTINCT_BITMAP_SERIALIZED_MAGIC) {
+                BitmapValue src_bitmap(reinterpret_cast<const char*>(src + sizeof(size_t)));
+                if (bitmap == nullptr) {
+                    _convert_to_bitmap();
+                }
+                *bitmap |= src_bitmap;
+                return 0;
+            }
+            if (bitmap != nullptr) {
+                phmap::InMemoryInput input(reinterpret_cast<const char*>(src));
+                HashSet<T> set_src;
+                set_src.load(input);
+                for (auto key : set_src) {
+                    bitmap->add(key);
+                }
+                return 0;
+            }
+        }
         phmap::InMemoryInput input(reinterpret_cast<const char*>(src));
         auto old_size = set.size();
+        size_t mem_usage = 0;
         if (old_size == 0) {
             set.load(input);
-            return set.size() * phmap::item_serialize_size<HashSet<T>>::value;
+            mem_usage = set.size() * phmap::item_serialize_size<HashSet<T>>::value;
         } else {
             HashSet<T> set_src;
             set_src.load(input);
             set.merge(set_src);
-            return (set.size() - old_size) * phmap::item_serialize_size<HashSet<T>>::value;
+            mem_usage = (set.size() - old_size) * phmap::item_serialize_size<HashSet<T>>::value;
+        }
+        if constexpr (can_use_bitmap) {
+            _try_convert_to_bitmap();
         }
+        return mem_usage;
     }
 
     SumType sum_distinct() const {
@@ -87,6 +174,16 @@ struct DistinctAggregateState<PT, SumPT, FixedLengthPTGuard<PT>> {
             return sum;
         }
 
+        if constexpr (can_use_bitmap) {
+            if (bitmap != nullptr) {
+                std::vector<int64_t> values;
+                bitmap->to_array(&values);
+                for (auto value : values) {
+                    sum += static_cast<T>(value);
+                }
+                return sum;
+            }
+        }
         for (auto& key : set) {
             sum += key;
         }
@@ -94,6 +191,24 @@ struct DistinctAggregateState<PT, SumPT, FixedLengthPTGuard<PT>> {
     }
 
     HashSet<T> set;
+    // Not null once the distinct values are moved from the set into it.
+    std::unique_ptr<BitmapValue> bitmap;
+
+private:
+    void _try_convert_to_bitmap() {
+        const int64_t threshold = config::distinct_agg_bitmap_threshold;
+        if (threshold > 0 && set.size() > static_cast<size_t>(threshold)) {
+            _convert_to_bitmap();
+        }
+    }
+
+    void _convert_to_bitmap() {
+        bitmap = std::make_unique<BitmapValue>();
+        for (auto key : set) {
+            bitmap->add(key);
+        }
+        HashSet<T>().swap(set);
+    }
 };
 
 template <PrimitiveType PT, PrimitiveType SumPT>
@@ -139,7 +254,8 @@ struct DistinctAggregateState<PT, SumPT, BinaryPTGuard<PT>> {
 
     // TODO(kks): If we put all string key to one continue memory,
     // then we could only one memcpy.
-    void serialize(uint8_t* dst) const {
+    size_t serialize(uint8_t* dst) const {
+        uint8_t* begin = dst;
         for (auto& key : set) {
             uint32_t size = (uint32_t)key.size;
             memcpy(dst, &size, sizeof(uint32_t));
@@ -147,6 +263,7 @@ struct DistinctAggregateState<PT, SumPT, BinaryPTGuard<PT>> {
             memcpy(dst, key.data, key.size);
             dst += key.size;
         }
+        return dst - begin;
     }
 
     size_t deserialize_and_merge(MemPool* mem_pool, const uint8_t* src, size_t len) {
@@ -206,7 +323,7 @@ struct DistinctAggregateStateV2<PT, SumPT, FixedLengthPTGuard<PT>> {
         return size;
     }
 
-    void serialize(uint8_t* dst) const {
+    size_t serialize(uint8_t* dst) const {
         size_t size = set.size();
         memcpy(dst, &size, sizeof(size));
         dst += sizeof(size);
@@ -214,6 +331,7 @@ struct DistinctAggregateStateV2<PT, SumPT, FixedLengthPTGuard<PT>> {
             memcpy(dst, &key, sizeof(key));
             dst += sizeof(T);
         }
+        return serialize_size();
     }
 
     size_t deserialize_and_merge(const uint8_t* src, size_t len) {
@@ -373,12 +491,22 @@ public:
     }
 
     void serialize_to_column(FunctionContext* ctx, ConstAggDataPtr __restrict state, Column* to) const override {
-        auto* column = down_cast<BinaryColumn*>(to);
-        size_t old_size = column->get_bytes().size();
-        size_t new_size = old_size + this->data(state).serialize_size();
-        column->get_bytes().resize(new_size);
-        this->data(state).serialize(column->get_bytes().data() + old_size);
-        column->get_offset().emplace_back(new_size);
+        this->serialize_to_binary(ctx, state, to);
+    }
+
+    void batch_serialize(FunctionContext* ctx, size_t chunk_size, const Buffer<AggDataPtr>& agg_states,
+                         size_t state_offset, Column* to) const override {
+        this->batch_serialize_to_binary(ctx, chunk_size, agg_states, state_offset, to);
+    }
+
+    bool support_serialize_to_bytes() const override { return true; }
+
+    size_t serialize_size(FunctionContext* ctx, ConstAggDataPtr __restrict state) const override {
+        return this->data(state).serialize_size();
+    }
+
+    size_t serialize_to_bytes(FunctionContext* ctx, ConstAggDataPtr __restrict state, uint8_t* dst) const override {
+        return this->data(state).serialize(dst);
     }
 
     void convert_to_serialize_format(FunctionContext* ctx, const Columns& src, size_t chunk_size,
@@ -148,21 +148,27 @@ public:
 
     void serialize_to_column(FunctionContext* ctx, ConstAggDataPtr __restrict state, Column* to) const override {
         DCHECK(to->is_binary());
+        this->serialize_to_binary(ctx, state, to);
+    }
 
-        auto* column = down_cast<BinaryColumn*>(to);
-        Bytes& bytes = column->get_bytes();
+    void batch_serialize(FunctionContext* ctx, size_t chunk_size, const Buffer<AggDataPtr>& agg_states,
+                         size_t state_offset, Column* to) const override {
+        DCHECK(to->is_binary());
+        this->batch_serialize_to_binary(ctx, chunk_size, agg_states, state_offset, to);
+    }
 
-        const std::string& value = this->data(state).intermediate_string;
+    bool support_serialize_to_bytes() const override { return true; }
 
-        size_t old_size = bytes.size();
-        size_t new_size = old_size + sizeof(uint32_t) + value.size();
-        bytes.resize(new_size);
+    size_t serialize_size(FunctionContext* ctx, ConstAggDataPtr __restrict state) const override {
+        return sizeof(uint32_t) + this->data(state).intermediate_string.size();
+    }
 
+    size_t serialize_to_bytes(FunctionContext* ctx, ConstAggDataPtr __restrict state, uint8_t* dst) const override {
+        const std::string& value = this->data(state).intermediate_string;
         uint32_t size_value = value.size();
-        memcpy(bytes.data() + old_size, &size_value, sizeof(uint32_t));
-        memcpy(bytes.data() + old_size + sizeof(uint32_t), value.data(), size_value);
-
-        column->get_offset().emplace_back(new_size);
+        memcpy(dst, &size_value, sizeof(uint32_t));
+        memcpy(dst + sizeof(uint32_t), value.data(), size_value);
+        return sizeof(uint32_t) + size_value;
     }
 
     size_t serialize_sep_and_value(Bytes& bytes, size_t old_size, uint32_t size_value, uint32_t size_sep,
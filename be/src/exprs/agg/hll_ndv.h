@@ -9,6 +9,7 @@
 #include "exprs/agg/aggregate.h"
 #include "gutil/casts.h"
 #include "types/hll.h"
+#include "util/coding.h"
 
 namespace starrocks::vectorized {
 
@@ -44,40 +45,32 @@ public:
         }
     }
 
+    void update_batch(FunctionContext* ctx, size_t chunk_size, size_t state_offset, const Column** columns,
+                      AggDataPtr* states) const override {
+        const ColumnType* column = down_cast<const ColumnType*>(columns[0]);
+        for_each_state_run(chunk_size, states, [&](AggDataPtr state, size_t start, size_t end) {
+            _update_range(column, start, end, this->data(state + state_offset));
+        });
+    }
+
+    void update_batch_single_state(FunctionContext* ctx, size_t chunk_size, const Column** columns,
+                                   AggDataPtr __restrict state) const override {
+        const ColumnType* column = down_cast<const ColumnType*>(columns[0]);
+        _update_range(column, 0, chunk_size, this->data(state));
+    }
+
     void update_batch_single_state(FunctionContext* ctx, AggDataPtr __restrict state, const Column** columns,
                                    int64_t peer_group_start, int64_t peer_group_end, int64_t frame_start,
                                    int64_t frame_end) const override {
         const ColumnType* column = down_cast<const ColumnType*>(columns[0]);
-
-        if constexpr (pt_is_binary<PT>) {
-            uint64_t value = 0;
-            for (size_t i = frame_start; i < frame_end; ++i) {
-                Slice s = column->get_slice(i);
-                value = HashUtil::murmur_hash64A(s.data, s.size, HashUtil::MURMUR_SEED);
-
-                if (value != 0) {
-                    this->data(state).update(value);
-                }
-            }
-        } else {
-            uint64_t value = 0;
-            const auto& v = column->get_data();
-            for (size_t i = frame_start; i < frame_end; ++i) {
-                value = HashUtil::murmur_hash64A(&v[i], sizeof(v[i]), HashUtil::MURMUR_SEED);
-
-                if (value != 0) {
-                    this->data(state).update(value);
-                }
-            }
-        }
+        _update_range(column, frame_start, frame_end, this->data(state));
     }
 
     void merge(FunctionContext* ctx, const Column* column, AggDataPtr __restrict state, size_t row_num) const override {
         DCHECK(column->is_binary());
 
         const BinaryColumn* hll_column = down_cast<const BinaryColumn*>(column);
-        HyperLogLog hll(hll_column->get(row_num).get_slice());
-        this->data(state).merge(hll);
+        this->data(state).merge(hll_column->get_slice(row_num));
     }
 
     void get_values(FunctionContext* ctx, ConstAggDataPtr __restrict state, Column* dst, size_t start,
@@ -94,13 +87,23 @@ public:
     void serialize_to_column([[maybe_unused]] FunctionContext* ctx, ConstAggDataPtr __restrict state,
                              Column* to) const override {
         DCHECK(to->is_binary());
+        this->serialize_to_binary(ctx, state, to);
+    }
 
-        auto* column = down_cast<BinaryColumn*>(to);
-        size_t size = this->data(state).max_serialized_size();
-        uint8_t result[size];
+    void batch_serialize(FunctionContext* ctx, size_t chunk_size, const Buffer<AggDataPtr>& agg_states,
+                         size_t state_offset, Column* to) const override {
+        DCHECK(to->is_binary());
+        this->batch_serialize_to_binary(ctx, chunk_size, agg_states, state_offset, to);
+    }
 
-        size = this->data(state).serialize(result);
-        column->append(Slice(result, size));
+    bool support_serialize_to_bytes() const override { return true; }
+
+    size_t serialize_size(FunctionContext* ctx, ConstAggDataPtr __restrict state) const override {
+        return this->data(state).max_serialized_size();
+    }
+
+    size_t serialize_to_bytes(FunctionContext* ctx, ConstAggDataPtr __restrict state, uint8_t* dst) const override {
+        return this->data(state).serialize(dst);
     }
 
     void convert_to_serialize_format([[maybe_unused]] FunctionContext* ctx, const Columns& src, size_t chunk_size,
@@ -109,31 +112,33 @@ public:
         auto* result = down_cast<BinaryColumn*>((*dst).get());
 
         Bytes& bytes = result->get_bytes();
-        bytes.reserve(chunk_size * 10);
         result->get_offset().resize(chunk_size + 1);
 
+        // Each row is serialized as an empty HLL, or an explicit HLL of a single hash value, which is written
+        // directly instead of by a temporary HyperLogLog. See HyperLogLog::serialize.
+        constexpr size_t MAX_ROW_SIZE = 2 + sizeof(uint64_t);
         size_t old_size = bytes.size();
-        uint64_t value = 0;
-        for (size_t i = 0; i < chunk_size; ++i) {
-            HyperLogLog hll;
-            if constexpr (pt_is_binary<PT>) {
-                Slice s = column->get_slice(i);
-                value = HashUtil::murmur_hash64A(s.data, s.size, HashUtil::MURMUR_SEED);
-            } else {
-                auto v = column->get_data()[i];
-                value = HashUtil::murmur_hash64A(&v, sizeof(v), HashUtil::MURMUR_SEED);
-            }
-            if (value != 0) {
-                hll.update(value);
+        bytes.resize(old_size + chunk_size * MAX_ROW_SIZE);
+        uint8_t* ptr = bytes.data() + old_size;
+
+        uint64_t hash_values[HASH_BLOCK_SIZE];
+        for (size_t start = 0; start < chunk_size; start += HASH_BLOCK_SIZE) {
+            size_t end = std::min(chunk_size, start + HASH_BLOCK_SIZE);
+            _hash_values(column, start, end, hash_values);
+            for (size_t i = start; i < end; ++i) {
+                uint64_t value = hash_values[i - start];
+                if (value != 0) {
+                    *ptr++ = HLL_DATA_EXPLICIT;
+                    *ptr++ = 1;
+                    encode_fixed64_le(ptr, value);
+                    ptr += sizeof(uint64_t);
+                } else {
+                    *ptr++ = HLL_DATA_EMPTY;
+                }
+                result->get_offset()[i + 1] = ptr - bytes.data();
             }
-
-            size_t new_size = old_size + hll.max_serialized_size();
-            bytes.resize(new_size);
-            hll.serialize(bytes.data() + old_size);
-
-            result->get_offset()[i + 1] = new_size;
-            old_size = new_size;
         }
+        bytes.resize(ptr - bytes.data());
     }
 
     void finalize_to_column(FunctionContext* ctx __attribute__((unused)), ConstAggDataPtr __restrict state,
@@ -145,6 +150,34 @@ public:
     }
 
     std::string get_name() const override { return "ndv"; }
+
+private:
+    // The values are hashed by blocks, so that hashing a block is a tight loop over the column, and the
+    // hash values of a block are added to the HLL by a single HyperLogLog::update_batch.
+    static constexpr size_t HASH_BLOCK_SIZE = 1024;
+
+    static void _hash_values(const ColumnType* column, size_t from, size_t to, uint64_t* hash_values) {
+        if constexpr (pt_is_binary<PT>) {
+            for (size_t i = from; i < to; ++i) {
+                Slice s = column->get_slice(i);
+                hash_values[i - from] = HashUtil::murmur_hash64A(s.data, s.size, HashUtil::MURMUR_SEED);
+            }
+        } else {
+            const auto* data = column->get_data().data();
+            for (size_t i = from; i < to; ++i) {
+                hash_values[i - from] = HashUtil::murmur_hash64A(&data[i], sizeof(data[i]), HashUtil::MURMUR_SEED);
+            }
+        }
+    }
+
+    static void _update_range(const ColumnType* column, size_t from, size_t to, HyperLogLog& hll) {
+        uint64_t hash_values[HASH_BLOCK_SIZE];
+        for (size_t start = from; start < to; start += HASH_BLOCK_SIZE) {
+            size_t end = std::min(to, start + HASH_BLOCK_SIZE);
+            _hash_values(column, start, end, hash_values);
+            hll.update_batch(hash_values, end - start);
+        }
+    }
 };
 
 } // namespace starrocks::vectorized
@@ -187,6 +187,20 @@ public:
         OP()(this->data(state), value);
     }
 
+    void update_batch(FunctionContext* ctx, size_t chunk_size, size_t state_offset, const Column** columns,
+                      AggDataPtr* states) const override {
+        DCHECK(!columns[0]->is_nullable() && !columns[0]->is_binary());
+        const auto* data = down_cast<const InputColumnType*>(columns[0])->get_data().data();
+        for_each_state_run(chunk_size, states, [&](AggDataPtr state, size_t start, size_t end) {
+            // Reduce the run on a local copy, which the compiler can keep in registers.
+            State local = this->data(state + state_offset);
+            for (size_t i = start; i < end; ++i) {
+                OP()(local, data[i]);
+            }
+            this->data(state + state_offset) = local;
+        });
+    }
+
     void update_batch_single_state(FunctionContext* ctx, AggDataPtr __restrict state, const Column** columns,
                                    int64_t peer_group_start, int64_t peer_group_end, int64_t frame_start,
                                    int64_t frame_end) const override {
@@ -195,6 +209,22 @@ public:
         }
     }
 
+    bool is_removable() const override { return true; }
+
+    // The result stays in the frame unless a removed row equals it, so the state needs to be rebuilt only then,
+    // which is rare unless the input is monotonic.
+    bool remove_batch_single_state(FunctionContext* ctx, AggDataPtr __restrict state, const Column** columns,
+                                   int64_t prev_frame_start, int64_t frame_start, int64_t frame_end) const override {
+        const auto* data = down_cast<const InputColumnType*>(columns[0])->get_data().data();
+        const T& result = this->data(state).result;
+        for (size_t i = prev_frame_start; i < frame_start; ++i) {
+            if (data[i] == result) {
+                return false;
+            }
+        }
+        return true;
+    }
+
     void merge(FunctionContext* ctx, const Column* column, AggDataPtr __restrict state, size_t row_num) const override {
         DCHECK(!column->is_nullable() && !column->is_binary());
         const auto* input_column = down_cast<const InputColumnType*>(column);
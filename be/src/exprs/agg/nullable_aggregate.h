@@ -6,6 +6,7 @@
 #include <immintrin.h>
 #endif
 
+#include <cstring>
 #include <utility>
 
 #include "column/chunk.h"
@@ -105,6 +106,28 @@ public:
 
     void batch_serialize(FunctionContext* ctx, size_t chunk_size, const Buffer<AggDataPtr>& agg_states,
                          size_t state_offset, Column* to) const override {
+        if (nested_function->support_serialize_to_bytes()) {
+            DCHECK(to->is_nullable());
+            auto* nullable_column = down_cast<NullableColumn*>(to);
+            NullData& null_data = nullable_column->null_column_data();
+            const size_t old_size = null_data.size();
+            null_data.resize(old_size + chunk_size);
+            bool has_null = false;
+            for (size_t i = 0; i < chunk_size; i++) {
+                null_data[old_size + i] = this->data(agg_states[i] + state_offset).is_null;
+                has_null |= null_data[old_size + i];
+            }
+            // The null rows are serialized as empty values, same as append_default.
+            serialize_states_to_binary(
+                    nested_function.get(), ctx, chunk_size,
+                    [&](size_t i) -> ConstAggDataPtr {
+                        const auto& state = this->data(agg_states[i] + state_offset);
+                        return state.is_null ? nullptr : state.nested_state();
+                    },
+                    down_cast<BinaryColumn*>(nullable_column->mutable_data_column()));
+            nullable_column->set_has_null(has_null);
+            return;
+        }
         for (size_t i = 0; i < chunk_size; i++) {
             serialize_to_column(ctx, agg_states[i] + state_offset, to);
         }
@@ -281,12 +304,14 @@ public:
                     this->nested_function->process_null(ctx, this->data(states[i] + state_offset).mutable_nest_state());
                 }
             }
-        } else {
+        } else if (chunk_size > 0) {
             for (size_t i = 0; i < chunk_size; ++i) {
                 this->data(states[i] + state_offset).is_null = false;
-                this->nested_function->update(ctx, columns, this->data(states[i] + state_offset).mutable_nest_state(),
-                                              i);
             }
+            // The nested states are at the same offset of all the states, so the nested function can update them
+            // in batch, with its own vectorized kernel if any.
+            const size_t nested_state_offset = this->data(states[0] + state_offset).mutable_nest_state() - states[0];
+            this->nested_function->update_batch(ctx, chunk_size, nested_state_offset, columns, states);
         }
     }
 
@@ -501,6 +526,53 @@ public:
                                                              peer_group_start, peer_group_end, frame_start, frame_end);
         }
     }
+
+    bool is_removable() const override { return IgnoreNull && this->nested_function->is_removable(); }
+
+    bool remove_batch_single_state(FunctionContext* ctx, AggDataPtr __restrict state, const Column** columns,
+                                   int64_t prev_frame_start, int64_t frame_start, int64_t frame_end) const override {
+        if constexpr (!IgnoreNull) {
+            return false;
+        }
+        if (prev_frame_start >= frame_start) {
+            return true;
+        }
+        if (!columns[0]->is_nullable()) {
+            return this->nested_function->remove_batch_single_state(ctx, this->data(state).mutable_nest_state(),
+                                                                    columns, prev_frame_start, frame_start, frame_end);
+        }
+
+        const auto* column = down_cast<const NullableColumn*>(columns[0]);
+        const Column* data_column = &column->data_column_ref();
+        if (!column->has_null()) {
+            return this->nested_function->remove_batch_single_state(ctx, this->data(state).mutable_nest_state(),
+                                                                    &data_column, prev_frame_start, frame_start,
+                                                                    frame_end);
+        }
+
+        // Remove the runs of the not null rows, which have been added to the nested state.
+        const uint8_t* f_data = column->null_column()->raw_data();
+        int64_t run_start = prev_frame_start;
+        while (run_start < frame_start) {
+            if (f_data[run_start] != 0) {
+                run_start++;
+                continue;
+            }
+            int64_t run_end = run_start + 1;
+            while (run_end < frame_start && f_data[run_end] == 0) {
+                run_end++;
+            }
+            if (!this->nested_function->remove_batch_single_state(ctx, this->data(state).mutable_nest_state(),
+                                                                  &data_column, run_start, run_end, frame_end)) {
+                return false;
+            }
+            run_start = run_end;
+        }
+        // The result is null again if only the null rows are left in the frame.
+        this->data(state).is_null =
+                frame_start >= frame_end || memchr(f_data + frame_start, 0, frame_end - frame_start) == nullptr;
+        return true;
+    }
 };
 
 template <typename State>
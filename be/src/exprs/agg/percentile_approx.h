@@ -44,48 +44,121 @@ public:
         data(state).is_null = false;
     }
 
-    void merge(FunctionContext* ctx, const Column* column, AggDataPtr __restrict state, size_t row_num) const override {
-        Slice src;
-        if (column->is_nullable()) {
-            if (column->is_null(row_num)) {
-                return;
+    // Adds the values of the chunk to the t-digest at a time instead of row by row.
+    void update_batch_single_state(FunctionContext* ctx, size_t chunk_size, const Column** columns,
+                                   AggDataPtr __restrict state) const override {
+        const uint8_t* null_data = nullptr;
+        const DoubleColumn* data_column = nullptr;
+        if (columns[0]->is_nullable()) {
+            const auto* nullable_column = down_cast<const NullableColumn*>(columns[0]);
+            if (nullable_column->has_null()) {
+                null_data = nullable_column->immutable_null_column_data().data();
             }
-            const auto* nullable_column = down_cast<const NullableColumn*>(column);
-            src = nullable_column->data_column()->get(row_num).get_slice();
+            data_column = down_cast<const DoubleColumn*>(nullable_column->data_column().get());
         } else {
-            const auto* binary_column = down_cast<const BinaryColumn*>(column);
-            src = binary_column->get_slice(row_num);
+            data_column = down_cast<const DoubleColumn*>(columns[0]);
         }
-        double quantile;
-        memcpy(&quantile, src.data, sizeof(double));
+        const auto& values = data_column->get_data();
 
-        PercentileApproxState src_percentile;
-        src_percentile.targetQuantile = quantile;
-        src_percentile.percentile->deserialize((char*)src.data + sizeof(double));
+        std::vector<float> buffer;
+        buffer.reserve(chunk_size);
+        for (size_t i = 0; i < chunk_size; ++i) {
+            if (null_data == nullptr || !null_data[i]) {
+                buffer.push_back(implicit_cast<float>(values[i]));
+            }
+        }
+        if (buffer.empty()) {
+            return;
+        }
 
-        data(state).percentile->merge(src_percentile.percentile.get());
-        data(state).targetQuantile = quantile;
+        DCHECK(!columns[1]->only_null());
+        DCHECK(!columns[1]->is_null(0));
+
+        data(state).percentile->add_many(buffer.data(), buffer.size());
+        data(state).targetQuantile = columns[1]->get(0).get_double();
         data(state).is_null = false;
     }
 
-    void serialize_to_column(FunctionContext* ctx, ConstAggDataPtr __restrict state, Column* to) const override {
-        size_t size = data(state).percentile->serialize_size();
-        uint8_t result[size + sizeof(double)];
-        memcpy(result, &(data(state).targetQuantile), sizeof(double));
-        data(state).percentile->serialize(result + sizeof(double));
+    void merge(FunctionContext* ctx, const Column* column, AggDataPtr __restrict state, size_t row_num) const override {
+        PercentileValue src_percentile;
+        _merge(column, state, row_num, &src_percentile);
+    }
 
+    // The batch merges deserialize the rows into the same PercentileValue, which reuses its memory.
+    void merge_batch(FunctionContext* ctx, size_t chunk_size, size_t state_offset, const Column* column,
+                     AggDataPtr* states) const override {
+        PercentileValue src_percentile;
+        for (size_t i = 0; i < chunk_size; ++i) {
+            _merge(column, states[i] + state_offset, i, &src_percentile);
+        }
+    }
+
+    void merge_batch_selectively(FunctionContext* ctx, size_t chunk_size, size_t state_offset, const Column* column,
+                                 AggDataPtr* states, const std::vector<uint8_t>& filter) const override {
+        PercentileValue src_percentile;
+        for (size_t i = 0; i < chunk_size; ++i) {
+            if (filter[i] == 0) {
+                _merge(column, states[i] + state_offset, i, &src_percentile);
+            }
+        }
+    }
+
+    void merge_batch_single_state(FunctionContext* ctx, size_t chunk_size, const Column* column,
+                                  AggDataPtr __restrict state) const override {
+        PercentileValue src_percentile;
+        for (size_t i = 0; i < chunk_size; ++i) {
+            _merge(column, state, i, &src_percentile);
+        }
+    }
+
+    void serialize_to_column(FunctionContext* ctx, ConstAggDataPtr __restrict state, Column* to) const override {
         if (to->is_nullable()) {
             auto* column = down_cast<NullableColumn*>(to);
             if (data(state).is_null) {
                 column->append_default();
             } else {
-                down_cast<BinaryColumn*>(column->data_column().get())->append(Slice(result, size));
+                this->serialize_to_binary(ctx, state, column->data_column().get());
                 column->null_column_data().push_back(0);
             }
         } else {
-            BinaryColumn* column = down_cast<BinaryColumn*>(to);
-            column->append(Slice(result, size));
+            this->serialize_to_binary(ctx, state, to);
+        }
+    }
+
+    void batch_serialize(FunctionContext* ctx, size_t chunk_size, const Buffer<AggDataPtr>& agg_states,
+                         size_t state_offset, Column* to) const override {
+        if (!to->is_nullable()) {
+            this->batch_serialize_to_binary(ctx, chunk_size, agg_states, state_offset, to);
+            return;
+        }
+        auto* column = down_cast<NullableColumn*>(to);
+        NullData& null_data = column->null_column_data();
+        bool has_null = false;
+        for (size_t i = 0; i < chunk_size; ++i) {
+            const bool is_null = data(agg_states[i] + state_offset).is_null;
+            null_data.push_back(is_null);
+            has_null |= is_null;
         }
+        serialize_states_to_binary(
+                this, ctx, chunk_size,
+                [&](size_t i) -> ConstAggDataPtr {
+                    ConstAggDataPtr state = agg_states[i] + state_offset;
+                    return data(state).is_null ? nullptr : state;
+                },
+                down_cast<BinaryColumn*>(column->data_column().get()));
+        column->set_has_null(has_null);
+    }
+
+    bool support_serialize_to_bytes() const override { return true; }
+
+    size_t serialize_size(FunctionContext* ctx, ConstAggDataPtr __restrict state) const override {
+        return sizeof(double) + data(state).percentile->serialize_size();
+    }
+
+    size_t serialize_to_bytes(FunctionContext* ctx, ConstAggDataPtr __restrict state, uint8_t* dst) const override {
+        memcpy(dst, &(data(state).targetQuantile), sizeof(double));
+        data(state).percentile->serialize(dst + sizeof(double));
+        return serialize_size(ctx, state);
     }
 
     void convert_to_serialize_format(FunctionContext* ctx, const Columns& src, size_t chunk_size,
@@ -166,5 +239,29 @@ public:
     }
 
     std::string get_name() const override { return "percentile_approx"; }
+
+private:
+    void _merge(const Column* column, AggDataPtr __restrict state, size_t row_num,
+                PercentileValue* src_percentile) const {
+        Slice src;
+        if (column->is_nullable()) {
+            if (column->is_null(row_num)) {
+                return;
+            }
+            const auto* nullable_column = down_cast<const NullableColumn*>(column);
+            src = nullable_column->data_column()->get(row_num).get_slice();
+        } else {
+            const auto* binary_column = down_cast<const BinaryColumn*>(column);
+            src = binary_column->get_slice(row_num);
+        }
+        double quantile;
+        memcpy(&quantile, src.data, sizeof(double));
+
+        src_percentile->deserialize((char*)src.data + sizeof(double));
+
+        data(state).percentile->merge(src_percentile);
+        data(state).targetQuantile = quantile;
+        data(state).is_null = false;
+    }
 };
 } // namespace starrocks::vectorized
@@ -50,6 +50,24 @@ public:
         this->data(state).sum += column.get_data()[row_num];
     }
 
+    void update_batch(FunctionContext* ctx, size_t chunk_size, size_t state_offset, const Column** columns,
+                      AggDataPtr* states) const override {
+        if constexpr (pt_is_arithmetic<PT> || pt_is_decimal<PT> || pt_is_decimalv2<PT>) {
+            const auto* data = down_cast<const InputColumnType*>(columns[0])->get_data().data();
+            for_each_state_run(chunk_size, states, [&](AggDataPtr state, size_t start, size_t end) {
+                ResultType sum{};
+                for (size_t i = start; i < end; ++i) {
+                    sum += data[i];
+                }
+                this->data(state + state_offset).sum += sum;
+            });
+        } else {
+            for (size_t i = 0; i < chunk_size; ++i) {
+                update(ctx, columns, states[i] + state_offset, i);
+            }
+        }
+    }
+
     void update_batch_single_state(FunctionContext* ctx, size_t chunk_size, const Column** columns,
                                    AggDataPtr __restrict state) const override {
         const auto* column = down_cast<const InputColumnType*>(columns[0]);
@@ -69,6 +87,24 @@ public:
         }
     }
 
+    // The float sums aren't removable, since the rounding errors of the removed rows would be accumulated.
+    bool is_removable() const override { return pt_is_integral<PT> || pt_is_decimal<PT> || pt_is_decimalv2<PT>; }
+
+    bool remove_batch_single_state(FunctionContext* ctx, AggDataPtr __restrict state, const Column** columns,
+                                   int64_t prev_frame_start, int64_t frame_start, int64_t frame_end) const override {
+        if constexpr (pt_is_integral<PT> || pt_is_decimal<PT> || pt_is_decimalv2<PT>) {
+            const auto* data = down_cast<const InputColumnType*>(columns[0])->get_data().data();
+            ResultType removed{};
+            for (size_t i = prev_frame_start; i < frame_start; ++i) {
+                removed += data[i];
+            }
+            this->data(state).sum = this->data(state).sum - removed;
+            return true;
+        } else {
+            return false;
+        }
+    }
+
     void merge(FunctionContext* ctx, const Column* column, AggDataPtr __restrict state, size_t row_num) const override {
         DCHECK(column->is_numeric() || column->is_decimal());
         const auto* input_column = down_cast<const ResultColumnType*>(column);
@@ -30,6 +30,10 @@ public:
             return VectorizedStrictDecimalBinaryFunction<OP, true>::template evaluate<Type>(l, r);
         } else {
             using ArithmeticOp = ArithmeticBinaryOperator<OP, Type>;
+            // reuse the result column of a child, e.g. in `a * b + c`
+            if (auto result = InPlaceBinaryFunction<ArithmeticOp>::template evaluate<Type>(l, r); result != nullptr) {
+                return result;
+            }
             return VectorizedStrictBinaryFunction<ArithmeticOp>::template evaluate<Type>(l, r);
         }
     }
@@ -10,6 +10,39 @@
 #include "util/phmap/phmap.h"
 
 namespace starrocks::vectorized {
+// Accesses the elements of the arrays of an ArrayColumn directly on its offsets and its flat elements column,
+// so that the array functions don't materialize a DatumArray for each array.
+template <PrimitiveType PT>
+class ArrayElementsViewer {
+public:
+    using CppType = RunTimeCppType<PT>;
+    using ColumnType = RunTimeColumnType<PT>;
+
+    explicit ArrayElementsViewer(const ArrayColumn& column) : _offsets(column.offsets().get_data().data()) {
+        const Column* elements = &column.elements();
+        if (elements->is_nullable()) {
+            const auto& nullable_elements = down_cast<const NullableColumn&>(*elements);
+            elements = nullable_elements.data_column().get();
+            if (nullable_elements.has_null()) {
+                _null_data = nullable_elements.null_column()->get_data().data();
+            }
+        }
+        _data = down_cast<const ColumnType*>(elements)->get_data().data();
+    }
+
+    // the elements of the array at index are in [begin(index), end(index)) of the elements column
+    size_t begin(size_t index) const { return _offsets[index]; }
+    size_t end(size_t index) const { return _offsets[index + 1]; }
+
+    bool is_null(size_t element_index) const { return _null_data != nullptr && _null_data[element_index]; }
+    const CppType& value(size_t element_index) const { return _data[element_index]; }
+
+private:
+    const uint32_t* _offsets;
+    const uint8_t* _null_data = nullptr;
+    const CppType* _data = nullptr;
+};
+
 template <PrimitiveType PT>
 class ArrayDistinct {
 public:
@@ -41,6 +74,7 @@ private:
         if (columns[0]->is_nullable()) {
             const auto* src_nullable_column = down_cast<const NullableColumn*>(src_column.get());
             const auto* src_data_column = down_cast<const ArrayColumn*>(src_nullable_column->data_column().get());
+            ArrayElementsViewer<PT> viewer(*src_data_column);
             auto& dest_nullable_column = down_cast<NullableColumn&>(*dest_column);
             auto& dest_null_data = down_cast<NullableColumn&>(*dest_column).null_column_data();
             auto& dest_data_column = down_cast<ArrayColumn&>(*dest_nullable_column.data_column());
@@ -51,7 +85,7 @@ private:
             if (src_nullable_column->has_null()) {
                 for (size_t i = 0; i < chunk_size; i++) {
                     if (!src_nullable_column->is_null(i)) {
-                        _array_distinct_item<HashSet>(*src_data_column, i, &hash_set, &dest_data_column);
+                        _array_distinct_item<HashSet>(viewer, i, &hash_set, &dest_data_column);
                         hash_set.clear();
                     } else {
                         dest_data_column.append_default();
@@ -59,16 +93,17 @@ private:
                 }
             } else {
                 for (size_t i = 0; i < chunk_size; i++) {
-                    _array_distinct_item<HashSet>(*src_data_column, i, &hash_set, &dest_data_column);
+                    _array_distinct_item<HashSet>(viewer, i, &hash_set, &dest_data_column);
                     hash_set.clear();
                 }
             }
         } else {
             const auto* src_data_column = down_cast<const ArrayColumn*>(src_column.get());
             auto* dest_data_column = down_cast<ArrayColumn*>(dest_column.get());
+            ArrayElementsViewer<PT> viewer(*src_data_column);
 
             for (size_t i = 0; i < chunk_size; i++) {
-                _array_distinct_item<HashSet>(*src_data_column, i, &hash_set, dest_data_column);
+                _array_distinct_item<HashSet>(viewer, i, &hash_set, dest_data_column);
                 hash_set.clear();
             }
         }
@@ -76,18 +111,14 @@ private:
     }
 
     template <typename HashSet>
-    static void _array_distinct_item(const ArrayColumn& column, size_t index, HashSet* hash_set,
+    static void _array_distinct_item(const ArrayElementsViewer<PT>& viewer, size_t index, HashSet* hash_set,
                                      ArrayColumn* dest_column) {
         bool has_null = false;
-        // TODO: may be has performance problem, optimize later
-        Datum v = column.get(index);
-        const auto& items = v.get<DatumArray>();
-
-        for (const auto& item : items) {
-            if (item.is_null()) {
+        for (size_t i = viewer.begin(index), end = viewer.end(index); i < end; ++i) {
+            if (viewer.is_null(i)) {
                 has_null = true;
             } else {
-                hash_set->emplace(item.get<CppType>());
+                hash_set->emplace(viewer.value(i));
             }
         }
 
@@ -493,9 +524,14 @@ private:
             }
         }
 
+        std::vector<ArrayElementsViewer<PT>> viewers;
+        viewers.reserve(src_columns.size());
+        for (const auto* src_column : src_columns) {
+            viewers.emplace_back(*src_column);
+        }
         HashSet hash_set;
         for (size_t i = 0; i < chunk_size; i++) {
-            _array_overlap_item<HashSet>(src_columns, i, &hash_set,
+            _array_overlap_item<HashSet>(viewers, i, &hash_set,
                                          static_cast<BooleanColumn*>(result_column.get())->get_data().data());
             hash_set.clear();
         }
@@ -508,33 +544,31 @@ private:
     }
 
     template <typename HashSet>
-    static void _array_overlap_item(const std::vector<ArrayColumn*>& columns, size_t index, HashSet* hash_set,
-                                    uint8_t* data) {
+    static void _array_overlap_item(const std::vector<ArrayElementsViewer<PT>>& viewers, size_t index,
+                                    HashSet* hash_set, uint8_t* data) {
         bool has_null = false;
 
         {
-            Datum v = columns[0]->get(index);
-            const auto& items = v.get<DatumArray>();
-            for (const auto& item : items) {
-                if (item.is_null()) {
+            const auto& viewer = viewers[0];
+            for (size_t i = viewer.begin(index), end = viewer.end(index); i < end; ++i) {
+                if (viewer.is_null(i)) {
                     has_null = true;
                 } else {
-                    hash_set->emplace(item.get<CppType>());
+                    hash_set->emplace(viewer.value(i));
                 }
             }
         }
 
         {
-            Datum v = columns[1]->get(index);
-            const auto& items = v.get<DatumArray>();
-            for (const auto& item : items) {
-                if (item.is_null()) {
+            const auto& viewer = viewers[1];
+            for (size_t i = viewer.begin(index), end = viewer.end(index); i < end; ++i) {
+                if (viewer.is_null(i)) {
                     if (has_null) {
                         data[index] = 1;
                         return;
                     }
                 } else {
-                    auto iter = hash_set->find(item.get<CppType>());
+                    auto iter = hash_set->find(viewer.value(i));
                     if (iter != hash_set->end()) {
                         data[index] = 1;
                         return;
@@ -644,9 +678,14 @@ private:
             dest_data_column = down_cast<ArrayColumn*>(dest_column.get());
         }
 
+        std::vector<ArrayElementsViewer<PT>> viewers;
+        viewers.reserve(src_columns.size());
+        for (const auto* src_column : src_columns) {
+            viewers.emplace_back(*src_column);
+        }
         HashSet hash_set;
         for (size_t i = 0; i < chunk_size; i++) {
-            _array_intersect_item<HashSet>(src_columns, i, &hash_set, dest_data_column);
+            _array_intersect_item<HashSet>(viewers, i, &hash_set, dest_data_column);
             hash_set.clear();
         }
 
@@ -654,31 +693,29 @@ private:
     }
 
     template <typename HashSet>
-    static void _array_intersect_item(const std::vector<ArrayColumn*>& columns, size_t index, HashSet* hash_set,
-                                      ArrayColumn* dest_column) {
+    static void _array_intersect_item(const std::vector<ArrayElementsViewer<PT>>& viewers, size_t index,
+                                      HashSet* hash_set, ArrayColumn* dest_column) {
         bool has_null = false;
 
         {
-            Datum v = columns[0]->get(index);
-            const auto& items = v.get<DatumArray>();
-            for (const auto& item : items) {
-                if (item.is_null()) {
+            const auto& viewer = viewers[0];
+            for (size_t j = viewer.begin(index), end = viewer.end(index); j < end; ++j) {
+                if (viewer.is_null(j)) {
                     has_null = true;
                 } else {
-                    hash_set->emplace(CppTypeWithOverlapTimes(item.get<CppType>(), 0));
+                    hash_set->emplace(CppTypeWithOverlapTimes(viewer.value(j), 0));
                 }
             }
         }
 
-        for (int i = 1; i < columns.size(); ++i) {
-            Datum v = columns[i]->get(index);
-            const auto& items = v.get<DatumArray>();
+        for (int i = 1; i < viewers.size(); ++i) {
+            const auto& viewer = viewers[i];
             bool local_has_null = false;
-            for (const auto& item : items) {
-                if (item.is_null()) {
+            for (size_t j = viewer.begin(index), end = viewer.end(index); j < end; ++j) {
+                if (viewer.is_null(j)) {
                     local_has_null = true;
                 } else {
-                    auto iter = hash_set->find(item.get<CppType>());
+                    auto iter = hash_set->find(viewer.value(j));
                     if (iter != hash_set->end()) {
                         if (iter->overlap_times < i) {
                             ++iter->overlap_times;
@@ -693,7 +730,7 @@ private:
         auto& dest_data_column = dest_column->elements_column();
         auto& dest_offsets = dest_column->offsets_column()->get_data();
 
-        auto max_overlap_times = columns.size() - 1;
+        auto max_overlap_times = viewers.size() - 1;
         size_t result_size = 0;
         for (auto iterator = hash_set->begin(); iterator != hash_set->end(); ++iterator) {
             if (iterator->overlap_times == max_overlap_times) {
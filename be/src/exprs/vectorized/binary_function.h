@@ -192,6 +192,107 @@ public:
     }
 };
 
+/**
+ * Execute a strict operation in place on one of the operands, instead of allocating and writing a new
+ * result column. An operand is reused only if it is a temporary column owned by the caller alone, like
+ * the result of a child expression, and it has the type of the result. So a tree of arithmetic
+ * expressions writes the intermediate results into the columns of its leaf computations.
+ *
+ * The other operand must be a vector of the same type, or a not-null constant, and it may only be
+ * nullable if the reused operand is nullable.
+ *
+ * @return the result column, or nullptr if none of the operands can be reused
+ * @param OP the operation impl, its result type must be the type of the operands
+ */
+template <typename OP>
+class InPlaceBinaryFunction {
+public:
+    template <PrimitiveType Type>
+    static ColumnPtr evaluate(const ColumnPtr& v1, const ColumnPtr& v2) {
+        if (_is_reusable<Type>(v1, v2)) {
+            return _apply<Type, true>(v1, v2);
+        }
+        if (_is_reusable<Type>(v2, v1)) {
+            return _apply<Type, false>(v2, v1);
+        }
+        return nullptr;
+    }
+
+private:
+    template <PrimitiveType Type>
+    static bool _is_data_column_of(const Column* column) {
+        return dynamic_cast<const RunTimeColumnType<Type>*>(column) != nullptr;
+    }
+
+    template <PrimitiveType Type>
+    static bool _is_reusable(const ColumnPtr& dst, const ColumnPtr& other) {
+        if (dst.use_count() != 1 || dst->is_constant() || dst.get() == other.get()) {
+            return false;
+        }
+        if (dst->is_nullable()) {
+            auto* nullable = down_cast<NullableColumn*>(dst.get());
+            if (nullable->data_column().use_count() != 1 || nullable->null_column().use_count() != 1) {
+                return false;
+            }
+        } else if (other->is_nullable()) {
+            return false;
+        }
+        if (!_is_data_column_of<Type>(ColumnHelper::get_data_column(dst.get()))) {
+            return false;
+        }
+        if (other->is_constant()) {
+            return !other->only_null() && _is_data_column_of<Type>(ColumnHelper::get_data_column(other.get()));
+        }
+        return other->size() == dst->size() && _is_data_column_of<Type>(ColumnHelper::get_data_column(other.get()));
+    }
+
+    // DST_IS_LEFT: dst is the left operand of OP
+    template <PrimitiveType Type, bool DST_IS_LEFT>
+    static ColumnPtr _apply(const ColumnPtr& dst, const ColumnPtr& other) {
+        using CppType = RunTimeCppType<Type>;
+        using ColumnType = RunTimeColumnType<Type>;
+        auto* dst_data = down_cast<ColumnType*>(ColumnHelper::get_data_column(dst.get()))->get_data().data();
+        const Column* other_column = ColumnHelper::get_data_column(other.get());
+        const auto* other_data = down_cast<const ColumnType*>(other_column)->get_data().data();
+        const size_t size = dst->size();
+
+        if (other->is_constant()) {
+            const CppType value = other_data[0];
+            for (size_t i = 0; i < size; ++i) {
+                if constexpr (DST_IS_LEFT) {
+                    dst_data[i] = OP::template apply<CppType, CppType, CppType>(dst_data[i], value);
+                } else {
+                    dst_data[i] = OP::template apply<CppType, CppType, CppType>(value, dst_data[i]);
+                }
+            }
+        } else {
+            for (size_t i = 0; i < size; ++i) {
+                if constexpr (DST_IS_LEFT) {
+                    dst_data[i] = OP::template apply<CppType, CppType, CppType>(dst_data[i], other_data[i]);
+                } else {
+                    dst_data[i] = OP::template apply<CppType, CppType, CppType>(other_data[i], dst_data[i]);
+                }
+            }
+        }
+
+        if (!dst->is_nullable()) {
+            return dst;
+        }
+        auto* nullable = down_cast<NullableColumn*>(dst.get());
+        if (other->is_nullable()) {
+            auto* nulls = nullable->null_column_data().data();
+            const auto& other_nullable = down_cast<const NullableColumn&>(*other);
+            const auto* other_nulls = other_nullable.immutable_null_column_data().data();
+            for (size_t i = 0; i < size; ++i) {
+                nulls[i] |= other_nulls[i];
+            }
+            nullable->update_has_null();
+        }
+        // keep the shape of the result of UnionNullableColumnBinaryFunction
+        return nullable->has_null() ? dst : nullable->data_column();
+    }
+};
+
 template <typename FN, typename NULL_OP = ResultNopCheck>
 class CheckOutputBinaryFunction {
 public:
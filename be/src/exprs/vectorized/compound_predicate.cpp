@@ -2,9 +2,13 @@
 
 #include "exprs/vectorized/compound_predicate.h"
 
+#include <strings.h>
+
 #include "common/object_pool.h"
 #include "exprs/predicate.h"
 #include "exprs/vectorized/binary_function.h"
+#include "exprs/vectorized/column_ref.h"
+#include "exprs/vectorized/like_predicate.h"
 #include "exprs/vectorized/unary_function.h"
 
 namespace starrocks::vectorized {
@@ -63,7 +67,20 @@ DEFINE_BINARY_FUNCTION_WITH_IMPL(OrImpl, l_value, r_value) {
 class VectorizedOrCompoundPredicate final : public Predicate {
 public:
     DEFINE_COMPOUND_CONSTRUCT(VectorizedOrCompoundPredicate);
+
+    Status open(RuntimeState* state, ExprContext* context, FunctionContext::FunctionStateScope scope) override {
+        RETURN_IF_ERROR(Expr::open(state, context, scope));
+        if (scope == FunctionContext::FRAGMENT_LOCAL) {
+            _init_pattern_matcher(context);
+        }
+        return Status::OK();
+    }
+
     ColumnPtr evaluate(ExprContext* context, vectorized::Chunk* ptr) override {
+        if (_pattern_matcher != nullptr) {
+            return _pattern_matcher->evaluate(ptr->get_column_by_slot_id(_pattern_slot_id));
+        }
+
         auto l = _children[0]->evaluate(context, ptr);
 
         int l_trues = ColumnHelper::count_true_with_notnull(l);
@@ -76,6 +93,73 @@ public:
 
         return VectorizedLogicPredicateBinaryFunction<OrNullImpl, OrImpl>::template evaluate<TYPE_BOOLEAN>(l, r);
     }
+
+private:
+    static void _collect_disjuncts(Expr* expr, std::vector<Expr*>* disjuncts) {
+        if (expr->node_type() == TExprNodeType::COMPOUND_PRED && expr->op() == TExprOpcode::COMPOUND_OR) {
+            for (auto* child : expr->children()) {
+                _collect_disjuncts(child, disjuncts);
+            }
+        } else {
+            disjuncts->emplace_back(expr);
+        }
+    }
+
+    // If all the disjuncts are LIKE or REGEXP on the same column with constant patterns, compile
+    // the patterns into one Hyperscan database, so each row is scanned once instead of once per
+    // disjunct. Otherwise the disjuncts are evaluated one by one, which also reports invalid patterns.
+    void _init_pattern_matcher(ExprContext* context) {
+        std::vector<Expr*> disjuncts;
+        _collect_disjuncts(this, &disjuncts);
+
+        ColumnRef* value_ref = nullptr;
+        Columns pattern_columns;
+        std::vector<Slice> like_patterns;
+        std::vector<Slice> regex_patterns;
+        for (auto* disjunct : disjuncts) {
+            if (disjunct->node_type() != TExprNodeType::FUNCTION_CALL || disjunct->get_num_children() != 2) {
+                return;
+            }
+            const auto& name = disjunct->fn().name.function_name;
+            bool is_like = strcasecmp(name.c_str(), "like") == 0;
+            if (!is_like && strcasecmp(name.c_str(), "regexp") != 0) {
+                return;
+            }
+
+            auto* value = disjunct->get_child(0);
+            if (!value->is_slotref()) {
+                return;
+            }
+            auto* ref = down_cast<ColumnRef*>(value);
+            if (value_ref != nullptr && ref->slot_id() != value_ref->slot_id()) {
+                return;
+            }
+            value_ref = ref;
+
+            auto* pattern = disjunct->get_child(1);
+            if (!pattern->is_constant()) {
+                return;
+            }
+            auto pattern_column = pattern->evaluate_const(context);
+            if (!pattern_column.ok() || pattern_column.value() == nullptr || pattern_column.value()->only_null()) {
+                return;
+            }
+            auto pattern_value = ColumnHelper::get_const_value<TYPE_VARCHAR>(pattern_column.value());
+            (is_like ? like_patterns : regex_patterns).emplace_back(pattern_value);
+            pattern_columns.emplace_back(std::move(pattern_column).value());
+        }
+
+        auto matcher = LikePredicate::MultiPatternMatcher::create(like_patterns, regex_patterns);
+        if (!matcher.ok()) {
+            return;
+        }
+        _pattern_slot_id = value_ref->slot_id();
+        _pattern_matcher = std::move(matcher).value();
+    }
+
+    // shared by the clones, the matcher is read-only after open
+    std::shared_ptr<LikePredicate::MultiPatternMatcher> _pattern_matcher;
+    SlotId _pattern_slot_id = -1;
 };
 
 DEFINE_UNARY_FN_WITH_IMPL(CompoundPredNot, l) {
@@ -7,6 +7,7 @@
 #include "column/column_viewer.h"
 #include "common/logging.h"
 #include "geo/geo_types.h"
+#include "gutil/casts.h"
 
 namespace starrocks::vectorized {
 
@@ -325,6 +326,8 @@ Status GeoFunctions::st_contains_prepare(FunctionContext* ctx, FunctionContext::
                 contains_ctx->shapes[i] = GeoShape::from_encoded(str_value.data, str_value.size);
                 if (contains_ctx->shapes[i] == nullptr) {
                     contains_ctx->is_null = true;
+                } else if (i == 0 && contains_ctx->shapes[i]->type() == GEO_SHAPE_POLYGON) {
+                    down_cast<GeoPolygon*>(contains_ctx->shapes[i])->build_covering();
                 }
             }
         }
@@ -346,15 +349,22 @@ ColumnPtr GeoFunctions::st_contains(FunctionContext* context, const Columns& col
 
     auto size = columns[0]->size();
     ColumnBuilder<TYPE_BOOLEAN> result(size);
+    // the points of the rows are decoded into this one, instead of a new shape per row
+    GeoPoint point;
     for (int row = 0; row < size; ++row) {
         if (lhs_viewer.is_null(row) || rhs_viewer.is_null(row)) {
             result.append_null();
             continue;
         }
 
+        auto rhs_value = rhs_viewer.value(row);
+        if (state != nullptr && state->shapes[0] != nullptr && point.decode_from(rhs_value.data, rhs_value.size)) {
+            result.append(state->shapes[0]->contains(&point));
+            continue;
+        }
+
         GeoShape* shapes[2] = {nullptr, nullptr};
         auto lhs_value = lhs_viewer.value(row);
-        auto rhs_value = rhs_viewer.value(row);
         const Slice* strs[2] = {&lhs_value, &rhs_value};
         // use this to delete new
         StContainsState local_state;
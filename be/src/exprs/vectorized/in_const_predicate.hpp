@@ -2,6 +2,8 @@
 
 #pragma once
 
+#include <algorithm>
+
 #include "column/column_builder.h"
 #include "column/column_helper.h"
 #include "column/column_viewer.h"
@@ -70,6 +72,8 @@ public:
                Type == TYPE_BIGINT;
     }
 
+    static constexpr bool can_use_dense_range() { return can_use_array() && Type != TYPE_BOOLEAN; }
+
     Status prepare([[maybe_unused]] RuntimeState* state) {
         if (_is_prepare) {
             return Status::OK();
@@ -84,6 +88,7 @@ public:
         if (auto* that = dynamic_cast<typeof(this)>(predicate)) {
             const auto& hash_set = that->hash_set();
             _hash_set.insert(hash_set.begin(), hash_set.end());
+            _dense_range_buffer.clear();
             _null_in_set = _null_in_set || that->null_in_set();
             return Status::OK();
         } else {
@@ -159,6 +164,11 @@ public:
                 _hash_set.emplace(viewer.value(0));
             }
         }
+        if constexpr (can_use_dense_range()) {
+            if (!use_array) {
+                _init_dense_range_buffer();
+            }
+        }
         return Status::OK();
     }
 
@@ -285,6 +295,7 @@ public:
             _null_in_set = true;
         } else {
             _hash_set.emplace(*value);
+            _dense_range_buffer.clear();
         }
     }
 
@@ -302,6 +313,13 @@ public:
     uint8_t check_value_existence(const ValueType& value) const {
         if constexpr (use_array && can_use_array()) {
             return _get_array_index(value);
+        } else if constexpr (can_use_dense_range()) {
+            if (!_dense_range_buffer.empty()) {
+                // values less than _dense_range_min wrap around to large offsets
+                uint64_t offset = static_cast<uint64_t>(value) - static_cast<uint64_t>(_dense_range_min);
+                return offset < _dense_range_buffer.size() ? _dense_range_buffer[offset] : 0;
+            }
+            return static_cast<uint8_t>(_hash_set.contains(value));
         } else {
             return static_cast<uint8_t>(_hash_set.contains(value));
         }
@@ -334,6 +352,25 @@ private:
     void _set_array_index(int64_t index) { _array_buffer[index] = 1; }
     uint8_t _get_array_index(int64_t index) const { return _array_buffer[index]; }
 
+    // The integer values of a large IN list are looked up in a byte table instead of the hash set if
+    // they are dense enough, e.g. the ids of a range, which avoids hashing and probing each row.
+    void _init_dense_range_buffer() {
+        _dense_range_buffer.clear();
+        if (_hash_set.size() < kDenseRangeMinValues) {
+            return;
+        }
+        auto [min_it, max_it] = std::minmax_element(_hash_set.begin(), _hash_set.end());
+        uint64_t range = static_cast<uint64_t>(*max_it) - static_cast<uint64_t>(*min_it);
+        if (range >= kDenseRangeMaxSize || range >= _hash_set.size() * kDenseRangeMaxSparsity) {
+            return;
+        }
+        _dense_range_min = *min_it;
+        _dense_range_buffer.assign(range + 1, 0);
+        for (const auto& value : _hash_set) {
+            _dense_range_buffer[static_cast<uint64_t>(value) - static_cast<uint64_t>(_dense_range_min)] = 1;
+        }
+    }
+
     void _init_array_buffer() {
         if constexpr (can_use_array()) {
             if (is_use_array()) {
@@ -350,6 +387,13 @@ private:
     int _array_size = 0;
     std::vector<uint8_t> _array_buffer;
 
+    static constexpr size_t kDenseRangeMinValues = 16;
+    static constexpr size_t kDenseRangeMaxSparsity = 8;
+    static constexpr uint64_t kDenseRangeMaxSize = 1 << 20;
+    // _dense_range_buffer[v - _dense_range_min] is 1 if v is in the set, empty if not used
+    int64_t _dense_range_min = 0;
+    std::vector<uint8_t> _dense_range_buffer;
+
     in_const_pred_detail::PHashSetType<Type> _hash_set;
     // Ensure the string memory don't early free
     std::vector<ColumnPtr> _string_values;
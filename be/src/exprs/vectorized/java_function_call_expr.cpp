@@ -54,14 +54,8 @@ struct UDFFunctionCallHelper {
         int num_cols = ctx->get_num_args();
         std::vector<const Column*> input_cols;
 
-        for (int i = 0; i < columns.size(); ++i) {
-            if (columns[i]->only_null()) {
-                // we will handle NULL later
-            } else if (columns[i]->is_constant()) {
-                columns[i] = ColumnHelper::unpack_and_duplicate_const_column(size, columns[i]);
-            }
-        }
-
+        // the constant and null columns are not unpacked, convert_to_boxed_array passes them to the JVM
+        // as an array of one shared object instead of converting the value of every row
         for (auto col : columns) {
             input_cols.emplace_back(col.get());
         }
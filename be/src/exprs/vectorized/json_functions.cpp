@@ -206,6 +206,12 @@ ColumnPtr JsonFunctions::_iterate_rows(FunctionContext* context, const Columns&
     auto path_viewer = ColumnViewer<TYPE_VARCHAR>(columns[1]);
 
     simdjson::ondemand::parser parser;
+    // the paths parsed by json_path_prepare if the path is a constant
+    const auto* prepared_paths = reinterpret_cast<const std::vector<SimpleJsonPath>*>(
+            context->get_function_state(FunctionContext::FRAGMENT_LOCAL));
+    std::vector<SimpleJsonPath> row_paths;
+    // reused by the rows to save an allocation per row
+    std::string json_string;
 
     auto size = columns[0]->size();
     ColumnBuilder<primitive_type> result(size);
@@ -220,19 +226,25 @@ ColumnPtr JsonFunctions::_iterate_rows(FunctionContext* context, const Columns&
             result.append_null();
             continue;
         }
-        std::string json_string(json_value.data, json_value.size);
 
-        auto path_value = path_viewer.value(row);
-        std::string path_string(path_value.data, path_value.size);
-        // Must remove or replace the escape sequence.
-        path_string.erase(std::remove(path_string.begin(), path_string.end(), '\\'), path_string.end());
-        if (path_string.empty()) {
-            result.append_null();
-            continue;
+        const std::vector<SimpleJsonPath>* jsonpath = prepared_paths;
+        if (jsonpath == nullptr) {
+            auto path_value = path_viewer.value(row);
+            std::string path_string(path_value.data, path_value.size);
+            // Must remove or replace the escape sequence.
+            path_string.erase(std::remove(path_string.begin(), path_string.end(), '\\'), path_string.end());
+            if (path_string.empty()) {
+                result.append_null();
+                continue;
+            }
+            row_paths.clear();
+            parse_json_paths(path_string, &row_paths);
+            jsonpath = &row_paths;
         }
 
         // Reserve for simdjson padding.
-        json_string.reserve(json_string.size() + simdjson::SIMDJSON_PADDING);
+        json_string.reserve(json_value.size + simdjson::SIMDJSON_PADDING);
+        json_string.assign(json_value.data, json_value.size);
 
         auto doc = parser.iterate(json_string);
         if (doc.error()) {
@@ -240,9 +252,6 @@ ColumnPtr JsonFunctions::_iterate_rows(FunctionContext* context, const Columns&
             continue;
         }
 
-        std::vector<SimpleJsonPath> jsonpath;
-        parse_json_paths(path_string, &jsonpath);
-
         simdjson::ondemand::json_type tp;
 
         auto err = doc.type().get(tp);
@@ -262,7 +271,7 @@ ColumnPtr JsonFunctions::_iterate_rows(FunctionContext* context, const Columns&
             }
 
             simdjson::ondemand::value value;
-            auto st = extract_from_object(obj, jsonpath, &value);
+            auto st = extract_from_object(obj, *jsonpath, &value);
             if (!st.ok()) {
                 result.append_null();
                 continue;
@@ -302,7 +311,7 @@ ColumnPtr JsonFunctions::_iterate_rows(FunctionContext* context, const Columns&
                 }
 
                 simdjson::ondemand::value value;
-                auto st = extract_from_object(obj, jsonpath, &value);
+                auto st = extract_from_object(obj, *jsonpath, &value);
                 if (!st.ok()) {
                     result.append_null();
                     continue;
@@ -471,6 +480,8 @@ ColumnPtr JsonFunctions::json_query(FunctionContext* context, const Columns& col
     ColumnBuilder<TYPE_JSON> result(num_rows);
 
     JsonPath stored_path;
+    // holds the values collected by an array wildcard, reused by the rows
+    vpack::Builder builder;
     for (int row = 0; row < num_rows; ++row) {
         if (json_viewer.is_null(row) || path_viewer.is_null(row)) {
             result.append_null();
@@ -486,7 +497,7 @@ ColumnPtr JsonFunctions::json_query(FunctionContext* context, const Columns& col
             continue;
         }
 
-        vpack::Builder builder;
+        builder.clear();
         vpack::Slice slice = JsonPath::extract(json_value, *jsonpath.value(), &builder);
         if (slice.isNone()) {
             result.append_null();
@@ -505,6 +516,7 @@ ColumnPtr JsonFunctions::json_exists(FunctionContext* context, const Columns& co
     ColumnBuilder<TYPE_BOOLEAN> result(num_rows);
 
     JsonPath stored_path;
+    vpack::Builder builder;
     for (int row = 0; row < num_rows; row++) {
         if (json_viewer.is_null(row) || json_viewer.value(row) == nullptr || path_viewer.is_null(row)) {
             result.append_null();
@@ -521,7 +533,7 @@ ColumnPtr JsonFunctions::json_exists(FunctionContext* context, const Columns& co
             continue;
         }
         VLOG(2) << "json_exists for  " << path_str << " of " << json_value->to_string().value();
-        vpack::Builder builder;
+        builder.clear();
         vpack::Slice slice = JsonPath::extract(json_value, *jsonpath.value(), &builder);
         result.append(!slice.isNone());
     }
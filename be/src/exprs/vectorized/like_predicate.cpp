@@ -464,10 +464,15 @@ ColumnPtr LikePredicate::regex_match_partial(FunctionContext* context, const sta
 
 template <bool fullMatch>
 std::string LikePredicate::convert_like_pattern(FunctionContext* context, const Slice& pattern) {
+    auto state = reinterpret_cast<LikePredicateState*>(context->get_function_state(FunctionContext::THREAD_LOCAL));
+    return convert_like_pattern<fullMatch>(state->escape_char, pattern);
+}
+
+template <bool fullMatch>
+std::string LikePredicate::convert_like_pattern(char escape_char, const Slice& pattern) {
     std::string re_pattern;
     re_pattern.clear();
 
-    auto state = reinterpret_cast<LikePredicateState*>(context->get_function_state(FunctionContext::THREAD_LOCAL));
     bool is_escaped = false;
 
     if constexpr (fullMatch) {
@@ -480,7 +485,7 @@ std::string LikePredicate::convert_like_pattern(FunctionContext* context, const
         } else if (!is_escaped && pattern.data[i] == '_') {
             re_pattern.append(".");
             // check for escape char before checking for regex special chars, they might overlap
-        } else if (!is_escaped && pattern.data[i] == state->escape_char) {
+        } else if (!is_escaped && pattern.data[i] == escape_char) {
             is_escaped = true;
         } else if (pattern.data[i] == '.' || pattern.data[i] == '[' || pattern.data[i] == ']' ||
                    pattern.data[i] == '{' || pattern.data[i] == '}' || pattern.data[i] == '(' ||
@@ -521,4 +526,90 @@ void LikePredicate::remove_escape_character(std::string* search_string) {
     }
 }
 
+LikePredicate::MultiPatternMatcher::~MultiPatternMatcher() {
+    if (_scratch != nullptr) {
+        hs_free_scratch(_scratch);
+    }
+    if (_database != nullptr) {
+        hs_free_database(_database);
+    }
+}
+
+StatusOr<std::unique_ptr<LikePredicate::MultiPatternMatcher>> LikePredicate::MultiPatternMatcher::create(
+        const std::vector<Slice>& like_patterns, const std::vector<Slice>& regex_patterns) {
+    std::vector<std::string> re_patterns;
+    re_patterns.reserve(like_patterns.size() + regex_patterns.size());
+    for (const auto& pattern : like_patterns) {
+        re_patterns.emplace_back(convert_like_pattern<true>('\\', pattern));
+    }
+    for (const auto& pattern : regex_patterns) {
+        re_patterns.emplace_back(pattern.data, pattern.size);
+    }
+
+    std::vector<const char*> expressions;
+    std::vector<unsigned int> flags;
+    std::vector<unsigned int> ids;
+    for (size_t i = 0; i < re_patterns.size(); ++i) {
+        expressions.emplace_back(re_patterns[i].c_str());
+        flags.emplace_back(HS_FLAG_ALLOWEMPTY | HS_FLAG_DOTALL | HS_FLAG_UTF8 | HS_FLAG_SINGLEMATCH);
+        ids.emplace_back(i);
+    }
+
+    std::unique_ptr<MultiPatternMatcher> matcher(new MultiPatternMatcher());
+    hs_compile_error_t* compile_err = nullptr;
+    if (hs_compile_multi(expressions.data(), flags.data(), ids.data(), expressions.size(), HS_MODE_BLOCK, nullptr,
+                         &matcher->_database, &compile_err) != HS_SUCCESS) {
+        std::string error = strings::Substitute("Invalid regex expression: $0", compile_err->message);
+        hs_free_compile_error(compile_err);
+        return Status::InvalidArgument(error);
+    }
+    if (hs_alloc_scratch(matcher->_database, &matcher->_scratch) != HS_SUCCESS) {
+        return Status::InvalidArgument("ERROR: Unable to allocate scratch space.");
+    }
+    return std::move(matcher);
+}
+
+ColumnPtr LikePredicate::MultiPatternMatcher::evaluate(const ColumnPtr& value_column) const {
+    if (value_column->only_null()) {
+        return ColumnHelper::create_const_null_column(value_column->size());
+    }
+
+    hs_scratch_t* scratch = nullptr;
+    hs_error_t status;
+    if ((status = hs_clone_scratch(_scratch, &scratch)) != HS_SUCCESS) {
+        CHECK(false) << "ERROR: Unable to clone scratch space."
+                     << " status: " << status;
+    }
+
+    ColumnViewer<TYPE_VARCHAR> value_viewer(value_column);
+    ColumnBuilder<TYPE_BOOLEAN> result(value_viewer.size());
+    for (int row = 0; row < value_viewer.size(); ++row) {
+        if (value_viewer.is_null(row)) {
+            result.append_null();
+            continue;
+        }
+
+        bool v = false;
+        auto value = value_viewer.value(row);
+        auto status = hs_scan(
+                // Use &_DUMMY_STRING_FOR_EMPTY_PATTERN instead of nullptr to avoid crash.
+                _database, (value.size) ? value.data : &_DUMMY_STRING_FOR_EMPTY_PATTERN, value.size, 0, scratch,
+                [](unsigned int id, unsigned long long from, unsigned long long to, unsigned int flags,
+                   void* ctx) -> int {
+                    *((bool*)ctx) = true;
+                    return 1;
+                },
+                &v);
+
+        DCHECK(status == HS_SUCCESS || status == HS_SCAN_TERMINATED) << " status: " << status;
+        result.append(v);
+    }
+
+    if ((status = hs_free_scratch(scratch)) != HS_SUCCESS) {
+        CHECK(false) << "ERROR: free scratch space failure"
+                     << " status: " << status;
+    }
+    return result.build(value_column->is_constant());
+}
+
 } // namespace starrocks::vectorized
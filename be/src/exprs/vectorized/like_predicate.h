@@ -7,6 +7,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "column/column_builder.h"
 #include "column/column_helper.h"
@@ -51,6 +52,27 @@ public:
      */
     DEFINE_VECTORIZED_FN(regex);
 
+    // Matches the values against several constant LIKE and REGEXP patterns with one Hyperscan database
+    // that holds all of them, so an OR of such predicates on the same column scans each value once.
+    class MultiPatternMatcher {
+    public:
+        ~MultiPatternMatcher();
+
+        // Returns an error if a pattern can not be compiled by Hyperscan.
+        static StatusOr<std::unique_ptr<MultiPatternMatcher>> create(const std::vector<Slice>& like_patterns,
+                                                                     const std::vector<Slice>& regex_patterns);
+
+        // The result of a row is null if the value is null, otherwise whether the value matches any pattern.
+        ColumnPtr evaluate(const ColumnPtr& value_column) const;
+
+    private:
+        MultiPatternMatcher() = default;
+
+        hs_database_t* _database = nullptr;
+        // cloned by every evaluation, as evaluate may run concurrently
+        hs_scratch_t* _scratch = nullptr;
+    };
+
 private:
     /**
      * use for:
@@ -139,6 +161,9 @@ private:
     template <bool fullMatch>
     static std::string convert_like_pattern(starrocks_udf::FunctionContext* context, const Slice& pattern);
 
+    template <bool fullMatch>
+    static std::string convert_like_pattern(char escape_char, const Slice& pattern);
+
     static void remove_escape_character(std::string* search_string);
 
 private:
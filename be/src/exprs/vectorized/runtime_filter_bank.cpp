@@ -2,9 +2,13 @@
 
 #include "exprs/vectorized/runtime_filter_bank.h"
 
+#include <algorithm>
+#include <sstream>
 #include <thread>
 
 #include "column/column.h"
+#include "common/config.h"
+#include "exec/pipeline/poller_notifier.h"
 #include "exec/pipeline/runtime_filter_types.h"
 #include "exprs/vectorized/in_const_predicate.hpp"
 #include "exprs/vectorized/literal.h"
@@ -13,6 +17,7 @@
 #include "runtime/primitive_type.h"
 #include "runtime/primitive_type_infra.h"
 #include "simd/simd.h"
+#include "util/stopwatch.hpp"
 #include "util/time.h"
 
 namespace starrocks::vectorized {
@@ -295,17 +300,28 @@ void RuntimeFilterProbeCollector::close(RuntimeState* state) {
 // do_evaluate is reentrant, can be called concurrently by multiple operators that shared the same
 // RuntimeFilterProbeCollector.
 void RuntimeFilterProbeCollector::do_evaluate(vectorized::Chunk* chunk, RuntimeBloomFilterEvalContext& eval_context) {
-    if ((eval_context.input_chunk_nums++ & 31) == 0) {
+    // Every runtime filter is evaluated on the first chunks of each period to measure its selectivity and cost,
+    // and only the chosen filters are evaluated on the rest chunks of the period.
+    static constexpr size_t SAMPLE_PERIOD_CHUNKS = 32;
+    const size_t sample_chunks =
+            std::clamp<size_t>(config::runtime_filter_sample_chunk_num, 1, SAMPLE_PERIOD_CHUNKS);
+    const size_t chunk_index = (eval_context.input_chunk_nums++) % SAMPLE_PERIOD_CHUNKS;
+    if (chunk_index < sample_chunks) {
+        if (chunk_index == 0) {
+            eval_context.sample_stats.clear();
+        }
         update_selectivity(chunk, eval_context);
+        if (chunk_index == sample_chunks - 1) {
+            select_filters(eval_context);
+        }
         return;
     }
-    if (!eval_context.selectivity.empty()) {
+    if (!eval_context.selected_filters.empty()) {
         const auto num_rows = chunk->num_rows();
         auto& selection = eval_context.running_context.selection;
         size_t true_count = 0;
         selection.assign(num_rows, 1);
-        for (auto& kv : eval_context.selectivity) {
-            RuntimeFilterProbeDescriptor* rf_desc = kv.second;
+        for (RuntimeFilterProbeDescriptor* rf_desc : eval_context.selected_filters) {
             const JoinRuntimeFilter* filter = rf_desc->runtime_filter();
             if (filter == nullptr) {
                 continue;
@@ -337,6 +353,7 @@ void RuntimeFilterProbeCollector::init_counter() {
             ADD_COUNTER(_runtime_profile, "JoinRuntimeFilterOutputRows", TUnit::UNIT);
     _eval_context.join_runtime_filter_eval_counter =
             ADD_COUNTER(_runtime_profile, "JoinRuntimeFilterEvaluate", TUnit::UNIT);
+    _eval_context.runtime_profile = _runtime_profile;
 }
 
 void RuntimeFilterProbeCollector::evaluate(vectorized::Chunk* chunk) {
@@ -365,7 +382,6 @@ void RuntimeFilterProbeCollector::evaluate(vectorized::Chunk* chunk, RuntimeBloo
 
 void RuntimeFilterProbeCollector::update_selectivity(vectorized::Chunk* chunk,
                                                      RuntimeBloomFilterEvalContext& eval_context) {
-    eval_context.selectivity.clear();
     size_t chunk_size = chunk->num_rows();
     auto& selection = eval_context.running_context.selection;
     selection.assign(chunk_size, 1);
@@ -375,6 +391,8 @@ void RuntimeFilterProbeCollector::update_selectivity(vectorized::Chunk* chunk,
         if (filter == nullptr) {
             continue;
         }
+        MonotonicStopWatch watch;
+        watch.start();
         auto ctx = rf_desc->probe_expr_ctx();
         ColumnPtr column = EVALUATE_NULL_IF_ERROR(ctx, ctx->root(), chunk);
         // for colocate grf
@@ -382,33 +400,71 @@ void RuntimeFilterProbeCollector::update_selectivity(vectorized::Chunk* chunk,
         // true count is not accummulated, it is evaluated for each RF respectively
         auto true_count = filter->evaluate(column.get(), &eval_context.running_context);
         eval_context.run_filter_nums += 1;
-        double selectivity = true_count * 1.0 / chunk_size;
-        if (selectivity <= 0.5) {     // useful filter
-            if (selectivity < 0.05) { // very useful filter, could early return
-                eval_context.selectivity.clear();
-                eval_context.selectivity.emplace(selectivity, rf_desc);
-                chunk->filter(selection);
-                return;
-            }
 
-            // Only choose three most selective runtime filters
-            if (eval_context.selectivity.size() < 3) {
-                eval_context.selectivity.emplace(selectivity, rf_desc);
-            } else {
-                auto it = eval_context.selectivity.end();
-                it--;
-                if (selectivity < it->first) {
-                    eval_context.selectivity.erase(it);
-                    eval_context.selectivity.emplace(selectivity, rf_desc);
-                }
-            }
-        }
+        auto& stat = eval_context.sample_stats[rf_desc->filter_id()];
+        stat.desc = rf_desc;
+        stat.input_rows += chunk_size;
+        stat.output_rows += true_count;
+        stat.eval_time_ns += watch.elapsed_time();
     }
-    if (!eval_context.selectivity.empty()) {
+    // All the filters are evaluated on the sampled chunk, so it can be filtered by all of them.
+    if (SIMD::count_nonzero(selection) != chunk_size) {
         chunk->filter(selection);
     }
 }
 
+void RuntimeFilterProbeCollector::select_filters(RuntimeBloomFilterEvalContext& eval_context) {
+    // A filter passing more than half of the rows doesn't pay off.
+    static constexpr double MAX_SELECTIVITY = 0.5;
+    // The rest filters are not evaluated once the chosen filters pass less than this ratio of the rows together.
+    static constexpr double MIN_COMBINED_SELECTIVITY = 0.05;
+    // At most this number of filters are evaluated.
+    static constexpr size_t MAX_SELECTED_FILTERS = 3;
+
+    struct Candidate {
+        RuntimeFilterProbeDescriptor* desc;
+        double selectivity;
+        // The expected cost to remove a row, by which the filters are ordered.
+        double rank;
+    };
+    std::vector<Candidate> candidates;
+    std::stringstream reason;
+    for (const auto& [filter_id, stat] : eval_context.sample_stats) {
+        if (stat.input_rows == 0) {
+            continue;
+        }
+        const double selectivity = stat.output_rows * 1.0 / stat.input_rows;
+        const double cost_per_row_ns = stat.eval_time_ns * 1.0 / stat.input_rows;
+        reason << "rf" << filter_id << "(selectivity=" << selectivity << ",cost=" << cost_per_row_ns << "ns/row";
+        if (selectivity > MAX_SELECTIVITY) {
+            reason << ",skipped:low selectivity) ";
+            continue;
+        }
+        reason << ") ";
+        candidates.push_back({stat.desc, selectivity, cost_per_row_ns / (1 - selectivity)});
+    }
+    std::sort(candidates.begin(), candidates.end(),
+              [](const Candidate& lhs, const Candidate& rhs) { return lhs.rank < rhs.rank; });
+
+    eval_context.selected_filters.clear();
+    double combined_selectivity = 1;
+    reason << "selected:";
+    for (const auto& candidate : candidates) {
+        if (eval_context.selected_filters.size() >= MAX_SELECTED_FILTERS ||
+            combined_selectivity < MIN_COMBINED_SELECTIVITY) {
+            break;
+        }
+        eval_context.selected_filters.push_back(candidate.desc);
+        // Assume the filters are independent.
+        combined_selectivity *= candidate.selectivity;
+        reason << " rf" << candidate.desc->filter_id();
+    }
+
+    if (eval_context.runtime_profile != nullptr) {
+        eval_context.runtime_profile->add_info_string("JoinRuntimeFilterSelection", reason.str());
+    }
+}
+
 void RuntimeFilterProbeCollector::push_down(RuntimeFilterProbeCollector* parent, const std::vector<TupleId>& tuple_ids,
                                             std::set<TPlanNodeId>& local_rf_waiting_set) {
     if (this == parent) return;
@@ -488,6 +544,10 @@ void RuntimeFilterProbeDescriptor::set_runtime_filter(const JoinRuntimeFilter* r
         _ready_timestamp = UnixMillis();
         _latency_timer->set((_ready_timestamp - _open_timestamp) * 1000);
     }
+    if (rf != nullptr) {
+        // Wake up the poller, since the drivers waiting for this global runtime filter may become ready.
+        pipeline::PollerNotifier::instance()->notify();
+    }
 }
 void RuntimeFilterProbeDescriptor::set_shared_runtime_filter(const std::shared_ptr<const JoinRuntimeFilter>& rf) {
     std::shared_ptr<const JoinRuntimeFilter> old_value = nullptr;
@@ -141,10 +141,23 @@ private:
 struct RuntimeBloomFilterEvalContext {
     RuntimeBloomFilterEvalContext() = default;
 
-    std::map<double, RuntimeFilterProbeDescriptor*> selectivity;
+    // The rows and the evaluation time of a runtime filter during sampling.
+    struct SampleStat {
+        RuntimeFilterProbeDescriptor* desc = nullptr;
+        size_t input_rows = 0;
+        size_t output_rows = 0;
+        int64_t eval_time_ns = 0;
+    };
+
+    // The runtime filters chosen by the last sampling, in the order to evaluate them.
+    std::vector<RuntimeFilterProbeDescriptor*> selected_filters;
+    // mapping from filter id to the stat of the ongoing sampling.
+    std::map<int32_t, SampleStat> sample_stats;
     size_t input_chunk_nums = 0;
     int run_filter_nums = 0;
     JoinRuntimeFilter::RunningContext running_context;
+    // The choice of the last sampling is reported to this profile if it is set.
+    RuntimeProfile* runtime_profile = nullptr;
     RuntimeProfile::Counter* join_runtime_filter_timer = nullptr;
     RuntimeProfile::Counter* join_runtime_filter_input_counter = nullptr;
     RuntimeProfile::Counter* join_runtime_filter_output_counter = nullptr;
@@ -186,6 +199,8 @@ public:
 private:
     void update_selectivity(vectorized::Chunk* chunk);
     void update_selectivity(vectorized::Chunk* chunk, RuntimeBloomFilterEvalContext& eval_context);
+    // Choose the runtime filters to evaluate by the stats of the finished sampling.
+    void select_filters(RuntimeBloomFilterEvalContext& eval_context);
     // TODO: return a funcion call status
     void do_evaluate(vectorized::Chunk* chunk);
     void do_evaluate(vectorized::Chunk* chunk, RuntimeBloomFilterEvalContext& eval_context);
@@ -1554,12 +1554,35 @@ ColumnPtr StringFunctions::length(FunctionContext* context, const Columns& colum
     return VectorizedStrictUnaryFunction<lengthImpl>::evaluate<TYPE_VARCHAR, TYPE_INT>(columns[0]);
 }
 
-DEFINE_UNARY_FN_WITH_IMPL(utf8LengthImpl, str) {
-    return utf8_len(str.data, str.data + str.size);
-}
+struct StringUtf8LengthFunction {
+public:
+    template <PrimitiveType Type, PrimitiveType ResultType>
+    static ColumnPtr evaluate(const ColumnPtr& v1) {
+        auto* src = down_cast<BinaryColumn*>(v1.get());
+        const Bytes& src_bytes = src->get_bytes();
+        const Offsets& src_offsets = src->get_offset();
+        const size_t size = src->size();
+        auto dst = RunTimeColumnType<TYPE_INT>::create();
+        dst->resize_uninitialized(size);
+        auto* lengths = dst->get_data().data();
+
+        if (validate_ascii_fast((const char*)src_bytes.data(), src_bytes.size())) {
+            // the length of an ascii string is its byte size, no need to decode the bytes
+            for (size_t i = 0; i < size; ++i) {
+                lengths[i] = src_offsets[i + 1] - src_offsets[i];
+            }
+        } else {
+            const char* data = (const char*)src_bytes.data();
+            for (size_t i = 0; i < size; ++i) {
+                lengths[i] = utf8_len(data + src_offsets[i], data + src_offsets[i + 1]);
+            }
+        }
+        return dst;
+    }
+};
 
 ColumnPtr StringFunctions::utf8_length(FunctionContext* context, const starrocks::vectorized::Columns& columns) {
-    return VectorizedStrictUnaryFunction<utf8LengthImpl>::evaluate<TYPE_VARCHAR, TYPE_INT>(columns[0]);
+    return VectorizedUnaryFunction<StringUtf8LengthFunction>::evaluate<TYPE_VARCHAR, TYPE_INT>(columns[0]);
 }
 
 template <char CA, char CZ>
@@ -1583,7 +1606,7 @@ static inline void vectorized_toggle_case(const Bytes* src, Bytes* dst) {
     const auto z_plus1 = _mm_set1_epi8(CZ + 1);
     const auto flips = _mm_set1_epi8(32);
 
-    for (; src_ptr > sse2_end; src_ptr += SSE2_BYTES, dst_ptr += SSE2_BYTES) {
+    for (; src_ptr < sse2_end; src_ptr += SSE2_BYTES, dst_ptr += SSE2_BYTES) {
         auto bytes = _mm_loadu_si128((const __m128i*)src_ptr);
         // the i-th byte of masks is set to 0xff if the corresponding byte is
         // between a..z when computing upper function (A..Z when computing lower function),
@@ -2,6 +2,7 @@
 
 #include "exprs/vectorized/time_functions.h"
 
+#include <limits>
 #include <string_view>
 
 #include "column/column_helper.h"
@@ -136,6 +137,8 @@ Status TimeFunctions::convert_tz_prepare(starrocks_udf::FunctionContext* context
         return Status::OK();
     }
 
+    ctc->use_offset = TimezoneUtils::timezone_offsets(std::string_view(from_value), std::string_view(to_value),
+                                                      &ctc->offset);
     ctc->is_valid = true;
     return Status::OK();
 }
@@ -208,40 +211,49 @@ ColumnPtr TimeFunctions::convert_tz_general(FunctionContext* context, const Colu
     return result.build(ColumnHelper::is_all_const(columns));
 }
 
+// Returns the seconds to add to local_second, the seconds since 1970-01-01 00:00:00 of a datetime in
+// from, to get the datetime in to.
+static int64_t convert_tz_delta(int64_t local_second, const cctz::time_zone& from, const cctz::time_zone& to) {
+    static const cctz::civil_second epoch(1970, 1, 1, 0, 0, 0);
+    const auto tp = cctz::convert(epoch + local_second, from);
+    return (cctz::convert(tp, to) - epoch) - local_second;
+}
+
 ColumnPtr TimeFunctions::convert_tz_const(FunctionContext* context, const Columns& columns, const cctz::time_zone& from,
                                           const cctz::time_zone& to) {
     auto time_viewer = ColumnViewer<TYPE_DATETIME>(columns[0]);
 
     auto size = columns[0]->size();
     ColumnBuilder<TYPE_DATETIME> result(size);
+    ConvertTzCtx* ctc = reinterpret_cast<ConvertTzCtx*>(context->get_function_state(FunctionContext::FRAGMENT_LOCAL));
+
+    // The delta of the last local hour, reused by the rows in the same hour. It is reused only if the
+    // delta is the same at the first and the last second of the hour, i.e. no transition happens in it.
+    int64_t cached_hour = std::numeric_limits<int64_t>::min();
+    int64_t cached_delta = 0;
+    bool cached_delta_valid = false;
     for (int row = 0; row < size; ++row) {
         if (time_viewer.is_null(row)) {
             result.append_null();
             continue;
         }
 
-        auto datetime_value = time_viewer.value(row);
-
-        int year, month, day, hour, minute, second, usec;
-        datetime_value.to_timestamp(&year, &month, &day, &hour, &minute, &second, &usec);
-        DateTimeValue ts_value(TIME_DATETIME, year, month, day, hour, minute, second, usec);
-
-        int64_t timestamp;
-        // TODO find a better approach to replace datetime_value.unix_timestamp
-        if (!ts_value.unix_timestamp(&timestamp, from)) {
-            result.append_null();
-            continue;
-        }
-        DateTimeValue ts_value2;
-        // TODO find a better approach to replace datetime_value.from_unixtime
-        if (!ts_value2.from_unixtime(timestamp, to)) {
-            result.append_null();
-            continue;
+        // the microseconds are dropped by the conversion
+        int64_t local_second = time_viewer.value(row).to_unix_second();
+        int64_t delta = ctc->offset;
+        if (!ctc->use_offset) {
+            int64_t hour = local_second / SECS_PER_HOUR - (local_second % SECS_PER_HOUR < 0);
+            if (hour != cached_hour) {
+                cached_hour = hour;
+                cached_delta = convert_tz_delta(hour * SECS_PER_HOUR, from, to);
+                cached_delta_valid =
+                        cached_delta == convert_tz_delta(hour * SECS_PER_HOUR + SECS_PER_HOUR - 1, from, to);
+            }
+            delta = cached_delta_valid ? cached_delta : convert_tz_delta(local_second, from, to);
         }
 
         TimestampValue ts;
-        ts.from_timestamp(ts_value2.year(), ts_value2.month(), ts_value2.day(), ts_value2.hour(), ts_value2.minute(),
-                          ts_value2.second(), 0);
+        ts.from_unix_second(local_second + delta);
         result.append(ts);
     }
 
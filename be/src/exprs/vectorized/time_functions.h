@@ -617,6 +617,9 @@ private:
         bool is_valid = false;
         cctz::time_zone from_tz;
         cctz::time_zone to_tz;
+        // true if the time zones have a fixed offset between them, and the conversion only adds offset
+        bool use_offset = false;
+        int64_t offset = 0;
     };
 
     struct FormatCtx {
@@ -2,6 +2,12 @@
 
 #include "formats/csv/csv_reader.h"
 
+#ifdef __AVX2__
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 namespace starrocks::vectorized {
 
 Status CSVReader::next_record(Record* record) {
@@ -10,7 +16,9 @@ Status CSVReader::next_record(Record* record) {
     }
     char* d;
     size_t pos = 0;
-    while ((d = _buff.find(_row_delimiter, pos)) == nullptr) {
+    // memchr scans for a single byte by SIMD.
+    while ((d = (_row_delimiter_length == 1 ? _buff.find(_row_delimiter[0], pos) : _buff.find(_row_delimiter, pos))) ==
+           nullptr) {
         pos = _buff.available();
         _buff.compact();
         if (_buff.free_space() == 0) {
@@ -47,8 +55,34 @@ void CSVReader::split_record(const Record& record, Fields* fields) const {
     const size_t size = record.size;
 
     if (_column_separator_length == 1) {
-        for (size_t i = 0; i < size; ++i, ++ptr) {
-            if (*ptr == _column_separator[0]) {
+        const char separator = _column_separator[0];
+        const char* const end = record.data + size;
+        // Find the separators of each block by a bitmask of the bytes equal to the separator.
+#if defined(__AVX2__)
+        const __m256i pattern = _mm256_set1_epi8(separator);
+        for (; ptr + sizeof(__m256i) <= end; ptr += sizeof(__m256i)) {
+            __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));
+            auto mask = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, pattern)));
+            for (; mask != 0; mask &= mask - 1) {
+                const char* separator_ptr = ptr + __builtin_ctz(mask);
+                fields->emplace_back(value, separator_ptr - value);
+                value = separator_ptr + 1;
+            }
+        }
+#elif defined(__SSE2__)
+        const __m128i pattern = _mm_set1_epi8(separator);
+        for (; ptr + sizeof(__m128i) <= end; ptr += sizeof(__m128i)) {
+            __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));
+            auto mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, pattern)));
+            for (; mask != 0; mask &= mask - 1) {
+                const char* separator_ptr = ptr + __builtin_ctz(mask);
+                fields->emplace_back(value, separator_ptr - value);
+                value = separator_ptr + 1;
+            }
+        }
+#endif
+        for (; ptr < end; ++ptr) {
+            if (*ptr == separator) {
                 fields->emplace_back(value, ptr - value);
                 value = ptr + 1;
             }
@@ -0,0 +1,72 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "formats/footer_cache.h"
+
+#include "runtime/current_thread.h"
+#include "runtime/mem_tracker.h"
+#include "util/defer_op.h"
+
+namespace starrocks {
+
+FooterCache* FooterCache::_s_instance = nullptr;
+
+void FooterCache::create_global_cache(MemTracker* mem_tracker, size_t capacity) {
+    if (_s_instance == nullptr) {
+        _s_instance = new FooterCache(mem_tracker, capacity);
+    }
+}
+
+void FooterCache::release_global_cache() {
+    if (_s_instance != nullptr) {
+        delete _s_instance;
+        _s_instance = nullptr;
+    }
+}
+
+std::string FooterCache::encode_key(std::string_view format, const std::string& fname, int64_t file_size,
+                                    int64_t modification_time) {
+    std::string key(format);
+    key.push_back(':');
+    key.append(fname);
+    key.append(reinterpret_cast<const char*>(&file_size), sizeof(file_size));
+    key.append(reinterpret_cast<const char*>(&modification_time), sizeof(modification_time));
+    return key;
+}
+
+FooterCache::FooterCache(MemTracker* mem_tracker, size_t capacity)
+        : _mem_tracker(mem_tracker), _cache(new_lru_cache(capacity)) {}
+
+FooterCache::~FooterCache() = default;
+
+std::shared_ptr<const void> FooterCache::_lookup(const std::string& key) {
+    auto* handle = _cache->lookup(CacheKey(key));
+    if (handle == nullptr) {
+        return nullptr;
+    }
+    auto footer = *reinterpret_cast<std::shared_ptr<const void>*>(_cache->value(handle));
+#ifndef BE_TEST
+    MemTracker* prev_tracker = tls_thread_status.set_mem_tracker(_mem_tracker);
+    DeferOp op([&] { tls_thread_status.set_mem_tracker(prev_tracker); });
+#endif
+    _cache->release(handle);
+    return footer;
+}
+
+void FooterCache::_insert(const std::string& key, std::shared_ptr<const void> footer, size_t charge) {
+#ifndef BE_TEST
+    // The footer is owned by the cache from now on.
+    tls_thread_status.mem_release(charge);
+    MemTracker* prev_tracker = tls_thread_status.set_mem_tracker(_mem_tracker);
+    tls_thread_status.mem_consume(charge);
+    DeferOp op([&] { tls_thread_status.set_mem_tracker(prev_tracker); });
+#endif
+
+    auto deleter = [](const starrocks::CacheKey& key, void* value) {
+        delete reinterpret_cast<std::shared_ptr<const void>*>(value);
+    };
+    auto* value = new std::shared_ptr<const void>(std::move(footer));
+    auto* handle = _cache->insert(CacheKey(key), value, charge, deleter);
+    _cache->release(handle);
+}
+
+} // namespace starrocks
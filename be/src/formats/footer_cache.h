@@ -0,0 +1,64 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "util/lru_cache.h"
+
+namespace starrocks {
+
+class MemTracker;
+
+// Cache of the parsed footers of the files of the external tables, e.g. the FileMetaData of the parquet files and the
+// file tails of the orc files, so that the scans of the files don't read and deserialize the footers again. It's
+// shared by the queries on the BE, whose scans of the many small files are dominated by reading the footers,
+// especially on the object storages.
+// An entry is identified by the format, the path, the size and the modification time of the file, so a rewritten
+// file never hits the footer of its previous version.
+// Like DecodedColumnCache, it's not created unless `footer_cache_limit` is set.
+class FooterCache {
+public:
+    // Create global instance of this class
+    static void create_global_cache(MemTracker* mem_tracker, size_t capacity);
+
+    static void release_global_cache();
+
+    // Return global instance, or nullptr if the cache is disabled.
+    static FooterCache* instance() { return _s_instance; }
+
+    // The key of the footer of |format| of the file |fname| of |file_size| bytes modified at |modification_time|.
+    static std::string encode_key(std::string_view format, const std::string& fname, int64_t file_size,
+                                  int64_t modification_time);
+
+    FooterCache(MemTracker* mem_tracker, size_t capacity);
+    ~FooterCache();
+
+    // Return the cached footer of |key|, or nullptr if it's not found.
+    // The returned footer is shared and must not be modified.
+    template <typename T>
+    std::shared_ptr<const T> lookup(const std::string& key) {
+        return std::static_pointer_cast<const T>(_lookup(key));
+    }
+
+    // Insert |footer| of |charge| bytes with |key|, which must not be modified anymore.
+    template <typename T>
+    void insert(const std::string& key, std::shared_ptr<const T> footer, size_t charge) {
+        _insert(key, std::move(footer), charge);
+    }
+
+    size_t memory_usage() const { return _cache->get_memory_usage(); }
+
+private:
+    std::shared_ptr<const void> _lookup(const std::string& key);
+    void _insert(const std::string& key, std::shared_ptr<const void> footer, size_t charge);
+
+    static FooterCache* _s_instance;
+
+    MemTracker* _mem_tracker = nullptr;
+    std::unique_ptr<Cache> _cache;
+};
+
+} // namespace starrocks
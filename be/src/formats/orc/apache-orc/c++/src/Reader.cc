@@ -390,9 +390,11 @@ void RowReaderImpl::loadStripeIndex() {
     for (int i = 0; i < currentStripeFooter.streams_size(); ++i) {
         const proto::Stream& pbStream = currentStripeFooter.streams(i);
         uint64_t colId = pbStream.column();
+        // only the bloom filters of the columns in the search argument are used to pick the row groups.
+        bool needsBloomFilter = !skipBloomFilters && sargsApplier && sargsApplier->needsBloomFilter(colId);
         if (selectedColumns[colId] && pbStream.has_kind() &&
             (pbStream.kind() == proto::Stream_Kind_ROW_INDEX ||
-             pbStream.kind() == proto::Stream_Kind_BLOOM_FILTER_UTF8)) {
+             (pbStream.kind() == proto::Stream_Kind_BLOOM_FILTER_UTF8 && needsBloomFilter))) {
             std::unique_ptr<SeekableInputStream> inStream =
                     createDecompressor(getCompression(),
                                        std::unique_ptr<SeekableInputStream>(new SeekableFileInputStream(
@@ -405,7 +407,7 @@ void RowReaderImpl::loadStripeIndex() {
                     throw ParseError("Failed to parse the row index");
                 }
                 rowIndexes[colId] = rowIndex;
-            } else if (!skipBloomFilters) { // Stream_Kind_BLOOM_FILTER_UTF8
+            } else { // Stream_Kind_BLOOM_FILTER_UTF8
                 proto::BloomFilterIndex pbBFIndex;
                 if (!pbBFIndex.ParseFromZeroCopyStream(inStream.get())) {
                     throw ParseError("Failed to parse bloom filter index");
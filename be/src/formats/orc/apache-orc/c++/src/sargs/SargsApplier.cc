@@ -22,7 +22,7 @@
 
 #include "SargsApplier.hh"
 
-#include <numeric>
+#include <algorithm>
 
 namespace orc {
 
@@ -61,18 +61,23 @@ SargsApplier::SargsApplier(const Type& type, const SearchArgument* searchArgumen
     mFilterColumns.resize(leaves.size(), INVALID_COLUMN_ID);
     for (size_t i = 0; i != mFilterColumns.size(); ++i) {
         mFilterColumns[i] = findColumn(type, leaves[i].getColumnName());
+        if (mFilterColumns[i] != INVALID_COLUMN_ID) {
+            mBloomFilterColumns.insert(mFilterColumns[i]);
+        }
     }
 }
 
 bool SargsApplier::pickRowGroups(uint64_t rowsInStripe, const std::unordered_map<uint64_t, proto::RowIndex>& rowIndexes,
                                  const std::map<uint32_t, BloomFilterIndex>& bloomFilters) {
-    // init state of each row group
+    // init state of each row group, the row groups skipped in the previous stripe must not be left skipped.
     uint64_t groupsInStripe = (rowsInStripe + mRowIndexStride - 1) / mRowIndexStride;
-    mRowGroups.resize(groupsInStripe, true);
+    mRowGroups.assign(groupsInStripe, true);
     mTotalRowsInStripe = rowsInStripe;
 
     // row indexes do not exist, simply read all rows
     if (rowIndexes.empty()) {
+        mHasSelected = true;
+        mHasSkipped = false;
         return true;
     }
 
@@ -124,8 +129,7 @@ bool SargsApplier::pickRowGroups(uint64_t rowsInStripe, const std::unordered_map
     }
 
     // update stats
-    mStats.first = std::accumulate(mRowGroups.cbegin(), mRowGroups.cend(), mStats.first,
-                                   [](bool rg, uint64_t s) { return rg ? 1 : 0 + s; });
+    mStats.first += static_cast<uint64_t>(std::count(mRowGroups.cbegin(), mRowGroups.cend(), true));
     mStats.second += groupsInStripe;
 
     return mHasSelected;
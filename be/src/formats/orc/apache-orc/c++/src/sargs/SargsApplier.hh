@@ -24,6 +24,7 @@
 
 #include <orc/Common.hh>
 #include <unordered_map>
+#include <unordered_set>
 
 #include "orc/BloomFilter.hh"
 #include "orc/Type.hh"
@@ -80,6 +81,12 @@ public:
 
     RowReaderFilter* getRowReaderFilter() const { return mRowReaderFilter; }
 
+    /**
+     * Whether the bloom filters of the column are used to pick the row groups, i.e. the column is
+     * referenced by a predicate leaf. The bloom filters of the other columns need not be loaded.
+     */
+    bool needsBloomFilter(uint64_t columnId) const { return mBloomFilterColumns.count(columnId) > 0; }
+
 private:
     friend class TestSargsApplier_findColumnTest_Test;
     static uint64_t findColumn(const Type& type, const std::string& colName);
@@ -92,6 +99,8 @@ private:
     WriterVersion mWriterVersion;
     // column ids for each predicate leaf in the search argument
     std::vector<uint64_t> mFilterColumns;
+    // column ids referenced by the predicate leaves
+    std::unordered_set<uint64_t> mBloomFilterColumns;
 
     // store results of last call of pickRowGroups
     std::vector<bool> mRowGroups;
@@ -76,6 +76,18 @@ TEST(TestSargsApplier, testPickRowGroups) {
     EXPECT_EQ(false, rowgroups[1]);
     EXPECT_EQ(false, rowgroups[2]);
     EXPECT_EQ(true, rowgroups[3]);
+    EXPECT_TRUE(applier.needsBloomFilter(1));
+    EXPECT_TRUE(applier.needsBloomFilter(2));
+    EXPECT_FALSE(applier.needsBloomFilter(0));
+
+    // the next stripe has no row index, the row groups skipped in the previous stripe are read.
+    EXPECT_TRUE(applier.pickRowGroups(4000, {}, {}));
+    rowgroups = applier.getRowGroups();
+    EXPECT_EQ(4, rowgroups.size());
+    for (bool rowgroup : rowgroups) {
+        EXPECT_TRUE(rowgroup);
+    }
+    EXPECT_TRUE(applier.hasSelectedFrom(0));
 }
 
 } // namespace orc
@@ -18,6 +18,7 @@
 #include "gen_cpp/Exprs_types.h"
 #include "gen_cpp/orc_proto.pb.h"
 #include "gutil/casts.h"
+#include "gutil/strings/fastmem.h"
 #include "gutil/strings/substitute.h"
 #include "runtime/primitive_type.h"
 #include "simd/simd.h"
@@ -547,6 +548,63 @@ static void fill_decimal128_column_with_null(orc::ColumnVectorBatch* cvb, Column
     fill_decimal_column_from_orc_decimal64_or_decimal128<TYPE_DECIMAL128, true>(cvb, col, from, size, type_desc, ctx);
 }
 
+// Append the strings [from, from + size) of |data| to |values|, and the nulls as empty strings.
+// The strings of a direct encoded stream are contiguous in the blob of the batch, so they are copied by one memcpy
+// and only the offsets are computed per row. The strings of a dictionary encoded stream point into the dictionary,
+// and are copied one by one.
+static void append_orc_strings(const orc::StringVectorBatch* data, int from, int size, BinaryColumn* values) {
+    const char* const* starts = data->data.data() + from;
+    const int64_t* lengths = data->length.data() + from;
+    // the lengths of the nulls are undefined.
+    const char* not_nulls = data->hasNulls ? data->notNull.data() + from : nullptr;
+
+    size_t total_len = 0;
+    const char* first = nullptr;
+    const char* expected = nullptr;
+    bool contiguous = true;
+    for (int i = 0; i < size; ++i) {
+        if (not_nulls != nullptr && !not_nulls[i]) {
+            continue;
+        }
+        if (first == nullptr) {
+            first = starts[i];
+        } else {
+            contiguous &= (starts[i] == expected);
+        }
+        expected = starts[i] + lengths[i];
+        total_len += lengths[i];
+    }
+
+    auto& vb = values->get_bytes();
+    auto& vo = values->get_offset();
+    size_t bytes_start = vb.size();
+    size_t offsets_start = vo.size();
+    vb.resize(bytes_start + total_len);
+    vo.resize(offsets_start + size);
+    uint8_t* dst = vb.data() + bytes_start;
+    auto* offsets = vo.data() + offsets_start;
+    auto offset = static_cast<BinaryColumn::Offset>(bytes_start);
+
+    if (contiguous) {
+        if (total_len > 0) {
+            strings::memcpy_inlined(dst, first, total_len);
+        }
+        for (int i = 0; i < size; ++i) {
+            bool not_null = not_nulls == nullptr || not_nulls[i];
+            offset += not_null ? lengths[i] : 0;
+            offsets[i] = offset;
+        }
+    } else {
+        for (int i = 0; i < size; ++i) {
+            if (not_nulls == nullptr || not_nulls[i]) {
+                strings::memcpy_inlined(vb.data() + offset, starts[i], lengths[i]);
+                offset += lengths[i];
+            }
+            offsets[i] = offset;
+        }
+    }
+}
+
 static void fill_string_column(orc::ColumnVectorBatch* cvb, ColumnPtr& col, int from, int size,
                                const TypeDescriptor& type_desc, void* ctx) {
     OrcChunkReader* reader = static_cast<OrcChunkReader*>(ctx);
@@ -576,10 +634,7 @@ static void fill_string_column(orc::ColumnVectorBatch* cvb, ColumnPtr& col, int
             vo.emplace_back(vb.size());
         }
     } else {
-        for (int i = col_start; i < col_start + size; ++i, ++pos) {
-            vb.insert(vb.end(), data->data[pos], data->data[pos] + data->length[pos]);
-            vo.emplace_back(vb.size());
-        }
+        append_orc_strings(data, from, size, values);
     }
 
     // col_start == 0 and from == 0 means it's at top level of fill chunk, not in the middle of array
@@ -649,13 +704,8 @@ static void fill_string_column_with_null(orc::ColumnVectorBatch* cvb, ColumnPtr&
         } else {
             for (int i = col_start; i < col_start + size; ++i, ++pos) {
                 nulls[i] = !cvb->notNull[pos];
-                if (cvb->notNull[pos]) {
-                    vb.insert(vb.end(), data->data[pos], data->data[pos] + data->length[pos]);
-                    vo.emplace_back(vb.size());
-                } else {
-                    vo.emplace_back(vb.size());
-                }
             }
+            append_orc_strings(data, from, size, values);
         }
     } else {
         if (type_desc.type == TYPE_CHAR) {
@@ -666,10 +716,7 @@ static void fill_string_column_with_null(orc::ColumnVectorBatch* cvb, ColumnPtr&
                 vo.emplace_back(vb.size());
             }
         } else {
-            for (int i = col_start; i < col_start + size; ++i, ++pos) {
-                vb.insert(vb.end(), data->data[pos], data->data[pos] + data->length[pos]);
-                vo.emplace_back(vb.size());
-            }
+            append_orc_strings(data, from, size, values);
         }
     }
 
@@ -0,0 +1,77 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "formats/parquet/bloom_filter.h"
+
+#include <algorithm>
+
+#include "common/logging.h"
+#include "fs/fs.h"
+#include "gen_cpp/parquet_types.h"
+#include "gutil/strings/substitute.h"
+#include "util/thrift_util.h"
+#include "util/xxh3.h"
+
+namespace starrocks::parquet {
+
+const uint32_t SplitBlockBloomFilter::kSalt[kBitsSetPerBlock] = {0x47b6137b, 0x44974d91, 0x8824ad5b, 0xa2b7289d,
+                                                                 0x705495c7, 0x2df1424b, 0x9efc4947, 0x5c6bfb31};
+
+Status SplitBlockBloomFilter::read(RandomAccessFile* file, int64_t offset, int64_t file_size) {
+    // the header is a small thrift message, 64 bytes is enough for it.
+    constexpr int64_t kHeaderBufSize = 64;
+    if (offset < 0 || offset >= file_size) {
+        return Status::Corruption(strings::Substitute("Invalid parquet bloom filter offset: $0", offset));
+    }
+    uint8_t header_buf[kHeaderBufSize];
+    auto to_read = std::min(kHeaderBufSize, file_size - offset);
+    RETURN_IF_ERROR(file->read_at_fully(offset, header_buf, to_read));
+
+    tparquet::BloomFilterHeader header;
+    auto header_length = static_cast<uint32_t>(to_read);
+    RETURN_IF_ERROR(deserialize_thrift_msg(header_buf, &header_length, TProtocolType::COMPACT, &header));
+    if (!header.algorithm.__isset.BLOCK || !header.hash.__isset.XXHASH || !header.compression.__isset.UNCOMPRESSED) {
+        return Status::NotSupported("Not supported parquet bloom filter");
+    }
+    if (header.numBytes <= 0 || header.numBytes > kMaxBytes || header.numBytes % kBytesPerBlock != 0 ||
+        offset + header_length + header.numBytes > file_size) {
+        return Status::Corruption(strings::Substitute("Invalid parquet bloom filter size: $0", header.numBytes));
+    }
+
+    _bitset.resize(header.numBytes / sizeof(uint32_t));
+    return file->read_at_fully(offset + header_length, _bitset.data(), header.numBytes);
+}
+
+Status SplitBlockBloomFilter::init(size_t num_bytes) {
+    if (num_bytes == 0 || num_bytes > static_cast<size_t>(kMaxBytes) || num_bytes % kBytesPerBlock != 0) {
+        return Status::InvalidArgument(strings::Substitute("Invalid parquet bloom filter size: $0", num_bytes));
+    }
+    _bitset.assign(num_bytes / sizeof(uint32_t), 0);
+    return Status::OK();
+}
+
+void SplitBlockBloomFilter::insert_hash(uint64_t hash) {
+    DCHECK(!_bitset.empty());
+    uint32_t* block = &_bitset[_block_offset(hash)];
+    auto key = static_cast<uint32_t>(hash);
+    for (int i = 0; i < kBitsSetPerBlock; ++i) {
+        block[i] |= _mask(key, i);
+    }
+}
+
+bool SplitBlockBloomFilter::test_hash(uint64_t hash) const {
+    DCHECK(!_bitset.empty());
+    const uint32_t* block = &_bitset[_block_offset(hash)];
+    auto key = static_cast<uint32_t>(hash);
+    for (int i = 0; i < kBitsSetPerBlock; ++i) {
+        if ((block[i] & _mask(key, i)) == 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+uint64_t SplitBlockBloomFilter::hash(const void* data, size_t size) {
+    return XXH64(data, size, 0);
+}
+
+} // namespace starrocks::parquet
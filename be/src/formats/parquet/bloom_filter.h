@@ -0,0 +1,59 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "common/status.h"
+
+namespace starrocks {
+class RandomAccessFile;
+} // namespace starrocks
+
+namespace starrocks::parquet {
+
+// The split block bloom filter of parquet column chunk, see BloomFilter.md of parquet-format.
+// It is the same algorithm with BlockSplitBloomFilter in storage/rowset except the way to select
+// the block: parquet uses the multiply-shift of the most significant 32 bits of hash, so the
+// filters written by other parquet writers can be tested here.
+class SplitBlockBloomFilter {
+public:
+    // Read the bloom filter header and the following bitset at offset of file.
+    Status read(RandomAccessFile* file, int64_t offset, int64_t file_size);
+
+    // Init an empty bloom filter of num_bytes, num_bytes must be a positive multiple of 32.
+    Status init(size_t num_bytes);
+
+    void insert_hash(uint64_t hash);
+
+    bool test_hash(uint64_t hash) const;
+
+    size_t num_bytes() const { return _bitset.size() * sizeof(uint32_t); }
+
+    const uint8_t* data() const { return reinterpret_cast<const uint8_t*>(_bitset.data()); }
+
+    // Hash the plain encoded value, i.e. the little endian bytes of numbers and the bytes without
+    // length of BYTE_ARRAY.
+    static uint64_t hash(const void* data, size_t size);
+
+private:
+    static constexpr uint32_t kBytesPerBlock = 32;
+    static constexpr int kBitsSetPerBlock = 8;
+    // The maximum bitset size written by parquet-mr.
+    static constexpr int32_t kMaxBytes = 128 * 1024 * 1024;
+    static const uint32_t kSalt[kBitsSetPerBlock];
+
+    // the offset of first word of the block selected by hash in _bitset
+    size_t _block_offset(uint64_t hash) const {
+        uint64_t num_blocks = _bitset.size() / kBitsSetPerBlock;
+        return (((hash >> 32) * num_blocks) >> 32) * kBitsSetPerBlock;
+    }
+
+    static uint32_t _mask(uint32_t key, int i) { return 1U << ((key * kSalt[i]) >> 27); }
+
+    std::vector<uint32_t> _bitset;
+};
+
+} // namespace starrocks::parquet
@@ -85,6 +85,19 @@ Status ColumnChunkReader::next_page() {
     return Status::OK();
 }
 
+Status ColumnChunkReader::skip_page() {
+    if (_page_parse_state != PAGE_HEADER_PARSED) {
+        return Status::InternalError("Error state");
+    }
+    RETURN_IF_ERROR(_page_reader->skip_bytes(_page_reader->current_header()->compressed_page_size));
+    _page_parse_state = PAGE_DATA_PARSED;
+    return Status::OK();
+}
+
+const tparquet::PageHeader* ColumnChunkReader::current_page_header() const {
+    return _page_reader->current_header();
+}
+
 Status ColumnChunkReader::_parse_page_header() {
     DCHECK(_page_parse_state == INITIALIZED || _page_parse_state == PAGE_DATA_PARSED);
     RETURN_IF_ERROR(_page_reader->next_header());
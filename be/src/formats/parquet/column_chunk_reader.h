@@ -43,6 +43,14 @@ public:
 
     Status next_page();
 
+    // next_page() is split into next_header() and load_page(), so that the caller can check the header
+    // of next page and call skip_page() instead of load_page() to skip it without reading its data.
+    Status next_header() { return _parse_page_header(); }
+    Status load_page() { return _parse_page_data(); }
+    Status skip_page();
+
+    const tparquet::PageHeader* current_page_header() const;
+
     uint32_t num_values() const { return _num_values; }
 
     // Try to decode n definition levels into 'levels'
@@ -64,6 +72,10 @@ public:
     }
 
     Status decode_values(size_t n, const uint8_t* is_nulls, ColumnContentType content_type, vectorized::Column* dst) {
+        Status status = _cur_decoder->next_batch_with_nulls(n, is_nulls, content_type, dst);
+        if (!status.is_not_supported()) {
+            return status;
+        }
         size_t idx = 0;
         while (idx < n) {
             bool is_null = is_nulls[idx++];
@@ -85,6 +97,17 @@ public:
         return _cur_decoder->next_batch(n, content_type, dst);
     }
 
+    // Skip n values in current page, the decoders unable to skip decode the values into 'scratch'.
+    Status skip_values(size_t n, ColumnContentType content_type, vectorized::Column* scratch) {
+        Status status = _cur_decoder->skip(n);
+        if (status.is_not_supported()) {
+            RETURN_IF_ERROR(_cur_decoder->next_batch(n, content_type, scratch));
+            scratch->reset_column();
+            return Status::OK();
+        }
+        return status;
+    }
+
     const tparquet::ColumnMetaData& metadata() const { return _chunk_metadata->meta_data; }
 
     Status get_dict_values(vectorized::Column* column) { return _cur_decoder->get_dict_values(column); }
@@ -85,6 +85,15 @@ public:
 
     Status finish_batch() override { return Status::OK(); }
 
+    Status skip_batch(size_t num_records, ColumnContentType content_type, vectorized::Column* scratch) override {
+        if (!converter->need_convert) {
+            return _reader->skip_records(num_records, content_type, scratch);
+        } else {
+            auto column = converter->create_src_column();
+            return _reader->skip_records(num_records, content_type, column.get());
+        }
+    }
+
     void get_levels(level_t** def_levels, level_t** rep_levels, size_t* num_levels) override {
         _reader->get_levels(def_levels, rep_levels, num_levels);
     }
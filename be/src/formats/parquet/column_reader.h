@@ -28,6 +28,12 @@ public:
 
     virtual void get_levels(level_t** def_levels, level_t** rep_levels, size_t* num_levels) = 0;
 
+    // Skip num_records records, 'scratch' is a column of the same type with the column passed to
+    // next_batch, it is used to hold the skipped values and its content is undefined after the call.
+    virtual Status skip_batch(size_t num_records, ColumnContentType content_type, vectorized::Column* scratch) {
+        return Status::NotSupported("skip_batch is not supported");
+    }
+
     virtual Status get_dict_values(vectorized::Column* column) {
         return Status::NotSupported("get_dict_values is not supported");
     }
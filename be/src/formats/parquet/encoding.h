@@ -71,6 +71,18 @@ public:
     virtual Status next_batch(size_t count, uint8_t* dst) {
         return Status::NotSupported("next_batch is not supported");
     }
+
+    // Decode the not null values of count rows into the nullable column 'dst', where the row i is null if
+    // is_nulls[i] != 0. The null map of 'dst' is appended from is_nulls directly.
+    // Return NotSupported if the decoder or the type of 'dst' is not supported, then the caller should decode
+    // the runs of not null values by next_batch.
+    virtual Status next_batch_with_nulls(size_t count, const uint8_t* is_nulls, ColumnContentType content_type,
+                                         vectorized::Column* dst) {
+        return Status::NotSupported("next_batch_with_nulls is not supported");
+    }
+
+    // Skip count values without materializing them, the same bound restriction as next_batch.
+    virtual Status skip(size_t count) { return Status::NotSupported("skip is not supported"); }
 };
 
 class EncodingInfo {
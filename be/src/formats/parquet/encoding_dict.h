@@ -2,12 +2,17 @@
 
 #pragma once
 
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
 #include <map>
 
 #include "column/column.h"
 #include "column/column_helper.h"
 #include "common/status.h"
 #include "formats/parquet/encoding.h"
+#include "formats/parquet/encoding_plain.h"
 #include "util/coding.h"
 #include "util/rle_encoding.h"
 #include "util/slice.h"
@@ -18,6 +23,27 @@ struct SliceHasher {
     uint32_t operator()(const Slice& s) const { return HashUtil::hash(s.data, s.size, 397); }
 };
 
+// Decode count dict indexes, and check that all of them are in the dictionary of dict_size values.
+inline Status decode_dict_indexes(RleBatchDecoder<uint32_t>* decoder, size_t count, size_t dict_size,
+                                  std::vector<uint32_t>* indexes) {
+    if (indexes->size() < count) {
+        raw::stl_vector_resize_uninitialized(indexes, count);
+    }
+    uint32_t* data = indexes->data();
+    if (decoder->GetBatch(data, static_cast<int32_t>(count)) != count) {
+        return Status::Corruption("going to read out-of-bounds dict indexes");
+    }
+    // vectorized by the compiler
+    uint32_t max_index = 0;
+    for (size_t i = 0; i < count; i++) {
+        max_index = std::max(max_index, data[i]);
+    }
+    if (count > 0 && max_index >= dict_size) {
+        return Status::Corruption(strings::Substitute("dict index $0 out of the dict size $1", max_index, dict_size));
+    }
+    return Status::OK();
+}
+
 template <typename T>
 class DictEncoder final : public Encoder {
 public:
@@ -97,8 +123,7 @@ public:
     }
 
     Status next_batch(size_t count, ColumnContentType content_type, vectorized::Column* dst) override {
-        _indexes.reserve(count);
-        _index_batch_decoder.GetBatch(&_indexes[0], count);
+        RETURN_IF_ERROR(decode_dict_indexes(&_index_batch_decoder, count, _dict.size(), &_indexes));
 
         if (dst->is_nullable()) {
             auto* nullable_column = reinterpret_cast<vectorized::NullableColumn*>(dst);
@@ -107,9 +132,7 @@ public:
             size_t cur_size = data_column->size();
             data_column->resize_uninitialized(cur_size + count);
 
-            for (int i = 0; i < count; i++) {
-                data_column->get_data()[cur_size + i] = _dict[_indexes[i]];
-            }
+            _gather(count, data_column->get_data().data() + cur_size);
 
             nullable_column->null_column()->append_default(count);
         } else {
@@ -118,17 +141,68 @@ public:
             size_t cur_size = data_column->size();
             data_column->resize_uninitialized(cur_size + count);
 
-            for (int i = 0; i < count; i++) {
-                data_column->get_data()[cur_size + i] = _dict[_indexes[i]];
-            }
+            _gather(count, data_column->get_data().data() + cur_size);
         }
 
         return Status::OK();
     }
 
+    Status next_batch_with_nulls(size_t count, const uint8_t* is_nulls, ColumnContentType content_type,
+                                 vectorized::Column* dst) override {
+        auto* nullable_column = as_nullable_column_of<T>(dst);
+        if (nullable_column == nullptr) {
+            return Status::NotSupported("next_batch_with_nulls is not supported");
+        }
+        size_t num_values = count - SIMD::count_nonzero(is_nulls, count);
+        RETURN_IF_ERROR(decode_dict_indexes(&_index_batch_decoder, num_values, _dict.size(), &_indexes));
+        const T* dict = _dict.data();
+        const uint32_t* indexes = _indexes.data();
+        append_values_with_nulls<T>(count, is_nulls, num_values, nullable_column,
+                                    [dict, indexes](size_t idx) { return dict[indexes[idx]]; });
+        return Status::OK();
+    }
+
+    Status skip(size_t count) override {
+        // only decode the indexes, the values are not looked up
+        while (count > 0) {
+            auto batch = static_cast<int32_t>(std::min(count, _indexes.size()));
+            if (_index_batch_decoder.GetBatch(&_indexes[0], batch) != batch) {
+                return Status::InternalError("going to skip out-of-bounds dict indexes");
+            }
+            count -= batch;
+        }
+        return Status::OK();
+    }
+
 private:
     enum { SIZE_OF_TYPE = sizeof(T) };
 
+    // Look up the dict values of the first count indexes into dst, the indexes must be checked.
+    void _gather(size_t count, T* dst) const {
+        const T* dict = _dict.data();
+        const uint32_t* indexes = _indexes.data();
+        size_t i = 0;
+#ifdef __AVX2__
+        // the indexes are less than the dict size, so they are non-negative as int32
+        if constexpr (std::is_arithmetic_v<T> && sizeof(T) == 4) {
+            for (; i + 8 <= count; i += 8) {
+                __m256i idx = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indexes + i));
+                __m256i values = _mm256_i32gather_epi32(reinterpret_cast<const int*>(dict), idx, 4);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), values);
+            }
+        } else if constexpr (std::is_arithmetic_v<T> && sizeof(T) == 8) {
+            for (; i + 4 <= count; i += 4) {
+                __m128i idx = _mm_loadu_si128(reinterpret_cast<const __m128i*>(indexes + i));
+                __m256i values = _mm256_i32gather_epi64(reinterpret_cast<const long long*>(dict), idx, 8);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), values);
+            }
+        }
+#endif
+        for (; i < count; i++) {
+            dst[i] = dict[indexes[i]];
+        }
+    }
+
     RleBatchDecoder<uint32_t> _index_batch_decoder;
     std::vector<T> _dict;
     std::vector<uint32_t> _indexes;
@@ -207,7 +281,7 @@ public:
     }
 
     Status next_batch(size_t count, ColumnContentType content_type, vectorized::Column* dst) override {
-        _index_batch_decoder.GetBatch(&_indexes[0], count);
+        RETURN_IF_ERROR(decode_dict_indexes(&_index_batch_decoder, count, _dict.size(), &_indexes));
 
         switch (content_type) {
         case DICT_CODE: {
@@ -229,6 +303,59 @@ public:
         return Status::OK();
     }
 
+    Status next_batch_with_nulls(size_t count, const uint8_t* is_nulls, ColumnContentType content_type,
+                                 vectorized::Column* dst) override {
+        vectorized::NullableColumn* nullable_column = nullptr;
+        if (content_type == DICT_CODE) {
+            nullable_column = as_nullable_column_of<int32_t>(dst);
+        } else if (content_type == VALUE && dst->is_nullable() &&
+                   reinterpret_cast<vectorized::NullableColumn*>(dst)->data_column()->is_binary()) {
+            nullable_column = reinterpret_cast<vectorized::NullableColumn*>(dst);
+        }
+        if (nullable_column == nullptr) {
+            return Status::NotSupported("next_batch_with_nulls is not supported");
+        }
+        size_t num_values = count - SIMD::count_nonzero(is_nulls, count);
+        RETURN_IF_ERROR(decode_dict_indexes(&_index_batch_decoder, num_values, _dict.size(), &_indexes));
+        const uint32_t* indexes = _indexes.data();
+
+        switch (content_type) {
+        case DICT_CODE: {
+            append_values_with_nulls<int32_t>(count, is_nulls, num_values, nullable_column,
+                                              [indexes](size_t idx) { return static_cast<int32_t>(indexes[idx]); });
+            break;
+        }
+        case VALUE: {
+            // the null rows are empty strings
+            raw::stl_vector_resize_uninitialized(&_slices, count);
+            size_t value_idx = 0;
+            for (size_t i = 0; i < count; i++) {
+                _slices[i] = is_nulls[i] ? Slice() : _dict[indexes[value_idx]];
+                value_idx += !is_nulls[i];
+            }
+            nullable_column->data_column()->append_strings_overflow(_slices, _max_value_length);
+            nullable_column->null_column()->append_numbers(is_nulls, count);
+            nullable_column->set_has_null(num_values < count);
+            break;
+        }
+        default:
+            return Status::NotSupported("read type not supported");
+        }
+        return Status::OK();
+    }
+
+    Status skip(size_t count) override {
+        // only decode the indexes, the values are not looked up
+        while (count > 0) {
+            auto batch = static_cast<int32_t>(std::min(count, _indexes.size()));
+            if (_index_batch_decoder.GetBatch(&_indexes[0], batch) != batch) {
+                return Status::InternalError("going to skip out-of-bounds dict indexes");
+            }
+            count -= batch;
+        }
+        return Status::OK();
+    }
+
 private:
     enum { SIZE_OF_DICT_CODE_TYPE = sizeof(int32_t) };
     std::unordered_map<Slice, int32_t, SliceHasher> _dict_code_by_value;
@@ -3,9 +3,11 @@
 #pragma once
 
 #include "column/column.h"
+#include "column/nullable_column.h"
 #include "common/status.h"
 #include "formats/parquet/encoding.h"
 #include "gutil/strings/substitute.h"
+#include "simd/simd.h"
 #include "util/bit_stream_utils.h"
 #include "util/coding.h"
 #include "util/faststring.h"
@@ -15,6 +17,48 @@ namespace starrocks::parquet {
 
 static constexpr int kBooleanBitPackedBitWidth = 1;
 
+// Return the nullable column if 'column' is nullable and its data column stores T, otherwise nullptr.
+template <typename T>
+inline vectorized::NullableColumn* as_nullable_column_of(vectorized::Column* column) {
+    if (!column->is_nullable()) {
+        return nullptr;
+    }
+    auto* nullable_column = reinterpret_cast<vectorized::NullableColumn*>(column);
+    const auto& data_column = nullable_column->data_column();
+    if (!data_column->is_numeric() || data_column->type_size() != sizeof(T)) {
+        return nullptr;
+    }
+    return nullable_column;
+}
+
+// Append count rows to 'dst', the row i is null if is_nulls[i] != 0, and the not null rows take get_value(0),
+// get_value(1), ... in order. The data of the null rows are copied from the neighbouring values, so that the loop
+// has no branch and is vectorized by the compiler.
+template <typename T, typename GetValue>
+inline void append_values_with_nulls(size_t count, const uint8_t* is_nulls, size_t num_values,
+                                     vectorized::NullableColumn* dst, GetValue&& get_value) {
+    auto* data_column = dst->data_column().get();
+    size_t cur_size = data_column->size();
+    data_column->resize_uninitialized(cur_size + count);
+    T* data = reinterpret_cast<T*>(data_column->mutable_raw_data()) + cur_size;
+
+    // the rows after the last not null row are not filled by the loop, to not read out of the values
+    size_t num_filled = count;
+    while (num_filled > 0 && is_nulls[num_filled - 1]) {
+        num_filled--;
+    }
+    size_t value_idx = 0;
+    for (size_t i = 0; i < num_filled; i++) {
+        data[i] = get_value(value_idx);
+        value_idx += !is_nulls[i];
+    }
+    DCHECK_EQ(num_values, value_idx);
+    std::fill(data + num_filled, data + count, T{});
+
+    dst->null_column()->append_numbers(is_nulls, count);
+    dst->set_has_null(num_values < count);
+}
+
 template <typename T>
 class PlainEncoder final : public Encoder {
 public:
@@ -110,6 +154,28 @@ public:
         return Status::OK();
     }
 
+    Status next_batch_with_nulls(size_t count, const uint8_t* is_nulls, ColumnContentType content_type,
+                                 vectorized::Column* dst) override {
+        auto* nullable_column = as_nullable_column_of<T>(dst);
+        if (nullable_column == nullptr) {
+            return Status::NotSupported("next_batch_with_nulls is not supported");
+        }
+        size_t num_values = count - SIMD::count_nonzero(is_nulls, count);
+        size_t max_fetch = num_values * SIZE_OF_TYPE;
+        if (max_fetch + _offset > _data.size) {
+            return Status::InternalError(strings::Substitute(
+                    "going to read out-of-bounds data, offset=$0,count=$1,size=$2", _offset, num_values, _data.size));
+        }
+        const char* values = _data.data + _offset;
+        append_values_with_nulls<T>(count, is_nulls, num_values, nullable_column, [values](size_t idx) {
+            T value;
+            memcpy(&value, values + idx * SIZE_OF_TYPE, SIZE_OF_TYPE);
+            return value;
+        });
+        _offset += max_fetch;
+        return Status::OK();
+    }
+
     Status next_batch(size_t count, uint8_t* dst) override {
         size_t max_fetch = count * SIZE_OF_TYPE;
         if (max_fetch + _offset > _data.size) {
@@ -121,6 +187,16 @@ public:
         return Status::OK();
     }
 
+    Status skip(size_t count) override {
+        size_t max_fetch = count * SIZE_OF_TYPE;
+        if (max_fetch + _offset > _data.size) {
+            return Status::InternalError(strings::Substitute(
+                    "going to skip out-of-bounds data, offset=$0,count=$1,size=$2", _offset, count, _data.size));
+        }
+        _offset += max_fetch;
+        return Status::OK();
+    }
+
 private:
     enum { SIZE_OF_TYPE = sizeof(T) };
 
@@ -186,6 +262,20 @@ public:
         return Status::OK();
     }
 
+    Status skip(size_t count) override {
+        size_t num_skipped = 0;
+        while (num_skipped < count && _offset < _data.size) {
+            uint32_t length = decode_fixed32_le(reinterpret_cast<const uint8_t*>(_data.data) + _offset);
+            _offset += sizeof(int32_t) + length;
+            num_skipped++;
+        }
+        if (num_skipped < count || _offset > _data.size) {
+            return Status::InternalError(strings::Substitute(
+                    "going to skip out-of-bounds data, offset=$0,count=$1,size=$2", _offset, count, _data.size));
+        }
+        return Status::OK();
+    }
+
 private:
     Slice _data;
     size_t _offset = 0;
@@ -357,6 +447,15 @@ public:
         return Status::OK();
     }
 
+    Status skip(size_t count) override {
+        if (_offset + _type_length * count > _data.size) {
+            return Status::InternalError(strings::Substitute(
+                    "going to skip out-of-bounds data, offset=$0,count=$1,size=$2", _offset, count, _data.size));
+        }
+        _offset += _type_length * count;
+        return Status::OK();
+    }
+
 private:
     Slice _data;
     size_t _type_length;
@@ -2,11 +2,18 @@
 
 #include "formats/parquet/file_reader.h"
 
+#include <limits>
+
 #include "column/column_helper.h"
+#include "column/column_viewer.h"
+#include "common/config.h"
 #include "exec/exec_node.h"
 #include "exec/vectorized/hdfs_scanner.h"
 #include "exprs/expr.h"
 #include "exprs/expr_context.h"
+#include "exprs/vectorized/in_const_predicate.hpp"
+#include "formats/footer_cache.h"
+#include "formats/parquet/bloom_filter.h"
 #include "formats/parquet/encoding_plain.h"
 #include "formats/parquet/metadata.h"
 #include "fs/fs.h"
@@ -29,6 +36,18 @@ FileReader::~FileReader() = default;
 
 Status FileReader::init(vectorized::HdfsScannerContext* ctx) {
     _scanner_ctx = ctx;
+    if (config::parquet_read_coalesce_max_bytes > 0) {
+        _shared_buffered_stream = std::make_shared<SharedBufferedInputStream>(
+                _file->stream(), config::parquet_read_coalesce_max_gap, config::parquet_read_coalesce_max_bytes,
+                _scanner_ctx->stats);
+        _shared_buffered_file = std::make_unique<RandomAccessFile>(_shared_buffered_stream, _file->filename());
+        _file = _shared_buffered_file.get();
+        // a small file is read in one IO, which serves the footer and all the row groups
+        if (_file_size <= config::parquet_read_fully_max_file_bytes) {
+            RETURN_IF_ERROR(_shared_buffered_stream->set_io_ranges({{0, static_cast<int64_t>(_file_size)}}));
+            _loaded_row_group_idx = std::numeric_limits<int64_t>::max();
+        }
+    }
     RETURN_IF_ERROR(_parse_footer());
 
     std::unordered_set<std::string> names;
@@ -43,6 +62,18 @@ Status FileReader::init(vectorized::HdfsScannerContext* ctx) {
 }
 
 Status FileReader::_parse_footer() {
+    auto* footer_cache = FooterCache::instance();
+    std::string footer_cache_key;
+    if (footer_cache != nullptr) {
+        footer_cache_key = FooterCache::encode_key("parquet", _file->filename(), _file_size,
+                                                   _scanner_ctx->file_modification_time());
+        _file_metadata = footer_cache->lookup<FileMetaData>(footer_cache_key);
+        if (_file_metadata != nullptr) {
+            _scanner_ctx->stats->footer_cache_hit_count++;
+            return Status::OK();
+        }
+    }
+
     // try with buffer on stack
     constexpr uint64_t footer_buf_size = 16 * 1024;
     uint8_t local_buf[footer_buf_size];
@@ -84,8 +115,13 @@ Status FileReader::_parse_footer() {
     // deserialize footer
     RETURN_IF_ERROR(deserialize_thrift_msg(footer_buf + to_read - 8 - footer_size, &footer_size, TProtocolType::COMPACT,
                                            &t_metadata));
-    _file_metadata.reset(new FileMetaData());
-    RETURN_IF_ERROR(_file_metadata->init(t_metadata));
+    auto file_metadata = std::make_shared<FileMetaData>();
+    RETURN_IF_ERROR(file_metadata->init(t_metadata));
+    _file_metadata = file_metadata;
+    if (footer_cache != nullptr) {
+        // the parsed footer takes a few times as much memory as the serialized one.
+        footer_cache->insert<FileMetaData>(footer_cache_key, _file_metadata, footer_size * 4);
+    }
 
     return Status::OK();
 }
@@ -118,11 +154,11 @@ StatusOr<bool> FileReader::_filter_group(const tparquet::RowGroup& row_group) {
 
         bool exist = false;
         RETURN_IF_ERROR(_read_min_max_chunk(row_group, &min_chunk, &max_chunk, &exist));
-        if (!exist) {
-            return false;
-        }
-
         for (auto& min_max_conjunct_ctx : _scanner_ctx->min_max_conjunct_ctxs) {
+            // statistics not exist, try the bloom filter
+            if (!exist) {
+                break;
+            }
             ASSIGN_OR_RETURN(auto min_column, min_max_conjunct_ctx->evaluate(min_chunk.get()));
             ASSIGN_OR_RETURN(auto max_column, min_max_conjunct_ctx->evaluate(max_chunk.get()));
 
@@ -135,6 +171,143 @@ StatusOr<bool> FileReader::_filter_group(const tparquet::RowGroup& row_group) {
         }
     }
 
+    return _filter_group_by_bloom_filter(row_group);
+}
+
+template <PrimitiveType PT>
+static uint64_t hash_plain_value(const RunTimeCppType<PT>& value) {
+    if constexpr (isSlicePT<PT>) {
+        return SplitBlockBloomFilter::hash(value.data, value.size);
+    } else {
+        return SplitBlockBloomFilter::hash(&value, sizeof(value));
+    }
+}
+
+// Get the hashes of the values of an equality or IN conjunct on slot.
+// Return false if the conjunct is not of these kinds.
+template <PrimitiveType PT>
+static bool get_conjunct_value_hashes(ExprContext* conjunct_ctx, const SlotDescriptor* slot,
+                                      std::vector<uint64_t>* hashes) {
+    Expr* root = conjunct_ctx->root();
+    if (root->get_num_children() < 1) {
+        return false;
+    }
+    Expr* slot_expr = root->get_child(0);
+    std::vector<SlotId> slot_ids;
+    if (!slot_expr->is_slotref() || slot_expr->type().type != PT || slot_expr->get_slot_ids(&slot_ids) != 1 ||
+        slot_ids[0] != slot->id()) {
+        return false;
+    }
+
+    if (root->op() == TExprOpcode::EQ && root->get_num_children() == 2) {
+        Expr* value_expr = root->get_child(1);
+        if (!value_expr->is_constant() || value_expr->type().type != PT) {
+            return false;
+        }
+        auto value_column = conjunct_ctx->evaluate(value_expr, nullptr);
+        if (!value_column.ok() || value_column.value()->size() != 1) {
+            return false;
+        }
+        vectorized::ColumnViewer<PT> viewer(value_column.value());
+        if (viewer.is_null(0)) {
+            return false;
+        }
+        hashes->emplace_back(hash_plain_value<PT>(viewer.value(0)));
+        return true;
+    }
+
+    if (root->op() == TExprOpcode::FILTER_IN) {
+        const auto* pred = down_cast<const vectorized::VectorizedInConstPredicate<PT>*>(root);
+        // the values are not in hash set if array is used
+        if (pred->is_not_in() || pred->null_in_set() || pred->is_use_array()) {
+            return false;
+        }
+        for (const auto& value : pred->hash_set()) {
+            hashes->emplace_back(hash_plain_value<PT>(value));
+        }
+        return true;
+    }
+    return false;
+}
+
+StatusOr<bool> FileReader::_filter_group_by_bloom_filter(const tparquet::RowGroup& row_group) const {
+    const vectorized::HdfsScannerContext& ctx = *_scanner_ctx;
+    if (!config::parquet_bloom_filter_enable) {
+        return false;
+    }
+
+    for (const auto& [slot_id, conjunct_ctxs] : ctx.conjunct_ctxs_by_slot) {
+        const SlotDescriptor* slot = nullptr;
+        for (const auto* tuple_slot : ctx.tuple_desc->slots()) {
+            if (tuple_slot->id() == slot_id) {
+                slot = tuple_slot;
+                break;
+            }
+        }
+        if (slot == nullptr) {
+            continue;
+        }
+        const auto* column_meta = _get_column_meta(row_group, slot->col_name());
+        if (column_meta == nullptr || !column_meta->__isset.bloom_filter_offset) {
+            continue;
+        }
+        // only the types whose plain encoding is the same with the memory layout are supported
+        PrimitiveType type = slot->type().type;
+        tparquet::Type::type physical_type = column_meta->type;
+        if (!(type == TYPE_INT && physical_type == tparquet::Type::INT32) &&
+            !(type == TYPE_BIGINT && physical_type == tparquet::Type::INT64) &&
+            !(type == TYPE_VARCHAR && physical_type == tparquet::Type::BYTE_ARRAY)) {
+            continue;
+        }
+        const ParquetField* field = _file_metadata->schema().resolve_by_name(slot->col_name());
+        std::unique_ptr<ColumnConverter> converter;
+        if (field == nullptr ||
+            !ColumnConverterFactory::create_converter(*field, slot->type(), ctx.timezone, &converter).ok() ||
+            converter->need_convert) {
+            continue;
+        }
+
+        std::unique_ptr<SplitBlockBloomFilter> bloom_filter;
+        for (ExprContext* conjunct_ctx : conjunct_ctxs) {
+            std::vector<uint64_t> hashes;
+            bool is_supported = false;
+            switch (type) {
+            case TYPE_INT:
+                is_supported = get_conjunct_value_hashes<TYPE_INT>(conjunct_ctx, slot, &hashes);
+                break;
+            case TYPE_BIGINT:
+                is_supported = get_conjunct_value_hashes<TYPE_BIGINT>(conjunct_ctx, slot, &hashes);
+                break;
+            default:
+                is_supported = get_conjunct_value_hashes<TYPE_VARCHAR>(conjunct_ctx, slot, &hashes);
+                break;
+            }
+            if (!is_supported) {
+                continue;
+            }
+
+            if (bloom_filter == nullptr) {
+                SCOPED_RAW_TIMER(&ctx.stats->bloom_filter_read_ns);
+                bloom_filter = std::make_unique<SplitBlockBloomFilter>();
+                Status status = bloom_filter->read(_file, column_meta->bloom_filter_offset, _file_size);
+                if (!status.ok()) {
+                    // the bloom filter is only an optimization, read the row group instead.
+                    LOG(WARNING) << "Failed to read parquet bloom filter of " << _file->filename() << ": " << status;
+                    break;
+                }
+            }
+            bool may_exist = false;
+            for (uint64_t hash : hashes) {
+                if (bloom_filter->test_hash(hash)) {
+                    may_exist = true;
+                    break;
+                }
+            }
+            if (!may_exist) {
+                return true;
+            }
+        }
+    }
     return false;
 }
 
@@ -184,6 +357,156 @@ Status FileReader::_read_min_max_chunk(const tparquet::RowGroup& row_group, vect
     return Status::OK();
 }
 
+// read the thrift message of length bytes at offset of file
+template <typename T>
+static Status read_thrift_at(RandomAccessFile* file, int64_t offset, int32_t length, T* msg) {
+    if (offset < 0 || length <= 0) {
+        return Status::Corruption(
+                strings::Substitute("Invalid parquet page index: offset=$0, length=$1", offset, length));
+    }
+    std::unique_ptr<uint8_t[]> buf(new uint8_t[length]);
+    RETURN_IF_ERROR(file->read_at_fully(offset, buf.get(), length));
+    auto len = static_cast<uint32_t>(length);
+    return deserialize_thrift_msg(buf.get(), &len, TProtocolType::COMPACT, msg);
+}
+
+StatusOr<bool> FileReader::_select_row_ranges(const tparquet::RowGroup& row_group,
+                                              vectorized::SparseRange* row_ranges) const {
+    const vectorized::HdfsScannerContext& ctx = *_scanner_ctx;
+    if (!config::parquet_page_index_enable || ctx.min_max_conjunct_ctxs.empty()) {
+        return false;
+    }
+    SCOPED_RAW_TIMER(&ctx.stats->page_index_read_ns);
+
+    // group the conjuncts by slot, the conjuncts of multiple slots can not be evaluated on the pages, because
+    // the pages of different columns are not aligned.
+    std::map<const SlotDescriptor*, std::vector<ExprContext*>> conjunct_ctxs_by_slot;
+    for (ExprContext* conjunct_ctx : ctx.min_max_conjunct_ctxs) {
+        std::vector<SlotId> slot_ids;
+        conjunct_ctx->root()->get_slot_ids(&slot_ids);
+        if (slot_ids.size() != 1) {
+            continue;
+        }
+        for (const auto* slot : ctx.min_max_tuple_desc->slots()) {
+            if (slot->id() == slot_ids[0]) {
+                conjunct_ctxs_by_slot[slot].emplace_back(conjunct_ctx);
+                break;
+            }
+        }
+    }
+
+    bool selected = false;
+    *row_ranges = vectorized::SparseRange(0, row_group.num_rows);
+    for (const auto& [slot, conjunct_ctxs] : conjunct_ctxs_by_slot) {
+        vectorized::SparseRange column_row_ranges;
+        ASSIGN_OR_RETURN(bool column_selected,
+                         _select_column_row_ranges(row_group, slot, conjunct_ctxs, &column_row_ranges));
+        if (column_selected) {
+            *row_ranges &= column_row_ranges;
+            selected = true;
+        }
+    }
+    return selected;
+}
+
+StatusOr<bool> FileReader::_select_column_row_ranges(const tparquet::RowGroup& row_group, const SlotDescriptor* slot,
+                                                     const std::vector<ExprContext*>& conjunct_ctxs,
+                                                     vectorized::SparseRange* row_ranges) const {
+    const tparquet::ColumnChunk* column_chunk = nullptr;
+    for (const auto& column : row_group.columns) {
+        if (column.meta_data.path_in_schema[0] == slot->col_name()) {
+            column_chunk = &column;
+            break;
+        }
+    }
+    if (column_chunk == nullptr || !column_chunk->__isset.offset_index_offset ||
+        !column_chunk->__isset.column_index_offset) {
+        return false;
+    }
+
+    tparquet::OffsetIndex offset_index;
+    tparquet::ColumnIndex column_index;
+    Status status = read_thrift_at(_file, column_chunk->offset_index_offset, column_chunk->offset_index_length,
+                                   &offset_index);
+    if (status.ok()) {
+        status = read_thrift_at(_file, column_chunk->column_index_offset, column_chunk->column_index_length,
+                                &column_index);
+    }
+    if (!status.ok()) {
+        // the page index is only an optimization, read the whole row group instead.
+        LOG(WARNING) << "Failed to read parquet page index of " << _file->filename() << ": " << status;
+        return false;
+    }
+    const auto& page_locations = offset_index.page_locations;
+    size_t num_pages = page_locations.size();
+    if (num_pages == 0 || column_index.null_pages.size() != num_pages || column_index.min_values.size() != num_pages ||
+        column_index.max_values.size() != num_pages) {
+        return false;
+    }
+
+    const ParquetField* field = _file_metadata->schema().resolve_by_name(slot->col_name());
+    const tparquet::ColumnOrder* column_order = nullptr;
+    if (_file_metadata->t_metadata().__isset.column_orders) {
+        const auto& column_orders = _file_metadata->t_metadata().column_orders;
+        int column_idx = field->physical_column_index;
+        column_order = column_idx < column_orders.size() ? &column_orders[column_idx] : nullptr;
+    }
+
+    // make min/max chunk of this slot, one row for each page
+    vectorized::ColumnPtr min_column = vectorized::ColumnHelper::create_column(slot->type(), slot->is_nullable());
+    vectorized::ColumnPtr max_column = vectorized::ColumnHelper::create_column(slot->type(), slot->is_nullable());
+    tparquet::ColumnMetaData page_meta;
+    page_meta.__set_type(column_chunk->meta_data.type);
+    for (size_t i = 0; i < num_pages; i++) {
+        if (column_index.null_pages[i]) {
+            // min/max values of null page are not valid, the page is always selected.
+            min_column->append_default();
+            max_column->append_default();
+            continue;
+        }
+        tparquet::Statistics statistics;
+        statistics.__set_min_value(column_index.min_values[i]);
+        statistics.__set_max_value(column_index.max_values[i]);
+        page_meta.__set_statistics(statistics);
+        status = _decode_min_max_column(*field, _scanner_ctx->timezone, slot->type(), page_meta, column_order,
+                                               &min_column, &max_column);
+        if (!status.ok()) {
+            return false;
+        }
+    }
+    auto min_chunk = std::make_shared<vectorized::Chunk>();
+    auto max_chunk = std::make_shared<vectorized::Chunk>();
+    min_chunk->append_column(min_column, slot->id());
+    max_chunk->append_column(max_column, slot->id());
+
+    std::vector<uint8_t> selection(num_pages, 1);
+    for (ExprContext* conjunct_ctx : conjunct_ctxs) {
+        ASSIGN_OR_RETURN(auto min_result, conjunct_ctx->evaluate(min_chunk.get()));
+        ASSIGN_OR_RETURN(auto max_result, conjunct_ctx->evaluate(max_chunk.get()));
+        for (size_t i = 0; i < num_pages; i++) {
+            if (!selection[i] || column_index.null_pages[i]) {
+                continue;
+            }
+            auto min = min_result->get(i);
+            auto max = max_result->get(i);
+            // same as _filter_group, the page is filtered only if both of min and max are false.
+            if (!min.is_null() && !max.is_null() && min.get_int8() == 0 && max.get_int8() == 0) {
+                selection[i] = 0;
+            }
+        }
+    }
+
+    row_ranges->clear();
+    for (size_t i = 0; i < num_pages; i++) {
+        if (selection[i]) {
+            int64_t first_row = page_locations[i].first_row_index;
+            int64_t end_row = i + 1 < num_pages ? page_locations[i + 1].first_row_index : row_group.num_rows;
+            row_ranges->add(vectorized::Range(first_row, end_row));
+        }
+    }
+    return true;
+}
+
 int FileReader::_get_partition_column_idx(const std::string& col_name) const {
     for (size_t i = 0; i < _scanner_ctx->partition_columns.size(); i++) {
         if (_scanner_ctx->partition_columns[i].col_name == col_name) {
@@ -352,6 +675,8 @@ Status FileReader::_create_and_init_group_reader(int row_group_number) {
     param.read_cols = _read_cols;
     param.timezone = fd_scanner_ctx.timezone;
     param.stats = fd_scanner_ctx.stats;
+    ASSIGN_OR_RETURN(param.use_row_ranges,
+                     _select_row_ranges(_file_metadata->t_metadata().row_groups[row_group_number], &param.row_ranges));
 
     RETURN_IF_ERROR(row_group_reader->init(param));
     _row_group_readers.emplace_back(row_group_reader);
@@ -407,6 +732,7 @@ Status FileReader::get_next(vectorized::ChunkPtr* chunk) {
     }
 
     if (_cur_row_group_idx < _row_group_size) {
+        RETURN_IF_ERROR(_load_row_group_io_ranges());
         size_t row_count = _chunk_size;
         Status status = _row_group_readers[_cur_row_group_idx]->get_next(chunk, &row_count);
         if (status.ok() || status.is_end_of_file()) {
@@ -427,6 +753,16 @@ Status FileReader::get_next(vectorized::ChunkPtr* chunk) {
     return Status::EndOfFile("");
 }
 
+Status FileReader::_load_row_group_io_ranges() {
+    if (_shared_buffered_stream == nullptr || _loaded_row_group_idx >= static_cast<int64_t>(_cur_row_group_idx)) {
+        return Status::OK();
+    }
+    _loaded_row_group_idx = _cur_row_group_idx;
+    std::vector<SharedBufferedInputStream::IORange> ranges;
+    _row_group_readers[_cur_row_group_idx]->collect_io_ranges(&ranges);
+    return _shared_buffered_stream->set_io_ranges(std::move(ranges));
+}
+
 Status FileReader::_exec_only_partition_scan(vectorized::ChunkPtr* chunk) {
     if (_scan_row_count < _total_row_count) {
         size_t read_size = std::min(static_cast<size_t>(_chunk_size), _total_row_count - _scan_row_count);
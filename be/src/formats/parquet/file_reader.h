@@ -13,6 +13,7 @@
 #include "util/runtime_profile.h"
 
 namespace starrocks {
+class ExprContext;
 class RandomAccessFile;
 
 namespace vectorized {
@@ -54,6 +55,10 @@ private:
     // filter row group by min/max conjuncts
     StatusOr<bool> _filter_group(const tparquet::RowGroup& row_group);
 
+    // filter row group by the bloom filters of column chunks, the row group is filtered if none of
+    // the values of an equality or IN conjunct may exist in the bloom filter of the column chunk.
+    StatusOr<bool> _filter_group_by_bloom_filter(const tparquet::RowGroup& row_group) const;
+
     // get row group to read
     // if scan range conatain the first byte in the row group, will be read
     // TODO: later modify the larger block should be read
@@ -64,6 +69,16 @@ private:
     Status _read_min_max_chunk(const tparquet::RowGroup& row_group, vectorized::ChunkPtr* min_chunk,
                                vectorized::ChunkPtr* max_chunk, bool* exist) const;
 
+    // select the row ranges of row group by min/max conjuncts on the page index(ColumnIndex and OffsetIndex)
+    // return false if there is no page index can be used
+    StatusOr<bool> _select_row_ranges(const tparquet::RowGroup& row_group, vectorized::SparseRange* row_ranges) const;
+
+    // select the row ranges of the pages of a column chunk by min/max conjuncts on the column
+    // return false if the page index of the column chunk can not be used
+    StatusOr<bool> _select_column_row_ranges(const tparquet::RowGroup& row_group, const SlotDescriptor* slot,
+                                             const std::vector<ExprContext*>& conjunct_ctxs,
+                                             vectorized::SparseRange* row_ranges) const;
+
     Status _get_next_internal(vectorized::ChunkPtr* chunk);
 
     // only scan partition column + not exist column
@@ -96,10 +111,19 @@ private:
     // get the data page start offset in parquet file
     static int64_t _get_row_group_start_offset(const tparquet::RowGroup& row_group);
 
+    // read the column chunks of the row group to read next into the shared buffers
+    Status _load_row_group_io_ranges();
+
     RandomAccessFile* _file;
+    // _file is replaced by a file on _shared_buffered_stream if the reads are coalesced
+    std::shared_ptr<SharedBufferedInputStream> _shared_buffered_stream;
+    std::unique_ptr<RandomAccessFile> _shared_buffered_file;
+    // the row group whose column chunks are loaded into _shared_buffered_stream, -1 if none
+    int64_t _loaded_row_group_idx = -1;
     uint64_t _file_size;
 
-    std::shared_ptr<FileMetaData> _file_metadata;
+    // shared with the other readers of the file if it is in the FooterCache
+    std::shared_ptr<const FileMetaData> _file_metadata;
     vector<std::shared_ptr<GroupReader>> _row_group_readers;
     size_t _cur_row_group_idx = 0;
     size_t _row_group_size = 0;
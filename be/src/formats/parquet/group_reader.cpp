@@ -4,6 +4,7 @@
 #include "formats/parquet/group_reader.h"
 
 #include "column/column_helper.h"
+#include "common/config.h"
 #include "exec/exec_node.h"
 #include "exec/vectorized/hdfs_scanner.h"
 #include "exprs/expr.h"
@@ -16,7 +17,8 @@ namespace starrocks::parquet {
 constexpr static const PrimitiveType kDictCodePrimitiveType = TYPE_INT;
 constexpr static const FieldType kDictCodeFieldType = OLAP_FIELD_TYPE_INT;
 
-GroupReader::GroupReader(int chunk_size, RandomAccessFile* file, FileMetaData* file_metadata, int row_group_number)
+GroupReader::GroupReader(int chunk_size, RandomAccessFile* file, const FileMetaData* file_metadata,
+                         int row_group_number)
         : _chunk_size(chunk_size), _file(file), _file_metadata(file_metadata), _row_group_number(row_group_number) {
     _row_group_metadata =
             std::make_shared<tparquet::RowGroup>(_file_metadata->t_metadata().row_groups[row_group_number]);
@@ -29,6 +31,7 @@ Status GroupReader::init(const GroupReaderParam& param) {
     _pre_process_columns_and_conjunct_ctxs();
     RETURN_IF_ERROR(_rewrite_dict_column_predicates());
     _init_read_chunk();
+    _init_row_ranges();
     return Status::OK();
 }
 
@@ -46,27 +49,47 @@ Status GroupReader::get_next(vectorized::ChunkPtr* chunk, size_t* row_count) {
 
     {
         SCOPED_RAW_TIMER(&_param.stats->group_chunk_read_ns);
+        if (_use_row_ranges) {
+            if (!_row_range_iter.has_more()) {
+                *row_count = 0;
+                return Status::EndOfFile("");
+            }
+            // read the rows of next range up to count
+            vectorized::Range range = _row_range_iter.next(count);
+            RETURN_IF_ERROR(_skip(range.begin() - _next_row));
+            count = range.span_size();
+            _next_row = range.end();
+        }
         // read data into _read_chunk
         status = _read(&count);
         _param.stats->raw_rows_read += count;
         if (!status.ok() && !status.is_end_of_file()) {
             return status;
         }
+        if (_use_row_ranges && !_row_range_iter.has_more()) {
+            status = Status::EndOfFile("");
+        }
     }
 
-    // dict filter
-    if (has_dict_filter) {
-        SCOPED_RAW_TIMER(&_param.stats->expr_filter_ns);
-        SCOPED_RAW_TIMER(&_param.stats->group_dict_filter_ns);
-        _dict_filter();
+    if (!_lazy_read_columns.empty()) {
+        // filter the active columns, then read the lazy read columns of the selected rows
+        RETURN_IF_ERROR(_filter_and_read_lazy_columns(count));
         _read_chunk->check_or_die();
-    }
+    } else {
+        // dict filter
+        if (has_dict_filter) {
+            SCOPED_RAW_TIMER(&_param.stats->expr_filter_ns);
+            SCOPED_RAW_TIMER(&_param.stats->group_dict_filter_ns);
+            _dict_filter();
+            _read_chunk->check_or_die();
+        }
 
-    // other filter that not dict
-    if (has_more_filter) {
-        SCOPED_RAW_TIMER(&_param.stats->expr_filter_ns);
-        RETURN_IF_ERROR(ExecNode::eval_conjuncts(_left_conjunct_ctxs, _read_chunk.get()));
-        _read_chunk->check_or_die();
+        // other filter that not dict
+        if (has_more_filter) {
+            SCOPED_RAW_TIMER(&_param.stats->expr_filter_ns);
+            RETURN_IF_ERROR(ExecNode::eval_conjuncts(_left_conjunct_ctxs, _read_chunk.get()));
+            _read_chunk->check_or_die();
+        }
     }
 
     *row_count = _read_chunk->num_rows();
@@ -78,6 +101,30 @@ Status GroupReader::get_next(vectorized::ChunkPtr* chunk, size_t* row_count) {
     return status;
 }
 
+void GroupReader::collect_io_ranges(std::vector<SharedBufferedInputStream::IORange>* ranges) const {
+    if (_is_group_filtered) {
+        return;
+    }
+    for (const auto& column : _param.read_cols) {
+        _collect_field_io_ranges(*_file_metadata->schema().get_stored_column_by_idx(column.col_idx_in_parquet), ranges);
+    }
+}
+
+void GroupReader::_collect_field_io_ranges(const ParquetField& field,
+                                           std::vector<SharedBufferedInputStream::IORange>* ranges) const {
+    if (!field.children.empty()) {
+        for (const auto& child : field.children) {
+            _collect_field_io_ranges(child, ranges);
+        }
+        return;
+    }
+    // the same range as the ColumnChunkReader
+    const auto& column_meta = _row_group_metadata->columns[field.physical_column_index].meta_data;
+    int64_t offset = column_meta.__isset.dictionary_page_offset ? column_meta.dictionary_page_offset
+                                                                  : column_meta.data_page_offset;
+    ranges->push_back({offset, column_meta.total_compressed_size});
+}
+
 Status GroupReader::_init_column_readers() {
     for (const auto& column : _param.read_cols) {
         RETURN_IF_ERROR(_create_column_reader(column));
@@ -121,6 +168,21 @@ void GroupReader::_pre_process_columns_and_conjunct_ctxs() {
             }
         }
     }
+
+    // late materialization: the direct read columns without conjuncts are read after the conjuncts are evaluated
+    if (!config::parquet_late_materialization_enable || (_dict_filter_columns.empty() && _left_conjunct_ctxs.empty()) ||
+        !_can_skip_rows()) {
+        return;
+    }
+    std::vector<GroupReaderParam::Column> active_columns;
+    for (const auto& column : _direct_read_columns) {
+        if (conjunct_ctxs_by_slot.find(column.slot_id) != conjunct_ctxs_by_slot.end()) {
+            active_columns.emplace_back(column);
+        } else {
+            _lazy_read_columns.emplace_back(column);
+        }
+    }
+    _direct_read_columns.swap(active_columns);
 }
 
 bool GroupReader::_can_using_dict_filter(const SlotDescriptor* slot, const SlotIdExprContextsMap& conjunct_ctxs_by_slot,
@@ -275,6 +337,17 @@ void GroupReader::_init_read_chunk() {
         dict_code_column->reserve(chunk_size);
         _read_chunk->update_column(dict_code_column, slot_id);
     }
+
+    // the active chunk shares the columns read before the lazy read columns with _read_chunk
+    if (!_lazy_read_columns.empty()) {
+        _active_chunk = std::make_shared<vectorized::Chunk>();
+        for (const auto& column : _dict_filter_columns) {
+            _active_chunk->append_column(_read_chunk->get_column_by_slot_id(column.slot_id), column.slot_id);
+        }
+        for (const auto& column : _direct_read_columns) {
+            _active_chunk->append_column(_read_chunk->get_column_by_slot_id(column.slot_id), column.slot_id);
+        }
+    }
 }
 
 Status GroupReader::_read(size_t* row_count) {
@@ -309,10 +382,118 @@ Status GroupReader::_read(size_t* row_count) {
     return Status::OK();
 }
 
-void GroupReader::_dict_filter() {
+bool GroupReader::_can_skip_rows() const {
+    // only the columns not repeated support skipping
+    for (const auto& column : _param.read_cols) {
+        const auto* schema_node = _file_metadata->schema().get_stored_column_by_idx(column.col_idx_in_parquet);
+        if (schema_node->max_rep_level() > 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void GroupReader::_init_row_ranges() {
+    if (_is_group_filtered || !_param.use_row_ranges || !_can_skip_rows()) {
+        return;
+    }
+    if (_param.row_ranges.empty()) {
+        _is_group_filtered = true;
+        return;
+    }
+    _use_row_ranges = true;
+    _row_range_iter = _param.row_ranges.new_iterator();
+}
+
+Status GroupReader::_skip(size_t num_rows) {
+    if (num_rows == 0) {
+        return Status::OK();
+    }
+    for (const auto& column : _dict_filter_columns) {
+        SlotId slot_id = column.slot_id;
+        RETURN_IF_ERROR(_column_readers[slot_id]->skip_batch(num_rows, ColumnContentType::DICT_CODE,
+                                                             _read_chunk->get_column_by_slot_id(slot_id).get()));
+    }
+    for (const auto& column : _direct_read_columns) {
+        SlotId slot_id = column.slot_id;
+        RETURN_IF_ERROR(_column_readers[slot_id]->skip_batch(num_rows, ColumnContentType::VALUE,
+                                                             _read_chunk->get_column_by_slot_id(slot_id).get()));
+    }
+    for (const auto& column : _lazy_read_columns) {
+        SlotId slot_id = column.slot_id;
+        RETURN_IF_ERROR(_column_readers[slot_id]->skip_batch(num_rows, ColumnContentType::VALUE,
+                                                             _read_chunk->get_column_by_slot_id(slot_id).get()));
+    }
+    _read_chunk->reset();
+    _param.stats->page_skip_rows += num_rows;
+    return Status::OK();
+}
+
+Status GroupReader::_filter_and_read_lazy_columns(size_t count) {
+    if (count == 0) {
+        return Status::OK();
+    }
+    size_t hit_count = count;
+    raw::stl_vector_resize_uninitialized(&_selection, count);
+    {
+        SCOPED_RAW_TIMER(&_param.stats->expr_filter_ns);
+        if (!_dict_filter_preds.empty()) {
+            SCOPED_RAW_TIMER(&_param.stats->group_dict_filter_ns);
+            hit_count = _eval_dict_filter(count);
+        } else {
+            memset(_selection.data(), 1, count);
+        }
+        if (hit_count > 0 && !_left_conjunct_ctxs.empty()) {
+            ASSIGN_OR_RETURN(hit_count, ExecNode::eval_conjuncts_into_filter(_left_conjunct_ctxs, _active_chunk.get(),
+                                                                             &_selection));
+        }
+        if (hit_count == 0) {
+            _active_chunk->set_num_rows(0);
+        } else if (hit_count != count) {
+            _active_chunk->filter_range(_selection, 0, count);
+        }
+    }
+
+    SCOPED_RAW_TIMER(&_param.stats->group_chunk_read_ns);
+    _param.stats->late_materialize_skip_rows += count - hit_count;
+    for (const auto& column : _lazy_read_columns) {
+        SlotId slot_id = column.slot_id;
+        ColumnReader* reader = _column_readers[slot_id].get();
+        vectorized::Column* dst = _read_chunk->get_column_by_slot_id(slot_id).get();
+        if (hit_count == 0) {
+            RETURN_IF_ERROR(reader->skip_batch(count, ColumnContentType::VALUE, dst));
+            dst->reset_column();
+            continue;
+        }
+        // read the runs of selected rows and skip the others
+        vectorized::ColumnPtr scratch;
+        size_t i = 0;
+        while (i < count) {
+            size_t j = i + 1;
+            while (j < count && _selection[j] == _selection[i]) {
+                j++;
+            }
+            size_t num_rows = j - i;
+            if (_selection[i]) {
+                Status status = reader->next_batch(&num_rows, ColumnContentType::VALUE, dst);
+                if (!status.ok() && !status.is_end_of_file()) {
+                    return status;
+                }
+            } else {
+                if (scratch == nullptr) {
+                    scratch = dst->clone_empty();
+                }
+                RETURN_IF_ERROR(reader->skip_batch(num_rows, ColumnContentType::VALUE, scratch.get()));
+            }
+            i = j;
+        }
+    }
+    return Status::OK();
+}
+
+size_t GroupReader::_eval_dict_filter(size_t count) {
     DCHECK(!_dict_filter_preds.empty());
 
-    size_t count = _read_chunk->num_rows();
     auto iter = _dict_filter_preds.begin();
     SlotId slot_id = iter->first;
     auto pred = iter->second;
@@ -322,8 +503,12 @@ void GroupReader::_dict_filter() {
         pred = iter->second;
         pred->evaluate_and(_read_chunk->get_column_by_slot_id(slot_id).get(), _selection.data());
     }
+    return SIMD::count_nonzero(_selection.data(), count);
+}
 
-    auto hit_count = SIMD::count_nonzero(_selection.data(), count);
+void GroupReader::_dict_filter() {
+    size_t count = _read_chunk->num_rows();
+    auto hit_count = _eval_dict_filter(count);
     if (hit_count == 0) {
         _read_chunk->set_num_rows(0);
     } else if (hit_count != count) {
@@ -360,6 +545,10 @@ Status GroupReader::_dict_decode(vectorized::ChunkPtr* chunk) {
         SlotId slot_id = column.slot_id;
         (*chunk)->get_column_by_slot_id(slot_id)->swap_column(*(_read_chunk->get_column_by_slot_id(slot_id)));
     }
+    for (const auto& column : _lazy_read_columns) {
+        SlotId slot_id = column.slot_id;
+        (*chunk)->get_column_by_slot_id(slot_id)->swap_column(*(_read_chunk->get_column_by_slot_id(slot_id)));
+    }
     return Status::OK();
 }
 } // namespace starrocks::parquet
\ No newline at end of file
@@ -6,9 +6,11 @@
 #include "column/vectorized_fwd.h"
 #include "formats/parquet/column_reader.h"
 #include "formats/parquet/metadata.h"
+#include "formats/parquet/shared_buffered_input_stream.h"
 #include "gen_cpp/parquet_types.h"
 #include "runtime/descriptors.h"
 #include "runtime/runtime_state.h"
+#include "storage/range.h"
 #include "storage/vectorized_column_predicate.h"
 #include "util/runtime_profile.h"
 
@@ -48,20 +50,30 @@ struct GroupReaderParam {
 
     std::string timezone;
 
+    // If use_row_ranges is true, only the rows in row_ranges may satisfy the conjuncts, and the other rows
+    // of the row group are skipped. row_ranges is selected by the page index of the row group.
+    bool use_row_ranges = false;
+    vectorized::SparseRange row_ranges;
+
     vectorized::HdfsScanStats* stats = nullptr;
 };
 
 class GroupReader {
 public:
-    GroupReader(int chunk_size, RandomAccessFile* file, FileMetaData* file_metadata, int row_group_number);
+    GroupReader(int chunk_size, RandomAccessFile* file, const FileMetaData* file_metadata, int row_group_number);
     ~GroupReader() = default;
 
     Status init(const GroupReaderParam& _param);
     Status get_next(vectorized::ChunkPtr* chunk, size_t* row_count);
 
+    // Collect the byte ranges of the column chunks to read, nothing if the row group is filtered.
+    void collect_io_ranges(std::vector<SharedBufferedInputStream::IORange>* ranges) const;
+
 private:
     using SlotIdExprContextsMap = std::unordered_map<int, std::vector<ExprContext*>>;
 
+    void _collect_field_io_ranges(const ParquetField& field,
+                                  std::vector<SharedBufferedInputStream::IORange>* ranges) const;
     Status _init_column_readers();
     Status _create_column_reader(const GroupReaderParam::Column& column);
     // Extract dict filter columns and conjuncts
@@ -72,8 +84,17 @@ private:
     bool _column_all_pages_dict_encoded(const tparquet::ColumnMetaData& column_metadata);
     Status _rewrite_dict_column_predicates();
     void _init_read_chunk();
+    void _init_row_ranges();
+    // whether all the column readers support skip_batch
+    bool _can_skip_rows() const;
 
     Status _read(size_t* row_count);
+    // evaluate the conjuncts on the active columns, and read the lazy read columns of the selected rows
+    Status _filter_and_read_lazy_columns(size_t count);
+    // skip num_rows rows of all columns
+    Status _skip(size_t num_rows);
+    // evaluate dict filter preds on count rows into _selection, return the number of selected rows
+    size_t _eval_dict_filter(size_t count);
     void _dict_filter();
     Status _dict_decode(vectorized::ChunkPtr* chunk);
 
@@ -82,7 +103,7 @@ private:
     RandomAccessFile* _file;
 
     // parquet file meta
-    FileMetaData* _file_metadata;
+    const FileMetaData* _file_metadata;
 
     // row group number in parquet file
     int _row_group_number;
@@ -103,11 +124,22 @@ private:
     std::vector<GroupReaderParam::Column> _dict_filter_columns;
     // direct read conlumns
     std::vector<GroupReaderParam::Column> _direct_read_columns;
+    // direct read columns without conjuncts, they are read after the conjuncts are evaluated on the other columns,
+    // so only the selected rows are decoded.
+    std::vector<GroupReaderParam::Column> _lazy_read_columns;
 
     // dict value is empty after conjunct eval, file group can be skipped
     bool _is_group_filtered = false;
 
+    // only read the rows in row ranges, see GroupReaderParam::row_ranges
+    bool _use_row_ranges = false;
+    vectorized::SparseRangeIterator _row_range_iter;
+    // the rows of row group have been read or skipped
+    size_t _next_row = 0;
+
     vectorized::ChunkPtr _read_chunk;
+    // the columns of _read_chunk except the lazy read columns, used to evaluate the conjuncts
+    vectorized::ChunkPtr _active_chunk;
     vectorized::Buffer<uint8_t> _selection;
 
     // param for read row group
@@ -0,0 +1,101 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "formats/parquet/shared_buffered_input_stream.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "common/logging.h"
+#include "exec/vectorized/hdfs_scanner.h"
+#include "gutil/strings/substitute.h"
+#include "util/runtime_profile.h"
+
+namespace starrocks::parquet {
+
+Status SharedBufferedInputStream::set_io_ranges(std::vector<IORange> ranges) {
+    _buffers.clear();
+    std::sort(ranges.begin(), ranges.end(),
+              [](const IORange& lhs, const IORange& rhs) { return lhs.offset < rhs.offset; });
+
+    for (const IORange& range : ranges) {
+        if (range.size <= 0 || range.size > _max_buffer_bytes) {
+            continue;
+        }
+        if (!_buffers.empty()) {
+            SharedBuffer& last = _buffers.back();
+            const int64_t end = last.offset + last.size;
+            const int64_t new_end = std::max(end, range.offset + range.size);
+            if (range.offset <= end + _max_gap && new_end - last.offset <= _max_buffer_bytes) {
+                last.size = new_end - last.offset;
+                continue;
+            }
+        }
+        SharedBuffer& buffer = _buffers.emplace_back();
+        buffer.offset = range.offset;
+        buffer.size = range.size;
+    }
+
+    if (_buffers.size() > 1) {
+        // the first buffer is read right away.
+        for (size_t i = 1; i < _buffers.size(); i++) {
+            auto st = _stream->prefetch(_buffers[i].offset, _buffers[i].size);
+            LOG_IF(WARNING, !st.ok()) << "Fail to prefetch parquet file: " << st;
+        }
+    }
+    for (SharedBuffer& buffer : _buffers) {
+        buffer.data.reset(new char[buffer.size]);
+        SCOPED_RAW_TIMER(&_stats->shared_io_ns);
+        RETURN_IF_ERROR(_stream->read_at_fully(buffer.offset, buffer.data.get(), buffer.size));
+        _stats->shared_io_bytes += buffer.size;
+        _stats->shared_io_count++;
+    }
+    return Status::OK();
+}
+
+const SharedBufferedInputStream::SharedBuffer* SharedBufferedInputStream::_find_buffer(int64_t offset,
+                                                                                      int64_t count) const {
+    auto iter = std::upper_bound(_buffers.begin(), _buffers.end(), offset,
+                                 [](int64_t off, const SharedBuffer& b) { return off < b.offset; });
+    if (iter == _buffers.begin()) {
+        return nullptr;
+    }
+    --iter;
+    if (offset + count > iter->offset + iter->size) {
+        return nullptr;
+    }
+    return &(*iter);
+}
+
+StatusOr<int64_t> SharedBufferedInputStream::read(void* data, int64_t count) {
+    ASSIGN_OR_RETURN(auto nread, read_at(_offset, data, count));
+    _offset += nread;
+    return nread;
+}
+
+StatusOr<int64_t> SharedBufferedInputStream::read_at(int64_t offset, void* out, int64_t count) {
+    const SharedBuffer* buffer = _find_buffer(offset, count);
+    if (buffer == nullptr) {
+        return _stream->read_at(offset, out, count);
+    }
+    memcpy(out, buffer->data.get() + (offset - buffer->offset), count);
+    return count;
+}
+
+Status SharedBufferedInputStream::read_at_fully(int64_t offset, void* out, int64_t count) {
+    const SharedBuffer* buffer = _find_buffer(offset, count);
+    if (buffer == nullptr) {
+        return _stream->read_at_fully(offset, out, count);
+    }
+    memcpy(out, buffer->data.get() + (offset - buffer->offset), count);
+    return Status::OK();
+}
+
+Status SharedBufferedInputStream::seek(int64_t offset) {
+    if (offset < 0) {
+        return Status::InvalidArgument(strings::Substitute("Invalid offset $0", offset));
+    }
+    _offset = offset;
+    return Status::OK();
+}
+
+} // namespace starrocks::parquet
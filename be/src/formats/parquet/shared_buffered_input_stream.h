@@ -0,0 +1,74 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "io/seekable_input_stream.h"
+
+namespace starrocks::vectorized {
+struct HdfsScanStats;
+} // namespace starrocks::vectorized
+
+namespace starrocks::parquet {
+
+// SharedBufferedInputStream serves the reads of a parquet file from the shared buffers of the byte ranges to be read
+// next, e.g. the column chunks of a row group. The ranges are sorted by their offsets, and the ranges whose gaps are at
+// most `max_gap` bytes are merged into a buffer of at most `max_buffer_bytes` bytes, which is read in one IO. So the
+// column readers of a row group on the object storage are served by a few large ranged reads instead of a small read
+// after another of each column. The reads out of the buffers go to the underlying stream.
+// Not thread-safe.
+class SharedBufferedInputStream final : public io::SeekableInputStream {
+public:
+    struct IORange {
+        int64_t offset = 0;
+        int64_t size = 0;
+    };
+
+    SharedBufferedInputStream(std::shared_ptr<io::SeekableInputStream> stream, int64_t max_gap,
+                              int64_t max_buffer_bytes, vectorized::HdfsScanStats* stats)
+            : _stream(std::move(stream)), _max_gap(max_gap), _max_buffer_bytes(max_buffer_bytes), _stats(stats) {}
+
+    ~SharedBufferedInputStream() override = default;
+
+    // Read |ranges| into the shared buffers in a few IOs. The buffers loaded before are released.
+    // The ranges larger than `max_buffer_bytes` are left to be read from the underlying stream.
+    Status set_io_ranges(std::vector<IORange> ranges);
+
+    void release() { _buffers.clear(); }
+
+    StatusOr<int64_t> read(void* data, int64_t count) override;
+
+    StatusOr<int64_t> read_at(int64_t offset, void* out, int64_t count) override;
+
+    Status read_at_fully(int64_t offset, void* out, int64_t count) override;
+
+    Status seek(int64_t offset) override;
+
+    StatusOr<int64_t> position() override { return _offset; }
+
+    StatusOr<int64_t> get_size() override { return _stream->get_size(); }
+
+    Status prefetch(int64_t offset, int64_t count) override { return _stream->prefetch(offset, count); }
+
+private:
+    struct SharedBuffer {
+        int64_t offset = 0;
+        int64_t size = 0;
+        std::unique_ptr<char[]> data;
+    };
+
+    // Return the buffer containing [offset, offset + count), or nullptr if there is none.
+    const SharedBuffer* _find_buffer(int64_t offset, int64_t count) const;
+
+    std::shared_ptr<io::SeekableInputStream> _stream;
+    const int64_t _max_gap;
+    const int64_t _max_buffer_bytes;
+    vectorized::HdfsScanStats* _stats;
+    // sorted by offset
+    std::vector<SharedBuffer> _buffers;
+    int64_t _offset = 0;
+};
+
+} // namespace starrocks::parquet
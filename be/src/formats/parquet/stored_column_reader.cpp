@@ -7,6 +7,8 @@
 #include "column/column.h"
 #include "exec/vectorized/hdfs_scanner.h"
 #include "formats/parquet/types.h"
+#include "simd/simd.h"
+#include "util/raw_container.h"
 #include "util/runtime_profile.h"
 
 namespace starrocks::parquet {
@@ -96,6 +98,18 @@ public:
         }
     }
 
+    Status skip_records(size_t num_records, ColumnContentType content_type, vectorized::Column* scratch) override {
+        if (_eof) {
+            return Status::EndOfFile("");
+        }
+        // the levels decoded ahead are not skipped
+        if (_needs_levels) {
+            return Status::NotSupported("skip_records is not supported when levels are needed");
+        }
+        SCOPED_RAW_TIMER(&_opts.stats->column_read_ns);
+        return _skip_records(num_records, content_type, scratch, &_num_values_left_in_cur_page);
+    }
+
     void set_needs_levels(bool needs_levels) override { _needs_levels = needs_levels; }
 
     void get_levels(level_t** def_levels, level_t** rep_levels, size_t* num_levels) override {
@@ -107,6 +121,10 @@ public:
         *num_levels = 0;
     }
 
+protected:
+    Status _skip_records_in_cur_page(size_t num_records, ColumnContentType content_type,
+                                     vectorized::Column* scratch) override;
+
 private:
     Status _next_page();
 
@@ -155,12 +173,22 @@ public:
 
     Status read_records(size_t* num_rows, ColumnContentType content_type, vectorized::Column* dst) override;
 
+    Status skip_records(size_t num_records, ColumnContentType content_type, vectorized::Column* scratch) override {
+        return _skip_records(num_records, content_type, scratch, &_num_values_left_in_cur_page);
+    }
+
     void get_levels(level_t** def_levels, level_t** rep_levels, size_t* num_levels) override {
         *def_levels = nullptr;
         *rep_levels = nullptr;
         *num_levels = 0;
     }
 
+protected:
+    Status _skip_records_in_cur_page(size_t num_records, ColumnContentType content_type,
+                                     vectorized::Column* scratch) override {
+        return _reader->skip_values(num_records, content_type, scratch);
+    }
+
 private:
     Status _next_page();
 
@@ -413,20 +441,19 @@ Status OptionalStoredColumnReader::_read_records_only(size_t* num_records, Colum
             }
 
             SCOPED_RAW_TIMER(&_opts.stats->value_decode_ns);
-            size_t i = 0;
-            while (i < records_to_read) {
-                size_t j = i;
-                bool is_null = _def_levels[j] < _field->max_def_level();
-                j++;
-                while (j < records_to_read && is_null == (_def_levels[j] < _field->max_def_level())) {
-                    j++;
-                }
-                if (is_null) {
-                    dst->append_nulls(j - i);
-                } else {
-                    RETURN_IF_ERROR(_reader->decode_values(j - i, content_type, dst));
-                }
-                i = j;
+            // convert the levels to the null map without branches, and decode the values by it
+            raw::stl_vector_resize_uninitialized(&_is_nulls, records_to_read);
+            level_t max_def_level = _field->max_def_level();
+            for (size_t i = 0; i < records_to_read; ++i) {
+                _is_nulls[i] = _def_levels[i] < max_def_level;
+            }
+            size_t num_nulls = SIMD::count_nonzero(_is_nulls.data(), records_to_read);
+            if (num_nulls == 0) {
+                RETURN_IF_ERROR(_reader->decode_values(records_to_read, content_type, dst));
+            } else if (num_nulls == records_to_read) {
+                dst->append_nulls(records_to_read);
+            } else {
+                RETURN_IF_ERROR(_reader->decode_values(records_to_read, _is_nulls.data(), content_type, dst));
             }
         }
 
@@ -437,6 +464,32 @@ Status OptionalStoredColumnReader::_read_records_only(size_t* num_records, Colum
     return Status::OK();
 }
 
+Status OptionalStoredColumnReader::_skip_records_in_cur_page(size_t num_records, ColumnContentType content_type,
+                                                             vectorized::Column* scratch) {
+    // decode the levels to count the not null values to skip
+    size_t new_capacity = num_records;
+    if (new_capacity > _levels_capacity) {
+        new_capacity = BitUtil::next_power_of_two(new_capacity);
+        _def_levels.resize(new_capacity);
+
+        _levels_capacity = new_capacity;
+    }
+    {
+        SCOPED_RAW_TIMER(&_opts.stats->level_decode_ns);
+        _reader->decode_def_levels(num_records, &_def_levels[0]);
+    }
+
+    size_t num_values = 0;
+    for (size_t i = 0; i < num_records; ++i) {
+        num_values += _def_levels[i] >= _field->max_def_level();
+    }
+    if (num_values == 0) {
+        return Status::OK();
+    }
+    SCOPED_RAW_TIMER(&_opts.stats->value_decode_ns);
+    return _reader->skip_values(num_values, content_type, scratch);
+}
+
 Status OptionalStoredColumnReader::_next_page() {
     do {
         RETURN_IF_ERROR(_reader->next_page());
@@ -498,6 +551,31 @@ Status RequiredStoredColumnReader::_next_page() {
     return Status::OK();
 }
 
+Status StoredColumnReader::_skip_records(size_t num_records, ColumnContentType content_type,
+                                         vectorized::Column* scratch, size_t* num_values_left_in_cur_page) {
+    while (num_records > 0) {
+        if (*num_values_left_in_cur_page == 0) {
+            RETURN_IF_ERROR(_reader->next_header());
+            const auto* header = _reader->current_page_header();
+            if (header->type == tparquet::PageType::DATA_PAGE) {
+                auto num_values = static_cast<size_t>(header->data_page_header.num_values);
+                if (num_values <= num_records) {
+                    RETURN_IF_ERROR(_reader->skip_page());
+                    num_records -= num_values;
+                    continue;
+                }
+            }
+            RETURN_IF_ERROR(_reader->load_page());
+            *num_values_left_in_cur_page = _reader->num_values();
+        }
+        size_t records_to_skip = std::min(num_records, *num_values_left_in_cur_page);
+        RETURN_IF_ERROR(_skip_records_in_cur_page(records_to_skip, content_type, scratch));
+        *num_values_left_in_cur_page -= records_to_skip;
+        num_records -= records_to_skip;
+    }
+    return Status::OK();
+}
+
 Status StoredColumnReader::create(RandomAccessFile* file, const ParquetField* field,
                                   const tparquet::ColumnChunk* chunk_metadata, const StoredColumnReaderOptions& opts,
                                   int chunk_size, std::unique_ptr<StoredColumnReader>* out) {
@@ -54,6 +54,12 @@ public:
     // levels for last read_values.
     virtual void get_levels(level_t** def_levels, level_t** rep_levels, size_t* num_levels) = 0;
 
+    // Skip num_records records. The pages entirely skipped are neither read nor decoded, the values of
+    // the other skipped records are decoded into 'scratch', whose content is undefined after the call.
+    virtual Status skip_records(size_t num_records, ColumnContentType content_type, vectorized::Column* scratch) {
+        return Status::NotSupported("skip_records is not supported");
+    }
+
     virtual Status get_dict_values(vectorized::Column* column) { return _reader->get_dict_values(column); }
 
     virtual Status get_dict_values(const std::vector<int32_t>& dict_codes, vectorized::Column* column) {
@@ -65,6 +71,16 @@ public:
     }
 
 protected:
+    // Implement skip_records for the readers whose fields are not repeated, so one value is one record.
+    Status _skip_records(size_t num_records, ColumnContentType content_type, vectorized::Column* scratch,
+                         size_t* num_values_left_in_cur_page);
+
+    // Skip num_records records in current page, which must have enough values.
+    virtual Status _skip_records_in_cur_page(size_t num_records, ColumnContentType content_type,
+                                             vectorized::Column* scratch) {
+        return Status::NotSupported("skip_records is not supported");
+    }
+
     std::unique_ptr<ColumnChunkReader> _reader;
 };
 
@@ -184,6 +184,9 @@ struct WritableFileOptions {
     bool sync_on_close = true;
     // See OpenMode for details.
     FileSystem::OpenMode mode = FileSystem::MUST_CREATE;
+    // Write the file by direct I/O if it is under one of `direct_io_write_storage_paths`. Only the posix file system
+    // supports it, which falls back to the buffered writes if O_DIRECT is rejected. The file must be new.
+    bool direct_io = false;
 };
 
 // A `SequentialFile` is an `io::InputStream` with a name.
@@ -5,11 +5,14 @@
 #include <fmt/format.h>
 #include <hdfs/hdfs.h>
 
+#include <algorithm>
 #include <atomic>
 
+#include "io/io_profiler.h"
 #include "runtime/hdfs/hdfs_fs_cache.h"
 #include "udf/java/utils.h"
 #include "util/hdfs_util.h"
+#include "util/stopwatch.hpp"
 
 namespace starrocks {
 
@@ -37,6 +40,10 @@ private:
     std::string _file_name;
     int64_t _offset;
     int64_t _file_size;
+    // the latencies of the preads, to find the reads stalled by the straggling datanodes
+    int64_t _read_count = 0;
+    int64_t _read_ns = 0;
+    int64_t _max_read_ns = 0;
 };
 
 HdfsInputStream::~HdfsInputStream() {
@@ -56,10 +63,17 @@ StatusOr<int64_t> HdfsInputStream::read(void* data, int64_t size) {
     if (UNLIKELY(size > std::numeric_limits<tSize>::max())) {
         size = std::numeric_limits<tSize>::max();
     }
+    MonotonicStopWatch watch;
+    watch.start();
     tSize r = hdfsPread(_fs, _file, _offset, data, static_cast<tSize>(size));
+    int64_t read_ns = watch.elapsed_time();
+    _read_count++;
+    _read_ns += read_ns;
+    _max_read_ns = std::max(_max_read_ns, read_ns);
     if (r == -1) {
         return Status::IOError(fmt::format("fail to hdfsPread {}: {}", _file_name, get_hdfs_err_msg()));
     }
+    io::IOProfiler::record_read(io::IO_TIER_REMOTE, r, read_ns);
     _offset += r;
     return r;
 }
@@ -94,12 +108,15 @@ StatusOr<std::unique_ptr<io::NumericStatistics>> HdfsInputStream::get_numeric_st
         struct hdfsReadStatistics* hdfs_statistics = nullptr;
         auto r = hdfsFileGetReadStatistics(_file, &hdfs_statistics);
         if (r != 0) return Status::InternalError(fmt::format("hdfsFileGetReadStatistics failed: {}", r));
-        stats->reserve(4);
+        stats->reserve(7);
         stats->append("TotalBytesRead", hdfs_statistics->totalBytesRead);
         stats->append("TotalLocalBytesRead", hdfs_statistics->totalLocalBytesRead);
         stats->append("TotalShortCircuitBytesRead", hdfs_statistics->totalShortCircuitBytesRead);
         stats->append("TotalZeroCopyBytesRead", hdfs_statistics->totalZeroCopyBytesRead);
         hdfsFileFreeReadStatistics(hdfs_statistics);
+        stats->append("ReadCount", _read_count);
+        stats->append("ReadTimeNs", _read_ns);
+        stats->append("MaxReadTimeNs", _max_read_ns);
         return Status::OK();
     });
     Status st = ret->get_future().get();
@@ -16,8 +16,11 @@
 #include <unistd.h>
 
 #include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <filesystem>
 #include <memory>
+#include <new>
 
 #include "common/config.h"
 #include "common/logging.h"
@@ -26,9 +29,11 @@
 #include "gutil/gscoped_ptr.h"
 #include "gutil/macros.h"
 #include "gutil/port.h"
+#include "gutil/strings/split.h"
 #include "gutil/strings/substitute.h"
 #include "gutil/strings/util.h"
 #include "io/fd_input_stream.h"
+#include "io/mmap_input_stream.h"
 #include "util/errno.h"
 #include "util/slice.h"
 
@@ -69,6 +74,28 @@ inline bool enable_fd_cache(std::string_view path) {
     return HasSuffixString(path, ".dat");
 }
 
+// Whether |path| is under one of |roots|, which are separated by ';'.
+static bool is_under_storage_paths(std::string_view path, const std::string& roots) {
+    for (const auto& root : strings::Split(roots, ";", strings::SkipWhitespace())) {
+        if (HasPrefixString(path, root)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Whether |path| is a segment file under one of `mmap_read_storage_paths`.
+static bool enable_mmap_read(std::string_view path) {
+    return !config::mmap_read_storage_paths.empty() && enable_fd_cache(path) &&
+           is_under_storage_paths(path, config::mmap_read_storage_paths);
+}
+
+// Whether the new file |path| can be written by direct I/O with |opts|.
+static bool enable_direct_io_write(const WritableFileOptions& opts, std::string_view path) {
+    return opts.direct_io && opts.mode != FileSystem::MUST_EXIST && !config::direct_io_write_storage_paths.empty() &&
+           is_under_storage_paths(path, config::direct_io_write_storage_paths);
+}
+
 static Status io_error(const std::string& context, int err_number) {
     switch (err_number) {
     case 0:
@@ -170,14 +197,29 @@ static Status do_writev_at(int fd, const string& filename, uint64_t offset, cons
 
 class PosixWritableFile : public WritableFile {
 public:
-    PosixWritableFile(std::string filename, int fd, uint64_t filesize, bool sync_on_close)
-            : _filename(std::move(filename)), _fd(fd), _sync_on_close(sync_on_close), _filesize(filesize) {}
+    // The offsets, lengths and buffers of O_DIRECT must be aligned to the logical block size of the disk.
+    static constexpr size_t kDirectIOAlignment = 4096;
+    static constexpr size_t kDirectIOBufferSize = 1024 * 1024;
+
+    PosixWritableFile(std::string filename, int fd, uint64_t filesize, bool sync_on_close, bool direct_io = false)
+            : _filename(std::move(filename)), _fd(fd), _sync_on_close(sync_on_close), _filesize(filesize) {
+        if (direct_io) {
+            DCHECK_EQ(0, filesize);
+            _direct_buffer.reset(static_cast<char*>(std::aligned_alloc(kDirectIOAlignment, kDirectIOBufferSize)));
+            if (_direct_buffer == nullptr) {
+                throw std::bad_alloc();
+            }
+        }
+    }
 
     ~PosixWritableFile() override { WARN_IF_ERROR(close(), "Failed to close file, file=" + _filename); }
 
     Status append(const Slice& data) override { return appendv(&data, 1); }
 
     Status appendv(const Slice* data, size_t cnt) override {
+        if (_direct_buffer != nullptr) {
+            return _append_direct(data, cnt);
+        }
         size_t bytes_written = 0;
         RETURN_IF_ERROR(do_writev_at(_fd, _filename, _filesize, data, cnt, &bytes_written));
         _filesize += bytes_written;
@@ -205,7 +247,7 @@ public:
         if (_closed) {
             return Status::OK();
         }
-        Status s;
+        Status s = _write_direct_tail();
 
         // If we've allocated more space than we used, truncate to the
         // actual size of the file and perform Sync().
@@ -270,6 +312,52 @@ public:
     const string& filename() const override { return _filename; }
 
 private:
+    struct FreeDeleter {
+        void operator()(char* p) const { std::free(p); }
+    };
+
+    // Copy the data into the aligned buffer, and write the buffer by O_DIRECT whenever it is full.
+    Status _append_direct(const Slice* data, size_t cnt) {
+        for (size_t i = 0; i < cnt; i++) {
+            const char* p = data[i].data;
+            size_t n = data[i].size;
+            while (n > 0) {
+                size_t copy = std::min(n, kDirectIOBufferSize - _direct_buffer_size);
+                memcpy(_direct_buffer.get() + _direct_buffer_size, p, copy);
+                _direct_buffer_size += copy;
+                _filesize += copy;
+                p += copy;
+                n -= copy;
+                if (_direct_buffer_size == kDirectIOBufferSize) {
+                    Slice block(_direct_buffer.get(), kDirectIOBufferSize);
+                    size_t bytes_written = 0;
+                    RETURN_IF_ERROR(
+                            do_writev_at(_fd, _filename, _filesize - kDirectIOBufferSize, &block, 1, &bytes_written));
+                    _direct_buffer_size = 0;
+                    _pending_sync = true;
+                }
+            }
+        }
+        return Status::OK();
+    }
+
+    // The unaligned tail of the file is written through the page cache, after turning off O_DIRECT.
+    Status _write_direct_tail() {
+        if (_direct_buffer == nullptr || _direct_buffer_size == 0) {
+            return Status::OK();
+        }
+        int flags = fcntl(_fd, F_GETFL);
+        if (flags < 0 || fcntl(_fd, F_SETFL, flags & ~O_DIRECT) < 0) {
+            return io_error(_filename, errno);
+        }
+        Slice tail(_direct_buffer.get(), _direct_buffer_size);
+        size_t bytes_written = 0;
+        RETURN_IF_ERROR(do_writev_at(_fd, _filename, _filesize - _direct_buffer_size, &tail, 1, &bytes_written));
+        _direct_buffer_size = 0;
+        _pending_sync = true;
+        return Status::OK();
+    }
+
     std::string _filename;
     int _fd;
     const bool _sync_on_close = false;
@@ -277,6 +365,9 @@ private:
     bool _closed = false;
     uint64_t _filesize = 0;
     uint64_t _pre_allocated_size = 0;
+    // not null if the file is written by direct I/O, which holds the bytes not written yet.
+    std::unique_ptr<char, FreeDeleter> _direct_buffer;
+    size_t _direct_buffer_size = 0;
 };
 
 class PosixFileSystem : public FileSystem {
@@ -303,6 +394,22 @@ public:
 
     StatusOr<std::unique_ptr<RandomAccessFile>> new_random_access_file(const RandomAccessFileOptions& opts,
                                                                        const std::string& fname) override {
+        if (enable_mmap_read(fname)) {
+            int fd;
+            RETRY_ON_EINTR(fd, ::open(fname.c_str(), O_RDONLY));
+            if (fd < 0) {
+                return io_error(fname, errno);
+            }
+            ScopedFdCloser fd_closer(fd);
+            auto stream_or = io::MmapInputStream::open(fd);
+            if (stream_or.ok()) {
+                return std::make_unique<RandomAccessFile>(std::move(stream_or).value(), fname);
+            }
+            // the empty files are read by the descriptors below.
+            if (!stream_or.status().is_not_supported()) {
+                return stream_or.status();
+            }
+        }
         if (config::file_descriptor_cache_capacity > 0 && enable_fd_cache(fname)) {
             FdCache::Handle* h = FdCache::Instance()->lookup(fname);
             if (h == nullptr) {
@@ -337,6 +444,15 @@ public:
         int fd;
         RETURN_IF_ERROR(do_open(fname, opts.mode, &fd));
 
+        if (enable_direct_io_write(opts, fname)) {
+            // some file systems, e.g. tmpfs, reject O_DIRECT, whose files are written through the page cache.
+            int flags = fcntl(fd, F_GETFL);
+            if (flags >= 0 && fcntl(fd, F_SETFL, flags | O_DIRECT) == 0) {
+                return std::make_unique<PosixWritableFile>(fname, fd, 0, opts.sync_on_close, true);
+            }
+            LOG(WARNING) << "Fail to enable O_DIRECT for " << fname << ": " << std::strerror(errno);
+        }
+
         uint64_t file_size = 0;
         if (opts.mode == MUST_EXIST) {
             ASSIGN_OR_RETURN(file_size, get_file_size(fname));
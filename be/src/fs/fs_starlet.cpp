@@ -8,6 +8,7 @@
 #include "fs/output_stream_adapter.h"
 #include "gutil/strings/util.h"
 #include "io/input_stream.h"
+#include "io/io_profiler.h"
 #include "io/output_stream.h"
 #include "io/seekable_input_stream.h"
 
@@ -68,8 +69,10 @@ public:
         }
     }
     StatusOr<int64_t> read(void* data, int64_t count) override {
+        io::ScopedIORead io_read(io::IO_TIER_REMOTE);
         auto st = _ptr->read(data, count);
         if (st.ok()) {
+            io_read.set_bytes(*st);
             return *st;
         } else {
             return to_status(st.status());
@@ -29,10 +29,12 @@ DIAGNOSTIC_IGNORE("-Wclass-memaccess")
 #include <s2/s2cell.h>
 DIAGNOSTIC_POP
 
+#include <s2/s2cell_union.h>
 #include <s2/s2earth.h>
 #include <s2/s2latlng.h>
 #include <s2/s2polygon.h>
 #include <s2/s2polyline.h>
+#include <s2/s2region_coverer.h>
 #include <s2/util/coding/coder.h>
 #include <s2/util/units/length-units.h>
 
@@ -310,9 +312,17 @@ void GeoPolygon::encode(std::string* buf) {
 bool GeoPolygon::decode(const void* data, size_t size) {
     Decoder decoder(data, size);
     _polygon = std::make_unique<S2Polygon>();
+    _covering.reset();
     return _polygon->Decode(&decoder) && _polygon->IsValid();
 }
 
+void GeoPolygon::build_covering() {
+    S2RegionCoverer::Options options;
+    options.set_max_cells(32);
+    S2RegionCoverer coverer(options);
+    _covering = std::make_unique<S2CellUnion>(coverer.GetCovering(*_polygon));
+}
+
 std::string GeoLine::as_wkt() const {
     std::stringstream ss;
     ss << "LINESTRING (";
@@ -354,6 +364,10 @@ bool GeoPolygon::contains(const GeoShape* rhs) const {
     switch (rhs->type()) {
     case GEO_SHAPE_POINT: {
         const GeoPoint* point = (const GeoPoint*)rhs;
+        // the covering contains every cell that intersects the polygon
+        if (_covering != nullptr && !_covering->Contains(S2CellId(*point->point()))) {
+            return false;
+        }
         return _polygon->Contains(*point->point());
 #if 0
         if (_polygon->Contains(point->point())) {
@@ -30,6 +30,7 @@
 
 class S2Polyline;
 class S2Polygon;
+class S2CellUnion;
 class S2Cap;
 
 template <typename T>
@@ -123,6 +124,10 @@ public:
     GeoShapeType type() const override { return GEO_SHAPE_POLYGON; }
     const S2Polygon* polygon() const { return _polygon.get(); }
 
+    // Build a covering of S2 cells, used to reject the points out of it before the exact test.
+    // Worth it only for a polygon tested against many points, e.g. a constant argument.
+    void build_covering();
+
     bool contains(const GeoShape* rhs) const override;
     std::string as_wkt() const override;
 
@@ -132,6 +137,7 @@ protected:
 
 private:
     std::unique_ptr<S2Polygon> _polygon;
+    std::unique_ptr<S2CellUnion> _covering;
 };
 
 class GeoCircle : public GeoShape {
@@ -0,0 +1,85 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "http/action/cpu_samples_action.h"
+
+#include "common/logging.h"
+#include "gutil/strings/numbers.h"
+#include "gutil/strings/substitute.h"
+#include "http/http_channel.h"
+#include "http/http_headers.h"
+#include "http/http_request.h"
+#include "runtime/cpu_sampler.h"
+#include "util/time.h"
+#include "util/uid_util.h"
+
+namespace starrocks {
+
+const static std::string HEADER_TEXT = "text/plain";
+const static std::string QUERY_ID_KEY = "query_id";
+const static std::string WORKGROUP_ID_KEY = "workgroup_id";
+const static std::string SECONDS_KEY = "seconds";
+const static std::string FORMAT_KEY = "format";
+const static std::string LIMIT_KEY = "limit";
+const static size_t DEFAULT_LIMIT = 50;
+
+void CpuSamplesAction::handle(HttpRequest* req) {
+    VLOG_ROW << req->debug_string();
+    auto* sampler = CpuSampler::instance();
+    if (!sampler->is_running() && sampler->num_samples_taken() == 0) {
+        HttpChannel::send_reply(req, HttpStatus::NOT_FOUND, "The cpu sampler is disabled by cpu_sampler_frequency_hz");
+        return;
+    }
+
+    CpuSampler::Filter filter;
+    const auto& query_id_str = req->param(QUERY_ID_KEY);
+    if (!query_id_str.empty()) {
+        TUniqueId query_id;
+        if (!parse_id(query_id_str, &query_id)) {
+            HttpChannel::send_reply(req, HttpStatus::BAD_REQUEST,
+                                    strings::Substitute("Invalid query id: '$0'", query_id_str));
+            return;
+        }
+        filter.query_id_hi = query_id.hi;
+        filter.query_id_lo = query_id.lo;
+    }
+    const auto& workgroup_id_str = req->param(WORKGROUP_ID_KEY);
+    if (!workgroup_id_str.empty() && !safe_strto64(workgroup_id_str, &filter.workgroup_id)) {
+        HttpChannel::send_reply(req, HttpStatus::BAD_REQUEST,
+                                strings::Substitute("Invalid workgroup id: '$0'", workgroup_id_str));
+        return;
+    }
+    const auto& seconds_str = req->param(SECONDS_KEY);
+    if (!seconds_str.empty()) {
+        int64_t seconds = 0;
+        if (!safe_strto64(seconds_str, &seconds) || seconds <= 0) {
+            HttpChannel::send_reply(req, HttpStatus::BAD_REQUEST,
+                                    strings::Substitute("Invalid seconds: '$0'", seconds_str));
+            return;
+        }
+        filter.since_ns = MonotonicNanos() - seconds * NANOS_PER_SEC;
+    }
+
+    const auto samples = sampler->get_samples(filter);
+    const auto& format = req->param(FORMAT_KEY);
+    std::string res;
+    if (format.empty() || format == "collapsed") {
+        res = CpuSampler::to_collapsed_stacks(samples, true);
+    } else if (format == "top") {
+        int64_t limit = DEFAULT_LIMIT;
+        const auto& limit_str = req->param(LIMIT_KEY);
+        if (!limit_str.empty() && (!safe_strto64(limit_str, &limit) || limit <= 0)) {
+            HttpChannel::send_reply(req, HttpStatus::BAD_REQUEST,
+                                    strings::Substitute("Invalid limit: '$0'", limit_str));
+            return;
+        }
+        res = CpuSampler::to_top_functions(samples, limit);
+    } else {
+        HttpChannel::send_reply(req, HttpStatus::BAD_REQUEST,
+                                strings::Substitute("Invalid format: '$0', it should be collapsed or top", format));
+        return;
+    }
+    req->add_output_header(HttpHeaders::CONTENT_TYPE, HEADER_TEXT.c_str());
+    HttpChannel::send_reply(req, HttpStatus::OK, res);
+}
+
+} // namespace starrocks
@@ -0,0 +1,26 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <string>
+
+#include "http/http_handler.h"
+#include "http/http_status.h"
+
+namespace starrocks {
+
+// Aggregate the samples of CpuSampler, optionally of a query or a workgroup within the last seconds, e.g.
+//     curl "http://be_host:be_http_port/api/cpu_samples?query_id={query_id}&format=collapsed" | flamegraph.pl
+//     curl "http://be_host:be_http_port/api/cpu_samples?workgroup_id={workgroup_id}&seconds=60&format=top"
+// The format is one of
+//     collapsed: the collapsed stacks for flame graphs, whose root frames are the operators, it's the default one;
+//     top: the top functions by the self samples, the number of which is limited by the parameter `limit`.
+class CpuSamplesAction : public HttpHandler {
+public:
+    CpuSamplesAction() = default;
+    ~CpuSamplesAction() override = default;
+
+    void handle(HttpRequest* req) override;
+};
+
+} // namespace starrocks
@@ -0,0 +1,141 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "http/action/mem_samples_action.h"
+
+#include <fcntl.h>
+#include <fmt/format.h>
+#include <gperftools/malloc_extension.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
+#include "common/logging.h"
+#include "gutil/strings/numbers.h"
+#include "gutil/strings/substitute.h"
+#include "http/http_channel.h"
+#include "http/http_headers.h"
+#include "http/http_request.h"
+#include "runtime/alloc_sampler.h"
+#include "runtime/exec_env.h"
+#include "runtime/mem_tracker.h"
+#include "util/pretty_printer.h"
+
+namespace starrocks {
+
+const static std::string HEADER_TEXT = "text/plain";
+const static std::string FORMAT_KEY = "format";
+const static std::string LIMIT_KEY = "limit";
+const static size_t DEFAULT_LIMIT = 20;
+
+static int64_t get_rss_bytes() {
+    int fd = open("/proc/self/statm", O_RDONLY);
+    if (fd < 0) {
+        return -1;
+    }
+    char buf[128];
+    ssize_t n = read(fd, buf, sizeof(buf) - 1);
+    close(fd);
+    if (n <= 0) {
+        return -1;
+    }
+    buf[n] = '\0';
+    int64_t size_pages = 0;
+    int64_t rss_pages = 0;
+    if (sscanf(buf, "%ld %ld", &size_pages, &rss_pages) != 2) {
+        return -1;
+    }
+    return rss_pages * sysconf(_SC_PAGESIZE);
+}
+
+static int64_t get_tcmalloc_property(const char* name) {
+    size_t value = 0;
+    if (!MallocExtension::instance()->GetNumericProperty(name, &value)) {
+        return 0;
+    }
+    return static_cast<int64_t>(value);
+}
+
+static std::string bytes(int64_t value) {
+    return PrettyPrinter::print(value, TUnit::BYTES);
+}
+
+// The gap between the RSS and the tracked memory, which is the untracked allocations, the free memory cached by
+// tcmalloc and the memory not allocated by tcmalloc, e.g. the stacks and the mapped files.
+static std::string memory_breakdown() {
+    std::string res;
+    MemTracker* process_tracker = ExecEnv::GetInstance()->process_mem_tracker();
+    const int64_t rss = get_rss_bytes();
+    const int64_t tracked = process_tracker != nullptr ? process_tracker->consumption() : 0;
+    res.append(fmt::format("RSS: {}\n", bytes(rss)));
+    res.append(fmt::format("Tracked by MemTracker: {}\n", bytes(tracked)));
+    res.append(fmt::format("Gap between RSS and tracked: {}\n", bytes(rss - tracked)));
+#if !defined(ADDRESS_SANITIZER) && !defined(LEAK_SANITIZER) && !defined(THREAD_SANITIZER)
+    const int64_t allocated = get_tcmalloc_property("generic.current_allocated_bytes");
+    const int64_t heap_size = get_tcmalloc_property("generic.heap_size");
+    const int64_t unmapped = get_tcmalloc_property("tcmalloc.pageheap_unmapped_bytes");
+    const int64_t pageheap_free = get_tcmalloc_property("tcmalloc.pageheap_free_bytes");
+    const int64_t cache_free = get_tcmalloc_property("tcmalloc.current_total_thread_cache_bytes") +
+                               get_tcmalloc_property("tcmalloc.central_cache_free_bytes") +
+                               get_tcmalloc_property("tcmalloc.transfer_cache_free_bytes");
+    res.append(fmt::format("    Untracked allocations: {}\n", bytes(allocated - tracked)));
+    res.append(fmt::format("    Free in tcmalloc caches: {}\n", bytes(cache_free)));
+    res.append(fmt::format("    Free in tcmalloc page heap: {}\n", bytes(pageheap_free)));
+    res.append(fmt::format("    Not allocated by tcmalloc: {}\n", bytes(rss - (heap_size - unmapped))));
+#endif
+    if (process_tracker != nullptr) {
+        std::vector<MemTracker::SimpleItem> items;
+        process_tracker->list_mem_usage(&items, 0, 1);
+        std::sort(items.begin(), items.end(),
+                  [](const auto& a, const auto& b) { return a.cur_consumption > b.cur_consumption; });
+        res.append("\nTracked by each MemTracker:\n");
+        for (const auto& item : items) {
+            if (item.level == 1) {
+                res.append(fmt::format("    {}: {}\n", item.label, bytes(item.cur_consumption)));
+            }
+        }
+    }
+    return res;
+}
+
+void MemSamplesAction::handle(HttpRequest* req) {
+    VLOG_ROW << req->debug_string();
+    auto* sampler = AllocSampler::instance();
+    const auto& format = req->param(FORMAT_KEY);
+    std::string res;
+    if (format.empty() || format == "top") {
+        int64_t limit = DEFAULT_LIMIT;
+        const auto& limit_str = req->param(LIMIT_KEY);
+        if (!limit_str.empty() && (!safe_strto64(limit_str, &limit) || limit <= 0)) {
+            HttpChannel::send_reply(req, HttpStatus::BAD_REQUEST,
+                                    strings::Substitute("Invalid limit: '$0'", limit_str));
+            return;
+        }
+        res = memory_breakdown();
+        if (sampler->is_running() || sampler->num_live_samples() > 0) {
+            const auto samples = sampler->get_live_samples();
+            res.append("\nEstimated live bytes of each MemTracker by the samples:\n");
+            res.append(AllocSampler::to_tracker_breakdown(samples));
+            res.append(fmt::format("\nDropped samples: {}\n", sampler->num_dropped_samples()));
+            res.append(AllocSampler::to_top_sites(samples, limit));
+        } else {
+            res.append("\nThe alloc sampler is disabled by alloc_sampler_interval_bytes\n");
+        }
+    } else if (format == "collapsed") {
+        if (!sampler->is_running() && sampler->num_live_samples() == 0) {
+            HttpChannel::send_reply(req, HttpStatus::NOT_FOUND,
+                                    "The alloc sampler is disabled by alloc_sampler_interval_bytes");
+            return;
+        }
+        res = AllocSampler::to_collapsed_stacks(sampler->get_live_samples());
+    } else {
+        HttpChannel::send_reply(req, HttpStatus::BAD_REQUEST,
+                                strings::Substitute("Invalid format: '$0', it should be top or collapsed", format));
+        return;
+    }
+    req->add_output_header(HttpHeaders::CONTENT_TYPE, HEADER_TEXT.c_str());
+    HttpChannel::send_reply(req, HttpStatus::OK, res);
+}
+
+} // namespace starrocks
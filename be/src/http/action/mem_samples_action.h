@@ -0,0 +1,29 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <string>
+
+#include "http/http_handler.h"
+#include "http/http_status.h"
+
+namespace starrocks {
+
+// Break down the memory of the process, and aggregate the live samples of AllocSampler, e.g.
+//     curl "http://be_host:be_http_port/api/mem_samples?limit=20"
+//     curl "http://be_host:be_http_port/api/mem_samples?format=collapsed" | flamegraph.pl
+// The format is one of
+//     top: the gap between the RSS and the memory tracked by MemTracker, the estimated live bytes of each
+//          MemTracker, and the top allocation sites by the estimated live bytes, the number of which is limited by
+//          the parameter `limit`, it's the default one;
+//     collapsed: the collapsed stacks weighted by the estimated live bytes for flame graphs, whose root frames are
+//          the subsystems and the MemTrackers.
+class MemSamplesAction : public HttpHandler {
+public:
+    MemSamplesAction() = default;
+    ~MemSamplesAction() override = default;
+
+    void handle(HttpRequest* req) override;
+};
+
+} // namespace starrocks
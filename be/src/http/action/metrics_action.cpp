@@ -25,6 +25,7 @@
 #include <string>
 
 #include "common/tracer.h"
+#include "gutil/casts.h"
 #include "http/http_channel.h"
 #include "http/http_headers.h"
 #include "http/http_request.h"
@@ -42,6 +43,8 @@ public:
 
 private:
     void _visit_simple_metric(const std::string& name, const MetricLabels& labels, Metric* metric);
+    void _visit_histogram_metric(const std::string& name, const MetricLabels& labels, HistogramMetric* metric);
+    void _write_labels(const MetricLabels& labels, const std::string* le);
 
 private:
     std::stringstream _ss;
@@ -94,29 +97,67 @@ void PrometheusMetricsVisitor::visit(const std::string& prefix, const std::strin
             _visit_simple_metric(metric_name, it.first, (Metric*)it.second);
         }
         break;
+    case MetricType::HISTOGRAM:
+        for (auto& it : collector->metrics()) {
+            _visit_histogram_metric(metric_name, it.first, down_cast<HistogramMetric*>(it.second));
+        }
+        break;
     default:
         break;
     }
 }
 
+void PrometheusMetricsVisitor::_write_labels(const MetricLabels& labels, const std::string* le) {
+    if (labels.empty() && le == nullptr) {
+        return;
+    }
+    _ss << "{";
+    int i = 0;
+    for (auto& label : labels.labels) {
+        if (i++ > 0) {
+            _ss << ",";
+        }
+        _ss << label.name << "=\"" << label.value << "\"";
+    }
+    if (le != nullptr) {
+        _ss << (i > 0 ? "," : "") << "le=\"" << *le << "\"";
+    }
+    _ss << "}";
+}
+
 void PrometheusMetricsVisitor::_visit_simple_metric(const std::string& name, const MetricLabels& labels,
                                                     Metric* metric) {
     _ss << name;
-    // labels
-    if (!labels.empty()) {
-        _ss << "{";
-        int i = 0;
-        for (auto& label : labels.labels) {
-            if (i++ > 0) {
-                _ss << ",";
-            }
-            _ss << label.name << "=\"" << label.value << "\"";
-        }
-        _ss << "}";
-    }
+    _write_labels(labels, nullptr);
     _ss << " " << metric->to_string() << "\n";
 }
 
+// eg:
+// starrocks_be_memtable_flush_latency_us_bucket{le="1"} 0
+// ...
+// starrocks_be_memtable_flush_latency_us_bucket{le="+Inf"} 10
+// starrocks_be_memtable_flush_latency_us_sum 123456
+// starrocks_be_memtable_flush_latency_us_count 10
+void PrometheusMetricsVisitor::_visit_histogram_metric(const std::string& name, const MetricLabels& labels,
+                                                       HistogramMetric* metric) {
+    const HistogramMetric::Snapshot snapshot = metric->snapshot();
+    const int64_t* bounds = HistogramMetric::bounds();
+    int64_t cumulative = 0;
+    for (int i = 0; i < HistogramMetric::kNumBuckets; i++) {
+        cumulative += snapshot.counts[i];
+        const std::string le = i < HistogramMetric::kNumBounds ? std::to_string(bounds[i]) : "+Inf";
+        _ss << name << "_bucket";
+        _write_labels(labels, &le);
+        _ss << " " << cumulative << "\n";
+    }
+    _ss << name << "_sum";
+    _write_labels(labels, nullptr);
+    _ss << " " << snapshot.sum << "\n";
+    _ss << name << "_count";
+    _write_labels(labels, nullptr);
+    _ss << " " << snapshot.count << "\n";
+}
+
 void SimpleCoreMetricsVisitor::visit(const std::string& prefix, const std::string& name, MetricCollector* collector) {
     if (collector->empty() || name.empty()) {
         return;
@@ -165,6 +206,7 @@ void JsonMetricsVisitor::visit(const std::string& prefix, const std::string& nam
     switch (collector->type()) {
     case MetricType::COUNTER:
     case MetricType::GAUGE:
+    case MetricType::HISTOGRAM:
         for (auto& it : collector->metrics()) {
             const MetricLabels& labels = it.first;
             Metric* metric = reinterpret_cast<Metric*>(it.second);
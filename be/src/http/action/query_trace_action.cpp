@@ -0,0 +1,52 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "http/action/query_trace_action.h"
+
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
+#include "common/logging.h"
+#include "exec/pipeline/query_trace.h"
+#include "gutil/strings/substitute.h"
+#include "http/http_channel.h"
+#include "http/http_headers.h"
+#include "http/http_request.h"
+#include "util/uid_util.h"
+
+namespace starrocks {
+
+const static std::string HEADER_JSON = "application/json";
+const static std::string QUERY_ID_KEY = "query_id";
+
+void QueryTraceAction::handle(HttpRequest* req) {
+    VLOG_ROW << req->debug_string();
+    const auto& query_id_str = req->param(QUERY_ID_KEY);
+    TUniqueId query_id;
+    if (!parse_id(query_id_str, &query_id)) {
+        _handle_error(req, HttpStatus::BAD_REQUEST, strings::Substitute("Invalid query id: '$0'", query_id_str));
+        return;
+    }
+    auto trace = pipeline::QueryTraceManager::instance()->get(query_id);
+    if (trace == nullptr) {
+        _handle_error(req, HttpStatus::NOT_FOUND,
+                      strings::Substitute("The trace of query $0 is not found, it may have been evicted, "
+                                          "or pipeline_enable_query_trace is off",
+                                          query_id_str));
+        return;
+    }
+    req->add_output_header(HttpHeaders::CONTENT_TYPE, HEADER_JSON.c_str());
+    HttpChannel::send_reply(req, HttpStatus::OK, trace->to_json());
+}
+
+void QueryTraceAction::_handle_error(HttpRequest* req, HttpStatus status, const std::string& err_msg) {
+    rapidjson::StringBuffer strbuf;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(strbuf);
+    writer.StartObject();
+    writer.Key("error");
+    writer.String(err_msg.data(), err_msg.size());
+    writer.EndObject();
+    req->add_output_header(HttpHeaders::CONTENT_TYPE, HEADER_JSON.c_str());
+    HttpChannel::send_reply(req, status, strbuf.GetString());
+}
+
+} // namespace starrocks
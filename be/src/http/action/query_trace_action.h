@@ -0,0 +1,27 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <string>
+
+#include "http/http_handler.h"
+#include "http/http_status.h"
+
+namespace starrocks {
+
+// Dump the trace of a query in the Chrome trace event format, which can be loaded by chrome://tracing
+// or https://ui.perfetto.dev, e.g.
+//     curl http://be_host:be_http_port/api/query_trace/{query_id} > trace.json
+// The trace is recorded only when config::pipeline_enable_query_trace is on.
+class QueryTraceAction : public HttpHandler {
+public:
+    QueryTraceAction() = default;
+    ~QueryTraceAction() override = default;
+
+    void handle(HttpRequest* req) override;
+
+private:
+    void _handle_error(HttpRequest* req, HttpStatus status, const std::string& error_msg);
+};
+
+} // namespace starrocks
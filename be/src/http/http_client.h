@@ -86,6 +86,9 @@ public:
 
     void set_timeout_ms(int64_t timeout_ms) { curl_easy_setopt(_curl, CURLOPT_TIMEOUT_MS, timeout_ms); }
 
+    // limit the download speed of download(), config::max_download_speed_kbps is used if not set
+    void set_max_download_speed_kbps(int64_t speed_kbps) { _max_download_speed_kbps = speed_kbps; }
+
     // used to get content length
     int64_t get_content_length() const {
         double cl = 0.0f;
@@ -130,6 +133,7 @@ private:
     const HttpCallback* _callback = nullptr;
     char _error_buf[CURL_ERROR_SIZE];
     curl_slist* _header_list = nullptr;
+    int64_t _max_download_speed_kbps = -1;
 };
 
 } // namespace starrocks
@@ -0,0 +1,198 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "io/block_cache.h"
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <filesystem>
+
+#include "common/logging.h"
+#include "gutil/strings/substitute.h"
+#include "util/hash_util.hpp"
+#include "util/starrocks_metrics.h"
+#include "util/threadpool.h"
+
+namespace starrocks::io {
+
+BlockCache* BlockCache::_s_instance = nullptr;
+
+Status BlockCache::create_global_cache(const BlockCacheOptions& options) {
+    if (_s_instance == nullptr) {
+        auto cache = std::make_unique<BlockCache>(options);
+        RETURN_IF_ERROR(cache->init());
+        _s_instance = cache.release();
+    }
+    return Status::OK();
+}
+
+void BlockCache::release_global_cache() {
+    if (_s_instance != nullptr) {
+        delete _s_instance;
+        _s_instance = nullptr;
+    }
+}
+
+std::string BlockCache::encode_key(const std::string& fname, int64_t version, int64_t block_index) {
+    std::string key(fname);
+    key.append(reinterpret_cast<const char*>(&version), sizeof(version));
+    key.append(reinterpret_cast<const char*>(&block_index), sizeof(block_index));
+    return key;
+}
+
+BlockCache::BlockCache(BlockCacheOptions options) : _options(std::move(options)) {}
+
+BlockCache::~BlockCache() {
+    if (_populate_pool != nullptr) {
+        _populate_pool->shutdown();
+    }
+}
+
+Status BlockCache::init() {
+    if (_options.mem_capacity > 0) {
+        _mem_cache.reset(new_lru_cache(_options.mem_capacity));
+    }
+    if (_options.disk_path.empty() || _options.disk_capacity == 0) {
+        return Status::OK();
+    }
+    std::error_code ec;
+    std::filesystem::remove_all(_options.disk_path, ec);
+    if (ec || !std::filesystem::create_directories(_options.disk_path, ec)) {
+        return Status::IOError(strings::Substitute("Fail to create the block cache directory $0: $1",
+                                                   _options.disk_path, ec.message()));
+    }
+    _disk_cache.reset(new_lru_cache(_options.disk_capacity));
+    return ThreadPoolBuilder("block_cache_populate")
+            .set_min_threads(0)
+            .set_max_threads(_options.num_populate_threads)
+            .set_max_queue_size(1000)
+            .build(&_populate_pool);
+}
+
+std::shared_ptr<const std::string> BlockCache::lookup(const std::string& key) {
+    if (_mem_cache != nullptr) {
+        auto* handle = _mem_cache->lookup(CacheKey(key));
+        if (handle != nullptr) {
+            auto block = *reinterpret_cast<std::shared_ptr<const std::string>*>(_mem_cache->value(handle));
+            _mem_cache->release(handle);
+            StarRocksMetrics::instance()->block_cache_mem_hit_total.increment(1);
+            return block;
+        }
+    }
+    if (_disk_cache != nullptr) {
+        auto block = _lookup_disk(key);
+        if (block != nullptr) {
+            StarRocksMetrics::instance()->block_cache_disk_hit_total.increment(1);
+            _insert_mem(key, block);
+            return block;
+        }
+    }
+    StarRocksMetrics::instance()->block_cache_miss_total.increment(1);
+    return nullptr;
+}
+
+void BlockCache::insert(const std::string& key, std::shared_ptr<const std::string> block) {
+    if (_disk_cache != nullptr) {
+        // the block is dropped from the disk tier if the writers are too busy.
+        auto st = _populate_pool->submit_func([this, key, block]() { _write_disk(key, *block); });
+        LOG_IF(WARNING, !st.ok() && !st.is_service_unavailable()) << "Fail to populate block cache: " << st;
+    }
+    _insert_mem(key, std::move(block));
+}
+
+void BlockCache::wait_for_populating() {
+    if (_populate_pool != nullptr) {
+        _populate_pool->wait();
+    }
+}
+
+void BlockCache::_insert_mem(const std::string& key, std::shared_ptr<const std::string> block) {
+    if (_mem_cache == nullptr) {
+        return;
+    }
+    auto deleter = [](const starrocks::CacheKey& key, void* value) {
+        delete reinterpret_cast<std::shared_ptr<const std::string>*>(value);
+    };
+    size_t charge = block->size();
+    auto* value = new std::shared_ptr<const std::string>(std::move(block));
+    auto* handle = _mem_cache->insert(CacheKey(key), value, charge, deleter);
+    _mem_cache->release(handle);
+}
+
+std::string BlockCache::_disk_file_path(const std::string& key) const {
+    uint64_t hash = HashUtil::hash64(key.data(), static_cast<int32_t>(key.size()), 0);
+    return strings::Substitute("$0/$1", _options.disk_path, hash);
+}
+
+// A block file is the size of the key, the key and the block, the key is checked on reading in case that the keys of
+// two blocks have the same hash.
+std::shared_ptr<const std::string> BlockCache::_lookup_disk(const std::string& key) {
+    auto* handle = _disk_cache->lookup(CacheKey(key));
+    if (handle == nullptr) {
+        return nullptr;
+    }
+    // the file is not removed until the handle is released.
+    const auto& path = *reinterpret_cast<std::string*>(_disk_cache->value(handle));
+    std::shared_ptr<std::string> block;
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    struct stat st;
+    if (fd >= 0 && ::fstat(fd, &st) == 0 && st.st_size >= static_cast<off_t>(sizeof(uint32_t) + key.size())) {
+        std::string contents(st.st_size, '\0');
+        if (::pread(fd, contents.data(), contents.size(), 0) == static_cast<ssize_t>(contents.size())) {
+            uint32_t key_size = 0;
+            memcpy(&key_size, contents.data(), sizeof(key_size));
+            if (key_size == key.size() && memcmp(contents.data() + sizeof(key_size), key.data(), key_size) == 0) {
+                contents.erase(0, sizeof(key_size) + key_size);
+                block = std::make_shared<std::string>(std::move(contents));
+            }
+        }
+    }
+    if (fd >= 0) {
+        ::close(fd);
+    }
+    _disk_cache->release(handle);
+    if (block == nullptr) {
+        // the file is overwritten by another key or lost.
+        _disk_cache->erase(CacheKey(key));
+    }
+    return block;
+}
+
+void BlockCache::_write_disk(const std::string& key, const std::string& block) {
+    auto* handle = _disk_cache->lookup(CacheKey(key));
+    if (handle != nullptr) {
+        _disk_cache->release(handle);
+        return;
+    }
+    std::string path = _disk_file_path(key);
+    std::string tmp_path = strings::Substitute("$0.$1.tmp", path, _next_tmp_id.fetch_add(1));
+    int fd = ::open(tmp_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        PLOG(WARNING) << "Fail to create block cache file " << tmp_path;
+        return;
+    }
+    auto key_size = static_cast<uint32_t>(key.size());
+    bool ok = ::write(fd, &key_size, sizeof(key_size)) == sizeof(key_size) &&
+              ::write(fd, key.data(), key.size()) == static_cast<ssize_t>(key.size()) &&
+              ::write(fd, block.data(), block.size()) == static_cast<ssize_t>(block.size());
+    ::close(fd);
+    if (!ok || ::rename(tmp_path.c_str(), path.c_str()) != 0) {
+        PLOG(WARNING) << "Fail to write block cache file " << path;
+        ::unlink(tmp_path.c_str());
+        return;
+    }
+    StarRocksMetrics::instance()->block_cache_disk_write_bytes.increment(block.size());
+
+    auto deleter = [](const starrocks::CacheKey& key, void* value) {
+        auto* path = reinterpret_cast<std::string*>(value);
+        ::unlink(path->c_str());
+        delete path;
+    };
+    size_t charge = sizeof(key_size) + key.size() + block.size();
+    handle = _disk_cache->insert(CacheKey(key), new std::string(std::move(path)), charge, deleter);
+    _disk_cache->release(handle);
+}
+
+} // namespace starrocks::io
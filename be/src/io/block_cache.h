@@ -0,0 +1,83 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <string>
+
+#include "common/status.h"
+#include "util/lru_cache.h"
+
+namespace starrocks {
+class ThreadPool;
+} // namespace starrocks
+
+namespace starrocks::io {
+
+struct BlockCacheOptions {
+    // the capacity of the memory tier, 0 means no memory tier.
+    size_t mem_capacity = 0;
+    // the directory of the disk tier, empty means no disk tier.
+    std::string disk_path;
+    size_t disk_capacity = 0;
+    size_t block_size = 1024 * 1024;
+    int num_populate_threads = 1;
+};
+
+// BlockCache caches the blocks of the remote files, e.g. the files of the external tables on HDFS or S3, in a memory
+// tier and a disk tier on the local disks, so that the repeated scans of the files run at the local speed instead of
+// reading the remote storage again. A block is identified by the name and the version of its file, e.g. the
+// modification time, and its index in the file, so a rewritten file never hits the blocks of its previous version.
+// Both tiers evict the least recently used blocks to keep within their capacities. The blocks missed are inserted
+// into the memory tier at once, and written into the disk tier asynchronously by a thread pool.
+// The disk tier is cleared on startup since its index is kept in memory only.
+// Thread-safe.
+class BlockCache {
+public:
+    // Create global instance of this class.
+    static Status create_global_cache(const BlockCacheOptions& options);
+
+    static void release_global_cache();
+
+    // Return global instance, or nullptr if the cache is disabled.
+    static BlockCache* instance() { return _s_instance; }
+
+    // The key of the block |block_index| of the file |fname| of |version|.
+    static std::string encode_key(const std::string& fname, int64_t version, int64_t block_index);
+
+    explicit BlockCache(BlockCacheOptions options);
+    ~BlockCache();
+
+    Status init();
+
+    size_t block_size() const { return _options.block_size; }
+
+    // Return the cached block of |key|, or nullptr if it's in neither tier.
+    // The block found on the disk is inserted into the memory tier.
+    std::shared_ptr<const std::string> lookup(const std::string& key);
+
+    // Insert |block| of |key| into the memory tier, and write it into the disk tier asynchronously.
+    void insert(const std::string& key, std::shared_ptr<const std::string> block);
+
+    // Wait for the blocks being written into the disk tier.
+    void wait_for_populating();
+
+private:
+    void _insert_mem(const std::string& key, std::shared_ptr<const std::string> block);
+    std::shared_ptr<const std::string> _lookup_disk(const std::string& key);
+    void _write_disk(const std::string& key, const std::string& block);
+    std::string _disk_file_path(const std::string& key) const;
+
+    static BlockCache* _s_instance;
+
+    const BlockCacheOptions _options;
+    std::unique_ptr<Cache> _mem_cache;
+    // the index of the blocks on the disk, whose values are the paths of the block files, which are removed when
+    // the blocks are evicted.
+    std::unique_ptr<Cache> _disk_cache;
+    std::unique_ptr<ThreadPool> _populate_pool;
+    std::atomic<uint64_t> _next_tmp_id{0};
+};
+
+} // namespace starrocks::io
@@ -0,0 +1,95 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "io/cache_input_stream.h"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cstring>
+
+#include "io/block_cache.h"
+#include "io/io_profiler.h"
+
+namespace starrocks::io {
+
+CacheInputStream::CacheInputStream(std::shared_ptr<SeekableInputStream> stream, BlockCache* cache, std::string fname,
+                                   int64_t version, int64_t size)
+        : _stream(std::move(stream)), _cache(cache), _fname(std::move(fname)), _version(version), _size(size) {}
+
+StatusOr<std::shared_ptr<const std::string>> CacheInputStream::_read_block(int64_t block_index) {
+    const auto block_size = static_cast<int64_t>(_cache->block_size());
+    std::string key = BlockCache::encode_key(_fname, _version, block_index);
+    int64_t lookup_start_ns = MonotonicNanos();
+    auto block = _cache->lookup(key);
+    if (block != nullptr) {
+        _hit_count++;
+        IOProfiler::record_read(IO_TIER_BLOCK_CACHE, block->size(), MonotonicNanos() - lookup_start_ns);
+        return block;
+    }
+    _miss_count++;
+    int64_t offset = block_index * block_size;
+    auto contents = std::make_shared<std::string>(std::min(block_size, _size - offset), '\0');
+    RETURN_IF_ERROR(_stream->read_at_fully(offset, contents->data(), contents->size()));
+    _read_remote_bytes += contents->size();
+    _cache->insert(key, contents);
+    return contents;
+}
+
+StatusOr<int64_t> CacheInputStream::read_at(int64_t offset, void* out, int64_t count) {
+    if (offset < 0) {
+        return Status::InvalidArgument(fmt::format("Invalid offset {}", offset));
+    }
+    count = std::max<int64_t>(std::min(count, _size - offset), 0);
+    const auto block_size = static_cast<int64_t>(_cache->block_size());
+    auto* dst = static_cast<char*>(out);
+    int64_t end = offset + count;
+    for (int64_t pos = offset; pos < end;) {
+        int64_t block_index = pos / block_size;
+        ASSIGN_OR_RETURN(auto block, _read_block(block_index));
+        int64_t block_offset = pos - block_index * block_size;
+        int64_t n = std::min(end - pos, static_cast<int64_t>(block->size()) - block_offset);
+        if (n <= 0) {
+            return Status::IOError(fmt::format("Unexpected size {} of the cached block {} of {}", block->size(),
+                                               block_index, _fname));
+        }
+        memcpy(dst, block->data() + block_offset, n);
+        dst += n;
+        pos += n;
+    }
+    return count;
+}
+
+Status CacheInputStream::read_at_fully(int64_t offset, void* out, int64_t count) {
+    ASSIGN_OR_RETURN(auto n, read_at(offset, out, count));
+    if (n != count) {
+        return Status::IOError(fmt::format("Fail to read fully {} bytes at {} of {}", count, offset, _fname));
+    }
+    return Status::OK();
+}
+
+StatusOr<int64_t> CacheInputStream::read(void* data, int64_t count) {
+    ASSIGN_OR_RETURN(auto n, read_at(_offset, data, count));
+    _offset += n;
+    return n;
+}
+
+Status CacheInputStream::seek(int64_t offset) {
+    if (offset < 0) {
+        return Status::InvalidArgument(fmt::format("Invalid offset {}", offset));
+    }
+    _offset = offset;
+    return Status::OK();
+}
+
+StatusOr<std::unique_ptr<NumericStatistics>> CacheInputStream::get_numeric_statistics() {
+    ASSIGN_OR_RETURN(auto stats, _stream->get_numeric_statistics());
+    if (stats == nullptr) {
+        stats = std::make_unique<NumericStatistics>();
+    }
+    stats->append("BlockCacheHitCount", _hit_count);
+    stats->append("BlockCacheMissCount", _miss_count);
+    stats->append("BlockCacheReadRemoteBytes", _read_remote_bytes);
+    return stats;
+}
+
+} // namespace starrocks::io
@@ -0,0 +1,56 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "io/seekable_input_stream.h"
+
+namespace starrocks::io {
+
+class BlockCache;
+
+// CacheInputStream serves the reads of a remote file from the blocks in the BlockCache. A read is split by the
+// blocks of the cache, the blocks missed are read from the underlying stream in whole and inserted into the cache.
+// |version| identifies the content of the file, e.g. its modification time, so a rewritten file never reads the
+// blocks of its previous version.
+// Not thread-safe.
+class CacheInputStream final : public SeekableInputStream {
+public:
+    CacheInputStream(std::shared_ptr<SeekableInputStream> stream, BlockCache* cache, std::string fname,
+                     int64_t version, int64_t size);
+
+    ~CacheInputStream() override = default;
+
+    StatusOr<int64_t> read(void* data, int64_t count) override;
+
+    StatusOr<int64_t> read_at(int64_t offset, void* out, int64_t count) override;
+
+    Status read_at_fully(int64_t offset, void* out, int64_t count) override;
+
+    Status seek(int64_t offset) override;
+
+    StatusOr<int64_t> position() override { return _offset; }
+
+    StatusOr<int64_t> get_size() override { return _size; }
+
+    StatusOr<std::unique_ptr<NumericStatistics>> get_numeric_statistics() override;
+
+private:
+    // Read the block |block_index| from the cache, or from the underlying stream if it's missed.
+    StatusOr<std::shared_ptr<const std::string>> _read_block(int64_t block_index);
+
+    std::shared_ptr<SeekableInputStream> _stream;
+    BlockCache* _cache;
+    const std::string _fname;
+    const int64_t _version;
+    const int64_t _size;
+    int64_t _offset = 0;
+
+    int64_t _hit_count = 0;
+    int64_t _miss_count = 0;
+    int64_t _read_remote_bytes = 0;
+};
+
+} // namespace starrocks::io
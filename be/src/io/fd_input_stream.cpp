@@ -2,6 +2,7 @@
 
 #include "io/fd_input_stream.h"
 
+#include <fcntl.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <unistd.h>
@@ -9,6 +10,7 @@
 #include "common/logging.h"
 #include "gutil/macros.h"
 #include "io/io_error.h"
+#include "io/io_profiler.h"
 
 namespace starrocks::io {
 
@@ -38,17 +40,36 @@ Status FdInputStream::close() {
 }
 
 StatusOr<int64_t> FdInputStream::read(void* data, int64_t count) {
+    return read_at(_offset.load(std::memory_order_relaxed), data, count);
+}
+
+StatusOr<int64_t> FdInputStream::read_at(int64_t offset, void* data, int64_t count) {
     CHECK_IS_CLOSED(_is_closed);
+    if (offset < 0) return Status::InvalidArgument(fmt::format("Invalid offset {}", offset));
+    ScopedIORead io_read(IO_TIER_LOCAL_DISK);
     ssize_t res;
-    RETRY_ON_EINTR(res, ::pread(_fd, static_cast<char*>(data), count, _offset));
+    RETRY_ON_EINTR(res, ::pread(_fd, static_cast<char*>(data), count, offset));
     if (UNLIKELY(res < 0)) {
         _errno = errno;
         return io_error("read", _errno);
     }
-    _offset += res;
+    io_read.set_bytes(res);
+    _offset.store(offset + res, std::memory_order_relaxed);
     return res;
 }
 
+Status FdInputStream::read_at_fully(int64_t offset, void* data, int64_t count) {
+    int64_t nread = 0;
+    while (nread < count) {
+        ASSIGN_OR_RETURN(auto n, read_at(offset + nread, static_cast<char*>(data) + nread, count - nread));
+        nread += n;
+        if (n == 0) {
+            return Status::IOError("cannot read fully");
+        }
+    }
+    return Status::OK();
+}
+
 StatusOr<int64_t> FdInputStream::get_size() {
     CHECK_IS_CLOSED(_is_closed);
     struct stat st;
@@ -62,7 +83,21 @@ StatusOr<int64_t> FdInputStream::get_size() {
 
 Status FdInputStream::seek(int64_t offset) {
     if (offset < 0) return Status::InvalidArgument(fmt::format("Invalid offset {}", offset));
-    _offset = offset;
+    _offset.store(offset, std::memory_order_relaxed);
+    return Status::OK();
+}
+
+Status FdInputStream::prefetch(int64_t offset, int64_t count) {
+    CHECK_IS_CLOSED(_is_closed);
+    if (offset < 0 || count < 0) {
+        return Status::InvalidArgument(fmt::format("Invalid range {}:{}", offset, count));
+    }
+    // posix_fadvise returns the error number instead of setting errno.
+    int res = ::posix_fadvise(_fd, offset, count, POSIX_FADV_WILLNEED);
+    if (res != 0) {
+        _errno = res;
+        return io_error("posix_fadvise", _errno);
+    }
     return Status::OK();
 }
 
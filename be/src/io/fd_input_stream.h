@@ -2,11 +2,15 @@
 
 #pragma once
 
+#include <atomic>
+
 #include "io/seekable_input_stream.h"
 
 namespace starrocks::io {
 
 // A RandomAccessFile which reads from a file descriptor.
+// read_at() and read_at_fully() read by pread at the given offset, so they can be called by several threads at the
+// same time, e.g. on a file handle pinned to a Segment, while the position is left to the last one of them.
 class FdInputStream : public SeekableInputStream {
 public:
     explicit FdInputStream(int fd);
@@ -20,12 +24,19 @@ public:
 
     StatusOr<int64_t> read(void* data, int64_t count) override;
 
+    StatusOr<int64_t> read_at(int64_t offset, void* data, int64_t count) override;
+
+    Status read_at_fully(int64_t offset, void* data, int64_t count) override;
+
     StatusOr<int64_t> get_size() override;
 
-    StatusOr<int64_t> position() override { return _offset; }
+    StatusOr<int64_t> position() override { return _offset.load(std::memory_order_relaxed); }
 
     Status seek(int64_t offset) override;
 
+    // Start the kernel read-ahead of the range by posix_fadvise(POSIX_FADV_WILLNEED).
+    Status prefetch(int64_t offset, int64_t count) override;
+
     // closes the underlying file.
     //
     // Returns error if an error occurs during the process;
@@ -48,7 +59,7 @@ public:
 private:
     int _fd;
     int _errno;
-    int64_t _offset;
+    std::atomic<int64_t> _offset;
     bool _close_on_delete;
     bool _is_closed;
 };
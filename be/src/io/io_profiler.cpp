@@ -0,0 +1,93 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "io/io_profiler.h"
+
+#include <memory>
+
+#include "util/starrocks_metrics.h"
+
+namespace starrocks::io {
+
+thread_local IOStats IOProfiler::_tls_stats;
+
+const char* io_tier_name(IOTier tier) {
+    switch (tier) {
+    case IO_TIER_PAGE_CACHE:
+        return "page_cache";
+    case IO_TIER_LOCAL_DISK:
+        return "local_disk";
+    case IO_TIER_REMOTE:
+        return "remote";
+    case IO_TIER_BLOCK_CACHE:
+        return "block_cache";
+    default:
+        return "unknown";
+    }
+}
+
+namespace {
+
+// The upper bounds of the latency buckets in microseconds, the last bucket is unbounded.
+constexpr int64_t kLatencyBucketBoundsUs[] = {100, 1000, 10000, 100000};
+constexpr int kNumLatencyBuckets = sizeof(kLatencyBucketBoundsUs) / sizeof(kLatencyBucketBoundsUs[0]) + 1;
+const char* const kLatencyBucketNames[kNumLatencyBuckets] = {"0-100us", "100us-1ms", "1ms-10ms", "10ms-100ms",
+                                                             "100ms+"};
+
+// The metrics of the reads of each tier:
+//     io_read_bytes_total{tier="..."}
+//     io_read_total{tier="..."}
+//     io_read_latency_us_total{tier="..."}
+//     io_read_by_latency_total{tier="...",latency="..."}, the number of the reads in each latency bucket
+struct IOMetrics {
+    IOMetrics() {
+        auto* registry = StarRocksMetrics::instance()->metrics();
+        for (int i = 0; i < NUM_IO_TIERS; i++) {
+            const char* tier = io_tier_name(static_cast<IOTier>(i));
+            read_bytes[i] = std::make_unique<IntCounter>(MetricUnit::BYTES);
+            registry->register_metric("io_read_bytes_total", MetricLabels().add("tier", tier), read_bytes[i].get());
+            read_count[i] = std::make_unique<IntCounter>(MetricUnit::OPERATIONS);
+            registry->register_metric("io_read_total", MetricLabels().add("tier", tier), read_count[i].get());
+            read_latency_us[i] = std::make_unique<IntCounter>(MetricUnit::MICROSECONDS);
+            registry->register_metric("io_read_latency_us_total", MetricLabels().add("tier", tier),
+                                      read_latency_us[i].get());
+            for (int j = 0; j < kNumLatencyBuckets; j++) {
+                read_by_latency[i][j] = std::make_unique<IntCounter>(MetricUnit::OPERATIONS);
+                registry->register_metric("io_read_by_latency_total",
+                                          MetricLabels().add("tier", tier).add("latency", kLatencyBucketNames[j]),
+                                          read_by_latency[i][j].get());
+            }
+        }
+    }
+
+    std::unique_ptr<IntCounter> read_bytes[NUM_IO_TIERS];
+    std::unique_ptr<IntCounter> read_count[NUM_IO_TIERS];
+    std::unique_ptr<IntCounter> read_latency_us[NUM_IO_TIERS];
+    std::unique_ptr<IntCounter> read_by_latency[NUM_IO_TIERS][kNumLatencyBuckets];
+};
+
+IOMetrics* io_metrics() {
+    // Never destroyed, since the metrics are registered in the registry of StarRocksMetrics.
+    static auto* metrics = new IOMetrics();
+    return metrics;
+}
+
+} // namespace
+
+void IOProfiler::record_read(IOTier tier, int64_t bytes, int64_t latency_ns) {
+    _tls_stats.read_bytes[tier] += bytes;
+    _tls_stats.read_count[tier]++;
+    _tls_stats.read_ns[tier] += latency_ns;
+
+    auto* metrics = io_metrics();
+    const int64_t latency_us = latency_ns / 1000;
+    metrics->read_bytes[tier]->increment(bytes);
+    metrics->read_count[tier]->increment(1);
+    metrics->read_latency_us[tier]->increment(latency_us);
+    int bucket = 0;
+    while (bucket < kNumLatencyBuckets - 1 && latency_us >= kLatencyBucketBoundsUs[bucket]) {
+        bucket++;
+    }
+    metrics->read_by_latency[tier][bucket]->increment(1);
+}
+
+} // namespace starrocks::io
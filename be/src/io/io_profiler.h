@@ -0,0 +1,81 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <cstdint>
+
+#include "util/time.h"
+
+namespace starrocks::io {
+
+// Where the bytes are read from.
+enum IOTier : int {
+    // The decompressed pages cached by StoragePageCache.
+    IO_TIER_PAGE_CACHE = 0,
+    // The local files, including the memory-mapped ones.
+    IO_TIER_LOCAL_DISK = 1,
+    // The remote storage, e.g. S3, HDFS and starlet.
+    IO_TIER_REMOTE = 2,
+    // The blocks of the remote files cached by BlockCache.
+    IO_TIER_BLOCK_CACHE = 3,
+    NUM_IO_TIERS = 4,
+};
+
+const char* io_tier_name(IOTier tier);
+
+// The reads of each tier.
+struct IOStats {
+    int64_t read_bytes[NUM_IO_TIERS] = {};
+    int64_t read_count[NUM_IO_TIERS] = {};
+    int64_t read_ns[NUM_IO_TIERS] = {};
+
+    IOStats operator-(const IOStats& other) const {
+        IOStats res;
+        for (int i = 0; i < NUM_IO_TIERS; i++) {
+            res.read_bytes[i] = read_bytes[i] - other.read_bytes[i];
+            res.read_count[i] = read_count[i] - other.read_count[i];
+            res.read_ns[i] = read_ns[i] - other.read_ns[i];
+        }
+        return res;
+    }
+};
+
+// IOProfiler accounts each read in the statistics of the calling thread, and in the process-wide metrics of its
+// tier, including a histogram of the read latency.
+//
+// The statistics of the thread only increase, so the reads of a task running on the thread, e.g. a scan io task,
+// are the difference of the statistics after and before the task.
+class IOProfiler {
+public:
+    static void record_read(IOTier tier, int64_t bytes, int64_t latency_ns);
+
+    static const IOStats& thread_stats() { return _tls_stats; }
+
+private:
+    static thread_local IOStats _tls_stats;
+};
+
+// Records the read of the scope, timed from the construction to the destruction.
+// The bytes are set by set_bytes(), and nothing is recorded if they are not set.
+class ScopedIORead {
+public:
+    explicit ScopedIORead(IOTier tier) : _tier(tier), _start_ns(MonotonicNanos()) {}
+
+    ~ScopedIORead() {
+        if (_bytes >= 0) {
+            IOProfiler::record_read(_tier, _bytes, MonotonicNanos() - _start_ns);
+        }
+    }
+
+    void set_bytes(int64_t bytes) { _bytes = bytes; }
+
+private:
+    ScopedIORead(const ScopedIORead&) = delete;
+    const ScopedIORead& operator=(const ScopedIORead&) = delete;
+
+    const IOTier _tier;
+    const int64_t _start_ns;
+    int64_t _bytes = -1;
+};
+
+} // namespace starrocks::io
@@ -0,0 +1,83 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "io/mmap_input_stream.h"
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstring>
+
+#include <fmt/format.h>
+
+#include "common/logging.h"
+#include "io/io_error.h"
+#include "io/io_profiler.h"
+
+namespace starrocks::io {
+
+StatusOr<std::unique_ptr<MmapInputStream>> MmapInputStream::open(int fd) {
+    struct stat st;
+    if (::fstat(fd, &st) != 0) {
+        return io_error("fstat", errno);
+    }
+    if (st.st_size == 0) {
+        return Status::NotSupported("can not map an empty file");
+    }
+    void* data = ::mmap(nullptr, st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    if (data == MAP_FAILED) {
+        return io_error("mmap", errno);
+    }
+    return std::unique_ptr<MmapInputStream>(new MmapInputStream(static_cast<char*>(data), st.st_size));
+}
+
+MmapInputStream::~MmapInputStream() {
+    if (::munmap(_data, _size) != 0) {
+        PLOG(ERROR) << "munmap() failed";
+    }
+}
+
+StatusOr<int64_t> MmapInputStream::read_at(int64_t offset, void* out, int64_t count) {
+    if (offset < 0 || count < 0) {
+        return Status::InvalidArgument(fmt::format("Invalid range {}:{}", offset, count));
+    }
+    if (offset >= _size) {
+        return 0;
+    }
+    ScopedIORead io_read(IO_TIER_LOCAL_DISK);
+    int64_t n = std::min(count, _size - offset);
+    memcpy(out, _data + offset, n);
+    io_read.set_bytes(n);
+    return n;
+}
+
+Status MmapInputStream::read_at_fully(int64_t offset, void* out, int64_t count) {
+    ASSIGN_OR_RETURN(auto n, read_at(offset, out, count));
+    if (n < count) {
+        return Status::IOError("cannot read fully");
+    }
+    return Status::OK();
+}
+
+Status MmapInputStream::advise(int64_t offset, int64_t count, int advice) {
+    if (offset < 0 || count < 0 || offset + count > _size) {
+        return Status::InvalidArgument(fmt::format("Invalid range {}:{} of size {}", offset, count, _size));
+    }
+    // madvise requires the address aligned to the page size.
+    static const int64_t page_size = ::sysconf(_SC_PAGESIZE);
+    int64_t begin = offset / page_size * page_size;
+    if (count > 0 && ::madvise(_data + begin, offset + count - begin, advice) != 0) {
+        return io_error("madvise", errno);
+    }
+    return Status::OK();
+}
+
+Status MmapInputStream::prefetch(int64_t offset, int64_t count) {
+    if (offset >= _size) {
+        return Status::OK();
+    }
+    return advise(offset, std::min(count, _size - offset), MADV_WILLNEED);
+}
+
+} // namespace starrocks::io
@@ -0,0 +1,46 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <memory>
+
+#include "common/statusor.h"
+#include "io/array_input_stream.h"
+
+namespace starrocks::io {
+
+// A RandomAccessFile which reads a file mapped into the memory, the bytes are copied from the mapping instead of
+// being read by syscalls, and can be referenced in place by |data()|.
+// The file is mapped privately and writable, so the writes into the referenced bytes go into private copies of
+// their pages instead of faulting. The file is unmapped when the stream is destroyed.
+// read_at() and read_at_fully() do not move the position, so they can be called by several threads at the same time.
+class MmapInputStream : public ArrayInputStream {
+public:
+    // Map the whole file of |fd|, which can be closed after it returns.
+    // Return NotSupported for an empty file, which can not be mapped.
+    static StatusOr<std::unique_ptr<MmapInputStream>> open(int fd);
+
+    ~MmapInputStream() override;
+
+    StatusOr<int64_t> read_at(int64_t offset, void* out, int64_t count) override;
+
+    Status read_at_fully(int64_t offset, void* out, int64_t count) override;
+
+    char* data() const { return _data; }
+
+    int64_t size() const { return _size; }
+
+    // Advise the kernel about the accesses to [offset, offset + count), |advice| being one of MADV_*.
+    Status advise(int64_t offset, int64_t count, int advice);
+
+    // Start the kernel read-ahead of the range by madvise(MADV_WILLNEED).
+    Status prefetch(int64_t offset, int64_t count) override;
+
+private:
+    MmapInputStream(char* data, int64_t size) : ArrayInputStream(data, size), _data(data), _size(size) {}
+
+    char* _data;
+    int64_t _size;
+};
+
+} // namespace starrocks::io
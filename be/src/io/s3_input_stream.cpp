@@ -8,32 +8,104 @@
 #include <aws/s3/model/HeadObjectRequest.h>
 #include <fmt/format.h>
 
+#include <vector>
+
+#include "common/config.h"
+#include "io/io_profiler.h"
+#include "util/countdown_latch.h"
+#include "util/threadpool.h"
+
 namespace starrocks::io {
 
-StatusOr<int64_t> S3InputStream::read(void* out, int64_t count) {
-    if (UNLIKELY(_size == -1)) {
-        ASSIGN_OR_RETURN(_size, S3InputStream::get_size());
-    }
-    if (_offset >= _size) {
-        return 0;
-    }
-    auto range = fmt::format("bytes={}-{}", _offset, std::min<int64_t>(_offset + count, _size));
+// The threads downloading the parts of the large reads, shared by all the streams.
+static ThreadPool* download_pool() {
+    static ThreadPool* pool = [] {
+        std::unique_ptr<ThreadPool> pool;
+        auto st = ThreadPoolBuilder("s3_download")
+                          .set_min_threads(0)
+                          .set_max_threads(std::max(config::object_storage_download_thread_num, 1))
+                          .set_max_queue_size(1000)
+                          .set_idle_timeout(MonoDelta::FromMilliseconds(2000))
+                          .build(&pool);
+        LOG_IF(WARNING, !st.ok()) << "Fail to create the s3 download pool: " << st;
+        return pool.release();
+    }();
+    return pool;
+}
+
+StatusOr<int64_t> S3InputStream::_get_object(int64_t offset, void* out, int64_t count) {
+    // the range is inclusive
+    auto range = fmt::format("bytes={}-{}", offset, std::min<int64_t>(offset + count, _size) - 1);
     Aws::S3::Model::GetObjectRequest request;
     request.SetBucket(_bucket);
     request.SetKey(_object);
     request.SetRange(std::move(range));
 
+    ScopedIORead io_read(IO_TIER_REMOTE);
     Aws::S3::Model::GetObjectOutcome outcome = _s3client->GetObject(request);
     if (outcome.IsSuccess()) {
         Aws::IOStream& body = outcome.GetResult().GetBody();
         body.read(static_cast<char*>(out), count);
-        _offset += body.gcount();
+        io_read.set_bytes(body.gcount());
         return body.gcount();
     } else {
         return Status::IOError(outcome.GetError().GetMessage());
     }
 }
 
+StatusOr<int64_t> S3InputStream::read(void* out, int64_t count) {
+    if (UNLIKELY(_size == -1)) {
+        ASSIGN_OR_RETURN(_size, S3InputStream::get_size());
+    }
+    if (_offset >= _size) {
+        return 0;
+    }
+    ASSIGN_OR_RETURN(auto n, _get_object(_offset, out, count));
+    _offset += n;
+    return n;
+}
+
+Status S3InputStream::read_at_fully(int64_t offset, void* out, int64_t count) {
+    const int64_t part_size = config::object_storage_download_part_size;
+    if (part_size <= 0 || count <= part_size) {
+        return SeekableInputStream::read_at_fully(offset, out, count);
+    }
+    if (offset < 0) return Status::InvalidArgument(fmt::format("Invalid offset {}", offset));
+    ASSIGN_OR_RETURN(auto size, get_size());
+    if (offset + count > size) {
+        return Status::IOError("cannot read fully");
+    }
+
+    const int64_t num_parts = (count + part_size - 1) / part_size;
+    std::vector<Status> statuses(num_parts);
+    CountDownLatch latch(static_cast<int>(num_parts));
+    ThreadPool* pool = download_pool();
+    for (int64_t i = 0; i < num_parts; i++) {
+        int64_t part_offset = i * part_size;
+        int64_t part_count = std::min(part_size, count - part_offset);
+        auto download = [this, &statuses, &latch, i, part_count, offset = offset + part_offset,
+                         data = static_cast<char*>(out) + part_offset]() {
+            auto res = _get_object(offset, data, part_count);
+            if (!res.ok()) {
+                statuses[i] = res.status();
+            } else if (res.value() != part_count) {
+                statuses[i] = Status::IOError("cannot read fully");
+            }
+            latch.count_down();
+        };
+        // the last part is downloaded by the caller, so are the parts which can't be submitted.
+        if (i == num_parts - 1 || pool == nullptr || !pool->submit_func(download).ok()) {
+            download();
+        }
+    }
+    latch.wait();
+    for (const auto& st : statuses) {
+        RETURN_IF_ERROR(st);
+    }
+    _offset = offset + count;
+    return Status::OK();
+}
+
 Status S3InputStream::seek(int64_t offset) {
     if (offset < 0) return Status::InvalidArgument(fmt::format("Invalid offset {}", offset));
     _offset = offset;
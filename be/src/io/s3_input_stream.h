@@ -34,6 +34,9 @@ public:
 
     StatusOr<int64_t> read(void* data, int64_t count) override;
 
+    // The ranges larger than `object_storage_download_part_size` are downloaded by parts in parallel.
+    Status read_at_fully(int64_t offset, void* out, int64_t count) override;
+
     Status seek(int64_t offset) override;
 
     StatusOr<int64_t> position() override;
@@ -41,6 +44,10 @@ public:
     StatusOr<int64_t> get_size() override;
 
 private:
+    // Read at most |count| bytes at |offset| by one ranged GET, return the number of bytes read.
+    // It doesn't change the position of the stream, so it may be called concurrently after the size is known.
+    StatusOr<int64_t> _get_object(int64_t offset, void* out, int64_t count);
+
     std::shared_ptr<Aws::S3::S3Client> _s3client;
     std::string _bucket;
     std::string _object;
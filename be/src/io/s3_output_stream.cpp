@@ -9,10 +9,28 @@
 #include <aws/s3/model/UploadPartRequest.h>
 #include <fmt/format.h>
 
+#include "common/config.h"
 #include "common/logging.h"
+#include "util/threadpool.h"
 
 namespace starrocks::io {
 
+// The threads uploading the parts of the multipart uploads, shared by all the streams.
+static ThreadPool* upload_pool() {
+    static ThreadPool* pool = [] {
+        std::unique_ptr<ThreadPool> pool;
+        auto st = ThreadPoolBuilder("s3_upload")
+                          .set_min_threads(0)
+                          .set_max_threads(std::max(config::object_storage_upload_thread_num, 1))
+                          .set_max_queue_size(1000)
+                          .set_idle_timeout(MonoDelta::FromMilliseconds(2000))
+                          .build(&pool);
+        LOG_IF(WARNING, !st.ok()) << "Fail to create the s3 upload pool: " << st;
+        return pool.release();
+    }();
+    return pool;
+}
+
 S3OutputStream::S3OutputStream(std::shared_ptr<Aws::S3::S3Client> client, std::string bucket, std::string object,
                                int64_t max_single_part_size, int64_t min_upload_part_size)
         : _client(std::move(client)),
@@ -26,6 +44,11 @@ S3OutputStream::S3OutputStream(std::shared_ptr<Aws::S3::S3Client> client, std::s
     CHECK(_client != nullptr);
 }
 
+S3OutputStream::~S3OutputStream() {
+    // the uploads of the parts refer to this stream.
+    (void)wait_for_inflight_parts(0);
+}
+
 Status S3OutputStream::write(const void* data, int64_t size) {
     _buffer.append(static_cast<const char*>(data), size);
     if (_upload_id.empty() && _buffer.size() > _max_single_part_size) {
@@ -34,7 +57,6 @@ Status S3OutputStream::write(const void* data, int64_t size) {
     }
     if (!_upload_id.empty() && _buffer.size() >= _min_upload_part_size) {
         RETURN_IF_ERROR(multipart_upload());
-        _buffer.clear();
     }
     return Status::OK();
 }
@@ -68,6 +90,7 @@ Status S3OutputStream::close() {
         RETURN_IF_ERROR(singlepart_upload());
     } else {
         RETURN_IF_ERROR(multipart_upload());
+        RETURN_IF_ERROR(wait_for_inflight_parts(0));
         RETURN_IF_ERROR(complete_multipart_upload());
     }
     _client = nullptr;
@@ -111,22 +134,62 @@ Status S3OutputStream::multipart_upload() {
     if (_buffer.empty()) {
         return Status::OK();
     }
+    // bound the memory of the parts buffered.
+    int64_t max_inflight_parts = std::max(config::object_storage_upload_max_inflight_parts, 1);
+    RETURN_IF_ERROR(wait_for_inflight_parts(max_inflight_parts - 1));
+
+    int part_number = ++_num_parts;
+    auto data = std::make_shared<Aws::String>(std::move(_buffer));
+    _buffer = Aws::String();
+    {
+        std::lock_guard l(_mutex);
+        _etags.resize(part_number);
+        _inflight_parts++;
+    }
+    auto upload = [this, part_number, data]() {
+        Aws::String etag;
+        auto st = upload_part(part_number, *data, &etag);
+        std::lock_guard l(_mutex);
+        if (st.ok()) {
+            _etags[part_number - 1] = std::move(etag);
+        } else if (_upload_status.ok()) {
+            _upload_status = std::move(st);
+        }
+        _inflight_parts--;
+        _cond.notify_all();
+    };
+    ThreadPool* pool = upload_pool();
+    if (max_inflight_parts == 1 || pool == nullptr || !pool->submit_func(upload).ok()) {
+        upload();
+    }
+    std::lock_guard l(_mutex);
+    return _upload_status;
+}
+
+Status S3OutputStream::upload_part(int part_number, const Aws::String& data, Aws::String* etag) {
     Aws::S3::Model::UploadPartRequest req;
     req.SetBucket(_bucket);
     req.SetKey(_object);
-    req.SetPartNumber(static_cast<int>(_etags.size() + 1));
+    req.SetPartNumber(part_number);
     req.SetUploadId(_upload_id);
-    req.SetContentLength(static_cast<int64_t>(_buffer.size()));
-    req.SetBody(std::make_shared<Aws::StringStream>(_buffer));
+    req.SetContentLength(static_cast<int64_t>(data.size()));
+    req.SetBody(std::make_shared<Aws::StringStream>(data));
+    // the failed requests are retried by the retry strategy of the client.
     auto outcome = _client->UploadPart(req);
     if (outcome.IsSuccess()) {
-        _etags.push_back(outcome.GetResult().GetETag());
+        *etag = outcome.GetResult().GetETag();
         return Status::OK();
     }
     return Status::IOError(
             fmt::format("S3: Fail to upload part of {}/{}: {}", _bucket, _object, outcome.GetError().GetMessage()));
 }
 
+Status S3OutputStream::wait_for_inflight_parts(int64_t max_inflight_parts) {
+    std::unique_lock l(_mutex);
+    _cond.wait(l, [&] { return _inflight_parts <= max_inflight_parts; });
+    return _upload_status;
+}
+
 Status S3OutputStream::complete_multipart_upload() {
     VLOG(12) << "Completing multipart upload s3://" << _bucket << "/" << _object;
     DCHECK(!_upload_id.empty());
@@ -4,6 +4,9 @@
 
 #include <aws/s3/S3Client.h>
 
+#include <condition_variable>
+#include <mutex>
+
 #include "io/output_stream.h"
 
 namespace starrocks::io {
@@ -13,7 +16,8 @@ public:
     explicit S3OutputStream(std::shared_ptr<Aws::S3::S3Client> client, std::string bucket, std::string object,
                             int64_t max_single_part_size, int64_t min_upload_part_size);
 
-    ~S3OutputStream() override = default;
+    // Wait for the parts being uploaded.
+    ~S3OutputStream() override;
 
     // Disallow copy and assignment
     S3OutputStream(const S3OutputStream&) = delete;
@@ -39,7 +43,12 @@ public:
 
 private:
     Status create_multipart_upload();
+    // Upload |_buffer| as the next part in the background. It waits if there are already
+    // `object_storage_upload_max_inflight_parts` parts being uploaded, and returns the error of the parts uploaded.
     Status multipart_upload();
+    Status upload_part(int part_number, const Aws::String& data, Aws::String* etag);
+    // Wait until at most |max_inflight_parts| parts are being uploaded, return the first error of the parts.
+    Status wait_for_inflight_parts(int64_t max_inflight_parts);
     Status singlepart_upload();
     Status complete_multipart_upload();
 
@@ -50,6 +59,14 @@ private:
     const int64_t _min_upload_part_size;
     Aws::String _buffer;
     Aws::String _upload_id;
+    int _num_parts = 0;
+
+    // protect the following states updated by the uploads of the parts.
+    std::mutex _mutex;
+    std::condition_variable _cond;
+    int64_t _inflight_parts = 0;
+    Status _upload_status;
+    // the etag of the part i + 1
     std::vector<Aws::String> _etags;
 };
 
@@ -48,6 +48,12 @@ public:
     // Return the total file size in bytes, or error.
     virtual StatusOr<int64_t> get_size() = 0;
 
+    // Hint that [offset, offset + count) will be read soon, so the implementation can start reading it
+    // asynchronously. The reads are not required to follow.
+    //
+    // Default implementation does nothing and returns OK.
+    virtual Status prefetch(int64_t offset, int64_t count) { return Status::OK(); }
+
     // Default implementation:
     // ```
     //    ASSIGN_OR_RETURN(auto pos, position());
@@ -100,6 +106,8 @@ public:
 
     StatusOr<int64_t> get_size() override { return _impl->get_size(); }
 
+    Status prefetch(int64_t offset, int64_t count) override { return _impl->prefetch(offset, count); }
+
     Status seek(int64_t offset) override { return _impl->seek(offset); }
 
 private:
@@ -0,0 +1,279 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "runtime/alloc_sampler.h"
+
+#include <fmt/format.h>
+#include <gperftools/stacktrace.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <map>
+#include <unordered_map>
+
+#include "common/logging.h"
+#include "gutil/strings/substitute.h"
+#include "runtime/current_thread.h"
+#include "runtime/mem_tracker.h"
+#include "util/pretty_printer.h"
+#include "util/stack_util.h"
+#include "util/time.h"
+
+namespace starrocks {
+
+// Whether the thread is recording a sample, the allocations inside it are not sampled.
+static thread_local bool tls_in_sampler = false;
+// Whether the sample distance of the thread is initialized, the first allocation of a thread only initializes it.
+static thread_local bool tls_sample_distance_initialized = false;
+static thread_local uint64_t tls_random_state = 0;
+
+static void copy_label(const std::string& label, char* out) {
+    const size_t len = std::min<size_t>(label.size(), AllocSampler::kMaxLabelLen - 1);
+    memcpy(out, label.data(), len);
+    out[len] = '\0';
+}
+
+AllocSampler* AllocSampler::instance() {
+    static AllocSampler sampler;
+    return &sampler;
+}
+
+Status AllocSampler::start(int64_t interval_bytes, size_t capacity) {
+    if (interval_bytes <= 0 || capacity == 0) {
+        return Status::InvalidArgument(strings::Substitute("Invalid interval $0 or capacity $1 of alloc sampler",
+                                                           interval_bytes, capacity));
+    }
+    std::lock_guard<std::mutex> l(_mutex);
+    if (_keys == nullptr) {
+        size_t n = 1;
+        while (n < capacity) {
+            n <<= 1;
+        }
+        // Allocated before running, so they are never sampled.
+        auto keys = std::make_unique<std::atomic<uintptr_t>[]>(n);
+        for (size_t i = 0; i < n; i++) {
+            keys[i].store(0, std::memory_order_relaxed);
+        }
+        _samples = std::make_unique<Sample[]>(n);
+        _keys = std::move(keys);
+        _capacity = n;
+    }
+    _interval_bytes.store(interval_bytes, std::memory_order_relaxed);
+    _s_running.store(true, std::memory_order_release);
+    LOG(INFO) << "Start alloc sampler, interval=" << interval_bytes << " bytes, capacity=" << _capacity;
+    return Status::OK();
+}
+
+void AllocSampler::stop() {
+    _s_running.store(false, std::memory_order_relaxed);
+}
+
+int64_t AllocSampler::_next_sample_distance() {
+    // xorshift64*, which doesn't allocate.
+    if (UNLIKELY(tls_random_state == 0)) {
+        tls_random_state = reinterpret_cast<uintptr_t>(&tls_random_state) ^ static_cast<uint64_t>(MonotonicNanos());
+        tls_random_state |= 1;
+    }
+    tls_random_state ^= tls_random_state >> 12;
+    tls_random_state ^= tls_random_state << 25;
+    tls_random_state ^= tls_random_state >> 27;
+    const uint64_t r = tls_random_state * 2685821657736338717ULL;
+    // Uniform in (0, 1].
+    const double u = (static_cast<double>(r >> 11) + 1) / 9007199254740992.0;
+    // The distances between the samples are exponentially distributed, i.e. the sampled bytes are a poisson process.
+    const double distance = -std::log(u) * _interval_bytes.load(std::memory_order_relaxed);
+    return std::max<int64_t>(static_cast<int64_t>(distance), 1);
+}
+
+size_t AllocSampler::_slot_of(uintptr_t key) const {
+    // The low bits are mostly zero because of the alignment.
+    return static_cast<size_t>((key >> 4) * 0x9E3779B97F4A7C15ULL >> 20) & (_capacity - 1);
+}
+
+void AllocSampler::record_alloc(void* ptr, size_t size) {
+    if (tls_in_sampler) {
+        return;
+    }
+    tls_in_sampler = true;
+    const int64_t interval = _interval_bytes.load(std::memory_order_relaxed);
+    _tls_bytes_until_sample = _next_sample_distance();
+    if (UNLIKELY(!tls_sample_distance_initialized)) {
+        tls_sample_distance_initialized = true;
+        tls_in_sampler = false;
+        return;
+    }
+    if (ptr == nullptr || _keys == nullptr) {
+        tls_in_sampler = false;
+        return;
+    }
+
+    const auto key = reinterpret_cast<uintptr_t>(ptr);
+    const size_t begin = _slot_of(key);
+    for (int i = 0; i < kMaxProbes; i++) {
+        const size_t slot = (begin + i) & (_capacity - 1);
+        uintptr_t expected = 0;
+        if (!_keys[slot].compare_exchange_strong(expected, kBusyKey, std::memory_order_acquire)) {
+            continue;
+        }
+        Sample& sample = _samples[slot];
+        sample.size = static_cast<int64_t>(size);
+        // An allocation of s bytes is sampled with the probability 1 - exp(-s / interval).
+        const double s = static_cast<double>(size);
+        sample.weight = static_cast<int64_t>(s / -std::expm1(-s / interval));
+        sample.timestamp_ns = MonotonicNanos();
+        MemTracker* tracker = tls_is_thread_status_init ? CurrentThread::mem_tracker() : nullptr;
+        if (tracker != nullptr) {
+            copy_label(tracker->label(), sample.tracker_label);
+            MemTracker* subsystem = tracker;
+            while (subsystem->parent() != nullptr && subsystem->parent()->parent() != nullptr) {
+                subsystem = subsystem->parent();
+            }
+            copy_label(subsystem->label(), sample.subsystem);
+        } else {
+            copy_label("untracked", sample.tracker_label);
+            copy_label("untracked", sample.subsystem);
+        }
+        // Skip the frames of the sampler and the hook.
+        sample.depth = GetStackTrace(sample.frames, kMaxDepth, 2);
+        _keys[slot].store(key, std::memory_order_release);
+        _s_num_live_samples.fetch_add(1, std::memory_order_relaxed);
+        tls_in_sampler = false;
+        return;
+    }
+    _num_dropped_samples.fetch_add(1, std::memory_order_relaxed);
+    tls_in_sampler = false;
+}
+
+void AllocSampler::_remove(void* ptr) {
+    if (_keys == nullptr) {
+        return;
+    }
+    const auto key = reinterpret_cast<uintptr_t>(ptr);
+    const size_t begin = _slot_of(key);
+    // The slots are emptied by the removals, so all the probes are checked.
+    for (int i = 0; i < kMaxProbes; i++) {
+        const size_t slot = (begin + i) & (_capacity - 1);
+        uintptr_t expected = key;
+        if (_keys[slot].load(std::memory_order_relaxed) == key &&
+            _keys[slot].compare_exchange_strong(expected, 0, std::memory_order_acq_rel)) {
+            _s_num_live_samples.fetch_sub(1, std::memory_order_relaxed);
+            return;
+        }
+    }
+}
+
+std::vector<AllocSampler::Sample> AllocSampler::get_live_samples() const {
+    std::vector<Sample> samples;
+    if (_keys == nullptr) {
+        return samples;
+    }
+    samples.reserve(num_live_samples());
+    Sample sample;
+    for (size_t slot = 0; slot < _capacity; slot++) {
+        const uintptr_t key = _keys[slot].load(std::memory_order_acquire);
+        if (key == 0 || key == kBusyKey) {
+            continue;
+        }
+        memcpy(&sample, &_samples[slot], sizeof(Sample));
+        std::atomic_thread_fence(std::memory_order_acquire);
+        // Freed during the copy.
+        if (_keys[slot].load(std::memory_order_relaxed) != key) {
+            continue;
+        }
+        samples.emplace_back(sample);
+    }
+    return samples;
+}
+
+std::string AllocSampler::to_top_sites(const std::vector<Sample>& samples, size_t limit) {
+    struct Site {
+        const Sample* first;
+        int64_t bytes = 0;
+        int64_t count = 0;
+        std::map<std::string, int64_t> tracker_bytes;
+    };
+    // The stacks are compared by the frames.
+    std::map<std::vector<void*>, Site> sites;
+    int64_t total_bytes = 0;
+    for (const auto& sample : samples) {
+        auto& site = sites[std::vector<void*>(sample.frames, sample.frames + sample.depth)];
+        if (site.count == 0) {
+            site.first = &sample;
+        }
+        site.bytes += sample.weight;
+        site.count++;
+        site.tracker_bytes[sample.tracker_label] += sample.weight;
+        total_bytes += sample.weight;
+    }
+    std::vector<const Site*> sorted;
+    sorted.reserve(sites.size());
+    for (const auto& [_, site] : sites) {
+        sorted.emplace_back(&site);
+    }
+    std::sort(sorted.begin(), sorted.end(), [](const Site* a, const Site* b) { return a->bytes > b->bytes; });
+    if (sorted.size() > limit) {
+        sorted.resize(limit);
+    }
+
+    FrameSymbolizer symbolizer;
+    std::string res = fmt::format("Live samples: {}, estimated live bytes: {}, allocation sites: {}\n",
+                                  samples.size(), PrettyPrinter::print(total_bytes, TUnit::BYTES), sites.size());
+    for (const auto* site : sorted) {
+        const auto top_tracker = std::max_element(site->tracker_bytes.begin(), site->tracker_bytes.end(),
+                                                  [](const auto& a, const auto& b) { return a.second < b.second; });
+        res.append(fmt::format("\n{} ({:.2f}%) in {} samples, mostly by MemTracker {}\n",
+                               PrettyPrinter::print(site->bytes, TUnit::BYTES),
+                               site->bytes * 100.0 / std::max<int64_t>(total_bytes, 1), site->count,
+                               top_tracker->first));
+        for (int i = 0; i < site->first->depth; i++) {
+            res.append("    ").append(symbolizer.symbolize(site->first->frames[i], i > 0)).append("\n");
+        }
+    }
+    return res;
+}
+
+std::string AllocSampler::to_collapsed_stacks(const std::vector<Sample>& samples) {
+    FrameSymbolizer symbolizer;
+    std::map<std::string, int64_t> stacks;
+    std::string stack;
+    for (const auto& sample : samples) {
+        stack.clear();
+        stack.append(sample.subsystem).append(";").append(sample.tracker_label);
+        for (int i = sample.depth - 1; i >= 0; i--) {
+            stack.push_back(';');
+            stack.append(symbolizer.symbolize(sample.frames[i], i > 0));
+        }
+        stacks[stack] += sample.weight;
+    }
+    std::string res;
+    for (const auto& [s, bytes] : stacks) {
+        res.append(s).append(" ").append(std::to_string(bytes)).append("\n");
+    }
+    return res;
+}
+
+std::string AllocSampler::to_tracker_breakdown(const std::vector<Sample>& samples) {
+    std::map<std::string, std::map<std::string, int64_t>> subsystems;
+    for (const auto& sample : samples) {
+        subsystems[sample.subsystem][sample.tracker_label] += sample.weight;
+    }
+    std::vector<std::pair<std::string, int64_t>> sorted;
+    std::string res;
+    for (const auto& [subsystem, trackers] : subsystems) {
+        int64_t bytes = 0;
+        for (const auto& [_, tracker_bytes] : trackers) {
+            bytes += tracker_bytes;
+        }
+        res.append(fmt::format("{}: {}\n", subsystem, PrettyPrinter::print(bytes, TUnit::BYTES)));
+        sorted.assign(trackers.begin(), trackers.end());
+        std::sort(sorted.begin(), sorted.end(), [](const auto& a, const auto& b) { return a.second > b.second; });
+        for (const auto& [tracker, tracker_bytes] : sorted) {
+            if (tracker != subsystem) {
+                res.append(fmt::format("    {}: {}\n", tracker, PrettyPrinter::print(tracker_bytes, TUnit::BYTES)));
+            }
+        }
+    }
+    return res;
+}
+
+} // namespace starrocks
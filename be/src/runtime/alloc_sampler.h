@@ -0,0 +1,115 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "common/compiler_util.h"
+#include "common/status.h"
+
+namespace starrocks {
+
+// AllocSampler samples the allocations by the hooks of malloc, and keeps the stack, the size and the MemTracker of
+// each sampled allocation until it's freed. So the live memory can be broken down by the allocation sites and the
+// MemTracker labels, including the memory consumed but not released of a finished query.
+//
+// The allocations are sampled once per |interval_bytes| allocated by each thread on average, and the distance
+// between the samples is random, so the large allocations are always sampled and the small ones are sampled in
+// proportion to their sizes. Each sample is weighted by the bytes it represents, so the sum of the weights of the
+// live samples estimates the live bytes.
+//
+// The live samples are kept in a fixed size table keyed by the address without locks or allocations, since they
+// are recorded inside malloc. The samples beyond the capacity of the table are dropped.
+class AllocSampler {
+public:
+    static constexpr int kMaxDepth = 32;
+    static constexpr int kMaxLabelLen = 48;
+
+    struct Sample {
+        // The requested size.
+        int64_t size;
+        // The estimated bytes allocated by the allocations represented by this sample.
+        int64_t weight;
+        int64_t timestamp_ns;
+        int32_t depth;
+        // The label of the MemTracker of the thread.
+        char tracker_label[kMaxLabelLen];
+        // The label of the ancestor of the MemTracker under the process MemTracker, e.g. query_pool or compaction.
+        char subsystem[kMaxLabelLen];
+        // From the innermost frame.
+        void* frames[kMaxDepth];
+    };
+
+    static AllocSampler* instance();
+
+    // Starts sampling once per |interval_bytes| allocated, keeping at most |capacity| live samples.
+    // The capacity is fixed when it's started for the first time.
+    Status start(int64_t interval_bytes, size_t capacity);
+    // The live samples are still removed when they are freed after stopping.
+    void stop();
+    bool is_running() const { return _s_running.load(std::memory_order_relaxed); }
+
+    // Called by each allocation of |size| bytes, returns true if the allocation should be recorded.
+    static bool should_sample(size_t size) {
+        if (LIKELY(!_s_running.load(std::memory_order_relaxed))) {
+            return false;
+        }
+        _tls_bytes_until_sample -= static_cast<int64_t>(size);
+        return UNLIKELY(_tls_bytes_until_sample <= 0);
+    }
+    // Called by each free, which costs a load if there is no live sample.
+    static void on_free(void* ptr) {
+        if (LIKELY(_s_num_live_samples.load(std::memory_order_relaxed) == 0) || ptr == nullptr) {
+            return;
+        }
+        instance()->_remove(ptr);
+    }
+    // Records the allocation returned by malloc, and draws the distance to the next sample of the thread.
+    // The first sampled allocation of each thread only draws the distance, since it's sampled regardless of its size.
+    void record_alloc(void* ptr, size_t size);
+
+    // Returns the consistent live samples.
+    std::vector<Sample> get_live_samples() const;
+    int64_t num_live_samples() const { return _s_num_live_samples.load(std::memory_order_relaxed); }
+    int64_t num_dropped_samples() const { return _num_dropped_samples.load(std::memory_order_relaxed); }
+
+    // Aggregates the samples into the top |limit| allocation sites by the estimated live bytes.
+    static std::string to_top_sites(const std::vector<Sample>& samples, size_t limit);
+    // Aggregates the samples into the collapsed stacks weighted by the estimated live bytes, with the subsystem and
+    // the MemTracker as the root frames, which is the input of flamegraph.pl.
+    static std::string to_collapsed_stacks(const std::vector<Sample>& samples);
+    // Aggregates the estimated live bytes by the subsystem and the MemTracker label.
+    static std::string to_tracker_breakdown(const std::vector<Sample>& samples);
+
+private:
+    AllocSampler() = default;
+
+    static constexpr int kMaxProbes = 16;
+    // The key of a slot being written.
+    static constexpr uintptr_t kBusyKey = 1;
+
+    int64_t _next_sample_distance();
+    size_t _slot_of(uintptr_t key) const;
+    void _remove(void* ptr);
+
+    static inline std::atomic<bool> _s_running{false};
+    static inline std::atomic<int64_t> _s_num_live_samples{0};
+    static inline thread_local int64_t _tls_bytes_until_sample = 0;
+
+    std::mutex _mutex;
+    std::atomic<int64_t> _interval_bytes{0};
+    std::atomic<int64_t> _num_dropped_samples{0};
+    // A power of 2.
+    size_t _capacity = 0;
+    // The addresses of the live samples, 0 if the slot is empty.
+    std::unique_ptr<std::atomic<uintptr_t>[]> _keys;
+    std::unique_ptr<Sample[]> _samples;
+};
+
+} // namespace starrocks
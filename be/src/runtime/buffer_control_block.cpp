@@ -21,6 +21,8 @@
 
 #include "runtime/buffer_control_block.h"
 
+#include <algorithm>
+#include <limits>
 #include <utility>
 
 #include "gen_cpp/InternalService_types.h"
@@ -53,7 +55,13 @@ void GetResultBatchCtx::on_close(int64_t packet_seq, QueryStatistics* statistics
 void GetResultBatchCtx::on_data(TFetchDataResult* t_result, int64_t packet_seq, bool eos) {
     uint8_t* buf = nullptr;
     uint32_t len = 0;
-    ThriftSerializer ser(false, 4096);
+    // The buffer of the serializer is allocated for the rows at once, instead of growing by doubling from a few
+    // KBs and copying the rows serialized so far again and again, which costs much for the large results.
+    size_t estimated_size = 4096;
+    for (const auto& row : t_result->result_batch.rows) {
+        estimated_size += sizeof(int32_t) + row.size();
+    }
+    ThriftSerializer ser(false, static_cast<int>(std::min<size_t>(estimated_size, std::numeric_limits<int>::max())));
     auto st = ser.serialize(&t_result->result_batch, &len, &buf);
     if (st.ok()) {
         cntl->response_attachment().append(buf, len);
@@ -2,6 +2,7 @@
 
 #include "runtime/chunk_cursor.h"
 
+#include <algorithm>
 #include <utility>
 
 #include "column/chunk.h"
@@ -43,16 +44,20 @@ ChunkCursor::ChunkCursor(ChunkSupplier chunk_supplier, ChunkProbeSupplier chunk_
 ChunkCursor::~ChunkCursor() = default;
 
 bool ChunkCursor::operator<(const ChunkCursor& cursor) const {
-    DCHECK_EQ(_current_order_by_columns.size(), cursor._current_order_by_columns.size());
     // both cursors must be pointing to valid data.
     DCHECK(_current_pos >= 0 && _current_chunk != nullptr);
     DCHECK(cursor._current_pos >= 0 && cursor._current_chunk != nullptr);
+    return _is_row_before(_current_pos, cursor, cursor._current_pos);
+}
+
+bool ChunkCursor::_is_row_before(int32_t pos, const ChunkCursor& other, int32_t other_pos) const {
+    DCHECK_EQ(_current_order_by_columns.size(), other._current_order_by_columns.size());
     const size_t number_of_order_by_columns = _current_order_by_columns.size();
     bool is_ahead = true;
     for (size_t col_index = 0; col_index < number_of_order_by_columns; ++col_index) {
         const auto& left_col = _current_order_by_columns[col_index];
-        const auto& right_col = cursor._current_order_by_columns[col_index];
-        int cmp = left_col->compare_at(_current_pos, cursor._current_pos, *right_col, _null_first_flag[col_index]);
+        const auto& right_col = other._current_order_by_columns[col_index];
+        int cmp = left_col->compare_at(pos, other_pos, *right_col, _null_first_flag[col_index]);
         if (cmp != 0) {
             if (_sort_order_flag[col_index] > 0) {
                 is_ahead = cmp < 0;
@@ -65,6 +70,43 @@ bool ChunkCursor::operator<(const ChunkCursor& cursor) const {
     return is_ahead;
 }
 
+size_t ChunkCursor::count_following_rows(size_t max_rows) const {
+    DCHECK(is_valid());
+    return std::min<size_t>(max_rows, _current_chunk->num_rows() - _current_pos - 1);
+}
+
+size_t ChunkCursor::count_following_rows_not_after(const ChunkCursor& bound, size_t max_rows) const {
+    DCHECK(is_valid() && bound.is_valid());
+    const size_t last = _current_pos + count_following_rows(max_rows);
+    // The row at pos isn't after the bound, iff the bound is not before it.
+    auto is_not_after = [&](size_t pos) { return !bound._is_row_before(bound._current_pos, *this, pos); };
+
+    // Gallop: the rows in (_current_pos, lo] are not after the bound, and the row at hi is after the bound if hi
+    // doesn't exceed the last row.
+    size_t lo = _current_pos;
+    size_t step = 1;
+    while (lo + step <= last && is_not_after(lo + step)) {
+        lo += step;
+        step *= 2;
+    }
+    size_t hi = std::min(lo + step, last + 1);
+    while (hi - lo > 1) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (is_not_after(mid)) {
+            lo = mid;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo - _current_pos;
+}
+
+void ChunkCursor::skip_in_chunk(size_t num_rows) {
+    DCHECK(is_valid());
+    DCHECK_LT(_current_pos + num_rows, _current_chunk->num_rows());
+    _current_pos += num_rows;
+}
+
 bool ChunkCursor::is_valid() const {
     return _current_pos >= 0 && _current_chunk != nullptr;
 }
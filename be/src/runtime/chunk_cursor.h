@@ -40,6 +40,16 @@ public:
     // Whether the record referenced by this cursor is before the one referenced by cursor.
     bool operator<(const ChunkCursor& cursor) const;
 
+    // Return the number of rows following the current row in the current chunk, which are not after the record
+    // referenced by |bound|, at most |max_rows|. These rows can be output together with the current row while merging.
+    // Since the rows of a chunk are sorted, it gallops from the current row and then binary searches, which costs
+    // O(log(n)) comparisons for a run of n rows.
+    size_t count_following_rows_not_after(const ChunkCursor& bound, size_t max_rows) const;
+    // Return the number of rows following the current row in the current chunk, at most |max_rows|.
+    size_t count_following_rows(size_t max_rows) const;
+    // Move forward |num_rows| rows within the current chunk.
+    void skip_in_chunk(size_t num_rows);
+
     // Move to next row.
     void next();
     // Return if there is new chunk.
@@ -63,6 +73,8 @@ public:
 
 private:
     void _reset_with_next_chunk();
+    // Whether the row at |pos| of this cursor is before the row at |other_pos| of |other|.
+    bool _is_row_before(int32_t pos, const ChunkCursor& other, int32_t other_pos) const;
 
 private:
     ChunkSupplier _chunk_supplier;
@@ -0,0 +1,254 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "runtime/cpu_sampler.h"
+
+#include <fmt/format.h>
+#include <gperftools/stacktrace.h>
+#include <signal.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <map>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "common/logging.h"
+#include "gutil/strings/substitute.h"
+#include "runtime/current_thread.h"
+#include "util/stack_util.h"
+#include "util/time.h"
+
+#ifndef sigev_notify_thread_id
+#define sigev_notify_thread_id _sigev_un._tid
+#endif
+
+namespace starrocks {
+
+// Not SIGPROF, which is used by the cpu profiler of gperftools behind /pprof/profile.
+static int sampling_signal() {
+    return SIGRTMIN + 4;
+}
+
+static void sampling_signal_handler(int, siginfo_t*, void* ucontext) {
+    const int saved_errno = errno;
+    CpuSampler::instance()->take_sample(ucontext);
+    errno = saved_errno;
+}
+
+// The sampling timer of the thread, deleted when the thread exits.
+//
+// It's created after tls_thread_status in the same thread, so it's destroyed before tls_thread_status and the
+// signal handler never reads a destroyed tls_thread_status.
+struct ThreadSamplingTimer {
+    ~ThreadSamplingTimer() {
+        if (created) {
+            timer_delete(timer_id);
+        }
+    }
+
+    bool created = false;
+    timer_t timer_id;
+};
+
+CpuSampler* CpuSampler::instance() {
+    static CpuSampler sampler;
+    return &sampler;
+}
+
+Status CpuSampler::start(int frequency_hz, size_t capacity) {
+    if (frequency_hz <= 0 || capacity == 0) {
+        return Status::InvalidArgument(
+                strings::Substitute("Invalid frequency $0 or capacity $1 of cpu sampler", frequency_hz, capacity));
+    }
+    std::lock_guard<std::mutex> l(_mutex);
+    if (_started) {
+        _running.store(true, std::memory_order_relaxed);
+        return Status::OK();
+    }
+    _capacity = capacity;
+    _slots = std::make_unique<Slot[]>(capacity);
+    _interval_ns = std::max<int64_t>(1000000000L / frequency_hz, 1000000L);
+
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_sigaction = sampling_signal_handler;
+    action.sa_flags = SA_SIGINFO | SA_RESTART;
+    sigemptyset(&action.sa_mask);
+    if (sigaction(sampling_signal(), &action, nullptr) != 0) {
+        return Status::InternalError(strings::Substitute("Fail to install the signal handler of cpu sampler: $0",
+                                                         strerror(errno)));
+    }
+    _started = true;
+    _running.store(true, std::memory_order_release);
+    LOG(INFO) << "Start cpu sampler, frequency=" << frequency_hz << "Hz, capacity=" << capacity;
+    return Status::OK();
+}
+
+void CpuSampler::stop() {
+    _running.store(false, std::memory_order_relaxed);
+}
+
+void CpuSampler::register_current_thread() {
+    if (!_running.load(std::memory_order_acquire)) {
+        return;
+    }
+    thread_local ThreadSamplingTimer timer;
+    if (timer.created) {
+        return;
+    }
+    struct sigevent event;
+    memset(&event, 0, sizeof(event));
+    event.sigev_notify = SIGEV_THREAD_ID;
+    event.sigev_signo = sampling_signal();
+    event.sigev_notify_thread_id = static_cast<pid_t>(syscall(SYS_gettid));
+    if (timer_create(CLOCK_THREAD_CPUTIME_ID, &event, &timer.timer_id) != 0) {
+        LOG_EVERY_N(WARNING, 100) << "Fail to create the timer of cpu sampler: " << strerror(errno);
+        return;
+    }
+    struct itimerspec spec;
+    spec.it_interval.tv_sec = _interval_ns / 1000000000L;
+    spec.it_interval.tv_nsec = _interval_ns % 1000000000L;
+    spec.it_value = spec.it_interval;
+    if (timer_settime(timer.timer_id, 0, &spec, nullptr) != 0) {
+        LOG_EVERY_N(WARNING, 100) << "Fail to start the timer of cpu sampler: " << strerror(errno);
+        timer_delete(timer.timer_id);
+        return;
+    }
+    timer.created = true;
+}
+
+void CpuSampler::take_sample(const void* ucontext) {
+    if (!_running.load(std::memory_order_acquire) || !tls_is_thread_status_init) {
+        return;
+    }
+    const uint64_t seq = _next.fetch_add(1, std::memory_order_relaxed);
+    Slot& slot = _slots[seq % _capacity];
+    slot.version.store(2 * seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    Sample& sample = slot.sample;
+    sample.timestamp_ns = MonotonicNanos();
+    const TUniqueId& query_id = tls_thread_status.query_id();
+    sample.query_id_hi = query_id.hi;
+    sample.query_id_lo = query_id.lo;
+    sample.workgroup_id = tls_thread_status.workgroup_id();
+    sample.plan_node_id = tls_thread_status.plan_node_id();
+    const char* name = tls_thread_status.operator_name();
+    int len = 0;
+    if (name != nullptr) {
+        for (; len < kMaxOperatorNameLen - 1 && name[len] != '\0'; len++) {
+            sample.operator_name[len] = name[len];
+        }
+    }
+    sample.operator_name[len] = '\0';
+    // Skip the frames of the signal handler.
+    sample.depth = GetStackTraceWithContext(sample.frames, kMaxDepth, 2, ucontext);
+
+    slot.version.store(2 * seq + 2, std::memory_order_release);
+}
+
+std::vector<CpuSampler::Sample> CpuSampler::get_samples(const Filter& filter) const {
+    std::vector<Sample> samples;
+    if (_slots == nullptr) {
+        return samples;
+    }
+    const uint64_t end = _next.load(std::memory_order_acquire);
+    const uint64_t begin = end > _capacity ? end - _capacity : 0;
+    Sample sample;
+    for (uint64_t seq = begin; seq < end; seq++) {
+        const Slot& slot = _slots[seq % _capacity];
+        const uint64_t version = slot.version.load(std::memory_order_acquire);
+        if (version != 2 * seq + 2) {
+            // Still being written, or overwritten by a newer sample.
+            continue;
+        }
+        memcpy(&sample, &slot.sample, sizeof(Sample));
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.version.load(std::memory_order_relaxed) != version) {
+            continue;
+        }
+        if (sample.timestamp_ns < filter.since_ns) {
+            continue;
+        }
+        if ((filter.query_id_hi != 0 || filter.query_id_lo != 0) &&
+            (sample.query_id_hi != filter.query_id_hi || sample.query_id_lo != filter.query_id_lo)) {
+            continue;
+        }
+        if (filter.workgroup_id >= 0 && sample.workgroup_id != filter.workgroup_id) {
+            continue;
+        }
+        samples.emplace_back(sample);
+    }
+    return samples;
+}
+
+std::string CpuSampler::to_collapsed_stacks(const std::vector<Sample>& samples, bool with_operator) {
+    FrameSymbolizer symbolizer;
+    std::map<std::string, int64_t> stacks;
+    std::string stack;
+    for (const auto& sample : samples) {
+        stack.clear();
+        if (with_operator && sample.operator_name[0] != '\0') {
+            stack.append(strings::Substitute("$0_$1", sample.operator_name, sample.plan_node_id));
+        }
+        for (int i = sample.depth - 1; i >= 0; i--) {
+            if (!stack.empty()) {
+                stack.push_back(';');
+            }
+            stack.append(symbolizer.symbolize(sample.frames[i], i > 0));
+        }
+        if (!stack.empty()) {
+            stacks[stack]++;
+        }
+    }
+    std::string res;
+    for (const auto& [s, count] : stacks) {
+        res.append(s).append(" ").append(std::to_string(count)).append("\n");
+    }
+    return res;
+}
+
+std::string CpuSampler::to_top_functions(const std::vector<Sample>& samples, size_t limit) {
+    struct Counts {
+        int64_t self = 0;
+        int64_t total = 0;
+    };
+    FrameSymbolizer symbolizer;
+    std::unordered_map<std::string, Counts> functions;
+    std::unordered_set<std::string> seen;
+    for (const auto& sample : samples) {
+        seen.clear();
+        for (int i = 0; i < sample.depth; i++) {
+            const std::string& symbol = symbolizer.symbolize(sample.frames[i], i > 0);
+            auto& counts = functions[symbol];
+            if (i == 0) {
+                counts.self++;
+            }
+            // The recursive calls are counted once per sample.
+            if (seen.insert(symbol).second) {
+                counts.total++;
+            }
+        }
+    }
+    std::vector<std::pair<std::string, Counts>> sorted(functions.begin(), functions.end());
+    std::sort(sorted.begin(), sorted.end(), [](const auto& a, const auto& b) {
+        return a.second.self != b.second.self ? a.second.self > b.second.self : a.second.total > b.second.total;
+    });
+    if (sorted.size() > limit) {
+        sorted.resize(limit);
+    }
+    const double num_samples = std::max<size_t>(samples.size(), 1);
+    std::string res = fmt::format("Total samples: {}\n{:>8} {:>7} {:>8} {:>7}  function\n", samples.size(), "self",
+                                  "self%", "total", "total%");
+    for (const auto& [symbol, counts] : sorted) {
+        res.append(fmt::format("{:>8} {:>6.2f}% {:>8} {:>6.2f}%  {}\n", counts.self, counts.self * 100 / num_samples,
+                               counts.total, counts.total * 100 / num_samples, symbol));
+    }
+    return res;
+}
+
+} // namespace starrocks
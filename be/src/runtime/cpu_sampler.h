@@ -0,0 +1,97 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "common/status.h"
+
+namespace starrocks {
+
+// CpuSampler samples the stacks of the threads running the queries at a low frequency, and tags each sample with
+// the query, the workgroup and the operator running on the thread, taken from CurrentThread. So the cpu time of a
+// single query or workgroup can be analyzed by a flame graph or the top functions, even after the query finishes.
+//
+// Each thread is sampled by a timer of its own cpu time, which is created when the thread runs a query for the
+// first time, so the samples of a thread are proportional to its cpu time and the idle threads cost nothing.
+// The samples are written into a fixed size ring buffer by the signal handler without locks or allocations,
+// and only the latest samples are kept.
+class CpuSampler {
+public:
+    static constexpr int kMaxDepth = 32;
+    static constexpr int kMaxOperatorNameLen = 32;
+
+    struct Sample {
+        int64_t timestamp_ns;
+        int64_t query_id_hi;
+        int64_t query_id_lo;
+        int64_t workgroup_id;
+        int32_t plan_node_id;
+        int32_t depth;
+        // The name of the operator, empty if the thread is not running an operator.
+        char operator_name[kMaxOperatorNameLen];
+        // From the innermost frame.
+        void* frames[kMaxDepth];
+    };
+
+    struct Filter {
+        // 0 means any query.
+        int64_t query_id_hi = 0;
+        int64_t query_id_lo = 0;
+        // -1 means any workgroup.
+        int64_t workgroup_id = -1;
+        // Only the samples taken since it, in MonotonicNanos().
+        int64_t since_ns = 0;
+    };
+
+    static CpuSampler* instance();
+
+    // Starts sampling |frequency_hz| times per second of the cpu time of each thread, keeping the latest
+    // |capacity| samples. It can be started only once.
+    Status start(int frequency_hz, size_t capacity);
+    // The samples are kept after stopping, and the timers of the threads are kept but do nothing.
+    void stop();
+    bool is_running() const { return _running.load(std::memory_order_relaxed); }
+
+    // Creates the sampling timer of the calling thread if the sampler is started, it's called once per thread.
+    void register_current_thread();
+
+    // Returns the consistent samples matching the filter, from the oldest.
+    std::vector<Sample> get_samples(const Filter& filter) const;
+    uint64_t num_samples_taken() const { return _next.load(std::memory_order_relaxed); }
+
+    // Aggregates the samples into the collapsed stacks, i.e. one line of "root;...;leaf count" per distinct stack,
+    // which is the input of flamegraph.pl and speedscope. The operator is the root frame if |with_operator|.
+    static std::string to_collapsed_stacks(const std::vector<Sample>& samples, bool with_operator);
+    // Aggregates the samples into the top |limit| functions by the self samples, with the total samples including
+    // the callees of each function.
+    static std::string to_top_functions(const std::vector<Sample>& samples, size_t limit);
+
+    // Records a sample of the calling thread, it's called by the signal handler.
+    void take_sample(const void* ucontext);
+
+private:
+    CpuSampler() = default;
+
+    // The slot is being written if the version is odd. The version of the n-th sample is 2 * n + 2 after written,
+    // so a reader can tell whether the slot is overwritten during its read.
+    struct Slot {
+        std::atomic<uint64_t> version{0};
+        Sample sample;
+    };
+
+    std::mutex _mutex;
+    bool _started = false;
+    std::atomic<bool> _running{false};
+    int64_t _interval_ns = 0;
+    size_t _capacity = 0;
+    std::unique_ptr<Slot[]> _slots;
+    std::atomic<uint64_t> _next{0};
+};
+
+} // namespace starrocks
@@ -2,6 +2,7 @@
 
 #include "runtime/current_thread.h"
 
+#include "runtime/cpu_sampler.h"
 #include "runtime/exec_env.h"
 #include "storage/storage_engine.h"
 
@@ -17,6 +18,15 @@ CurrentThread::~CurrentThread() {
     tls_is_thread_status_init = false;
 }
 
+void CurrentThread::_register_cpu_sampler() {
+    // Only the threads running the queries are sampled.
+    if (_query_id.hi == 0 && _query_id.lo == 0) {
+        return;
+    }
+    _is_cpu_sampler_registered = true;
+    CpuSampler::instance()->register_current_thread();
+}
+
 starrocks::MemTracker* CurrentThread::mem_tracker() {
     if (UNLIKELY(tls_mem_tracker == nullptr)) {
         tls_mem_tracker = ExecEnv::GetInstance()->process_mem_tracker();
@@ -48,9 +48,26 @@ public:
         }
     }
 
-    void set_query_id(const starrocks::TUniqueId& query_id) { _query_id = query_id; }
+    void set_query_id(const starrocks::TUniqueId& query_id) {
+        _query_id = query_id;
+        if (UNLIKELY(!_is_cpu_sampler_registered)) {
+            _register_cpu_sampler();
+        }
+    }
     const starrocks::TUniqueId& query_id() { return _query_id; }
 
+    void set_workgroup_id(int64_t workgroup_id) { _workgroup_id = workgroup_id; }
+    int64_t workgroup_id() const { return _workgroup_id; }
+
+    // The operator running on the thread, which tags the samples of CpuSampler.
+    // The name should outlive the period it's set.
+    void set_operator(int32_t plan_node_id, const char* operator_name) {
+        _plan_node_id = plan_node_id;
+        _operator_name = operator_name;
+    }
+    int32_t plan_node_id() const { return _plan_node_id; }
+    const char* operator_name() const { return _operator_name; }
+
     void set_fragment_instance_id(const starrocks::TUniqueId& fragment_instance_id) {
         _fragment_instance_id = fragment_instance_id;
     }
@@ -58,9 +75,13 @@ public:
 
     // Return prev memory tracker.
     starrocks::MemTracker* set_mem_tracker(starrocks::MemTracker* mem_tracker) {
-        commit();
         auto* prev = tls_mem_tracker;
-        tls_mem_tracker = mem_tracker;
+        // the nested scopes of the same tracker, such as an operator under its driver, keep the cached
+        // consumption, instead of walking up the trackers with atomic adds at every entry and exit.
+        if (mem_tracker != prev) {
+            commit();
+            tls_mem_tracker = mem_tracker;
+        }
         return prev;
     }
 
@@ -155,6 +176,8 @@ public:
     }
 
 private:
+    void _register_cpu_sampler();
+
     const static int64_t BATCH_SIZE = 2 * 1024 * 1024;
 
     int64_t _cache_size = 0;
@@ -162,6 +185,10 @@ private:
     TUniqueId _query_id;
     TUniqueId _fragment_instance_id;
     int32_t _driver_id = 0;
+    int64_t _workgroup_id = -1;
+    int32_t _plan_node_id = -1;
+    const char* _operator_name = nullptr;
+    bool _is_cpu_sampler_registered = false;
     bool _is_catched = false;
     bool _check = true;
     int64_t _try_consume_mem_size = 0;
@@ -203,6 +230,26 @@ private:
     bool _prev_check;
 };
 
+class CurrentThreadOperatorSetter {
+public:
+    CurrentThreadOperatorSetter(int32_t plan_node_id, const char* operator_name)
+            : _prev_plan_node_id(tls_thread_status.plan_node_id()),
+              _prev_operator_name(tls_thread_status.operator_name()) {
+        tls_thread_status.set_operator(plan_node_id, operator_name);
+    }
+
+    ~CurrentThreadOperatorSetter() { tls_thread_status.set_operator(_prev_plan_node_id, _prev_operator_name); }
+
+    CurrentThreadOperatorSetter(const CurrentThreadOperatorSetter&) = delete;
+    void operator=(const CurrentThreadOperatorSetter&) = delete;
+    CurrentThreadOperatorSetter(CurrentThreadOperatorSetter&&) = delete;
+    void operator=(CurrentThreadOperatorSetter&&) = delete;
+
+private:
+    int32_t _prev_plan_node_id;
+    const char* _prev_operator_name;
+};
+
 class CurrentThreadCatchSetter {
 public:
     explicit CurrentThreadCatchSetter(bool catched) { _prev_catched = tls_thread_status.set_is_catched(catched); }
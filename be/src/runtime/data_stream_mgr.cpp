@@ -130,7 +130,8 @@ Status DataStreamMgr::transmit_data(const PTransmitDataParams* request, ::google
     return Status::OK();
 }
 
-Status DataStreamMgr::transmit_chunk(const PTransmitChunkParams& request, ::google::protobuf::Closure** done) {
+Status DataStreamMgr::transmit_chunk(const PTransmitChunkParams& request, ::google::protobuf::Closure** done,
+                                     int64_t* credit_bytes) {
     const PUniqueId& finst_id = request.finst_id();
     // TODO(zc): Use PUniqueId directly
     // We can use PUniqueId directly, because old version StarRocks has already use
@@ -164,6 +165,9 @@ Status DataStreamMgr::transmit_chunk(const PTransmitChunkParams& request, ::goog
     if (eos) {
         recvr->remove_sender(request.sender_id(), request.be_number());
     }
+    if (credit_bytes != nullptr) {
+        *credit_bytes = recvr->credit_bytes();
+    }
     return Status::OK();
 }
 
@@ -85,7 +85,9 @@ public:
 
     Status transmit_data(const PTransmitDataParams* request, ::google::protobuf::Closure** done);
 
-    Status transmit_chunk(const PTransmitChunkParams& request, ::google::protobuf::Closure** done);
+    // If credit_bytes isn't null, it's set to the credit of the receiver for the sender after adding the chunks.
+    Status transmit_chunk(const PTransmitChunkParams& request, ::google::protobuf::Closure** done,
+                          int64_t* credit_bytes = nullptr);
     // Closes all receivers registered for fragment_instance_id immediately.
     void cancel(const TUniqueId& fragment_instance_id);
 
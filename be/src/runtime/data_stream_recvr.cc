@@ -31,6 +31,7 @@
 #include <utility>
 
 #include "column/chunk.h"
+#include "exec/pipeline/poller_notifier.h"
 #include "exec/sort_exec_exprs.h"
 #include "gen_cpp/data.pb.h"
 #include "runtime/current_thread.h"
@@ -533,6 +534,7 @@ Status DataStreamRecvr::SenderQueue::add_chunks(const PTransmitChunkParams& requ
         _recvr->_num_buffered_bytes += total_chunk_bytes;
     }
     _data_arrival_cv.notify_one();
+    pipeline::PollerNotifier::instance()->notify();
     return Status::OK();
 }
 
@@ -689,6 +691,7 @@ Status DataStreamRecvr::SenderQueue::add_chunks_and_keep_order(const PTransmitCh
 
         _recvr->_num_buffered_bytes += total_chunk_bytes;
     }
+    pipeline::PollerNotifier::instance()->notify();
     return Status::OK();
 }
 
@@ -740,6 +743,7 @@ void DataStreamRecvr::SenderQueue::decrement_senders(int be_number) {
               << " be_number=" << be_number;
     if (_num_remaining_senders == 0) {
         _data_arrival_cv.notify_one();
+        pipeline::PollerNotifier::instance()->notify();
     }
 }
 
@@ -756,6 +760,7 @@ void DataStreamRecvr::SenderQueue::cancel() {
     // Wake up all threads waiting to produce/consume batches.  They will all
     // notice that the stream is cancelled and handle it.
     _data_arrival_cv.notify_all();
+    pipeline::PollerNotifier::instance()->notify();
 
     {
         std::lock_guard<std::mutex> l(_lock);
@@ -863,6 +868,7 @@ DataStreamRecvr::DataStreamRecvr(DataStreamMgr* stream_mgr, RuntimeState* runtim
           _fragment_instance_id(fragment_instance_id),
           _dest_node_id(dest_node_id),
           _total_buffer_limit(total_buffer_limit),
+          _num_senders(num_senders),
           _row_desc(row_desc),
           _is_merging(is_merging),
           _num_buffered_bytes(0),
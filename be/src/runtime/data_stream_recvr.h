@@ -21,6 +21,8 @@
 
 #pragma once
 
+#include <algorithm>
+
 #include "column/vectorized_fwd.h"
 #include "common/object_pool.h"
 #include "common/status.h"
@@ -136,6 +138,12 @@ private:
     // total buffer limit.
     bool exceeds_limit(int chunk_size) { return _num_buffered_bytes + chunk_size > _total_buffer_limit; }
 
+    // The credit advertised to each sender, i.e. the free buffer shared fairly by all the senders, so that
+    // a fast sender cannot occupy the whole buffer and block the other senders.
+    int64_t credit_bytes() const {
+        return std::max<int64_t>(0, _total_buffer_limit - _num_buffered_bytes) / std::max(1, _num_senders);
+    }
+
     // DataStreamMgr instance used to create this recvr. (Not owned)
     DataStreamMgr* _mgr;
 
@@ -148,6 +156,8 @@ private:
     // exceeds this value
     int _total_buffer_limit;
 
+    const int _num_senders;
+
     // Row schema, copied from the caller of CreateRecvr().
     RowDescriptor _row_desc;
 
@@ -0,0 +1,79 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "runtime/descriptor_tbl_cache.h"
+
+#include "common/object_pool.h"
+#include "runtime/descriptors.h"
+#include "util/thrift_util.h"
+
+namespace starrocks {
+
+struct DescriptorTblCache::Entry {
+    std::string key;
+    ObjectPool pool;
+    DescriptorTbl* tbl = nullptr;
+};
+
+bool DescriptorTblCache::is_cacheable(const TDescriptorTable& thrift_tbl) {
+    for (const auto& tdesc : thrift_tbl.tableDescriptors) {
+        switch (tdesc.tableType) {
+        case TTableType::HDFS_TABLE:
+        case TTableType::ICEBERG_TABLE:
+        case TTableType::HUDI_TABLE:
+            return false;
+        default:
+            break;
+        }
+    }
+    return true;
+}
+
+Status DescriptorTblCache::get_or_create(const TDescriptorTable& thrift_tbl, int32_t chunk_size, DescriptorTbl** tbl,
+                                         Handle* handle) {
+    ThriftSerializer serializer(false, 4096);
+    std::string key;
+    RETURN_IF_ERROR(serializer.serialize(&thrift_tbl, &key));
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto it = _entries.find(key);
+        if (it != _entries.end()) {
+            _lru_list.splice(_lru_list.begin(), _lru_list, it->second);
+            *handle = *it->second;
+            *tbl = (*handle)->tbl;
+            _hit_count++;
+            return Status::OK();
+        }
+    }
+
+    // Create the DescriptorTbl out of the lock, since it may be costly.
+    _miss_count++;
+    auto entry = std::make_shared<Entry>();
+    RETURN_IF_ERROR(DescriptorTbl::create(&entry->pool, thrift_tbl, &entry->tbl, chunk_size));
+    entry->key = std::move(key);
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto it = _entries.find(entry->key);
+    if (it != _entries.end()) {
+        // Another query has created and cached the same DescriptorTbl concurrently.
+        _lru_list.splice(_lru_list.begin(), _lru_list, it->second);
+        *handle = *it->second;
+    } else {
+        _lru_list.emplace_front(entry);
+        _entries.emplace(entry->key, _lru_list.begin());
+        while (_lru_list.size() > _capacity) {
+            _entries.erase(_lru_list.back()->key);
+            _lru_list.pop_back();
+        }
+        *handle = std::move(entry);
+    }
+    *tbl = (*handle)->tbl;
+    return Status::OK();
+}
+
+size_t DescriptorTblCache::size() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _lru_list.size();
+}
+
+} // namespace starrocks
@@ -0,0 +1,67 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "common/status.h"
+#include "gen_cpp/Descriptors_types.h"
+
+namespace starrocks {
+
+class DescriptorTbl;
+
+// DescriptorTblCache shares the DescriptorTbl created from the same TDescriptorTable across queries,
+// since BI tools usually issue the same parameterized query again and again, and rebuilding the descriptors
+// from thrift costs more than executing such a short query.
+//
+// The key is the serialized TDescriptorTable, so there is no false hit. The entries are evicted in LRU order,
+// and an evicted DescriptorTbl is kept alive until all the queries holding its handle have finished.
+//
+// A cached DescriptorTbl is shared by the concurrent queries, so it must not be modified after creation.
+// The caller shouldn't use the cache for the descriptor table which will be rewritten by the query,
+// e.g. when the query has low-cardinality global dicts.
+class DescriptorTblCache {
+public:
+    struct Entry;
+    using Handle = std::shared_ptr<const Entry>;
+
+    explicit DescriptorTblCache(size_t capacity) : _capacity(capacity) {}
+    ~DescriptorTblCache() = default;
+
+    DescriptorTblCache(const DescriptorTblCache&) = delete;
+    DescriptorTblCache& operator=(const DescriptorTblCache&) = delete;
+
+    // Whether the descriptor table doesn't contain the descriptors holding expressions, e.g. the partition
+    // keys of HDFS tables, which cannot be shared across queries.
+    static bool is_cacheable(const TDescriptorTable& thrift_tbl);
+
+    // Return the cached DescriptorTbl of thrift_tbl, or create and cache a new one.
+    // The returned *tbl is valid as long as the returned *handle is alive.
+    Status get_or_create(const TDescriptorTable& thrift_tbl, int32_t chunk_size, DescriptorTbl** tbl, Handle* handle);
+
+    size_t capacity() const { return _capacity; }
+    size_t size() const;
+    int64_t hit_count() const { return _hit_count; }
+    int64_t miss_count() const { return _miss_count; }
+
+private:
+    using LruList = std::list<std::shared_ptr<const Entry>>;
+
+    const size_t _capacity;
+
+    mutable std::mutex _mutex;
+    // The most recently used entry is at the front.
+    LruList _lru_list;
+    std::unordered_map<std::string, LruList::iterator> _entries;
+
+    std::atomic<int64_t> _hit_count = 0;
+    std::atomic<int64_t> _miss_count = 0;
+};
+
+} // namespace starrocks
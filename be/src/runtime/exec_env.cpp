@@ -28,18 +28,22 @@
 #include "common/logging.h"
 #include "exec/pipeline/driver_limiter.h"
 #include "exec/pipeline/pipeline_driver_executor.h"
+#include "exec/pipeline/query_cache.h"
 #include "exec/pipeline/query_context.h"
 #include "exec/workgroup/scan_executor.h"
 #include "exec/workgroup/work_group.h"
 #include "exec/workgroup/work_group_fwd.h"
+#include "formats/footer_cache.h"
 #include "gen_cpp/BackendService.h"
 #include "gen_cpp/FrontendService.h"
 #include "gen_cpp/HeartbeatService_types.h"
 #include "gen_cpp/TFileBrokerService.h"
 #include "gutil/strings/substitute.h"
+#include "io/block_cache.h"
 #include "runtime/broker_mgr.h"
 #include "runtime/client_cache.h"
 #include "runtime/data_stream_mgr.h"
+#include "runtime/descriptor_tbl_cache.h"
 #include "runtime/external_scan_context_mgr.h"
 #include "runtime/fragment_mgr.h"
 #include "runtime/heartbeat_flags.h"
@@ -57,6 +61,7 @@
 #include "runtime/stream_load/stream_load_executor.h"
 #include "runtime/stream_load/transaction_mgr.h"
 #include "runtime/thread_resource_mgr.h"
+#include "storage/decoded_column_cache.h"
 #include "storage/lake/group_assigner.h"
 #include "storage/lake/tablet_manager.h"
 #include "storage/page_cache.h"
@@ -236,6 +241,9 @@ Status ExecEnv::_init(const std::vector<StorePath>& store_paths) {
     _runtime_filter_worker = new RuntimeFilterWorker(this);
     _runtime_filter_cache = new RuntimeFilterCache(8);
     RETURN_IF_ERROR(_runtime_filter_cache->init());
+    if (config::descriptor_tbl_cache_capacity > 0) {
+        _descriptor_tbl_cache = new DescriptorTblCache(config::descriptor_tbl_cache_capacity);
+    }
 
     _backend_client_cache->init_metrics(StarRocksMetrics::instance()->metrics(), "backend");
     _frontend_client_cache->init_metrics(StarRocksMetrics::instance()->metrics(), "frontend");
@@ -272,6 +280,7 @@ Status ExecEnv::_init(const std::vector<StorePath>& store_paths) {
 
     RETURN_IF_ERROR(_load_channel_mgr->init(_load_mem_tracker));
     _heartbeat_flags = new HeartbeatFlags();
+    RETURN_IF_ERROR(_init_block_cache());
     return Status::OK();
 }
 
@@ -357,14 +366,47 @@ Status ExecEnv::_init_storage_page_cache() {
         LOG(WARNING) << "Config storage_page_cache_limit is greater than memory size, config="
                      << config::storage_page_cache_limit << ", memory=" << MemInfo::physical_mem();
     }
-    StoragePageCache::create_global_cache(_page_cache_mem_tracker, storage_cache_limit);
+    auto policy = config::storage_page_cache_scan_resistant ? CacheEvictionPolicy::SLRU : CacheEvictionPolicy::LRU;
+    StoragePageCache::create_global_cache(_page_cache_mem_tracker, storage_cache_limit, policy);
+
+    int64_t decoded_column_cache_limit = ParseUtil::parse_mem_spec(config::decoded_column_cache_limit);
+    if (decoded_column_cache_limit > 0) {
+        DecodedColumnCache::create_global_cache(_page_cache_mem_tracker, decoded_column_cache_limit);
+    }
+
+    int64_t footer_cache_limit = ParseUtil::parse_mem_spec(config::footer_cache_limit);
+    if (footer_cache_limit > 0) {
+        FooterCache::create_global_cache(_page_cache_mem_tracker, footer_cache_limit);
+    }
+
+    int64_t query_cache_limit = ParseUtil::parse_mem_spec(config::query_cache_limit);
+    if (query_cache_limit > 0) {
+        pipeline::QueryCache::create_global_cache(_page_cache_mem_tracker, query_cache_limit);
+    }
 
     // TODO(zc): The current memory usage configuration is a bit confusing,
     // we need to sort out the use of memory
     return Status::OK();
 }
 
+Status ExecEnv::_init_block_cache() {
+    if (!config::block_cache_enable) {
+        return Status::OK();
+    }
+    if (config::block_cache_block_size <= 0) {
+        return Status::InvalidArgument("Config block_cache_block_size must be positive");
+    }
+    io::BlockCacheOptions options;
+    options.mem_capacity = std::max<int64_t>(ParseUtil::parse_mem_spec(config::block_cache_mem_size), 0);
+    options.disk_path = config::block_cache_disk_path;
+    options.disk_capacity = std::max<int64_t>(ParseUtil::parse_mem_spec(config::block_cache_disk_size), 0);
+    options.block_size = config::block_cache_block_size;
+    options.num_populate_threads = std::max(config::block_cache_populate_thread_num, 1);
+    return io::BlockCache::create_global_cache(options);
+}
+
 void ExecEnv::_destroy() {
+    io::BlockCache::release_global_cache();
     if (_runtime_filter_worker) {
         delete _runtime_filter_worker;
         _runtime_filter_worker = nullptr;
@@ -461,6 +503,10 @@ void ExecEnv::_destroy() {
         delete _runtime_filter_cache;
         _runtime_filter_cache = nullptr;
     }
+    if (_descriptor_tbl_cache) {
+        delete _descriptor_tbl_cache;
+        _descriptor_tbl_cache = nullptr;
+    }
     if (_thread_pool) {
         delete _thread_pool;
         _thread_pool = nullptr;
@@ -62,6 +62,7 @@ class SmallFileMgr;
 class PluginMgr;
 class RuntimeFilterWorker;
 class RuntimeFilterCache;
+class DescriptorTblCache;
 struct RfTracePoint;
 
 class BackendServiceClient;
@@ -174,6 +175,8 @@ public:
     Status init_mem_tracker();
 
     RuntimeFilterCache* runtime_filter_cache() { return _runtime_filter_cache; }
+    // Return nullptr if the cache is disabled.
+    DescriptorTblCache* descriptor_tbl_cache() { return _descriptor_tbl_cache; }
     void add_rf_event(const RfTracePoint& pt);
 
     pipeline::QueryContextManager* query_context_mgr() { return _query_context_mgr; }
@@ -193,6 +196,9 @@ private:
 
     Status _init_storage_page_cache();
 
+    // init the cache of the blocks of the remote files of the external tables
+    Status _init_block_cache();
+
 private:
     std::vector<StorePath> _store_paths;
     // Leave protected so that subclasses can override
@@ -272,6 +278,7 @@ private:
 
     RuntimeFilterWorker* _runtime_filter_worker = nullptr;
     RuntimeFilterCache* _runtime_filter_cache = nullptr;
+    DescriptorTblCache* _descriptor_tbl_cache = nullptr;
 
     lake::TabletManager* _lake_tablet_manager = nullptr;
     lake::GroupAssigner* _lake_group_assigner = nullptr;
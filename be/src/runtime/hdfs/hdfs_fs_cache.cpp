@@ -4,6 +4,7 @@
 
 #include <memory>
 
+#include "common/config.h"
 #include "gutil/strings/substitute.h"
 #include "util/hdfs_util.h"
 
@@ -15,6 +16,13 @@ static Status create_hdfs_fs_handle(const std::string& namenode, HdfsFsHandle* h
         handle->type = HdfsFsHandle::Type::HDFS;
         auto hdfs_builder = hdfsNewBuilder();
         hdfsBuilderSetNameNode(hdfs_builder, namenode.c_str());
+        // the builder keeps the pointers to the values until hdfsBuilderConnect.
+        std::string pool_size = std::to_string(config::hdfs_client_hedged_read_threadpool_size);
+        std::string threshold = std::to_string(config::hdfs_client_hedged_read_threshold_millis);
+        if (config::hdfs_client_hedged_read_threadpool_size > 0) {
+            hdfsBuilderConfSetStr(hdfs_builder, "dfs.client.hedged.read.threadpool.size", pool_size.c_str());
+            hdfsBuilderConfSetStr(hdfs_builder, "dfs.client.hedged.read.threshold.millis", threshold.c_str());
+        }
         handle->hdfs_fs = hdfsBuilderConnect(hdfs_builder);
         if (handle->hdfs_fs == nullptr) {
             return Status::InternalError(strings::Substitute("fail to connect hdfs namenode, namenode=$0, err=$1",
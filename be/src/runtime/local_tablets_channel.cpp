@@ -3,8 +3,10 @@
 #include "runtime/local_tablets_channel.h"
 
 #include <brpc/controller.h>
+#include <bthread/bthread.h>
 #include <fmt/format.h>
 
+#include <algorithm>
 #include <chrono>
 
 #include "common/closure_guard.h"
@@ -20,6 +22,7 @@
 #include "util/block_compression.h"
 #include "util/faststring.h"
 #include "util/starrocks_metrics.h"
+#include "util/stopwatch.hpp"
 
 namespace starrocks {
 
@@ -57,6 +60,7 @@ Status LocalTabletsChannel::open(const PTabletWriterOpenRequest& params) {
     _num_remaining_senders.store(params.num_senders(), std::memory_order_release);
     _senders = std::vector<Sender>(params.num_senders());
 
+    _flush_largest_on_memory_limit = config::load_flush_largest_memtables_on_memory_limit;
     RETURN_IF_ERROR(_open_all_writers(params));
     return Status::OK();
 }
@@ -163,7 +167,7 @@ void LocalTabletsChannel::add_chunk(brpc::Controller* cntl, const PTabletWriterA
         auto& delta_writer = it->second;
 
         AsyncDeltaWriterRequest req;
-        req.chunk = &context->_chunk;
+        req.chunk = context->_chunk;
         req.indexes = row_indexes + from;
         req.indexes_size = size;
         req.commit_after_write = false;
@@ -205,6 +209,10 @@ void LocalTabletsChannel::add_chunk(brpc::Controller* cntl, const PTabletWriterA
     // This will only block the bthread, will not block the pthread
     count_down_latch.wait();
 
+    if (_flush_largest_on_memory_limit && !close_channel) {
+        _flush_largest_memtables(response);
+    }
+
     {
         std::lock_guard lock(_senders[request.sender_id()].lock);
 
@@ -269,6 +277,83 @@ int LocalTabletsChannel::_close_sender(const int64_t* partitions, size_t partiti
     return n - 1;
 }
 
+bool LocalTabletsChannel::_memory_limit_exceeded() const {
+    return _mem_tracker->limit_exceeded() ||
+           (_mem_tracker->parent() != nullptr && _mem_tracker->parent()->limit_exceeded());
+}
+
+void LocalTabletsChannel::_flush_largest_memtables(PTabletWriterAddBatchResult* response) {
+    if (!_memory_limit_exceeded()) {
+        return;
+    }
+    // only one sender flushes at a time, and the others go on writing.
+    std::unique_lock l(_flush_lock, std::try_to_lock);
+    if (!l.owns_lock()) {
+        return;
+    }
+
+    // the MemTables close to the write buffer size are flushed first, which produce segments of the normal size.
+    const auto min_flush_size = static_cast<size_t>(std::max<int64_t>(
+            config::write_buffer_size * std::clamp(config::load_flush_min_memtable_percent, 0, 100) / 100, 1));
+    int64_t flushed = _flush_memtables(response, min_flush_size, SIZE_MAX);
+    StarRocksMetrics::instance()->load_memtable_flush_on_memory_limit_bytes.increment(flushed);
+    if (!_memory_limit_exceeded()) {
+        return;
+    }
+
+    // backpressure: the sender waits for the memory released by the flushes in progress, before the small MemTables
+    // are flushed early.
+    MonotonicStopWatch watch;
+    watch.start();
+    const int64_t max_wait_ns = std::max(config::load_memory_backpressure_max_wait_ms, 0) * 1000000L;
+    while (_memory_limit_exceeded() && watch.elapsed_time() < max_wait_ns) {
+        bthread_usleep(10 * 1000);
+    }
+    StarRocksMetrics::instance()->load_memory_backpressure_duration_us.increment(watch.elapsed_time() / 1000);
+    if (_memory_limit_exceeded()) {
+        flushed = _flush_memtables(response, 1, min_flush_size);
+        StarRocksMetrics::instance()->load_memtable_early_flush_bytes.increment(flushed);
+    }
+}
+
+int64_t LocalTabletsChannel::_flush_memtables(PTabletWriterAddBatchResult* response, size_t min_size,
+                                              size_t max_size) {
+    // release the memory to 3/4 of the limit, or a half of the channel if only the limit of the parent is exceeded.
+    const int64_t consumption = _mem_tracker->consumption();
+    const int64_t target = _mem_tracker->limit_exceeded() ? consumption - _mem_tracker->limit() * 3 / 4
+                                                          : consumption / 2;
+    std::vector<std::pair<size_t, AsyncDeltaWriter*>> writers;
+    for (auto& [_, delta_writer] : _delta_writers) {
+        size_t size = delta_writer->write_buffer_size();
+        if (size >= min_size && size < max_size) {
+            writers.emplace_back(size, delta_writer.get());
+        }
+    }
+    if (writers.empty()) {
+        return 0;
+    }
+    std::sort(writers.begin(), writers.end(), [](const auto& lhs, const auto& rhs) { return lhs.first > rhs.first; });
+
+    auto count_down_latch = BThreadCountDownLatch(1);
+    scoped_refptr<WriteContext> context(new WriteContext(response));
+    context->set_count_down_latch(&count_down_latch);
+    int64_t flushed = 0;
+    size_t num_flushed = 0;
+    for (auto& [size, delta_writer] : writers) {
+        if (flushed >= target && num_flushed > 0) {
+            break;
+        }
+        delta_writer->flush(new WriteCallback(context.get()));
+        flushed += size;
+        num_flushed++;
+    }
+    VLOG(2) << "Flushing " << num_flushed << " memory tables of " << _key.to_string() << " bytes " << flushed
+            << " due to memory limit exceeded, consumption " << consumption;
+    context.reset();
+    count_down_latch.wait();
+    return flushed;
+}
+
 Status LocalTabletsChannel::_open_all_writers(const PTabletWriterOpenRequest& params) {
     std::vector<SlotDescriptor*>* index_slots = nullptr;
     int32_t schema_hash = 0;
@@ -311,6 +396,7 @@ Status LocalTabletsChannel::_open_all_writers(const PTabletWriterOpenRequest& pa
         options.tuple_desc = _tuple_desc;
         options.slots = index_slots;
         options.global_dicts = &_global_dicts;
+        options.flush_on_memory_limit = !_flush_largest_on_memory_limit;
 
         auto res = AsyncDeltaWriter::open(options, _mem_tracker);
         RETURN_IF_ERROR(res.status());
@@ -382,7 +468,7 @@ StatusOr<scoped_refptr<LocalTabletsChannel::WriteContext>> LocalTabletsChannel::
     auto& pchunk = request.chunk();
     RETURN_IF_ERROR(_build_chunk_meta(pchunk));
 
-    vectorized::Chunk& chunk = context->_chunk;
+    vectorized::Chunk& chunk = *context->_chunk;
 
     faststring uncompressed_buffer;
     RETURN_IF_ERROR(_deserialize_chunk(pchunk, chunk, &uncompressed_buffer));
@@ -116,7 +116,8 @@ private:
         PTabletWriterAddBatchResult* _response;
         BThreadCountDownLatch* _latch;
 
-        vectorized::Chunk _chunk;
+        // shared by the MemTables referencing its rows.
+        vectorized::ChunkPtr _chunk = std::make_shared<vectorized::Chunk>();
         std::unique_ptr<uint32_t[]> _row_indexes;
         std::unique_ptr<uint32_t[]> _channel_row_idx_start_points;
     };
@@ -148,6 +149,17 @@ private:
 
     int _close_sender(const int64_t* partitions, size_t partitions_size);
 
+    bool _memory_limit_exceeded() const;
+
+    // Flush the largest MemTables of the channel if the memory limit is exceeded, and wait until they are written.
+    // The MemTables smaller than `load_flush_min_memtable_percent` of the write buffer size are flushed only if the
+    // limit is still exceeded after waiting for the flushes in progress at most `load_memory_backpressure_max_wait_ms`.
+    void _flush_largest_memtables(PTabletWriterAddBatchResult* response);
+
+    // Flush the largest MemTables of the sizes in [min_size, max_size) until the memory is released to the target of
+    // the limit, and wait until they are written. Return the bytes flushed.
+    int64_t _flush_memtables(PTabletWriterAddBatchResult* response, size_t min_size, size_t max_size);
+
     Status _deserialize_chunk(const ChunkPB& pchunk, vectorized::Chunk& chunk, faststring* uncompressed_buffer);
 
     LoadChannel* _load_channel;
@@ -181,6 +193,11 @@ private:
 
     vectorized::GlobalDictByNameMaps _global_dicts;
     std::unique_ptr<MemPool> _mem_pool;
+
+    // initialized in open function by `load_flush_largest_memtables_on_memory_limit`.
+    bool _flush_largest_on_memory_limit = false;
+    // held by the sender flushing the largest MemTables.
+    std::mutex _flush_lock;
 };
 
 } // namespace starrocks
@@ -41,6 +41,7 @@ ChunkAllocator* ChunkAllocator::_s_instance = nullptr;
 
 static IntCounter local_core_alloc_count(MetricUnit::NOUNIT);
 static IntCounter other_core_alloc_count(MetricUnit::NOUNIT);
+static IntCounter same_numa_node_alloc_count(MetricUnit::NOUNIT);
 static IntCounter system_alloc_count(MetricUnit::NOUNIT);
 static IntCounter system_free_count(MetricUnit::NOUNIT);
 static IntCounter system_alloc_cost_ns(MetricUnit::NANOSECONDS);
@@ -116,6 +117,7 @@ void ChunkAllocator::init_instance(MemTracker* mem_tracker, size_t reserve_limit
 
     REGISTER_METIRC(local_core_alloc_count);
     REGISTER_METIRC(other_core_alloc_count);
+    REGISTER_METIRC(same_numa_node_alloc_count);
     REGISTER_METIRC(system_alloc_count);
     REGISTER_METIRC(system_free_count);
     REGISTER_METIRC(system_alloc_cost_ns);
@@ -156,6 +158,19 @@ bool ChunkAllocator::allocate(size_t size, Chunk* chunk) {
         ret = true;
         return ret;
     }
+    if (_reserved_bytes > size && CpuInfo::get_max_num_numa_nodes() > 1) {
+        // try to allocate from the arenas of the other cores in the same NUMA node,
+        // to avoid accessing the memory of the remote NUMA node.
+        for (int other_core_id : CpuInfo::get_cores_of_same_numa_node(core_id)) {
+            if (other_core_id != core_id && _arenas[other_core_id]->pop_free_chunk(size, &chunk->data)) {
+                _reserved_bytes.fetch_sub(size);
+                same_numa_node_alloc_count.increment(1);
+                chunk->core_id = other_core_id;
+                ret = true;
+                return ret;
+            }
+        }
+    }
     if (_reserved_bytes > size) {
         // try to allocate from other core's arena
         ++core_id;
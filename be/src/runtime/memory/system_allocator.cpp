@@ -29,17 +29,23 @@
 #include "common/config.h"
 #include "common/logging.h"
 #include "runtime/mem_tracker.h"
+#include "util/huge_page.h"
 
 namespace starrocks {
 
 #define PAGE_SIZE (4 * 1024) // 4K
 
 uint8_t* SystemAllocator::allocate(MemTracker* mem_tracker, size_t length) {
+    uint8_t* ptr;
     if (config::use_mmap_allocate_chunk) {
-        return allocate_via_mmap(mem_tracker, length);
+        ptr = allocate_via_mmap(mem_tracker, length);
     } else {
-        return allocate_via_malloc(length);
+        ptr = allocate_via_malloc(length);
     }
+    if (ptr != nullptr && length >= HUGE_PAGE_SIZE) {
+        madvise_huge_pages(ptr, length);
+    }
+    return ptr;
 }
 
 void SystemAllocator::free(MemTracker* mem_tracker, uint8_t* ptr, size_t length) {
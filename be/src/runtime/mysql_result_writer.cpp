@@ -36,24 +36,15 @@ namespace starrocks {
 
 MysqlResultWriter::MysqlResultWriter(BufferControlBlock* sinker, const std::vector<ExprContext*>& output_expr_ctxs,
                                      RuntimeProfile* parent_profile)
-        : _sinker(sinker), _output_expr_ctxs(output_expr_ctxs), _row_buffer(nullptr), _parent_profile(parent_profile) {}
+        : _sinker(sinker), _output_expr_ctxs(output_expr_ctxs), _parent_profile(parent_profile) {}
 
-MysqlResultWriter::~MysqlResultWriter() {
-    delete _row_buffer;
-}
+MysqlResultWriter::~MysqlResultWriter() = default;
 
 Status MysqlResultWriter::init(RuntimeState* state) {
     _init_profile();
     if (nullptr == _sinker) {
         return Status::InternalError("sinker is NULL pointer.");
     }
-
-    _row_buffer = new (std::nothrow) MysqlRowBuffer();
-
-    if (nullptr == _row_buffer) {
-        return Status::InternalError("no memory to alloc.");
-    }
-
     return Status::OK();
 }
 
@@ -116,23 +107,52 @@ StatusOr<TFetchDataResultPtr> MysqlResultWriter::process_chunk(vectorized::Chunk
         result_columns.emplace_back(std::move(column));
     }
 
-    // Step 2: convert chunk to mysql row format row by row
+    // Step 2: convert chunk to mysql row format column by column
     {
-        _row_buffer->reserve(128);
         SCOPED_TIMER(_convert_tuple_timer);
+        _encode_columns(result_columns, num_rows);
         for (int i = 0; i < num_rows; ++i) {
-            DCHECK_EQ(0, _row_buffer->length());
-            for (auto& result_column : result_columns) {
-                result_column->put_mysql_row_buffer(_row_buffer, i);
-            }
-            size_t len = _row_buffer->length();
-            _row_buffer->move_content(&result_rows[i]);
-            _row_buffer->reserve(len * 1.1);
+            _copy_row(i, &result_rows[i]);
         }
     }
     return result;
 }
 
+void MysqlResultWriter::_encode_columns(const vectorized::Columns& columns, size_t num_rows) {
+    _column_buffers.resize(columns.size());
+    _column_offsets.resize(columns.size());
+    for (size_t col = 0; col < columns.size(); ++col) {
+        auto& buffer = _column_buffers[col];
+        auto& offsets = _column_offsets[col];
+        buffer.reset();
+        offsets.resize(num_rows + 1);
+        offsets[0] = 0;
+        for (size_t i = 0; i < num_rows; ++i) {
+            columns[col]->put_mysql_row_buffer(&buffer, i);
+            offsets[i + 1] = buffer.length();
+        }
+    }
+}
+
+size_t MysqlResultWriter::_row_length(size_t row) const {
+    size_t length = 0;
+    for (const auto& offsets : _column_offsets) {
+        length += offsets[row + 1] - offsets[row];
+    }
+    return length;
+}
+
+void MysqlResultWriter::_copy_row(size_t row, std::string* dst) const {
+    dst->resize(_row_length(row));
+    char* pos = dst->data();
+    for (size_t col = 0; col < _column_buffers.size(); ++col) {
+        const auto& offsets = _column_offsets[col];
+        size_t length = offsets[row + 1] - offsets[row];
+        memcpy(pos, _column_buffers[col].data().data() + offsets[row], length);
+        pos += length;
+    }
+}
+
 StatusOr<TFetchDataResultPtrs> MysqlResultWriter::process_chunk_for_pipeline(vectorized::Chunk* chunk) {
     SCOPED_TIMER(_append_chunk_timer);
     int num_rows = chunk->num_rows();
@@ -151,43 +171,39 @@ StatusOr<TFetchDataResultPtrs> MysqlResultWriter::process_chunk_for_pipeline(vec
         result_columns.emplace_back(std::move(column));
     }
 
-    // Step 2: convert chunk to mysql row format row by row
+    // Step 2: convert chunk to mysql row format column by column
     {
         TRY_CATCH_ALLOC_SCOPE_START()
-        _row_buffer->reserve(128);
         size_t current_bytes = 0;
         int current_rows = 0;
         SCOPED_TIMER(_convert_tuple_timer);
         auto result = std::make_unique<TFetchDataResult>();
-        auto& result_rows = result->result_batch.rows;
-        result_rows.resize(num_rows);
+        // a pointer instead of a reference, which is rebound to the rows of the next result when the rows are split
+        auto* result_rows = &result->result_batch.rows;
+        result_rows->resize(num_rows);
 
+        _encode_columns(result_columns, num_rows);
         for (int i = 0; i < num_rows; ++i) {
-            DCHECK_EQ(0, _row_buffer->length());
-            for (auto& result_column : result_columns) {
-                result_column->put_mysql_row_buffer(_row_buffer, i);
-            }
-            size_t len = _row_buffer->length();
+            size_t len = _row_length(i);
 
             if (UNLIKELY(current_bytes + len >= _max_row_buffer_size)) {
-                result_rows.resize(current_rows);
+                result_rows->resize(current_rows);
                 results.emplace_back(std::move(result));
 
                 result = std::make_unique<TFetchDataResult>();
-                result_rows = result->result_batch.rows;
-                result_rows.resize(num_rows - i);
+                result_rows = &result->result_batch.rows;
+                result_rows->resize(num_rows - i);
 
                 current_bytes = 0;
                 current_rows = 0;
             }
-            _row_buffer->move_content(&result_rows[current_rows]);
-            _row_buffer->reserve(len * 1.1);
+            _copy_row(i, &(*result_rows)[current_rows]);
 
             current_bytes += len;
             current_rows += 1;
         }
         if (current_rows > 0) {
-            result_rows.resize(current_rows);
+            result_rows->resize(current_rows);
             results.emplace_back(std::move(result));
         }
         TRY_CATCH_ALLOC_SCOPE_END()
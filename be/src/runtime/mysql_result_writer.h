@@ -21,14 +21,15 @@
 
 #pragma once
 
+#include "column/vectorized_fwd.h"
 #include "common/statusor.h"
 #include "runtime/result_writer.h"
 #include "runtime/runtime_state.h"
+#include "util/mysql_row_buffer.h"
 
 namespace starrocks {
 
 class ExprContext;
-class MysqlRowBuffer;
 class BufferControlBlock;
 class RuntimeProfile;
 using TFetchDataResultPtr = std::unique_ptr<TFetchDataResult>;
@@ -64,9 +65,18 @@ public:
 private:
     void _init_profile();
 
+    // Encode the values of each column into its own buffer in a tight loop, instead of encoding the cells of
+    // the columns row by row, and record the offsets of the fields of the rows.
+    void _encode_columns(const vectorized::Columns& columns, size_t num_rows);
+    size_t _row_length(size_t row) const;
+    // concatenate the fields of |row| into |dst|, which is allocated once at the exact size.
+    void _copy_row(size_t row, std::string* dst) const;
+
     BufferControlBlock* _sinker;
     const std::vector<ExprContext*>& _output_expr_ctxs;
-    MysqlRowBuffer* _row_buffer;
+    // the encoded values of each column of the chunk, and their offsets, which are reused across the chunks.
+    std::vector<MysqlRowBuffer> _column_buffers;
+    std::vector<std::vector<size_t>> _column_offsets;
 
     RuntimeProfile* _parent_profile; // parent profile from result sink. not owned
     // total time cost on append chunk operation
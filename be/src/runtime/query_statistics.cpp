@@ -30,6 +30,10 @@ void QueryStatistics::to_pb(PQueryStatistics* statistics) {
     statistics->set_returned_rows(returned_rows);
     statistics->set_cpu_cost_ns(cpu_ns);
     statistics->set_mem_cost_bytes(mem_cost_bytes);
+    statistics->set_read_page_cache_bytes(io_read_bytes[io::IO_TIER_PAGE_CACHE]);
+    statistics->set_read_local_disk_bytes(io_read_bytes[io::IO_TIER_LOCAL_DISK]);
+    statistics->set_read_remote_bytes(io_read_bytes[io::IO_TIER_REMOTE]);
+    statistics->set_read_block_cache_bytes(io_read_bytes[io::IO_TIER_BLOCK_CACHE]);
     *statistics->mutable_stats_items() = {_stats_items.begin(), _stats_items.end()};
 }
 
@@ -42,6 +46,10 @@ void QueryStatistics::merge_pb(const PQueryStatistics& statistics) {
     scan_bytes += statistics.scan_bytes();
     cpu_ns += statistics.cpu_cost_ns();
     mem_cost_bytes += statistics.mem_cost_bytes();
+    io_read_bytes[io::IO_TIER_PAGE_CACHE] += statistics.read_page_cache_bytes();
+    io_read_bytes[io::IO_TIER_LOCAL_DISK] += statistics.read_local_disk_bytes();
+    io_read_bytes[io::IO_TIER_REMOTE] += statistics.read_remote_bytes();
+    io_read_bytes[io::IO_TIER_BLOCK_CACHE] += statistics.read_block_cache_bytes();
     _stats_items.insert(_stats_items.end(), statistics.stats_items().begin(), statistics.stats_items().end());
 }
 
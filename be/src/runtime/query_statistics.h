@@ -24,6 +24,7 @@
 #include <mutex>
 
 #include "gen_cpp/data.pb.h"
+#include "io/io_profiler.h"
 #include "util/spinlock.h"
 
 namespace starrocks {
@@ -40,6 +41,9 @@ public:
     void merge(const QueryStatistics& other) {
         scan_rows += other.scan_rows;
         scan_bytes += other.scan_bytes;
+        for (int i = 0; i < io::NUM_IO_TIERS; i++) {
+            io_read_bytes[i] += other.io_read_bytes[i];
+        }
         _stats_items.insert(_stats_items.end(), other._stats_items.begin(), other._stats_items.end());
     }
 
@@ -56,6 +60,8 @@ public:
         this->scan_bytes += scan_bytes;
     }
 
+    void add_io_read_bytes(io::IOTier tier, int64_t bytes) { this->io_read_bytes[tier] += bytes; }
+
     void add_cpu_costs(int64_t cpu_ns) { this->cpu_ns += cpu_ns; }
 
     void add_mem_costs(int64_t bytes) { mem_cost_bytes += bytes; }
@@ -66,6 +72,9 @@ public:
         scan_rows = 0;
         scan_bytes = 0;
         returned_rows = 0;
+        for (auto& bytes : io_read_bytes) {
+            bytes = 0;
+        }
         _stats_items.clear();
     }
 
@@ -78,6 +87,7 @@ private:
     int64_t scan_bytes{0};
     int64_t cpu_ns{0};
     int64_t mem_cost_bytes = 0;
+    int64_t io_read_bytes[io::NUM_IO_TIERS] = {};
     // number rows returned by query.
     // only set once by result sink when closing.
     int64_t returned_rows{0};
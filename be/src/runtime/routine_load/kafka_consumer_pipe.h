@@ -21,11 +21,13 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstdint>
 #include <map>
 #include <string>
 #include <vector>
 
+#include "common/config.h"
 #include "librdkafka/rdkafka.h"
 #include "runtime/message_body_sink.h"
 #include "runtime/stream_load/stream_load_pipe.h"
@@ -51,11 +53,53 @@ public:
         return st;
     }
 
+    // The consecutive json objects are batched into a stream of documents separated by |row_delimiter|, the other
+    // json values and the objects larger than `routine_load_json_batch_bytes` are appended one by one.
     Status append_json(const char* data, size_t size, char row_delimiter) {
-        auto buf = ByteBuffer::allocate(size + simdjson::SIMDJSON_PADDING);
-        buf->put_bytes(data, size);
-        return append(std::move(buf));
+        const auto batch_bytes = static_cast<size_t>(std::max<int64_t>(config::routine_load_json_batch_bytes, 0));
+        if (size + 1 > batch_bytes || !_is_json_object(data, size)) {
+            RETURN_IF_ERROR(_flush_json_batch());
+            auto buf = ByteBuffer::allocate(size + simdjson::SIMDJSON_PADDING);
+            buf->put_bytes(data, size);
+            buf->flip();
+            return append(std::move(buf));
+        }
+        if (_json_batch != nullptr && _json_batch->remaining() < size + 1 + simdjson::SIMDJSON_PADDING) {
+            RETURN_IF_ERROR(_flush_json_batch());
+        }
+        if (_json_batch == nullptr) {
+            _json_batch = ByteBuffer::allocate(batch_bytes + simdjson::SIMDJSON_PADDING);
+        }
+        _json_batch->put_bytes(data, size);
+        _json_batch->put_bytes(&row_delimiter, 1);
+        return Status::OK();
+    }
+
+    Status finish() override {
+        RETURN_IF_ERROR(_flush_json_batch());
+        return StreamLoadPipe::finish();
+    }
+
+private:
+    static bool _is_json_object(const char* data, size_t size) {
+        for (size_t i = 0; i < size; ++i) {
+            if (data[i] != ' ' && data[i] != '\t' && data[i] != '\r' && data[i] != '\n') {
+                return data[i] == '{';
+            }
+        }
+        return false;
+    }
+
+    Status _flush_json_batch() {
+        if (_json_batch == nullptr) {
+            return Status::OK();
+        }
+        _json_batch->flip();
+        return append(std::move(_json_batch));
     }
+
+    // the json objects batched but not appended yet.
+    ByteBufferPtr _json_batch;
 };
 
 } // end namespace starrocks
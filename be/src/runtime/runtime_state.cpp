@@ -28,6 +28,7 @@
 #include <string>
 #include <utility>
 
+#include "common/config.h"
 #include "common/logging.h"
 #include "common/object_pool.h"
 #include "common/status.h"
@@ -236,6 +237,38 @@ void RuntimeState::get_unreported_errors(std::vector<std::string>* new_errors) {
     }
 }
 
+void RuntimeState::update_join_statistics(const TJoinStatistics& stats) {
+    std::lock_guard<std::mutex> l(_join_statistics_lock);
+    auto [it, inserted] = _join_statistics.try_emplace(stats.plan_node_id, stats);
+    if (inserted) {
+        return;
+    }
+    TJoinStatistics& merged = it->second;
+    if (stats.__isset.build_rows) {
+        merged.__set_build_rows(merged.build_rows + stats.build_rows);
+    }
+    // The builders of the same join node hold the disjoint partitions of the build keys.
+    if (stats.__isset.build_key_ndv) {
+        merged.__set_build_key_ndv(merged.build_key_ndv + stats.build_key_ndv);
+    }
+    if (stats.__isset.probe_rows) {
+        merged.__set_probe_rows(merged.probe_rows + stats.probe_rows);
+    }
+    if (stats.__isset.output_rows) {
+        merged.__set_output_rows(merged.output_rows + stats.output_rows);
+    }
+}
+
+std::vector<TJoinStatistics> RuntimeState::join_statistics() const {
+    std::lock_guard<std::mutex> l(_join_statistics_lock);
+    std::vector<TJoinStatistics> result;
+    result.reserve(_join_statistics.size());
+    for (const auto& [node_id, stats] : _join_statistics) {
+        result.push_back(stats);
+    }
+    return result;
+}
+
 Status RuntimeState::set_mem_limit_exceeded(MemTracker* tracker, int64_t failed_allocation_size,
                                             const std::string* msg) {
     DCHECK_GE(failed_allocation_size, 0);
@@ -266,6 +299,17 @@ Status RuntimeState::set_mem_limit_exceeded(MemTracker* tracker, int64_t failed_
     return _process_status;
 }
 
+bool RuntimeState::exceeds_spill_mem_limit(int32_t query_mem_limit_percent) const {
+    const MemTracker* mem_tracker = _query_mem_tracker.get();
+    if (mem_tracker != nullptr && mem_tracker->has_limit() &&
+        mem_tracker->consumption() > mem_tracker->limit() / 100 * query_mem_limit_percent) {
+        return true;
+    }
+    const MemTracker* pool_tracker = _exec_env != nullptr ? _exec_env->query_pool_mem_tracker() : nullptr;
+    return config::spill_query_pool_mem_limit_percent > 0 && pool_tracker != nullptr && pool_tracker->has_limit() &&
+           pool_tracker->consumption() > pool_tracker->limit() / 100 * config::spill_query_pool_mem_limit_percent;
+}
+
 Status RuntimeState::check_query_state(const std::string& msg) {
     // TODO: it would be nice if this also checked for cancellation, but doing so breaks
     // cases where we use Status::Cancelled("Cancelled") to indicate that the limit was reached.
@@ -23,6 +23,7 @@
 
 #include <atomic>
 #include <fstream>
+#include <map>
 #include <memory>
 #include <sstream>
 #include <string>
@@ -258,10 +259,19 @@ public:
 
     bool enable_spill() const { return _query_options.enable_spilling; }
 
+    // Whether a spillable operator of this query should spill: the query uses more than |query_mem_limit_percent|
+    // of its limit, or all the queries use more than `spill_query_pool_mem_limit_percent` of the query pool limit.
+    bool exceeds_spill_mem_limit(int32_t query_mem_limit_percent) const;
+
     const std::vector<TTabletCommitInfo>& tablet_commit_infos() const { return _tablet_commit_infos; }
 
     std::vector<TTabletCommitInfo>& tablet_commit_infos() { return _tablet_commit_infos; }
 
+    // Merge the statistics of a hash join into the statistics of the same join node, which are reported to FE
+    // when the fragment instance is done. The join nodes of the pipeline drivers are merged by summing up.
+    void update_join_statistics(const TJoinStatistics& stats);
+    std::vector<TJoinStatistics> join_statistics() const;
+
     // get mem limit for load channel
     // if load mem limit is not set, or is zero, using query mem limit instead.
     int64_t get_load_mem_limit() const;
@@ -374,6 +384,10 @@ private:
     std::ofstream* _error_log_file = nullptr; // error file path, absolute path
     std::vector<TTabletCommitInfo> _tablet_commit_infos;
 
+    mutable std::mutex _join_statistics_lock;
+    // plan node id -> the statistics of the join node.
+    std::map<int32_t, TJoinStatistics> _join_statistics;
+
     // prohibit copies
     RuntimeState(const RuntimeState&) = delete;
 
@@ -2,6 +2,8 @@
 
 #include "runtime/sorted_chunks_merger.h"
 
+#include <numeric>
+
 #include "column/chunk.h"
 #include "exec/sort_exec_exprs.h"
 
@@ -137,38 +139,23 @@ Status SortedChunksMerger::get_next(ChunkPtr* chunk, bool* eos) {
     ChunkPtr current_chunk = cursor->get_current_chunk();
     std::vector<uint32_t> selective_values; // for append_selective call
     selective_values.reserve(_state->chunk_size());
-    selective_values.push_back(cursor->get_current_position_in_chunk());
-    size_t row_number = 1;
+    size_t row_number = _append_top_run(&selective_values, _state->chunk_size());
 
-    std::pop_heap(_min_heap.begin(), _min_heap.end(), _cursor_cmp_greater);
     cursor->next();
-    if (cursor->is_valid()) {
-        std::push_heap(_min_heap.begin(), _min_heap.end(), _cursor_cmp_greater);
-    } else {
-        _min_heap.pop_back();
-    }
+    _adjust_min_heap_top(cursor->is_valid());
 
     while (row_number < _state->chunk_size() && !_min_heap.empty()) {
         cursor = _min_heap[0];
         const auto& ptr = cursor->get_current_chunk();
-        if (current_chunk == ptr) {
-            selective_values.push_back(cursor->get_current_position_in_chunk());
-        } else {
+        if (current_chunk != ptr) {
             (*chunk)->append_selective(*current_chunk, selective_values.data(), 0, selective_values.size());
             current_chunk = ptr;
             selective_values.clear();
-            selective_values.push_back(cursor->get_current_position_in_chunk());
         }
+        row_number += _append_top_run(&selective_values, _state->chunk_size() - row_number);
 
-        std::pop_heap(_min_heap.begin(), _min_heap.end(), _cursor_cmp_greater);
         cursor->next();
-        if (cursor->is_valid()) {
-            std::push_heap(_min_heap.begin(), _min_heap.end(), _cursor_cmp_greater);
-        } else {
-            _min_heap.pop_back();
-        }
-
-        ++row_number;
+        _adjust_min_heap_top(cursor->is_valid());
     }
 
     (*chunk)->append_selective(*current_chunk, selective_values.data(), 0, selective_values.size());
@@ -228,24 +215,18 @@ Status SortedChunksMerger::get_next_for_pipeline(ChunkPtr* chunk, std::atomic<bo
             _current_chunk = _cursor->get_current_chunk();
             _selective_values.clear();
             _selective_values.reserve(_state->chunk_size());
-            _selective_values.push_back(_cursor->get_current_position_in_chunk());
         } else {
             const auto& ptr = _cursor->get_current_chunk();
-            // If it is the same chunk, we just add a index for this row.
+            // If it is the same chunk, we just add the indexes of the rows.
             // else we copy These datas, and record a new chunk.
-            if (_current_chunk == ptr) {
-                _selective_values.push_back(_cursor->get_current_position_in_chunk());
-            } else {
+            if (_current_chunk != ptr) {
                 _result_chunk->append_selective(*_current_chunk, _selective_values.data(), 0, _selective_values.size());
                 _current_chunk = ptr;
                 _selective_values.clear();
-                _selective_values.push_back(_cursor->get_current_position_in_chunk());
             }
         }
-
-        ++_row_number;
-        // we move min-element in the heap and then probe next row in cursor.
-        std::pop_heap(_min_heap.begin(), _min_heap.end(), _cursor_cmp_greater);
+        _row_number += _append_top_run(&_selective_values, _state->chunk_size() - _row_number);
+        // Probe next row in cursor, which is kept on the top of the heap until it moves to the next row.
         _wait_for_data = true;
 
         // probe next row.
@@ -269,16 +250,69 @@ Status SortedChunksMerger::get_next_for_pipeline(ChunkPtr* chunk, std::atomic<bo
 
 void SortedChunksMerger::move_cursor_and_adjust_min_heap(std::atomic<bool>* eos) {
     // It has next row, so we move cursor.
+    DCHECK_EQ(_cursor, _min_heap[0]);
     _cursor->next_for_pipeline();
     if (_cursor->is_valid()) {
-        // we should adjust min_heap to keep min heap property.
-        std::push_heap(_min_heap.begin(), _min_heap.end(), _cursor_cmp_greater);
+        _adjust_min_heap_top(true);
     } else {
+        _adjust_min_heap_top(false);
+        *eos = _min_heap.empty();
+    }
+}
+
+void SortedChunksMerger::_adjust_min_heap_top(bool is_top_valid) {
+    if (!is_top_valid) {
         // just remove one source.
+        std::pop_heap(_min_heap.begin(), _min_heap.end(), _cursor_cmp_greater);
         _min_heap.pop_back();
-        *eos = _min_heap.empty();
+        return;
     }
+    // Sift the top cursor down to keep min heap property. The sorted input streams usually output
+    // runs of several rows, so the top cursor mostly stays on the top after one or two comparisons,
+    // while pop_heap and push_heap always cost O(log(n)) comparisons for each row.
+    const size_t size = _min_heap.size();
+    ChunkCursor* top = _min_heap[0];
+    size_t idx = 0;
+    for (;;) {
+        size_t child = 2 * idx + 1;
+        if (child >= size) {
+            break;
+        }
+        // Pick the smaller child.
+        if (child + 1 < size && _cursor_cmp_greater(_min_heap[child], _min_heap[child + 1])) {
+            ++child;
+        }
+        if (!_cursor_cmp_greater(top, _min_heap[child])) {
+            break;
+        }
+        _min_heap[idx] = _min_heap[child];
+        idx = child;
+    }
+    _min_heap[idx] = top;
 }
+size_t SortedChunksMerger::_append_top_run(std::vector<uint32_t>* selective_values, size_t max_rows) {
+    DCHECK_GT(max_rows, 0);
+    ChunkCursor* top = _min_heap[0];
+    size_t num_following_rows = 0;
+    if (_min_heap.size() == 1) {
+        num_following_rows = top->count_following_rows(max_rows - 1);
+    } else {
+        // The second smallest cursor is the smaller child of the top.
+        ChunkCursor* second = _min_heap[1];
+        if (_min_heap.size() > 2 && _cursor_cmp_greater(second, _min_heap[2])) {
+            second = _min_heap[2];
+        }
+        num_following_rows = top->count_following_rows_not_after(*second, max_rows - 1);
+    }
+
+    const uint32_t pos = top->get_current_position_in_chunk();
+    const size_t old_size = selective_values->size();
+    selective_values->resize(old_size + num_following_rows + 1);
+    std::iota(selective_values->begin() + old_size, selective_values->end(), pos);
+    top->skip_in_chunk(num_following_rows);
+    return num_following_rows + 1;
+}
+
 void SortedChunksMerger::collect_merged_chunks(ChunkPtr* chunk) {
     _result_chunk->append_selective(*_current_chunk, _selective_values.data(), 0, _selective_values.size());
     _result_chunk->set_num_rows(_row_number); // set constant column in chunk with right size.
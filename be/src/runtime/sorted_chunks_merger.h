@@ -38,6 +38,14 @@ private:
     RuntimeState* _state;
     void collect_merged_chunks(ChunkPtr* chunk);
     void move_cursor_and_adjust_min_heap(std::atomic<bool>* eos);
+    // Restore min heap property after the top cursor moves to the next row,
+    // and remove the top cursor from the heap if it isn't valid anymore.
+    void _adjust_min_heap_top(bool is_top_valid);
+    // Append the current row of the top cursor to |selective_values|, together with the following rows in its chunk
+    // which are not after any other cursor, at most |max_rows| rows in total. The top cursor is moved to the last
+    // appended row, so that the run of rows is output without adjusting the heap for each row.
+    // Return the number of the appended rows.
+    size_t _append_top_run(std::vector<uint32_t>* selective_values, size_t max_rows);
 
     ChunkSupplier _single_supplier;
     ChunkProbeSupplier _single_probe_supplier;
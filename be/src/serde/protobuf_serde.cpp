@@ -2,6 +2,10 @@
 
 #include "serde/protobuf_serde.h"
 
+#include <butil/iobuf.h>
+
+#include <limits>
+
 #include "column/column_helper.h"
 #include "gutil/strings/substitute.h"
 #include "runtime/descriptors.h"
@@ -22,35 +26,38 @@ int64_t ProtobufChunkSerde::max_serialized_size(const vectorized::Chunk& chunk)
 StatusOr<ChunkPB> ProtobufChunkSerde::serialize(const vectorized::Chunk& chunk) {
     StatusOr<ChunkPB> res = serialize_without_meta(chunk);
     if (!res.ok()) return res.status();
+    serialize_meta(chunk, &res.value());
+    return res;
+}
 
+void ProtobufChunkSerde::serialize_meta(const vectorized::Chunk& chunk, ChunkPB* chunk_pb) {
     const auto& slot_id_to_index = chunk.get_slot_id_to_index_map();
     const auto& tuple_id_to_index = chunk.get_tuple_id_to_index_map();
     const auto& columns = chunk.columns();
 
-    res->mutable_slot_id_map()->Reserve(static_cast<int>(slot_id_to_index.size()) * 2);
+    chunk_pb->mutable_slot_id_map()->Reserve(static_cast<int>(slot_id_to_index.size()) * 2);
     for (const auto& kv : slot_id_to_index) {
-        res->mutable_slot_id_map()->Add(kv.first);
-        res->mutable_slot_id_map()->Add(static_cast<int>(kv.second));
+        chunk_pb->mutable_slot_id_map()->Add(kv.first);
+        chunk_pb->mutable_slot_id_map()->Add(static_cast<int>(kv.second));
     }
 
-    res->mutable_tuple_id_map()->Reserve(static_cast<int>(tuple_id_to_index.size()) * 2);
+    chunk_pb->mutable_tuple_id_map()->Reserve(static_cast<int>(tuple_id_to_index.size()) * 2);
     for (const auto& kv : tuple_id_to_index) {
-        res->mutable_tuple_id_map()->Add(kv.first);
-        res->mutable_tuple_id_map()->Add(static_cast<int>(kv.second));
+        chunk_pb->mutable_tuple_id_map()->Add(kv.first);
+        chunk_pb->mutable_tuple_id_map()->Add(static_cast<int>(kv.second));
     }
 
-    res->mutable_is_nulls()->Reserve(static_cast<int>(columns.size()));
+    chunk_pb->mutable_is_nulls()->Reserve(static_cast<int>(columns.size()));
     for (const auto& column : columns) {
-        res->mutable_is_nulls()->Add(column->is_nullable());
+        chunk_pb->mutable_is_nulls()->Add(column->is_nullable());
     }
 
-    res->mutable_is_consts()->Reserve(static_cast<int>(columns.size()));
+    chunk_pb->mutable_is_consts()->Reserve(static_cast<int>(columns.size()));
     for (const auto& column : columns) {
-        res->mutable_is_consts()->Add(column->is_constant());
+        chunk_pb->mutable_is_consts()->Add(column->is_constant());
     }
 
     DCHECK_EQ(columns.size(), tuple_id_to_index.size() + slot_id_to_index.size());
-    return res;
 }
 
 StatusOr<ChunkPB> ProtobufChunkSerde::serialize_without_meta(const vectorized::Chunk& chunk) {
@@ -73,6 +80,48 @@ StatusOr<ChunkPB> ProtobufChunkSerde::serialize_without_meta(const vectorized::C
     return std::move(chunk_pb);
 }
 
+StatusOr<Slice> ProtobufChunkSerde::serialize_without_meta_to_iobuf(const vectorized::Chunk& chunk,
+                                                                    ChunkPB* chunk_pb, butil::IOBuf* buf) {
+    // The header of the IOBuf block is placed in front of its data.
+    static constexpr int64_t IOBUF_BLOCK_HEADER_SIZE = 64;
+
+    const int64_t max_size = ProtobufChunkSerde::max_serialized_size(chunk);
+    if (UNLIKELY(max_size + IOBUF_BLOCK_HEADER_SIZE > std::numeric_limits<int32_t>::max())) {
+        return Status::InternalError(strings::Substitute("too large chunk to serialize: $0", max_size));
+    }
+
+    // Allocate a block which can hold all the serialized data, so that the data is contiguous.
+    butil::IOBufAsZeroCopyOutputStream stream(buf, max_size + IOBUF_BLOCK_HEADER_SIZE);
+    void* data = nullptr;
+    int size = 0;
+    if (UNLIKELY(!stream.Next(&data, &size) || size < max_size)) {
+        if (data != nullptr) stream.BackUp(size);
+        return Status::InternalError("failed to allocate iobuf block to serialize chunk");
+    }
+
+    auto* begin = reinterpret_cast<uint8_t*>(data);
+    auto* buff = begin;
+    encode_fixed32_le(buff + 0, 1);
+    encode_fixed32_le(buff + 4, chunk.num_rows());
+    buff = buff + 8;
+
+    for (const auto& column : chunk.columns()) {
+        buff = ColumnArraySerde::serialize(*column, buff);
+        if (UNLIKELY(buff == nullptr)) {
+            stream.BackUp(size);
+            return Status::InternalError("has unsupported column");
+        }
+    }
+    const int64_t serialized_size = buff - begin;
+    stream.BackUp(size - serialized_size);
+
+    chunk_pb->set_compress_type(CompressionTypePB::NO_COMPRESSION);
+    chunk_pb->set_serialized_size(serialized_size);
+    chunk_pb->set_uncompressed_size(serialized_size);
+    chunk_pb->set_data_size(serialized_size);
+    return Slice(begin, serialized_size);
+}
+
 StatusOr<vectorized::Chunk> ProtobufChunkSerde::deserialize(const RowDescriptor& row_desc, const ChunkPB& chunk_pb) {
     auto res = build_protobuf_chunk_meta(row_desc, chunk_pb);
     if (!res.ok()) {
@@ -8,6 +8,11 @@
 #include "column/chunk.h"
 #include "common/statusor.h"
 #include "gen_cpp/data.pb.h" // ChunkPB
+#include "util/slice.h"
+
+namespace butil {
+class IOBuf;
+}
 
 namespace starrocks {
 class RowDescriptor;
@@ -31,6 +36,20 @@ public:
     //  - is_consts()
     static StatusOr<ChunkPB> serialize_without_meta(const vectorized::Chunk& chunk);
 
+    // Like `serialize_without_meta()` but write the data to a contiguous block appended to |buf|, instead of
+    // ChunkPB::data(), and set ChunkPB::data_size().
+    // The data is written to the memory of |buf| directly, so it can be sent as the brpc attachment without copying
+    // it again, and the copies of |buf| share the same block. The returned slice is valid as long as |buf| holds it.
+    static StatusOr<Slice> serialize_without_meta_to_iobuf(const vectorized::Chunk& chunk, ChunkPB* chunk_pb,
+                                                           butil::IOBuf* buf);
+
+    // Fill the following fields of ChunkPB, which are left unfilled by `serialize_without_meta()`:
+    //  - slot_id_map()
+    //  - tuple_id_map()
+    //  - is_nulls()
+    //  - is_consts()
+    static void serialize_meta(const vectorized::Chunk& chunk, ChunkPB* chunk_pb);
+
     // REQUIRE: the following fields of |chunk_pb| must be non-empty:
     //  - slot_id_map()
     //  - tuple_id_map()
@@ -21,10 +21,15 @@
 
 #include "service/internal_service.h"
 
+#include <fmt/format.h>
+
+#include <atomic>
+
 #include "common/closure_guard.h"
 #include "common/config.h"
 #include "exec/pipeline/fragment_context.h"
 #include "exec/pipeline/fragment_executor.h"
+#include "fs/fs_util.h"
 #include "gen_cpp/BackendService.h"
 #include "gutil/strings/substitute.h"
 #include "runtime/buffer_control_block.h"
@@ -101,7 +106,10 @@ void PInternalServiceImplBase<T>::transmit_chunk(google::protobuf::RpcController
     }
     Status st;
     st.to_protobuf(response->mutable_status());
-    st = _exec_env->stream_mgr()->transmit_chunk(*request, &done);
+    // No credit is advertised if the receiver holds done until the buffered chunks are consumed.
+    response->set_credit_bytes(0);
+    int64_t credit_bytes = 0;
+    st = _exec_env->stream_mgr()->transmit_chunk(*request, &done, &credit_bytes);
     if (!st.ok()) {
         LOG(WARNING) << "transmit_data failed, message=" << st.get_error_msg()
                      << ", fragment_instance_id=" << print_id(request->finst_id()) << ", node=" << request->node_id();
@@ -109,6 +117,7 @@ void PInternalServiceImplBase<T>::transmit_chunk(google::protobuf::RpcController
     if (done != nullptr) {
         // NOTE: only when done is not null, we can set response status
         st.to_protobuf(response->mutable_status());
+        response->set_credit_bytes(credit_bytes);
         done->Run();
     }
 }
@@ -174,6 +183,31 @@ void PInternalServiceImplBase<T>::tablet_writer_cancel(google::protobuf::RpcCont
                                                        PTabletWriterCancelResult* response,
                                                        google::protobuf::Closure* done) {}
 
+// Writes the serialized fragment into <capture_dir>/<query_id>/<seq>_<fragment_instance_id>.thrift, so the
+// fragments of a query are replayed in the order they are received.
+static void capture_plan_fragment(const TExecPlanFragmentParams& t_request, const std::string& ser_request) {
+    static std::atomic<int64_t> num_captured{0};
+    const int64_t seq = num_captured++;
+    if (seq >= config::plan_fragment_capture_max_num) {
+        return;
+    }
+    const std::string dir = config::plan_fragment_capture_dir + "/" + print_id(t_request.params.query_id);
+    const std::string path =
+            fmt::format("{}/{:010d}_{}.thrift", dir, seq, print_id(t_request.params.fragment_instance_id));
+    Status st = fs::create_directories(dir);
+    if (st.ok()) {
+        auto maybe_file = fs::new_writable_file(path);
+        st = maybe_file.status();
+        if (st.ok()) {
+            st = (*maybe_file)->append(ser_request);
+            if (st.ok()) {
+                st = (*maybe_file)->close();
+            }
+        }
+    }
+    LOG_IF(WARNING, !st.ok()) << "Fail to capture plan fragment to " << path << ": " << st;
+}
+
 template <typename T>
 Status PInternalServiceImplBase<T>::_exec_plan_fragment(brpc::Controller* cntl) {
     auto ser_request = cntl->request_attachment().to_string();
@@ -183,6 +217,9 @@ Status PInternalServiceImplBase<T>::_exec_plan_fragment(brpc::Controller* cntl)
         uint32_t len = ser_request.size();
         RETURN_IF_ERROR(deserialize_thrift_msg(buf, &len, TProtocolType::BINARY, &t_request));
     }
+    if (UNLIKELY(!config::plan_fragment_capture_dir.empty())) {
+        capture_plan_fragment(t_request, ser_request);
+    }
     bool is_pipeline = t_request.__isset.is_pipeline && t_request.is_pipeline;
     LOG(INFO) << "exec plan fragment, fragment_instance_id=" << print_id(t_request.params.fragment_instance_id)
               << ", coord=" << t_request.coord << ", backend=" << t_request.backend_num
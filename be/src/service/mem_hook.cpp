@@ -10,6 +10,7 @@
 #include "common/compiler_util.h"
 
 #ifndef BE_TEST
+#include "runtime/alloc_sampler.h"
 #include "runtime/current_thread.h"
 #include "runtime/exec_env.h"
 #endif
@@ -204,6 +205,13 @@ void operator delete[](void* p, size_t size, std::align_val_t al) noexcept {
 #define SET_EXCEED_MEM_TRACKER() \
     starrocks::tls_exceed_mem_tracker = starrocks::ExecEnv::GetInstance()->process_mem_tracker()
 #define IS_BAD_ALLOC_CATCHED() starrocks::tls_thread_status.is_catched()
+#define SAMPLE_ALLOC(ptr, size)                                           \
+    do {                                                                  \
+        if (UNLIKELY(starrocks::AllocSampler::should_sample(size))) {     \
+            starrocks::AllocSampler::instance()->record_alloc(ptr, size); \
+        }                                                                 \
+    } while (0)
+#define SAMPLE_FREE(ptr) starrocks::AllocSampler::on_free(ptr)
 #else
 std::atomic<int64_t> g_mem_usage(0);
 #define TC_MALLOC_SIZE(ptr) tc_malloc_size(ptr)
@@ -214,6 +222,8 @@ std::atomic<int64_t> g_mem_usage(0);
 #define TRY_MEM_CONSUME(size, err_ret) g_mem_usage.fetch_add(size)
 #define SET_EXCEED_MEM_TRACKER() (void)0
 #define IS_BAD_ALLOC_CATCHED() false
+#define SAMPLE_ALLOC(ptr, size) (void)0
+#define SAMPLE_FREE(ptr) (void)0
 #endif
 
 extern "C" {
@@ -228,6 +238,7 @@ void* my_malloc(size_t size) __THROW {
             SET_EXCEED_MEM_TRACKER();
             MEMORY_RELEASE_SIZE(tc_nallocx(size, 0));
         }
+        SAMPLE_ALLOC(ptr, size);
         return ptr;
     } else {
         void* ptr = tc_malloc(size);
@@ -236,12 +247,14 @@ void* my_malloc(size_t size) __THROW {
         if (LIKELY(ptr != nullptr)) {
             MEMORY_CONSUME_SIZE(tc_nallocx(size, 0));
         }
+        SAMPLE_ALLOC(ptr, size);
         return ptr;
     }
 }
 
 // free
 void my_free(void* p) __THROW {
+    SAMPLE_FREE(p);
     MEMORY_RELEASE_PTR(p);
     tc_free(p);
 }
@@ -255,6 +268,8 @@ void* my_realloc(void* p, size_t size) __THROW {
         return nullptr;
     }
     int64_t old_size = TC_MALLOC_SIZE(p);
+    // The sample of the old block is removed even if tc_realloc() fails, which is rare.
+    SAMPLE_FREE(p);
 
     if (IS_BAD_ALLOC_CATCHED()) {
         TRY_MEM_CONSUME(tc_nallocx(size, 0) - old_size, nullptr);
@@ -263,6 +278,7 @@ void* my_realloc(void* p, size_t size) __THROW {
             SET_EXCEED_MEM_TRACKER();
             MEMORY_RELEASE_SIZE(tc_nallocx(size, 0) - old_size);
         }
+        SAMPLE_ALLOC(ptr, size);
         return ptr;
     } else {
         void* ptr = tc_realloc(p, size);
@@ -272,6 +288,7 @@ void* my_realloc(void* p, size_t size) __THROW {
             // nothing to do.
             // If tc_realloc() fails the original block is left untouched; it is not freed or moved
         }
+        SAMPLE_ALLOC(ptr, size);
         return ptr;
     }
 }
@@ -293,15 +310,18 @@ void* my_calloc(size_t n, size_t size) __THROW {
         } else {
             MEMORY_CONSUME_SIZE(TC_MALLOC_SIZE(ptr) - n * size);
         }
+        SAMPLE_ALLOC(ptr, n * size);
         return ptr;
     } else {
         void* ptr = tc_calloc(n, size);
         MEMORY_CONSUME_PTR(ptr);
+        SAMPLE_ALLOC(ptr, n * size);
         return ptr;
     }
 }
 
 void my_cfree(void* ptr) __THROW {
+    SAMPLE_FREE(ptr);
     MEMORY_RELEASE_PTR(ptr);
     tc_cfree(ptr);
 }
@@ -317,10 +337,12 @@ void* my_memalign(size_t align, size_t size) __THROW {
         } else {
             MEMORY_CONSUME_SIZE(TC_MALLOC_SIZE(ptr) - size);
         }
+        SAMPLE_ALLOC(ptr, size);
         return ptr;
     } else {
         void* ptr = tc_memalign(align, size);
         MEMORY_CONSUME_PTR(ptr);
+        SAMPLE_ALLOC(ptr, size);
         return ptr;
     }
 }
@@ -336,10 +358,12 @@ void* my_aligned_alloc(size_t align, size_t size) __THROW {
         } else {
             MEMORY_CONSUME_SIZE(TC_MALLOC_SIZE(ptr) - size);
         }
+        SAMPLE_ALLOC(ptr, size);
         return ptr;
     } else {
         void* ptr = tc_memalign(align, size);
         MEMORY_CONSUME_PTR(ptr);
+        SAMPLE_ALLOC(ptr, size);
         return ptr;
     }
 }
@@ -355,10 +379,12 @@ void* my_valloc(size_t size) __THROW {
         } else {
             MEMORY_CONSUME_SIZE(TC_MALLOC_SIZE(ptr) - size);
         }
+        SAMPLE_ALLOC(ptr, size);
         return ptr;
     } else {
         void* ptr = tc_valloc(size);
         MEMORY_CONSUME_PTR(ptr);
+        SAMPLE_ALLOC(ptr, size);
         return ptr;
     }
 }
@@ -374,10 +400,12 @@ void* my_pvalloc(size_t size) __THROW {
         } else {
             MEMORY_CONSUME_SIZE(TC_MALLOC_SIZE(ptr) - size);
         }
+        SAMPLE_ALLOC(ptr, size);
         return ptr;
     } else {
         void* ptr = tc_pvalloc(size);
         MEMORY_CONSUME_PTR(ptr);
+        SAMPLE_ALLOC(ptr, size);
         return ptr;
     }
 }
@@ -392,12 +420,14 @@ int my_posix_memalign(void** r, size_t align, size_t size) __THROW {
             MEMORY_RELEASE_SIZE(size);
         } else {
             MEMORY_CONSUME_SIZE(TC_MALLOC_SIZE(*r) - size);
+            SAMPLE_ALLOC(*r, size);
         }
         return ret;
     } else {
         int ret = tc_posix_memalign(r, align, size);
         if (ret == 0) {
             MEMORY_CONSUME_PTR(*r);
+            SAMPLE_ALLOC(*r, size);
         }
         return ret;
     }
@@ -25,10 +25,13 @@
 #include "gutil/stl_util.h"
 #include "http/action/checksum_action.h"
 #include "http/action/compaction_action.h"
+#include "http/action/cpu_samples_action.h"
 #include "http/action/health_action.h"
+#include "http/action/mem_samples_action.h"
 #include "http/action/meta_action.h"
 #include "http/action/metrics_action.h"
 #include "http/action/pprof_actions.h"
+#include "http/action/query_trace_action.h"
 #include "http/action/reload_tablet_action.h"
 #include "http/action/restore_tablet_action.h"
 #include "http/action/runtime_filter_cache_action.h"
@@ -190,6 +193,18 @@ Status HttpServiceBE::start() {
                                       runtime_filter_cache_action);
     _http_handlers.emplace_back(runtime_filter_cache_action);
 
+    QueryTraceAction* query_trace_action = new QueryTraceAction();
+    _ev_http_server->register_handler(HttpMethod::GET, "/api/query_trace/{query_id}", query_trace_action);
+    _http_handlers.emplace_back(query_trace_action);
+
+    CpuSamplesAction* cpu_samples_action = new CpuSamplesAction();
+    _ev_http_server->register_handler(HttpMethod::GET, "/api/cpu_samples", cpu_samples_action);
+    _http_handlers.emplace_back(cpu_samples_action);
+
+    MemSamplesAction* mem_samples_action = new MemSamplesAction();
+    _ev_http_server->register_handler(HttpMethod::GET, "/api/mem_samples", mem_samples_action);
+    _http_handlers.emplace_back(mem_samples_action);
+
     RETURN_IF_ERROR(_ev_http_server->start());
     return Status::OK();
 }
@@ -40,6 +40,8 @@
 #include "common/status.h"
 #include "exec/pipeline/query_context.h"
 #include "fs/fs_util.h"
+#include "runtime/alloc_sampler.h"
+#include "runtime/cpu_sampler.h"
 #include "runtime/exec_env.h"
 #include "runtime/heartbeat_flags.h"
 #include "runtime/jdbc_driver_manager.h"
@@ -76,11 +78,15 @@ static void thrift_output(const char* x) {
 } // namespace starrocks
 
 extern int meta_tool_main(int argc, char** argv);
+extern int fragment_replay_main(int argc, char** argv);
 
 int main(int argc, char** argv) {
     if (argc > 1 && strcmp(argv[1], "meta_tool") == 0) {
         return meta_tool_main(argc - 1, argv + 1);
     }
+    if (argc > 1 && strcmp(argv[1], "fragment_replay") == 0) {
+        return fragment_replay_main(argc - 1, argv + 1);
+    }
     bool as_cn = false;
     // Check if print version or help or cn.
     if (argc > 1) {
@@ -247,6 +253,16 @@ int main(int argc, char** argv) {
 
     // Init exec env.
     EXIT_IF_ERROR(starrocks::ExecEnv::init(exec_env, paths));
+    if (starrocks::config::cpu_sampler_frequency_hz > 0) {
+        auto st = starrocks::CpuSampler::instance()->start(starrocks::config::cpu_sampler_frequency_hz,
+                                                           starrocks::config::cpu_sampler_max_samples);
+        LOG_IF(WARNING, !st.ok()) << "Fail to start cpu sampler: " << st;
+    }
+    if (starrocks::config::alloc_sampler_interval_bytes > 0) {
+        auto st = starrocks::AllocSampler::instance()->start(starrocks::config::alloc_sampler_interval_bytes,
+                                                             starrocks::config::alloc_sampler_max_samples);
+        LOG_IF(WARNING, !st.ok()) << "Fail to start alloc sampler: " << st;
+    }
     exec_env->set_storage_engine(engine);
     engine->set_heartbeat_flags(exec_env->heartbeat_flags());
 
@@ -0,0 +1,137 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+#if defined(__AVX2__) || defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+
+#include "gutil/bits.h"
+
+namespace SIMD {
+
+// The number of the filter bytes covered by a mask of filter_mask32().
+constexpr size_t kFilterBatchSize = 32;
+
+// Returns the mask of filter[0, 32), whose i-th bit is set if filter[i] is nonzero.
+inline uint32_t filter_mask32(const uint8_t* filter) {
+#ifdef __AVX2__
+    const __m256i f = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(filter));
+    return ~static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(f, _mm256_setzero_si256())));
+#elif defined(__SSE2__)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i f0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(filter));
+    const __m128i f1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(filter + 16));
+    const auto m0 = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(f0, zero)));
+    const auto m1 = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(f1, zero)));
+    return ~(m0 | (m1 << 16));
+#else
+    // Vectorized by the compilers, e.g. for NEON.
+    uint32_t mask = 0;
+    for (size_t i = 0; i < kFilterBatchSize; i++) {
+        mask |= static_cast<uint32_t>(filter[i] != 0) << i;
+    }
+    return mask;
+#endif
+}
+
+namespace detail {
+
+#ifdef __AVX512F__
+// Moves the elements of src[0, 32) selected by |mask| to dst in order, returns the number of them.
+// dst may overlap src at the lower addresses, since the batch is loaded before it's stored.
+template <typename T>
+inline size_t compress_batch(T* dst, const T* src, uint32_t mask) {
+    if constexpr (sizeof(T) == 4) {
+        const __m512i v0 = _mm512_loadu_si512(src);
+        const __m512i v1 = _mm512_loadu_si512(src + 16);
+        _mm512_mask_compressstoreu_epi32(dst, static_cast<__mmask16>(mask), v0);
+        dst += Bits::CountOnes(mask & 0xffff);
+        _mm512_mask_compressstoreu_epi32(dst, static_cast<__mmask16>(mask >> 16), v1);
+    } else {
+        static_assert(sizeof(T) == 8);
+        __m512i v[4];
+        for (int i = 0; i < 4; i++) {
+            v[i] = _mm512_loadu_si512(src + i * 8);
+        }
+        for (int i = 0; i < 4; i++) {
+            const auto m = static_cast<__mmask8>(mask >> (i * 8));
+            _mm512_mask_compressstoreu_epi64(dst, m, v[i]);
+            dst += Bits::CountOnes(m);
+        }
+    }
+    return Bits::CountOnes(mask);
+}
+#endif
+
+} // namespace detail
+
+// Keeps the elements data[i], i in [from, to), whose filter[i] is nonzero, by moving them to data[from, result) in
+// order, and returns the result. The filter is checked 32 bytes at a time, so the empty and the full batches are
+// skipped or moved at once, and the sparse ones only visit the selected elements. With AVX-512, the mixed batches of
+// the 4-byte and 8-byte elements are compressed by vpcompress.
+template <typename T>
+inline size_t filter_range(const uint8_t* filter, T* data, size_t from, size_t to) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    size_t src = from;
+    size_t dst = from;
+    for (; src + kFilterBatchSize <= to; src += kFilterBatchSize) {
+        uint32_t mask = filter_mask32(filter + src);
+        if (mask == 0) {
+            continue;
+        }
+        if (mask == 0xffffffff) {
+            memmove(data + dst, data + src, kFilterBatchSize * sizeof(T));
+            dst += kFilterBatchSize;
+            continue;
+        }
+#ifdef __AVX512F__
+        if constexpr (sizeof(T) == 4 || sizeof(T) == 8) {
+            dst += detail::compress_batch(data + dst, data + src, mask);
+            continue;
+        }
+#endif
+        while (mask != 0) {
+            data[dst++] = data[src + Bits::CountTrailingZerosNonZero32(mask)];
+            mask &= mask - 1;
+        }
+    }
+    for (; src < to; ++src) {
+        if (filter[src]) {
+            data[dst++] = data[src];
+        }
+    }
+    return dst;
+}
+
+// Calls func(i) for each i in [from, to) whose filter[i] is nonzero in order, and func_batch(i) instead for each
+// 32 elements [i, i + 32) all selected, so the callers can process a full batch at once.
+template <typename Func, typename BatchFunc>
+inline void for_each_selected(const uint8_t* filter, size_t from, size_t to, Func&& func, BatchFunc&& func_batch) {
+    size_t i = from;
+    for (; i + kFilterBatchSize <= to; i += kFilterBatchSize) {
+        uint32_t mask = filter_mask32(filter + i);
+        if (mask == 0xffffffff) {
+            func_batch(i);
+            continue;
+        }
+        while (mask != 0) {
+            func(i + Bits::CountTrailingZerosNonZero32(mask));
+            mask &= mask - 1;
+        }
+    }
+    for (; i < to; ++i) {
+        if (filter[i]) {
+            func(i);
+        }
+    }
+}
+
+} // namespace SIMD
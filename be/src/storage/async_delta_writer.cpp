@@ -26,7 +26,10 @@ int AsyncDeltaWriter::_execute(void* meta, bthread::TaskIterator<AsyncDeltaWrite
     for (; iter; ++iter) {
         Status st;
         if (iter->chunk != nullptr && iter->indexes_size > 0) {
-            st = writer->write(*iter->chunk, iter->indexes, 0, iter->indexes_size);
+            st = writer->write(iter->chunk, iter->indexes, 0, iter->indexes_size);
+        }
+        if (st.ok() && iter->flush_after_write) {
+            st = writer->flush_memtable();
         }
         if (st.ok() && iter->commit_after_write) {
             if (st = writer->close(); !st.ok()) {
@@ -105,6 +108,18 @@ void AsyncDeltaWriter::commit(AsyncDeltaWriterCallback* cb) {
     }
 }
 
+void AsyncDeltaWriter::flush(AsyncDeltaWriterCallback* cb) {
+    DCHECK(cb != nullptr);
+    Task task;
+    task.write_cb = cb;
+    task.flush_after_write = true;
+    int r = bthread::execution_queue_execute(_queue_id, task);
+    if (r != 0) {
+        LOG(WARNING) << "Fail to execution_queue_execute: " << r;
+        task.write_cb->run(Status::InternalError("fail to call execution_queue_execute"), nullptr);
+    }
+}
+
 void AsyncDeltaWriter::abort(bool with_log) {
     _writer->abort(with_log);
 }
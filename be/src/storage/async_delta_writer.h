@@ -36,9 +36,8 @@ public:
 
     // REQUIRE:
     //  - |cb| cannot be NULL
-    //  - if |req.chunk| is not NULL, the chunk it points to must be kept alive until |cb->run()| been called
     //  - if |req.chunk| is not NULL, |req.indexes| must not be NULL and kept alive until |cb->run()| been
-    //    called.
+    //    called. The chunk may be referenced by the MemTable after that, and must not be modified.
     //
     // [thread-safe and wait-free]
     void write(const AsyncDeltaWriterRequest& req, AsyncDeltaWriterCallback* cb);
@@ -46,11 +45,17 @@ public:
     // [thread-safe and wait-free]
     void commit(AsyncDeltaWriterCallback* cb);
 
+    // Flush the MemTable after the writes submitted before, and run |cb| after it has been written to disk.
+    // [thread-safe and wait-free]
+    void flush(AsyncDeltaWriterCallback* cb);
+
     // [thread-safe and wait-free]
     void abort(bool with_log = true);
 
     int64_t partition_id() const { return _writer->partition_id(); }
 
+    size_t write_buffer_size() const { return _writer->write_buffer_size(); }
+
 private:
     struct private_type {
         explicit private_type(int) {}
@@ -58,11 +63,12 @@ private:
 
     struct Task {
         // If chunk == nullptr, this is a commit task
-        vectorized::Chunk* chunk = nullptr;
+        vectorized::ChunkPtr chunk;
         const uint32_t* indexes = nullptr;
         AsyncDeltaWriterCallback* write_cb;
         uint32_t indexes_size = 0;
         bool commit_after_write = false;
+        bool flush_after_write = false;
     };
 
     Status _init();
@@ -83,7 +89,7 @@ public:
 class AsyncDeltaWriterRequest {
 public:
     // nullptr means no record to write
-    vectorized::Chunk* chunk = nullptr;
+    vectorized::ChunkPtr chunk;
     const uint32_t* indexes = nullptr;
     uint32_t indexes_size = 0;
     bool commit_after_write = false;
@@ -53,6 +53,9 @@ public:
 
     size_t merged_rows() const { return _merged_rows; }
 
+    // the number of the rows aggregated since the last `aggregate_reset`.
+    uint32_t aggregate_rows() const { return _aggregate_rows; }
+
     size_t bytes_usage();
 
     void close();
@@ -171,13 +171,6 @@ ColumnId ChunkHelper::max_column_id(const starrocks::vectorized::Schema& schema)
     return id;
 }
 
-template <typename T>
-struct ColumnDeleter {
-    ColumnDeleter(uint32_t chunk_size) : chunk_size(chunk_size) {}
-    void operator()(Column* ptr) const { return_column<T>(down_cast<T*>(ptr), chunk_size); }
-    uint32_t chunk_size;
-};
-
 template <typename T, bool force>
 inline std::shared_ptr<T> get_column_ptr(size_t chunk_size) {
     if constexpr (std::negation_v<HasColumnPool<T>>) {
@@ -185,7 +178,7 @@ inline std::shared_ptr<T> get_column_ptr(size_t chunk_size) {
     } else {
         T* ptr = get_column<T, force>();
         if (LIKELY(ptr != nullptr)) {
-            return std::shared_ptr<T>(ptr, ColumnDeleter<T>(chunk_size));
+            return std::shared_ptr<T>(ptr, ColumnPoolDeleter<T>(chunk_size));
         } else {
             return std::make_shared<T>();
         }
@@ -200,6 +193,9 @@ inline std::shared_ptr<DecimalColumnType<T>> get_decimal_column_ptr(int precisio
     return column;
 }
 
+template <bool force>
+ColumnPtr column_from_pool(const Field& field, size_t chunk_size);
+
 template <bool force>
 struct ColumnPtrBuilder {
     template <FieldType ftype>
@@ -211,7 +207,8 @@ struct ColumnPtrBuilder {
         };
 
         if constexpr (ftype == OLAP_FIELD_TYPE_ARRAY) {
-            auto elements = field.sub_field(0).create_column();
+            // the elements are returned to the pool along with the offsets, not freed
+            auto elements = column_from_pool<force>(field.sub_field(0), chunk_size);
             auto offsets = get_column_ptr<UInt32Column, force>(chunk_size);
             auto array = ArrayColumn::create(std::move(elements), offsets);
             return nullable(array);
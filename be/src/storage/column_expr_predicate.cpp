@@ -13,6 +13,9 @@
 #include "runtime/descriptors.h"
 #include "runtime/primitive_type.h"
 #include "runtime/runtime_state.h"
+#include "storage/rowset/bloom_filter.h"
+#include "storage/rowset/inverted_index_reader.h"
+#include "storage/rowset/ngram.h"
 #include "storage/vectorized_column_predicate.h"
 
 namespace starrocks::vectorized {
@@ -166,6 +169,52 @@ bool ColumnExprPredicate::zone_map_filter(const ZoneMapDetail& detail) const {
     return false;
 }
 
+bool ColumnExprPredicate::_get_like_pattern(Slice* pattern) const {
+    if (_expr_ctxs.size() != 1) {
+        return false;
+    }
+    Expr* root = _expr_ctxs[0]->root();
+    if (root->fn().name.function_name != "like" || root->get_num_children() != 2 ||
+        !root->get_child(0)->is_slotref() || !root->get_child(1)->is_constant()) {
+        return false;
+    }
+    // the constant column is cached by the expression, so the pattern outlives the call.
+    auto column = root->get_child(1)->evaluate_const(_expr_ctxs[0]);
+    if (!column.ok() || column.value() == nullptr || !column.value()->is_constant() || column.value()->only_null()) {
+        return false;
+    }
+    *pattern = ColumnHelper::get_const_value<TYPE_VARCHAR>(column.value());
+    return true;
+}
+
+Status ColumnExprPredicate::seek_inverted_index(InvertedIndexIterator* iter, Roaring* rows, bool* exact) const {
+    Slice pattern;
+    if (!_get_like_pattern(&pattern)) {
+        return Status::Cancelled("unsupported expression");
+    }
+    return iter->read_like(pattern, rows, exact);
+}
+
+bool ColumnExprPredicate::support_ngram_bloom_filter() const {
+    Slice pattern;
+    return _get_like_pattern(&pattern);
+}
+
+bool ColumnExprPredicate::ngram_bloom_filter(const BloomFilter* bf, size_t gram_size) const {
+    Slice pattern;
+    if (!_get_like_pattern(&pattern)) {
+        return true;
+    }
+    for (const std::string& literal : like_pattern_literals(pattern)) {
+        bool matched = for_each_ngram(literal, gram_size,
+                                      [bf](const Slice& gram) { return bf->test_bytes(gram.data, gram.size); });
+        if (!matched) {
+            return false;
+        }
+    }
+    return true;
+}
+
 Status ColumnExprPredicate::convert_to(const ColumnPredicate** output, const TypeInfoPtr& target_type_info,
                                        ObjectPool* obj_pool) const {
     TypeDescriptor input_type = TypeDescriptor::from_storage_type_info(target_type_info.get());
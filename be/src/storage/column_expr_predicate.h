@@ -12,6 +12,7 @@ class SlotDescriptor;
 class SparseRange;
 class ExprContext;
 class BitmapIndexIterator;
+class InvertedIndexIterator;
 class ObjectPool;
 } // namespace starrocks
 
@@ -43,6 +44,10 @@ public:
 
     bool zone_map_filter(const ZoneMapDetail& detail) const override;
     bool support_bloom_filter() const override { return false; }
+    // Only `column LIKE 'constant pattern'` is evaluated by the inverted index and the n-gram bloom filter.
+    Status seek_inverted_index(InvertedIndexIterator* iter, Roaring* rows, bool* exact) const override;
+    bool support_ngram_bloom_filter() const override;
+    bool ngram_bloom_filter(const BloomFilter* bf, size_t gram_size) const override;
     PredicateType type() const override { return PredicateType::kExpr; }
     bool can_vectorized() const override { return true; }
 
@@ -60,6 +65,9 @@ public:
                                               std::vector<const ColumnExprPredicate*>* output) const;
 
 private:
+    // Set |pattern| if the predicate is `column LIKE 'constant pattern'`.
+    bool _get_like_pattern(Slice* pattern) const;
+
     void _add_expr_ctxs(std::vector<ExprContext*> expr_ctxs);
 
     // Take ownership of this expression, not necessary to clone
@@ -1,5 +1,6 @@
 // This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
 
+#include <algorithm>
 #include <type_traits>
 
 #include "column/column.h"
@@ -20,7 +21,12 @@ class ColumnInPredicate : public ColumnPredicate {
 
 public:
     ColumnInPredicate(const TypeInfoPtr& type_info, ColumnId id, ItemSet values)
-            : ColumnPredicate(type_info, id), _values(std::move(values)) {}
+            : ColumnPredicate(type_info, id), _values(std::move(values)) {
+        if constexpr (is_integer_type()) {
+            _sorted_values.assign(_values.begin(), _values.end());
+            std::sort(_sorted_values.begin(), _sorted_values.end());
+        }
+    }
 
     ~ColumnInPredicate() override = default;
 
@@ -79,6 +85,16 @@ public:
     bool zone_map_filter(const ZoneMapDetail& detail) const override {
         const auto& min = detail.min_or_null_value();
         const auto& max = detail.max_value();
+        if constexpr (is_integer_type()) {
+            // a null datum is less than any value
+            if (max.is_null()) {
+                return false;
+            }
+            auto it = min.is_null() ? _sorted_values.begin()
+                                    : std::lower_bound(_sorted_values.begin(), _sorted_values.end(),
+                                                       min.get<ValueType>());
+            return it != _sorted_values.end() && *it <= max.get<ValueType>();
+        }
         const auto type_info = this->type_info();
         for (const ValueType& v : _values) {
             if (type_info->cmp(Datum(v), min) >= 0 && type_info->cmp(Datum(v), max) <= 0) {
@@ -160,7 +176,16 @@ public:
     }
 
 private:
+    static constexpr bool is_integer_type() {
+        return field_type == OLAP_FIELD_TYPE_TINYINT || field_type == OLAP_FIELD_TYPE_SMALLINT ||
+               field_type == OLAP_FIELD_TYPE_INT || field_type == OLAP_FIELD_TYPE_BIGINT ||
+               field_type == OLAP_FIELD_TYPE_LARGEINT;
+    }
+
     ItemSet _values;
+    // the values in ascending order for the integer types, so that the zone map of a large IN list
+    // is checked by a binary search instead of comparing every value.
+    std::vector<ValueType> _sorted_values;
 };
 
 // Template specialization for binary column
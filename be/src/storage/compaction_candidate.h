@@ -58,13 +58,13 @@ struct CompactionCandidate {
     }
 };
 
-// Comparator should compare tablet by compaction score in descending order
+// Comparator should compare tablet by compaction priority in descending order
 // When compaction scores are equal, put smaller level ahead
 // when compaction score and level are equal, use tablet id(to be unique) instead(ascending)
 struct CompactionCandidateComparator {
     bool operator()(const CompactionCandidate& left, const CompactionCandidate& right) const {
-        int64_t left_score = static_cast<int64_t>(left.tablet->compaction_score(left.type) * 100);
-        int64_t right_score = static_cast<int64_t>(right.tablet->compaction_score(right.type) * 100);
+        int64_t left_score = static_cast<int64_t>(left.tablet->compaction_priority(left.type) * 100);
+        int64_t right_score = static_cast<int64_t>(right.tablet->compaction_priority(right.type) * 100);
         return left_score > right_score || (left_score == right_score && left.type > right.type) ||
                (left_score == right_score && left.type == right.type &&
                 left.tablet->tablet_id() < right.tablet->tablet_id());
@@ -14,6 +14,7 @@ std::string CompactionContext::to_string() const {
     ss << "compaction type:" << chosen_compaction_type << "\n";
     ss << "cumulative score:" << cumulative_score << "\n";
     ss << "base score:" << base_score << "\n";
+    ss << "scan heat weight:" << scan_heat_weight << "\n";
     ss << "cumulative rowset candidates:";
     for (auto& rowset : rowset_levels[0]) {
         ss << rowset->version() << ";";
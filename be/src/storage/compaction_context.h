@@ -30,6 +30,8 @@ struct CompactionContext {
     std::set<Rowset*, RowsetComparator> rowset_levels[LEVEL_NUMBER];
     double cumulative_score = 0;
     double base_score = 0;
+    // the weight of the scores by the scan heat of |tablet|.
+    double scan_heat_weight = 1;
     TabletSharedPtr tablet;
     CompactionType chosen_compaction_type = INVALID_COMPACTION;
 
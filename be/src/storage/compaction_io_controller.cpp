@@ -0,0 +1,68 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "storage/compaction_io_controller.h"
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+#include "common/config.h"
+#include "util/starrocks_metrics.h"
+#include "util/time.h"
+
+namespace starrocks {
+
+int64_t CompactionIOController::acquire(int64_t bytes) {
+    if (!config::enable_compaction_io_throttle || bytes <= 0) {
+        return 0;
+    }
+    int64_t wait_us = reserve(bytes, MonotonicMicros());
+    if (wait_us > 0) {
+        std::this_thread::sleep_for(std::chrono::microseconds(wait_us));
+        StarRocksMetrics::instance()->compaction_io_throttle_duration_us.increment(wait_us);
+    }
+    StarRocksMetrics::instance()->compaction_io_throttle_bytes.increment(bytes);
+    return wait_us;
+}
+
+int64_t CompactionIOController::reserve(int64_t bytes, int64_t now_us) {
+    std::lock_guard<std::mutex> l(_mutex);
+    if (_rate < 0) {
+        _rate = std::max<int64_t>(config::compaction_io_max_bytes_per_second, 1);
+        _tokens = static_cast<double>(_rate);
+        _last_refill_us = now_us;
+        _last_adjust_us = now_us;
+        StarRocksMetrics::instance()->disks_compaction_io_rate.set_metric(_path, _rate);
+    }
+    if (now_us > _last_refill_us) {
+        // the bucket holds the tokens of one second at most.
+        _tokens = std::min(static_cast<double>(_rate),
+                           _tokens + static_cast<double>(_rate) * (now_us - _last_refill_us) / kAdjustIntervalUs);
+        _last_refill_us = now_us;
+    }
+    if (now_us - _last_adjust_us >= kAdjustIntervalUs) {
+        _adjust_rate();
+        _last_adjust_us = now_us;
+    }
+    _tokens -= static_cast<double>(bytes);
+    if (_tokens >= 0) {
+        return 0;
+    }
+    return static_cast<int64_t>(-_tokens * kAdjustIntervalUs / _rate);
+}
+
+void CompactionIOController::_adjust_rate() {
+    int64_t io_ns = _foreground_io_ns.exchange(0, std::memory_order_relaxed);
+    int64_t ios = _foreground_ios.exchange(0, std::memory_order_relaxed);
+    int64_t max_rate = std::max<int64_t>(config::compaction_io_max_bytes_per_second, 1);
+    int64_t min_rate = std::clamp<int64_t>(config::compaction_io_min_bytes_per_second, 1, max_rate);
+    if (ios > 0 && io_ns / ios > config::compaction_io_target_latency_us * 1000) {
+        _rate /= 2;
+    } else {
+        _rate += std::max<int64_t>(max_rate / 10, 1);
+    }
+    _rate = std::clamp(_rate, min_rate, max_rate);
+    StarRocksMetrics::instance()->disks_compaction_io_rate.set_metric(_path, _rate);
+}
+
+} // namespace starrocks
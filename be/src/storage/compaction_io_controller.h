@@ -0,0 +1,59 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <utility>
+
+namespace starrocks {
+
+// A token bucket limiting the bytes read from the disk of a DataDir by the compactions.
+// Its rate follows the latency of the foreground reads of the same disk: every second, the rate is halved if the
+// average latency of the foreground I/Os exceeds `compaction_io_target_latency_us`, and grows by a tenth of
+// `compaction_io_max_bytes_per_second` otherwise, so the compactions back off while the queries are busy and speed
+// up while they are idle.
+// Thread-safe.
+class CompactionIOController {
+public:
+    explicit CompactionIOController(std::string path) : _path(std::move(path)) {}
+
+    // Record the foreground reads of |num_ios| I/Os taking |io_ns| in total.
+    void add_foreground_io(int64_t io_ns, int64_t num_ios) {
+        _foreground_io_ns.fetch_add(io_ns, std::memory_order_relaxed);
+        _foreground_ios.fetch_add(num_ios, std::memory_order_relaxed);
+    }
+
+    // Take |bytes| tokens for the compaction I/O, and sleep until the bucket is refilled if it runs out.
+    // Return the microseconds slept, 0 if `enable_compaction_io_throttle` is false.
+    int64_t acquire(int64_t bytes);
+
+    // Take |bytes| tokens at |now_us|, and return the microseconds to wait for the bucket to refill.
+    int64_t reserve(int64_t bytes, int64_t now_us);
+
+    // The current rate in bytes per second, -1 before the first reservation.
+    int64_t rate() const {
+        std::lock_guard<std::mutex> l(_mutex);
+        return _rate;
+    }
+
+private:
+    static constexpr int64_t kAdjustIntervalUs = 1000000;
+
+    void _adjust_rate();
+
+    const std::string _path;
+    std::atomic<int64_t> _foreground_io_ns{0};
+    std::atomic<int64_t> _foreground_ios{0};
+
+    mutable std::mutex _mutex;
+    int64_t _rate = -1;
+    // negative if the reservations are waiting for the tokens.
+    double _tokens = 0;
+    int64_t _last_refill_us = 0;
+    int64_t _last_adjust_us = 0;
+};
+
+} // namespace starrocks
@@ -1,10 +1,21 @@
 // This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
 #include "storage/compaction_task.h"
 
+#include <algorithm>
+
+#include "column/chunk.h"
+#include "common/config.h"
+#include "fs/fs.h"
 #include "runtime/current_thread.h"
 #include "runtime/mem_tracker.h"
 #include "storage/compaction_manager.h"
 #include "storage/compaction_scheduler.h"
+#include "storage/chunk_helper.h"
+#include "storage/rowset/beta_rowset.h"
+#include "storage/rowset/rowid_range_option.h"
+#include "storage/rowset/rowset_writer.h"
+#include "storage/rowset/segment.h"
+#include "storage/rowset/segment_options.h"
 #include "storage/storage_engine.h"
 #include "util/scoped_cleanup.h"
 #include "util/starrocks_metrics.h"
@@ -152,4 +163,141 @@ void CompactionTask::_failure_callback() {
     LOG(WARNING) << "compaction task:" << _task_info.task_id << ", tablet:" << _task_info.tablet_id << " failed.";
 }
 
+// The first and the last keys of a nonoverlapping rowset.
+struct RowsetKeyRange {
+    RowsetSharedPtr rowset;
+    vectorized::ChunkPtr first;
+    vectorized::ChunkPtr last;
+};
+
+// Read the key columns of the row |rowid| of |segment|.
+static StatusOr<vectorized::ChunkPtr> read_segment_key(Segment* segment, const vectorized::Schema& key_schema,
+                                                       const vectorized::SegmentReadOptions& options,
+                                                       const RowsetId& rowset_id, rowid_t rowid) {
+    vectorized::SegmentReadOptions seg_options = options;
+    seg_options.rowid_range_option = std::make_shared<vectorized::RowidRangeOption>(
+            rowset_id, segment->id(), vectorized::SparseRange(rowid, rowid + 1));
+    ASSIGN_OR_RETURN(auto iter, segment->new_iterator(key_schema, seg_options));
+    RETURN_IF_ERROR(iter->init_encoded_schema(vectorized::EMPTY_GLOBAL_DICTMAPS));
+    auto chunk = vectorized::ChunkHelper::new_chunk(key_schema, 1);
+    Status st = iter->get_next(chunk.get());
+    iter->close();
+    RETURN_IF_ERROR(st);
+    if (chunk->num_rows() != 1) {
+        return Status::InternalError(fmt::format("fail to read the row {} of segment {}", rowid, segment->id()));
+    }
+    return chunk;
+}
+
+static int compare_keys(const vectorized::Chunk& lhs, const vectorized::Chunk& rhs) {
+    for (size_t i = 0; i < lhs.num_columns(); i++) {
+        int r = lhs.get_column_by_index(i)->compare_at(0, 0, *rhs.get_column_by_index(i), -1);
+        if (r != 0) {
+            return r;
+        }
+    }
+    return 0;
+}
+
+// Read the key range of |rowset| into |range|, return false if the segments of |rowset| may overlap.
+static StatusOr<bool> read_rowset_key_range(const RowsetSharedPtr& rowset, const vectorized::Schema& key_schema,
+                                            OlapReaderStatistics* stats, RowsetKeyRange* range) {
+    if (rowset->rowset_meta()->segments_overlap() != NONOVERLAPPING && rowset->num_segments() > 1) {
+        return false;
+    }
+    auto* beta_rowset = down_cast<BetaRowset*>(rowset.get());
+    RETURN_IF_ERROR(beta_rowset->load());
+    Segment* first_segment = nullptr;
+    Segment* last_segment = nullptr;
+    for (const auto& segment : beta_rowset->segments()) {
+        if (segment->num_rows() > 0) {
+            first_segment = first_segment == nullptr ? segment.get() : first_segment;
+            last_segment = segment.get();
+        }
+    }
+    if (first_segment == nullptr) {
+        return false;
+    }
+    vectorized::SegmentReadOptions seg_options;
+    ASSIGN_OR_RETURN(seg_options.fs, FileSystem::CreateSharedFromString(rowset->rowset_path()));
+    seg_options.stats = stats;
+    range->rowset = rowset;
+    ASSIGN_OR_RETURN(range->first, read_segment_key(first_segment, key_schema, seg_options, rowset->rowset_id(), 0));
+    ASSIGN_OR_RETURN(range->last, read_segment_key(last_segment, key_schema, seg_options, rowset->rowset_id(),
+                                                   last_segment->num_rows() - 1));
+    return true;
+}
+
+StatusOr<bool> CompactionTask::_link_input_rowsets(Statistics* statistics) {
+    if (!config::enable_compaction_segment_link || _tablet->keys_type() != DUP_KEYS || _input_rowsets.size() <= 1 ||
+        _task_info.input_segments_num == 0) {
+        return false;
+    }
+    if (static_cast<int64_t>(_task_info.input_rowsets_size / _task_info.input_segments_num) <
+        config::compaction_segment_link_min_segment_size) {
+        return false;
+    }
+    {
+        // the rows deleted are only removed by merging.
+        std::shared_lock header_lock(_tablet->get_header_lock());
+        for (const auto& pred : _tablet->delete_predicates()) {
+            if (pred.version() <= _task_info.output_version.second) {
+                return false;
+            }
+        }
+    }
+
+    std::vector<ColumnId> key_cids(_tablet->num_key_columns());
+    for (ColumnId cid = 0; cid < key_cids.size(); cid++) {
+        key_cids[cid] = cid;
+    }
+    auto key_schema = vectorized::ChunkHelper::convert_schema_to_format_v2(_tablet->tablet_schema(), key_cids);
+    OlapReaderStatistics stats;
+    std::vector<RowsetKeyRange> ranges;
+    for (const auto& rowset : _input_rowsets) {
+        if (rowset->num_rows() == 0) {
+            continue;
+        }
+        RowsetKeyRange range;
+        ASSIGN_OR_RETURN(bool nonoverlapping, read_rowset_key_range(rowset, key_schema, &stats, &range));
+        if (!nonoverlapping) {
+            return false;
+        }
+        ranges.emplace_back(std::move(range));
+    }
+    std::sort(ranges.begin(), ranges.end(), [](const RowsetKeyRange& lhs, const RowsetKeyRange& rhs) {
+        return compare_keys(*lhs.first, *rhs.first) < 0;
+    });
+    // the rows of the same keys are in any order in a duplicate keys tablet, so the ranges may touch.
+    for (size_t i = 1; i < ranges.size(); i++) {
+        if (compare_keys(*ranges[i - 1].last, *ranges[i].first) > 0) {
+            return false;
+        }
+    }
+
+    TRACE("[Compaction] link the segments of $0 rowsets", ranges.size());
+    std::unique_ptr<RowsetWriter> output_rs_writer;
+    int64_t max_rows_per_segment = CompactionUtils::get_segment_max_rows(
+            config::max_segment_file_size, _task_info.input_rows_num, _task_info.input_rowsets_size);
+    RETURN_IF_ERROR(CompactionUtils::construct_output_rowset_writer(
+            _tablet.get(), max_rows_per_segment, HORIZONTAL_COMPACTION, _task_info.output_version, &output_rs_writer));
+    for (const auto& range : ranges) {
+        RETURN_IF_ERROR(output_rs_writer->add_rowset(range.rowset));
+    }
+    ASSIGN_OR_RETURN(_output_rowset, output_rs_writer->build());
+    _task_info.output_segments_num = _output_rowset->num_segments();
+    _task_info.output_rowset_size = _output_rowset->data_disk_size();
+    _task_info.output_num_rows = _output_rowset->num_rows();
+    TRACE_COUNTER_INCREMENT("output_rowset_data_size", _output_rowset->data_disk_size());
+    TRACE_COUNTER_INCREMENT("output_segments_num", _output_rowset->num_segments());
+    TRACE("[Compaction] output rowset linked");
+    LOG(INFO) << "compaction task_id:" << _task_info.task_id << ", tablet:" << _task_info.tablet_id << " linked "
+              << _output_rowset->num_segments() << " segments of " << _input_rowsets.size() << " rowsets";
+
+    statistics->output_rows = _output_rowset->num_rows();
+    statistics->merged_rows = 0;
+    statistics->filtered_rows = 0;
+    return true;
+}
+
 } // namespace starrocks
@@ -257,6 +257,12 @@ protected:
                   << ", input rowsets:" << input_stream_info.str() << ", input rowsets size:" << _input_rowsets.size();
     }
 
+    // Link the segment files of the input rowsets into the output rowset instead of merging their rows, if the
+    // tablet is of duplicate keys without delete predicates to apply, and the key ranges of the input rowsets don't
+    // overlap, e.g. the rowsets of a table loaded in the time order of its keys.
+    // Return false if the input rowsets need to be merged.
+    StatusOr<bool> _link_input_rowsets(Statistics* statistics);
+
     void _success_callback();
 
     void _failure_callback();
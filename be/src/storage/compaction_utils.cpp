@@ -8,6 +8,7 @@
 #include "storage/rowset/rowset_factory.h"
 #include "storage/rowset/rowset_writer.h"
 #include "storage/rowset/rowset_writer_context.h"
+#include "storage/size_tiered_compaction_policy.h"
 #include "storage/storage_engine.h"
 #include "storage/tablet.h"
 
@@ -57,6 +58,7 @@ Status CompactionUtils::construct_output_rowset_writer(Tablet* tablet, uint32_t
     context.max_rows_per_segment = max_rows_per_segment;
     context.writer_type =
             (algorithm == VERTICAL_COMPACTION ? RowsetWriterType::kVertical : RowsetWriterType::kHorizontal);
+    context.direct_io = true;
     Status st = RowsetFactory::create_rowset_writer(context, output_rowset_writer);
     if (!st.ok()) {
         std::stringstream ss;
@@ -96,6 +98,31 @@ void CompactionUtils::split_column_into_groups(size_t num_columns, size_t num_ke
     }
 }
 
+void CompactionUtils::split_column_into_groups(size_t num_columns, size_t num_key_columns,
+                                               int64_t max_columns_per_group,
+                                               const std::vector<int64_t>& column_row_sizes,
+                                               int64_t max_group_row_size,
+                                               std::vector<std::vector<uint32_t>>* column_groups) {
+    DCHECK_EQ(num_columns, column_row_sizes.size());
+    std::vector<uint32_t> key_columns;
+    for (size_t i = 0; i < num_key_columns; ++i) {
+        key_columns.emplace_back(i);
+    }
+    column_groups->emplace_back(std::move(key_columns));
+
+    int64_t group_row_size = 0;
+    for (size_t i = num_key_columns; i < num_columns; ++i) {
+        if (column_groups->size() == 1 ||
+            (static_cast<int64_t>(column_groups->back().size()) >= max_columns_per_group &&
+             group_row_size + column_row_sizes[i] > max_group_row_size)) {
+            column_groups->emplace_back();
+            group_row_size = 0;
+        }
+        column_groups->back().emplace_back(i);
+        group_row_size += column_row_sizes[i];
+    }
+}
+
 CompactionAlgorithm CompactionUtils::choose_compaction_algorithm(size_t num_columns, int64_t max_columns_per_group,
                                                                  size_t source_num) {
     // if the number of columns in the schema is less than or equal to max_columns_per_group, use HORIZONTAL_COMPACTION.
@@ -114,7 +141,9 @@ CompactionAlgorithm CompactionUtils::choose_compaction_algorithm(size_t num_colu
 }
 
 std::unique_ptr<CompactionPolicy> CompactionUtils::create_compaction_policy(CompactionContext* context) {
-    // now only support BaseAndCumulativeCompactionPolicy
+    if (config::enable_size_tiered_compaction_strategy) {
+        return std::make_unique<SizeTieredCompactionPolicy>(context);
+    }
     return std::make_unique<BaseAndCumulativeCompactionPolicy>(context);
 }
 
@@ -26,10 +26,12 @@
 #include <sys/stat.h>
 #include <utime.h>
 
+#include <atomic>
 #include <filesystem>
 #include <fstream>
 #include <set>
 #include <sstream>
+#include <thread>
 #include <utility>
 
 #include "common/config.h"
@@ -51,6 +53,7 @@
 #include "util/defer_op.h"
 #include "util/errno.h"
 #include "util/monotime.h"
+#include "util/starrocks_metrics.h"
 #include "util/string_util.h"
 
 using strings::Substitute;
@@ -70,7 +73,8 @@ DataDir::DataDir(const std::string& path, TStorageMedium::type storage_medium, T
           _tablet_manager(tablet_manager),
           _txn_manager(txn_manager),
           _cluster_id_mgr(std::make_shared<ClusterIdMgr>(path)),
-          _current_shard(0) {}
+          _current_shard(0),
+          _compaction_io_controller(path) {}
 
 DataDir::~DataDir() {
     delete _id_generator;
@@ -92,10 +96,29 @@ Status DataDir::init(bool read_only) {
     RETURN_IF_ERROR_WITH_WARN(_init_tmp_dir(), "_init_tmp_dir failed");
     RETURN_IF_ERROR_WITH_WARN(_init_meta(read_only), "_init_meta failed");
 
+    for (auto tier : {io::IO_TIER_PAGE_CACHE, io::IO_TIER_LOCAL_DISK}) {
+        auto labels = MetricLabels().add("path", _path).add("tier", io::io_tier_name(tier));
+        _read_bytes_metrics[tier] = std::make_unique<IntCounter>(MetricUnit::BYTES);
+        StarRocksMetrics::instance()->metrics()->register_metric("disks_read_bytes_total", labels,
+                                                                 _read_bytes_metrics[tier].get());
+        _read_time_us_metrics[tier] = std::make_unique<IntCounter>(MetricUnit::MICROSECONDS);
+        StarRocksMetrics::instance()->metrics()->register_metric("disks_read_time_us_total", labels,
+                                                                 _read_time_us_metrics[tier].get());
+    }
+
     _is_used = true;
     return Status::OK();
 }
 
+void DataDir::add_read_stats(const io::IOStats& io_stats) {
+    for (int i = 0; i < io::NUM_IO_TIERS; i++) {
+        if (_read_bytes_metrics[i] != nullptr && io_stats.read_count[i] > 0) {
+            _read_bytes_metrics[i]->increment(io_stats.read_bytes[i]);
+            _read_time_us_metrics[i]->increment(io_stats.read_ns[i] / 1000);
+        }
+    }
+}
+
 void DataDir::stop_bg_worker() {
     _stop_bg_worker = true;
     _cv.notify_one();
@@ -263,10 +286,12 @@ Status DataDir::load() {
     LOG(INFO) << "begin loading tablet from meta";
     std::set<int64_t> tablet_ids;
     std::set<int64_t> failed_tablet_ids;
-    auto load_tablet_func = [this, &tablet_ids, &failed_tablet_ids](int64_t tablet_id, int32_t schema_hash,
-                                                                    std::string_view value) -> bool {
+    std::mutex tablet_ids_lock;
+    auto load_tablet = [this, &tablet_ids, &failed_tablet_ids, &tablet_ids_lock](
+                               int64_t tablet_id, int32_t schema_hash, std::string_view value) {
         Status st =
                 _tablet_manager->load_tablet_from_meta(this, tablet_id, schema_hash, value, false, false, false, false);
+        std::lock_guard l(tablet_ids_lock);
         if (!st.ok() && !st.is_not_found()) {
             // load_tablet_from_meta() may return NotFound which means the tablet status is DELETED
             // This may happen when the tablet was just deleted before the BE restarted,
@@ -280,9 +305,49 @@ Status DataDir::load() {
         } else {
             tablet_ids.insert(tablet_id);
         }
+    };
+
+    // The metas are walked in order and loaded in batches by several threads, the tablets are locked by
+    // their shards in TabletManager, so that the tablets of a batch are created and initialized in parallel.
+    struct TabletMetaEntry {
+        int64_t tablet_id;
+        int32_t schema_hash;
+        std::string value;
+    };
+    const size_t num_threads = std::max(1, config::load_tablet_meta_thread_num_per_data_dir);
+    const size_t batch_size = num_threads * 256;
+    std::vector<TabletMetaEntry> batch;
+    auto load_batch = [&]() {
+        if (num_threads == 1 || batch.size() < 2) {
+            for (const auto& entry : batch) {
+                load_tablet(entry.tablet_id, entry.schema_hash, entry.value);
+            }
+        } else {
+            std::atomic<size_t> next{0};
+            std::vector<std::thread> threads;
+            threads.reserve(num_threads);
+            for (size_t i = 0; i < std::min(num_threads, batch.size()); ++i) {
+                threads.emplace_back([&]() {
+                    for (size_t idx = next++; idx < batch.size(); idx = next++) {
+                        load_tablet(batch[idx].tablet_id, batch[idx].schema_hash, batch[idx].value);
+                    }
+                });
+            }
+            for (auto& thread : threads) {
+                thread.join();
+            }
+        }
+        batch.clear();
+    };
+    auto load_tablet_func = [&](int64_t tablet_id, int32_t schema_hash, std::string_view value) -> bool {
+        batch.push_back(TabletMetaEntry{tablet_id, schema_hash, std::string(value)});
+        if (batch.size() >= batch_size) {
+            load_batch();
+        }
         return true;
     };
     Status load_tablet_status = TabletMetaManager::walk(_kv_store, load_tablet_func);
+    load_batch();
     if (failed_tablet_ids.size() != 0) {
         LOG(ERROR) << "load tablets from header failed"
                    << ", loaded tablet: " << tablet_ids.size() << ", error tablet: " << failed_tablet_ids.size()
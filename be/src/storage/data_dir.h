@@ -32,10 +32,13 @@
 #include "fs/fs.h"
 #include "gen_cpp/Types_types.h"
 #include "gen_cpp/olap_file.pb.h"
+#include "io/io_profiler.h"
 #include "storage/cluster_id_mgr.h"
+#include "storage/compaction_io_controller.h"
 #include "storage/kv_store.h"
 #include "storage/olap_common.h"
 #include "storage/rowset/rowset_id_generator.h"
+#include "util/metrics.h"
 
 namespace starrocks {
 
@@ -88,6 +91,12 @@ public:
 
     TStorageMedium::type storage_medium() const { return _storage_medium; }
 
+    CompactionIOController* compaction_io_controller() { return &_compaction_io_controller; }
+
+    // Account the reads of the tablets of this data dir from the page cache and the local disk, which are exported
+    // as the metrics disks_read_bytes_total and disks_read_time_us_total labeled by the path and the io tier.
+    void add_read_stats(const io::IOStats& io_stats);
+
     void register_tablet(Tablet* tablet);
     void deregister_tablet(Tablet* tablet);
     void clear_tablets(std::vector<TabletInfo>* tablet_infos);
@@ -159,6 +168,12 @@ private:
     std::condition_variable _cv;
     std::set<std::string> _all_check_paths;
     std::set<std::string> _all_tablet_schemahash_paths;
+
+    CompactionIOController _compaction_io_controller;
+
+    // Only the tiers of the page cache and the local disk are registered, the others are nullptr.
+    std::unique_ptr<IntCounter> _read_bytes_metrics[io::NUM_IO_TIERS];
+    std::unique_ptr<IntCounter> _read_time_us_metrics[io::NUM_IO_TIERS];
 };
 
 } // namespace starrocks
@@ -0,0 +1,71 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "storage/decoded_column_cache.h"
+
+#include "column/column.h"
+#include "runtime/current_thread.h"
+#include "runtime/mem_tracker.h"
+#include "util/defer_op.h"
+
+namespace starrocks {
+
+DecodedColumnCache* DecodedColumnCache::_s_instance = nullptr;
+
+void DecodedColumnCache::create_global_cache(MemTracker* mem_tracker, size_t capacity) {
+    if (_s_instance == nullptr) {
+        _s_instance = new DecodedColumnCache(mem_tracker, capacity);
+    }
+}
+
+void DecodedColumnCache::release_global_cache() {
+    if (_s_instance != nullptr) {
+        delete _s_instance;
+        _s_instance = nullptr;
+    }
+}
+
+std::string DecodedColumnCache::encode_key(const std::string& fname, ColumnId cid, bool nullable) {
+    std::string key(fname);
+    key.append(reinterpret_cast<const char*>(&cid), sizeof(cid));
+    key.push_back(nullable ? 1 : 0);
+    return key;
+}
+
+DecodedColumnCache::DecodedColumnCache(MemTracker* mem_tracker, size_t capacity)
+        : _mem_tracker(mem_tracker), _cache(new_lru_cache(capacity)) {}
+
+DecodedColumnCache::~DecodedColumnCache() = default;
+
+vectorized::ColumnPtr DecodedColumnCache::lookup(const std::string& key) {
+    auto* handle = _cache->lookup(CacheKey(key));
+    if (handle == nullptr) {
+        return nullptr;
+    }
+    vectorized::ColumnPtr column = *reinterpret_cast<vectorized::ColumnPtr*>(_cache->value(handle));
+#ifndef BE_TEST
+    MemTracker* prev_tracker = tls_thread_status.set_mem_tracker(_mem_tracker);
+    DeferOp op([&] { tls_thread_status.set_mem_tracker(prev_tracker); });
+#endif
+    _cache->release(handle);
+    return column;
+}
+
+void DecodedColumnCache::insert(const std::string& key, vectorized::ColumnPtr column) {
+    size_t charge = column->memory_usage();
+#ifndef BE_TEST
+    // The column is owned by the cache from now on.
+    tls_thread_status.mem_release(charge);
+    MemTracker* prev_tracker = tls_thread_status.set_mem_tracker(_mem_tracker);
+    tls_thread_status.mem_consume(charge);
+    DeferOp op([&] { tls_thread_status.set_mem_tracker(prev_tracker); });
+#endif
+
+    auto deleter = [](const starrocks::CacheKey& key, void* value) {
+        delete reinterpret_cast<vectorized::ColumnPtr*>(value);
+    };
+    auto* value = new vectorized::ColumnPtr(std::move(column));
+    auto* handle = _cache->insert(CacheKey(key), value, charge, deleter);
+    _cache->release(handle);
+}
+
+} // namespace starrocks
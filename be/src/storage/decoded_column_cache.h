@@ -0,0 +1,51 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "column/vectorized_fwd.h"
+#include "storage/olap_common.h"
+#include "util/lru_cache.h"
+
+namespace starrocks {
+
+class MemTracker;
+
+// Cache of the decoded columns of the small segments, e.g. the segments of the hot dimension tables, so that the
+// scans of them don't parse and decode the pages again. Each entry holds all the rows of a column of a segment.
+// Unlike StoragePageCache, it's not created unless `decoded_column_cache_limit` is set.
+class DecodedColumnCache {
+public:
+    // Create global instance of this class
+    static void create_global_cache(MemTracker* mem_tracker, size_t capacity);
+
+    static void release_global_cache();
+
+    // Return global instance, or nullptr if the cache is disabled.
+    static DecodedColumnCache* instance() { return _s_instance; }
+
+    // The key of the column |cid| of the segment file |fname|, which is decoded as a nullable column or not.
+    static std::string encode_key(const std::string& fname, ColumnId cid, bool nullable);
+
+    DecodedColumnCache(MemTracker* mem_tracker, size_t capacity);
+    ~DecodedColumnCache();
+
+    // Return the cached column of |key|, or nullptr if it's not found.
+    // The returned column is shared and must not be modified.
+    vectorized::ColumnPtr lookup(const std::string& key);
+
+    // Insert |column| with |key|, which must not be modified anymore.
+    void insert(const std::string& key, vectorized::ColumnPtr column);
+
+    size_t memory_usage() const { return _cache->get_memory_usage(); }
+
+private:
+    static DecodedColumnCache* _s_instance;
+
+    MemTracker* _mem_tracker = nullptr;
+    std::unique_ptr<Cache> _cache;
+};
+
+} // namespace starrocks
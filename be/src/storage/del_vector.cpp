@@ -27,6 +27,7 @@ void DelVector::_add_dels(const std::vector<uint32_t>& dels) {
     } else {
         _roaring->addMany(dels.size(), dels.data());
     }
+    _optimize();
     _update_stats();
 }
 
@@ -67,6 +68,7 @@ void DelVector::init(int64_t version, const uint32_t* data, size_t length) {
     if (length > 0) {
         _roaring = std::make_unique<Roaring>(length, data);
     }
+    _optimize();
     _update_stats();
 }
 
@@ -85,6 +87,15 @@ string DelVector::to_string() const {
     return strings::Substitute("version:$0 $1", _version, _roaring ? _roaring->toString() : string("null"));
 }
 
+void DelVector::_optimize() {
+    // the rows of a segment replaced by a later load are usually consecutive, which are kept in run containers
+    // taking a few bytes per run, instead of 2 bytes per row in array containers or 8KB in bitset containers.
+    if (_roaring) {
+        _roaring->runOptimize();
+        _roaring->shrinkToFit();
+    }
+}
+
 void DelVector::_update_stats() {
     // TODO(cbl): optimization
     if (_roaring) {
@@ -48,6 +48,10 @@ public:
 private:
     void _add_dels(const std::vector<uint32_t>& dels);
 
+    // Convert the containers to run containers where they are smaller, and release the unused capacity, which
+    // shrinks both the memory of the cached delvecs and the values written into the meta.
+    void _optimize();
+
     void _update_stats();
 
     bool _loaded = false;
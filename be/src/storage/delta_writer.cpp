@@ -180,6 +180,7 @@ Status DeltaWriter::_init() {
     writer_context.load_id = _opt.load_id;
     writer_context.segments_overlap = OVERLAPPING;
     writer_context.global_dicts = _opt.global_dicts;
+    writer_context.encoding_hints = _tablet->encoding_hints();
     Status st = RowsetFactory::create_rowset_writer(writer_context, &_rowset_writer);
     if (!st.ok()) {
         _set_state(kAborted);
@@ -196,6 +197,15 @@ Status DeltaWriter::_init() {
 }
 
 Status DeltaWriter::write(const Chunk& chunk, const uint32_t* indexes, uint32_t from, uint32_t size) {
+    return _write([&]() { return _mem_table->insert(chunk, indexes, from, size); });
+}
+
+Status DeltaWriter::write(const ChunkPtr& chunk, const uint32_t* indexes, uint32_t from, uint32_t size) {
+    return _write([&]() { return _mem_table->insert(chunk, indexes, from, size); });
+}
+
+template <typename Insert>
+Status DeltaWriter::_write(Insert&& insert) {
     SCOPED_THREAD_LOCAL_MEM_SETTER(_mem_tracker, false);
     // Delay the creation memtables until we write data.
     // Because for the tablet which doesn't have any written data, we will not use their memtables.
@@ -208,12 +218,12 @@ Status DeltaWriter::write(const Chunk& chunk, const uint32_t* indexes, uint32_t
                 fmt::format("Fail to prepare. tablet_id: {}, state: {}", _opt.tablet_id, _state_name(state)));
     }
     Status st;
-    bool full = _mem_table->insert(chunk, indexes, from, size);
-    if (_mem_tracker->limit_exceeded()) {
+    bool full = insert();
+    if (_opt.flush_on_memory_limit && _mem_tracker->limit_exceeded()) {
         VLOG(2) << "Flushing memory table due to memory limit exceeded";
         st = _flush_memtable();
         _reset_mem_table();
-    } else if (_mem_tracker->parent() && _mem_tracker->parent()->limit_exceeded()) {
+    } else if (_opt.flush_on_memory_limit && _mem_tracker->parent() && _mem_tracker->parent()->limit_exceeded()) {
         VLOG(2) << "Flushing memory table due to parent memory limit exceeded";
         st = _flush_memtable();
         _reset_mem_table();
@@ -221,6 +231,22 @@ Status DeltaWriter::write(const Chunk& chunk, const uint32_t* indexes, uint32_t
         st = _flush_memtable_async();
         _reset_mem_table();
     }
+    _write_buffer_size.store(_mem_table->write_buffer_size(), std::memory_order_relaxed);
+    if (!st.ok()) {
+        _set_state(kAborted);
+    }
+    return st;
+}
+
+Status DeltaWriter::flush_memtable() {
+    SCOPED_THREAD_LOCAL_MEM_SETTER(_mem_tracker, false);
+    // nothing to flush after closed or aborted, the status of which is returned by the other calls.
+    if (_get_state() != kWriting) {
+        return Status::OK();
+    }
+    // the MemTable is created again on the next write.
+    Status st = _flush_memtable();
+    _write_buffer_size.store(0, std::memory_order_relaxed);
     if (!st.ok()) {
         _set_state(kAborted);
     }
@@ -35,6 +35,9 @@ struct DeltaWriterOptions {
     // slots are in order of tablet's schema
     const std::vector<SlotDescriptor*>* slots;
     vectorized::GlobalDictByNameMaps* global_dicts = nullptr;
+    // whether a write flushes the MemTable when the memory limit is exceeded, otherwise the caller takes care of
+    // it by `flush_memtable()`.
+    bool flush_on_memory_limit = true;
 };
 
 // Writer for a particular (load, index, tablet).
@@ -50,6 +53,18 @@ public:
     // [NOT thread-safe]
     [[nodiscard]] Status write(const Chunk& chunk, const uint32_t* indexes, uint32_t from, uint32_t size);
 
+    // Same as above, but the MemTable may keep a reference of |chunk| instead of copying the rows.
+    // [NOT thread-safe]
+    [[nodiscard]] Status write(const ChunkPtr& chunk, const uint32_t* indexes, uint32_t from, uint32_t size);
+
+    // Flush the MemTable and wait until it has been written to disk, without closing this DeltaWriter.
+    // [NOT thread-safe]
+    [[nodiscard]] Status flush_memtable();
+
+    // The buffered bytes of the MemTable after the last write or flush.
+    // [thread-safe]
+    size_t write_buffer_size() const { return _write_buffer_size.load(std::memory_order_relaxed); }
+
     // Flush all in-memory data to disk, without waiting.
     // Subsequent `write()`s to this DeltaWriter will fail after this method returned.
     // [NOT thread-safe]
@@ -104,6 +119,9 @@ private:
 
     Status _init();
     Status _prepare();
+    // |insert| inserts the rows into |_mem_table| and returns whether it is full.
+    template <typename Insert>
+    Status _write(Insert&& insert);
     Status _flush_memtable_async();
     Status _flush_memtable();
     const char* _state_name(State state) const;
@@ -129,6 +147,7 @@ private:
 
     std::unique_ptr<FlushToken> _flush_token;
     bool _with_rollback_log;
+    std::atomic<size_t> _write_buffer_size{0};
 };
 
 } // namespace vectorized
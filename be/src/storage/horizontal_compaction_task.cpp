@@ -21,7 +21,10 @@ namespace starrocks {
 
 Status HorizontalCompactionTask::run_impl() {
     Statistics statistics;
-    RETURN_IF_ERROR(_horizontal_compact_data(&statistics));
+    ASSIGN_OR_RETURN(bool linked, _link_input_rowsets(&statistics));
+    if (!linked) {
+        RETURN_IF_ERROR(_horizontal_compact_data(&statistics));
+    }
 
     TRACE_COUNTER_INCREMENT("merged_rows", statistics.merged_rows);
     TRACE_COUNTER_INCREMENT("filtered_rows", statistics.filtered_rows);
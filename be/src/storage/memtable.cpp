@@ -23,6 +23,9 @@ namespace starrocks::vectorized {
 // TODO(cbl): move to common space latter
 static const string LOAD_OP_COLUMN = "__op";
 static const size_t kPrimaryKeyLimitSize = 128;
+// the rows of a chunk are referenced only if they are at least 1/kMinChunkRefFraction of it, so that the memory kept
+// alive by the references is bounded.
+static const size_t kMinChunkRefFraction = 4;
 
 void MemTable::_init_aggregator_if_needed() {
     if (_keys_type != KeysType::DUP_KEYS) {
@@ -104,6 +107,10 @@ bool MemTable::insert(const Chunk& chunk, const uint32_t* indexes, uint32_t from
     if (_chunk == nullptr) {
         _chunk = ChunkHelper::new_chunk(_vectorized_schema, 0);
     }
+    // keep the rows in the order they are inserted.
+    if (!_chunk_refs.empty()) {
+        _materialize_chunk_refs();
+    }
 
     if (_use_slot_desc) {
         // For schema change, FE will construct a shadow column.
@@ -127,7 +134,38 @@ bool MemTable::insert(const Chunk& chunk, const uint32_t* indexes, uint32_t from
         _chunk_memory_usage += chunk.memory_usage() * size / chunk.num_rows();
         _chunk_bytes_usage += chunk.bytes_usage() * size / chunk.num_rows();
     }
+    return _merge_if_full();
+}
+
+bool MemTable::insert(const ChunkPtr& chunk, const uint32_t* indexes, uint32_t from, uint32_t size) {
+    if (size == 0 || size * kMinChunkRefFraction < chunk->num_rows()) {
+        return insert(*chunk, indexes, from, size);
+    }
+    if (_chunk == nullptr) {
+        _chunk = ChunkHelper::new_chunk(_vectorized_schema, 0);
+    }
+    ChunkRef ref;
+    ref.columns.reserve(_chunk->num_columns());
+    for (size_t i = 0; i < _chunk->num_columns(); i++) {
+        const ColumnPtr& src = _use_slot_desc ? chunk->get_column_by_slot_id((*_slot_descs)[i]->id())
+                                              : chunk->get_column_by_index(i);
+        // the sorted rows are appended from the referenced columns, which requires the same layout.
+        if (src->is_constant() || src->is_nullable() != _chunk->get_column_by_index(i)->is_nullable()) {
+            return insert(*chunk, indexes, from, size);
+        }
+        ref.columns.push_back(src);
+    }
+    ref.chunk = chunk;
+    ref.indexes.assign(indexes + from, indexes + from + size);
+    _chunk_refs.emplace_back(std::move(ref));
+    _chunk_refs_rows += size;
+
+    _chunk_memory_usage += chunk->memory_usage() * size / chunk->num_rows();
+    _chunk_bytes_usage += chunk->bytes_usage() * size / chunk->num_rows();
+    return _merge_if_full();
+}
 
+bool MemTable::_merge_if_full() {
     // if memtable is full, push it to the flush executor,
     // and create a new memtable for incoming data
     bool suggest_flush = false;
@@ -160,7 +198,7 @@ Status MemTable::finalize() {
         SCOPED_RAW_TIMER(&duration_ns);
 
         if (_keys_type != KeysType::DUP_KEYS) {
-            if (_chunk->num_rows() > 0) {
+            if (_chunk->num_rows() > 0 || _chunk_refs_rows > 0) {
                 // merge last undo merge
                 _merge();
             }
@@ -169,6 +207,8 @@ Status MemTable::finalize() {
                 _chunk = _aggregator->aggregate_result();
                 _aggregator->aggregate_reset();
 
+                // the aggregate result consists of the sorted runs of the merges, so that a k-way merge of them
+                // replaces the sort of all the rows.
                 int64_t t1 = MonotonicMicros();
                 _sort(true);
                 int64_t t2 = MonotonicMicros();
@@ -233,6 +273,7 @@ Status MemTable::flush() {
     }
     StarRocksMetrics::instance()->memtable_flush_total.increment(1);
     StarRocksMetrics::instance()->memtable_flush_duration_us.increment(duration_ns / 1000);
+    StarRocksMetrics::instance()->memtable_flush_latency_us.observe(duration_ns / 1000);
     VLOG(1) << "memtable flush: " << duration_ns / 1000 << "us";
     return Status::OK();
 }
@@ -249,6 +290,10 @@ void MemTable::_merge() {
     int64_t t3 = MonotonicMicros();
     VLOG(1) << Substitute("memtable sort:$0 agg:$1 total:$2", t2 - t1, t3 - t2, t3 - t1);
     ++_merge_count;
+    uint32_t run_end = _aggregator->aggregate_rows();
+    if (_sorted_run_ends.empty() || _sorted_run_ends.back() < run_end) {
+        _sorted_run_ends.push_back(run_end);
+    }
 }
 
 void MemTable::_aggregate(bool is_final) {
@@ -278,10 +323,45 @@ void MemTable::_aggregate(bool is_final) {
     }
 }
 
+// Whether the rows of |key_columns| are in the ascending order of the keys, with null first.
+static bool is_sorted_by_keys(const Columns& key_columns, size_t num_rows) {
+    for (size_t row = 1; row < num_rows; row++) {
+        for (const auto& column : key_columns) {
+            int cmp = column->compare_at(row - 1, row, *column, -1);
+            if (cmp > 0) {
+                return false;
+            }
+            if (cmp < 0) {
+                break;
+            }
+        }
+    }
+    return true;
+}
+
 void MemTable::_sort(bool is_final) {
-    SmallPermutation perm = create_small_permutation(_chunk->num_rows());
-    std::swap(perm, _permutations);
-    _sort_column_inc();
+    if (!_chunk_refs.empty()) {
+        if (_chunk->num_rows() == 0) {
+            _sort_chunk_refs(is_final);
+            return;
+        }
+        _materialize_chunk_refs();
+    }
+    if (is_final && !_sorted_run_ends.empty()) {
+        _merge_sorted_runs();
+        _sorted_run_ends.clear();
+    } else {
+        SmallPermutation perm = create_small_permutation(_chunk->num_rows());
+        std::swap(perm, _permutations);
+        Columns key_columns;
+        for (int i = 0; i < _vectorized_schema.num_key_fields(); i++) {
+            key_columns.push_back(_chunk->get_column_by_index(i));
+        }
+        // the rows of a pre-sorted load keep the identity permutation.
+        if (!is_sorted_by_keys(key_columns, _chunk->num_rows())) {
+            _sort_column_inc(key_columns);
+        }
+    }
 
     if (is_final) {
         // No need to reserve, it will be reserve in IColumn::append_selective(),
@@ -298,6 +378,64 @@ void MemTable::_sort(bool is_final) {
     _chunk_bytes_usage = 0;
 }
 
+void MemTable::_materialize_chunk_refs() {
+    for (const ChunkRef& ref : _chunk_refs) {
+        for (size_t i = 0; i < ref.columns.size(); i++) {
+            _chunk->get_column_by_index(i)->append_selective(*ref.columns[i], ref.indexes.data(), 0,
+                                                             ref.indexes.size());
+        }
+    }
+    _chunk_refs.clear();
+    _chunk_refs_rows = 0;
+}
+
+void MemTable::_sort_chunk_refs(bool is_final) {
+    // only the key columns are copied for sorting, and the other columns are copied once in the sorted order.
+    const size_t num_keys = _vectorized_schema.num_key_fields();
+    Columns key_columns;
+    for (size_t i = 0; i < num_keys; i++) {
+        key_columns.push_back(_chunk->get_column_by_index(i)->clone_empty());
+    }
+    Permutation rows;
+    rows.reserve(_chunk_refs_rows);
+    for (uint32_t r = 0; r < _chunk_refs.size(); r++) {
+        const ChunkRef& ref = _chunk_refs[r];
+        for (size_t i = 0; i < num_keys; i++) {
+            key_columns[i]->append_selective(*ref.columns[i], ref.indexes.data(), 0, ref.indexes.size());
+        }
+        for (uint32_t index : ref.indexes) {
+            rows.emplace_back(r, index);
+        }
+    }
+    _permutations = create_small_permutation(rows.size());
+    if (!is_sorted_by_keys(key_columns, rows.size())) {
+        _sort_column_inc(key_columns);
+    }
+
+    Permutation perm(rows.size());
+    for (size_t i = 0; i < perm.size(); i++) {
+        perm[i] = rows[_permutations[i].index_in_chunk];
+    }
+    _result_chunk = _chunk->clone_empty_with_schema(is_final ? 0 : perm.size());
+    Columns columns(_chunk_refs.size());
+    for (size_t i = 0; i < _result_chunk->num_columns(); i++) {
+        for (size_t r = 0; r < _chunk_refs.size(); r++) {
+            columns[r] = _chunk_refs[r].columns[i];
+        }
+        append_by_permutation(_result_chunk->get_column_by_index(i).get(), columns, perm);
+    }
+
+    _chunk_refs.clear();
+    _chunk_refs_rows = 0;
+    if (is_final) {
+        _chunk.reset();
+    } else {
+        _chunk->reset();
+    }
+    _chunk_memory_usage = 0;
+    _chunk_bytes_usage = 0;
+}
+
 void MemTable::_append_to_sorted_chunk(Chunk* src, Chunk* dest, bool is_final) {
     DCHECK_EQ(src->num_rows(), _permutations.size());
     permutate_to_selective(_permutations, &_selective_values);
@@ -351,18 +489,53 @@ Status MemTable::_split_upserts_deletes(ChunkPtr& src, ChunkPtr* upserts, std::u
     return Status::OK();
 }
 
-void MemTable::_sort_column_inc() {
+void MemTable::_merge_sorted_runs() {
+    DCHECK_EQ(_sorted_run_ends.back(), _chunk->num_rows());
     Columns columns;
-    std::vector<int> sort_orders;
-    std::vector<int> null_firsts;
     for (int i = 0; i < _vectorized_schema.num_key_fields(); i++) {
         columns.push_back(_chunk->get_column_by_index(i));
-        // Ascending, null first
-        sort_orders.push_back(1);
-        null_firsts.push_back(-1);
     }
+    // ascending, null first, and the rows of the same key in the order they are inserted, i.e. the earlier runs
+    // first, for the REPLACE aggregation.
+    auto greater = [&](const std::pair<uint32_t, uint32_t>& lhs, const std::pair<uint32_t, uint32_t>& rhs) {
+        for (const auto& column : columns) {
+            int r = column->compare_at(lhs.first, rhs.first, *column, -1);
+            if (r != 0) {
+                return r > 0;
+            }
+        }
+        return lhs.first > rhs.first;
+    };
+    // the next row and the end row of each run.
+    std::vector<std::pair<uint32_t, uint32_t>> heap;
+    heap.reserve(_sorted_run_ends.size());
+    uint32_t begin = 0;
+    for (uint32_t end : _sorted_run_ends) {
+        heap.emplace_back(begin, end);
+        begin = end;
+    }
+    std::make_heap(heap.begin(), heap.end(), greater);
+
+    _permutations.resize(_chunk->num_rows());
+    size_t num_rows = 0;
+    while (!heap.empty()) {
+        std::pop_heap(heap.begin(), heap.end(), greater);
+        auto& run = heap.back();
+        _permutations[num_rows++].index_in_chunk = run.first++;
+        if (run.first < run.second) {
+            std::push_heap(heap.begin(), heap.end(), greater);
+        } else {
+            heap.pop_back();
+        }
+    }
+    DCHECK_EQ(num_rows, _permutations.size());
+}
 
-    Status st = stable_sort_and_tie_columns(false, columns, sort_orders, null_firsts, &_permutations);
+void MemTable::_sort_column_inc(const Columns& key_columns) {
+    // Ascending, null first
+    std::vector<int> sort_orders(key_columns.size(), 1);
+    std::vector<int> null_firsts(key_columns.size(), -1);
+    Status st = stable_sort_and_tie_columns(false, key_columns, sort_orders, null_firsts, &_permutations);
     CHECK(st.ok());
 }
 
@@ -41,6 +41,10 @@ public:
     // return true suggests caller should flush this memory table
     bool insert(const Chunk& chunk, const uint32_t* indexes, uint32_t from, uint32_t size);
 
+    // Same as above, but the rows may be kept by referencing |chunk| until they are sorted, and then copied once
+    // in the sorted order from it.
+    bool insert(const ChunkPtr& chunk, const uint32_t* indexes, uint32_t from, uint32_t size);
+
     Status flush();
 
     Status finalize();
@@ -48,10 +52,27 @@ public:
     bool is_full() const;
 
 private:
+    // The rows of |chunk| selected by |indexes|, referenced by the MemTable.
+    struct ChunkRef {
+        ChunkPtr chunk;
+        // the columns of |chunk| in the order of the schema.
+        Columns columns;
+        std::vector<uint32_t> indexes;
+    };
+
+    bool _merge_if_full();
+
+    // Copy the referenced rows to |_chunk|.
+    void _materialize_chunk_refs();
+    // Sort the referenced rows into |_result_chunk|.
+    void _sort_chunk_refs(bool is_final);
+
     void _merge();
 
     void _sort(bool is_final);
-    void _sort_column_inc();
+    void _sort_column_inc(const Columns& key_columns);
+    // Set |_permutations| to the order of |_chunk| by merging the sorted runs in `_sorted_run_ends`.
+    void _merge_sorted_runs();
     void _append_to_sorted_chunk(Chunk* src, Chunk* dest, bool is_final);
 
     bool _is_aggregate_needed();
@@ -61,6 +82,9 @@ private:
     Status _split_upserts_deletes(ChunkPtr& src, ChunkPtr* upserts, std::unique_ptr<Column>* deletes);
 
     ChunkPtr _chunk;
+    // the rows inserted after the ones of |_chunk|.
+    std::vector<ChunkRef> _chunk_refs;
+    size_t _chunk_refs_rows = 0;
     ChunkPtr _result_chunk;
     vector<uint8_t> _result_deletes;
 
@@ -81,6 +105,8 @@ private:
     std::unique_ptr<ChunkAggregator> _aggregator;
 
     uint64_t _merge_count = 0;
+    // the end rows of the sorted runs of the aggregate result, each of which is appended by a `_merge`.
+    std::vector<uint32_t> _sorted_run_ends;
 
     bool _has_op_slot = false;
     std::unique_ptr<Column> _deletes;
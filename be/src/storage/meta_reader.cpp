@@ -5,9 +5,12 @@
 #include <vector>
 
 #include "column/array_column.h"
+#include "column/binary_column.h"
 #include "column/chunk.h"
+#include "column/column_hash.h"
 #include "column/column_helper.h"
 #include "column/datum_convert.h"
+#include "common/config.h"
 #include "common/status.h"
 #include "runtime/global_dict/config.h"
 #include "storage/chunk_helper.h"
@@ -15,10 +18,12 @@
 #include "storage/rowset/column_iterator.h"
 #include "storage/rowset/column_reader.h"
 #include "storage/tablet.h"
+#include "storage/vectorized_column_predicate.h"
+#include "util/phmap/phmap.h"
 
 namespace starrocks::vectorized {
 
-std::vector<std::string> SegmentMetaCollecter::support_collect_fields = {"dict_merge", "max", "min"};
+std::vector<std::string> SegmentMetaCollecter::support_collect_fields = {"dict_merge", "max", "min", "count"};
 
 Status SegmentMetaCollecter::parse_field_and_colname(const std::string& item, std::string* field,
                                                      std::string* col_name) {
@@ -71,6 +76,15 @@ Status MetaReader::_init_params(const MetaReaderParams& read_params) {
 
 Status MetaReader::_build_collect_context(const MetaReaderParams& read_params) {
     _collect_context.seg_collecter_params.max_cid = 0;
+    for (const ColumnPredicate* pred : read_params.predicates) {
+        if (pred->column_id() != read_params.predicates[0]->column_id()) {
+            return Status::NotSupported("meta scan with the predicates of multiple columns");
+        }
+    }
+    _collect_context.seg_collecter_params.predicates = read_params.predicates;
+    if (!read_params.predicates.empty()) {
+        _collect_context.seg_collecter_params.predicate_cid = read_params.predicates[0]->column_id();
+    }
     for (auto it : *(read_params.id_to_names)) {
         std::string col_name = "";
         std::string collect_field = "";
@@ -113,6 +127,16 @@ Status MetaReader::_init_seg_meta_collecters(const MetaReaderParams& params) {
     std::vector<SegmentSharedPtr> segments;
     RETURN_IF_ERROR(_get_segments(params.tablet, params.version, &segments));
 
+    // the deleted rows are still counted in the segments.
+    const auto& fields = _collect_context.seg_collecter_params.fields;
+    if (std::find(fields.begin(), fields.end(), "count") != fields.end()) {
+        for (const auto& rowset : _rowsets) {
+            if (rowset->rowset_meta()->has_delete_predicate()) {
+                return Status::NotSupported("meta scan of count with delete predicates");
+            }
+        }
+    }
+
     for (auto& segment : segments) {
         auto seg_collecter = std::make_unique<SegmentMetaCollecter>(segment);
 
@@ -246,10 +270,20 @@ Status SegmentMetaCollecter::_init_return_column_iterators() {
     DCHECK_EQ(_params->fields.size(), _params->cids.size());
     DCHECK_EQ(_params->fields.size(), _params->read_page.size());
 
-    ASSIGN_OR_RETURN(auto fs, FileSystem::CreateSharedFromString(_segment->file_name()));
-    ASSIGN_OR_RETURN(_read_file, fs->new_random_access_file(_segment->file_name()));
+    ASSIGN_OR_RETURN(_read_file, _segment->new_read_file());
 
-    _column_iterators.resize(_params->max_cid + 1, nullptr);
+    _column_iterators.resize(std::max<size_t>(_params->max_cid, _params->predicate_cid) + 1, nullptr);
+    if (!_params->predicates.empty()) {
+        auto cid = _params->predicate_cid;
+        RETURN_IF_ERROR(_segment->new_column_iterator(cid, &_column_iterators[cid]));
+        _obj_pool.add(_column_iterators[cid]);
+
+        ColumnIteratorOptions iter_opts;
+        iter_opts.check_dict_encoding = true;
+        iter_opts.read_file = _read_file.get();
+        iter_opts.stats = &_stats;
+        RETURN_IF_ERROR(_column_iterators[cid]->init(iter_opts));
+    }
     for (int i = 0; i < _params->fields.size(); i++) {
         if (_params->read_page[i]) {
             auto cid = _params->cids[i];
@@ -285,6 +319,8 @@ Status SegmentMetaCollecter::_collect(const std::string& name, ColumnId cid, vec
         return _collect_max(cid, column, type);
     } else if (name == "min") {
         return _collect_min(cid, column, type);
+    } else if (name == "count") {
+        return _collect_count(cid, column, type);
     }
     return Status::NotSupported("Not Support Collect Meta: " + name);
 }
@@ -296,8 +332,12 @@ Status SegmentMetaCollecter::_collect_dict(ColumnId cid, vectorized::Column* col
     }
 
     std::vector<Slice> words;
+    // the words of the plain encoded pages, e.g. the pages of the segments written after the dictionary of a
+    // previous segment got full, are collected by reading the column.
+    std::vector<std::string> plain_words;
     if (!_column_iterators[cid]->all_page_dict_encoded()) {
-        return Status::GlobalDictError("no global dict");
+        RETURN_IF_ERROR(_read_distinct_words(cid, &plain_words));
+        words.assign(plain_words.begin(), plain_words.end());
     } else {
         RETURN_IF_ERROR(_column_iterators[cid]->fetch_all_dict_words(&words));
     }
@@ -322,14 +362,137 @@ Status SegmentMetaCollecter::_collect_dict(ColumnId cid, vectorized::Column* col
     return Status::OK();
 }
 
+Status SegmentMetaCollecter::_read_distinct_words(ColumnId cid, std::vector<std::string>* words) {
+    const ColumnReader* col_reader = _segment->column(cid);
+    ColumnIterator* iter = _column_iterators[cid];
+    ColumnPtr column = ChunkHelper::column_from_field_type(col_reader->column_type(), col_reader->is_nullable());
+    // |words| is never reallocated, so the slices of |word_set| keep referring to its strings.
+    words->clear();
+    words->reserve(DICT_DECODE_MAX_SIZE);
+    phmap::flat_hash_set<Slice, SliceHash> word_set;
+
+    RETURN_IF_ERROR(iter->seek_to_first());
+    size_t remaining = _segment->num_rows();
+    while (remaining > 0) {
+        size_t n = std::min<size_t>(remaining, config::vector_chunk_size);
+        column->reset_column();
+        RETURN_IF_ERROR(iter->next_batch(&n, column.get()));
+        if (n == 0) {
+            break;
+        }
+        remaining -= n;
+
+        const auto* values = down_cast<const BinaryColumn*>(ColumnHelper::get_data_column(column.get()));
+        for (size_t i = 0; i < n; ++i) {
+            if (column->is_null(i)) {
+                continue;
+            }
+            Slice word = values->get_slice(i);
+            if (word_set.contains(word)) {
+                continue;
+            }
+            if (words->size() >= DICT_DECODE_MAX_SIZE) {
+                return Status::GlobalDictError("global dict greater than DICT_DECODE_MAX_SIZE");
+            }
+            words->emplace_back(word.data, word.size);
+            word_set.insert(Slice(words->back()));
+        }
+    }
+    return Status::OK();
+}
+
 Status SegmentMetaCollecter::_collect_max(ColumnId cid, vectorized::Column* column, FieldType type) {
+    if (!_params->predicates.empty()) {
+        return __collect_max_or_min_by_predicates<true>(cid, column, type);
+    }
     return __collect_max_or_min<true>(cid, column, type);
 }
 
 Status SegmentMetaCollecter::_collect_min(ColumnId cid, vectorized::Column* column, FieldType type) {
+    if (!_params->predicates.empty()) {
+        return __collect_max_or_min_by_predicates<false>(cid, column, type);
+    }
     return __collect_max_or_min<false>(cid, column, type);
 }
 
+// collect the number of the rows, of any column
+Status SegmentMetaCollecter::_collect_count(ColumnId cid, vectorized::Column* column, FieldType type) {
+    if (_params->predicates.empty()) {
+        column->append_datum(vectorized::Datum(static_cast<int64_t>(_segment->num_rows())));
+        return Status::OK();
+    }
+    RETURN_IF_ERROR(_aggregate_by_zone_map());
+    const auto count = static_cast<int64_t>(_full_ranges.span_size() + _partial_values->size());
+    column->append_datum(vectorized::Datum(count));
+    return Status::OK();
+}
+
+Status SegmentMetaCollecter::_aggregate_by_zone_map() {
+    if (_aggregated) {
+        return Status::OK();
+    }
+    const ColumnId cid = _params->predicate_cid;
+    if (cid >= _segment->num_columns() || _column_iterators[cid] == nullptr) {
+        return Status::NotFound("");
+    }
+    const ColumnReader* col_reader = _segment->column(cid);
+    ColumnIterator* iter = _column_iterators[cid];
+    SparseRange partial_ranges;
+    RETURN_IF_ERROR(
+            iter->classify_pages_by_zone_map(_params->predicates, &_full_ranges, &partial_ranges, &_full_zone_map));
+
+    ColumnPtr column = ChunkHelper::column_from_field_type(col_reader->column_type(), col_reader->is_nullable());
+    _partial_values = column->clone_empty();
+    Filter selection(config::vector_chunk_size);
+    SparseRangeIterator range_iter = partial_ranges.new_iterator();
+    while (range_iter.has_more()) {
+        SparseRange range;
+        range_iter.next_range(config::vector_chunk_size, &range);
+        column->reset_column();
+        RETURN_IF_ERROR(iter->seek_to_ordinal(range.begin()));
+        RETURN_IF_ERROR(iter->next_batch(range, column.get()));
+        const size_t num_rows = column->size();
+        RETURN_IF_ERROR(_params->predicates[0]->evaluate(column.get(), selection.data(), 0, num_rows));
+        for (size_t i = 1; i < _params->predicates.size(); i++) {
+            RETURN_IF_ERROR(_params->predicates[i]->evaluate_and(column.get(), selection.data(), 0, num_rows));
+        }
+        column->filter_range(selection, 0, num_rows);
+        _partial_values->append(*column);
+    }
+    _aggregated = true;
+    return Status::OK();
+}
+
+template <bool is_max>
+Status SegmentMetaCollecter::__collect_max_or_min_by_predicates(ColumnId cid, vectorized::Column* column,
+                                                                FieldType type) {
+    if (cid != _params->predicate_cid) {
+        return Status::NotSupported("meta scan of max or min with the predicates of another column");
+    }
+    RETURN_IF_ERROR(_aggregate_by_zone_map());
+    if (_segment->column(cid)->column_type() != type) {
+        return Status::InternalError("column type mismatch");
+    }
+    TypeInfoPtr type_info = get_type_info(delegate_type(type));
+    auto better = [&](const vectorized::Datum& lhs, const vectorized::Datum& rhs) {
+        return is_max ? type_info->cmp(lhs, rhs) > 0 : type_info->cmp(lhs, rhs) < 0;
+    };
+    vectorized::Datum result;
+    if (!_full_ranges.empty()) {
+        result = is_max ? _full_zone_map.max_value() : _full_zone_map.min_value();
+    }
+    for (size_t i = 0; i < _partial_values->size(); i++) {
+        vectorized::Datum value = _partial_values->get(i);
+        if (!value.is_null() && (result.is_null() || better(value, result))) {
+            result = value;
+        }
+    }
+    if (!result.is_null()) {
+        column->append_datum(result);
+    }
+    return Status::OK();
+}
+
 template <bool is_max>
 Status SegmentMetaCollecter::__collect_max_or_min(ColumnId cid, vectorized::Column* column, FieldType type) {
     if (cid >= _segment->num_columns()) {
@@ -7,9 +7,11 @@
 #include "column/vectorized_fwd.h"
 #include "runtime/descriptors.h"
 #include "storage/olap_common.h"
+#include "storage/range.h"
 #include "storage/rowset/column_iterator.h"
 #include "storage/rowset/segment.h"
 #include "storage/tablet.h"
+#include "storage/zone_map_detail.h"
 
 namespace starrocks {
 
@@ -19,6 +21,7 @@ class RuntimeState;
 
 namespace starrocks::vectorized {
 
+class ColumnPredicate;
 class Tablet;
 class SegmentMetaCollecter;
 
@@ -39,6 +42,9 @@ struct MetaReaderParams {
     const std::map<int32_t, std::string>* id_to_names = nullptr;
     const DescriptorTbl* desc_tbl = nullptr;
 
+    // the predicates of a single column, by which "count" and the "max" and "min" of the same column are collected.
+    std::vector<const ColumnPredicate*> predicates;
+
     int chunk_size = config::vector_chunk_size;
 };
 
@@ -48,11 +54,15 @@ struct SegmentMetaCollecterParams {
     std::vector<bool> read_page;
     std::vector<FieldType> field_type;
     int32_t max_cid;
+    std::vector<const ColumnPredicate*> predicates;
+    ColumnId predicate_cid = 0;
 };
 
 // MetaReader will implements
 // 1. read meta info from segment footer
 // 2. read dict info from dict page if column is dict encoding type
+// 3. aggregate the rows satisfying the predicates by the page zone maps, only the pages partially satisfying the
+//    predicates are read
 class MetaReader {
 public:
     MetaReader();
@@ -121,16 +131,32 @@ private:
     Status _init_return_column_iterators();
     Status _collect(const std::string& name, ColumnId cid, vectorized::Column* column, FieldType type);
     Status _collect_dict(ColumnId cid, vectorized::Column* column, FieldType type);
+    // Read the distinct non-null words of the column into |words|, return GlobalDictError if there are more
+    // than DICT_DECODE_MAX_SIZE.
+    Status _read_distinct_words(ColumnId cid, std::vector<std::string>* words);
     Status _collect_max(ColumnId cid, vectorized::Column* column, FieldType type);
     Status _collect_min(ColumnId cid, vectorized::Column* column, FieldType type);
+    Status _collect_count(ColumnId cid, vectorized::Column* column, FieldType type);
     template <bool is_max>
     Status __collect_max_or_min(ColumnId cid, vectorized::Column* column, FieldType type);
+    template <bool is_max>
+    Status __collect_max_or_min_by_predicates(ColumnId cid, vectorized::Column* column, FieldType type);
+    // Classify the pages of the predicate column by the zone maps, and read the rows of the partially satisfied
+    // pages into |_partial_values|.
+    Status _aggregate_by_zone_map();
     SegmentSharedPtr _segment;
     std::vector<ColumnIterator*> _column_iterators;
     const SegmentMetaCollecterParams* _params = nullptr;
     std::unique_ptr<RandomAccessFile> _read_file;
     OlapReaderStatistics _stats;
     ObjectPool _obj_pool;
+
+    // the results of `_aggregate_by_zone_map`.
+    bool _aggregated = false;
+    SparseRange _full_ranges;
+    ZoneMapDetail _full_zone_map;
+    // the values of the predicate column satisfying the predicates in the partially satisfied pages.
+    ColumnPtr _partial_values;
 };
 
 } // namespace starrocks::vectorized
@@ -403,6 +403,8 @@ using KeyRange = std::pair<WrapperField*, WrapperField*>;
 struct OlapReaderStatistics {
     int64_t create_segment_iter_ns = 0;
     int64_t io_ns = 0;
+    // the number of the reads from the files timed by |io_ns|.
+    int64_t io_count = 0;
     int64_t compressed_bytes_read = 0;
 
     int64_t decompress_ns = 0;
@@ -357,6 +357,11 @@ void* StorageEngine::_update_cache_expire_thread_callback(void* arg) {
 #ifdef GOOGLE_PROFILER
     ProfilerRegisterThread();
 #endif
+    if (config::enable_primary_index_prewarm) {
+        // the indexes are loaded by the applies too, prewarming them cuts the latency of the first loads after restart.
+        _update_manager->prewarm_index_cache(_tablet_manager->get_primary_key_tablets(),
+                                             [this] { return _bg_worker_stopped.load(std::memory_order_consume); });
+    }
     while (!_bg_worker_stopped.load(std::memory_order_consume)) {
         int32_t expire_sec = config::update_cache_expire_sec;
         if (expire_sec <= 0) {
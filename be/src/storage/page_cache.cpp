@@ -23,6 +23,9 @@
 
 #include <malloc.h>
 
+#include <mutex>
+#include <unordered_map>
+
 #include "runtime/current_thread.h"
 #include "runtime/mem_tracker.h"
 #include "util/defer_op.h"
@@ -32,9 +35,47 @@ namespace starrocks {
 
 StoragePageCache* StoragePageCache::_s_instance = nullptr;
 
-void StoragePageCache::create_global_cache(MemTracker* mem_tracker, size_t capacity) {
+namespace {
+
+struct FileIdEntry {
+    uint64_t id;
+    int64_t refs;
+};
+
+std::mutex g_file_ids_lock;
+std::unordered_map<std::string, FileIdEntry> g_file_ids;
+uint64_t g_next_file_id = 1;
+
+} // namespace
+
+uint64_t StoragePageCache::acquire_file_id(const std::string& fname) {
+    std::lock_guard l(g_file_ids_lock);
+    auto [it, inserted] = g_file_ids.try_emplace(fname, FileIdEntry{g_next_file_id, 0});
+    if (inserted) {
+        g_next_file_id++;
+    }
+    it->second.refs++;
+    return it->second.id;
+}
+
+void StoragePageCache::release_file_id(const std::string& fname) {
+    std::lock_guard l(g_file_ids_lock);
+    auto it = g_file_ids.find(fname);
+    DCHECK(it != g_file_ids.end());
+    if (it != g_file_ids.end() && --it->second.refs == 0) {
+        g_file_ids.erase(it);
+    }
+}
+
+uint64_t StoragePageCache::find_file_id(const std::string& fname) {
+    std::lock_guard l(g_file_ids_lock);
+    auto it = g_file_ids.find(fname);
+    return it != g_file_ids.end() ? it->second.id : 0;
+}
+
+void StoragePageCache::create_global_cache(MemTracker* mem_tracker, size_t capacity, CacheEvictionPolicy policy) {
     if (_s_instance == nullptr) {
-        _s_instance = new StoragePageCache(mem_tracker, capacity);
+        _s_instance = new StoragePageCache(mem_tracker, capacity, policy);
     }
 }
 
@@ -45,13 +86,14 @@ void StoragePageCache::release_global_cache() {
     }
 }
 
-StoragePageCache::StoragePageCache(MemTracker* mem_tracker, size_t capacity)
-        : _mem_tracker(mem_tracker), _cache(new_lru_cache(capacity)) {}
+StoragePageCache::StoragePageCache(MemTracker* mem_tracker, size_t capacity, CacheEvictionPolicy policy)
+        : _mem_tracker(mem_tracker), _cache(new_lru_cache(capacity, policy)) {}
 
 StoragePageCache::~StoragePageCache() {}
 
 bool StoragePageCache::lookup(const CacheKey& key, PageCacheHandle* handle) {
-    auto* lru_handle = _cache->lookup(key.encode());
+    char buf[CacheKey::kEncodedSize];
+    auto* lru_handle = _cache->lookup(key.encode(buf));
     if (lru_handle == nullptr) {
         return false;
     }
@@ -75,7 +117,8 @@ void StoragePageCache::insert(const CacheKey& key, const Slice& data, PageCacheH
         priority = CachePriority::DURABLE;
     }
 
-    auto* lru_handle = _cache->insert(key.encode(), data.data, data.size, deleter, priority);
+    char buf[CacheKey::kEncodedSize];
+    auto* lru_handle = _cache->insert(key.encode(buf), data.data, data.size, deleter, priority);
     *handle = PageCacheHandle(_cache.get(), lru_handle);
 }
 
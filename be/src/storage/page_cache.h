@@ -21,6 +21,7 @@
 
 #pragma once
 
+#include <cstring>
 #include <memory>
 #include <string>
 #include <utility>
@@ -44,25 +45,35 @@ public:
     virtual ~StoragePageCache();
     // The unique key identifying entries in the page cache.
     // Each cached page corresponds to a specific offset within
-    // a file.
-    //
-    // TODO(zc): Now we use file name(std::string) as a part of
-    // key, which is not efficient. We should make it better later
+    // a file, which is identified by the id assigned by `acquire_file_id`,
+    // so that the key is compact and encoded without allocation.
     struct CacheKey {
-        CacheKey(std::string fname_, int64_t offset_) : fname(std::move(fname_)), offset(offset_) {}
-        std::string fname;
+        CacheKey(uint64_t file_id_, int64_t offset_) : file_id(file_id_), offset(offset_) {}
+        uint64_t file_id;
         int64_t offset;
 
-        // Encode to a flat binary which can be used as LRUCache's key
-        std::string encode() const {
-            std::string key_buf(fname);
-            key_buf.append((char*)&offset, sizeof(offset));
-            return key_buf;
+        static constexpr size_t kEncodedSize = sizeof(uint64_t) + sizeof(int64_t);
+
+        // Encode to a flat binary in |buf| which can be used as LRUCache's key
+        starrocks::CacheKey encode(char (&buf)[kEncodedSize]) const {
+            memcpy(buf, &file_id, sizeof(file_id));
+            memcpy(buf + sizeof(file_id), &offset, sizeof(offset));
+            return {buf, kEncodedSize};
         }
     };
 
+    // Return the id of the file |fname| in the cache keys, which is kept until all the acquired ids of the file are
+    // released. The ids are never reused, so the pages of a released id are never found again.
+    static uint64_t acquire_file_id(const std::string& fname);
+
+    static void release_file_id(const std::string& fname);
+
+    // Return the id of |fname| if it's acquired, otherwise 0, which means the pages of the file are not cached.
+    static uint64_t find_file_id(const std::string& fname);
+
     // Create global instance of this class
-    static void create_global_cache(MemTracker* mem_tracker, size_t capacity);
+    static void create_global_cache(MemTracker* mem_tracker, size_t capacity,
+                                    CacheEvictionPolicy policy = CacheEvictionPolicy::LRU);
 
     static void release_global_cache();
 
@@ -70,7 +81,7 @@ public:
     // Client should call create_global_cache before.
     static StoragePageCache* instance() { return _s_instance; }
 
-    StoragePageCache(MemTracker* mem_tracker, size_t capacity);
+    StoragePageCache(MemTracker* mem_tracker, size_t capacity, CacheEvictionPolicy policy = CacheEvictionPolicy::LRU);
 
     // Lookup the given page in the cache.
     //
@@ -5,15 +5,18 @@
 #include <cstring>
 #include <numeric>
 
+#include "common/config.h"
 #include "fs/fs.h"
 #include "gutil/strings/substitute.h"
 #include "storage/chunk_helper.h"
 #include "storage/chunk_iterator.h"
 #include "storage/primary_key_encoder.h"
 #include "storage/rowset/beta_rowset.h"
+#include "storage/storage_engine.h"
 #include "storage/tablet.h"
 #include "storage/tablet_meta_manager.h"
 #include "storage/tablet_updates.h"
+#include "storage/update_manager.h"
 #include "util/bit_util.h"
 #include "util/coding.h"
 #include "util/crc32c.h"
@@ -42,6 +45,8 @@ constexpr size_t l0_snapshot_size_max = 4 * 1024 * 1024;
 constexpr size_t l0_flush_size_min = 8 * 1024 * 1024;
 // perform l0 l1 merge compaction if l1_file_size / l0_memory >= this value and l0_memory > l0_snapshot_size_max
 constexpr size_t l0_l1_merge_ratio = 10;
+// false positive probability of the bloom filters of immutable index shards
+constexpr double bloom_filter_fpp = 0.05;
 
 const char* const index_file_magic = "IDX1";
 
@@ -437,8 +442,10 @@ public:
         }
     }
 
-    Status init(const string& dir, const EditVersion& version) {
+    // |with_bloom_filter|: write a bloom filter after the pages of each shard
+    Status init(const string& dir, const EditVersion& version, bool with_bloom_filter = false) {
         _version = version;
+        _with_bloom_filter = with_bloom_filter;
         _idx_file_path = strings::Substitute("$0/index.l1.$1.$2", dir, version.major(), version.minor());
         _idx_file_path_tmp = _idx_file_path + ".tmp";
         ASSIGN_OR_RETURN(_fs, FileSystem::CreateSharedFromString(_idx_file_path_tmp));
@@ -470,6 +477,19 @@ public:
         auto ptr_meta = shard_meta->mutable_data();
         ptr_meta->set_offset(pos_before);
         ptr_meta->set_size(pos_after - pos_before);
+        if (_with_bloom_filter && !kvs.empty()) {
+            std::unique_ptr<BloomFilter> bf;
+            RETURN_IF_ERROR(BloomFilter::create(BLOCK_BLOOM_FILTER, &bf));
+            RETURN_IF_ERROR(bf->init(kvs.size(), bloom_filter_fpp, HASH_MURMUR3_X64_64));
+            for (const auto& kv : kvs) {
+                bf->add_hash(kv.hash);
+            }
+            RETURN_IF_ERROR(_wb->append(Slice(bf->data(), bf->size())));
+            auto bf_meta = shard_meta->mutable_bloom_filter();
+            bf_meta->set_offset(pos_after);
+            bf_meta->set_size(bf->size());
+            pos_after = _wb->size();
+        }
         _total += kvs.size();
         _total_moved += shard->num_entry_moved;
         _total_kv_size += kvs.size() * kv_size;
@@ -509,6 +529,7 @@ private:
     string _idx_file_path;
     std::shared_ptr<FileSystem> _fs;
     std::unique_ptr<WritableFile> _wb;
+    bool _with_bloom_filter = false;
     size_t _nshard = 0;
     size_t _fixed_key_size = 0;
     size_t _fixed_value_size = 0;
@@ -699,7 +720,7 @@ public:
         size_t kv_size = KeySize + value_size;
         auto [nshard, npage_hint] = estimate_nshard_and_npage(kv_size, size(), default_usage_percent);
         ImmutableIndexWriter writer;
-        RETURN_IF_ERROR(writer.init(dir, version));
+        RETURN_IF_ERROR(writer.init(dir, version, config::enable_persistent_index_bloom_filter));
         if (nshard > 0) {
             auto kv_ref_by_shard = get_kv_refs_by_shard(nshard, size(), true);
             for (auto& kvs : kv_ref_by_shard) {
@@ -807,10 +828,45 @@ Status ImmutableIndex::_get_kvs_for_shard(std::vector<std::vector<KVRef>>& kvs_b
     return Status::OK();
 }
 
-Status ImmutableIndex::_get_in_shard(size_t shard_idx, size_t n, const void* keys, const KeysInfo& keys_info,
-                                     IndexValue* values, size_t* num_found) const {
+static void append_keys_info(const KeysInfo& keys_info, KeysInfo* dest) {
+    if (dest != nullptr) {
+        dest->key_idxes.insert(dest->key_idxes.end(), keys_info.key_idxes.begin(), keys_info.key_idxes.end());
+        dest->hashes.insert(dest->hashes.end(), keys_info.hashes.begin(), keys_info.hashes.end());
+    }
+}
+
+const KeysInfo& ImmutableIndex::_filter_by_bloom_filter(size_t shard_idx, const KeysInfo& keys_info,
+                                                        KeysInfo* filtered, IndexValue* values,
+                                                        KeysInfo* not_found) const {
+    if (shard_idx >= _bloom_filters.size() || _bloom_filters[shard_idx] == nullptr) {
+        return keys_info;
+    }
+    const auto& bf = _bloom_filters[shard_idx];
+    for (size_t i = 0; i < keys_info.size(); i++) {
+        auto key_idx = keys_info.key_idxes[i];
+        auto hash = keys_info.hashes[i];
+        KeysInfo* dest = bf->test_hash(hash) ? filtered : not_found;
+        if (dest == not_found && values != nullptr) {
+            values[key_idx] = NullIndexValue;
+        }
+        if (dest != nullptr) {
+            dest->key_idxes.emplace_back(key_idx);
+            dest->hashes.emplace_back(hash);
+        }
+    }
+    return *filtered;
+}
+
+Status ImmutableIndex::_get_in_shard(size_t shard_idx, size_t n, const void* keys, const KeysInfo& all_keys_info,
+                                     IndexValue* values, size_t* num_found, KeysInfo* not_found) const {
     const auto& shard_info = _shards[shard_idx];
-    if (shard_info.size == 0 || shard_info.npage == 0 || keys_info.size() == 0) {
+    if (shard_info.size == 0 || shard_info.npage == 0 || all_keys_info.size() == 0) {
+        append_keys_info(all_keys_info, not_found);
+        return Status::OK();
+    }
+    KeysInfo filtered;
+    const KeysInfo& keys_info = _filter_by_bloom_filter(shard_idx, all_keys_info, &filtered, values, not_found);
+    if (keys_info.size() == 0) {
         return Status::OK();
     }
     size_t found = 0;
@@ -830,24 +886,37 @@ Status ImmutableIndex::_get_in_shard(size_t shard_idx, size_t n, const void* key
         const uint8_t* fixed_key_probe = (const uint8_t*)keys + _fixed_key_size * key_idx;
         auto kv_pos = bucket_pos + pad(nele, pack_size);
         values[key_idx] = NullIndexValue;
+        bool matched = false;
         for (size_t candidate_idx = 0; candidate_idx < ncandidates; candidate_idx++) {
             auto idx = candidate_idxes[candidate_idx];
             auto candidate_kv = kv_pos + (_fixed_key_size + _fixed_value_size) * idx;
             if (strings::memeq(candidate_kv, fixed_key_probe, _fixed_key_size)) {
+                matched = true;
                 values[key_idx] = UNALIGNED_LOAD64(candidate_kv + _fixed_key_size);
-                found++;
+                // a deleted key is neither found nor checked in next level
+                found += (values[key_idx] != NullIndexValue);
                 break;
             }
         }
+        if (!matched && not_found != nullptr) {
+            not_found->key_idxes.emplace_back(key_idx);
+            not_found->hashes.emplace_back(keys_info.hashes[i]);
+        }
     }
     *num_found += found;
     return Status::OK();
 }
 
 Status ImmutableIndex::_check_not_exist_in_shard(size_t shard_idx, size_t n, const void* keys,
-                                                 const KeysInfo& keys_info) const {
+                                                 const KeysInfo& all_keys_info, KeysInfo* not_found) const {
     const auto& shard_info = _shards[shard_idx];
-    if (shard_info.size == 0 || keys_info.size() == 0) {
+    if (shard_info.size == 0 || all_keys_info.size() == 0) {
+        append_keys_info(all_keys_info, not_found);
+        return Status::OK();
+    }
+    KeysInfo filtered;
+    const KeysInfo& keys_info = _filter_by_bloom_filter(shard_idx, all_keys_info, &filtered, nullptr, not_found);
+    if (keys_info.size() == 0) {
         return Status::OK();
     }
     std::unique_ptr<ImmutableIndexShard> shard = std::make_unique<ImmutableIndexShard>(shard_info.npage);
@@ -865,13 +934,23 @@ Status ImmutableIndex::_check_not_exist_in_shard(size_t shard_idx, size_t n, con
         auto ncandidates = get_matched_tag_idxes(bucket_pos, nele, h.tag(), candidate_idxes);
         const uint8_t* fixed_key_probe = (const uint8_t*)keys + _fixed_key_size * key_idx;
         auto kv_pos = bucket_pos + pad(nele, pack_size);
+        bool matched = false;
         for (size_t candidate_idx = 0; candidate_idx < ncandidates; candidate_idx++) {
             auto idx = candidate_idxes[candidate_idx];
             auto candidate_kv = kv_pos + (_fixed_key_size + _fixed_value_size) * idx;
             if (strings::memeq(candidate_kv, fixed_key_probe, _fixed_key_size)) {
-                return Status::AlreadyExist("key already exists in immutable index");
+                // a deleted key does not exist, and is not checked in next level
+                if (UNALIGNED_LOAD64(candidate_kv + _fixed_key_size) != NullIndexValue) {
+                    return Status::AlreadyExist("key already exists in immutable index");
+                }
+                matched = true;
+                break;
             }
         }
+        if (!matched && not_found != nullptr) {
+            not_found->key_idxes.emplace_back(key_idx);
+            not_found->hashes.emplace_back(keys_info.hashes[i]);
+        }
     }
     return Status::OK();
 }
@@ -887,17 +966,42 @@ static void split_keys_info_by_shard(const KeysInfo& keys_info, std::vector<Keys
     }
 }
 
+// The update manager to look up the shards of an immutable index in parallel, nullptr if the batch is too small.
+static UpdateManager* parallel_lookup_manager(size_t nshard, size_t nkeys) {
+    if (nshard < 2 || nkeys < config::update_apply_parallel_min_keys || StorageEngine::instance() == nullptr) {
+        return nullptr;
+    }
+    return StorageEngine::instance()->update_manager();
+}
+
 Status ImmutableIndex::get(size_t n, const void* keys, const KeysInfo& keys_info, IndexValue* values,
-                           size_t* num_found) const {
+                           size_t* num_found, KeysInfo* not_found) const {
     size_t found = 0;
     if (_shards.size() > 1) {
         std::vector<KeysInfo> keys_info_by_shard(_shards.size());
         split_keys_info_by_shard(keys_info, keys_info_by_shard);
-        for (size_t i = 0; i < _shards.size(); i++) {
-            RETURN_IF_ERROR(_get_in_shard(i, n, keys, keys_info_by_shard[i], values, &found));
+        auto manager = parallel_lookup_manager(_shards.size(), keys_info.size());
+        if (manager != nullptr) {
+            // each shard is read and probed on its own, and only writes the values of its own keys.
+            std::vector<size_t> found_by_shard(_shards.size(), 0);
+            std::vector<KeysInfo> not_found_by_shard(not_found != nullptr ? _shards.size() : 0);
+            RETURN_IF_ERROR(manager->parallel_apply(_shards.size(), [&](size_t i) {
+                return _get_in_shard(i, n, keys, keys_info_by_shard[i], values, &found_by_shard[i],
+                                     not_found != nullptr ? &not_found_by_shard[i] : nullptr);
+            }));
+            for (size_t i = 0; i < _shards.size(); i++) {
+                found += found_by_shard[i];
+                if (not_found != nullptr) {
+                    append_keys_info(not_found_by_shard[i], not_found);
+                }
+            }
+        } else {
+            for (size_t i = 0; i < _shards.size(); i++) {
+                RETURN_IF_ERROR(_get_in_shard(i, n, keys, keys_info_by_shard[i], values, &found, not_found));
+            }
         }
     } else {
-        RETURN_IF_ERROR(_get_in_shard(0, n, keys, keys_info, values, &found));
+        RETURN_IF_ERROR(_get_in_shard(0, n, keys, keys_info, values, &found, not_found));
     }
     *num_found += found;
     return Status::OK();
@@ -915,7 +1019,33 @@ Status ImmutableIndex::check_not_exist(size_t n, const void* keys) {
         keys_info_by_shard[shard].hashes.emplace_back(h.hash);
     }
     for (size_t i = 0; i < nshard; i++) {
-        RETURN_IF_ERROR(_check_not_exist_in_shard(i, n, keys, keys_info_by_shard[i]));
+        RETURN_IF_ERROR(_check_not_exist_in_shard(i, n, keys, keys_info_by_shard[i], nullptr));
+    }
+    return Status::OK();
+}
+
+Status ImmutableIndex::check_not_exist(size_t n, const void* keys, const KeysInfo& keys_info,
+                                       KeysInfo* not_found) const {
+    if (_shards.size() > 1) {
+        std::vector<KeysInfo> keys_info_by_shard(_shards.size());
+        split_keys_info_by_shard(keys_info, keys_info_by_shard);
+        auto manager = parallel_lookup_manager(_shards.size(), keys_info.size());
+        if (manager != nullptr) {
+            std::vector<KeysInfo> not_found_by_shard(not_found != nullptr ? _shards.size() : 0);
+            RETURN_IF_ERROR(manager->parallel_apply(_shards.size(), [&](size_t i) {
+                return _check_not_exist_in_shard(i, n, keys, keys_info_by_shard[i],
+                                                 not_found != nullptr ? &not_found_by_shard[i] : nullptr);
+            }));
+            for (auto& shard_not_found : not_found_by_shard) {
+                append_keys_info(shard_not_found, not_found);
+            }
+        } else {
+            for (size_t i = 0; i < _shards.size(); i++) {
+                RETURN_IF_ERROR(_check_not_exist_in_shard(i, n, keys, keys_info_by_shard[i], not_found));
+            }
+        }
+    } else {
+        RETURN_IF_ERROR(_check_not_exist_in_shard(0, n, keys, keys_info, not_found));
     }
     return Status::OK();
 }
@@ -969,6 +1099,17 @@ StatusOr<std::unique_ptr<ImmutableIndex>> ImmutableIndex::load(std::unique_ptr<R
         dest.npage = src.npage();
         dest.offset = src.data().offset();
         dest.bytes = src.data().size();
+        if (src.has_bloom_filter()) {
+            const auto& bf_pb = src.bloom_filter();
+            std::string bf_data;
+            raw::stl_string_resize_uninitialized(&bf_data, bf_pb.size());
+            RETURN_IF_ERROR(file->read_at_fully(bf_pb.offset(), bf_data.data(), bf_data.size()));
+            std::unique_ptr<BloomFilter> bf;
+            RETURN_IF_ERROR(BloomFilter::create(BLOCK_BLOOM_FILTER, &bf));
+            RETURN_IF_ERROR(bf->init(bf_data.data(), bf_data.size(), HASH_MURMUR3_X64_64));
+            idx->_bloom_filters.resize(nshard);
+            idx->_bloom_filters[i] = std::move(bf);
+        }
     }
     idx->_file.swap(file);
     return std::move(idx);
@@ -983,6 +1124,9 @@ PersistentIndex::~PersistentIndex() {
     if (_l1) {
         _l1->clear();
     }
+    if (_l2) {
+        _l2->clear();
+    }
 }
 
 std::string PersistentIndex::_get_l0_index_file_name(std::string& dir, const EditVersion& version) {
@@ -1029,7 +1173,7 @@ Status PersistentIndex::load(const PersistentIndexMetaPB& index_meta) {
     MutableIndexMetaPB l0_meta = index_meta.l0_meta();
     IndexSnapshotMetaPB snapshot_meta = l0_meta.snapshot();
     EditVersion l0_version = snapshot_meta.version();
-    RETURN_IF_ERROR(_delete_expired_index_file(l0_version, _l1_version));
+    RETURN_IF_ERROR(_delete_expired_index_file(l0_version));
     return Status::OK();
 }
 
@@ -1098,6 +1242,7 @@ Status PersistentIndex::_load(const PersistentIndexMetaPB& index_meta) {
     wblock_opts.mode = FileSystem::MUST_EXIST;
     ASSIGN_OR_RETURN(_index_file, _fs->new_writable_file(wblock_opts, l0_index_file_name));
 
+    _l1.reset();
     if (index_meta.has_l1_version()) {
         _l1_version = index_meta.l1_version();
         auto l1_block_path = strings::Substitute("$0/index.l1.$1.$2", _path, _l1_version.major(), _l1_version.minor());
@@ -1108,6 +1253,13 @@ Status PersistentIndex::_load(const PersistentIndexMetaPB& index_meta) {
         }
         _l1 = std::move(l1_st).value();
     }
+    _l2.reset();
+    if (index_meta.has_l2_version()) {
+        _l2_version = index_meta.l2_version();
+        auto l2_block_path = strings::Substitute("$0/index.l1.$1.$2", _path, _l2_version.major(), _l2_version.minor());
+        ASSIGN_OR_RETURN(auto l2_rfile, _fs->new_random_access_file(l2_block_path));
+        ASSIGN_OR_RETURN(_l2, ImmutableIndex::load(std::move(l2_rfile)));
+    }
     return Status::OK();
 }
 
@@ -1139,9 +1291,11 @@ Status PersistentIndex::_build_commit(Tablet* tablet, PersistentIndexMetaPB& ind
         ASSIGN_OR_RETURN(_index_file, _fs->new_writable_file(wblock_opts, l0_index_file_path));
     }
 
-    RETURN_IF_ERROR(_delete_expired_index_file(_version, _l1_version));
+    RETURN_IF_ERROR(_delete_expired_index_file(_version));
     _dump_snapshot = false;
     _flushed = false;
+    _l1_demoted = false;
+    _merged_to_l2 = false;
     return status;
 }
 
@@ -1248,6 +1402,7 @@ Status PersistentIndex::load_from_tablet(Tablet* tablet) {
                       << " size: " << _size << " l0_size: " << (_l0 ? _l0->size() : 0)
                       << " l0_capacity:" << (_l0 ? _l0->capacity() : 0)
                       << " #shard: " << (_l1 ? _l1->_shards.size() : 0) << " l1_size:" << (_l1 ? _l1->_size : 0)
+                      << " l2_size:" << (_l2 ? _l2->_size : 0)
                       << " memory: " << memory_usage() << " status: " << status.to_string()
                       << " time:" << timer.elapsed_time() / 1000000 << "ms";
             return status;
@@ -1286,8 +1441,11 @@ Status PersistentIndex::load_from_tablet(Tablet* tablet) {
     //   2. delete WALs because maybe PersistentIndexMetaPB has expired wals
     //   3. reset SnapshotMeta
     //   4. write all data into new tmp _l0 index file (tmp file will be delete in _build_commit())
+    //   5. reset l1 and l2 because the expired ones are rebuilt
     index_meta.set_key_size(_key_size);
     lastest_applied_version.to_pb(index_meta.mutable_version());
+    index_meta.clear_l1_version();
+    index_meta.clear_l2_version();
     MutableIndexMetaPB* l0_meta = index_meta.mutable_l0_meta();
     l0_meta->clear_wals();
     IndexSnapshotMetaPB* snapshot = l0_meta->mutable_snapshot();
@@ -1342,7 +1500,8 @@ Status PersistentIndex::load_from_tablet(Tablet* tablet) {
               << " #rowset:" << rowsets.size() << " #segment:" << total_segments << " data_size:" << total_data_size
               << " size: " << _size << " l0_size: " << _l0->size() << " l0_capacity:" << _l0->capacity()
               << " #shard: " << (_l1 ? _l1->_shards.size() : 0) << " l1_size:" << (_l1 ? _l1->_size : 0)
-              << " memory: " << memory_usage() << " time: " << timer.elapsed_time() / 1000000 << "ms";
+              << " l2_size:" << (_l2 ? _l2->_size : 0) << " memory: " << memory_usage()
+              << " time: " << timer.elapsed_time() / 1000000 << "ms";
     return Status::OK();
 }
 
@@ -1362,7 +1521,7 @@ Status PersistentIndex::abort() {
 //   2. _merge_compaction
 //   3. _dump_snapshot
 //   4. _append_wal
-// both case1 and case2 will create a new l1 file and a new empty l0 file
+// both case1 and case2 will create a new l1 or l2 file and a new empty l0 file
 // case3 will write a new snapshot l0
 // case4 will append wals into l0 file
 Status PersistentIndex::commit(PersistentIndexMetaPB* index_meta) {
@@ -1384,7 +1543,19 @@ Status PersistentIndex::commit(PersistentIndexMetaPB* index_meta) {
         VLOG(1) << "new l0 file path(flush) is " << file_name;
         index_meta->set_size(_size);
         _version.to_pb(index_meta->mutable_version());
-        _version.to_pb(index_meta->mutable_l1_version());
+        if (_merged_to_l2) {
+            index_meta->clear_l1_version();
+            _version.to_pb(index_meta->mutable_l2_version());
+        } else {
+            _version.to_pb(index_meta->mutable_l1_version());
+            if (_l1_demoted) {
+                _l1_version.to_pb(index_meta->mutable_l2_version());
+            } else if (_l2 != nullptr) {
+                _l2_version.to_pb(index_meta->mutable_l2_version());
+            } else {
+                index_meta->clear_l2_version();
+            }
+        }
         MutableIndexMetaPB* l0_meta = index_meta->mutable_l0_meta();
         l0_meta->clear_wals();
         IndexSnapshotMetaPB* snapshot = l0_meta->mutable_snapshot();
@@ -1395,7 +1566,7 @@ Status PersistentIndex::commit(PersistentIndexMetaPB* index_meta) {
         l0_meta->set_format_version(PERSISTENT_INDEX_VERSION_1);
         _offset = 0;
         _page_size = 0;
-        // clear _l0 and reload _l1
+        // clear _l0 and reload _l1 and _l2
         RETURN_IF_ERROR(_reload(*index_meta));
     } else if (_dump_snapshot) {
         std::string file_name = _get_l0_index_file_name(_path, _version);
@@ -1443,7 +1614,7 @@ Status PersistentIndex::commit(PersistentIndexMetaPB* index_meta) {
 
 Status PersistentIndex::on_commited() {
     if (_flushed) {
-        RETURN_IF_ERROR(_delete_expired_index_file(_version, _l1_version));
+        RETURN_IF_ERROR(_delete_expired_index_file(_version));
     } else if (_dump_snapshot) {
         std::string expired_l0_file_path = _index_file->filename();
         std::string index_file_path = _get_l0_index_file_name(_path, _version);
@@ -1468,6 +1639,22 @@ Status PersistentIndex::on_commited() {
 
     _dump_snapshot = false;
     _flushed = false;
+    _l1_demoted = false;
+    _merged_to_l2 = false;
+    return Status::OK();
+}
+
+Status PersistentIndex::_get_from_immutable_index(size_t n, const void* keys, const KeysInfo& keys_info,
+                                                  IndexValue* values, size_t* num_found) const {
+    const KeysInfo* checks = &keys_info;
+    KeysInfo l2_checks;
+    if (_l1) {
+        RETURN_IF_ERROR(_l1->get(n, keys, *checks, values, num_found, _l2 ? &l2_checks : nullptr));
+        checks = &l2_checks;
+    }
+    if (_l2) {
+        RETURN_IF_ERROR(_l2->get(n, keys, *checks, values, num_found));
+    }
     return Status::OK();
 }
 
@@ -1475,9 +1662,7 @@ Status PersistentIndex::get(size_t n, const void* keys, IndexValue* values) {
     KeysInfo l1_checks;
     size_t num_found = 0;
     RETURN_IF_ERROR(_l0->get(n, keys, values, &l1_checks, &num_found));
-    if (_l1) {
-        RETURN_IF_ERROR(_l1->get(n, keys, l1_checks, values, &num_found));
-    }
+    RETURN_IF_ERROR(_get_from_immutable_index(n, keys, l1_checks, values, &num_found));
     return Status::OK();
 }
 
@@ -1486,9 +1671,7 @@ Status PersistentIndex::upsert(size_t n, const void* keys, const IndexValue* val
     size_t num_found = 0;
     RETURN_IF_ERROR(_l0->upsert(n, keys, values, old_values, &l1_checks, &num_found));
     _dump_snapshot |= _can_dump_directly();
-    if (_l1) {
-        RETURN_IF_ERROR(_l1->get(n, keys, l1_checks, old_values, &num_found));
-    }
+    RETURN_IF_ERROR(_get_from_immutable_index(n, keys, l1_checks, old_values, &num_found));
     _size += (n - num_found);
     if (!_dump_snapshot) {
         RETURN_IF_ERROR(_append_wal(n, keys, values));
@@ -1498,8 +1681,21 @@ Status PersistentIndex::upsert(size_t n, const void* keys, const IndexValue* val
 
 Status PersistentIndex::insert(size_t n, const void* keys, const IndexValue* values, bool check_l1) {
     RETURN_IF_ERROR(_l0->insert(n, keys, values));
-    if (_l1 && check_l1) {
-        RETURN_IF_ERROR(_l1->check_not_exist(n, keys));
+    if ((_l1 || _l2) && check_l1) {
+        KeysInfo keys_info;
+        keys_info.key_idxes.reserve(n);
+        keys_info.hashes.reserve(n);
+        for (size_t i = 0; i < n; i++) {
+            keys_info.key_idxes.emplace_back(i);
+            keys_info.hashes.emplace_back(key_index_hash((const uint8_t*)keys + _key_size * i, _key_size));
+        }
+        KeysInfo l2_checks;
+        if (_l1) {
+            RETURN_IF_ERROR(_l1->check_not_exist(n, keys, keys_info, _l2 ? &l2_checks : nullptr));
+        }
+        if (_l2) {
+            RETURN_IF_ERROR(_l2->check_not_exist(n, keys, _l1 ? l2_checks : keys_info, nullptr));
+        }
     }
     _dump_snapshot |= _can_dump_directly();
     _size += n;
@@ -1514,9 +1710,7 @@ Status PersistentIndex::erase(size_t n, const void* keys, IndexValue* old_values
     size_t num_erased = 0;
     RETURN_IF_ERROR(_l0->erase(n, keys, old_values, &l1_checks, &num_erased));
     _dump_snapshot |= _can_dump_directly();
-    if (_l1) {
-        RETURN_IF_ERROR(_l1->get(n, keys, l1_checks, old_values, &num_erased));
-    }
+    RETURN_IF_ERROR(_get_from_immutable_index(n, keys, l1_checks, old_values, &num_erased));
     CHECK(_size >= num_erased) << strings::Substitute("_size($0) < num_erased($1)", _size, num_erased);
     _size -= num_erased;
     if (!_dump_snapshot) {
@@ -1570,19 +1764,26 @@ Status PersistentIndex::_append_wal(size_t n, const void* keys, const IndexValue
     return Status::OK();
 }
 
-Status PersistentIndex::_flush_l0() {
+Status PersistentIndex::_flush_l0(bool with_null) {
     size_t value_size = sizeof(IndexValue);
     size_t kv_size = _key_size + value_size;
-    auto [nshard, npage_hint] = estimate_nshard_and_npage(kv_size, _size, default_usage_percent);
-    auto kv_ref_by_shard = _l0->get_kv_refs_by_shard(nshard, _size, true);
+    // without null, _l0 holds all the keys
+    size_t num_entry = with_null ? _l0->size() : _size;
+    auto [nshard, npage_hint] = estimate_nshard_and_npage(kv_size, num_entry, default_usage_percent);
+    auto kv_ref_by_shard = _l0->get_kv_refs_by_shard(nshard, num_entry, !with_null);
     ImmutableIndexWriter writer;
-    RETURN_IF_ERROR(writer.init(_path, _version));
+    RETURN_IF_ERROR(writer.init(_path, _version, _need_bloom_filter(with_null)));
     for (auto& kvs : kv_ref_by_shard) {
         RETURN_IF_ERROR(writer.write_shard(_key_size, value_size, npage_hint, kvs));
     }
     return writer.finish();
 }
 
+// the l1 above an l2 is small and mostly probed for the keys not in it, so it always has bloom filters
+bool PersistentIndex::_need_bloom_filter(bool with_null) {
+    return with_null || config::enable_persistent_index_bloom_filter;
+}
+
 Status PersistentIndex::_reload(const PersistentIndexMetaPB& index_meta) {
     _offset = 0;
     _page_size = 0;
@@ -1600,10 +1801,12 @@ Status PersistentIndex::_reload(const PersistentIndexMetaPB& index_meta) {
 }
 
 // check _l0 should be flush or not, if not, return
-// if _l0 should be flush, there are two conditions:
+// if _l0 should be flush, there are four conditions:
 //   1. _l1 is not exist, _flush_l0 and build _l1
-//   2. _l1 is exist, merge _l0 and _l1
-// rebuild _l0 and _l1
+//   2. _l1 is exist and _l2 is not exist, push _l1 down as _l2, _flush_l0 and build _l1
+//   3. both exist and _l1 is small comparing to _l2, merge _l0 and _l1 into _l1
+//   4. both exist and _l1 is large comparing to _l2, merge _l0, _l1 and _l2 into _l2
+// rebuild _l0, _l1 and _l2
 // In addition, there may be io waste because we append wals first and
 // do _flush_l0 or merge compaction.
 Status PersistentIndex::_check_and_flush_l0() {
@@ -1618,11 +1821,22 @@ Status PersistentIndex::_check_and_flush_l0() {
         return Status::OK();
     }
     _flushed = true;
+    uint64_t l2_file_size = 0;
+    if (_l2 != nullptr) {
+        _l2->file_size(&l2_file_size);
+    }
     // flush _l0
     if (_l1 == nullptr) {
-        RETURN_IF_ERROR(_flush_l0());
+        // the keys deleted in _l0 may still exist in _l2
+        RETURN_IF_ERROR(_flush_l0(_l2 != nullptr));
+    } else if (_l2 == nullptr) {
+        _l1_demoted = true;
+        RETURN_IF_ERROR(_flush_l0(true));
+    } else if (l1_file_size * std::max(config::persistent_index_l2_merge_ratio, 0) < l2_file_size) {
+        RETURN_IF_ERROR(_merge_compaction({_l1.get()}, true));
     } else {
-        RETURN_IF_ERROR(_merge_compaction());
+        _merged_to_l2 = true;
+        RETURN_IF_ERROR(_merge_compaction({_l1.get(), _l2.get()}, false));
     }
     return Status::OK();
 }
@@ -1653,16 +1867,25 @@ bool PersistentIndex::_load_snapshot(phmap::BinaryInputArchive& ar) {
     return (_l0 == nullptr) ? false : _l0->load_snapshot(ar);
 }
 
-Status PersistentIndex::_delete_expired_index_file(const EditVersion& l0_version, const EditVersion& l1_version) {
+Status PersistentIndex::_delete_expired_index_file(const EditVersion& l0_version) {
     std::string l0_file_name = strings::Substitute("index.l0.$0.$1", l0_version.major(), l0_version.minor());
-    std::string l1_file_name = strings::Substitute("index.l1.$0.$1", l1_version.major(), l1_version.minor());
+    // both the files of l1 and l2 are named by index.l1.<version>
+    std::string l1_file_name;
+    std::string l2_file_name;
+    if (_l1 != nullptr) {
+        l1_file_name = strings::Substitute("index.l1.$0.$1", _l1_version.major(), _l1_version.minor());
+    }
+    if (_l2 != nullptr) {
+        l2_file_name = strings::Substitute("index.l1.$0.$1", _l2_version.major(), _l2_version.minor());
+    }
     std::string l0_prefix("index.l0");
     std::string l1_prefix("index.l1");
     std::string dir = _path;
     auto cb = [&](std::string_view name) -> bool {
         std::string full(name);
         if ((full.compare(0, l0_prefix.length(), l0_prefix) == 0 && full.compare(l0_file_name) != 0) ||
-            (full.compare(0, l1_prefix.length(), l1_prefix) == 0 && full.compare(l1_file_name) != 0)) {
+            (full.compare(0, l1_prefix.length(), l1_prefix) == 0 && full.compare(l1_file_name) != 0 &&
+             full.compare(l2_file_name) != 0)) {
             std::string path = dir + "/" + full;
             VLOG(1) << "delete expired index file " << path;
             Status st = FileSystem::Default()->delete_file(path);
@@ -1687,27 +1910,29 @@ struct KVRefHash {
     uint64_t operator()(const KVRef& kv) const { return kv.hash; }
 };
 
+// merge the kvs of the levels ordered from the upper to the lower, the kvs of an upper level override the lower
+// |with_null|: keep the deleted keys, otherwise drop them
 template <size_t KeySize>
-Status merge_shard_kvs_fixed_len(std::vector<KVRef>& l0_kvs, std::vector<KVRef>& l1_kvs, size_t estimated_size,
-                                 std::vector<KVRef>& ret) {
+Status merge_shard_kvs_fixed_len(const std::vector<std::vector<KVRef>*>& kvs_by_level, bool with_null,
+                                 size_t estimated_size, std::vector<KVRef>& ret) {
     phmap::flat_hash_set<KVRef, KVRefHash, KVRefEq<KeySize>> kvs_set;
     kvs_set.reserve(estimated_size);
-    for (auto& kv : l1_kvs) {
-        auto rs = kvs_set.emplace(kv);
-        DCHECK(rs.second) << "duplicate key found when in l1 index";
-        if (!rs.second) {
-            // duplicate key found, illegal
-            return Status::InternalError("duplicate key found in l1 index");
-        }
-    }
-    for (auto& kv : l0_kvs) {
-        IndexValue v = UNALIGNED_LOAD64(kv.kv_pos + KeySize);
-        if (v == NullIndexValue) {
-            // delete
-            kvs_set.erase(kv);
-        } else {
+    for (size_t level = kvs_by_level.size(); level-- > 0;) {
+        bool lowest = (level + 1 == kvs_by_level.size());
+        for (auto& kv : *kvs_by_level[level]) {
+            IndexValue v = UNALIGNED_LOAD64(kv.kv_pos + KeySize);
+            if (v == NullIndexValue && !with_null) {
+                // delete
+                kvs_set.erase(kv);
+                continue;
+            }
             auto rs = kvs_set.emplace(kv);
             if (!rs.second) {
+                DCHECK(!lowest) << "duplicate key found in immutable index";
+                if (lowest) {
+                    // duplicate key found, illegal
+                    return Status::InternalError("duplicate key found in immutable index");
+                }
                 DCHECK(rs.first->hash == kv.hash) << "upsert kv in set, hash should be the same";
                 // TODO: find a way to modify iterator directly, currently just erase then re-insert
                 // rs.first->kv_pos = kv.kv_pos;
@@ -1723,14 +1948,14 @@ Status merge_shard_kvs_fixed_len(std::vector<KVRef>& l0_kvs, std::vector<KVRef>&
     return Status::OK();
 }
 
-static Status merge_shard_kvs(size_t key_size, std::vector<KVRef>& l0_kvs, std::vector<KVRef>& l1_kvs,
+static Status merge_shard_kvs(size_t key_size, const std::vector<std::vector<KVRef>*>& kvs_by_level, bool with_null,
                               size_t estimated_size, std::vector<KVRef>& ret) {
     if (key_size == 0) {
         return Status::NotSupported("merge_shard: varlen key size not supported");
     }
 #define CASE_SIZE(s) \
     case s:          \
-        return merge_shard_kvs_fixed_len<s>(l0_kvs, l1_kvs, estimated_size, ret);
+        return merge_shard_kvs_fixed_len<s>(kvs_by_level, with_null, estimated_size, ret);
 
 #define CASE_SIZE_8(s) \
     CASE_SIZE(s)       \
@@ -1759,56 +1984,72 @@ static Status merge_shard_kvs(size_t key_size, std::vector<KVRef>& l0_kvs, std::
 #undef CASE_SIZE
 }
 
-Status PersistentIndex::_merge_compaction() {
-    if (!_l1) {
-        return Status::InternalError("cannot do merge_compaction without l1");
+Status PersistentIndex::_merge_compaction(const std::vector<ImmutableIndex*>& indexes, bool with_null) {
+    if (indexes.empty()) {
+        return Status::InternalError("cannot do merge_compaction without immutable index");
     }
     ImmutableIndexWriter writer;
-    RETURN_IF_ERROR(writer.init(_path, _version));
+    RETURN_IF_ERROR(writer.init(_path, _version, _need_bloom_filter(with_null)));
     size_t value_size = sizeof(IndexValue);
     size_t kv_size = _key_size + value_size;
-    auto [nshard, npage_hint] = estimate_nshard_and_npage(kv_size, _size, default_usage_percent);
-    size_t estimated_size_per_shard = _size / nshard;
+    // without null, the merged levels hold all the keys
+    size_t num_entry = _size;
+    if (with_null) {
+        num_entry = _l0->size();
+        for (auto* index : indexes) {
+            num_entry += index->_size;
+        }
+    }
+    auto [nshard, npage_hint] = estimate_nshard_and_npage(kv_size, num_entry, default_usage_percent);
+    size_t estimated_size_per_shard = num_entry / nshard;
+    uint32_t shard_bits = log2(nshard);
     std::vector<std::vector<KVRef>> l0_kvs_by_shard = _l0->get_kv_refs_by_shard(nshard, _l0->size(), false);
-    std::vector<std::vector<KVRef>> l1_kvs_by_shard(nshard);
-    size_t nshard_l1 = _l1->_shards.size();
-    size_t cur_shard_idx = 0;
-    // shard iteration example:
+    // for each level, the kvs read by the shard of the new index, and the shards of the level holding them
+    std::vector<std::vector<std::vector<KVRef>>> kvs_by_level(indexes.size());
+    std::vector<std::vector<std::unique_ptr<ImmutableIndexShard>>> shards_by_level(indexes.size());
+    std::vector<size_t> next_shard_by_level(indexes.size(), 0);
+    std::vector<size_t> released_shard_by_level(indexes.size(), 0);
+    for (size_t i = 0; i < indexes.size(); i++) {
+        kvs_by_level[i].resize(nshard);
+        shards_by_level[i].resize(indexes[i]->_shards.size());
+    }
+    // shard iteration example, a shard of a level is read before the first new shard overlapping it,
+    // and released after the last one:
     //
-    // nshard_l1(4) < nshard(8):
-    //         l1_shard_idex: 0     1     2     3
-    //    num_shard_finished: 2     4     6     8
-    //         cur_shard_idx: 0 1   2 3   4 5   6 7
+    // nshard_level(4) < nshard(8):
+    //         level_shard_idx: 0     1     2     3
+    //           cur_shard_idx: 0 1   2 3   4 5   6 7
     //
-    // nshard_l1(4) = nshard(4):
-    //         l1_shard_idex: 0     1     2     3
-    //    num_shard_finished: 1     2     3     4
-    //         cur_shard_idx: 0     1     2     3
-    //
-    // nshard_l1(8) > nshard(4):
-    //         l1_shard_idex: 0  1  2  3  4  5  6  7
-    //    num_shard_finished: 0  1  1  2  2  3  3  4
-    //         cur_shard_idx:    0     1     2     3
-    std::vector<std::unique_ptr<ImmutableIndexShard>> index_shards((nshard_l1 / nshard) + 1);
-    size_t index_shards_idx = 0;
-    uint32_t shard_bits = log2(nshard);
-    for (size_t l1_shard_idx = 0; l1_shard_idx < nshard_l1; l1_shard_idx++) {
-        RETURN_IF_ERROR(
-                _l1->_get_kvs_for_shard(l1_kvs_by_shard, l1_shard_idx, shard_bits, &index_shards[index_shards_idx++]));
-        size_t num_shard_finished = (l1_shard_idx + 1) * nshard / nshard_l1;
-        std::vector<KVRef> kvs;
-        while (cur_shard_idx < num_shard_finished) {
-            kvs.clear();
-            RETURN_IF_ERROR(merge_shard_kvs(_key_size, l0_kvs_by_shard[cur_shard_idx], l1_kvs_by_shard[cur_shard_idx],
-                                            estimated_size_per_shard, kvs));
-            RETURN_IF_ERROR(writer.write_shard(_key_size, value_size, npage_hint, kvs));
-            // clear to optimize memory usage
-            l0_kvs_by_shard[cur_shard_idx].clear();
-            l0_kvs_by_shard[cur_shard_idx].shrink_to_fit();
-            l1_kvs_by_shard[cur_shard_idx].clear();
-            l1_kvs_by_shard[cur_shard_idx].shrink_to_fit();
-            cur_shard_idx++;
-            index_shards_idx = 0;
+    // nshard_level(8) > nshard(4):
+    //         level_shard_idx: 0  1  2  3  4  5  6  7
+    //           cur_shard_idx:   0     1     2     3
+    std::vector<KVRef> kvs;
+    for (size_t cur_shard_idx = 0; cur_shard_idx < nshard; cur_shard_idx++) {
+        std::vector<std::vector<KVRef>*> kvs_to_merge{&l0_kvs_by_shard[cur_shard_idx]};
+        for (size_t i = 0; i < indexes.size(); i++) {
+            size_t nshard_level = indexes[i]->_shards.size();
+            size_t shard_end = ((cur_shard_idx + 1) * nshard_level + nshard - 1) / nshard;
+            for (auto& level_shard_idx = next_shard_by_level[i]; level_shard_idx < shard_end; level_shard_idx++) {
+                RETURN_IF_ERROR(indexes[i]->_get_kvs_for_shard(kvs_by_level[i], level_shard_idx, shard_bits,
+                                                               &shards_by_level[i][level_shard_idx]));
+            }
+            kvs_to_merge.emplace_back(&kvs_by_level[i][cur_shard_idx]);
+        }
+        kvs.clear();
+        RETURN_IF_ERROR(merge_shard_kvs(_key_size, kvs_to_merge, with_null, estimated_size_per_shard, kvs));
+        RETURN_IF_ERROR(writer.write_shard(_key_size, value_size, npage_hint, kvs));
+        // clear to optimize memory usage
+        for (auto* level_kvs : kvs_to_merge) {
+            level_kvs->clear();
+            level_kvs->shrink_to_fit();
+        }
+        for (size_t i = 0; i < indexes.size(); i++) {
+            size_t nshard_level = indexes[i]->_shards.size();
+            auto& level_shard_idx = released_shard_by_level[i];
+            while (level_shard_idx < next_shard_by_level[i] &&
+                   (level_shard_idx + 1) * nshard <= (cur_shard_idx + 1) * nshard_level) {
+                shards_by_level[i][level_shard_idx++].reset();
+            }
         }
     }
     return writer.finish();
@@ -9,6 +9,7 @@
 #include "fs/fs.h"
 #include "gen_cpp/persistent_index.pb.h"
 #include "storage/edit_version.h"
+#include "storage/rowset/bloom_filter.h"
 #include "storage/rowset/rowset.h"
 #include "util/phmap/phmap.h"
 #include "util/phmap/phmap_dump.h"
@@ -153,11 +154,19 @@ public:
     // |not_found|: information of keys not found in upper level, which needs to be checked in this level
     // |values|: value array for return values
     // |num_found|: add the number of keys found in L1 to this argument
-    Status get(size_t n, const void* keys, const KeysInfo& keys_info, IndexValue* values, size_t* num_found) const;
+    // |not_found|: if not null, information of keys not found in this level, which need to be further checked
+    //              in next level, keys found deleted in this level are neither found nor added to it
+    Status get(size_t n, const void* keys, const KeysInfo& keys_info, IndexValue* values, size_t* num_found,
+               KeysInfo* not_found = nullptr) const;
 
     // batch check key existence
     Status check_not_exist(size_t n, const void* keys);
 
+    // batch check key existence of the keys in |keys_info|
+    // |not_found|: if not null, information of keys not found in this level, which need to be further checked
+    //              in next level
+    Status check_not_exist(size_t n, const void* keys, const KeysInfo& keys_info, KeysInfo* not_found) const;
+
     // get Immutable index file size;
     void file_size(uint64_t* file_size) {
         if (_file != nullptr) {
@@ -173,6 +182,15 @@ public:
         }
     }
 
+    // memory usage of the bloom filters
+    size_t memory_usage() const {
+        size_t ret = 0;
+        for (const auto& bf : _bloom_filters) {
+            ret += (bf != nullptr) ? bf->size() : 0;
+        }
+        return ret;
+    }
+
     static StatusOr<std::unique_ptr<ImmutableIndex>> load(std::unique_ptr<RandomAccessFile>&& rb);
 
 private:
@@ -185,9 +203,15 @@ private:
                               std::unique_ptr<ImmutableIndexShard>* shard) const;
 
     Status _get_in_shard(size_t shard_idx, size_t n, const void* keys, const KeysInfo& keys_info, IndexValue* values,
-                         size_t* num_found) const;
+                         size_t* num_found, KeysInfo* not_found) const;
 
-    Status _check_not_exist_in_shard(size_t shard_idx, size_t n, const void* keys, const KeysInfo& keys_info) const;
+    Status _check_not_exist_in_shard(size_t shard_idx, size_t n, const void* keys, const KeysInfo& keys_info,
+                                     KeysInfo* not_found) const;
+
+    // return the keys of |keys_info| passing the bloom filter of the shard `shard_idx`, the others are added to
+    // |not_found| and their |values| are set to NullIndexValue if not null
+    const KeysInfo& _filter_by_bloom_filter(size_t shard_idx, const KeysInfo& keys_info, KeysInfo* filtered,
+                                            IndexValue* values, KeysInfo* not_found) const;
 
     std::unique_ptr<RandomAccessFile> _file;
     EditVersion _version;
@@ -203,10 +227,17 @@ private:
     };
 
     std::vector<ShardInfo> _shards;
+    // bloom filters of the shards, consulted before reading a shard, empty if the index has no bloom filter
+    std::vector<std::unique_ptr<BloomFilter>> _bloom_filters;
 };
 
-// A persistent primary index contains an in-memory L0 and an on-SSD/NVMe L1,
+// A persistent primary index contains an in-memory L0 and on-SSD/NVMe L1 and L2,
 // this saves memory usage comparing to the orig all-in-memory implementation.
+// L2 holds the bulk of the keys, L1 holds the keys flushed from L0 since the last
+// merge into L2, and the keys deleted since then if L2 exists. Lookups probe L0,
+// L1 and L2 in turn and stop at the first level containing the key, so flushing L0
+// only rewrites L1, and L1 is merged into L2 once it grows to a fraction of L2, see
+// `persistent_index_l2_merge_ratio`.
 // This is a internal class and is intended to be used by PrimaryIndex internally.
 // TODO: code skeleton currently, implementation in future PRs
 //
@@ -235,7 +266,9 @@ public:
     size_t size() const { return _size; }
     size_t kv_size = key_size() + sizeof(IndexValue);
     size_t capacity() const { return _l0 ? _l0->capacity() : 0; }
-    size_t memory_usage() const { return _l0 ? _l0->memory_usage() : 0; }
+    size_t memory_usage() const {
+        return (_l0 ? _l0->memory_usage() : 0) + (_l1 ? _l1->memory_usage() : 0) + (_l2 ? _l2->memory_usage() : 0);
+    }
 
     EditVersion version() const { return _version; }
 
@@ -313,7 +346,8 @@ private:
 
     bool _load_snapshot(phmap::BinaryInputArchive& ar_in);
 
-    Status _delete_expired_index_file(const EditVersion& l0_version, const EditVersion& l1_version);
+    // delete the index files other than the l0 file of |l0_version| and the files of current l1 and l2
+    Status _delete_expired_index_file(const EditVersion& l0_version);
 
     // batch append wal
     // |n|: size of key/value array
@@ -323,10 +357,21 @@ private:
 
     Status _check_and_flush_l0();
 
-    Status _flush_l0();
+    // whether to write bloom filters for new l1 or l2
+    static bool _need_bloom_filter(bool with_null);
+
+    // flush l0 into new l1
+    // |with_null|: keep the deleted keys in new l1, which is required if they may exist in l2
+    Status _flush_l0(bool with_null);
+
+    // merge l0 and |indexes| into new l1 or l2, then clear l0
+    // |indexes|: the levels to merge, ordered from the upper to the lower
+    // |with_null|: keep the deleted keys, which is required if there is an l2 below the merged levels
+    Status _merge_compaction(const std::vector<ImmutableIndex*>& indexes, bool with_null);
 
-    // merge l0 and l1 into new l1, then clear l0
-    Status _merge_compaction();
+    // look up the keys not found in l0 in l1 and l2
+    Status _get_from_immutable_index(size_t n, const void* keys, const KeysInfo& keys_info, IndexValue* values,
+                                     size_t* num_found) const;
 
     Status _load(const PersistentIndexMetaPB& index_meta);
     Status _reload(const PersistentIndexMetaPB& index_meta);
@@ -345,8 +390,10 @@ private:
     EditVersion _version;
     // _l1_version is used to get l1 file name, update in on_committed
     EditVersion _l1_version;
+    EditVersion _l2_version;
     std::unique_ptr<MutableIndex> _l0;
     std::unique_ptr<ImmutableIndex> _l1;
+    std::unique_ptr<ImmutableIndex> _l2;
     // |_offset|: the start offset of last wal in index file
     // |_page_size|: the size of last wal in index file
     uint64_t _offset = 0;
@@ -356,6 +403,10 @@ private:
 
     bool _dump_snapshot = false;
     bool _flushed = false;
+    // set with _flushed if current l1 is pushed down as l2 without rewriting
+    bool _l1_demoted = false;
+    // set with _flushed if l1 and l2 are merged into new l2
+    bool _merged_to_l2 = false;
 };
 
 } // namespace starrocks
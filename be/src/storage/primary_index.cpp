@@ -4,6 +4,7 @@
 
 #include <mutex>
 
+#include "common/config.h"
 #include "runtime/large_int_value.h"
 #include "storage/chunk_helper.h"
 #include "storage/primary_key_encoder.h"
@@ -13,8 +14,10 @@
 #include "storage/tablet.h"
 #include "storage/tablet_reader.h"
 #include "storage/tablet_updates.h"
+#include "util/coding.h"
 #include "util/stack_util.h"
 #include "util/starrocks_metrics.h"
+#include "util/xxh3.h"
 
 namespace starrocks {
 
@@ -589,6 +592,245 @@ public:
     }
 };
 
+// Keys are stored back to back in large blocks, each one prefixed by its varint length, and referred to by
+// a position of (block index << 32 | offset in block).
+class KeyArena {
+public:
+    uint64_t add(const Slice& key) {
+        size_t need = key.size + 5;
+        if (_blocks.empty() || _blocks.back().size() + need > _blocks.back().capacity()) {
+            _blocks.emplace_back();
+            _blocks.back().reserve(std::max(block_size, need));
+        }
+        auto& block = _blocks.back();
+        uint64_t pos = (((uint64_t)(_blocks.size() - 1)) << 32) + block.size();
+        uint8_t buf[5];
+        uint8_t* end = encode_varint32(buf, key.size);
+        block.insert(block.end(), buf, end);
+        block.insert(block.end(), key.data, key.data + key.size);
+        _bytes += (end - buf) + key.size;
+        return pos;
+    }
+
+    Slice get(uint64_t pos) const {
+        auto& block = _blocks[pos >> 32];
+        const uint8_t* p = block.data() + (pos & ROWID_MASK);
+        uint32_t len = 0;
+        p = decode_varint32_ptr(p, block.data() + block.size(), &len);
+        return {p, len};
+    }
+
+    // the bytes of the keys and their lengths
+    size_t bytes() const { return _bytes; }
+
+    size_t memory_usage() const { return _blocks.size() * block_size; }
+
+private:
+    constexpr static size_t block_size = 1024 * 1024;
+
+    std::vector<std::vector<uint8_t>> _blocks;
+    size_t _bytes = 0;
+};
+
+#pragma pack(push)
+#pragma pack(4)
+struct CompactKeyEntry {
+    tablet_rowid_t value = 0;
+    uint64_t key_pos = 0;
+};
+#pragma pack(pop)
+
+// A memory compact replacement of SliceHashIndex for the long keys. The hash table only holds a 64-bit fingerprint
+// of each key, and the full keys are copied into a KeyArena to verify the matched fingerprints, instead of one
+// std::string per key. A key whose fingerprint is already taken by another key is kept in a small overflow map,
+// so a fingerprint absent from the hash table means an absent key.
+class CompactSliceHashIndex : public HashIndex {
+private:
+    using FingerprintMap =
+            phmap::parallel_flat_hash_map<uint64_t, CompactKeyEntry, phmap::Hash<uint64_t>,
+                                          phmap::priv::hash_default_eq<uint64_t>,
+                                          TraceAlloc<phmap::priv::Pair<const uint64_t, CompactKeyEntry>>, 4,
+                                          phmap::NullMutex, false>;
+    using OverflowMap = phmap::flat_hash_map<string, tablet_rowid_t, StringHash>;
+    FingerprintMap _map;
+    OverflowMap _overflow;
+    KeyArena _arena;
+    // the bytes of the erased keys still in _arena
+    size_t _garbage_bytes = 0;
+
+    static uint64_t fingerprint(const Slice& key) { return XXH3_64bits(key.data, key.size); }
+
+    // Return the value of |key|, nullptr if absent.
+    tablet_rowid_t* _find(const Slice& key, uint64_t fp) {
+        auto it = _map.find(fp);
+        if (it == _map.end()) {
+            return nullptr;
+        }
+        if (_arena.get(it->second.key_pos) == key) {
+            return &it->second.value;
+        }
+        if (_overflow.empty()) {
+            return nullptr;
+        }
+        auto oit = _overflow.find(key.to_string());
+        return oit != _overflow.end() ? &oit->second : nullptr;
+    }
+
+    // Insert |key| with |value| and return nullptr, or return the value of |key| if it's already present.
+    tablet_rowid_t* _insert(const Slice& key, uint64_t fp, tablet_rowid_t value) {
+        auto [it, inserted] = _map.try_emplace(fp);
+        if (inserted) {
+            it->second.value = value;
+            it->second.key_pos = _arena.add(key);
+            return nullptr;
+        }
+        if (_arena.get(it->second.key_pos) == key) {
+            return &it->second.value;
+        }
+        auto [oit, oinserted] = _overflow.emplace(key.to_string(), value);
+        return oinserted ? nullptr : &oit->second;
+    }
+
+    // Erase |key| and return its value in |old|, return false if absent.
+    bool _erase(const Slice& key, uint64_t fp, tablet_rowid_t* old) {
+        auto it = _map.find(fp);
+        if (it == _map.end()) {
+            return false;
+        }
+        if (_arena.get(it->second.key_pos) != key) {
+            auto oit = _overflow.find(key.to_string());
+            if (oit == _overflow.end()) {
+                return false;
+            }
+            *old = oit->second;
+            _overflow.erase(oit);
+            return true;
+        }
+        *old = it->second.value;
+        _garbage_bytes += _arena.get(it->second.key_pos).size;
+        // move an overflowed key of the same fingerprint into the hash table
+        for (auto oit = _overflow.begin(); oit != _overflow.end(); ++oit) {
+            if (fingerprint(oit->first) == fp) {
+                it->second.value = oit->second;
+                it->second.key_pos = _arena.add(oit->first);
+                _overflow.erase(oit);
+                return true;
+            }
+        }
+        _map.erase(it);
+        return true;
+    }
+
+    // Copy the live keys into a new arena once most of the arena is taken by the erased keys.
+    void _maybe_compact_arena() {
+        if (_garbage_bytes < 1024 * 1024 || _garbage_bytes * 2 < _arena.bytes()) {
+            return;
+        }
+        KeyArena arena;
+        for (auto& kv : _map) {
+            kv.second.key_pos = arena.add(_arena.get(kv.second.key_pos));
+        }
+        _arena = std::move(arena);
+        _garbage_bytes = 0;
+    }
+
+public:
+    CompactSliceHashIndex() = default;
+    ~CompactSliceHashIndex() override = default;
+
+    size_t size() const override { return _map.size() + _overflow.size(); }
+
+    size_t capacity() const override { return _map.capacity(); }
+
+    void reserve(size_t size) override { _map.reserve(size); }
+
+    Status insert(uint32_t rssid, const vector<uint32_t>& rowids, const vectorized::Column& pks, uint32_t idx_begin,
+                  uint32_t idx_end) override {
+        auto* keys = reinterpret_cast<const Slice*>(pks.raw_data());
+        DCHECK(idx_end <= rowids.size());
+        uint64_t base = (((uint64_t)rssid) << 32);
+        for (uint32_t i = idx_begin; i < idx_end; i++) {
+            uint64_t v = base + rowids[i];
+            auto p = _insert(keys[i], fingerprint(keys[i]), v);
+            if (p != nullptr) {
+                uint64_t old = *p;
+                std::string msg = strings::Substitute(
+                        "insert found duplicate key new(rssid=$0 rowid=$1) old(rssid=$2 rowid=$3) "
+                        "key=$4 [$5]",
+                        rssid, rowids[i], (uint32_t)(old >> 32), (uint32_t)(old & ROWID_MASK), keys[i].to_string(),
+                        hexdump(keys[i].data, keys[i].size));
+                LOG(ERROR) << msg;
+                return Status::InternalError(msg);
+            }
+        }
+        return Status::OK();
+    }
+
+    void upsert(uint32_t rssid, uint32_t rowid_start, const vectorized::Column& pks, uint32_t idx_begin,
+                uint32_t idx_end, DeletesMap* deletes) override {
+        auto* keys = reinterpret_cast<const Slice*>(pks.raw_data());
+        uint64_t base = (((uint64_t)rssid) << 32) + rowid_start;
+        for (uint32_t i = idx_begin; i < idx_end; i++) {
+            uint64_t v = base + i;
+            auto p = _insert(keys[i], fingerprint(keys[i]), v);
+            if (p != nullptr) {
+                uint64_t old = *p;
+                if ((old >> 32) == rssid) {
+                    LOG(ERROR) << "found duplicate in upsert data rssid:" << rssid << " key=" << keys[i].to_string()
+                               << " [" << hexdump(keys[i].data, keys[i].size) << "]";
+                }
+                (*deletes)[(uint32_t)(old >> 32)].push_back((uint32_t)(old & ROWID_MASK));
+                *p = v;
+            }
+        }
+    }
+
+    void try_replace(uint32_t rssid, uint32_t rowid_start, const vectorized::Column& pks,
+                     const vector<uint32_t>& src_rssid, uint32_t idx_begin, uint32_t idx_end,
+                     vector<uint32_t>* failed) override {
+        auto* keys = reinterpret_cast<const Slice*>(pks.raw_data());
+        uint64_t base = (((uint64_t)rssid) << 32) + rowid_start;
+        for (uint32_t i = idx_begin; i < idx_end; i++) {
+            auto p = _find(keys[i], fingerprint(keys[i]));
+            if (p != nullptr && ((uint32_t)(*p >> 32) == src_rssid[i])) {
+                // matched, can replace
+                *p = base + i;
+            } else {
+                // not match, mark failed
+                failed->push_back(rowid_start + i);
+            }
+        }
+    }
+
+    void erase(const vectorized::Column& pks, uint32_t idx_begin, uint32_t idx_end, DeletesMap* deletes) override {
+        auto* keys = reinterpret_cast<const Slice*>(pks.raw_data());
+        for (uint32_t i = idx_begin; i < idx_end; i++) {
+            uint64_t old = 0;
+            if (_erase(keys[i], fingerprint(keys[i]), &old)) {
+                (*deletes)[(uint32_t)(old >> 32)].push_back((uint32_t)(old & ROWID_MASK));
+            }
+        }
+        _maybe_compact_arena();
+    }
+
+    void get(const vectorized::Column& pks, uint32_t idx_begin, uint32_t idx_end,
+             std::vector<uint64_t>* rowids) override {
+        auto* keys = reinterpret_cast<const Slice*>(pks.raw_data());
+        for (uint32_t i = idx_begin; i < idx_end; i++) {
+            auto p = _find(keys[i], fingerprint(keys[i]));
+            (*rowids)[i] = p != nullptr ? *p : -1;
+        }
+    }
+
+    std::size_t memory_usage() const final {
+        size_t ret = _map.capacity() * (1 + sizeof(uint64_t) + sizeof(CompactKeyEntry)) + _arena.memory_usage();
+        for (const auto& kv : _overflow) {
+            ret += 32 + sizeof(tablet_rowid_t) + kv.first.size();
+        }
+        return ret;
+    }
+};
+
 class ShardByLengthSliceHashIndex : public HashIndex {
 private:
     constexpr static size_t max_fix_length = 40;
@@ -645,7 +887,13 @@ private:
             CASE_LEN(39)
         default: {
             auto& p = _maps[0];
-            if (!p) p.reset(new SliceHashIndex());
+            if (!p) {
+                if (config::enable_compact_primary_index) {
+                    p.reset(new CompactSliceHashIndex());
+                } else {
+                    p.reset(new SliceHashIndex());
+                }
+            }
             return p.get();
         }
         }
@@ -853,6 +1101,11 @@ Status PrimaryIndex::load(Tablet* tablet) {
     return _status;
 }
 
+bool PrimaryIndex::is_loaded() {
+    std::lock_guard<std::mutex> lg(_lock);
+    return _loaded && _status.ok();
+}
+
 void PrimaryIndex::unload() {
     std::lock_guard<std::mutex> lg(_lock);
     if (!_loaded) {
@@ -38,6 +38,17 @@ public:
     // [thread-safe]
     Status load(Tablet* tablet);
 
+    // Whether the index has been loaded successfully.
+    //
+    // [thread-safe]
+    bool is_loaded();
+
+    // Whether the index is backed by a persistent index, which is reloaded from the index files
+    // instead of scanning all the primary key columns of the tablet.
+    //
+    // [not thread-safe]
+    bool has_persistent_index() const { return _persistent_index != nullptr; }
+
     // Reset primary index to unload state, clear all contents
     //
     // [thread-safe]
@@ -0,0 +1,155 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "storage/primary_key_lookup.h"
+
+#include <numeric>
+#include <set>
+
+#include "column/chunk.h"
+#include "common/config.h"
+#include "runtime/mem_pool.h"
+#include "storage/chunk_helper.h"
+#include "storage/primary_key_encoder.h"
+#include "storage/tablet_reader.h"
+#include "storage/tablet_updates.h"
+
+namespace starrocks::vectorized {
+
+bool can_lookup_primary_keys(Tablet* tablet, const TabletReaderParams& params) {
+    if (!config::enable_primary_key_point_lookup || tablet->keys_type() != PRIMARY_KEYS ||
+        tablet->updates() == nullptr) {
+        return false;
+    }
+    if (params.reader_type != READER_QUERY || params.rowid_range_option != nullptr ||
+        !params.short_key_ranges.empty() || !params.global_dictmaps->empty() ||
+        !params.unused_output_column_ids->empty()) {
+        return false;
+    }
+    if (params.range != TabletReaderParams::RangeStartOperation::GE ||
+        params.end_range != TabletReaderParams::RangeEndOperation::LE || params.start_key.empty() ||
+        params.start_key.size() > config::primary_key_point_lookup_max_keys ||
+        params.start_key.size() != params.end_key.size()) {
+        return false;
+    }
+    const size_t num_key_columns = tablet->num_key_columns();
+    for (size_t i = 0; i < params.start_key.size(); i++) {
+        const OlapTuple& start = params.start_key[i];
+        const OlapTuple& end = params.end_key[i];
+        if (start.size() != num_key_columns || start.values() != end.values()) {
+            return false;
+        }
+        for (size_t j = 0; j < num_key_columns; j++) {
+            if (start.is_null(j) || end.is_null(j)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+class PrimaryKeyLookupIterator final : public ChunkIterator {
+public:
+    PrimaryKeyLookupIterator(TabletSharedPtr tablet, int64_t version, Schema schema, const TabletReaderParams& params)
+            : ChunkIterator(std::move(schema), params.chunk_size),
+              _tablet(std::move(tablet)),
+              _version(version),
+              _params(params) {}
+
+    void close() override {
+        if (_reader != nullptr) {
+            _reader->close();
+            _reader.reset();
+        }
+        _result.reset();
+    }
+
+protected:
+    Status do_get_next(Chunk* chunk) override;
+
+private:
+    // Read the rows of the keys into |_result|, or open |_reader| to scan them if the index cannot locate them.
+    Status _lookup();
+
+    // Return the *encoded* primary keys of the key ranges, without duplicates.
+    StatusOr<std::unique_ptr<Column>> _encode_keys() const;
+
+    const TabletSharedPtr _tablet;
+    const int64_t _version;
+    const TabletReaderParams _params;
+
+    bool _looked_up = false;
+    ChunkPtr _result;
+    size_t _result_offset = 0;
+    std::unique_ptr<TabletReader> _reader;
+};
+
+Status PrimaryKeyLookupIterator::do_get_next(Chunk* chunk) {
+    if (!_looked_up) {
+        _looked_up = true;
+        RETURN_IF_ERROR(_lookup());
+    }
+    if (_reader != nullptr) {
+        return _reader->get_next(chunk);
+    }
+    if (_result_offset >= _result->num_rows()) {
+        return Status::EndOfFile("end of primary key lookup");
+    }
+    size_t count = std::min<size_t>(_chunk_size, _result->num_rows() - _result_offset);
+    chunk->append(*_result, _result_offset, count);
+    _result_offset += count;
+    return Status::OK();
+}
+
+StatusOr<std::unique_ptr<Column>> PrimaryKeyLookupIterator::_encode_keys() const {
+    MemPool mempool;
+    std::vector<SeekRange> ranges;
+    RETURN_IF_ERROR(TabletReader::parse_seek_range(_tablet, _params.range, _params.end_range, _params.start_key,
+                                                   _params.end_key, &ranges, &mempool));
+    std::vector<ColumnId> pk_columns(_tablet->num_key_columns());
+    std::iota(pk_columns.begin(), pk_columns.end(), 0);
+    Schema pk_schema = ChunkHelper::convert_schema_to_format_v2(_tablet->tablet_schema(), pk_columns);
+    auto key_chunk = ChunkHelper::new_chunk(pk_schema, ranges.size());
+    std::set<std::vector<std::string>> distinct_keys;
+    for (size_t i = 0; i < ranges.size(); i++) {
+        if (!distinct_keys.insert(_params.start_key[i].values()).second) {
+            continue;
+        }
+        for (size_t j = 0; j < pk_columns.size(); j++) {
+            key_chunk->get_column_by_index(j)->append_datum(ranges[i].lower().get(j));
+        }
+    }
+    std::unique_ptr<Column> keys;
+    RETURN_IF_ERROR(PrimaryKeyEncoder::create_column(pk_schema, &keys));
+    PrimaryKeyEncoder::encode(pk_schema, *key_chunk, 0, key_chunk->num_rows(), keys.get());
+    return std::move(keys);
+}
+
+Status PrimaryKeyLookupIterator::_lookup() {
+    ASSIGN_OR_RETURN(auto keys, _encode_keys());
+    std::vector<uint32_t> column_ids;
+    std::vector<std::unique_ptr<Column>> columns;
+    for (const auto& field : _schema.fields()) {
+        column_ids.push_back(field->id());
+        columns.emplace_back(ChunkHelper::column_from_field(*field)->clone_empty());
+    }
+    Status st = _tablet->updates()->get_rows_by_primary_keys(_version, *keys, column_ids, &columns);
+    if (st.is_not_supported()) {
+        VLOG(2) << "scan the primary keys of tablet " << _tablet->tablet_id() << " instead: " << st;
+        _reader = std::make_unique<TabletReader>(_tablet, Version(0, _version), _schema);
+        RETURN_IF_ERROR(_reader->prepare());
+        return _reader->open(_params);
+    }
+    RETURN_IF_ERROR(st);
+    _result = ChunkHelper::new_chunk(_schema, 0);
+    for (size_t i = 0; i < columns.size(); i++) {
+        _result->columns()[i] = std::move(columns[i]);
+    }
+    return Status::OK();
+}
+
+ChunkIteratorPtr new_primary_key_lookup_iterator(TabletSharedPtr tablet, int64_t version, Schema schema,
+                                                 const TabletReaderParams& params) {
+    return std::make_shared<PrimaryKeyLookupIterator>(std::move(tablet), version, std::move(schema), params);
+}
+
+} // namespace starrocks::vectorized
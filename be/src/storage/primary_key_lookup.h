@@ -0,0 +1,25 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include "storage/chunk_iterator.h"
+#include "storage/tablet.h"
+#include "storage/tablet_reader_params.h"
+
+namespace starrocks::vectorized {
+
+// Whether the scan of |params| only reads the rows of a few primary keys of |tablet|, i.e. it's a query on a primary
+// key tablet whose key ranges are at most `primary_key_point_lookup_max_keys` points, each one of a full primary key,
+// without splits or global dicts.
+bool can_lookup_primary_keys(Tablet* tablet, const TabletReaderParams& params);
+
+// Return an iterator reading the rows of the |schema| columns of |tablet| in |version| whose primary keys are the key
+// ranges of |params|, located by the primary index of the tablet and read through the column iterators of their
+// segments, instead of scanning the segments. It falls back to a TabletReader created with |params| if the primary
+// index is not loaded, or |version| is not the latest applied version.
+// The predicates of |params| are not evaluated.
+// prerequisite: `can_lookup_primary_keys(tablet, params)` is true.
+ChunkIteratorPtr new_primary_key_lookup_iterator(TabletSharedPtr tablet, int64_t version, Schema schema,
+                                                 const TabletReaderParams& params);
+
+} // namespace starrocks::vectorized
@@ -87,7 +87,7 @@ public:
 
     Status remove() override;
 
-    Status link_files_to(const std::string& dir, RowsetId new_rowset_id) override;
+    Status link_files_to(const std::string& dir, RowsetId new_rowset_id, int first_segment_id = 0) override;
 
     Status copy_files_to(const std::string& dir) override;
 
@@ -93,6 +93,7 @@ Status BetaRowsetWriter::init() {
     _writer_options.storage_format_version = _context.storage_format_version;
     _writer_options.global_dicts = _context.global_dicts != nullptr ? _context.global_dicts : nullptr;
     _writer_options.referenced_column_ids = _context.referenced_column_ids;
+    _writer_options.encoding_hints = _context.encoding_hints;
 
     if (_context.tablet_schema->keys_type() == KeysType::PRIMARY_KEYS && _context.partial_update_tablet_schema) {
         _rowset_txn_meta_pb = std::make_unique<RowsetTxnMetaPB>();
@@ -132,7 +133,7 @@ StatusOr<RowsetSharedPtr> BetaRowsetWriter::build() {
             _rowset_meta->set_txn_meta(*_rowset_txn_meta_pb);
         }
     } else {
-        if (_num_segment <= 1) {
+        if (_num_segment <= 1 || _num_ordered_segments == _num_segment) {
             _rowset_meta->set_segments_overlap(NONOVERLAPPING);
         }
     }
@@ -236,7 +237,8 @@ StatusOr<std::unique_ptr<SegmentWriter>> HorizontalBetaRowsetWriter::_create_seg
         // temporary segment files.
         path = BetaRowset::segment_file_path(_context.rowset_path_prefix, _context.rowset_id, _num_segment);
     }
-    ASSIGN_OR_RETURN(auto wfile, _fs->new_writable_file(path));
+    WritableFileOptions opts{.sync_on_close = true, .mode = FileSystem::MUST_CREATE, .direct_io = _context.direct_io};
+    ASSIGN_OR_RETURN(auto wfile, _fs->new_writable_file(opts, path));
     const auto* schema = _rowset_schema != nullptr ? _rowset_schema.get() : _context.tablet_schema;
     auto segment_writer = std::make_unique<SegmentWriter>(std::move(wfile), _num_segment, schema, _writer_options);
     RETURN_IF_ERROR(segment_writer->init());
@@ -299,9 +301,40 @@ Status HorizontalBetaRowsetWriter::flush_chunk(const vectorized::Chunk& chunk) {
     default:
         return Status::Cancelled(_dump_mixed_segment_delfile_not_supported());
     }
+    if (_context.tablet_schema->keys_type() != KeysType::PRIMARY_KEYS) {
+        _check_flushed_key_order(chunk);
+    }
     return _flush_chunk(chunk);
 }
 
+void HorizontalBetaRowsetWriter::_check_flushed_key_order(const vectorized::Chunk& chunk) {
+    if (_num_ordered_segments < 0) {
+        return;
+    }
+    const size_t num_keys = _context.tablet_schema->num_key_columns();
+    if (chunk.num_rows() > 0 && !_last_flushed_keys.empty()) {
+        // the equal keys of two segments are merged by the reader unless the tablet is of duplicate keys.
+        int cmp = 0;
+        for (size_t i = 0; i < num_keys && cmp == 0; i++) {
+            cmp = _last_flushed_keys[i]->compare_at(0, 0, *chunk.get_column_by_index(i), -1);
+        }
+        if (cmp > 0 || (cmp == 0 && _context.tablet_schema->keys_type() != KeysType::DUP_KEYS)) {
+            _num_ordered_segments = -1;
+            _last_flushed_keys.clear();
+            return;
+        }
+    }
+    if (chunk.num_rows() > 0) {
+        _last_flushed_keys.resize(num_keys);
+        for (size_t i = 0; i < num_keys; i++) {
+            const auto& column = chunk.get_column_by_index(i);
+            _last_flushed_keys[i] = column->clone_empty();
+            _last_flushed_keys[i]->append(*column, chunk.num_rows() - 1, 1);
+        }
+    }
+    _num_ordered_segments++;
+}
+
 Status HorizontalBetaRowsetWriter::_flush_chunk(const vectorized::Chunk& chunk) {
     auto segment_writer = _create_segment_writer();
     if (!segment_writer.ok()) {
@@ -370,7 +403,7 @@ Status HorizontalBetaRowsetWriter::flush_chunk_with_deletes(const vectorized::Ch
 
 Status HorizontalBetaRowsetWriter::add_rowset(RowsetSharedPtr rowset) {
     assert(rowset->rowset_meta()->rowset_type() == BETA_ROWSET);
-    RETURN_IF_ERROR(rowset->link_files_to(_context.rowset_path_prefix, _context.rowset_id));
+    RETURN_IF_ERROR(rowset->link_files_to(_context.rowset_path_prefix, _context.rowset_id, _num_segment));
     _num_rows_written += rowset->num_rows();
     _total_row_size += static_cast<int64_t>(rowset->total_row_size());
     _total_data_size += static_cast<int64_t>(rowset->rowset_meta()->data_disk_size());
@@ -720,7 +753,8 @@ StatusOr<std::unique_ptr<SegmentWriter>> VerticalBetaRowsetWriter::_create_segme
         const std::vector<uint32_t>& column_indexes, bool is_key) {
     std::lock_guard<std::mutex> l(_lock);
     std::string path = BetaRowset::segment_file_path(_context.rowset_path_prefix, _context.rowset_id, _num_segment);
-    ASSIGN_OR_RETURN(auto wfile, _fs->new_writable_file(path));
+    WritableFileOptions opts{.sync_on_close = true, .mode = FileSystem::MUST_CREATE, .direct_io = _context.direct_io};
+    ASSIGN_OR_RETURN(auto wfile, _fs->new_writable_file(opts, path));
     const auto* schema = _rowset_schema != nullptr ? _rowset_schema.get() : _context.tablet_schema;
     auto segment_writer = std::make_unique<SegmentWriter>(std::move(wfile), _num_segment, schema, _writer_options);
     RETURN_IF_ERROR(segment_writer->init(column_indexes, is_key));
@@ -24,6 +24,7 @@
 #include <mutex>
 #include <vector>
 
+#include "column/vectorized_fwd.h"
 #include "common/statusor.h"
 #include "gen_cpp/olap_file.pb.h"
 #include "runtime/global_dict/types.h"
@@ -86,6 +87,12 @@ protected:
 
     FlushChunkState _flush_chunk_state = FlushChunkState::UNKNOWN;
 
+    // the number of the segments flushed by `flush_chunk` in the key order, or -1 once the order is violated.
+    // A rowset of the segments in the key order is NONOVERLAPPING, e.g. the rowset of a pre-sorted load.
+    int _num_ordered_segments{0};
+    // the keys of the last row flushed by `flush_chunk`.
+    vectorized::Columns _last_flushed_keys;
+
     vectorized::DictColumnsValidMap _global_dict_columns_valid_info;
 };
 
@@ -118,6 +125,9 @@ private:
 
     Status _flush_chunk(const vectorized::Chunk& chunk);
 
+    // Update `_num_ordered_segments` by the keys of |chunk| flushed as a segment.
+    void _check_flushed_key_order(const vectorized::Chunk& chunk);
+
     std::string _dump_mixed_segment_delfile_not_supported();
 
     std::unique_ptr<SegmentWriter> _segment_writer;
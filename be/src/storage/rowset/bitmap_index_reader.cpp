@@ -105,6 +105,23 @@ Status BitmapIndexIterator::read_bitmap(rowid_t ordinal, Roaring* result) {
     return Status::OK();
 }
 
+Status BitmapIndexIterator::read_dictionary(rowid_t ordinal, size_t* n, std::vector<std::string>* values) {
+    std::unique_ptr<ColumnVectorBatch> cvb;
+    RETURN_IF_ERROR(ColumnVectorBatch::create(*n, false, _reader->type_info(), nullptr, &cvb));
+    ColumnBlock block(cvb.get(), _pool.get());
+    ColumnBlockView column_block_view(&block);
+
+    RETURN_IF_ERROR(_dict_column_iter->seek_to_ordinal(ordinal));
+    RETURN_IF_ERROR(_dict_column_iter->next_batch(n, &column_block_view));
+    const auto* slices = reinterpret_cast<const Slice*>(block.data());
+    values->clear();
+    for (size_t i = 0; i < *n; i++) {
+        values->emplace_back(slices[i].data, slices[i].size);
+    }
+    _pool->clear();
+    return Status::OK();
+}
+
 Status BitmapIndexIterator::read_union_bitmap(rowid_t from, rowid_t to, Roaring* result) {
     DCHECK(0 <= from && from <= to && to <= _reader->bitmap_nums());
 
@@ -22,6 +22,8 @@
 #pragma once
 
 #include <roaring/roaring.hh>
+#include <string>
+#include <vector>
 
 #include "common/status.h"
 #include "fs/fs.h"
@@ -146,6 +148,10 @@ public:
     // }
     Status read_union_bitmap(const vectorized::SparseRange& range, Roaring* result);
 
+    // Read at most |*n| dictionary values from the |ordinal|-th one to |values|, and set |*n| to the number of values
+    // read. REQUIRES: the dictionary has an ordinal index, which is only written for the inverted index.
+    Status read_dictionary(rowid_t ordinal, size_t* n, std::vector<std::string>* values);
+
     rowid_t bitmap_nums() const { return _num_bitmap; }
 
     rowid_t current_ordinal() const { return _current_rowid; }
@@ -192,39 +192,7 @@ public:
             if (!_null_bitmap.isEmpty()) {
                 bitmaps.push_back(&_null_bitmap);
             }
-
-            uint32_t max_bitmap_size = 0;
-            std::vector<uint32_t> bitmap_sizes;
-            for (auto& bitmap : bitmaps) {
-                bitmap->runOptimize();
-                uint32_t bitmap_size = bitmap->getSizeInBytes(false);
-                if (max_bitmap_size < bitmap_size) {
-                    max_bitmap_size = bitmap_size;
-                }
-                bitmap_sizes.push_back(bitmap_size);
-            }
-
-            TypeInfoPtr bitmap_typeinfo = get_type_info(OLAP_FIELD_TYPE_OBJECT);
-
-            IndexedColumnWriterOptions options;
-            options.write_ordinal_index = true;
-            options.write_value_index = false;
-            options.encoding = EncodingInfo::get_default_encoding(bitmap_typeinfo->type(), false);
-            // we already store compressed bitmap, use NO_COMPRESSION to save some cpu
-            options.compression = NO_COMPRESSION;
-
-            IndexedColumnWriter bitmap_column_writer(options, bitmap_typeinfo, wfile);
-            RETURN_IF_ERROR(bitmap_column_writer.init());
-
-            faststring buf;
-            buf.reserve(max_bitmap_size);
-            for (size_t i = 0; i < bitmaps.size(); ++i) {
-                buf.resize(bitmap_sizes[i]); // so that buf[0..size) can be read and written
-                bitmaps[i]->write(reinterpret_cast<char*>(buf.data()), false);
-                Slice buf_slice(buf);
-                RETURN_IF_ERROR(bitmap_column_writer.add(&buf_slice));
-            }
-            RETURN_IF_ERROR(bitmap_column_writer.finish(meta->mutable_bitmap_column()));
+            RETURN_IF_ERROR(write_bitmaps(bitmaps, wfile, meta->mutable_bitmap_column()));
         }
         return Status::OK();
     }
@@ -266,6 +234,42 @@ struct BitmapIndexWriterBuilder {
     }
 };
 
+Status BitmapIndexWriter::write_bitmaps(const std::vector<Roaring*>& bitmaps, WritableFile* wfile,
+                                        IndexedColumnMetaPB* meta) {
+    uint32_t max_bitmap_size = 0;
+    std::vector<uint32_t> bitmap_sizes;
+    for (auto& bitmap : bitmaps) {
+        bitmap->runOptimize();
+        uint32_t bitmap_size = bitmap->getSizeInBytes(false);
+        if (max_bitmap_size < bitmap_size) {
+            max_bitmap_size = bitmap_size;
+        }
+        bitmap_sizes.push_back(bitmap_size);
+    }
+
+    TypeInfoPtr bitmap_typeinfo = get_type_info(OLAP_FIELD_TYPE_OBJECT);
+
+    IndexedColumnWriterOptions options;
+    options.write_ordinal_index = true;
+    options.write_value_index = false;
+    options.encoding = EncodingInfo::get_default_encoding(bitmap_typeinfo->type(), false);
+    // we already store compressed bitmap, use NO_COMPRESSION to save some cpu
+    options.compression = NO_COMPRESSION;
+
+    IndexedColumnWriter bitmap_column_writer(options, bitmap_typeinfo, wfile);
+    RETURN_IF_ERROR(bitmap_column_writer.init());
+
+    faststring buf;
+    buf.reserve(max_bitmap_size);
+    for (size_t i = 0; i < bitmaps.size(); ++i) {
+        buf.resize(bitmap_sizes[i]); // so that buf[0..size) can be read and written
+        bitmaps[i]->write(reinterpret_cast<char*>(buf.data()), false);
+        Slice buf_slice(buf);
+        RETURN_IF_ERROR(bitmap_column_writer.add(&buf_slice));
+    }
+    return bitmap_column_writer.finish(meta);
+}
+
 Status BitmapIndexWriter::create(const TypeInfoPtr& typeinfo, std::unique_ptr<BitmapIndexWriter>* res) {
     FieldType type = typeinfo->type();
     *res = field_type_dispatch_bitmap_index(type, BitmapIndexWriterBuilder(), typeinfo);
@@ -23,11 +23,14 @@
 
 #include <cstddef>
 #include <memory>
+#include <vector>
 
 #include "common/status.h"
 #include "gen_cpp/segment.pb.h"
 #include "gutil/macros.h"
 
+class Roaring;
+
 namespace starrocks {
 
 class TypeInfo;
@@ -50,6 +53,9 @@ public:
 
     virtual uint64_t size() const = 0;
 
+    // Write the posting lists of a bitmap index to |file|, which are optimized in place.
+    static Status write_bitmaps(const std::vector<Roaring*>& bitmaps, WritableFile* file, IndexedColumnMetaPB* meta);
+
 private:
     BitmapIndexWriter(const BitmapIndexWriter&) = delete;
     const BitmapIndexWriter& operator=(const BitmapIndexWriter&) = delete;
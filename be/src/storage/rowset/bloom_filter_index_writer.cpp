@@ -32,8 +32,10 @@
 #include "storage/rowset/common.h"
 #include "storage/rowset/encoding_info.h"
 #include "storage/rowset/indexed_column_writer.h"
+#include "storage/rowset/ngram.h"
 #include "storage/type_traits.h"
 #include "storage/types.h"
+#include "util/phmap/phmap.h"
 #include "util/slice.h"
 
 namespace starrocks {
@@ -91,6 +93,22 @@ inline void update_bf(BloomFilter* bf, const typename CppTypeTraits<type>::CppTy
 // This builder builds a bloom filter page by every data page, with a page id index.
 // Meanswhile, It adds an ordinal index to load bloom filter index according to requirement.
 //
+Status write_bloom_filters(const std::vector<std::unique_ptr<BloomFilter>>& bfs, WritableFile* wfile,
+                           BloomFilterIndexPB* meta) {
+    TypeInfoPtr bf_typeinfo = get_type_info(OLAP_FIELD_TYPE_VARCHAR);
+    IndexedColumnWriterOptions options;
+    options.write_ordinal_index = true;
+    options.write_value_index = false;
+    options.encoding = PLAIN_ENCODING;
+    IndexedColumnWriter bf_writer(options, bf_typeinfo, wfile);
+    RETURN_IF_ERROR(bf_writer.init());
+    for (auto& bf : bfs) {
+        Slice data(bf->data(), bf->size());
+        bf_writer.add(&data);
+    }
+    return bf_writer.finish(meta->mutable_bloom_filter());
+}
+
 template <FieldType field_type>
 class BloomFilterIndexWriterImpl : public BloomFilterIndexWriter {
 public:
@@ -136,21 +154,7 @@ public:
         BloomFilterIndexPB* meta = index_meta->mutable_bloom_filter_index();
         meta->set_hash_strategy(_bf_options.strategy);
         meta->set_algorithm(BLOCK_BLOOM_FILTER);
-
-        // write bloom filters
-        TypeInfoPtr bf_typeinfo = get_type_info(OLAP_FIELD_TYPE_VARCHAR);
-        IndexedColumnWriterOptions options;
-        options.write_ordinal_index = true;
-        options.write_value_index = false;
-        options.encoding = PLAIN_ENCODING;
-        IndexedColumnWriter bf_writer(options, bf_typeinfo, wfile);
-        RETURN_IF_ERROR(bf_writer.init());
-        for (auto& bf : _bfs) {
-            Slice data(bf->data(), bf->size());
-            bf_writer.add(&data);
-        }
-        RETURN_IF_ERROR(bf_writer.finish(meta->mutable_bloom_filter()));
-        return Status::OK();
+        return write_bloom_filters(_bfs, wfile, meta);
     }
 
     uint64_t size() override {
@@ -170,6 +174,69 @@ private:
     std::vector<std::unique_ptr<BloomFilter>> _bfs;
 };
 
+// Builder for the n-gram bloom filter of a CHAR/VARCHAR column, which builds a bloom filter of all the grams of
+// gram_size bytes of the values by every data page. A page can't match `LIKE '%abc%'` if any gram of "abc" is not
+// in its bloom filter, which prunes the substring searches that the bloom filter of the values can't.
+class NgramBloomFilterIndexWriter : public BloomFilterIndexWriter {
+public:
+    NgramBloomFilterIndexWriter(const BloomFilterOptions& bf_options, uint32_t gram_size)
+            : _bf_options(bf_options), _gram_size(gram_size) {}
+
+    ~NgramBloomFilterIndexWriter() override = default;
+
+    void add_values(const void* values, size_t count) override {
+        const auto* slices = reinterpret_cast<const Slice*>(values);
+        for (size_t i = 0; i < count; ++i) {
+            for_each_ngram(slices[i], _gram_size, [this](const Slice& gram) {
+                uint64_t hash_code;
+                murmur_hash3_x64_64(gram.data, gram.size, BloomFilter::DEFAULT_SEED, &hash_code);
+                _gram_hashes.insert(hash_code);
+                return true;
+            });
+        }
+    }
+
+    void add_nulls(uint32_t count) override { _has_null |= (count > 0); }
+
+    Status flush() override {
+        std::unique_ptr<BloomFilter> bf;
+        RETURN_IF_ERROR(BloomFilter::create(BLOCK_BLOOM_FILTER, &bf));
+        RETURN_IF_ERROR(bf->init(_gram_hashes.size(), _bf_options.fpp, _bf_options.strategy));
+        bf->set_has_null(_has_null);
+        for (uint64_t hash_code : _gram_hashes) {
+            bf->add_hash(hash_code);
+        }
+        _bf_buffer_size += bf->size();
+        _bfs.push_back(std::move(bf));
+        _gram_hashes.clear();
+        _has_null = false;
+        return Status::OK();
+    }
+
+    Status finish(WritableFile* wfile, ColumnIndexMetaPB* index_meta) override {
+        if (!_gram_hashes.empty()) {
+            RETURN_IF_ERROR(flush());
+        }
+        index_meta->set_type(NGRAM_BLOOM_FILTER_INDEX);
+        BloomFilterIndexPB* meta = index_meta->mutable_ngram_bloom_filter_index();
+        meta->set_hash_strategy(_bf_options.strategy);
+        meta->set_algorithm(BLOCK_BLOOM_FILTER);
+        meta->set_gram_size(_gram_size);
+        return write_bloom_filters(_bfs, wfile, meta);
+    }
+
+    uint64_t size() override { return _bf_buffer_size + _gram_hashes.size() * sizeof(uint64_t); }
+
+private:
+    BloomFilterOptions _bf_options;
+    const uint32_t _gram_size;
+    bool _has_null = false;
+    uint64_t _bf_buffer_size = 0;
+    // the hashes of the distinct grams of the current page
+    phmap::flat_hash_set<uint64_t> _gram_hashes;
+    std::vector<std::unique_ptr<BloomFilter>> _bfs;
+};
+
 } // namespace
 
 struct BloomFilterBuilderFunctor {
@@ -187,4 +254,13 @@ Status BloomFilterIndexWriter::create(const BloomFilterOptions& bf_options, cons
     return field_type_dispatch_bloomfilter(typeinfo->type(), BloomFilterBuilderFunctor(), res, bf_options, typeinfo);
 }
 
+Status BloomFilterIndexWriter::create_ngram(const BloomFilterOptions& bf_options, uint32_t gram_size,
+                                            std::unique_ptr<BloomFilterIndexWriter>* res) {
+    if (gram_size == 0) {
+        return Status::InvalidArgument("the gram size of n-gram bloom filter must be positive");
+    }
+    *res = std::make_unique<NgramBloomFilterIndexWriter>(bf_options, gram_size);
+    return Status::OK();
+}
+
 } // namespace starrocks
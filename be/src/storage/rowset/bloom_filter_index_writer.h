@@ -41,6 +41,10 @@ public:
     static Status create(const BloomFilterOptions& bf_options, const TypeInfoPtr& typeinfo,
                          std::unique_ptr<BloomFilterIndexWriter>* res);
 
+    // Create the writer of the n-gram bloom filter of a CHAR/VARCHAR column, whose grams have |gram_size| bytes.
+    static Status create_ngram(const BloomFilterOptions& bf_options, uint32_t gram_size,
+                               std::unique_ptr<BloomFilterIndexWriter>* res);
+
     BloomFilterIndexWriter() = default;
     virtual ~BloomFilterIndexWriter() = default;
 
@@ -0,0 +1,115 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "storage/rowset/cached_column_iterator.h"
+
+#include <algorithm>
+
+#include <fmt/format.h>
+
+#include "column/column.h"
+#include "storage/decoded_column_cache.h"
+#include "storage/range.h"
+
+namespace starrocks {
+
+CachedColumnIterator::CachedColumnIterator(ColumnIterator* iter, std::string cache_key, vectorized::ColumnPtr column,
+                                           size_t num_rows)
+        : _iter(iter), _cache_key(std::move(cache_key)), _column(std::move(column)), _num_rows(num_rows) {}
+
+Status CachedColumnIterator::init(const ColumnIteratorOptions& opts) {
+    _opts = opts;
+    return Status::OK();
+}
+
+Status CachedColumnIterator::seek_to_first() {
+    _current_ordinal = 0;
+    return Status::OK();
+}
+
+Status CachedColumnIterator::seek_to_ordinal(ordinal_t ord) {
+    if (ord > _num_rows) {
+        return Status::NotFound("seek to an ordinal out of the segment");
+    }
+    _current_ordinal = ord;
+    return Status::OK();
+}
+
+Status CachedColumnIterator::_load() {
+    if (_loaded) {
+        return Status::OK();
+    }
+    auto* cache = DecodedColumnCache::instance();
+    if (auto column = cache->lookup(_cache_key); column != nullptr) {
+        DCHECK_EQ(_num_rows, column->size());
+        _column = std::move(column);
+    } else {
+        RETURN_IF_ERROR(_iter->seek_to_first());
+        size_t n = _num_rows;
+        RETURN_IF_ERROR(_iter->next_batch(&n, _column.get()));
+        if (n != _num_rows) {
+            return Status::Corruption(fmt::format("read {} rows of a column of {} rows", n, _num_rows));
+        }
+        _column->set_delete_state(DEL_NOT_SATISFIED);
+        cache->insert(_cache_key, _column);
+    }
+    _loaded = true;
+    return Status::OK();
+}
+
+void CachedColumnIterator::_set_delete_state(vectorized::Column* dst) const {
+    if (_has_del_predicate) {
+        dst->set_delete_state(DEL_PARTIAL_SATISFIED);
+    }
+}
+
+Status CachedColumnIterator::next_batch(size_t* n, ColumnBlockView* dst, bool* has_null) {
+    // The row block is only read by the non-vectorized engine, which isn't worth caching.
+    RETURN_IF_ERROR(_iter->seek_to_ordinal(_current_ordinal));
+    RETURN_IF_ERROR(_iter->next_batch(n, dst, has_null));
+    _current_ordinal += *n;
+    return Status::OK();
+}
+
+Status CachedColumnIterator::next_batch(size_t* n, vectorized::Column* dst) {
+    RETURN_IF_ERROR(_load());
+    *n = std::min<size_t>(*n, _num_rows - _current_ordinal);
+    dst->append(*_column, _current_ordinal, *n);
+    _current_ordinal += *n;
+    _set_delete_state(dst);
+    return Status::OK();
+}
+
+Status CachedColumnIterator::next_batch(const vectorized::SparseRange& range, vectorized::Column* dst) {
+    RETURN_IF_ERROR(_load());
+    for (size_t i = 0; i < range.size(); i++) {
+        const vectorized::Range& r = range[i];
+        if (r.end() > _num_rows) {
+            return Status::InternalError("read a range out of the segment");
+        }
+        dst->append(*_column, r.begin(), r.span_size());
+        _current_ordinal = r.end();
+    }
+    _set_delete_state(dst);
+    return Status::OK();
+}
+
+Status CachedColumnIterator::get_row_ranges_by_zone_map(
+        const std::vector<const vectorized::ColumnPredicate*>& predicates,
+        const vectorized::ColumnPredicate* del_predicate, vectorized::SparseRange* row_ranges) {
+    _has_del_predicate |= del_predicate != nullptr;
+    return _iter->get_row_ranges_by_zone_map(predicates, del_predicate, row_ranges);
+}
+
+Status CachedColumnIterator::get_row_ranges_by_bloom_filter(
+        const std::vector<const vectorized::ColumnPredicate*>& predicates, vectorized::SparseRange* row_ranges) {
+    return _iter->get_row_ranges_by_bloom_filter(predicates, row_ranges);
+}
+
+Status CachedColumnIterator::fetch_values_by_rowid(const rowid_t* rowids, size_t size, vectorized::Column* values) {
+    RETURN_IF_ERROR(_load());
+    DCHECK(size == 0 || rowids[size - 1] < _num_rows);
+    values->append_selective(*_column, rowids, 0, size);
+    return Status::OK();
+}
+
+} // namespace starrocks
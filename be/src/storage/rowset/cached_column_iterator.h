@@ -0,0 +1,63 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <string>
+
+#include "column/vectorized_fwd.h"
+#include "storage/rowset/column_iterator.h"
+
+namespace starrocks {
+
+// CachedColumnIterator reads all the rows of a column of a small segment from DecodedColumnCache, and copies the
+// read rows from the cached column instead of decoding the pages. On a cache miss, the column is read by the wrapped
+// iterator at the first read, and inserted into the cache.
+// The index lookups, e.g. the zone map, are still done by the wrapped iterator.
+class CachedColumnIterator final : public ColumnIterator {
+public:
+    // |iter| must have been initialized and is not owned by this iterator. |column| is the empty column which the
+    // rows are read into on a cache miss.
+    CachedColumnIterator(ColumnIterator* iter, std::string cache_key, vectorized::ColumnPtr column, size_t num_rows);
+
+    ~CachedColumnIterator() override = default;
+
+    Status init(const ColumnIteratorOptions& opts) override;
+
+    Status seek_to_first() override;
+
+    Status seek_to_ordinal(ordinal_t ord) override;
+
+    Status next_batch(size_t* n, ColumnBlockView* dst, bool* has_null) override;
+
+    Status next_batch(size_t* n, vectorized::Column* dst) override;
+
+    Status next_batch(const vectorized::SparseRange& range, vectorized::Column* dst) override;
+
+    ordinal_t get_current_ordinal() const override { return _current_ordinal; }
+
+    Status get_row_ranges_by_zone_map(const std::vector<const vectorized::ColumnPredicate*>& predicates,
+                                      const vectorized::ColumnPredicate* del_predicate,
+                                      vectorized::SparseRange* row_ranges) override;
+
+    Status get_row_ranges_by_bloom_filter(const std::vector<const vectorized::ColumnPredicate*>& predicates,
+                                          vectorized::SparseRange* row_ranges) override;
+
+    Status fetch_values_by_rowid(const rowid_t* rowids, size_t size, vectorized::Column* values) override;
+
+private:
+    Status _load();
+
+    // Set the delete state of |dst|, which is only known by the pages, so the rows are always assumed to be deleted
+    // partially if there is a delete predicate.
+    void _set_delete_state(vectorized::Column* dst) const;
+
+    ColumnIterator* _iter;
+    std::string _cache_key;
+    vectorized::ColumnPtr _column;
+    size_t _num_rows;
+    bool _loaded = false;
+    bool _has_del_predicate = false;
+    ordinal_t _current_ordinal = 0;
+};
+
+} // namespace starrocks
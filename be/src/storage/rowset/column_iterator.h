@@ -34,20 +34,28 @@ namespace vectorized {
 class Column;
 class ColumnPredicate;
 class SparseRange;
+class ZoneMapDetail;
 } // namespace vectorized
 
 class ColumnReader;
+class PagePointer;
 class RandomAccessFile;
+class SegmentReadBuffer;
 
 struct ColumnIteratorOptions {
     RandomAccessFile* read_file = nullptr;
     // reader statistics
     OlapReaderStatistics* stats = nullptr;
     bool use_page_cache = false;
+    // whether to insert the pages not found in the page cache into it.
+    bool fill_page_cache = true;
 
     // check whether column pages are all dictionary encoding.
     bool check_dict_encoding = false;
 
+    // the buffer of the pages coalesced by SegmentIterator, may be null.
+    const SegmentReadBuffer* read_buffer = nullptr;
+
     void sanity_check() const {
         CHECK_NOTNULL(read_file);
         CHECK_NOTNULL(stats);
@@ -109,6 +117,14 @@ public:
         return Status::OK();
     }
 
+    // See ColumnReader::zone_map_classify.
+    virtual Status classify_pages_by_zone_map(const std::vector<const vectorized::ColumnPredicate*>& predicates,
+                                              vectorized::SparseRange* full_ranges,
+                                              vectorized::SparseRange* partial_ranges,
+                                              vectorized::ZoneMapDetail* full_zone_map) {
+        return Status::NotSupported("classify pages by zone map");
+    }
+
     // return true iff all data pages of this column are encoded as dictionary encoding.
     // NOTE: the ColumnIterator must have been initialized with `check_dict_encoding`,
     // otherwise this method will always return false.
@@ -174,6 +190,10 @@ public:
 
     Status fetch_dict_codes_by_rowid(const vectorized::Column& rowids, vectorized::Column* values);
 
+    // Append the pointers of the data pages which will be read from the file by `next_batch(range, ...)` to |pages|,
+    // so that the reads of several columns can be coalesced. The pages which have been loaded may be skipped.
+    virtual void collect_data_pages(const vectorized::SparseRange& range, std::vector<PagePointer>* pages) {}
+
 protected:
     ColumnIteratorOptions _opts;
 };
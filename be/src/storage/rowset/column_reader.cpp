@@ -30,12 +30,14 @@
 #include "column/column_helper.h"
 #include "column/datum_convert.h"
 #include "common/logging.h"
+#include "storage/chunk_helper.h"
 #include "storage/rowset/array_column_iterator.h"
 #include "storage/rowset/binary_dict_page.h" // for BinaryDictPageDecoder
 #include "storage/rowset/bitmap_index_reader.h"
 #include "storage/rowset/bloom_filter.h"
 #include "storage/rowset/bloom_filter_index_reader.h"
 #include "storage/rowset/encoding_info.h"
+#include "storage/rowset/inverted_index_reader.h"
 #include "storage/rowset/page_handle.h" // for PageHandle
 #include "storage/rowset/page_io.h"
 #include "storage/rowset/page_pointer.h" // for PagePointer
@@ -67,6 +69,12 @@ ColumnReader::~ColumnReader() {
         size += _segment_zone_map->SpaceUsedLong();
         _segment_zone_map.reset(nullptr);
     }
+    if (_segment_zone_map_detail != nullptr) {
+        size += sizeof(vectorized::ZoneMapDetail);
+        _segment_zone_map_detail.reset(nullptr);
+    }
+    size += _page_zone_map_details.capacity() * sizeof(vectorized::ZoneMapDetail);
+    size += _block_zone_map_details.capacity() * sizeof(vectorized::ZoneMapDetail);
     if (_ordinal_index_meta != nullptr) {
         size += _ordinal_index_meta->SpaceUsedLong();
         _ordinal_index_meta.reset(nullptr);
@@ -91,6 +99,14 @@ ColumnReader::~ColumnReader() {
         size += _bitmap_index->mem_usage();
         _bitmap_index.reset(nullptr);
     }
+    if (_inverted_index_meta != nullptr) {
+        size += _inverted_index_meta->SpaceUsedLong();
+        _inverted_index_meta.reset(nullptr);
+    }
+    if (_inverted_index != nullptr) {
+        size += _inverted_index->mem_usage();
+        _inverted_index.reset(nullptr);
+    }
     if (_bloom_filter_index_meta != nullptr) {
         size += _bloom_filter_index_meta->SpaceUsedLong();
         _bloom_filter_index_meta.reset(nullptr);
@@ -99,6 +115,14 @@ ColumnReader::~ColumnReader() {
         size += _bloom_filter_index->mem_usage();
         _bloom_filter_index.reset(nullptr);
     }
+    if (_ngram_bloom_filter_index_meta != nullptr) {
+        size += _ngram_bloom_filter_index_meta->SpaceUsedLong();
+        _ngram_bloom_filter_index_meta.reset(nullptr);
+    }
+    if (_ngram_bloom_filter_index != nullptr) {
+        size += _ngram_bloom_filter_index->mem_usage();
+        _ngram_bloom_filter_index.reset(nullptr);
+    }
     mem_tracker()->release(size);
 }
 
@@ -145,6 +169,17 @@ Status ColumnReader::_init(ColumnMetaPB* meta) {
                 _bloom_filter_index = std::make_unique<BloomFilterIndexReader>();
                 mem_tracker()->consume(_bloom_filter_index_meta->SpaceUsedLong());
                 break;
+            case NGRAM_BLOOM_FILTER_INDEX:
+                _ngram_bloom_filter_index_meta.reset(index_meta->release_ngram_bloom_filter_index());
+                _ngram_bloom_filter_index = std::make_unique<BloomFilterIndexReader>();
+                _ngram_size = _ngram_bloom_filter_index_meta->gram_size();
+                mem_tracker()->consume(_ngram_bloom_filter_index_meta->SpaceUsedLong());
+                break;
+            case INVERTED_INDEX:
+                _inverted_index_meta.reset(index_meta->release_inverted_index());
+                _inverted_index = std::make_unique<BitmapIndexReader>();
+                mem_tracker()->consume(_inverted_index_meta->SpaceUsedLong());
+                break;
             case UNKNOWN_INDEX_TYPE:
                 return Status::Corruption(fmt::format("Bad file {}: unknown index type", file_name()));
             }
@@ -153,6 +188,14 @@ Status ColumnReader::_init(ColumnMetaPB* meta) {
             return Status::Corruption(
                     fmt::format("Bad file {}: missing ordinal index for column {}", file_name(), meta->column_id()));
         }
+        if (_segment_zone_map != nullptr) {
+            auto detail = std::make_unique<vectorized::ZoneMapDetail>();
+            // a segment zone map which can not be parsed filters nothing.
+            if (_parse_zone_map(*_segment_zone_map, detail.get()).ok()) {
+                _segment_zone_map_detail = std::move(detail);
+                mem_tracker()->consume(sizeof(vectorized::ZoneMapDetail));
+            }
+        }
         return Status::OK();
     } else if (_column_type == FieldType::OLAP_FIELD_TYPE_ARRAY) {
         _sub_readers = std::make_unique<SubReaderList>();
@@ -204,18 +247,32 @@ Status ColumnReader::new_bitmap_index_iterator(BitmapIndexIterator** iterator) {
     return Status::OK();
 }
 
+Status ColumnReader::new_inverted_index_iterator(InvertedIndexIterator** iterator) {
+    RETURN_IF_ERROR(_load_inverted_index());
+    BitmapIndexIterator* bitmap_iter = nullptr;
+    RETURN_IF_ERROR(_inverted_index->new_iterator(&bitmap_iter));
+    *iterator = new InvertedIndexIterator(bitmap_iter);
+    return Status::OK();
+}
+
 Status ColumnReader::read_page(const ColumnIteratorOptions& iter_opts, const PagePointer& pp, PageHandle* handle,
-                               Slice* page_body, PageFooterPB* footer) {
+                               Slice* page_body, PageFooterPB* footer, PageReadAheadBuffer* read_ahead,
+                               uint64_t read_ahead_size) {
     iter_opts.sanity_check();
     PageReadOptions opts;
     opts.read_file = iter_opts.read_file;
     opts.page_pointer = pp;
+    opts.file_id = file_id();
     opts.codec = _compress_codec;
     opts.stats = iter_opts.stats;
     opts.verify_checksum = true;
     opts.use_page_cache = iter_opts.use_page_cache;
+    opts.fill_page_cache = iter_opts.fill_page_cache;
     opts.encoding_type = _encoding_info->encoding();
     opts.kept_in_memory = keep_in_memory();
+    opts.read_ahead = read_ahead;
+    opts.read_ahead_size = read_ahead_size;
+    opts.read_buffer = iter_opts.read_buffer;
 
     return PageIO::read_and_decompress_page(opts, handle, page_body, footer);
 }
@@ -251,19 +308,8 @@ Status ColumnReader::bloom_filter(const std::vector<const vectorized::ColumnPred
     vectorized::SparseRange bf_row_ranges;
     std::unique_ptr<BloomFilterIndexIterator> bf_iter;
     RETURN_IF_ERROR(_bloom_filter_index->new_iterator(&bf_iter));
-    size_t range_size = row_ranges->size();
-    // get covered page ids
     std::set<int32_t> page_ids;
-    for (int i = 0; i < range_size; ++i) {
-        vectorized::Range r = (*row_ranges)[i];
-        int64_t idx = r.begin();
-        auto iter = _ordinal_index->seek_at_or_before(r.begin());
-        while (idx < r.end()) {
-            page_ids.insert(iter.page_index());
-            idx = static_cast<int>(iter.last_ordinal() + 1);
-            iter.next();
-        }
-    }
+    _get_page_ids(*row_ranges, &page_ids);
     for (const auto& pid : page_ids) {
         std::unique_ptr<BloomFilter> bf;
         RETURN_IF_ERROR(bf_iter->read_bloom_filter(pid, &bf));
@@ -278,6 +324,46 @@ Status ColumnReader::bloom_filter(const std::vector<const vectorized::ColumnPred
     return Status::OK();
 }
 
+Status ColumnReader::ngram_bloom_filter(const std::vector<const vectorized::ColumnPredicate*>& predicates,
+                                        vectorized::SparseRange* row_ranges) {
+    RETURN_IF_ERROR(_load_ngram_bloom_filter_index());
+    vectorized::SparseRange bf_row_ranges;
+    std::unique_ptr<BloomFilterIndexIterator> bf_iter;
+    RETURN_IF_ERROR(_ngram_bloom_filter_index->new_iterator(&bf_iter));
+    std::set<int32_t> page_ids;
+    _get_page_ids(*row_ranges, &page_ids);
+    for (const auto& pid : page_ids) {
+        std::unique_ptr<BloomFilter> bf;
+        RETURN_IF_ERROR(bf_iter->read_bloom_filter(pid, &bf));
+        bool matched = true;
+        for (const auto* pred : predicates) {
+            if (pred->support_ngram_bloom_filter() && !pred->ngram_bloom_filter(bf.get(), _ngram_size)) {
+                matched = false;
+                break;
+            }
+        }
+        if (matched) {
+            bf_row_ranges.add(vectorized::Range(_ordinal_index->get_first_ordinal(pid),
+                                                _ordinal_index->get_last_ordinal(pid) + 1));
+        }
+    }
+    *row_ranges = row_ranges->intersection(bf_row_ranges);
+    return Status::OK();
+}
+
+void ColumnReader::_get_page_ids(const vectorized::SparseRange& row_ranges, std::set<int32_t>* page_ids) {
+    for (size_t i = 0; i < row_ranges.size(); ++i) {
+        vectorized::Range r = row_ranges[i];
+        int64_t idx = r.begin();
+        auto iter = _ordinal_index->seek_at_or_before(r.begin());
+        while (idx < r.end()) {
+            page_ids->insert(iter.page_index());
+            idx = static_cast<int>(iter.last_ordinal() + 1);
+            iter.next();
+        }
+    }
+}
+
 Status ColumnReader::load_ordinal_index() {
     return _load_ordinal_index();
 }
@@ -300,18 +386,34 @@ Status ColumnReader::_load_ordinal_index() {
 }
 
 Status ColumnReader::_load_zonemap_index() {
-    if (_zonemap_index == nullptr || _zonemap_index->loaded()) return Status::OK();
+    if (_zonemap_index == nullptr) return Status::OK();
     SCOPED_THREAD_LOCAL_CHECK_MEM_LIMIT_SETTER(false);
-    auto fs = file_system();
-    auto meta = _zonemap_index_meta.get();
-    auto use_page_cache = !config::disable_storage_page_cache;
-    auto kept_in_memory = keep_in_memory();
-    ASSIGN_OR_RETURN(auto first_load, _zonemap_index->load(fs, file_name(), *meta, use_page_cache, kept_in_memory));
-    if (UNLIKELY(first_load)) {
-        mem_tracker()->consume(_zonemap_index->mem_usage());
-        mem_tracker()->release(_zonemap_index_meta->SpaceUsedLong());
-        _zonemap_index_meta.reset();
+    if (!_zonemap_index->loaded()) {
+        auto fs = file_system();
+        auto meta = _zonemap_index_meta.get();
+        auto use_page_cache = !config::disable_storage_page_cache;
+        auto kept_in_memory = keep_in_memory();
+        ASSIGN_OR_RETURN(auto first_load,
+                         _zonemap_index->load(fs, file_name(), *meta, use_page_cache, kept_in_memory));
+        if (UNLIKELY(first_load)) {
+            mem_tracker()->consume(_zonemap_index->mem_usage());
+            mem_tracker()->release(_zonemap_index_meta->SpaceUsedLong());
+            _zonemap_index_meta.reset();
+        }
+    }
+    return _parse_zone_maps_once.call([this] {
+        RETURN_IF_ERROR(_parse_zone_maps(_zonemap_index->page_zone_maps(), &_page_zone_map_details));
+        return _parse_zone_maps(_zonemap_index->block_zone_maps(), &_block_zone_map_details);
+    });
+}
+
+Status ColumnReader::_parse_zone_maps(const std::vector<ZoneMapPB>& zone_maps,
+                                      std::vector<vectorized::ZoneMapDetail>* details) {
+    details->resize(zone_maps.size());
+    for (size_t i = 0; i < zone_maps.size(); i++) {
+        RETURN_IF_ERROR(_parse_zone_map(zone_maps[i], &(*details)[i]));
     }
+    mem_tracker()->consume(details->capacity() * sizeof(vectorized::ZoneMapDetail));
     return Status::OK();
 }
 
@@ -331,6 +433,22 @@ Status ColumnReader::_load_bitmap_index() {
     return Status::OK();
 }
 
+Status ColumnReader::_load_inverted_index() {
+    if (_inverted_index == nullptr || _inverted_index->loaded()) return Status::OK();
+    SCOPED_THREAD_LOCAL_CHECK_MEM_LIMIT_SETTER(false);
+    auto fs = file_system();
+    auto meta = _inverted_index_meta.get();
+    auto use_page_cache = !config::disable_storage_page_cache;
+    auto kept_in_memory = keep_in_memory();
+    ASSIGN_OR_RETURN(auto first_load, _inverted_index->load(fs, file_name(), *meta, use_page_cache, kept_in_memory));
+    if (UNLIKELY(first_load)) {
+        mem_tracker()->consume(_inverted_index->mem_usage());
+        mem_tracker()->release(_inverted_index_meta->SpaceUsedLong());
+        _inverted_index_meta.reset();
+    }
+    return Status::OK();
+}
+
 Status ColumnReader::_load_bloom_filter_index() {
     if (_bloom_filter_index == nullptr || _bloom_filter_index->loaded()) return Status::OK();
     SCOPED_THREAD_LOCAL_CHECK_MEM_LIMIT_SETTER(false);
@@ -348,6 +466,23 @@ Status ColumnReader::_load_bloom_filter_index() {
     return Status::OK();
 }
 
+Status ColumnReader::_load_ngram_bloom_filter_index() {
+    if (_ngram_bloom_filter_index == nullptr || _ngram_bloom_filter_index->loaded()) return Status::OK();
+    SCOPED_THREAD_LOCAL_CHECK_MEM_LIMIT_SETTER(false);
+    auto fs = file_system();
+    auto meta = _ngram_bloom_filter_index_meta.get();
+    auto use_page_cache = !config::disable_storage_page_cache;
+    auto kept_in_memory = keep_in_memory();
+    ASSIGN_OR_RETURN(auto first_load,
+                     _ngram_bloom_filter_index->load(fs, file_name(), *meta, use_page_cache, kept_in_memory));
+    if (UNLIKELY(first_load)) {
+        mem_tracker()->consume(_ngram_bloom_filter_index->mem_usage());
+        mem_tracker()->release(_ngram_bloom_filter_index_meta->SpaceUsedLong());
+        _ngram_bloom_filter_index_meta.reset();
+    }
+    return Status::OK();
+}
+
 Status ColumnReader::seek_to_first(OrdinalPageIndexIterator* iter) {
     *iter = _ordinal_index->begin();
     if (!iter->valid()) {
@@ -371,7 +506,30 @@ Status ColumnReader::zone_map_filter(const std::vector<const vectorized::ColumnP
     RETURN_IF_ERROR(_load_zonemap_index());
     std::vector<uint32_t> page_indexes;
     RETURN_IF_ERROR(_zone_map_filter(predicates, del_predicate, del_partial_filtered_pages, &page_indexes));
-    RETURN_IF_ERROR(_calculate_row_ranges(page_indexes, row_ranges));
+    if (_zonemap_index->block_num_rows() == 0 || predicates.empty()) {
+        return _calculate_row_ranges(page_indexes, row_ranges);
+    }
+    vectorized::SparseRange page_row_ranges;
+    vectorized::SparseRange block_row_ranges;
+    RETURN_IF_ERROR(_calculate_row_ranges(page_indexes, &page_row_ranges));
+    RETURN_IF_ERROR(_block_zone_map_filter(predicates, &block_row_ranges));
+    *row_ranges |= page_row_ranges & block_row_ranges;
+    return Status::OK();
+}
+
+Status ColumnReader::_block_zone_map_filter(const std::vector<const vectorized::ColumnPredicate*>& predicates,
+                                            vectorized::SparseRange* row_ranges) {
+    const uint64_t block_num_rows = _zonemap_index->block_num_rows();
+    const uint64_t total_rows = num_rows();
+    for (size_t i = 0; i < _block_zone_map_details.size(); ++i) {
+        const vectorized::ZoneMapDetail& detail = _block_zone_map_details[i];
+        auto filter = [&](const vectorized::ColumnPredicate* pred) { return pred->zone_map_filter(detail); };
+        if (std::all_of(predicates.begin(), predicates.end(), filter)) {
+            const uint64_t begin = i * block_num_rows;
+            const uint64_t end = std::min(begin + block_num_rows, total_rows);
+            row_ranges->add({static_cast<rowid_t>(begin), static_cast<rowid_t>(end)});
+        }
+    }
     return Status::OK();
 }
 
@@ -379,12 +537,9 @@ Status ColumnReader::_zone_map_filter(const std::vector<const vectorized::Column
                                       const vectorized::ColumnPredicate* del_predicate,
                                       std::unordered_set<uint32_t>* del_partial_filtered_pages,
                                       std::vector<uint32_t>* pages) {
-    const std::vector<ZoneMapPB>& zone_maps = _zonemap_index->page_zone_maps();
     int32_t page_size = _zonemap_index->num_pages();
     for (int32_t i = 0; i < page_size; ++i) {
-        const ZoneMapPB& zm = zone_maps[i];
-        vectorized::ZoneMapDetail detail;
-        _parse_zone_map(zm, &detail);
+        const vectorized::ZoneMapDetail& detail = _page_zone_map_details[i];
         bool matched = true;
         for (const auto* predicate : predicates) {
             if (!predicate->zone_map_filter(detail)) {
@@ -404,12 +559,75 @@ Status ColumnReader::_zone_map_filter(const std::vector<const vectorized::Column
     return Status::OK();
 }
 
+Status ColumnReader::zone_map_classify(const std::vector<const vectorized::ColumnPredicate*>& predicates,
+                                       vectorized::SparseRange* full_ranges, vectorized::SparseRange* partial_ranges,
+                                       vectorized::ZoneMapDetail* full_zone_map) {
+    RETURN_IF_ERROR(_load_zonemap_index());
+    RETURN_IF_ERROR(_load_ordinal_index());
+    // the string zone maps may be truncated, and the other predicates are not ranges of values.
+    auto is_range = [](const vectorized::ColumnPredicate* pred) {
+        switch (pred->type()) {
+        case vectorized::PredicateType::kEQ:
+        case vectorized::PredicateType::kGT:
+        case vectorized::PredicateType::kGE:
+        case vectorized::PredicateType::kLT:
+        case vectorized::PredicateType::kLE:
+        case vectorized::PredicateType::kNotNull:
+            return true;
+        default:
+            return false;
+        }
+    };
+    const bool may_be_full = _column_type != OLAP_FIELD_TYPE_CHAR && _column_type != OLAP_FIELD_TYPE_VARCHAR &&
+                             std::all_of(predicates.begin(), predicates.end(), is_range);
+    TypeInfoPtr type_info = get_type_info(delegate_type(_column_type));
+    ColumnPtr bounds = ChunkHelper::column_from_field_type(_column_type, false);
+    std::vector<uint8_t> selection(2);
+    std::vector<uint32_t> full_pages;
+    std::vector<uint32_t> partial_pages;
+
+    for (int32_t i = 0; i < _zonemap_index->num_pages(); ++i) {
+        const vectorized::ZoneMapDetail& detail = _page_zone_map_details[i];
+        auto filter = [&](const vectorized::ColumnPredicate* pred) { return pred->zone_map_filter(detail); };
+        if (!std::all_of(predicates.begin(), predicates.end(), filter)) {
+            continue;
+        }
+        bool full = may_be_full && !detail.has_null() && detail.has_not_null();
+        if (full) {
+            // all the values of the page are in the range if both its min and max are.
+            bounds->reset_column();
+            bounds->append_datum(detail.min_value());
+            bounds->append_datum(detail.max_value());
+            for (size_t p = 0; full && p < predicates.size(); p++) {
+                RETURN_IF_ERROR(predicates[p]->evaluate(bounds.get(), selection.data(), 0, 2));
+                full = selection[0] && selection[1];
+            }
+        }
+        if (!full) {
+            partial_pages.emplace_back(i);
+            continue;
+        }
+        full_pages.emplace_back(i);
+        if (full_pages.size() == 1) {
+            *full_zone_map = detail;
+            continue;
+        }
+        if (type_info->cmp(detail.min_value(), full_zone_map->min_value()) < 0) {
+            full_zone_map->min_value() = detail.min_value();
+        }
+        if (type_info->cmp(detail.max_value(), full_zone_map->max_value()) > 0) {
+            full_zone_map->max_value() = detail.max_value();
+        }
+    }
+    RETURN_IF_ERROR(_calculate_row_ranges(full_pages, full_ranges));
+    return _calculate_row_ranges(partial_pages, partial_ranges);
+}
+
 bool ColumnReader::segment_zone_map_filter(const std::vector<const vectorized::ColumnPredicate*>& predicates) const {
-    if (_segment_zone_map == nullptr) {
+    if (_segment_zone_map_detail == nullptr) {
         return true;
     }
-    vectorized::ZoneMapDetail detail;
-    _parse_zone_map(*_segment_zone_map, &detail);
+    const vectorized::ZoneMapDetail& detail = *_segment_zone_map_detail;
     auto filter = [&](const vectorized::ColumnPredicate* pred) { return pred->zone_map_filter(detail); };
     return std::all_of(predicates.begin(), predicates.end(), filter);
 }
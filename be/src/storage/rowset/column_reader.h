@@ -26,6 +26,7 @@
 #include <cstddef> // for size_t
 #include <cstdint> // for uint32_t
 #include <memory>  // for unique_ptr
+#include <set>
 #include <utility>
 
 #include "column/datum.h"
@@ -42,6 +43,7 @@
 #include "storage/rowset/page_handle.h"
 #include "storage/rowset/segment.h"
 #include "storage/rowset/zone_map_index.h"
+#include "storage/zone_map_detail.h"
 #include "util/once.h"
 
 namespace starrocks {
@@ -64,9 +66,11 @@ class BitmapIndexReader;
 class ColumnIterator;
 class ColumnIteratorOptions;
 class EncodingInfo;
+class InvertedIndexIterator;
 class PageDecoder;
 class PagePointer;
 class ParsedPage;
+struct PageReadAheadBuffer;
 class ZoneMapIndexPB;
 class ZoneMapPB;
 class Segment;
@@ -98,13 +102,18 @@ public:
     // TODO: StatusOr<std::unique_ptr<ColumnIterator>> new_bitmap_index_iterator()
     Status new_bitmap_index_iterator(BitmapIndexIterator** iterator);
 
+    // Caller should free returned iterator after unused.
+    Status new_inverted_index_iterator(InvertedIndexIterator** iterator);
+
     // Seek to the first entry in the column.
     Status seek_to_first(OrdinalPageIndexIterator* iter);
     Status seek_at_or_before(ordinal_t ordinal, OrdinalPageIndexIterator* iter);
 
-    // read a page from file into a page handle
+    // read a page from file into a page handle.
+    // if |read_ahead| is not null, see PageReadOptions::read_ahead.
     Status read_page(const ColumnIteratorOptions& iter_opts, const PagePointer& pp, PageHandle* handle,
-                     Slice* page_body, PageFooterPB* footer);
+                     Slice* page_body, PageFooterPB* footer, PageReadAheadBuffer* read_ahead = nullptr,
+                     uint64_t read_ahead_size = 0);
 
     bool is_nullable() const { return _flags & kIsNullableMask; }
 
@@ -112,7 +121,9 @@ public:
 
     bool has_zone_map() const { return _zonemap_index != nullptr; }
     bool has_bitmap_index() const { return _bitmap_index != nullptr; }
+    bool has_inverted_index() const { return _inverted_index != nullptr; }
     bool has_bloom_filter_index() const { return _bloom_filter_index != nullptr; }
+    bool has_ngram_bloom_filter_index() const { return _ngram_bloom_filter_index != nullptr; }
 
     ZoneMapPB* segment_zone_map() const { return _segment_zone_map.get(); }
 
@@ -140,10 +151,24 @@ public:
     // same as `match_condition`, used by vector engine.
     bool segment_zone_map_filter(const std::vector<const ::starrocks::vectorized::ColumnPredicate*>& predicates) const;
 
+    // Classify the data pages by their zone maps for the aggregations answered without reading all the data. The rows
+    // of the pages whose values all satisfy |predicates| are added to |full_ranges|, and those of the other pages
+    // which may have some satisfying values are added to |partial_ranges|. |full_zone_map| is set to the merged
+    // zone map of the pages in |full_ranges|.
+    // A page can be full only if it has no null and |predicates| are all comparisons of non-string values.
+    Status zone_map_classify(const std::vector<const ::starrocks::vectorized::ColumnPredicate*>& predicates,
+                             vectorized::SparseRange* full_ranges, vectorized::SparseRange* partial_ranges,
+                             vectorized::ZoneMapDetail* full_zone_map);
+
     // prerequisite: at least one predicate in |predicates| support bloom filter.
     Status bloom_filter(const std::vector<const ::starrocks::vectorized::ColumnPredicate*>& p,
                         vectorized::SparseRange* ranges);
 
+    // Filter the pages by the n-gram bloom filters, only the pages matching all the supported predicates are kept.
+    // prerequisite: at least one predicate in |predicates| support n-gram bloom filter.
+    Status ngram_bloom_filter(const std::vector<const ::starrocks::vectorized::ColumnPredicate*>& p,
+                              vectorized::SparseRange* ranges);
+
     Status load_ordinal_index();
 
     uint32_t num_rows() const { return _segment->num_rows(); }
@@ -154,6 +179,8 @@ public:
 private:
     const std::string& file_name() const { return _segment->file_name(); }
 
+    uint64_t file_id() const { return _segment->file_id(); }
+
     MemTracker* mem_tracker() const { return _segment->mem_tracker(); }
 
     FileSystem* file_system() const { return _segment->file_system(); }
@@ -180,16 +207,28 @@ private:
     Status _load_zonemap_index();
     Status _load_ordinal_index();
     Status _load_bitmap_index();
+    Status _load_inverted_index();
     Status _load_bloom_filter_index();
+    Status _load_ngram_bloom_filter_index();
+
+    // Get the ids of the pages covering |row_ranges|.
+    void _get_page_ids(const vectorized::SparseRange& row_ranges, std::set<int32_t>* page_ids);
 
     Status _parse_zone_map(const ZoneMapPB& zm, vectorized::ZoneMapDetail* detail) const;
 
+    // Parse the page and block zone maps once, so the filters do not decode the protobufs for each query.
+    Status _parse_zone_maps(const std::vector<ZoneMapPB>& zone_maps, std::vector<vectorized::ZoneMapDetail>* details);
+
     Status _calculate_row_ranges(const std::vector<uint32_t>& page_indexes, vectorized::SparseRange* row_ranges);
 
     Status _zone_map_filter(const std::vector<const vectorized::ColumnPredicate*>& predicates,
                             const vectorized::ColumnPredicate* del_predicate,
                             std::unordered_set<uint32_t>* del_partial_filtered_pages, std::vector<uint32_t>* pages);
 
+    // Add the rows of the blocks whose zone maps match |predicates| to |row_ranges|.
+    Status _block_zone_map_filter(const std::vector<const vectorized::ColumnPredicate*>& predicates,
+                                  vectorized::SparseRange* row_ranges);
+
     // ColumnReader will be resident in memory. When there are many columns in the table,
     // the meta in ColumnReader takes up a lot of memory,
     // and now the content that is not needed in Meta is not saved to ColumnReader
@@ -204,15 +243,27 @@ private:
     std::unique_ptr<ZoneMapIndexPB> _zonemap_index_meta;
     std::unique_ptr<OrdinalIndexPB> _ordinal_index_meta;
     std::unique_ptr<BitmapIndexPB> _bitmap_index_meta;
+    std::unique_ptr<BitmapIndexPB> _inverted_index_meta;
     std::unique_ptr<BloomFilterIndexPB> _bloom_filter_index_meta;
+    std::unique_ptr<BloomFilterIndexPB> _ngram_bloom_filter_index_meta;
 
     std::unique_ptr<ZoneMapIndexReader> _zonemap_index;
     std::unique_ptr<OrdinalIndexReader> _ordinal_index;
     std::unique_ptr<BitmapIndexReader> _bitmap_index;
+    // the inverted index has the layout of the bitmap index
+    std::unique_ptr<BitmapIndexReader> _inverted_index;
     std::unique_ptr<BloomFilterIndexReader> _bloom_filter_index;
+    std::unique_ptr<BloomFilterIndexReader> _ngram_bloom_filter_index;
+    uint32_t _ngram_size = 0;
 
     std::unique_ptr<ZoneMapPB> _segment_zone_map;
 
+    // The parsed zone maps, whose string values point into the protobufs above.
+    StarRocksCallOnce<Status> _parse_zone_maps_once;
+    std::vector<vectorized::ZoneMapDetail> _page_zone_map_details;
+    std::vector<vectorized::ZoneMapDetail> _block_zone_map_details;
+    std::unique_ptr<vectorized::ZoneMapDetail> _segment_zone_map_detail;
+
     using SubReaderList = std::vector<std::unique_ptr<ColumnReader>>;
     std::unique_ptr<SubReaderList> _sub_readers;
 
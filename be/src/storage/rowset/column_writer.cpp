@@ -38,6 +38,7 @@
 #include "storage/rowset/bloom_filter.h"
 #include "storage/rowset/bloom_filter_index_writer.h"
 #include "storage/rowset/encoding_info.h"
+#include "storage/rowset/inverted_index_writer.h"
 #include "storage/rowset/options.h"
 #include "storage/rowset/ordinal_page_index.h"
 #include "storage/rowset/page_builder.h"
@@ -202,7 +203,7 @@ public:
 
     ~StringColumnWriter() override = default;
 
-    Status init() override { return _scalar_column_writer->init(); };
+    Status init() override;
 
     Status append(const vectorized::Column& column) override;
 
@@ -233,6 +234,7 @@ public:
     Status write_ordinal_index() override { return _scalar_column_writer->write_ordinal_index(); };
     Status write_zone_map() override { return _scalar_column_writer->write_zone_map(); };
     Status write_bitmap_index() override { return _scalar_column_writer->write_bitmap_index(); };
+    Status write_inverted_index() override { return _scalar_column_writer->write_inverted_index(); };
     Status write_bloom_filter_index() override { return _scalar_column_writer->write_bloom_filter_index(); };
 
     ordinal_t get_next_rowid() const override { return _scalar_column_writer->get_next_rowid(); };
@@ -243,6 +245,7 @@ public:
 
 private:
     std::unique_ptr<ScalarColumnWriter> _scalar_column_writer;
+    EncodingTypePB _encoding_hint;
     bool _is_speculated = false;
     vectorized::ColumnPtr _buf_column = nullptr;
 };
@@ -368,17 +371,27 @@ Status ScalarColumnWriter::init() {
     }
     if (_opts.need_zone_map) {
         _has_index_builder = true;
-        _zone_map_index_builder = ZoneMapIndexWriter::create(get_field());
+        _zone_map_index_builder =
+                ZoneMapIndexWriter::create(get_field(), std::max<int32_t>(0, config::zone_map_block_rows));
     }
     if (_opts.need_bitmap_index) {
         _has_index_builder = true;
         RETURN_IF_ERROR(BitmapIndexWriter::create(get_field()->type_info(), &_bitmap_index_builder));
     }
+    if (_opts.need_inverted_index) {
+        _has_index_builder = true;
+        _inverted_index_builder = std::make_unique<InvertedIndexWriter>();
+    }
     if (_opts.need_bloom_filter) {
         _has_index_builder = true;
         RETURN_IF_ERROR(BloomFilterIndexWriter::create(BloomFilterOptions(), get_field()->type_info(),
                                                        &_bloom_filter_index_builder));
     }
+    if (_opts.ngram_bloom_filter_gram_size > 0) {
+        _has_index_builder = true;
+        RETURN_IF_ERROR(BloomFilterIndexWriter::create_ngram(BloomFilterOptions(), _opts.ngram_bloom_filter_gram_size,
+                                                             &_ngram_bloom_filter_index_builder));
+    }
     return Status::OK();
 }
 
@@ -399,14 +412,22 @@ uint64_t ScalarColumnWriter::estimate_buffer_size() {
     if (_bitmap_index_builder != nullptr) {
         size += _bitmap_index_builder->size();
     }
+    if (_inverted_index_builder != nullptr) {
+        size += _inverted_index_builder->size();
+    }
     if (_bloom_filter_index_builder != nullptr) {
         size += _bloom_filter_index_builder->size();
     }
+    if (_ngram_bloom_filter_index_builder != nullptr) {
+        size += _ngram_bloom_filter_index_builder->size();
+    }
     return size;
 }
 
 Status ScalarColumnWriter::finish() {
-    if (_encoding_info->encoding() == DICT_ENCODING && _opts.global_dict != nullptr) {
+    // the words of the pages encoded plainly after the dictionary got full are not in the dictionary.
+    if (_encoding_info->encoding() == DICT_ENCODING && _opts.global_dict != nullptr &&
+        _page_builder->all_dict_encoded()) {
         _is_global_dict_valid = _page_builder->is_valid_global_dict(_opts.global_dict);
     } else {
         _is_global_dict_valid = false;
@@ -493,9 +514,19 @@ Status ScalarColumnWriter::write_bitmap_index() {
     return Status::OK();
 }
 
+Status ScalarColumnWriter::write_inverted_index() {
+    if (_inverted_index_builder != nullptr) {
+        return _inverted_index_builder->finish(_wfile, _opts.meta->add_indexes());
+    }
+    return Status::OK();
+}
+
 Status ScalarColumnWriter::write_bloom_filter_index() {
     if (_bloom_filter_index_builder != nullptr) {
-        return _bloom_filter_index_builder->finish(_wfile, _opts.meta->add_indexes());
+        RETURN_IF_ERROR(_bloom_filter_index_builder->finish(_wfile, _opts.meta->add_indexes()));
+    }
+    if (_ngram_bloom_filter_index_builder != nullptr) {
+        RETURN_IF_ERROR(_ngram_bloom_filter_index_builder->finish(_wfile, _opts.meta->add_indexes()));
     }
     return Status::OK();
 }
@@ -521,6 +552,10 @@ Status ScalarColumnWriter::finish_current_page() {
         RETURN_IF_ERROR(_bloom_filter_index_builder->flush());
     }
 
+    if (_ngram_bloom_filter_index_builder != nullptr) {
+        RETURN_IF_ERROR(_ngram_bloom_filter_index_builder->flush());
+    }
+
     // build data page body : encoded values + [nullmap]
     std::vector<Slice> body;
     faststring* encoded_values = _page_builder->finish();
@@ -731,18 +766,24 @@ Status ScalarColumnWriter::append(const uint8_t* data, const uint8_t* null_flags
                 if (is_null) {
                     INDEX_ADD_NULLS(_zone_map_index_builder, run);
                     INDEX_ADD_NULLS(_bitmap_index_builder, run);
+                    INDEX_ADD_NULLS(_inverted_index_builder, run);
                     INDEX_ADD_NULLS(_bloom_filter_index_builder, run);
+                    INDEX_ADD_NULLS(_ngram_bloom_filter_index_builder, run);
                 } else {
                     INDEX_ADD_VALUES(_zone_map_index_builder, pdata, run);
                     INDEX_ADD_VALUES(_bitmap_index_builder, pdata, run);
+                    INDEX_ADD_VALUES(_inverted_index_builder, pdata, run);
                     INDEX_ADD_VALUES(_bloom_filter_index_builder, pdata, run);
+                    INDEX_ADD_VALUES(_ngram_bloom_filter_index_builder, pdata, run);
                 }
                 pdata += get_field()->size() * run;
             }
         } else {
             INDEX_ADD_VALUES(_zone_map_index_builder, data, num_written);
             INDEX_ADD_VALUES(_bitmap_index_builder, data, num_written);
+            INDEX_ADD_VALUES(_inverted_index_builder, data, num_written);
             INDEX_ADD_VALUES(_bloom_filter_index_builder, data, num_written);
+            INDEX_ADD_VALUES(_ngram_bloom_filter_index_builder, data, num_written);
         }
 
         _next_rowid += num_written;
@@ -893,7 +934,18 @@ Status ArrayColumnWriter::finish_current_page() {
 
 StringColumnWriter::StringColumnWriter(const ColumnWriterOptions& opts, std::unique_ptr<Field> field,
                                        std::unique_ptr<ScalarColumnWriter> column_writer)
-        : ColumnWriter(std::move(field), opts.meta->is_nullable()), _scalar_column_writer(std::move(column_writer)) {}
+        : ColumnWriter(std::move(field), opts.meta->is_nullable()),
+          _scalar_column_writer(std::move(column_writer)),
+          _encoding_hint(opts.encoding_hint) {}
+
+Status StringColumnWriter::init() {
+    RETURN_IF_ERROR(_scalar_column_writer->init());
+    if (_encoding_hint != DEFAULT_ENCODING) {
+        RETURN_IF_ERROR(_scalar_column_writer->set_encoding(_encoding_hint));
+        _is_speculated = true;
+    }
+    return Status::OK();
+}
 
 Status StringColumnWriter::append(const vectorized::Column& column) {
     if (_is_speculated) {
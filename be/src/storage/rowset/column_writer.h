@@ -57,11 +57,16 @@ struct ColumnWriterOptions {
     double compression_min_space_saving = 0.1;
     bool need_zone_map = false;
     bool need_bitmap_index = false;
+    bool need_inverted_index = false;
     bool need_bloom_filter = false;
+    // the gram size of the n-gram bloom filter, 0 means no n-gram bloom filter
+    uint32_t ngram_bloom_filter_gram_size = 0;
     bool adaptive_page_format = false;
     // for char/varchar will speculate encoding in append
     // for others will decide encoding in init method
     bool need_speculate_encoding = false;
+    // the encoding of char/varchar used without speculation, DEFAULT_ENCODING means speculating the encoding.
+    EncodingTypePB encoding_hint = DEFAULT_ENCODING;
 
     // when column data is encoding by dict
     // if global_dict is not nullptr, will checkout whether global_dict can cover all data
@@ -70,6 +75,7 @@ struct ColumnWriterOptions {
 
 class BitmapIndexWriter;
 class EncodingInfo;
+class InvertedIndexWriter;
 class NullMapRLEBuilder;
 class NullFlagsBuilder;
 class OrdinalIndexWriter;
@@ -109,6 +115,8 @@ public:
 
     virtual Status write_bitmap_index() = 0;
 
+    virtual Status write_inverted_index() = 0;
+
     virtual Status write_bloom_filter_index() = 0;
 
     virtual ordinal_t get_next_rowid() const = 0;
@@ -165,6 +173,7 @@ public:
     Status write_ordinal_index() override;
     Status write_zone_map() override;
     Status write_bitmap_index() override;
+    Status write_inverted_index() override;
     Status write_bloom_filter_index() override;
     ordinal_t get_next_rowid() const override { return _next_rowid; }
 
@@ -234,8 +243,10 @@ private:
     std::unique_ptr<OrdinalIndexWriter> _ordinal_index_builder;
     std::unique_ptr<ZoneMapIndexWriter> _zone_map_index_builder;
     std::unique_ptr<BitmapIndexWriter> _bitmap_index_builder;
+    std::unique_ptr<InvertedIndexWriter> _inverted_index_builder;
     std::unique_ptr<BloomFilterIndexWriter> _bloom_filter_index_builder;
-    // _zone_map_index_builder != NULL || _bitmap_index_builder != NULL || _bloom_filter_index_builder != NULL
+    std::unique_ptr<BloomFilterIndexWriter> _ngram_bloom_filter_index_builder;
+    // any of the index builders is not NULL
     bool _has_index_builder = false;
     int64_t _element_ordinal = 0;
     int64_t _previous_ordinal = 0;
@@ -271,6 +282,8 @@ public:
 
     Status write_bitmap_index() override { return Status::OK(); }
 
+    Status write_inverted_index() override { return Status::OK(); }
+
     Status write_bloom_filter_index() override { return Status::OK(); }
 
     ordinal_t get_next_rowid() const override { return _array_size_writer->get_next_rowid(); }
@@ -0,0 +1,36 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "storage/rowset/encoding_hints.h"
+
+#include "common/config.h"
+
+namespace starrocks {
+
+EncodingTypePB EncodingHints::get(uint32_t unique_id) {
+    std::lock_guard<std::mutex> l(_mutex);
+    auto iter = _hints.find(unique_id);
+    if (iter == _hints.end()) {
+        return DEFAULT_ENCODING;
+    }
+    if (iter->second.segments_left <= 0) {
+        _hints.erase(iter);
+        return DEFAULT_ENCODING;
+    }
+    iter->second.segments_left--;
+    return iter->second.encoding;
+}
+
+void EncodingHints::update(uint32_t unique_id, EncodingTypePB hint, EncodingTypePB encoding) {
+    if (hint == encoding) {
+        // keep counting down to the next speculation.
+        return;
+    }
+    std::lock_guard<std::mutex> l(_mutex);
+    if (config::dictionary_encoding_hint_segments <= 0) {
+        _hints.clear();
+        return;
+    }
+    _hints[unique_id] = Hint{encoding, config::dictionary_encoding_hint_segments};
+}
+
+} // namespace starrocks
@@ -0,0 +1,38 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <mutex>
+#include <unordered_map>
+
+#include "gen_cpp/segment.pb.h"
+
+namespace starrocks {
+
+// The encodings of the CHAR/VARCHAR columns of the segments loaded into a tablet, shared by the segment writers of
+// the tablet. A string column writer speculates the encoding by the cardinality of its first rows, and a dictionary
+// encoded column falls back to the plain encoding once its dictionary is full. The segments of a tablet usually get
+// the same outcome, so a column is encoded as the previous segment without speculating again, for
+// `dictionary_encoding_hint_segments` segments.
+class EncodingHints {
+public:
+    // Return the encoding for the next segment of the column of |unique_id|, or DEFAULT_ENCODING to speculate it.
+    EncodingTypePB get(uint32_t unique_id);
+
+    // Record the encoding by which all the pages of a segment of the column of |unique_id| were encoded,
+    // i.e. PLAIN_ENCODING if its dictionary got full.
+    // |hint| is the encoding returned by `get` for the segment.
+    void update(uint32_t unique_id, EncodingTypePB hint, EncodingTypePB encoding);
+
+private:
+    struct Hint {
+        EncodingTypePB encoding;
+        // the number of the segments to encode by |encoding| before speculating again.
+        int32_t segments_left;
+    };
+
+    std::mutex _mutex;
+    std::unordered_map<uint32_t, Hint> _hints;
+};
+
+} // namespace starrocks
@@ -30,6 +30,7 @@
 #include "storage/rowset/binary_prefix_page.h"
 #include "storage/rowset/bitshuffle_page.h"
 #include "storage/rowset/frame_of_reference_page.h"
+#include "storage/rowset/pfor_page.h"
 #include "storage/rowset/plain_page.h"
 #include "storage/rowset/rle_page.h"
 
@@ -130,6 +131,19 @@ struct TypeEncodingTraits<type, FOR_ENCODING, CppType,
     }
 };
 
+template <FieldType type, typename CppType>
+struct TypeEncodingTraits<type, PFOR_ENCODING, CppType,
+                          typename std::enable_if<std::is_integral<CppType>::value && sizeof(CppType) <= 8>::type> {
+    static Status create_page_builder(const PageBuilderOptions& opts, PageBuilder** builder) {
+        *builder = new PForPageBuilder<type>(opts);
+        return Status::OK();
+    }
+    static Status create_page_decoder(const Slice& data, const PageDecoderOptions& opts, PageDecoder** decoder) {
+        *decoder = new PForPageDecoder<type>(data, opts);
+        return Status::OK();
+    }
+};
+
 template <FieldType type>
 struct TypeEncodingTraits<type, PREFIX_ENCODING, Slice> {
     static Status create_page_builder(const PageBuilderOptions& opts, PageBuilder** builder) {
@@ -189,18 +203,22 @@ private:
 EncodingInfoResolver::EncodingInfoResolver() {
     _add_map<OLAP_FIELD_TYPE_TINYINT, BIT_SHUFFLE>();
     _add_map<OLAP_FIELD_TYPE_TINYINT, FOR_ENCODING, true>();
+    _add_map<OLAP_FIELD_TYPE_TINYINT, PFOR_ENCODING>();
     _add_map<OLAP_FIELD_TYPE_TINYINT, PLAIN_ENCODING>();
 
     _add_map<OLAP_FIELD_TYPE_SMALLINT, BIT_SHUFFLE>();
     _add_map<OLAP_FIELD_TYPE_SMALLINT, FOR_ENCODING, true>();
+    _add_map<OLAP_FIELD_TYPE_SMALLINT, PFOR_ENCODING>();
     _add_map<OLAP_FIELD_TYPE_SMALLINT, PLAIN_ENCODING>();
 
     _add_map<OLAP_FIELD_TYPE_INT, BIT_SHUFFLE>();
     _add_map<OLAP_FIELD_TYPE_INT, FOR_ENCODING, true>();
+    _add_map<OLAP_FIELD_TYPE_INT, PFOR_ENCODING>();
     _add_map<OLAP_FIELD_TYPE_INT, PLAIN_ENCODING>();
 
     _add_map<OLAP_FIELD_TYPE_BIGINT, BIT_SHUFFLE>();
     _add_map<OLAP_FIELD_TYPE_BIGINT, FOR_ENCODING, true>();
+    _add_map<OLAP_FIELD_TYPE_BIGINT, PFOR_ENCODING>();
     _add_map<OLAP_FIELD_TYPE_BIGINT, PLAIN_ENCODING>();
 
     _add_map<OLAP_FIELD_TYPE_LARGEINT, BIT_SHUFFLE>();
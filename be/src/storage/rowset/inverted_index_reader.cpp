@@ -0,0 +1,153 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "storage/rowset/inverted_index_reader.h"
+
+#include <algorithm>
+#include <string_view>
+
+#include "storage/rowset/inverted_index_tokenizer.h"
+
+namespace starrocks {
+
+static constexpr size_t kDictionaryBatchSize = 1024;
+
+bool InvertedIndexIterator::parse_like_pattern(const Slice& pattern, std::vector<InvertedIndexTerm>* terms,
+                                               bool* exact) {
+    const auto* data = reinterpret_cast<const uint8_t*>(pattern.data);
+    const size_t size = pattern.size;
+    if (std::find(data, data + size, '\\') != data + size) {
+        return false;
+    }
+    auto is_wildcard = [](uint8_t c) { return c == '%' || c == '_'; };
+
+    terms->clear();
+    size_t i = 0;
+    while (i < size) {
+        if (!is_token_char(data[i])) {
+            i++;
+            continue;
+        }
+        size_t begin = i;
+        while (i < size && is_token_char(data[i])) {
+            i++;
+        }
+        // The start and the end of a string, and the separators are all the boundaries of the tokens.
+        bool left_bounded = begin == 0 || !is_wildcard(data[begin - 1]);
+        bool right_bounded = i == size || !is_wildcard(data[i]);
+        InvertedIndexTerm::MatchType type;
+        if (left_bounded && right_bounded) {
+            type = InvertedIndexTerm::kEqual;
+        } else if (left_bounded) {
+            type = InvertedIndexTerm::kPrefix;
+        } else if (right_bounded) {
+            type = InvertedIndexTerm::kSuffix;
+        } else {
+            type = InvertedIndexTerm::kContains;
+        }
+        terms->emplace_back(std::string(pattern.data + begin, i - begin), type);
+    }
+    if (terms->empty()) {
+        return false;
+    }
+
+    size_t first = 0;
+    while (first < size && data[first] == '%') {
+        first++;
+    }
+    size_t last = size;
+    while (last > first && data[last - 1] == '%') {
+        last--;
+    }
+    *exact = terms->size() == 1 && first > 0 && last < size && last - first == (*terms)[0].token.size();
+    return true;
+}
+
+Status InvertedIndexIterator::read_like(const Slice& pattern, Roaring* rows, bool* exact) {
+    std::vector<InvertedIndexTerm> terms;
+    if (!parse_like_pattern(pattern, &terms, exact)) {
+        return Status::Cancelled("pattern without tokens");
+    }
+    for (size_t i = 0; i < terms.size(); i++) {
+        vectorized::SparseRange ordinals;
+        RETURN_IF_ERROR(_seek_term(terms[i], &ordinals));
+        Roaring term_rows;
+        RETURN_IF_ERROR(_iter->read_union_bitmap(ordinals, &term_rows));
+        if (i == 0) {
+            *rows = std::move(term_rows);
+        } else {
+            *rows &= term_rows;
+        }
+        if (rows->isEmpty()) {
+            break;
+        }
+    }
+    return Status::OK();
+}
+
+Status InvertedIndexIterator::_seek_term(const InvertedIndexTerm& term, vectorized::SparseRange* ordinals) {
+    const rowid_t num_tokens = _num_tokens();
+    if (num_tokens == 0) {
+        return Status::OK();
+    }
+    const std::string_view key(term.token);
+
+    rowid_t from = 0;
+    if (term.type == InvertedIndexTerm::kEqual || term.type == InvertedIndexTerm::kPrefix) {
+        Slice value(term.token);
+        bool exact_match;
+        Status st = _iter->seek_dictionary(&value, &exact_match);
+        if (st.is_not_found()) {
+            return Status::OK();
+        }
+        RETURN_IF_ERROR(st);
+        if (term.type == InvertedIndexTerm::kEqual) {
+            if (exact_match) {
+                ordinals->add(vectorized::Range(_iter->current_ordinal(), _iter->current_ordinal() + 1));
+            }
+            return Status::OK();
+        }
+        from = _iter->current_ordinal();
+    }
+
+    // Scan the dictionary from |from|, the tokens of a prefix are contiguous since they are sorted.
+    std::vector<std::string> tokens;
+    rowid_t run_begin = from;
+    rowid_t ordinal = from;
+    bool done = false;
+    while (ordinal < num_tokens && !done) {
+        size_t n = std::min<size_t>(kDictionaryBatchSize, num_tokens - ordinal);
+        RETURN_IF_ERROR(_iter->read_dictionary(ordinal, &n, &tokens));
+        if (n == 0) {
+            break;
+        }
+        for (size_t i = 0; i < n; i++, ordinal++) {
+            const std::string_view token(tokens[i]);
+            bool matched = false;
+            switch (term.type) {
+            case InvertedIndexTerm::kPrefix:
+                matched = token.substr(0, key.size()) == key;
+                done = !matched;
+                break;
+            case InvertedIndexTerm::kSuffix:
+                matched = token.size() >= key.size() && token.substr(token.size() - key.size()) == key;
+                break;
+            default:
+                matched = token.find(key) != std::string_view::npos;
+                break;
+            }
+            if (!matched) {
+                ordinals->add(vectorized::Range(run_begin, ordinal));
+                run_begin = ordinal + 1;
+            }
+            if (done) {
+                break;
+            }
+        }
+    }
+    if (!done) {
+        ordinals->add(vectorized::Range(run_begin, ordinal));
+    }
+    return Status::OK();
+}
+
+} // namespace starrocks
@@ -0,0 +1,64 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <memory>
+#include <roaring/roaring.hh>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "common/status.h"
+#include "storage/range.h"
+#include "storage/rowset/bitmap_index_reader.h"
+#include "util/slice.h"
+
+namespace starrocks {
+
+// A token which any string matching a LIKE pattern must have, see InvertedIndexIterator::parse_like_pattern.
+struct InvertedIndexTerm {
+    enum MatchType {
+        kEqual,   // the token itself
+        kPrefix,  // a token starting with it
+        kSuffix,  // a token ending with it
+        kContains // a token containing it
+    };
+
+    InvertedIndexTerm(std::string token_, MatchType type_) : token(std::move(token_)), type(type_) {}
+
+    bool operator==(const InvertedIndexTerm& rhs) const { return token == rhs.token && type == rhs.type; }
+
+    std::string token;
+    MatchType type;
+};
+
+// Iterator of the inverted index written by InvertedIndexWriter, which is loaded by BitmapIndexReader.
+class InvertedIndexIterator {
+public:
+    explicit InvertedIndexIterator(BitmapIndexIterator* iter) : _iter(iter) {}
+
+    // Split the LIKE |pattern| into the terms of its tokens, which all the matched strings must have.
+    // A token is bounded by the start or the end of the pattern, or a separator, but not by a wildcard. E.g.
+    // - "%GET /api/%" has the terms "GET" of kSuffix and "api" of kEqual;
+    // - "error%" has the term "error" of kPrefix.
+    // |exact| is set if a string matches the pattern iff it has the terms, which is only true for "%token%".
+    // Return false if there is no term, or the pattern has the escape character.
+    static bool parse_like_pattern(const Slice& pattern, std::vector<InvertedIndexTerm>* terms, bool* exact);
+
+    bool has_null_bitmap() const { return _iter->has_null_bitmap(); }
+
+    // Set |rows| to the rows which may match the LIKE |pattern|, and |exact| to whether they are exactly the matched
+    // rows. Return Cancelled if the pattern can't be evaluated by the index.
+    Status read_like(const Slice& pattern, Roaring* rows, bool* exact);
+
+private:
+    // Add the ordinals of the dictionary tokens matching |term| to |ordinals|.
+    Status _seek_term(const InvertedIndexTerm& term, vectorized::SparseRange* ordinals);
+
+    // The number of the tokens in the dictionary, excluding the null bitmap.
+    rowid_t _num_tokens() const { return _iter->bitmap_nums() - (_iter->has_null_bitmap() ? 1 : 0); }
+
+    std::unique_ptr<BitmapIndexIterator> _iter;
+};
+
+} // namespace starrocks
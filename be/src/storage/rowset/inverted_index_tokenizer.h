@@ -0,0 +1,37 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <cstdint>
+
+#include "util/slice.h"
+
+namespace starrocks {
+
+// The tokens of a string are its maximal runs of the token characters, which are the ASCII letters and digits and all
+// the non-ASCII bytes, so that a UTF-8 character is never split. The tokens are case-sensitive, like LIKE.
+// E.g. the tokens of "GET /api/v1?id=3" are "GET", "api", "v1", "id" and "3".
+inline bool is_token_char(uint8_t c) {
+    return c >= 0x80 || (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+}
+
+// Call |func| with each token of |value|.
+template <typename Func>
+inline void for_each_token(const Slice& value, Func&& func) {
+    const auto* data = reinterpret_cast<const uint8_t*>(value.data);
+    size_t i = 0;
+    while (i < value.size) {
+        while (i < value.size && !is_token_char(data[i])) {
+            i++;
+        }
+        size_t begin = i;
+        while (i < value.size && is_token_char(data[i])) {
+            i++;
+        }
+        if (i > begin) {
+            func(Slice(value.data + begin, i - begin));
+        }
+    }
+}
+
+} // namespace starrocks
@@ -0,0 +1,82 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "storage/rowset/inverted_index_writer.h"
+
+#include <string_view>
+#include <vector>
+
+#include "storage/rowset/bitmap_index_writer.h"
+#include "storage/rowset/encoding_info.h"
+#include "storage/rowset/indexed_column_writer.h"
+#include "storage/rowset/inverted_index_tokenizer.h"
+#include "storage/types.h"
+#include "util/slice.h"
+
+namespace starrocks {
+
+void InvertedIndexWriter::add_values(const void* values, size_t count) {
+    const auto* slices = reinterpret_cast<const Slice*>(values);
+    for (size_t i = 0; i < count; i++) {
+        for_each_token(slices[i], [this](const Slice& token) {
+            std::string_view key(token.data, token.size);
+            auto it = _mem_index.lower_bound(key);
+            if (it == _mem_index.end() || it->first != key) {
+                it = _mem_index.emplace_hint(it, std::string(key), Roaring());
+                _size += token.size + sizeof(Roaring);
+            }
+            // a token may occur more than once in a value
+            if (it->second.addChecked(_rid)) {
+                _size += sizeof(rowid_t);
+            }
+        });
+        _rid++;
+    }
+}
+
+void InvertedIndexWriter::add_nulls(uint32_t count) {
+    _null_bitmap.addRange(_rid, _rid + count);
+    _rid += count;
+}
+
+Status InvertedIndexWriter::finish(WritableFile* wfile, ColumnIndexMetaPB* index_meta) {
+    index_meta->set_type(INVERTED_INDEX);
+    BitmapIndexPB* meta = index_meta->mutable_inverted_index();
+
+    meta->set_bitmap_type(BitmapIndexPB::ROARING_BITMAP);
+    meta->set_has_null(!_null_bitmap.isEmpty());
+
+    { // write dictionary
+        TypeInfoPtr typeinfo = get_type_info(OLAP_FIELD_TYPE_VARCHAR);
+        IndexedColumnWriterOptions options;
+        options.write_ordinal_index = true;
+        options.write_value_index = true;
+        options.encoding = EncodingInfo::get_default_encoding(typeinfo->type(), true);
+        options.compression = CompressionTypePB::LZ4_FRAME;
+
+        IndexedColumnWriter dict_column_writer(options, typeinfo, wfile);
+        RETURN_IF_ERROR(dict_column_writer.init());
+        for (auto const& it : _mem_index) {
+            Slice token(it.first);
+            RETURN_IF_ERROR(dict_column_writer.add(&token));
+        }
+        RETURN_IF_ERROR(dict_column_writer.finish(meta->mutable_dict_column()));
+    }
+    { // write bitmaps
+        std::vector<Roaring*> bitmaps;
+        bitmaps.reserve(_mem_index.size() + 1);
+        for (auto& it : _mem_index) {
+            bitmaps.push_back(&it.second);
+        }
+        if (!_null_bitmap.isEmpty()) {
+            bitmaps.push_back(&_null_bitmap);
+        }
+        RETURN_IF_ERROR(BitmapIndexWriter::write_bitmaps(bitmaps, wfile, meta->mutable_bitmap_column()));
+    }
+    return Status::OK();
+}
+
+uint64_t InvertedIndexWriter::size() const {
+    return _size + _null_bitmap.getSizeInBytes(false);
+}
+
+} // namespace starrocks
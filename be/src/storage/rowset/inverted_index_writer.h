@@ -0,0 +1,51 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <map>
+#include <roaring/roaring.hh>
+#include <string>
+
+#include "common/status.h"
+#include "gen_cpp/segment.pb.h"
+#include "storage/rowset/common.h"
+
+namespace starrocks {
+
+class WritableFile;
+
+// Builder for the inverted index of a CHAR/VARCHAR column, which maps each token of the values to the rows having
+// it, see inverted_index_tokenizer.h.
+// The index has the layout of the bitmap index, whose ordered dictionary holds the distinct tokens instead of the
+// distinct values, so that it's loaded by BitmapIndexReader. Unlike the bitmap index, the dictionary also has an
+// ordinal index, since the tokens are scanned in order for the prefix, suffix and substring matches.
+//
+// E.g, if the column contains ["GET /a", "POST /a", "GET /b"], the dictionary would be ["GET", "POST", "a", "b"],
+// and the posting lists would be [0, 2], [1], [0, 1] and [2].
+class InvertedIndexWriter {
+public:
+    InvertedIndexWriter() = default;
+
+    // |values| points to |count| Slices.
+    void add_values(const void* values, size_t count);
+
+    void add_nulls(uint32_t count);
+
+    Status finish(WritableFile* wfile, ColumnIndexMetaPB* index_meta);
+
+    uint64_t size() const;
+
+private:
+    InvertedIndexWriter(const InvertedIndexWriter&) = delete;
+    const InvertedIndexWriter& operator=(const InvertedIndexWriter&) = delete;
+
+    rowid_t _rid = 0;
+    // row id list for null value
+    Roaring _null_bitmap;
+    // token to its row id list
+    std::map<std::string, Roaring, std::less<>> _mem_index;
+    // the estimated size of the tokens and the row id lists
+    uint64_t _size = 0;
+};
+
+} // namespace starrocks
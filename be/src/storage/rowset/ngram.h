@@ -0,0 +1,48 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "util/slice.h"
+
+namespace starrocks {
+
+// Call |func| with each gram of |gram_size| bytes of |value|, until it returns false.
+// Return false if |func| returns false.
+template <typename Func>
+inline bool for_each_ngram(const Slice& value, size_t gram_size, Func&& func) {
+    for (size_t i = 0; i + gram_size <= value.size; i++) {
+        if (!func(Slice(value.data + i, gram_size))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Split the LIKE |pattern| into its literal substrings between the wildcards, with the escape characters removed.
+// A string matching the pattern has all the literals, e.g. "%a\%b_c%" has "a%b" and "c".
+inline std::vector<std::string> like_pattern_literals(const Slice& pattern) {
+    std::vector<std::string> literals;
+    std::string literal;
+    for (size_t i = 0; i < pattern.size; i++) {
+        char c = pattern.data[i];
+        if (c == '%' || c == '_') {
+            if (!literal.empty()) {
+                literals.emplace_back(std::move(literal));
+                literal.clear();
+            }
+        } else if (c == '\\' && i + 1 < pattern.size) {
+            literal.push_back(pattern.data[++i]);
+        } else {
+            literal.push_back(c);
+        }
+    }
+    if (!literal.empty()) {
+        literals.emplace_back(std::move(literal));
+    }
+    return literals;
+}
+
+} // namespace starrocks
@@ -21,6 +21,8 @@
 
 #pragma once
 
+#include <memory>
+
 #include "gutil/macros.h" // for DISALLOW_COPY_AND_ASSIGN
 #include "storage/page_cache.h"
 #include "util/slice.h"
@@ -44,8 +46,12 @@ public:
     // cache_data to a invalid cache handle.
     explicit PageHandle(PageCacheHandle cache_data) : _cache_data(std::move(cache_data)) {}
 
+    // This class will reference the input data in place, which is kept alive by |owner|, e.g. a mapped file.
+    PageHandle(const Slice& data, std::shared_ptr<void> owner) : _data(data), _owner(std::move(owner)) {}
+
     // Move constructor
-    PageHandle(PageHandle&& other) noexcept : _data(other._data), _cache_data(std::move(other._cache_data)) {
+    PageHandle(PageHandle&& other) noexcept
+            : _data(other._data), _cache_data(std::move(other._cache_data)), _owner(std::move(other._owner)) {
         // we can use std::exchange if we switch c++14 on
         std::swap(_is_data_owner, other._is_data_owner);
     }
@@ -54,6 +60,7 @@ public:
         std::swap(_is_data_owner, other._is_data_owner);
         _data = other._data;
         _cache_data = std::move(other._cache_data);
+        _owner = std::move(other._owner);
         return *this;
     }
 
@@ -74,7 +81,7 @@ public:
 
     // the return slice contains uncompressed page body, page footer, and footer size
     Slice data() const {
-        if (_is_data_owner) {
+        if (_is_data_owner || _owner != nullptr) {
             return _data;
         }
         return _cache_data.data();
@@ -94,6 +101,8 @@ private:
     bool _is_data_owner = false;
     Slice _data;
     PageCacheHandle _cache_data;
+    // when this is not null, _data is valid and belongs to it.
+    std::shared_ptr<void> _owner;
 
     // Don't allow copy and assign
     PageHandle(const PageHandle&) = delete;
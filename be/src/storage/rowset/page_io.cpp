@@ -28,7 +28,10 @@
 #include "common/logging.h"
 #include "fs/fs.h"
 #include "gutil/strings/substitute.h"
+#include "io/io_profiler.h"
+#include "io/mmap_input_stream.h"
 #include "storage/page_cache.h"
+#include "storage/rowset/segment_read_buffer.h"
 #include "storage/rowset/storage_page_decoder.h"
 #include "util/block_compression.h"
 #include "util/coding.h"
@@ -36,6 +39,7 @@
 #include "util/faststring.h"
 #include "util/runtime_profile.h"
 #include "util/scoped_cleanup.h"
+#include "util/starrocks_metrics.h"
 
 namespace starrocks {
 
@@ -110,6 +114,35 @@ Status PageIO::write_page(WritableFile* wfile, const std::vector<Slice>& body, c
     return Status::OK();
 }
 
+// Read the raw bytes of the page into |page|, from the read-ahead buffer if possible.
+static Status read_page_data(const PageReadOptions& opts, Slice* page) {
+    const PagePointer& pp = opts.page_pointer;
+    if (opts.read_buffer != nullptr && opts.read_buffer->read(pp, page->data)) {
+        return Status::OK();
+    }
+    PageReadAheadBuffer* buffer = opts.read_ahead;
+    if (buffer != nullptr && !buffer->contains(pp) && opts.read_ahead_size > pp.size) {
+        if (buffer->capacity < opts.read_ahead_size) {
+            buffer->data.reset(new char[opts.read_ahead_size]);
+            buffer->capacity = opts.read_ahead_size;
+        }
+        buffer->size = 0;
+        RETURN_IF_ERROR(opts.read_file->read_at_fully(pp.offset, buffer->data.get(), opts.read_ahead_size));
+        buffer->offset = pp.offset;
+        buffer->size = opts.read_ahead_size;
+        opts.stats->compressed_bytes_read += opts.read_ahead_size;
+        opts.stats->io_count++;
+    }
+    if (buffer != nullptr && buffer->contains(pp)) {
+        memcpy(page->data, buffer->data.get() + (pp.offset - buffer->offset), page->size);
+        return Status::OK();
+    }
+    RETURN_IF_ERROR(opts.read_file->read_at_fully(pp.offset, page->data, page->size));
+    opts.stats->compressed_bytes_read += page->size;
+    opts.stats->io_count++;
+    return Status::OK();
+}
+
 Status PageIO::read_and_decompress_page(const PageReadOptions& opts, PageHandle* handle, Slice* body,
                                         PageFooterPB* footer) {
     // the function will be used by query or load, current load is not allowed to fail when memory reach the limit,
@@ -121,13 +154,19 @@ Status PageIO::read_and_decompress_page(const PageReadOptions& opts, PageHandle*
 
     auto cache = StoragePageCache::instance();
     PageCacheHandle cache_handle;
-    StoragePageCache::CacheKey cache_key(opts.read_file->filename(), opts.page_pointer.offset);
-    if (opts.use_page_cache && cache->lookup(cache_key, &cache_handle)) {
+    const uint64_t file_id =
+            opts.file_id != 0 ? opts.file_id : StoragePageCache::find_file_id(opts.read_file->filename());
+    // the pages of the files not opened by a Segment are not cached
+    const bool use_page_cache = opts.use_page_cache && file_id != 0;
+    StoragePageCache::CacheKey cache_key(file_id, opts.page_pointer.offset);
+    const int64_t lookup_start_ns = use_page_cache ? MonotonicNanos() : 0;
+    if (use_page_cache && cache->lookup(cache_key, &cache_handle)) {
         // we find page in cache, use it
         *handle = PageHandle(std::move(cache_handle));
         opts.stats->cached_pages_num++;
         // parse body and footer
         Slice page_slice = handle->data();
+        io::IOProfiler::record_read(io::IO_TIER_PAGE_CACHE, page_slice.size, MonotonicNanos() - lookup_start_ns);
         uint32_t footer_size = decode_fixed32_le((uint8_t*)page_slice.data + page_slice.size - 4);
         std::string footer_buf(page_slice.data + page_slice.size - 4 - footer_size, footer_size);
         if (!footer->ParseFromString(footer_buf)) {
@@ -143,14 +182,34 @@ Status PageIO::read_and_decompress_page(const PageReadOptions& opts, PageHandle*
         return Status::Corruption(strings::Substitute("Bad page: too small size ($0)", page_size));
     }
 
+    // the page of a mapped file is referenced in place, if the mapping covers the overflow bytes too
+    std::shared_ptr<io::SeekableInputStream> stream = opts.read_file->stream();
+    auto* mmap_stream = dynamic_cast<io::MmapInputStream*>(stream.get());
+    if (mmap_stream != nullptr && opts.page_pointer.offset + page_size + vectorized::Column::APPEND_OVERFLOW_MAX_SIZE >
+                                          static_cast<uint64_t>(mmap_stream->size())) {
+        mmap_stream = nullptr;
+    }
+
     // hold compressed page at first, reset to decompressed page later
-    // Allocate APPEND_OVERFLOW_MAX_SIZE more bytes to make append_strings_overflow work
-    std::unique_ptr<char[]> page(new char[page_size + vectorized::Column::APPEND_OVERFLOW_MAX_SIZE]);
-    Slice page_slice(page.get(), page_size);
-    {
-        SCOPED_RAW_TIMER(&opts.stats->io_ns);
-        RETURN_IF_ERROR(opts.read_file->read_at_fully(opts.page_pointer.offset, page_slice.data, page_slice.size));
+    std::unique_ptr<char[]> page;
+    Slice page_slice;
+    if (mmap_stream != nullptr) {
+        page_slice = Slice(mmap_stream->data() + opts.page_pointer.offset, page_size);
         opts.stats->compressed_bytes_read += page_size;
+        opts.stats->io_count++;
+        // the page is faulted in lazily when it's accessed, so the latency is unknown here
+        io::IOProfiler::record_read(io::IO_TIER_LOCAL_DISK, page_size, 0);
+    } else {
+        // Allocate APPEND_OVERFLOW_MAX_SIZE more bytes to make append_strings_overflow work
+        page.reset(new char[page_size + vectorized::Column::APPEND_OVERFLOW_MAX_SIZE]);
+        page_slice = Slice(page.get(), page_size);
+        int64_t read_ns = 0;
+        {
+            SCOPED_RAW_TIMER(&read_ns);
+            RETURN_IF_ERROR(read_page_data(opts, &page_slice));
+        }
+        opts.stats->io_ns += read_ns;
+        StarRocksMetrics::instance()->page_read_latency_us.observe(read_ns / 1000);
     }
 
     if (opts.verify_checksum) {
@@ -202,7 +261,12 @@ Status PageIO::read_and_decompress_page(const PageReadOptions& opts, PageHandle*
     RETURN_IF_ERROR(StoragePageDecoder::decode_page(footer, footer_size + 4, opts.encoding_type, &page, &page_slice));
 
     *body = Slice(page_slice.data, page_slice.size - 4 - footer_size);
-    if (opts.use_page_cache) {
+    if (page == nullptr) {
+        // neither decompressed nor decoded, the page is still in the mapping, which the OS page cache holds
+        *handle = PageHandle(page_slice, std::move(stream));
+        return Status::OK();
+    }
+    if (use_page_cache && opts.fill_page_cache) {
         // insert this page into cache and return the cache handle
         cache->insert(cache_key, page_slice, &cache_handle, opts.kept_in_memory);
         *handle = PageHandle(std::move(cache_handle));
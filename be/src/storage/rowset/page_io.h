@@ -21,6 +21,7 @@
 
 #pragma once
 
+#include <memory>
 #include <vector>
 
 #include "common/logging.h"
@@ -34,14 +35,28 @@ namespace starrocks {
 
 class BlockCompressionCodec;
 class RandomAccessFile;
+class SegmentReadBuffer;
 class WritableFile;
 struct OlapReaderStatistics;
 
+// The bytes of several contiguous pages, which are read from the file in one IO and serve the reads of these pages.
+struct PageReadAheadBuffer {
+    uint64_t offset = 0;
+    uint64_t size = 0;
+    uint64_t capacity = 0;
+    std::unique_ptr<char[]> data;
+
+    bool contains(const PagePointer& pp) const { return pp.offset >= offset && pp.offset + pp.size <= offset + size; }
+};
+
 struct PageReadOptions {
     // block to read page
     RandomAccessFile* read_file = nullptr;
     // location of the page
     PagePointer page_pointer;
+    // the id of |read_file| in the page cache keys, see `StoragePageCache::acquire_file_id`.
+    // 0 means the id is found by the file name.
+    uint64_t file_id = 0;
     // decompressor for page body (null means page body is not compressed)
     const BlockCompressionCodec* codec = nullptr;
     // used to collect IO metrics
@@ -50,11 +65,19 @@ struct PageReadOptions {
     bool verify_checksum = true;
     // whether to use page cache in read path
     bool use_page_cache = true;
+    // whether to insert the page into the page cache if it's not found there, only used if |use_page_cache| is true
+    bool fill_page_cache = true;
     // if true, use DURABLE CachePriority in page cache
     // currently used for in memory olap table
     bool kept_in_memory = false;
     // page encoding type
     EncodingTypePB encoding_type = UNKNOWN_ENCODING;
+    // if not null, the page is read from the buffer if the buffer contains it. Otherwise the `read_ahead_size` bytes
+    // from the offset of the page are read into the buffer, which must be the contiguous pages of the same file.
+    PageReadAheadBuffer* read_ahead = nullptr;
+    uint64_t read_ahead_size = 0;
+    // if not null, the page is read from the buffer if it's loaded there, see SegmentReadBuffer.
+    const SegmentReadBuffer* read_buffer = nullptr;
 
     void sanity_check() const {
         CHECK_NOTNULL(read_file);
@@ -0,0 +1,262 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include "column/column.h"
+#include "storage/rowset/options.h"      // for PageBuilderOptions/PageDecoderOptions
+#include "storage/rowset/page_builder.h" // for PageBuilder
+#include "storage/rowset/page_decoder.h" // for PageDecoder
+#include "storage/type_traits.h"
+#include "util/coding.h"
+#include "util/faststring.h"
+#include "util/pfor_coding.h"
+
+namespace starrocks {
+
+// Encode the integers of a page by the patched frame-of-reference coding, see PForCoding.
+//
+// The page format is as follows:
+//
+//      Block * BlockNum Padding(8) BlockOffset(4) * BlockNum ValueNum(4)
+//
+// All the blocks but the last one have PForCoding::BLOCK_SIZE values.
+template <FieldType Type>
+class PForPageBuilder final : public PageBuilder {
+public:
+    using CppType = typename TypeTraits<Type>::CppType;
+    using Coding = PForCoding<CppType>;
+
+    explicit PForPageBuilder(const PageBuilderOptions& options) : _options(options) {
+        _pending_values.reserve(Coding::BLOCK_SIZE);
+    }
+
+    ~PForPageBuilder() override = default;
+
+    bool is_page_full() override { return size() >= _options.data_page_size; }
+
+    size_t add(const uint8_t* vals, size_t count) override {
+        DCHECK(!_finished);
+        auto new_vals = reinterpret_cast<const CppType*>(vals);
+        for (size_t i = 0; i < count;) {
+            const size_t n = std::min(count - i, Coding::BLOCK_SIZE - _pending_values.size());
+            _pending_values.insert(_pending_values.end(), new_vals + i, new_vals + i + n);
+            i += n;
+            if (_pending_values.size() == Coding::BLOCK_SIZE) {
+                _flush_block();
+            }
+        }
+        if (count > 0) {
+            if (_count == 0) {
+                _first_val = new_vals[0];
+            }
+            _last_val = new_vals[count - 1];
+        }
+        _count += count;
+        return count;
+    }
+
+    faststring* finish() override {
+        DCHECK(!_finished);
+        _finished = true;
+        if (!_pending_values.empty()) {
+            _flush_block();
+        }
+        _buf.resize(_buf.size() + Coding::PADDING_SIZE);
+        memset(_buf.data() + _buf.size() - Coding::PADDING_SIZE, 0, Coding::PADDING_SIZE);
+        for (uint32_t offset : _block_offsets) {
+            put_fixed32_le(&_buf, offset);
+        }
+        put_fixed32_le(&_buf, static_cast<uint32_t>(_count));
+        return &_buf;
+    }
+
+    void reset() override {
+        _count = 0;
+        _finished = false;
+        _buf.clear();
+        _block_offsets.clear();
+        _pending_values.clear();
+    }
+
+    size_t count() const override { return _count; }
+
+    uint64_t size() const override {
+        return _buf.size() + _pending_values.size() * sizeof(CppType) + (_block_offsets.size() + 1) * sizeof(uint32_t);
+    }
+
+    Status get_first_value(void* value) const override {
+        if (_count == 0) {
+            return Status::NotFound("page is empty");
+        }
+        memcpy(value, &_first_val, sizeof(CppType));
+        return Status::OK();
+    }
+
+    Status get_last_value(void* value) const override {
+        if (_count == 0) {
+            return Status::NotFound("page is empty");
+        }
+        memcpy(value, &_last_val, sizeof(CppType));
+        return Status::OK();
+    }
+
+private:
+    void _flush_block() {
+        _block_offsets.push_back(static_cast<uint32_t>(_buf.size()));
+        Coding::encode_block(_pending_values.data(), _pending_values.size(), &_buf);
+        _pending_values.clear();
+    }
+
+    PageBuilderOptions _options;
+    size_t _count = 0;
+    bool _finished = false;
+    faststring _buf;
+    std::vector<uint32_t> _block_offsets;
+    std::vector<CppType> _pending_values;
+    CppType _first_val;
+    CppType _last_val;
+};
+
+template <FieldType Type>
+class PForPageDecoder final : public PageDecoder {
+public:
+    using CppType = typename TypeTraits<Type>::CppType;
+    using Coding = PForCoding<CppType>;
+
+    PForPageDecoder(Slice data, const PageDecoderOptions& options) : _data(data) {}
+
+    ~PForPageDecoder() override = default;
+
+    Status init() override {
+        CHECK(!_parsed);
+        if (_data.size < sizeof(uint32_t)) {
+            return Status::Corruption("The PFOR page is too small");
+        }
+        const auto* data = reinterpret_cast<const uint8_t*>(_data.data);
+        _num_elements = decode_fixed32_le(data + _data.size - sizeof(uint32_t));
+        _num_blocks = (_num_elements + Coding::BLOCK_SIZE - 1) / Coding::BLOCK_SIZE;
+        const size_t footer_size = (_num_blocks + 1) * sizeof(uint32_t);
+        if (_data.size < footer_size + Coding::PADDING_SIZE) {
+            return Status::Corruption("The PFOR page metadata maybe broken");
+        }
+        _block_offsets = data + _data.size - footer_size;
+        const size_t blocks_size = _data.size - footer_size - Coding::PADDING_SIZE;
+        for (size_t i = 0; i < _num_blocks; i++) {
+            if (decode_fixed32_le(_block_offsets + i * sizeof(uint32_t)) + Coding::HEADER_SIZE > blocks_size) {
+                return Status::Corruption("The PFOR page metadata maybe broken");
+            }
+        }
+        _parsed = true;
+        return Status::OK();
+    }
+
+    Status seek_to_position_in_page(size_t pos) override {
+        DCHECK(_parsed) << "Must call init() firstly";
+        DCHECK_LE(pos, _num_elements) << "Tried to seek to " << pos << " which is > number of elements ("
+                                      << _num_elements << ") in the block!";
+        _cur_index = pos;
+        return Status::OK();
+    }
+
+    Status next_batch(size_t* n, ColumnBlockView* dst) override {
+        DCHECK(_parsed) << "Must call init() firstly";
+        if (PREDICT_FALSE(*n == 0 || _cur_index >= _num_elements)) {
+            *n = 0;
+            return Status::OK();
+        }
+        size_t to_fetch = std::min(*n, _num_elements - _cur_index);
+        RETURN_IF_ERROR(_read(reinterpret_cast<CppType*>(dst->data()), to_fetch));
+        *n = to_fetch;
+        return Status::OK();
+    }
+
+    Status next_batch(size_t* n, vectorized::Column* dst) override {
+        vectorized::SparseRange read_range;
+        size_t begin = current_index();
+        read_range.add(vectorized::Range(begin, begin + *n));
+        RETURN_IF_ERROR(next_batch(read_range, dst));
+        *n = current_index() - begin;
+        return Status::OK();
+    }
+
+    Status next_batch(const vectorized::SparseRange& range, vectorized::Column* dst) override {
+        DCHECK(_parsed) << "Must call init() firstly";
+        if (PREDICT_FALSE(range.span_size() == 0 || _cur_index >= _num_elements)) {
+            return Status::OK();
+        }
+        size_t to_read =
+                std::min(static_cast<size_t>(range.span_size()), static_cast<size_t>(_num_elements - _cur_index));
+        vectorized::SparseRangeIterator iter = range.new_iterator();
+        while (to_read > 0 && _cur_index < _num_elements) {
+            seek_to_position_in_page(iter.begin());
+            vectorized::Range r = iter.next(to_read);
+            const size_t ori_size = dst->size();
+            dst->resize_uninitialized(ori_size + r.span_size());
+            auto* p = reinterpret_cast<CppType*>(dst->mutable_raw_data()) + ori_size;
+            RETURN_IF_ERROR(_read(p, r.span_size()));
+            to_read -= r.span_size();
+        }
+        return Status::OK();
+    }
+
+    size_t count() const override { return _num_elements; }
+
+    size_t current_index() const override { return _cur_index; }
+
+    EncodingTypePB encoding_type() const override { return PFOR_ENCODING; }
+
+private:
+    // Decode the |block| into |out|.
+    Status _decode_block(size_t block, CppType* out) {
+        const auto* data = reinterpret_cast<const uint8_t*>(_data.data);
+        const uint32_t offset = decode_fixed32_le(_block_offsets + block * sizeof(uint32_t));
+        if (Coding::decode_block(data + offset, _block_size(block), out) == 0) {
+            return Status::Corruption("The PFOR block maybe broken");
+        }
+        return Status::OK();
+    }
+
+    size_t _block_size(size_t block) const {
+        return std::min(Coding::BLOCK_SIZE, _num_elements - block * Coding::BLOCK_SIZE);
+    }
+
+    // Read |n| values from the current index. The whole blocks are decoded to |out| directly.
+    Status _read(CppType* out, size_t n) {
+        DCHECK_LE(_cur_index + n, _num_elements);
+        while (n > 0) {
+            const size_t block = _cur_index / Coding::BLOCK_SIZE;
+            const size_t offset_in_block = _cur_index % Coding::BLOCK_SIZE;
+            const size_t block_size = _block_size(block);
+            size_t num_read;
+            if (offset_in_block == 0 && n >= block_size) {
+                RETURN_IF_ERROR(_decode_block(block, out));
+                num_read = block_size;
+            } else {
+                if (_decoded_block != block) {
+                    RETURN_IF_ERROR(_decode_block(block, _block_values));
+                    _decoded_block = block;
+                }
+                num_read = std::min(n, block_size - offset_in_block);
+                memcpy(out, _block_values + offset_in_block, num_read * sizeof(CppType));
+            }
+            out += num_read;
+            n -= num_read;
+            _cur_index += num_read;
+        }
+        return Status::OK();
+    }
+
+    bool _parsed = false;
+    Slice _data;
+    size_t _num_elements = 0;
+    size_t _num_blocks = 0;
+    size_t _cur_index = 0;
+    const uint8_t* _block_offsets = nullptr;
+    size_t _decoded_block = static_cast<size_t>(-1);
+    CppType _block_values[Coding::BLOCK_SIZE];
+};
+
+} // namespace starrocks
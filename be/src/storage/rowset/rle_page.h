@@ -199,14 +199,8 @@ public:
         }
 
         size_t to_fetch = std::min(*n, static_cast<size_t>(_num_elements - _cur_index));
-        size_t remaining = to_fetch;
-        uint8_t* data_ptr = dst->data();
-        while (remaining > 0) {
-            bool result = _rle_decoder.Get(reinterpret_cast<CppType*>(data_ptr));
-            DCHECK(result);
-            remaining--;
-            data_ptr += SIZE_OF_TYPE;
-        }
+        [[maybe_unused]] size_t num_read = _rle_decoder.GetBatch(reinterpret_cast<CppType*>(dst->data()), to_fetch);
+        DCHECK_EQ(to_fetch, num_read);
 
         _cur_index += to_fetch;
         *n = to_fetch;
@@ -227,20 +221,19 @@ public:
         if (PREDICT_FALSE(_cur_index >= _num_elements)) {
             return Status::OK();
         }
-        CppType value{};
-
         size_t to_read =
                 std::min(static_cast<size_t>(range.span_size()), static_cast<size_t>(_num_elements - _cur_index));
         vectorized::SparseRangeIterator iter = range.new_iterator();
         while (to_read > 0) {
             seek_to_position_in_page(iter.begin());
             vectorized::Range r = iter.next(to_read);
-            for (size_t i = 0; i < r.span_size(); ++i) {
-                if (PREDICT_FALSE(!_rle_decoder.Get(&value))) {
-                    return Status::Corruption("RLE decode failed");
-                }
-                [[maybe_unused]] int p = dst->append_numbers(&value, sizeof(value));
-                DCHECK_EQ(1, p);
+            // Decode the values into the column directly, a repeated run is filled at once instead of value by value.
+            const size_t ori_size = dst->size();
+            dst->resize_uninitialized(ori_size + r.span_size());
+            auto* p = reinterpret_cast<CppType*>(dst->mutable_raw_data()) + ori_size;
+            if (PREDICT_FALSE(_rle_decoder.GetBatch(p, r.span_size()) != r.span_size())) {
+                dst->resize(ori_size);
+                return Status::Corruption("RLE decode failed");
             }
             _cur_index += r.span_size();
             to_read -= r.span_size();
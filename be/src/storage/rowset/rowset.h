@@ -203,7 +203,8 @@ public:
     }
 
     // hard link all files in this rowset to `dir` to form a new rowset with id `new_rowset_id`.
-    virtual Status link_files_to(const std::string& dir, RowsetId new_rowset_id) = 0;
+    // The segment files are linked as the segments from `first_segment_id` of the new rowset.
+    virtual Status link_files_to(const std::string& dir, RowsetId new_rowset_id, int first_segment_id = 0) = 0;
 
     // copy all files to `dir`
     virtual Status copy_files_to(const std::string& dir) = 0;
@@ -57,6 +57,7 @@ public:
     starrocks::RuntimeState* runtime_state = nullptr;
     starrocks::RuntimeProfile* profile = nullptr;
     bool use_page_cache = false;
+    bool fill_page_cache = true;
 
     ColumnIdToGlobalDictMap* global_dictmaps = &EMPTY_GLOBAL_DICTMAPS;
     const std::unordered_set<uint32_t>* unused_output_column_ids = nullptr;
@@ -28,6 +28,7 @@
 
 namespace starrocks {
 
+class EncodingHints;
 class TabletSchema;
 
 enum RowsetWriterType { kHorizontal = 0, kVertical = 1 };
@@ -77,7 +78,13 @@ public:
 
     vectorized::GlobalDictByNameMaps* global_dicts = nullptr;
 
+    // the encodings of the string columns of the previous segments, nullptr to speculate them for each segment.
+    EncodingHints* encoding_hints = nullptr;
+
     RowsetWriterType writer_type = kHorizontal;
+
+    // Write the segment files by direct I/O, see `WritableFileOptions::direct_io`.
+    bool direct_io = false;
 };
 
 } // namespace starrocks
@@ -21,6 +21,10 @@
 
 #include "storage/rowset/scalar_column_iterator.h"
 
+#include <algorithm>
+
+#include "common/config.h"
+#include "storage/page_cache.h"
 #include "storage/rowset/binary_dict_page.h"
 #include "storage/rowset/column_reader.h"
 #include "storage/rowset/encoding_info.h"
@@ -256,7 +260,7 @@ Status ScalarColumnIterator::_load_next_page(bool* eos) {
         return Status::OK();
     }
 
-    RETURN_IF_ERROR(_read_data_page(_page_iter));
+    RETURN_IF_ERROR(_read_data_page(_page_iter, true));
     _seek_to_pos_in_page(_page.get(), 0);
     *eos = false;
     return Status::OK();
@@ -292,11 +296,34 @@ Status ScalarColumnIterator::_do_init_dict_decoder() {
     return Status::OK();
 }
 
-Status ScalarColumnIterator::_read_data_page(const OrdinalPageIndexIterator& iter) {
+uint64_t ScalarColumnIterator::_read_ahead_size(const OrdinalPageIndexIterator& iter) const {
+    const uint64_t max_bytes = std::max<int64_t>(0, config::column_page_read_ahead_bytes);
+    const uint64_t begin = iter.page().offset;
+    uint64_t end = begin + iter.page().size;
+    OrdinalPageIndexIterator next = iter;
+    for (next.next(); next.valid(); next.next()) {
+        const PagePointer& pp = next.page();
+        if (pp.offset != end || end + pp.size - begin > max_bytes) {
+            break;
+        }
+        end += pp.size;
+    }
+    return end - begin;
+}
+
+Status ScalarColumnIterator::_read_data_page(const OrdinalPageIndexIterator& iter, bool read_ahead) {
     PageHandle handle;
     Slice page_body;
     PageFooterPB footer;
-    RETURN_IF_ERROR(_reader->read_page(_opts, iter.page(), &handle, &page_body, &footer));
+    if (read_ahead && config::column_page_read_ahead_bytes > 0) {
+        // The pages are read sequentially, so read the following contiguous pages along with this page, unless they
+        // have been read.
+        const uint64_t read_ahead_size = _read_ahead.contains(iter.page()) ? 0 : _read_ahead_size(iter);
+        RETURN_IF_ERROR(
+                _reader->read_page(_opts, iter.page(), &handle, &page_body, &footer, &_read_ahead, read_ahead_size));
+    } else {
+        RETURN_IF_ERROR(_reader->read_page(_opts, iter.page(), &handle, &page_body, &footer));
+    }
     RETURN_IF_ERROR(parse_page(&_page, std::move(handle), page_body, footer.data_page_footer(),
                                _reader->encoding_info(), iter.page(), iter.page_index()));
 
@@ -324,15 +351,35 @@ Status ScalarColumnIterator::get_row_ranges_by_zone_map(
     return Status::OK();
 }
 
+Status ScalarColumnIterator::classify_pages_by_zone_map(
+        const std::vector<const vectorized::ColumnPredicate*>& predicates, vectorized::SparseRange* full_ranges,
+        vectorized::SparseRange* partial_ranges, vectorized::ZoneMapDetail* full_zone_map) {
+    if (!_reader->has_zone_map()) {
+        return Status::NotSupported("classify pages of a column without zone map");
+    }
+    return _reader->zone_map_classify(predicates, full_ranges, partial_ranges, full_zone_map);
+}
+
 Status ScalarColumnIterator::get_row_ranges_by_bloom_filter(
         const std::vector<const vectorized::ColumnPredicate*>& predicates, vectorized::SparseRange* row_ranges) {
-    RETURN_IF(!_reader->has_bloom_filter_index(), Status::OK());
-    bool support = false;
-    for (const auto* pred : predicates) {
-        support = support | pred->support_bloom_filter();
+    if (_reader->has_bloom_filter_index()) {
+        bool support = false;
+        for (const auto* pred : predicates) {
+            support = support | pred->support_bloom_filter();
+        }
+        if (support) {
+            RETURN_IF_ERROR(_reader->bloom_filter(predicates, row_ranges));
+        }
+    }
+    if (_reader->has_ngram_bloom_filter_index()) {
+        bool support = false;
+        for (const auto* pred : predicates) {
+            support = support | pred->support_ngram_bloom_filter();
+        }
+        if (support) {
+            RETURN_IF_ERROR(_reader->ngram_bloom_filter(predicates, row_ranges));
+        }
     }
-    RETURN_IF(!support, Status::OK());
-    RETURN_IF_ERROR(_reader->bloom_filter(predicates, row_ranges));
     return Status::OK();
 }
 
@@ -518,6 +565,34 @@ Status ScalarColumnIterator::_fetch_by_rowid(const rowid_t* rowids, size_t size,
     return Status::OK();
 }
 
+void ScalarColumnIterator::collect_data_pages(const vectorized::SparseRange& range, std::vector<PagePointer>* pages) {
+    if (range.empty()) {
+        return;
+    }
+    auto cache = StoragePageCache::instance();
+    int32_t last_page_index = _page != nullptr ? static_cast<int32_t>(_page->page_index()) : -1;
+    for (size_t i = 0; i < range.size(); i++) {
+        OrdinalPageIndexIterator iter;
+        if (!_reader->seek_at_or_before(range[i].begin(), &iter).ok()) {
+            return;
+        }
+        for (; iter.valid() && iter.first_ordinal() < range[i].end(); iter.next()) {
+            // The current page has been parsed, and a page may overlap several ranges.
+            if (iter.page_index() <= last_page_index) {
+                continue;
+            }
+            last_page_index = iter.page_index();
+            if (_opts.use_page_cache) {
+                PageCacheHandle cache_handle;
+                if (cache->lookup(StoragePageCache::CacheKey(_reader->file_id(), iter.page().offset), &cache_handle)) {
+                    continue;
+                }
+            }
+            pages->push_back(iter.page());
+        }
+    }
+}
+
 Status ScalarColumnIterator::fetch_values_by_rowid(const rowid_t* rowids, size_t size, vectorized::Column* values) {
     auto page_parse = [&](vectorized::Column* column, size_t* count) { return _page->read(column, count); };
     return _fetch_by_rowid(rowids, size, values, page_parse);
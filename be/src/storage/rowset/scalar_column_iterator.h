@@ -26,6 +26,7 @@
 #include "storage/rowset/column_iterator.h"
 #include "storage/rowset/ordinal_page_index.h"
 #include "storage/rowset/page_handle.h"
+#include "storage/rowset/page_io.h"
 #include "storage/rowset/parsed_page.h"
 
 namespace starrocks {
@@ -59,6 +60,10 @@ public:
     Status get_row_ranges_by_bloom_filter(const std::vector<const vectorized::ColumnPredicate*>& predicates,
                                           vectorized::SparseRange* range) override;
 
+    Status classify_pages_by_zone_map(const std::vector<const vectorized::ColumnPredicate*>& predicates,
+                                      vectorized::SparseRange* full_ranges, vectorized::SparseRange* partial_ranges,
+                                      vectorized::ZoneMapDetail* full_zone_map) override;
+
     bool all_page_dict_encoded() const override { return _all_dict_encoded; }
 
     Status fetch_all_dict_words(std::vector<Slice>* words) const override;
@@ -75,6 +80,8 @@ public:
 
     Status fetch_dict_codes_by_rowid(const rowid_t* rowids, size_t size, vectorized::Column* values) override;
 
+    void collect_data_pages(const vectorized::SparseRange& range, std::vector<PagePointer>* pages) override;
+
     ParsedPage* get_current_page() { return _page.get(); }
 
     bool is_nullable();
@@ -88,7 +95,9 @@ public:
 private:
     static void _seek_to_pos_in_page(ParsedPage* page, ordinal_t offset_in_page);
     Status _load_next_page(bool* eos);
-    Status _read_data_page(const OrdinalPageIndexIterator& iter);
+    Status _read_data_page(const OrdinalPageIndexIterator& iter, bool read_ahead = false);
+    // The bytes of the contiguous pages from |iter| which are read in one IO, see column_page_read_ahead_bytes.
+    uint64_t _read_ahead_size(const OrdinalPageIndexIterator& iter) const;
 
     template <FieldType Type>
     int _do_dict_lookup(const Slice& word);
@@ -133,6 +142,9 @@ private:
     // This value will be reset when a new seek is issued
     OrdinalPageIndexIterator _page_iter;
 
+    // the following pages read along with the current page when reading the pages sequentially
+    PageReadAheadBuffer _read_ahead;
+
     // current value ordinal
     ordinal_t _current_ordinal = 0;
 
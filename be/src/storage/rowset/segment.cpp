@@ -38,6 +38,7 @@
 #include "segment_iterator.h"
 #include "segment_options.h"
 #include "storage/column_predicate_rewriter.h"
+#include "storage/page_cache.h"
 #include "storage/rowset/column_reader.h"
 #include "storage/rowset/default_value_column_iterator.h"
 #include "storage/rowset/page_io.h"
@@ -171,13 +172,22 @@ Segment::Segment(const private_type&, std::shared_ptr<FileSystem> blk_mgr, std::
           _fname(std::move(fname)),
           _tablet_schema(tablet_schema),
           _segment_id(segment_id),
-          _mem_tracker(mem_tracker) {}
+          _mem_tracker(mem_tracker) {
+    _file_id = StoragePageCache::acquire_file_id(_fname);
+}
+
+Segment::~Segment() {
+    StoragePageCache::release_file_id(_fname);
+}
 
 Status Segment::_open(MemTracker* mem_tracker, size_t* footer_length_hint,
                       const FooterPointerPB* partial_rowset_footer) {
     SegmentFooterPB footer;
     ASSIGN_OR_RETURN(auto read_file, _fs->new_random_access_file(_fname));
     RETURN_IF_ERROR(Segment::parse_segment_footer(read_file.get(), &footer, footer_length_hint, partial_rowset_footer));
+    if (config::pin_segment_file_handles && _fs->type() == FileSystem::POSIX) {
+        _pinned_stream = read_file->stream();
+    }
 
     RETURN_IF_ERROR(_create_column_readers(mem_tracker, &footer));
     _num_rows = footer.num_rows();
@@ -186,6 +196,13 @@ Status Segment::_open(MemTracker* mem_tracker, size_t* footer_length_hint,
     return Status::OK();
 }
 
+StatusOr<std::unique_ptr<RandomAccessFile>> Segment::new_read_file() const {
+    if (_pinned_stream != nullptr) {
+        return std::make_unique<RandomAccessFile>(_pinned_stream, _fname);
+    }
+    return _fs->new_random_access_file(_fname);
+}
+
 StatusOr<ChunkIteratorPtr> Segment::_new_iterator(const vectorized::Schema& schema,
                                                   const vectorized::SegmentReadOptions& read_options) {
     DCHECK(read_options.stats != nullptr);
@@ -230,12 +247,13 @@ Status Segment::load_index(MemTracker* mem_tracker) {
     return _load_index_once.call([this, mem_tracker] {
         SCOPED_THREAD_LOCAL_CHECK_MEM_LIMIT_SETTER(false);
         // read and parse short key index page
-        ASSIGN_OR_RETURN(auto read_file, _fs->new_random_access_file(_fname));
+        ASSIGN_OR_RETURN(auto read_file, new_read_file());
 
         PageReadOptions opts;
         opts.use_page_cache = !config::disable_storage_page_cache;
         opts.read_file = read_file.get();
         opts.page_pointer = _short_key_index_page;
+        opts.file_id = _file_id;
         opts.codec = nullptr; // short key index page uses NO_COMPRESSION for now
         OlapReaderStatistics tmp_stats;
         opts.stats = &tmp_stats;
@@ -338,4 +356,11 @@ Status Segment::new_bitmap_index_iterator(uint32_t cid, BitmapIndexIterator** it
     return Status::OK();
 }
 
+Status Segment::new_inverted_index_iterator(uint32_t cid, InvertedIndexIterator** iter) {
+    if (_column_readers[cid] != nullptr && _column_readers[cid]->has_inverted_index()) {
+        return _column_readers[cid]->new_inverted_index_iterator(iter);
+    }
+    return Status::OK();
+}
+
 } // namespace starrocks
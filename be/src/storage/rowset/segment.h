@@ -54,6 +54,7 @@ class SegmentReadOptions;
 
 class BitmapIndexIterator;
 class ColumnReader;
+class InvertedIndexIterator;
 class ColumnIterator;
 class Segment;
 using SegmentSharedPtr = std::shared_ptr<Segment>;
@@ -83,7 +84,7 @@ public:
     Segment(const private_type&, std::shared_ptr<FileSystem> blk_mgr, std::string fname, uint32_t segment_id,
             const TabletSchema* tablet_schema, MemTracker* mem_tracker);
 
-    ~Segment() = default;
+    ~Segment();
 
     // Returns `EndOfFile` if |read_options| has predicate and no record in this segment
     // matched with the predicate.
@@ -97,6 +98,8 @@ public:
 
     Status new_bitmap_index_iterator(uint32_t cid, BitmapIndexIterator** iter);
 
+    Status new_inverted_index_iterator(uint32_t cid, InvertedIndexIterator** iter);
+
     size_t num_short_keys() const { return _tablet_schema->num_short_key_columns(); }
 
     uint32_t num_rows_per_block() const {
@@ -143,6 +146,13 @@ public:
 
     const std::string& file_name() const { return _fname; }
 
+    // Return a file reading this segment, which shares the handle pinned to this segment if
+    // `pin_segment_file_handles` is true and the segment is local, or opens the file otherwise.
+    StatusOr<std::unique_ptr<RandomAccessFile>> new_read_file() const;
+
+    // The id of the file in the keys of StoragePageCache.
+    uint64_t file_id() const { return _file_id; }
+
     uint32_t num_rows() const { return _num_rows; }
 
     // Load and decode short key index.
@@ -174,11 +184,14 @@ private:
 
     std::shared_ptr<FileSystem> _fs;
     std::string _fname;
+    uint64_t _file_id = 0;
     const TabletSchema* _tablet_schema;
     uint32_t _segment_id = 0;
     uint32_t _num_rows = 0;
     PagePointer _short_key_index_page;
     MemTracker* _mem_tracker;
+    // the file handle opened by _open(), whose reads by the offsets can be called concurrently.
+    std::shared_ptr<io::SeekableInputStream> _pinned_stream;
 
     // ColumnReader for each column in TabletSchema. If ColumnReader is nullptr,
     // This means that this segment has no data for that column, which may be added
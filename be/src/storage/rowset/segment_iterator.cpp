@@ -26,24 +26,29 @@
 #include "storage/column_expr_predicate.h"
 #include "storage/column_or_predicate.h"
 #include "storage/column_predicate_rewriter.h"
+#include "storage/decoded_column_cache.h"
 #include "storage/del_vector.h"
 #include "storage/projection_iterator.h"
 #include "storage/range.h"
 #include "storage/roaring2range.h"
 #include "storage/rowset/bitmap_index_reader.h"
+#include "storage/rowset/cached_column_iterator.h"
 #include "storage/rowset/column_decoder.h"
 #include "storage/rowset/column_reader.h"
 #include "storage/rowset/common.h"
 #include "storage/rowset/default_value_column_iterator.h"
 #include "storage/rowset/dictcode_column_iterator.h"
+#include "storage/rowset/inverted_index_reader.h"
 #include "storage/rowset/rowid_column_iterator.h"
 #include "storage/rowset/rowid_range_option.h"
 #include "storage/rowset/segment.h"
+#include "storage/rowset/segment_read_buffer.h"
 #include "storage/rowset/short_key_range_option.h"
 #include "storage/storage_engine.h"
 #include "storage/types.h"
 #include "storage/update_manager.h"
 #include "storage/vectorized_column_predicate.h"
+#include "storage/zone_map_detail.h"
 #include "util/starrocks_metrics.h"
 
 namespace starrocks::vectorized {
@@ -100,6 +105,22 @@ protected:
     Status do_get_next(Chunk* chunk, vector<uint32_t>* rowid) override;
 
 private:
+    // A predicate column of a ScanContext which is read and filtered before the other columns, see `_read_by_column`.
+    struct CascadeColumn {
+        // index of the column in |ScanContext::_read_schema|
+        size_t index;
+        std::vector<const ColumnPredicate*> preds;
+
+        // the rows read, the rows passed the predicates and the time to read and filter them, by which the columns
+        // are ordered.
+        int64_t rows_read = 0;
+        int64_t rows_passed = 0;
+        int64_t cost_ns = 0;
+
+        // the rejected rows per nanosecond, the column with a larger one is read ahead.
+        double score() const { return static_cast<double>(rows_read - rows_passed) / std::max<int64_t>(cost_ns, 1); }
+    };
+
     struct ScanContext {
         ScanContext() {}
 
@@ -157,6 +178,11 @@ private:
         Schema _dict_decode_schema;
         std::vector<bool> _is_dict_column;
         std::vector<ColumnIterator*> _column_iterators;
+        // the iterators of the columns of |_read_schema| which read the data pages, whose reads are coalesced.
+        std::vector<ColumnIterator*> _page_iterators;
+        // if not empty, the predicate columns are read one by one in this order, and the rows rejected by a column
+        // are not read from the following columns.
+        std::vector<CascadeColumn> _cascade_columns;
         ScanContext* _next{nullptr};
 
         // index the column which only be used for filter
@@ -190,6 +216,9 @@ private:
 
     template <bool check_global_dict>
     Status _init_column_iterators(const Schema& schema);
+    // Replace the column iterator of |field| by a CachedColumnIterator if the column can be kept in
+    // DecodedColumnCache.
+    Status _try_cache_column(const Field& field, const ColumnIteratorOptions& opts);
     Status _get_row_ranges_by_keys();
     Status _get_row_ranges_by_key_ranges();
     Status _get_row_ranges_by_short_key_ranges();
@@ -243,12 +272,27 @@ private:
 
     Status _apply_bitmap_index();
 
+    Status _apply_inverted_index();
+
     Status _apply_del_vector();
 
+    // Exclude the rows satisfying a delete predicate by the page zone maps, so that they are not read at all.
+    Status _get_row_ranges_by_delete_predicates();
+
     Status _read(Chunk* chunk, vector<rowid_t>* rowid, size_t n);
 
+    void _init_cascade_columns(ScanContext* ctx);
+
+    // Read at most |n| rows of the scan range into |result| like `_read` and `_filter`, but read the predicate
+    // columns of `ScanContext::_cascade_columns` one by one, and read each column only for the rows passed the
+    // predicates of the previous ones.
     Status _read_by_column(size_t n, Chunk* result, vector<rowid_t>* rowids);
 
+    Status _read_column_by_range(ScanContext* ctx, size_t index, const SparseRange& range, Column* column);
+
+    // Return the rows of |range| which are selected by |_selection| from |from|.
+    SparseRange _selected_range(const SparseRange& range, size_t from) const;
+
 private:
     using RawColumnIterators = std::vector<ColumnIterator*>;
     using ColumnDecoders = std::vector<ColumnDecoder>;
@@ -257,11 +301,15 @@ private:
     RawColumnIterators _column_iterators;
     ColumnDecoders _column_decoders;
     std::vector<BitmapIndexIterator*> _bitmap_index_iterators;
+    std::vector<InvertedIndexIterator*> _inverted_index_iterators;
 
     DelVectorPtr _del_vec;
     roaring_uint32_iterator_t _roaring_iter;
 
     std::unique_ptr<RandomAccessFile> _rfile;
+    // null if the reads of the data pages are not coalesced
+    std::unique_ptr<SegmentReadBuffer> _read_buffer;
+    std::vector<PagePointer> _pages_to_read;
 
     SparseRange _scan_range;
     SparseRangeIterator _range_iter;
@@ -296,6 +344,7 @@ private:
 
     bool _inited = false;
     bool _has_bitmap_index = false;
+    bool _has_inverted_index = false;
 
     bool _context_switch_next_time = false;
 };
@@ -340,7 +389,16 @@ Status SegmentIterator::_init() {
 
     StarRocksMetrics::instance()->segment_read_total.increment(1);
     // get file handle from file descriptor of segment
-    ASSIGN_OR_RETURN(_rfile, _opts.fs->new_random_access_file(_segment->file_name()));
+    if (_opts.fs.get() == _segment->file_system()) {
+        ASSIGN_OR_RETURN(_rfile, _segment->new_read_file());
+    } else {
+        ASSIGN_OR_RETURN(_rfile, _opts.fs->new_random_access_file(_segment->file_name()));
+    }
+    if (config::segment_read_coalesce_max_bytes > 0) {
+        _read_buffer = std::make_unique<SegmentReadBuffer>(_rfile.get(),
+                                                           std::max<int64_t>(0, config::segment_read_coalesce_max_gap),
+                                                           config::segment_read_coalesce_max_bytes);
+    }
 
     /// the calling order matters, do not change unless you know why.
 
@@ -355,7 +413,9 @@ Status SegmentIterator::_init() {
     RETURN_IF_ERROR(_get_row_ranges_by_keys());
     RETURN_IF_ERROR(_get_row_ranges_by_rowid_range());
     RETURN_IF_ERROR(_apply_del_vector());
+    RETURN_IF_ERROR(_get_row_ranges_by_delete_predicates());
     RETURN_IF_ERROR(_apply_bitmap_index());
+    RETURN_IF_ERROR(_apply_inverted_index());
     RETURN_IF_ERROR(_get_row_ranges_by_zone_map());
     RETURN_IF_ERROR(_get_row_ranges_by_bloom_filter());
     // rewrite stage
@@ -363,6 +423,9 @@ Status SegmentIterator::_init() {
     RETURN_IF_ERROR(_rewrite_predicates());
     RETURN_IF_ERROR(_init_context());
     _init_column_predicates();
+    for (auto& ctx : _context_list) {
+        _init_cascade_columns(&ctx);
+    }
     _range_iter = _scan_range.new_iterator();
 
     return Status::OK();
@@ -403,10 +466,13 @@ Status SegmentIterator::_init_column_iterators(const Schema& schema) {
             ColumnIteratorOptions iter_opts;
             iter_opts.stats = _opts.stats;
             iter_opts.use_page_cache = _opts.use_page_cache;
+            iter_opts.fill_page_cache = _opts.fill_page_cache;
             iter_opts.read_file = _rfile.get();
             iter_opts.check_dict_encoding = check_dict_enc;
             iter_opts.reader_type = _opts.reader_type;
+            iter_opts.read_buffer = _read_buffer.get();
             RETURN_IF_ERROR(_column_iterators[cid]->init(iter_opts));
+            RETURN_IF_ERROR(_try_cache_column(*f, iter_opts));
 
             if constexpr (check_global_dict) {
                 _column_decoders[cid].set_iterator(_column_iterators[cid]);
@@ -424,6 +490,25 @@ Status SegmentIterator::_init_column_iterators(const Schema& schema) {
     return Status::OK();
 }
 
+Status SegmentIterator::_try_cache_column(const Field& field, const ColumnIteratorOptions& opts) {
+    const ColumnId cid = field.id();
+    if (DecodedColumnCache::instance() == nullptr || _opts.reader_type != READER_QUERY ||
+        num_rows() > config::decoded_column_cache_max_segment_rows || _opts.global_dictmaps->count(cid) > 0) {
+        return Status::OK();
+    }
+    // The dictionary-encoded columns are still read by the codes for the low cardinality optimization.
+    if (_column_iterators[cid]->all_page_dict_encoded()) {
+        return Status::OK();
+    }
+    std::string key = DecodedColumnCache::encode_key(_segment->file_name(), cid, field.is_nullable());
+    auto* iter = new CachedColumnIterator(_column_iterators[cid], std::move(key), ChunkHelper::column_from_field(field),
+                                          num_rows());
+    _obj_pool.add(iter);
+    RETURN_IF_ERROR(iter->init(opts));
+    _column_iterators[cid] = iter;
+    return Status::OK();
+}
+
 void SegmentIterator::_init_column_predicates() {
     DCHECK_EQ(_predicate_columns, _opts.predicates.size());
     for (const auto& pair : _opts.predicates) {
@@ -748,7 +833,17 @@ inline Status SegmentIterator::_read(Chunk* chunk, vector<rowid_t>* rowids, size
     {
         _opts.stats->blocks_load += 1;
         SCOPED_RAW_TIMER(&_opts.stats->block_fetch_ns);
+        if (_read_buffer != nullptr) {
+            _pages_to_read.clear();
+            for (auto* iter : _context->_page_iterators) {
+                iter->collect_data_pages(range, &_pages_to_read);
+            }
+            RETURN_IF_ERROR(_read_buffer->load(&_pages_to_read, _opts.stats));
+        }
         RETURN_IF_ERROR(_context->read_columns(chunk, range));
+        if (_read_buffer != nullptr) {
+            _read_buffer->clear();
+        }
     }
 
     if (rowids != nullptr) {
@@ -768,6 +863,150 @@ inline Status SegmentIterator::_read(Chunk* chunk, vector<rowid_t>* rowids, size
     return Status::OK();
 }
 
+void SegmentIterator::_init_cascade_columns(ScanContext* ctx) {
+    ctx->_cascade_columns.clear();
+    if (!config::enable_segment_predicate_column_cascade) {
+        return;
+    }
+    const size_t predicate_fields = std::min<size_t>(_predicate_columns, ctx->_read_schema.num_fields());
+    size_t num_preds = 0;
+    for (size_t i = 0; i < predicate_fields; i++) {
+        const ColumnId cid = ctx->_read_schema.field(i)->id();
+        CascadeColumn column;
+        column.index = i;
+        for (const auto* preds : {&_vectorized_preds, &_branchless_preds}) {
+            for (const ColumnPredicate* pred : *preds) {
+                if (pred->column_id() == cid) {
+                    column.preds.emplace_back(pred);
+                }
+            }
+        }
+        if (!column.preds.empty()) {
+            num_preds += column.preds.size();
+            ctx->_cascade_columns.emplace_back(std::move(column));
+        }
+    }
+    // there is nothing to skip with only one predicate column, and all the predicates must be evaluated.
+    if (ctx->_cascade_columns.size() < 2 || num_preds != _vectorized_preds.size() + _branchless_preds.size()) {
+        ctx->_cascade_columns.clear();
+    }
+}
+
+Status SegmentIterator::_read_column_by_range(ScanContext* ctx, size_t index, const SparseRange& range,
+                                              Column* column) {
+    ColumnIterator* iter = ctx->_column_iterators[index];
+    if (iter->get_current_ordinal() != range.begin()) {
+        _opts.stats->block_seek_num += 1;
+        SCOPED_RAW_TIMER(&_opts.stats->block_seek_ns);
+        RETURN_IF_ERROR(iter->seek_to_ordinal(range.begin()));
+    }
+    SCOPED_RAW_TIMER(&_opts.stats->block_fetch_ns);
+    if (_read_buffer != nullptr && index < ctx->_page_iterators.size()) {
+        _pages_to_read.clear();
+        ctx->_page_iterators[index]->collect_data_pages(range, &_pages_to_read);
+        RETURN_IF_ERROR(_read_buffer->load(&_pages_to_read, _opts.stats));
+    }
+    return iter->next_batch(range, column);
+}
+
+SparseRange SegmentIterator::_selected_range(const SparseRange& range, size_t from) const {
+    SparseRange selected;
+    const uint8_t* selection = &_selection[from];
+    for (size_t i = 0; i < range.size(); i++) {
+        rowid_t row = range[i].begin();
+        while (row < range[i].end()) {
+            if (!*selection) {
+                row++;
+                selection++;
+                continue;
+            }
+            rowid_t run_begin = row;
+            while (row < range[i].end() && *selection) {
+                row++;
+                selection++;
+            }
+            selected.add(Range(run_begin, row));
+        }
+    }
+    return selected;
+}
+
+Status SegmentIterator::_read_by_column(size_t n, Chunk* chunk, vector<rowid_t>* rowids) {
+    ScanContext* ctx = _context;
+    SparseRange range;
+    _range_iter.next_range(n, &range);
+    _opts.stats->blocks_load += 1;
+    _opts.stats->raw_rows_read += range.span_size();
+
+    const size_t from = chunk->num_rows();
+    bool may_has_del_row = chunk->delete_state() != DEL_NOT_SATISFIED;
+    std::vector<size_t> read_indexes;
+    read_indexes.reserve(ctx->_read_schema.num_fields());
+    for (CascadeColumn& cascade_column : ctx->_cascade_columns) {
+        MonotonicStopWatch watch;
+        watch.start();
+        Column* column = chunk->get_column_by_index(cascade_column.index).get();
+        RETURN_IF_ERROR(_read_column_by_range(ctx, cascade_column.index, range, column));
+        may_has_del_row |= (column->delete_state() != DEL_NOT_SATISFIED);
+        read_indexes.push_back(cascade_column.index);
+
+        const size_t to = column->size();
+        DCHECK_EQ(from + range.span_size(), to);
+        {
+            SCOPED_RAW_TIMER(&_opts.stats->vec_cond_evaluate_ns);
+            cascade_column.preds[0]->evaluate(column, _selection.data(), from, to);
+            for (size_t i = 1; i < cascade_column.preds.size(); i++) {
+                cascade_column.preds[i]->evaluate_and(column, _selection.data(), from, to);
+            }
+        }
+        const size_t hit_count = SIMD::count_nonzero(&_selection[from], to - from);
+        cascade_column.rows_read += to - from;
+        cascade_column.rows_passed += hit_count;
+        _opts.stats->rows_vec_cond_filtered += to - from - hit_count;
+        if (hit_count != to - from) {
+            SCOPED_RAW_TIMER(&_opts.stats->vec_cond_chunk_copy_ns);
+            for (size_t index : read_indexes) {
+                chunk->get_column_by_index(index)->filter_range(_selection, from, to);
+            }
+            range = _selected_range(range, from);
+        }
+        cascade_column.cost_ns += watch.elapsed_time();
+        if (range.empty()) {
+            break;
+        }
+    }
+
+    if (!range.empty()) {
+        // the other columns, including the row id column of the late materialization, are read for the rows passed
+        // all the predicates.
+        for (size_t i = 0; i < ctx->_column_iterators.size(); i++) {
+            if (std::find(read_indexes.begin(), read_indexes.end(), i) != read_indexes.end()) {
+                continue;
+            }
+            Column* column = chunk->get_column_by_index(i).get();
+            RETURN_IF_ERROR(_read_column_by_range(ctx, i, range, column));
+            may_has_del_row |= (column->delete_state() != DEL_NOT_SATISFIED);
+        }
+        if (rowids != nullptr) {
+            rowids->reserve(rowids->size() + range.span_size());
+            for (size_t i = 0; i < range.size(); i++) {
+                for (rowid_t row = range[i].begin(); row < range[i].end(); row++) {
+                    rowids->push_back(row);
+                }
+            }
+        }
+    }
+    if (_read_buffer != nullptr) {
+        _read_buffer->clear();
+    }
+    chunk->set_delete_state(may_has_del_row ? DEL_PARTIAL_SATISFIED : DEL_NOT_SATISFIED);
+
+    // read the columns which reject more rows at a lower cost first.
+    std::stable_sort(ctx->_cascade_columns.begin(), ctx->_cascade_columns.end(),
+                     [](const CascadeColumn& lhs, const CascadeColumn& rhs) { return lhs.score() > rhs.score(); });
+    return Status::OK();
+}
+
 Status SegmentIterator::do_get_next(Chunk* chunk) {
     if (!_inited) {
         RETURN_IF_ERROR(_init());
@@ -832,11 +1071,18 @@ Status SegmentIterator::_do_get_next(Chunk* result, vector<rowid_t>* rowid) {
 
     if (LIKELY(!_context_switch_next_time)) {
         while ((chunk_start < chunk_capacity) & _range_iter.has_more()) {
+            size_t n = chunk_capacity - chunk_start;
             if (config::enable_segment_overflow_read_chunk) {
-                RETURN_IF_ERROR(_read(chunk, rowid, std::max(chunk_capacity - chunk_start, chunk_capacity / 4)));
-            } else {
-                RETURN_IF_ERROR(_read(chunk, rowid, chunk_capacity - chunk_start));
+                n = std::max<size_t>(n, chunk_capacity / 4);
+            }
+            if (!_context->_cascade_columns.empty()) {
+                // the predicates are evaluated while reading the columns.
+                RETURN_IF_ERROR(_read_by_column(n, chunk, rowid));
+                chunk->check_or_die();
+                chunk_start = chunk->num_rows();
+                continue;
             }
+            RETURN_IF_ERROR(_read(chunk, rowid, n));
             chunk->check_or_die();
             size_t next_start = chunk->num_rows();
 
@@ -1156,6 +1402,7 @@ Status SegmentIterator::_build_context(ScanContext* ctx) {
     for (size_t i = 0; i < early_materialize_fields; i++) {
         const FieldPtr& f = _schema.field(i);
         const ColumnId cid = f->id();
+        ctx->_page_iterators.emplace_back(_column_iterators[cid]);
         bool use_global_dict_code = _can_using_global_dict(f);
         bool use_dict_code = _can_using_dict_code(f);
 
@@ -1441,12 +1688,17 @@ Status SegmentIterator::_encode_to_global_id(ScanContext* ctx) {
 Status SegmentIterator::_init_bitmap_index_iterators() {
     DCHECK_EQ(_predicate_columns, _opts.predicates.size());
     _bitmap_index_iterators.resize(ChunkHelper::max_column_id(_schema) + 1, nullptr);
+    _inverted_index_iterators.resize(ChunkHelper::max_column_id(_schema) + 1, nullptr);
     for (const auto& pair : _opts.predicates) {
         ColumnId cid = pair.first;
         if (_bitmap_index_iterators[cid] == nullptr) {
             RETURN_IF_ERROR(_segment->new_bitmap_index_iterator(cid, &_bitmap_index_iterators[cid]));
             _has_bitmap_index |= (_bitmap_index_iterators[cid] != nullptr);
         }
+        if (_inverted_index_iterators[cid] == nullptr) {
+            RETURN_IF_ERROR(_segment->new_inverted_index_iterator(cid, &_inverted_index_iterators[cid]));
+            _has_inverted_index |= (_inverted_index_iterators[cid] != nullptr);
+        }
     }
     return Status::OK();
 }
@@ -1546,6 +1798,48 @@ Status SegmentIterator::_apply_bitmap_index() {
     return Status::OK();
 }
 
+// filter rows by evaluating column predicates using inverted indexes, which are counted as the bitmap indexes.
+// upon return, predicates that have been exactly evaluated by inverted indexes will be removed.
+Status SegmentIterator::_apply_inverted_index() {
+    DCHECK_EQ(_predicate_columns, _opts.predicates.size());
+    RETURN_IF(!_has_inverted_index || _scan_range.empty(), Status::OK());
+    SCOPED_RAW_TIMER(&_opts.stats->bitmap_index_filter_timer);
+
+    Roaring row_bitmap = range2roaring(_scan_range);
+    size_t input_rows = row_bitmap.cardinality();
+    std::vector<const ColumnPredicate*> erased_preds;
+    for (auto& [cid, pred_list] : _opts.predicates) {
+        InvertedIndexIterator* inverted_iter = _inverted_index_iterators[cid];
+        if (inverted_iter == nullptr) {
+            continue;
+        }
+        for (const ColumnPredicate* pred : pred_list) {
+            Roaring rows;
+            bool exact = false;
+            Status st = pred->seek_inverted_index(inverted_iter, &rows, &exact);
+            if (st.ok()) {
+                row_bitmap &= rows;
+                if (exact) {
+                    erased_preds.emplace_back(pred);
+                }
+            } else if (!st.is_cancelled()) {
+                return st;
+            }
+        }
+    }
+
+    if (row_bitmap.cardinality() < input_rows) {
+        _scan_range = roaring2range(row_bitmap);
+    }
+    for (const ColumnPredicate* pred : erased_preds) {
+        PredicateList& pred_list = _opts.predicates[pred->column_id()];
+        pred_list.erase(std::find(pred_list.begin(), pred_list.end(), pred));
+    }
+
+    _opts.stats->rows_bitmap_index_filtered += (input_rows - _scan_range.span_size());
+    return Status::OK();
+}
+
 Status SegmentIterator::_apply_del_vector() {
     if (_opts.is_primary_keys && _opts.version > 0 && _del_vec && !_del_vec->empty()) {
         Roaring row_bitmap = range2roaring(_scan_range);
@@ -1558,6 +1852,50 @@ Status SegmentIterator::_apply_del_vector() {
     return Status::OK();
 }
 
+Status SegmentIterator::_get_row_ranges_by_delete_predicates() {
+    RETURN_IF(_opts.delete_predicates.empty() || _scan_range.empty(), Status::OK());
+    // a row is deleted if any of the (disjunctive) delete predicates is true, i.e. all the column predicates of it
+    // are true, which is known without reading the row if each of them is true on the whole page of its column.
+    SparseRange deleted_range;
+    for (size_t i = 0; i < _opts.delete_predicates.size(); i++) {
+        const ConjunctivePredicates& del_pred = _opts.delete_predicates[i];
+        std::set<ColumnId> columns;
+        del_pred.get_column_ids(&columns);
+        SparseRange range(0, num_rows());
+        for (ColumnId cid : columns) {
+            std::vector<const ColumnPredicate*> preds;
+            del_pred.predicates_of_column(cid, &preds);
+            SparseRange full_range;
+            SparseRange partial_range;
+            ZoneMapDetail zone_map;
+            Status st = _column_iterators[cid]->classify_pages_by_zone_map(preds, &full_range, &partial_range,
+                                                                           &zone_map);
+            if (st.is_not_supported()) {
+                range.clear();
+                break;
+            }
+            RETURN_IF_ERROR(st);
+            range = range.intersection(full_range);
+            if (range.empty()) {
+                break;
+            }
+        }
+        deleted_range |= range;
+    }
+    RETURN_IF(deleted_range.empty(), Status::OK());
+    SparseRange live_range;
+    rowid_t begin = 0;
+    for (size_t i = 0; i < deleted_range.size(); i++) {
+        live_range.add(Range(begin, deleted_range[i].begin()));
+        begin = deleted_range[i].end();
+    }
+    live_range.add(Range(begin, num_rows()));
+    size_t prev_size = _scan_range.span_size();
+    _scan_range = _scan_range.intersection(live_range);
+    _opts.stats->rows_del_filtered += prev_size - _scan_range.span_size();
+    return Status::OK();
+}
+
 Status SegmentIterator::_get_row_ranges_by_bloom_filter() {
     RETURN_IF(_opts.predicates.empty(), Status::OK());
     size_t prev_size = _scan_range.span_size();
@@ -1592,6 +1930,9 @@ void SegmentIterator::close() {
     for (auto* iter : _bitmap_index_iterators) {
         delete iter;
     }
+    for (auto* iter : _inverted_index_iterators) {
+        delete iter;
+    }
 }
 
 // put the field that has predicated on it ahead of those without one, for handle late
@@ -53,6 +53,8 @@ public:
     RuntimeProfile* profile = nullptr;
 
     bool use_page_cache = false;
+    // whether to insert the data pages read into the page cache, see TabletReaderParams::fill_page_cache.
+    bool fill_page_cache = true;
 
     ReaderType reader_type = READER_QUERY;
     int chunk_size = DEFAULT_CHUNK_SIZE;
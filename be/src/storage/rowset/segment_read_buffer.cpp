@@ -0,0 +1,75 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "storage/rowset/segment_read_buffer.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "common/config.h"
+#include "common/logging.h"
+#include "fs/fs.h"
+#include "storage/olap_common.h"
+#include "util/runtime_profile.h"
+
+namespace starrocks {
+
+Status SegmentReadBuffer::load(std::vector<PagePointer>* pages, OlapReaderStatistics* stats) {
+    _ranges.clear();
+    if (pages->size() <= 1) {
+        return Status::OK();
+    }
+    std::sort(pages->begin(), pages->end(),
+              [](const PagePointer& lhs, const PagePointer& rhs) { return lhs.offset < rhs.offset; });
+
+    for (const PagePointer& pp : *pages) {
+        if (!_ranges.empty()) {
+            Range& last = _ranges.back();
+            const uint64_t end = last.offset + last.size;
+            const uint64_t new_end = std::max(end, pp.offset + pp.size);
+            if (pp.offset <= end + _max_gap && new_end - last.offset <= _max_range_bytes) {
+                last.size = new_end - last.offset;
+                last.num_pages++;
+                continue;
+            }
+        }
+        Range& range = _ranges.emplace_back();
+        range.offset = pp.offset;
+        range.size = pp.size;
+        range.num_pages = 1;
+    }
+
+    // A single page gains nothing from the buffer, so it's left to be read by its column.
+    _ranges.erase(std::remove_if(_ranges.begin(), _ranges.end(), [](const Range& r) { return r.num_pages <= 1; }),
+                  _ranges.end());
+    if (config::enable_segment_read_prefetch && _ranges.size() > 1) {
+        // the first range is read right away.
+        for (size_t i = 1; i < _ranges.size(); i++) {
+            auto st = _file->prefetch(_ranges[i].offset, _ranges[i].size);
+            LOG_IF(WARNING, !st.ok()) << "Fail to prefetch " << _file->filename() << ": " << st;
+        }
+    }
+    for (Range& range : _ranges) {
+        range.data.reset(new char[range.size]);
+        SCOPED_RAW_TIMER(&stats->io_ns);
+        RETURN_IF_ERROR(_file->read_at_fully(range.offset, range.data.get(), range.size));
+        stats->compressed_bytes_read += range.size;
+        stats->io_count++;
+    }
+    return Status::OK();
+}
+
+bool SegmentReadBuffer::read(const PagePointer& pp, char* dst) const {
+    auto iter = std::upper_bound(_ranges.begin(), _ranges.end(), pp.offset,
+                                 [](uint64_t offset, const Range& r) { return offset < r.offset; });
+    if (iter == _ranges.begin()) {
+        return false;
+    }
+    --iter;
+    if (pp.offset + pp.size > iter->offset + iter->size) {
+        return false;
+    }
+    memcpy(dst, iter->data.get() + (pp.offset - iter->offset), pp.size);
+    return true;
+}
+
+} // namespace starrocks
@@ -0,0 +1,48 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "common/status.h"
+#include "storage/rowset/page_pointer.h"
+
+namespace starrocks {
+
+class RandomAccessFile;
+struct OlapReaderStatistics;
+
+// SegmentReadBuffer coalesces the reads of the data pages of all the columns read by a SegmentIterator.
+// Before reading a row range, the pages of the range are collected from all the columns and sorted by their offsets.
+// The pages whose gaps are at most `max_gap` bytes are merged into a range of at most `max_range_bytes` bytes, and each
+// range of several pages is read in one IO. The page reads of the column iterators are then served by the buffer.
+class SegmentReadBuffer {
+public:
+    SegmentReadBuffer(RandomAccessFile* file, uint64_t max_gap, uint64_t max_range_bytes)
+            : _file(file), _max_gap(max_gap), _max_range_bytes(max_range_bytes) {}
+
+    // Read |pages| of the file into the buffer in a few IOs. The pages loaded before are released.
+    Status load(std::vector<PagePointer>* pages, OlapReaderStatistics* stats);
+
+    // Copy the page to |dst| and return true if it's loaded.
+    bool read(const PagePointer& pp, char* dst) const;
+
+    void clear() { _ranges.clear(); }
+
+private:
+    struct Range {
+        uint64_t offset = 0;
+        uint64_t size = 0;
+        size_t num_pages = 0;
+        std::unique_ptr<char[]> data;
+    };
+
+    RandomAccessFile* _file;
+    const uint64_t _max_gap;
+    const uint64_t _max_range_bytes;
+    // sorted by offset
+    std::vector<Range> _ranges;
+};
+
+} // namespace starrocks
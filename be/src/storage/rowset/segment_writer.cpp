@@ -21,22 +21,28 @@
 
 #include "storage/rowset/segment_writer.h"
 
+#include <algorithm>
 #include <memory>
 
 #include "column/chunk.h"
 #include "column/datum_tuple.h"
 #include "column/nullable_column.h"
+#include "common/config.h"
 #include "common/logging.h" // LOG
 #include "fs/fs.h"          // FileSystem
 #include "gen_cpp/segment.pb.h"
+#include "runtime/current_thread.h"
 #include "storage/rowset/column_writer.h" // ColumnWriter
+#include "storage/rowset/encoding_hints.h"
 #include "storage/rowset/page_io.h"
 #include "storage/schema.h"
 #include "storage/seek_tuple.h"
 #include "storage/short_key_index.h"
+#include "util/countdown_latch.h"
 #include "util/crc32c.h"
 #include "util/faststring.h"
 #include "util/json.h"
+#include "util/threadpool.h"
 
 namespace starrocks {
 
@@ -51,12 +57,46 @@ SegmentWriter::SegmentWriter(std::unique_ptr<WritableFile> wfile, uint32_t segme
 
 SegmentWriter::~SegmentWriter() {}
 
+// The pool encoding and compressing the columns of the segments in parallel, nullptr if disabled or failed to build.
+static ThreadPool* segment_write_pool() {
+    static std::unique_ptr<ThreadPool> pool = []() {
+        std::unique_ptr<ThreadPool> p;
+        if (config::segment_write_parallel_thread_num <= 0) {
+            return p;
+        }
+        auto st = ThreadPoolBuilder("segment_write") // segment column writer
+                          .set_min_threads(0)
+                          .set_max_threads(config::segment_write_parallel_thread_num)
+                          .set_idle_timeout(MonoDelta::FromMilliseconds(60000))
+                          .build(&p);
+        if (!st.ok()) {
+            LOG(WARNING) << "Fail to build segment write pool, the columns are written one by one: " << st;
+            p.reset();
+        }
+        return p;
+    }();
+    return pool.get();
+}
+
+// The integer columns may be encoded by PFOR, see enable_pfor_encoding.
+static EncodingTypePB default_encoding_of(FieldType type) {
+    switch (type) {
+    case OLAP_FIELD_TYPE_TINYINT:
+    case OLAP_FIELD_TYPE_SMALLINT:
+    case OLAP_FIELD_TYPE_INT:
+    case OLAP_FIELD_TYPE_BIGINT:
+        return config::enable_pfor_encoding ? PFOR_ENCODING : DEFAULT_ENCODING;
+    default:
+        return DEFAULT_ENCODING;
+    }
+}
+
 void SegmentWriter::_init_column_meta(ColumnMetaPB* meta, uint32_t column_id, const TabletColumn& column) {
     meta->set_column_id(column_id);
     meta->set_unique_id(column.unique_id());
     meta->set_type(column.type());
     meta->set_length(column.length());
-    meta->set_encoding(DEFAULT_ENCODING);
+    meta->set_encoding(default_encoding_of(column.type()));
     meta->set_compression(LZ4_FRAME);
     meta->set_is_nullable(column.is_nullable());
 
@@ -137,7 +177,14 @@ Status SegmentWriter::init(const std::vector<uint32_t>& column_indexes, bool has
             opts.need_zone_map = false;
         }
         opts.need_bloom_filter = column.is_bf_column();
+        if (opts.need_bloom_filter && (column.type() == FieldType::OLAP_FIELD_TYPE_CHAR ||
+                                       column.type() == FieldType::OLAP_FIELD_TYPE_VARCHAR)) {
+            opts.ngram_bloom_filter_gram_size = std::max<int32_t>(0, config::ngram_bloom_filter_gram_size);
+        }
         opts.need_bitmap_index = column.has_bitmap_index();
+        opts.need_inverted_index = config::enable_string_inverted_index &&
+                                   (column.type() == FieldType::OLAP_FIELD_TYPE_CHAR ||
+                                    column.type() == FieldType::OLAP_FIELD_TYPE_VARCHAR);
         if (column.type() == FieldType::OLAP_FIELD_TYPE_ARRAY) {
             if (opts.need_bloom_filter) {
                 return Status::NotSupported("Do not support bloom filter for array type");
@@ -154,6 +201,12 @@ Status SegmentWriter::init(const std::vector<uint32_t>& column_indexes, bool has
                 _global_dict_columns_valid_info[iter->first] = true;
             }
         }
+        // the columns of global dicts are speculated as before, to check whether the global dicts cover them.
+        if (_opts.encoding_hints != nullptr && opts.global_dict == nullptr &&
+            (column.type() == FieldType::OLAP_FIELD_TYPE_CHAR || column.type() == FieldType::OLAP_FIELD_TYPE_VARCHAR)) {
+            opts.encoding_hint = _opts.encoding_hints->get(column.unique_id());
+            _string_column_encodings.emplace_back(opts.meta, opts.encoding_hint);
+        }
 
         ASSIGN_OR_RETURN(auto writer, ColumnWriter::create(opts, &column, _wfile.get()));
         RETURN_IF_ERROR(writer->init());
@@ -196,6 +249,9 @@ Status SegmentWriter::finalize_columns(uint64_t* index_size) {
     }
     _num_rows_written = 0;
 
+    // encode and compress the last pages, which only touches the memory of each column writer.
+    RETURN_IF_ERROR(_for_each_column_writer(_num_rows, [this](size_t i) { return _column_writers[i]->finish(); }));
+
     size_t num_columns = _tablet_schema->num_columns();
     for (size_t i = 0; i < _column_indexes.size(); ++i) {
         uint32_t column_index = _column_indexes[i];
@@ -205,7 +261,6 @@ Status SegmentWriter::finalize_columns(uint64_t* index_size) {
         }
 
         auto& column_writer = _column_writers[i];
-        RETURN_IF_ERROR(column_writer->finish());
         // write data
         RETURN_IF_ERROR(column_writer->write_data());
         // write index
@@ -213,6 +268,7 @@ Status SegmentWriter::finalize_columns(uint64_t* index_size) {
         RETURN_IF_ERROR(column_writer->write_ordinal_index());
         RETURN_IF_ERROR(column_writer->write_zone_map());
         RETURN_IF_ERROR(column_writer->write_bitmap_index());
+        RETURN_IF_ERROR(column_writer->write_inverted_index());
         RETURN_IF_ERROR(column_writer->write_bloom_filter_index());
         *index_size += _wfile->size() - index_offset;
 
@@ -229,6 +285,16 @@ Status SegmentWriter::finalize_columns(uint64_t* index_size) {
     _column_writers.clear();
     _column_indexes.clear();
 
+    for (const auto& [meta, hint] : _string_column_encodings) {
+        // a dictionary encoded column with the pages encoded plainly after its dictionary got full.
+        if (meta->encoding() == DICT_ENCODING && !meta->all_dict_encoded()) {
+            _opts.encoding_hints->update(meta->unique_id(), hint, PLAIN_ENCODING);
+        } else if (meta->encoding() == DICT_ENCODING || meta->encoding() == PLAIN_ENCODING) {
+            _opts.encoding_hints->update(meta->unique_id(), hint, meta->encoding());
+        }
+    }
+    _string_column_encodings.clear();
+
     if (_has_key) {
         uint64_t index_offset = _wfile->size();
         RETURN_IF_ERROR(_write_short_key_index());
@@ -284,12 +350,55 @@ Status SegmentWriter::_write_raw_data(const std::vector<Slice>& slices) {
     return Status::OK();
 }
 
+Status SegmentWriter::_for_each_column_writer(size_t num_rows, const std::function<Status(size_t)>& func) {
+    const size_t num_writers = _column_writers.size();
+    ThreadPool* pool = nullptr;
+    if (num_writers >= std::max(config::segment_write_parallel_min_columns, 2) &&
+        num_rows >= config::segment_write_parallel_min_rows) {
+        pool = segment_write_pool();
+    }
+    if (pool == nullptr) {
+        for (size_t i = 0; i < num_writers; ++i) {
+            RETURN_IF_ERROR(func(i));
+        }
+        return Status::OK();
+    }
+
+    // the writers are assigned to the tasks round-robin, the last task is run by the calling thread.
+    const size_t num_tasks = std::min<size_t>(config::segment_write_parallel_thread_num + 1, num_writers);
+    std::vector<Status> statuses(num_tasks);
+    MemTracker* mem_tracker = CurrentThread::mem_tracker();
+    auto run_task = [&](size_t task) {
+        SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(mem_tracker);
+        for (size_t i = task; i < num_writers && statuses[task].ok(); i += num_tasks) {
+            statuses[task] = func(i);
+        }
+    };
+    CountDownLatch latch(num_tasks - 1);
+    for (size_t task = 0; task + 1 < num_tasks; ++task) {
+        auto st = pool->submit_func([&, task]() {
+            run_task(task);
+            latch.count_down();
+        });
+        if (!st.ok()) {
+            run_task(task);
+            latch.count_down();
+        }
+    }
+    run_task(num_tasks - 1);
+    latch.wait();
+    for (auto& st : statuses) {
+        RETURN_IF_ERROR(st);
+    }
+    return Status::OK();
+}
+
 Status SegmentWriter::append_chunk(const vectorized::Chunk& chunk) {
     DCHECK_EQ(_column_writers.size(), chunk.num_columns());
-    for (size_t i = 0; i < _column_writers.size(); ++i) {
-        const vectorized::Column* col = chunk.get_column_by_index(i).get();
-        RETURN_IF_ERROR(_column_writers[i]->append(*col));
-    }
+    // the column writers buffer the pages in memory until finalized, so they can be appended concurrently.
+    RETURN_IF_ERROR(_for_each_column_writer(chunk.num_rows(), [&](size_t i) {
+        return _column_writers[i]->append(*chunk.get_column_by_index(i));
+    }));
 
     size_t chunk_num_rows = chunk.num_rows();
     if (_has_key) {
@@ -22,6 +22,7 @@
 #pragma once
 
 #include <cstdint>
+#include <functional>
 #include <memory> // unique_ptr
 #include <string>
 #include <vector>
@@ -45,6 +46,7 @@ class Chunk;
 }
 
 class ColumnWriter;
+class EncodingHints;
 
 extern const char* const k_segment_magic;
 extern const uint32_t k_segment_magic_length;
@@ -54,6 +56,8 @@ struct SegmentWriterOptions {
     uint32_t num_rows_per_block = 1024;
     vectorized::GlobalDictByNameMaps* global_dicts = nullptr;
     std::vector<int32_t> referenced_column_ids;
+    // the encodings of the string columns of the previous segments, see EncodingHints.
+    EncodingHints* encoding_hints = nullptr;
 };
 
 // SegmentWriter is responsible for writing data into single segment by all or partital columns.
@@ -120,6 +124,10 @@ private:
     Status _write_footer();
     Status _write_raw_data(const std::vector<Slice>& slices);
     void _init_column_meta(ColumnMetaPB* meta, uint32_t column_id, const TabletColumn& column);
+    // Call |func| with the index of each column writer, on the threads of the segment write pool if there are
+    // at least `segment_write_parallel_min_columns` column writers and |num_rows| is at least
+    // `segment_write_parallel_min_rows`. Return the first error.
+    Status _for_each_column_writer(size_t num_rows, const std::function<Status(size_t)>& func);
 
     uint32_t _segment_id;
     const TabletSchema* _tablet_schema;
@@ -131,6 +139,8 @@ private:
     std::unique_ptr<ShortKeyIndexBuilder> _index_builder;
     std::vector<std::unique_ptr<ColumnWriter>> _column_writers;
     std::vector<uint32_t> _column_indexes;
+    // the meta and the encoding hint of each string column, used to update `_opts.encoding_hints` when finalized.
+    std::vector<std::pair<ColumnMetaPB*, EncodingTypePB>> _string_column_encodings;
     bool _has_key = true;
 
     // num rows written when appending [partial] columns
@@ -64,11 +64,11 @@ class ZoneMapIndexWriterImpl final : public ZoneMapIndexWriter {
     using CppType = typename TypeTraits<type>::CppType;
 
 public:
-    explicit ZoneMapIndexWriterImpl(starrocks::Field* field);
+    ZoneMapIndexWriterImpl(starrocks::Field* field, uint32_t block_num_rows);
 
     void add_values(const void* values, size_t count) override;
 
-    void add_nulls(uint32_t count) override { _page_zone_map.has_null |= count > 0; }
+    void add_nulls(uint32_t count) override;
 
     // mark the end of one data page so that we can finalize the corresponding zone map
     Status flush() override;
@@ -86,6 +86,10 @@ private:
         zone_map->has_not_null = false;
     }
 
+    void _add_values(ZoneMap* zone_map, const CppType* values, size_t count);
+
+    void _flush_block();
+
     Field* _field;
     // memory will be managed by MemPool
     ZoneMap _page_zone_map;
@@ -97,33 +101,92 @@ private:
     // serialized ZoneMapPB for each data page
     std::vector<std::string> _values;
     uint64_t _estimated_size = 0;
+
+    // 0 means no block zone maps
+    const uint32_t _block_num_rows;
+    uint32_t _block_rows = 0;
+    ZoneMap _block_zone_map;
+    // serialized ZoneMapPB for each block of |_block_num_rows| rows
+    std::vector<std::string> _block_values;
 };
 
 template <FieldType type>
-ZoneMapIndexWriterImpl<type>::ZoneMapIndexWriterImpl(Field* field) : _field(field) {
+ZoneMapIndexWriterImpl<type>::ZoneMapIndexWriterImpl(Field* field, uint32_t block_num_rows)
+        : _field(field), _block_num_rows(block_num_rows) {
     _page_zone_map.min_value = _field->allocate_value(&_pool);
     _page_zone_map.max_value = _field->allocate_value(&_pool);
     _reset_zone_map(&_page_zone_map);
     _segment_zone_map.min_value = _field->allocate_value(&_pool);
     _segment_zone_map.max_value = _field->allocate_value(&_pool);
     _reset_zone_map(&_segment_zone_map);
+    if (_block_num_rows > 0) {
+        _block_zone_map.min_value = _field->allocate_value(&_pool);
+        _block_zone_map.max_value = _field->allocate_value(&_pool);
+        _reset_zone_map(&_block_zone_map);
+    }
 }
 
 template <FieldType type>
-void ZoneMapIndexWriterImpl<type>::add_values(const void* values, size_t count) {
+void ZoneMapIndexWriterImpl<type>::_add_values(ZoneMap* zone_map, const CppType* vals, size_t count) {
     if (count > 0) {
-        _page_zone_map.has_not_null = true;
-        const CppType* vals = reinterpret_cast<const CppType*>(values);
+        zone_map->has_not_null = true;
         auto [pmin, pmax] = std::minmax_element(vals, vals + count);
-        if (unaligned_load<CppType>(pmin) < unaligned_load<CppType>(_page_zone_map.min_value)) {
-            _field->type_info()->direct_copy(_page_zone_map.min_value, pmin, nullptr);
+        if (unaligned_load<CppType>(pmin) < unaligned_load<CppType>(zone_map->min_value)) {
+            _field->type_info()->direct_copy(zone_map->min_value, pmin, nullptr);
+        }
+        if (unaligned_load<CppType>(pmax) > unaligned_load<CppType>(zone_map->max_value)) {
+            _field->type_info()->direct_copy(zone_map->max_value, pmax, nullptr);
+        }
+    }
+}
+
+template <FieldType type>
+void ZoneMapIndexWriterImpl<type>::add_values(const void* values, size_t count) {
+    const CppType* vals = reinterpret_cast<const CppType*>(values);
+    _add_values(&_page_zone_map, vals, count);
+    if (_block_num_rows == 0) {
+        return;
+    }
+    while (count > 0) {
+        const size_t n = std::min<size_t>(count, _block_num_rows - _block_rows);
+        _add_values(&_block_zone_map, vals, n);
+        vals += n;
+        count -= n;
+        _block_rows += n;
+        if (_block_rows == _block_num_rows) {
+            _flush_block();
         }
-        if (unaligned_load<CppType>(pmax) > unaligned_load<CppType>(_page_zone_map.max_value)) {
-            _field->type_info()->direct_copy(_page_zone_map.max_value, pmax, nullptr);
+    }
+}
+
+template <FieldType type>
+void ZoneMapIndexWriterImpl<type>::add_nulls(uint32_t count) {
+    _page_zone_map.has_null |= count > 0;
+    if (_block_num_rows == 0) {
+        return;
+    }
+    while (count > 0) {
+        const uint32_t n = std::min(count, _block_num_rows - _block_rows);
+        _block_zone_map.has_null = true;
+        count -= n;
+        _block_rows += n;
+        if (_block_rows == _block_num_rows) {
+            _flush_block();
         }
     }
 }
 
+template <FieldType type>
+void ZoneMapIndexWriterImpl<type>::_flush_block() {
+    ZoneMapPB zone_map_pb;
+    _block_zone_map.to_proto(&zone_map_pb, _field);
+    _reset_zone_map(&_block_zone_map);
+    _block_rows = 0;
+    std::string serialized_zone_map = zone_map_pb.SerializeAsString();
+    _estimated_size += serialized_zone_map.size() + sizeof(uint32_t);
+    _block_values.push_back(std::move(serialized_zone_map));
+}
+
 template <FieldType type>
 Status ZoneMapIndexWriterImpl<type>::flush() {
     // Update segment zone map.
@@ -156,23 +219,17 @@ Status ZoneMapIndexWriterImpl<type>::flush() {
 
 struct ZoneMapIndexWriterBuilder {
     template <FieldType ftype>
-    std::unique_ptr<ZoneMapIndexWriter> operator()(Field* field) {
-        return std::make_unique<ZoneMapIndexWriterImpl<ftype>>(field);
+    std::unique_ptr<ZoneMapIndexWriter> operator()(Field* field, uint32_t block_num_rows) {
+        return std::make_unique<ZoneMapIndexWriterImpl<ftype>>(field, block_num_rows);
     }
 };
 
-std::unique_ptr<ZoneMapIndexWriter> ZoneMapIndexWriter::create(starrocks::Field* field) {
-    return field_type_dispatch_zonemap_index(field->type(), ZoneMapIndexWriterBuilder(), field);
+std::unique_ptr<ZoneMapIndexWriter> ZoneMapIndexWriter::create(starrocks::Field* field, uint32_t block_num_rows) {
+    return field_type_dispatch_zonemap_index(field->type(), ZoneMapIndexWriterBuilder(), field, block_num_rows);
 }
 
-template <FieldType type>
-Status ZoneMapIndexWriterImpl<type>::finish(WritableFile* wfile, ColumnIndexMetaPB* index_meta) {
-    index_meta->set_type(ZONE_MAP_INDEX);
-    ZoneMapIndexPB* meta = index_meta->mutable_zone_map_index();
-    // store segment zone map
-    _segment_zone_map.to_proto(meta->mutable_segment_zone_map(), _field);
-
-    // write out zone map for each data pages
+static Status write_zone_maps(WritableFile* wfile, const std::vector<std::string>& values,
+                              IndexedColumnMetaPB* meta) {
     TypeInfoPtr typeinfo = get_type_info(OLAP_FIELD_TYPE_OBJECT);
     IndexedColumnWriterOptions options;
     options.write_ordinal_index = true;
@@ -183,11 +240,32 @@ Status ZoneMapIndexWriterImpl<type>::finish(WritableFile* wfile, ColumnIndexMeta
     IndexedColumnWriter writer(options, typeinfo, wfile);
     RETURN_IF_ERROR(writer.init());
 
-    for (auto& value : _values) {
+    for (auto& value : values) {
         Slice value_slice(value);
         RETURN_IF_ERROR(writer.add(&value_slice));
     }
-    return writer.finish(meta->mutable_page_zone_maps());
+    return writer.finish(meta);
+}
+
+template <FieldType type>
+Status ZoneMapIndexWriterImpl<type>::finish(WritableFile* wfile, ColumnIndexMetaPB* index_meta) {
+    index_meta->set_type(ZONE_MAP_INDEX);
+    ZoneMapIndexPB* meta = index_meta->mutable_zone_map_index();
+    // store segment zone map
+    _segment_zone_map.to_proto(meta->mutable_segment_zone_map(), _field);
+
+    // write out zone map for each data pages
+    RETURN_IF_ERROR(write_zone_maps(wfile, _values, meta->mutable_page_zone_maps()));
+
+    // write out zone map for each block
+    if (_block_num_rows > 0) {
+        if (_block_rows > 0) {
+            _flush_block();
+        }
+        meta->set_block_num_rows(_block_num_rows);
+        RETURN_IF_ERROR(write_zone_maps(wfile, _block_values, meta->mutable_block_zone_maps()));
+    }
+    return Status::OK();
 }
 
 StatusOr<bool> ZoneMapIndexReader::load(FileSystem* fs, const std::string& filename, const ZoneMapIndexPB& meta,
@@ -218,15 +296,15 @@ StatusOr<bool> ZoneMapIndexReader::load(FileSystem* fs, const std::string& filen
     }
 }
 
-Status ZoneMapIndexReader::do_load(FileSystem* fs, const std::string& filename, const ZoneMapIndexPB& meta,
-                                   bool use_page_cache, bool kept_in_memory) {
-    IndexedColumnReader reader(fs, filename, meta.page_zone_maps());
+static Status load_zone_maps(FileSystem* fs, const std::string& filename, const IndexedColumnMetaPB& meta,
+                             bool use_page_cache, bool kept_in_memory, std::vector<ZoneMapPB>* zone_maps) {
+    IndexedColumnReader reader(fs, filename, meta);
     RETURN_IF_ERROR(reader.load(use_page_cache, kept_in_memory));
     std::unique_ptr<IndexedColumnIterator> iter;
     RETURN_IF_ERROR(reader.new_iterator(&iter));
 
     MemPool pool;
-    _page_zone_maps.resize(reader.num_values());
+    zone_maps->resize(reader.num_values());
 
     // read and cache all page zone maps
     for (int i = 0; i < reader.num_values(); ++i) {
@@ -242,7 +320,7 @@ Status ZoneMapIndexReader::do_load(FileSystem* fs, const std::string& filename,
         DCHECK(num_to_read == num_read);
 
         auto* value = reinterpret_cast<Slice*>(cvb->data());
-        if (!_page_zone_maps[i].ParseFromArray(value->data, value->size)) {
+        if (!(*zone_maps)[i].ParseFromArray(value->data, value->size)) {
             return Status::Corruption("Failed to parse zone map");
         }
         pool.clear();
@@ -250,12 +328,28 @@ Status ZoneMapIndexReader::do_load(FileSystem* fs, const std::string& filename,
     return Status::OK();
 }
 
+Status ZoneMapIndexReader::do_load(FileSystem* fs, const std::string& filename, const ZoneMapIndexPB& meta,
+                                   bool use_page_cache, bool kept_in_memory) {
+    RETURN_IF_ERROR(
+            load_zone_maps(fs, filename, meta.page_zone_maps(), use_page_cache, kept_in_memory, &_page_zone_maps));
+    if (meta.has_block_zone_maps() && meta.block_num_rows() > 0) {
+        RETURN_IF_ERROR(load_zone_maps(fs, filename, meta.block_zone_maps(), use_page_cache, kept_in_memory,
+                                       &_block_zone_maps));
+        _block_num_rows = meta.block_num_rows();
+    }
+    return Status::OK();
+}
+
 size_t ZoneMapIndexReader::mem_usage() const {
     size_t size = sizeof(ZoneMapIndexReader);
     size += _page_zone_maps.capacity() * sizeof(_page_zone_maps[0]);
     for (const auto& zone_map : _page_zone_maps) {
         size += zone_map.SpaceUsedLong();
     }
+    size += _block_zone_maps.capacity() * sizeof(ZoneMapPB);
+    for (const auto& zone_map : _block_zone_maps) {
+        size += zone_map.SpaceUsedLong();
+    }
     return size;
 }
 
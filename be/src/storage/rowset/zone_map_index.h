@@ -43,9 +43,11 @@ class WritableFile;
 // The IndexedColumn stores serialized ZoneMapPB for each data page.
 // It also create and store the segment-level zone map in the index meta so that
 // reader can prune an entire segment without reading pages.
+// If |block_num_rows| is not 0, another IndexedColumn stores the zone map for each block of |block_num_rows| rows,
+// which prunes the rows inside a page.
 class ZoneMapIndexWriter {
 public:
-    static std::unique_ptr<ZoneMapIndexWriter> create(starrocks::Field* field);
+    static std::unique_ptr<ZoneMapIndexWriter> create(starrocks::Field* field, uint32_t block_num_rows = 0);
 
     virtual ~ZoneMapIndexWriter() = default;
 
@@ -82,6 +84,13 @@ public:
     // REQUIRES: the index data has been successfully `load()`ed into memory.
     int32_t num_pages() const { return _page_zone_maps.size(); }
 
+    // REQUIRES: the index data has been successfully `load()`ed into memory.
+    // The zone map of the i-th block covers the rows [i * block_num_rows(), (i + 1) * block_num_rows()).
+    const std::vector<ZoneMapPB>& block_zone_maps() const { return _block_zone_maps; }
+
+    // 0 if there is no block zone maps.
+    uint32_t block_num_rows() const { return _block_num_rows; }
+
     size_t mem_usage() const;
 
     bool loaded() const { return _state.load(std::memory_order_acquire) == kLoaded; }
@@ -98,6 +107,8 @@ private:
 
     std::atomic<State> _state;
     std::vector<ZoneMapPB> _page_zone_maps;
+    std::vector<ZoneMapPB> _block_zone_maps;
+    uint32_t _block_num_rows = 0;
 };
 
 } // namespace starrocks
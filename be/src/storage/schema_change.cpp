@@ -1581,6 +1581,13 @@ Status SchemaChangeHandler::_convert_historical_rowsets(SchemaChangeParams& sc_p
     return status;
 }
 
+// Whether |new_column| only widens the VARCHAR |ref_column|, whose values are stored as they are whatever the length,
+// so the segments of |ref_column| are read as the segments of |new_column| without being rewritten.
+static bool is_varchar_widened(const TabletColumn& ref_column, const TabletColumn& new_column) {
+    return ref_column.type() == OLAP_FIELD_TYPE_VARCHAR && new_column.type() == OLAP_FIELD_TYPE_VARCHAR &&
+           new_column.length() > ref_column.length() && new_column.index_length() == ref_column.index_length();
+}
+
 Status SchemaChangeHandler::_parse_request(
         const std::shared_ptr<Tablet>& base_tablet, const std::shared_ptr<Tablet>& new_tablet,
         ChunkChanger* chunk_changer, bool* sc_sorting, bool* sc_directly,
@@ -1711,7 +1718,8 @@ Status SchemaChangeHandler::_parse_request(
                        (new_column.precision() != ref_column.precision() || new_column.scale() != ref_column.scale())) {
                 *sc_directly = true;
                 return Status::OK();
-            } else if (new_column.length() != ref_column.length()) {
+            } else if (new_column.length() != ref_column.length() &&
+                       !is_varchar_widened(ref_column, new_column)) {
                 *sc_directly = true;
                 return Status::OK();
             } else if (new_column.is_bf_column() != ref_column.is_bf_column()) {
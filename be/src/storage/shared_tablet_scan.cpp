@@ -0,0 +1,280 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "storage/shared_tablet_scan.h"
+
+#include <fmt/format.h>
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+
+#include "column/chunk.h"
+#include "common/config.h"
+#include "storage/chunk_helper.h"
+#include "storage/tablet_reader.h"
+
+namespace starrocks::vectorized {
+
+bool can_share_tablet_scan(const TabletReaderParams& params) {
+    return params.reader_type == READER_QUERY && params.start_key.empty() && params.end_key.empty() &&
+           params.predicates.empty() && params.rowid_range_option == nullptr && params.short_key_ranges.empty() &&
+           params.global_dictmaps->empty() && params.unused_output_column_ids->empty();
+}
+
+// The chunks of a tablet read by one TabletReader, shared by the SharedTabletScanIterators of the same key.
+// The chunks are numbered by the sequence in which they are read, and a chunk is at the same position of every
+// pass over the tablet, since the TabletReaders created with the same params read the same chunks in the same order.
+class SharedTabletScan {
+public:
+    // The read progress of a SharedTabletScanIterator.
+    struct Cursor {
+        // the sequence of the next chunk to read.
+        int64_t next_seq = 0;
+        // the position of the first chunk read, -1 if no chunk has been read.
+        int64_t start_position = -1;
+        int64_t num_read = 0;
+    };
+
+    SharedTabletScan(std::string key, TabletSharedPtr tablet, const Version& version, Schema schema,
+                     const TabletReaderParams& params)
+            : _key(std::move(key)),
+              _tablet(std::move(tablet)),
+              _version(version),
+              _schema(std::move(schema)),
+              _params(params) {}
+
+    ~SharedTabletScan();
+
+    static std::shared_ptr<SharedTabletScan> attach(TabletSharedPtr tablet, const Version& version,
+                                                    const Schema& schema, const TabletReaderParams& params,
+                                                    Cursor* cursor);
+
+    // Set |chunk| to the next chunk of |cursor|.
+    // Return EndOfFile if all the chunks of the tablet have been read by |cursor|, and NotFound if the next chunk has
+    // been evicted, with |cycle| set to the number of the chunks of the tablet, or -1 if unknown yet.
+    Status next(Cursor* cursor, ChunkPtr* chunk, int64_t* cycle);
+
+    StatusOr<std::unique_ptr<TabletReader>> new_reader() const;
+
+private:
+    struct Entry {
+        ChunkPtr chunk;
+        int64_t position;
+    };
+
+    const std::string _key;
+    const TabletSharedPtr _tablet;
+    const Version _version;
+    const Schema _schema;
+    const TabletReaderParams _params;
+
+    std::mutex _mutex;
+    std::condition_variable _cv;
+    Status _status;
+    // only the thread which set |_producing| reads from |_reader|.
+    bool _producing = false;
+    std::unique_ptr<TabletReader> _reader;
+    std::deque<Entry> _chunks;
+    // the sequence of |_chunks.front()|.
+    int64_t _front_seq = 0;
+    // the sequence of the next chunk to read.
+    int64_t _next_seq = 0;
+    // the position of the next chunk to read in the current pass.
+    int64_t _next_position = 0;
+    // the number of the chunks of the tablet, known after the first pass.
+    int64_t _cycle = -1;
+};
+
+static std::mutex g_shared_scans_mutex;
+static std::unordered_map<std::string, std::weak_ptr<SharedTabletScan>> g_shared_scans;
+
+SharedTabletScan::~SharedTabletScan() {
+    std::lock_guard<std::mutex> l(g_shared_scans_mutex);
+    auto iter = g_shared_scans.find(_key);
+    if (iter != g_shared_scans.end() && iter->second.expired()) {
+        g_shared_scans.erase(iter);
+    }
+}
+
+std::shared_ptr<SharedTabletScan> SharedTabletScan::attach(TabletSharedPtr tablet, const Version& version,
+                                                           const Schema& schema, const TabletReaderParams& params,
+                                                           Cursor* cursor) {
+    std::string key = fmt::format("{}:{}:{}:{}:{}", tablet->full_name(), version.second, params.skip_aggregation,
+                                  params.chunk_size, params.use_page_cache);
+    for (const auto& field : schema.fields()) {
+        key.append(fmt::format(":{}", field->id()));
+    }
+
+    std::shared_ptr<SharedTabletScan> scan;
+    {
+        std::lock_guard<std::mutex> l(g_shared_scans_mutex);
+        auto& entry = g_shared_scans[key];
+        scan = entry.lock();
+        if (scan == nullptr) {
+            TabletReaderParams shared_params = params;
+            // the shared reader may outlive the query creating it.
+            shared_params.runtime_state = nullptr;
+            shared_params.profile = nullptr;
+            shared_params.global_dictmaps = &EMPTY_GLOBAL_DICTMAPS;
+            shared_params.unused_output_column_ids = &EMPTY_FILTERED_COLUMN_IDS;
+            scan = std::make_shared<SharedTabletScan>(key, std::move(tablet), version, schema, shared_params);
+            entry = scan;
+        }
+    }
+    std::lock_guard<std::mutex> l(scan->_mutex);
+    // start from the oldest buffered chunk.
+    cursor->next_seq = scan->_front_seq;
+    return scan;
+}
+
+StatusOr<std::unique_ptr<TabletReader>> SharedTabletScan::new_reader() const {
+    auto reader = std::make_unique<TabletReader>(_tablet, _version, _schema);
+    RETURN_IF_ERROR(reader->prepare());
+    RETURN_IF_ERROR(reader->open(_params));
+    return std::move(reader);
+}
+
+Status SharedTabletScan::next(Cursor* cursor, ChunkPtr* chunk, int64_t* cycle) {
+    std::unique_lock<std::mutex> l(_mutex);
+    while (true) {
+        RETURN_IF_ERROR(_status);
+        *cycle = _cycle;
+        if (_cycle >= 0 && cursor->num_read >= _cycle) {
+            return Status::EndOfFile("end of shared tablet scan");
+        }
+        if (cursor->next_seq < _front_seq) {
+            return Status::NotFound("evicted chunk of shared tablet scan");
+        }
+        if (cursor->next_seq < _next_seq) {
+            const Entry& entry = _chunks[cursor->next_seq - _front_seq];
+            if (cursor->start_position < 0) {
+                cursor->start_position = entry.position;
+            }
+            cursor->next_seq++;
+            cursor->num_read++;
+            *chunk = entry.chunk;
+            return Status::OK();
+        }
+        if (_producing) {
+            _cv.wait(l);
+            continue;
+        }
+
+        // read the next chunk for all the scans.
+        _producing = true;
+        l.unlock();
+        Status st;
+        ChunkPtr produced;
+        if (_reader == nullptr) {
+            auto res = new_reader();
+            st = res.status();
+            if (st.ok()) {
+                _reader = std::move(res).value();
+            }
+        }
+        if (st.ok()) {
+            produced = ChunkHelper::new_chunk(_schema, _params.chunk_size);
+            st = _reader->get_next(produced.get());
+        }
+        l.lock();
+        _producing = false;
+        if (st.is_end_of_file()) {
+            // wrap around to the beginning of the tablet.
+            _cycle = _next_position;
+            _next_position = 0;
+            _reader.reset();
+        } else if (!st.ok()) {
+            _status = st;
+        } else {
+            _chunks.push_back(Entry{std::move(produced), _next_position++});
+            _next_seq++;
+            const auto max_chunks = static_cast<size_t>(std::max(config::shared_tablet_scan_max_buffered_chunks, 1));
+            while (_chunks.size() > max_chunks) {
+                _chunks.pop_front();
+                _front_seq++;
+            }
+        }
+        _cv.notify_all();
+    }
+}
+
+class SharedTabletScanIterator final : public ChunkIterator {
+public:
+    SharedTabletScanIterator(TabletSharedPtr tablet, const Version& version, Schema schema,
+                             const TabletReaderParams& params)
+            : ChunkIterator(std::move(schema), params.chunk_size) {
+        _scan = SharedTabletScan::attach(std::move(tablet), version, _schema, params, &_cursor);
+    }
+
+    void close() override {
+        _private_reader.reset();
+        _scan.reset();
+    }
+
+protected:
+    Status do_get_next(Chunk* chunk) override;
+
+private:
+    // Whether the chunk at |position| has been read from the shared scan.
+    bool _has_read(int64_t position) const;
+
+    // Read the chunks not read yet by a private reader.
+    Status _read_private(Chunk* chunk);
+
+    std::shared_ptr<SharedTabletScan> _scan;
+    SharedTabletScan::Cursor _cursor;
+
+    // used after falling behind the shared scan.
+    std::unique_ptr<TabletReader> _private_reader;
+    int64_t _private_position = 0;
+    int64_t _cycle = -1;
+    ChunkPtr _private_chunk;
+};
+
+Status SharedTabletScanIterator::do_get_next(Chunk* chunk) {
+    if (_private_reader != nullptr) {
+        return _read_private(chunk);
+    }
+    ChunkPtr shared;
+    Status st = _scan->next(&_cursor, &shared, &_cycle);
+    if (st.is_not_found()) {
+        // the chunks evicted are read again by a private reader, which skips the chunks already read.
+        ASSIGN_OR_RETURN(_private_reader, _scan->new_reader());
+        _private_chunk = ChunkHelper::new_chunk(_schema, _chunk_size);
+        return _read_private(chunk);
+    }
+    RETURN_IF_ERROR(st);
+    chunk->append(*shared);
+    return Status::OK();
+}
+
+bool SharedTabletScanIterator::_has_read(int64_t position) const {
+    if (_cursor.start_position < 0) {
+        return false;
+    }
+    // the scan hasn't wrapped around if the number of the chunks is unknown.
+    if (_cycle < 0) {
+        return position >= _cursor.start_position && position < _cursor.start_position + _cursor.num_read;
+    }
+    return (position - _cursor.start_position + _cycle) % _cycle < _cursor.num_read;
+}
+
+Status SharedTabletScanIterator::_read_private(Chunk* chunk) {
+    while (true) {
+        _private_chunk->reset();
+        RETURN_IF_ERROR(_private_reader->get_next(_private_chunk.get()));
+        if (!_has_read(_private_position++)) {
+            chunk->append(*_private_chunk);
+            return Status::OK();
+        }
+    }
+}
+
+ChunkIteratorPtr new_shared_tablet_scan_iterator(TabletSharedPtr tablet, const Version& version, Schema schema,
+                                                 const TabletReaderParams& params) {
+    DCHECK(can_share_tablet_scan(params));
+    return std::make_shared<SharedTabletScanIterator>(std::move(tablet), version, std::move(schema), params);
+}
+
+} // namespace starrocks::vectorized
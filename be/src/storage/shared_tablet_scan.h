@@ -0,0 +1,26 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include "storage/chunk_iterator.h"
+#include "storage/olap_common.h"
+#include "storage/tablet.h"
+#include "storage/tablet_reader_params.h"
+
+namespace starrocks::vectorized {
+
+// Whether the scan of |params| can share the chunks read by the other scans, i.e. it reads the whole tablet without
+// key ranges, splits, global dicts or predicates evaluated by the storage.
+bool can_share_tablet_scan(const TabletReaderParams& params);
+
+// Return an iterator reading the rows of the |schema| columns of |tablet| in |version| once.
+// The concurrent iterators of the same tablet, version and columns attach to one shared TabletReader created with
+// |params|, and each of them gets a copy of the chunks read by it. An iterator attached to a running scan starts from
+// the oldest chunk still buffered, and wraps around to the beginning of the tablet after reaching its end.
+// The scans run at the pace of the slowest one, which holds at most `shared_tablet_scan_max_buffered_chunks` chunks
+// back.
+// prerequisite: `can_share_tablet_scan(params)` is true.
+ChunkIteratorPtr new_shared_tablet_scan_iterator(TabletSharedPtr tablet, const Version& version, Schema schema,
+                                                 const TabletReaderParams& params);
+
+} // namespace starrocks::vectorized
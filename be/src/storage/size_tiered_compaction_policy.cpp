@@ -0,0 +1,147 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "storage/size_tiered_compaction_policy.h"
+
+#include <algorithm>
+
+#include "common/config.h"
+#include "storage/compaction_task.h"
+#include "storage/compaction_task_factory.h"
+#include "storage/rowset/rowset.h"
+#include "util/time.h"
+
+namespace starrocks {
+
+bool SizeTieredCompactionPolicy::need_compaction() {
+    _init_rowsets();
+    Window cumulative = _pick_window(false);
+    Window base = _pick_window(true);
+    // too many sources slow down the queries whatever the compaction costs.
+    const double read_amplification_score =
+            static_cast<double>(_num_sources) /
+            static_cast<double>(std::max<int64_t>(config::size_tiered_compaction_max_read_amplification, 1));
+    if (cumulative.end > cumulative.begin && cumulative.score >= base.score) {
+        cumulative.score = std::max(cumulative.score, read_amplification_score);
+    } else if (base.end > base.begin) {
+        base.score = std::max(base.score, read_amplification_score);
+    }
+    _compaction_context->cumulative_score = cumulative.score;
+    _compaction_context->base_score = base.score;
+
+    VLOG(2) << "need_compaction compaction context:" << _compaction_context->to_string();
+    return _compaction_context->cumulative_score > COMPACTION_SCORE_THRESHOLD ||
+           _compaction_context->base_score > COMPACTION_SCORE_THRESHOLD;
+}
+
+std::shared_ptr<CompactionTask> SizeTieredCompactionPolicy::create_compaction() {
+    VLOG(2) << "compaction context:" << _compaction_context->to_string();
+    const CompactionType type = _compaction_context->chosen_compaction_type;
+    if (type != CUMULATIVE_COMPACTION && type != BASE_COMPACTION) {
+        LOG(WARNING) << "invalid compaction type:" << type << ", tablet:" << _compaction_context->tablet->tablet_id();
+        return nullptr;
+    }
+    return _create_compaction(type);
+}
+
+void SizeTieredCompactionPolicy::_init_rowsets() {
+    _rowsets.clear();
+    _num_sources = 0;
+    for (const auto& level : _compaction_context->rowset_levels) {
+        for (Rowset* rowset : level) {
+            _rowsets.emplace_back(rowset);
+            _num_sources += rowset->rowset_meta()->get_compaction_score();
+        }
+    }
+    std::sort(_rowsets.begin(), _rowsets.end(), RowsetComparator());
+    _has_base = !_rowsets.empty() && _rowsets[0]->start_version() == 0;
+
+    // newly created deltas may still be queried by the plans made before they were published.
+    const int64_t now = UnixSeconds();
+    for (size_t i = 1; i < _rowsets.size(); i++) {
+        Rowset* rowset = _rowsets[i];
+        if (rowset->start_version() == rowset->end_version() &&
+            rowset->creation_time() + config::cumulative_compaction_skip_window_seconds > now) {
+            _rowsets.resize(i);
+            break;
+        }
+    }
+}
+
+SizeTieredCompactionPolicy::Window SizeTieredCompactionPolicy::_pick_window(bool base) const {
+    Window best;
+    if (base && !_has_base) {
+        return best;
+    }
+    const auto& tablet = _compaction_context->tablet;
+    const int64_t level_multiple = std::max<int64_t>(config::size_tiered_compaction_level_multiple, 1);
+    const int64_t min_level_size = std::max<int64_t>(config::size_tiered_compaction_min_level_size, 1);
+    const int64_t bytes_per_source = std::max<int64_t>(config::size_tiered_compaction_bytes_per_source, 1);
+    const auto max_sources = static_cast<size_t>(base ? config::max_base_compaction_num_singleton_deltas
+                                                      : config::max_cumulative_compaction_num_singleton_deltas);
+    const size_t first = base ? 0 : (_has_base ? 1 : 0);
+    const size_t last = base ? std::min<size_t>(1, _rowsets.size()) : _rowsets.size();
+    for (size_t begin = first; begin < last; begin++) {
+        // a cumulative compaction doesn't apply the delete predicates.
+        if (!base && tablet->version_for_delete_predicate(_rowsets[begin]->version())) {
+            continue;
+        }
+        int64_t min_size = std::max(_rowsets[begin]->rowset_meta()->total_disk_size(), min_level_size);
+        int64_t max_size = min_size;
+        int64_t bytes = _rowsets[begin]->rowset_meta()->total_disk_size();
+        size_t sources = _rowsets[begin]->rowset_meta()->get_compaction_score();
+        for (size_t end = begin + 1; end < _rowsets.size(); end++) {
+            Rowset* rowset = _rowsets[end];
+            if (rowset->start_version() != _rowsets[end - 1]->end_version() + 1) {
+                break;
+            }
+            if (!base && tablet->version_for_delete_predicate(rowset->version())) {
+                break;
+            }
+            const int64_t size = rowset->rowset_meta()->total_disk_size();
+            min_size = std::min(min_size, std::max(size, min_level_size));
+            max_size = std::max(max_size, size);
+            sources += rowset->rowset_meta()->get_compaction_score();
+            if (max_size > min_size * level_multiple || sources > max_sources) {
+                break;
+            }
+            bytes += size;
+            // the output rowset is nonoverlapping, read as one source.
+            const double score = static_cast<double>(sources - 1) * static_cast<double>(bytes_per_source) /
+                                 static_cast<double>(std::max(bytes, bytes_per_source));
+            if (score > best.score) {
+                best.begin = begin;
+                best.end = end + 1;
+                best.score = score;
+            }
+        }
+    }
+    VLOG(2) << "tablet:" << tablet->tablet_id() << ", size tiered " << (base ? "base" : "cumulative")
+            << " compaction window:[" << best.begin << "," << best.end << "), score:" << best.score
+            << ", sources:" << _num_sources;
+    return best;
+}
+
+std::shared_ptr<CompactionTask> SizeTieredCompactionPolicy::_create_compaction(CompactionType type) {
+    _init_rowsets();
+    Window window = _pick_window(type == BASE_COMPACTION);
+    if (window.end - window.begin <= 1) {
+        LOG(INFO) << "no suitable rowsets for size tiered compaction. tablet:"
+                  << _compaction_context->tablet->tablet_id() << ", type:" << type;
+        return nullptr;
+    }
+    std::vector<RowsetSharedPtr> input_rowsets;
+    for (size_t i = window.begin; i < window.end; i++) {
+        input_rowsets.emplace_back(_rowsets[i]->shared_from_this());
+    }
+
+    Version output_version;
+    output_version.first = input_rowsets.front()->start_version();
+    output_version.second = input_rowsets.back()->end_version();
+
+    const double score =
+            type == BASE_COMPACTION ? _compaction_context->base_score : _compaction_context->cumulative_score;
+    CompactionTaskFactory factory(output_version, _compaction_context->tablet, std::move(input_rowsets), score, type);
+    return factory.create_compaction_task();
+}
+
+} // namespace starrocks
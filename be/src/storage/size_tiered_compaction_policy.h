@@ -0,0 +1,59 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <vector>
+
+#include "storage/compaction_context.h"
+#include "storage/compaction_policy.h"
+
+namespace starrocks {
+
+class CompactionTask;
+
+// Size-tiered compaction policy for tablet.
+// The rowsets of a tablet are merged in windows of consecutive versions of similar sizes, i.e. the largest rowset of
+// a window is at most `size_tiered_compaction_level_multiple` times of the smallest one, so that a large rowset is
+// rewritten only once enough data of its size has followed it.
+// The score of a window is the read amplification it removes per unit of the compaction I/O: the number of the
+// sources merged by a query saved, scaled by `size_tiered_compaction_bytes_per_source` over the bytes rewritten. The
+// score of a tablet is the score of its best window, so that the compaction manager, which picks the tablets of the
+// highest scores first, minimizes the read cost of the queries per unit of the compaction I/O. The tablets of more
+// than `size_tiered_compaction_max_read_amplification` sources are compacted regardless of the I/O.
+// A window including the base rowset is compacted by a base compaction, and the other windows by cumulative
+// compactions, which don't cross the versions of delete predicates.
+class SizeTieredCompactionPolicy : public CompactionPolicy {
+public:
+    explicit SizeTieredCompactionPolicy(CompactionContext* compaction_context)
+            : _compaction_context(compaction_context) {}
+    ~SizeTieredCompactionPolicy() override = default;
+
+    bool need_compaction() override;
+
+    std::shared_ptr<CompactionTask> create_compaction() override;
+
+private:
+    struct Window {
+        // the range [begin, end) of `_rowsets`.
+        size_t begin = 0;
+        size_t end = 0;
+        double score = 0;
+    };
+
+    // Set `_rowsets` to the rowsets of the context in the order of versions, without the newly created ones.
+    void _init_rowsets();
+
+    // Return the window of the highest score, which includes the base rowset if |base| is true.
+    Window _pick_window(bool base) const;
+
+    std::shared_ptr<CompactionTask> _create_compaction(CompactionType type);
+
+    CompactionContext* _compaction_context;
+    std::vector<Rowset*> _rowsets;
+    // whether `_rowsets[0]` is the base rowset.
+    bool _has_base = false;
+    // the number of the sources merged by a query reading all `_rowsets`.
+    size_t _num_sources = 0;
+};
+
+} // namespace starrocks
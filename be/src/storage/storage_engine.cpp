@@ -628,7 +628,13 @@ Status StorageEngine::_perform_cumulative_compaction(DataDir* data_dir) {
             std::make_unique<MemTracker>(MemTracker::COMPACTION, -1, "", _options.compaction_mem_tracker);
     vectorized::CumulativeCompaction cumulative_compaction(mem_tracker.get(), best_tablet);
 
-    Status res = cumulative_compaction.compact();
+    int64_t duration_ns = 0;
+    Status res;
+    {
+        SCOPED_RAW_TIMER(&duration_ns);
+        res = cumulative_compaction.compact();
+    }
+    StarRocksMetrics::instance()->cumulative_compaction_task_latency_us.observe(duration_ns / 1000);
     if (!res.ok()) {
         if (!res.is_mem_limit_exceeded()) {
             best_tablet->set_last_cumu_compaction_failure_time(UnixMillis());
@@ -669,7 +675,13 @@ Status StorageEngine::_perform_base_compaction(DataDir* data_dir) {
             std::make_unique<MemTracker>(MemTracker::COMPACTION, -1, "", _options.compaction_mem_tracker);
     vectorized::BaseCompaction base_compaction(mem_tracker.get(), best_tablet);
 
-    Status res = base_compaction.compact();
+    int64_t duration_ns = 0;
+    Status res;
+    {
+        SCOPED_RAW_TIMER(&duration_ns);
+        res = base_compaction.compact();
+    }
+    StarRocksMetrics::instance()->base_compaction_task_latency_us.observe(duration_ns / 1000);
     if (!res.ok()) {
         best_tablet->set_last_base_compaction_failure_time(UnixMillis());
         if (!res.is_not_found()) {
@@ -715,6 +727,7 @@ Status StorageEngine::_perform_update_compaction(DataDir* data_dir) {
         res = best_tablet->updates()->compaction(mem_tracker.get());
     }
     StarRocksMetrics::instance()->update_compaction_duration_us.increment(duration_ns / 1000);
+    StarRocksMetrics::instance()->update_compaction_task_latency_us.observe(duration_ns / 1000);
     if (!res.ok()) {
         StarRocksMetrics::instance()->update_compaction_request_failed.increment(1);
         LOG(WARNING) << "failed to perform update compaction. res=" << res.to_string()
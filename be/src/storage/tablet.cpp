@@ -26,6 +26,7 @@
 #include <rapidjson/prettywriter.h>
 #include <rapidjson/stringbuffer.h>
 
+#include <cmath>
 #include <map>
 #include <memory>
 #include <utility>
@@ -1215,6 +1216,10 @@ std::unique_ptr<CompactionContext> Tablet::_get_compaction_context() {
         }
     }
     compaction_context->tablet = std::static_pointer_cast<Tablet>(shared_from_this());
+    if (config::compaction_scan_heat_half_life_seconds > 0 && config::compaction_scan_heat_unit_bytes > 0) {
+        compaction_context->scan_heat_weight =
+                1 + std::log2(1 + scan_heat() / static_cast<double>(config::compaction_scan_heat_unit_bytes));
+    }
 
     // For leading 'delete' or 'compacted' rowset in level 0, move it to level 1
     // because they should be compacted by base compaction
@@ -1270,6 +1275,39 @@ double Tablet::compaction_score(CompactionType type) const {
     }
 }
 
+double Tablet::compaction_priority(CompactionType type) const {
+    std::unique_lock wrlock(_meta_lock);
+    if (!_compaction_context) {
+        return 0;
+    }
+    if (type == BASE_COMPACTION) {
+        return _compaction_context->base_score * _compaction_context->scan_heat_weight;
+    } else if (type == CUMULATIVE_COMPACTION) {
+        return _compaction_context->cumulative_score * _compaction_context->scan_heat_weight;
+    }
+    return 0;
+}
+
+static double decay_scan_heat(double heat, int64_t elapsed_ms) {
+    if (config::compaction_scan_heat_half_life_seconds <= 0 || elapsed_ms <= 0) {
+        return heat;
+    }
+    return heat * std::exp2(-static_cast<double>(elapsed_ms) / (config::compaction_scan_heat_half_life_seconds * 1000));
+}
+
+void Tablet::add_scan_heat(int64_t bytes) {
+    int64_t now_ms = MonotonicMillis();
+    std::lock_guard l(_scan_heat_lock);
+    _scan_heat = decay_scan_heat(_scan_heat, now_ms - _scan_heat_update_ms) + static_cast<double>(bytes);
+    _scan_heat_update_ms = now_ms;
+}
+
+double Tablet::scan_heat() const {
+    int64_t now_ms = MonotonicMillis();
+    std::lock_guard l(_scan_heat_lock);
+    return decay_scan_heat(_scan_heat, now_ms - _scan_heat_update_ms);
+}
+
 std::shared_ptr<CompactionTask> Tablet::get_compaction(CompactionType type, bool create_if_not_exist) {
     std::shared_lock wrlock(_meta_lock);
     if (!_compaction_context) {
@@ -37,6 +37,7 @@
 #include "storage/base_tablet.h"
 #include "storage/data_dir.h"
 #include "storage/olap_define.h"
+#include "storage/rowset/encoding_hints.h"
 #include "storage/rowset/rowset.h"
 #include "storage/tablet_meta.h"
 #include "storage/tuple.h"
@@ -243,6 +244,9 @@ public:
     TabletUpdates* updates() { return _updates.get(); }
     Status rowset_commit(int64_t version, const RowsetSharedPtr& rowset);
 
+    // the encodings of the string columns of the segments loaded into this tablet.
+    EncodingHints* encoding_hints() { return &_encoding_hints; }
+
     int64_t mem_usage() { return sizeof(Tablet); }
 
     // if there is _compaction_task running
@@ -259,6 +263,16 @@ public:
 
     double compaction_score(CompactionType type) const;
 
+    // The compaction score weighted by the scan heat of the tablet when its compaction context was updated, by which
+    // the compaction candidates are ordered.
+    double compaction_priority(CompactionType type) const;
+
+    // Record a query reading |bytes| from the tablet.
+    void add_scan_heat(int64_t bytes);
+
+    // The bytes read by the queries of the tablet, halved every `compaction_scan_heat_half_life_seconds`.
+    double scan_heat() const;
+
     std::shared_ptr<CompactionTask> get_compaction(CompactionType type, bool create_if_not_exist);
 
     void stop_compaction();
@@ -339,6 +353,8 @@ private:
     // States used for updatable tablets only
     std::unique_ptr<TabletUpdates> _updates;
 
+    EncodingHints _encoding_hints;
+
     // compaction related
     std::unique_ptr<CompactionContext> _compaction_context;
     std::shared_ptr<CompactionTask> _base_compaction_task;
@@ -358,6 +374,10 @@ private:
     std::atomic<int32_t> _newly_created_rowset_num{0};
     std::atomic<int64_t> _last_checkpoint_time{0};
 
+    mutable std::mutex _scan_heat_lock;
+    double _scan_heat = 0;
+    int64_t _scan_heat_update_ms = 0;
+
     Tablet(const Tablet&) = delete;
     const Tablet& operator=(const Tablet&) = delete;
 };
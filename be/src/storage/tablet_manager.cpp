@@ -28,6 +28,7 @@ DIAGNOSTIC_POP
 #include <fmt/format.h>
 #include <re2/re2.h>
 
+#include <algorithm>
 #include <ctime>
 #include <memory>
 
@@ -48,6 +49,7 @@ DIAGNOSTIC_POP
 #include "storage/txn_manager.h"
 #include "storage/update_manager.h"
 #include "storage/utils.h"
+#include "util/hash_util.hpp"
 #include "util/path_util.h"
 #include "util/starrocks_metrics.h"
 
@@ -551,15 +553,15 @@ TabletSharedPtr TabletManager::find_best_tablet_to_compaction(CompactionType com
     uint32_t highest_score = 1;
     TabletSharedPtr best_tablet;
     for (const auto& tablets_shard : _tablets_shards) {
-        std::shared_lock rlock(tablets_shard.lock);
-        for (auto [tablet_id, tablet_ptr] : tablets_shard.tablet_map) {
+        // score the tablets without holding the shard lock, which blocks the creating and dropping of tablets
+        for (const auto& tablet_ptr : _get_shard_tablets(tablets_shard)) {
             if (tablet_ptr->keys_type() == PRIMARY_KEYS) {
                 continue;
             }
             AlterTabletTaskSharedPtr cur_alter_task = tablet_ptr->alter_task();
             if (cur_alter_task != nullptr && cur_alter_task->alter_state() != ALTER_FINISHED &&
                 cur_alter_task->alter_state() != ALTER_FAILED) {
-                TabletSharedPtr related_tablet = _get_tablet_unlocked(cur_alter_task->related_tablet_id());
+                TabletSharedPtr related_tablet = get_tablet(cur_alter_task->related_tablet_id());
                 if (related_tablet != nullptr && tablet_ptr->creation_time() > related_tablet->creation_time()) {
                     // Current tablet is newly created during schema-change or rollup, skip it
                     continue;
@@ -629,19 +631,35 @@ TabletSharedPtr TabletManager::find_best_tablet_to_compaction(CompactionType com
     return best_tablet;
 }
 
+std::vector<TabletSharedPtr> TabletManager::get_primary_key_tablets() {
+    std::vector<TabletSharedPtr> tablets;
+    for (const auto& tablets_shard : _tablets_shards) {
+        std::shared_lock rlock(tablets_shard.lock);
+        for (const auto& [tablet_id, tablet_ptr] : tablets_shard.tablet_map) {
+            if (tablet_ptr->keys_type() == PRIMARY_KEYS && tablet_ptr->tablet_state() == TABLET_RUNNING &&
+                tablet_ptr->init_succeeded()) {
+                tablets.push_back(tablet_ptr);
+            }
+        }
+    }
+    std::sort(tablets.begin(), tablets.end(), [](const TabletSharedPtr& a, const TabletSharedPtr& b) {
+        return a->creation_time() > b->creation_time();
+    });
+    return tablets;
+}
+
 TabletSharedPtr TabletManager::find_best_tablet_to_do_update_compaction(DataDir* data_dir) {
     int64_t highest_score = 0;
     TabletSharedPtr best_tablet;
     for (const auto& tablets_shard : _tablets_shards) {
-        std::shared_lock rlock(tablets_shard.lock);
-        for (const auto& [tablet_id, tablet_ptr] : tablets_shard.tablet_map) {
+        for (const auto& tablet_ptr : _get_shard_tablets(tablets_shard)) {
             if (tablet_ptr->keys_type() != PRIMARY_KEYS) {
                 continue;
             }
             AlterTabletTaskSharedPtr cur_alter_task = tablet_ptr->alter_task();
             if (cur_alter_task != nullptr && cur_alter_task->alter_state() != ALTER_FINISHED &&
                 cur_alter_task->alter_state() != ALTER_FAILED) {
-                TabletSharedPtr related_tablet = _get_tablet_unlocked(cur_alter_task->related_tablet_id());
+                TabletSharedPtr related_tablet = get_tablet(cur_alter_task->related_tablet_id());
                 if (related_tablet != nullptr && tablet_ptr->creation_time() > related_tablet->creation_time()) {
                     // Current tablet is newly created during schema-change or rollup, skip it
                     continue;
@@ -828,8 +846,9 @@ Status TabletManager::report_all_tablets_info(std::map<TTabletId, TTablet>* tabl
     StarRocksMetrics::instance()->report_all_tablets_requests_total.increment(1);
 
     for (const auto& tablets_shard : _tablets_shards) {
-        std::shared_lock rlock(tablets_shard.lock);
-        for (const auto& [tablet_id, tablet_ptr] : tablets_shard.tablet_map) {
+        // build the report info, which needs the header lock of tablets, outside the shard lock
+        for (const auto& tablet_ptr : _get_shard_tablets(tablets_shard)) {
+            int64_t tablet_id = tablet_ptr->tablet_id();
             TTablet t_tablet;
             TTabletInfo tablet_info;
             tablet_ptr->build_tablet_report_info(&tablet_info);
@@ -1063,6 +1082,33 @@ void TabletManager::update_root_path_info(std::map<std::string, DataDirInfo>* pa
     }
 }
 
+uint64_t TabletManager::tablets_info_fingerprint(const std::map<TTabletId, TTablet>& tablets_info) {
+    uint64_t hash = tablets_info.size();
+    auto add = [&hash](const auto& value) { hash = HashUtil::hash64(&value, sizeof(value), hash); };
+    for (const auto& [tablet_id, tablet] : tablets_info) {
+        for (const TTabletInfo& info : tablet.tablet_infos) {
+            add(info.tablet_id);
+            add(info.schema_hash);
+            add(info.version);
+            add(info.row_count);
+            add(info.data_size);
+            add(info.__isset.storage_medium ? static_cast<int32_t>(info.storage_medium) : -1);
+            add(info.transaction_ids.size());
+            for (auto txn_id : info.transaction_ids) {
+                add(txn_id);
+            }
+            add(info.version_count);
+            add(info.path_hash);
+            add(info.__isset.version_miss && info.version_miss);
+            add(info.__isset.used ? static_cast<int32_t>(info.used) : -1);
+            add(info.partition_id);
+            add(info.is_in_memory);
+            add(info.enable_persistent_index);
+        }
+    }
+    return hash;
+}
+
 void TabletManager::do_tablet_meta_checkpoint(DataDir* data_dir) {
     std::vector<TabletSharedPtr> related_tablets;
     for (const auto& tablets_shard : _tablets_shards) {
@@ -1299,6 +1345,16 @@ TabletManager::TabletsShard& TabletManager::_get_tablets_shard(TTabletId tabletI
     return _tablets_shards[tabletId & _tablets_shards_mask];
 }
 
+std::vector<TabletSharedPtr> TabletManager::_get_shard_tablets(const TabletsShard& shard) {
+    std::vector<TabletSharedPtr> tablets;
+    std::shared_lock rlock(shard.lock);
+    tablets.reserve(shard.tablet_map.size());
+    for (const auto& [tablet_id, tablet] : shard.tablet_map) {
+        tablets.push_back(tablet);
+    }
+    return tablets;
+}
+
 Status TabletManager::create_tablet_from_meta_snapshot(DataDir* store, TTabletId tablet_id, SchemaHash schema_hash,
                                                        const string& schema_hash_path, bool restore) {
     auto meta_path = strings::Substitute("$0/meta", schema_hash_path);
@@ -78,6 +78,9 @@ public:
 
     TabletSharedPtr find_best_tablet_to_do_update_compaction(DataDir* data_dir);
 
+    // The running tablets of the primary key model, the recently created ones first.
+    std::vector<TabletSharedPtr> get_primary_key_tablets();
+
     // TODO: pass |include_deleted| as an enum instead of boolean to avoid unexpected implicit cast.
     TabletSharedPtr get_tablet(TTabletId tablet_id, bool include_deleted = false, std::string* err = nullptr);
 
@@ -121,6 +124,10 @@ public:
 
     Status report_all_tablets_info(std::map<TTabletId, TTablet>* tablets_info);
 
+    // A fingerprint of the tablets info built by report_all_tablets_info, the tablets info doesn't change
+    // if the fingerprint is the same, so that reporting the same tablets info again can be skipped.
+    static uint64_t tablets_info_fingerprint(const std::map<TTabletId, TTablet>& tablets_info);
+
     Status start_trash_sweep();
     // Prevent schema change executed concurrently.
     bool try_schema_change_lock(TTabletId tablet_id);
@@ -216,6 +223,9 @@ private:
 
     TabletsShard& _get_tablets_shard(TTabletId tabletId);
 
+    // A snapshot of the tablets of the shard, which can be inspected without holding the shard lock
+    static std::vector<TabletSharedPtr> _get_shard_tablets(const TabletsShard& shard);
+
     Status _remove_tablet_meta(const TabletSharedPtr& tablet);
     Status _remove_tablet_directories(const TabletSharedPtr& tablet);
     Status _move_tablet_directories_to_trash(const TabletSharedPtr& tablet);
@@ -10,6 +10,7 @@
 #include "storage/chunk_helper.h"
 #include "storage/column_predicate_rewriter.h"
 #include "storage/conjunctive_predicates.h"
+#include "storage/data_dir.h"
 #include "storage/delete_predicates.h"
 #include "storage/empty_iterator.h"
 #include "storage/merge_iterator.h"
@@ -46,6 +47,9 @@ void TabletReader::close() {
     if (_collect_iter != nullptr) {
         _collect_iter->close();
         _collect_iter.reset();
+        if (_reader_type == READER_QUERY) {
+            _tablet->add_scan_heat(_stats.bytes_read);
+        }
     }
     STLDeleteElements(&_predicate_free_list);
     Rowset::release_readers(_rowsets);
@@ -77,6 +81,7 @@ Status TabletReader::open(const TabletReaderParams& read_params) {
         read_params.reader_type != ReaderType::READER_ALTER_TABLE && !is_compaction(read_params.reader_type)) {
         return Status::NotSupported("reader type not supported now");
     }
+    _reader_type = read_params.reader_type;
     Status st = _init_collector(read_params);
     return st;
 }
@@ -84,15 +89,35 @@ Status TabletReader::open(const TabletReaderParams& read_params) {
 Status TabletReader::do_get_next(Chunk* chunk) {
     DCHECK(!_is_vertical_merge);
     RETURN_IF_ERROR(_collect_iter->get_next(chunk));
+    _update_compaction_io();
     return Status::OK();
 }
 
 Status TabletReader::do_get_next(Chunk* chunk, std::vector<RowSourceMask>* source_masks) {
     DCHECK(_is_vertical_merge);
     RETURN_IF_ERROR(_collect_iter->get_next(chunk, source_masks));
+    _update_compaction_io();
     return Status::OK();
 }
 
+void TabletReader::_update_compaction_io() {
+    DataDir* data_dir = _tablet->data_dir();
+    if (data_dir == nullptr) {
+        return;
+    }
+    if (_reader_type == READER_QUERY) {
+        if (_stats.io_count > _reported_io_count) {
+            data_dir->compaction_io_controller()->add_foreground_io(_stats.io_ns - _reported_io_ns,
+                                                                    _stats.io_count - _reported_io_count);
+            _reported_io_ns = _stats.io_ns;
+            _reported_io_count = _stats.io_count;
+        }
+    } else if (is_compaction(_reader_type) && _stats.compressed_bytes_read > _reported_bytes_read) {
+        data_dir->compaction_io_controller()->acquire(_stats.compressed_bytes_read - _reported_bytes_read);
+        _reported_bytes_read = _stats.compressed_bytes_read;
+    }
+}
+
 Status TabletReader::get_segment_iterators(const TabletReaderParams& params, std::vector<ChunkIteratorPtr>* iters) {
     RowsetReadOptions rs_opts;
     KeysType keys_type = _tablet->tablet_schema().keys_type();
@@ -111,6 +136,7 @@ Status TabletReader::get_segment_iterators(const TabletReaderParams& params, std
     rs_opts.runtime_state = params.runtime_state;
     rs_opts.profile = params.profile;
     rs_opts.use_page_cache = params.use_page_cache;
+    rs_opts.fill_page_cache = params.fill_page_cache;
     rs_opts.tablet_schema = &_tablet->tablet_schema();
     rs_opts.global_dictmaps = params.global_dictmaps;
     rs_opts.unused_output_column_ids = params.unused_output_column_ids;
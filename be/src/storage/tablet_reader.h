@@ -61,6 +61,10 @@ private:
     Status _init_delete_predicates(const TabletReaderParams& read_params, DeletePredicates* dels);
     Status _init_collector(const TabletReaderParams& read_params);
 
+    // Report the I/O of a query to the CompactionIOController of the disk of |_tablet|, or take the tokens of the
+    // bytes read by a compaction from it.
+    void _update_compaction_io();
+
     static Status _to_seek_tuple(const TabletSchema& tablet_schema, const OlapTuple& input, SeekTuple* tuple,
                                  MemPool* mempool);
 
@@ -82,6 +86,12 @@ private:
 
     OlapReaderStatistics _stats;
 
+    ReaderType _reader_type = READER_QUERY;
+    // the part of |_stats| reported by `_update_compaction_io()`.
+    int64_t _reported_io_ns = 0;
+    int64_t _reported_io_count = 0;
+    int64_t _reported_bytes_read = 0;
+
     // used for vertical compaction
     bool _is_vertical_merge = false;
     bool _is_key = false;
@@ -44,6 +44,9 @@ struct TabletReaderParams {
     // 2. when read column index page
     //     if config::disable_storage_page_cache is false, we use page cache
     bool use_page_cache = false;
+    // If false, the data pages not found in the page cache are not inserted into it, e.g. for a one-off full scan
+    // which would evict the hot pages.
+    bool fill_page_cache = true;
 
     RangeStartOperation range = RangeStartOperation::GT;
     RangeEndOperation end_range = RangeEndOperation::LT;
@@ -665,6 +665,7 @@ void TabletUpdates::do_apply() {
                 _apply_rowset_commit(*version_info_apply);
             }
             StarRocksMetrics::instance()->update_rowset_commit_apply_duration_us.increment(duration_ns / 1000);
+            StarRocksMetrics::instance()->update_rowset_commit_apply_latency_us.observe(duration_ns / 1000);
         } else if (version_info_apply->compaction) {
             // _compaction_running may be false after BE restart, reset it to true
             _compaction_running = true;
@@ -815,42 +816,55 @@ void TabletUpdates::_apply_rowset_commit(const EditVersionInfo& version_info) {
 
     size_t ndelvec = new_deletes.size();
     vector<std::pair<uint32_t, DelVectorPtr>> new_del_vecs(ndelvec);
-    size_t idx = 0;
-    size_t old_total_del = 0;
-    size_t new_del = 0;
-    size_t total_del = 0;
-    string delvec_change_info;
-    for (auto& new_delete : new_deletes) {
-        uint32_t rssid = new_delete.first;
+    vector<const PrimaryIndex::DeletesMap::value_type*> deletes_by_idx;
+    deletes_by_idx.reserve(ndelvec);
+    for (const auto& new_delete : new_deletes) {
+        deletes_by_idx.push_back(&new_delete);
+    }
+    // the latest delvecs of the old segments, nullptr for the segments of the newly added rowset
+    vector<DelVectorPtr> old_del_vecs(ndelvec);
+    // each delvec only depends on the deletes of its own segment, so they are generated in parallel.
+    st = manager->parallel_apply(ndelvec, [&](size_t idx) {
+        uint32_t rssid = deletes_by_idx[idx]->first;
+        const auto& del_ids = deletes_by_idx[idx]->second;
+        new_del_vecs[idx].first = rssid;
         if (rssid >= rowset_id && rssid < rowset_id + rowset->num_segments()) {
             // it's newly added rowset's segment, do not have latest delvec yet
-            new_del_vecs[idx].first = rssid;
             new_del_vecs[idx].second = std::make_shared<DelVector>();
-            auto& del_ids = new_delete.second;
             new_del_vecs[idx].second->init(version.major(), del_ids.data(), del_ids.size());
+            return Status::OK();
+        }
+        TabletSegmentId tsid;
+        tsid.tablet_id = tablet_id;
+        tsid.segment_id = rssid;
+        // TODO(cbl): should get the version before this apply version, to be safe
+        RETURN_IF_ERROR(manager->get_latest_del_vec(_tablet.data_dir()->get_meta(), tsid, &old_del_vecs[idx]));
+        old_del_vecs[idx]->add_dels_as_new_version(del_ids, version.major(), &(new_del_vecs[idx].second));
+        return Status::OK();
+    });
+    if (!st.ok()) {
+        std::string msg = Substitute("_apply_rowset_commit error: get_latest_del_vec failed: $0 $1", st.to_string(),
+                                     debug_string());
+        LOG(ERROR) << msg;
+        _set_error(msg);
+        return;
+    }
+    size_t old_total_del = 0;
+    size_t new_del = 0;
+    size_t total_del = 0;
+    string delvec_change_info;
+    for (size_t idx = 0; idx < ndelvec; idx++) {
+        uint32_t rssid = new_del_vecs[idx].first;
+        size_t cur_add = deletes_by_idx[idx]->second.size();
+        auto& old_del_vec = old_del_vecs[idx];
+        if (old_del_vec == nullptr) {
             if (VLOG_IS_ON(1)) {
-                StringAppendF(&delvec_change_info, " %u:+%zu", rssid, del_ids.size());
+                StringAppendF(&delvec_change_info, " %u:+%zu", rssid, cur_add);
             }
-            new_del += del_ids.size();
-            total_del += del_ids.size();
+            new_del += cur_add;
+            total_del += cur_add;
         } else {
-            TabletSegmentId tsid;
-            tsid.tablet_id = tablet_id;
-            tsid.segment_id = rssid;
-            DelVectorPtr old_del_vec;
-            // TODO(cbl): should get the version before this apply version, to be safe
-            st = manager->get_latest_del_vec(_tablet.data_dir()->get_meta(), tsid, &old_del_vec);
-            if (!st.ok()) {
-                std::string msg = Substitute("_apply_rowset_commit error: get_latest_del_vec failed: $0 $1",
-                                             st.to_string(), debug_string());
-                LOG(ERROR) << msg;
-                _set_error(msg);
-                return;
-            }
-            new_del_vecs[idx].first = rssid;
-            old_del_vec->add_dels_as_new_version(new_delete.second, version.major(), &(new_del_vecs[idx].second));
             size_t cur_old = old_del_vec->cardinality();
-            size_t cur_add = new_delete.second.size();
             size_t cur_new = new_del_vecs[idx].second->cardinality();
             if (cur_old + cur_add != cur_new) {
                 // should not happen, data inconsistent
@@ -868,8 +882,6 @@ void TabletUpdates::_apply_rowset_commit(const EditVersionInfo& version_info) {
             total_del += cur_new;
         }
 
-        idx++;
-
         // Update the stats of affected rowsets.
         std::lock_guard lg(_rowset_stats_lock);
         auto iter = _rowset_stats.upper_bound(rssid);
@@ -885,7 +897,7 @@ void TabletUpdates::_apply_rowset_commit(const EditVersionInfo& version_info) {
             DCHECK(false) << msg;
             LOG(ERROR) << msg;
         } else {
-            iter->second->num_dels += new_delete.second.size();
+            iter->second->num_dels += cur_add;
             _calc_compaction_score(iter->second.get());
             DCHECK_LE(iter->second->num_dels, iter->second->num_rows);
         }
@@ -1059,6 +1071,7 @@ Status TabletUpdates::_do_compaction(std::unique_ptr<CompactionInfo>* pinfo, boo
     context.max_rows_per_segment = max_rows_per_segment;
     context.writer_type =
             (algorithm == VERTICAL_COMPACTION ? RowsetWriterType::kVertical : RowsetWriterType::kHorizontal);
+    context.direct_io = true;
     std::unique_ptr<RowsetWriter> rowset_writer;
     Status st = RowsetFactory::create_rowset_writer(context, &rowset_writer);
     if (!st.ok()) {
@@ -1237,7 +1250,19 @@ void TabletUpdates::_apply_compaction_commit(const EditVersionInfo& version_info
     size_t total_rows = 0;
     vector<std::pair<uint32_t, DelVectorPtr>> delvecs;
     vector<uint32_t> tmp_deletes;
+    auto output_rowset = _get_rowset(rowset_id);
     for (size_t i = 0; i < _compaction_state->segment_states.size(); i++) {
+        if (!(st = _compaction_state->load_segment(output_rowset.get(), i)).ok()) {
+            // the segments before have been applied to the index.
+            index.abort();
+            manager->index_cache().remove(index_entry);
+            _compaction_state.reset();
+            std::string msg = Substitute("_apply_compaction_commit error: load compaction state failed: $0 $1",
+                                         st.to_string(), debug_string());
+            LOG(ERROR) << msg;
+            _set_error(msg);
+            return;
+        }
         auto& sstate = _compaction_state->segment_states[i];
         total_rows += sstate.src_rssids.size();
         uint32_t rssid = rowset_id + i;
@@ -1253,8 +1278,7 @@ void TabletUpdates::_apply_compaction_commit(const EditVersionInfo& version_info
         }
         delvecs.emplace_back(rssid, dv);
         // release memory early
-        sstate.pkeys.reset();
-        sstate.src_rssids.clear();
+        _compaction_state->release_segment(i);
     }
     // release memory
     _compaction_state.reset();
@@ -2673,48 +2697,110 @@ Status TabletUpdates::get_column_values(std::vector<uint32_t>& column_ids, bool
             }
         }
     }
-    std::shared_ptr<FileSystem> fs;
+    OlapReaderStatistics stats;
     for (const auto& [rssid, rowids] : rowids_by_rssid) {
-        auto iter = rssid_to_rowsets.upper_bound(rssid);
-        --iter;
-        const auto& rowset = iter->second.get();
-        if (!(rowset->rowset_meta()->get_rowset_seg_id() <= rssid &&
-              rssid < rowset->rowset_meta()->get_rowset_seg_id() + rowset->num_segments())) {
-            std::string msg = Substitute("illegal rssid: $0, should in [$1, $2)", rssid,
-                                         rowset->rowset_meta()->get_rowset_seg_id(),
-                                         rowset->rowset_meta()->get_rowset_seg_id() + rowset->num_segments());
-            LOG(ERROR) << msg;
-            _set_error(msg);
-            return Status::InternalError(msg);
-        }
-        // REQUIRE: all rowsets in this tablet have the same path prefix, i.e, can share the same fs
-        if (fs == nullptr) {
-            ASSIGN_OR_RETURN(fs, FileSystem::CreateSharedFromString(rowset->rowset_path()));
-        }
-        std::string seg_path =
-                BetaRowset::segment_file_path(rowset->rowset_path(), rowset->rowset_id(), rssid - iter->first);
-        auto segment = Segment::open(ExecEnv::GetInstance()->tablet_meta_mem_tracker(), fs, seg_path,
-                                     rssid - iter->first, &rowset->schema());
-        if (!segment.ok()) {
-            LOG(WARNING) << "Fail to open " << seg_path << ": " << segment.status();
-            return segment.status();
+        RETURN_IF_ERROR(_get_column_values_in_segment(rssid_to_rowsets, rssid, column_ids, rowids, &stats, columns));
+    }
+    return Status::OK();
+}
+
+Status TabletUpdates::_get_column_values_in_segment(const std::map<uint32_t, RowsetSharedPtr>& rssid_to_rowsets,
+                                                    uint32_t rssid, const std::vector<uint32_t>& column_ids,
+                                                    const std::vector<uint32_t>& rowids, OlapReaderStatistics* stats,
+                                                    vector<std::unique_ptr<vectorized::Column>>* columns) {
+    auto iter = rssid_to_rowsets.upper_bound(rssid);
+    if (iter == rssid_to_rowsets.begin()) {
+        std::string msg = Substitute("illegal rssid: $0, rowset not found", rssid);
+        LOG(ERROR) << msg;
+        _set_error(msg);
+        return Status::InternalError(msg);
+    }
+    --iter;
+    auto rowset = down_cast<BetaRowset*>(iter->second.get());
+    if (!(rowset->rowset_meta()->get_rowset_seg_id() <= rssid &&
+          rssid < rowset->rowset_meta()->get_rowset_seg_id() + rowset->num_segments())) {
+        std::string msg = Substitute("illegal rssid: $0, should in [$1, $2)", rssid,
+                                     rowset->rowset_meta()->get_rowset_seg_id(),
+                                     rowset->rowset_meta()->get_rowset_seg_id() + rowset->num_segments());
+        LOG(ERROR) << msg;
+        _set_error(msg);
+        return Status::InternalError(msg);
+    }
+    // the segments opened by the loaded rowset are reused, instead of reading the footer of the segment again for
+    // each segment being written.
+    RETURN_IF_ERROR(rowset->load());
+    RowsetReleaseGuard guard(iter->second);
+    const auto& segment = rowset->segments()[rssid - iter->first];
+    if (segment->num_rows() == 0) {
+        return Status::OK();
+    }
+    ASSIGN_OR_RETURN(auto read_file, segment->new_read_file());
+    ColumnIteratorOptions iter_opts;
+    iter_opts.stats = stats;
+    iter_opts.read_file = read_file.get();
+    iter_opts.use_page_cache = !config::disable_storage_page_cache;
+    for (size_t i = 0; i < column_ids.size(); ++i) {
+        ColumnIterator* col_iter_raw_ptr = nullptr;
+        RETURN_IF_ERROR(segment->new_column_iterator(column_ids[i], &col_iter_raw_ptr));
+        std::unique_ptr<ColumnIterator> col_iter(col_iter_raw_ptr);
+        RETURN_IF_ERROR(col_iter->init(iter_opts));
+        RETURN_IF_ERROR(col_iter->fetch_values_by_rowid(rowids.data(), rowids.size(), (*columns)[i].get()));
+    }
+    return Status::OK();
+}
+
+Status TabletUpdates::get_rows_by_primary_keys(int64_t version, const vectorized::Column& keys,
+                                               const std::vector<uint32_t>& column_ids,
+                                               vector<std::unique_ptr<vectorized::Column>>* columns) {
+    // the rows are read while holding |_index_lock|, so no apply moves them after they are located by the index.
+    std::lock_guard lg(_index_lock);
+    if (_error) {
+        return Status::InternalError(
+                Substitute("get_rows_by_primary_keys failed, tablet updates is in error state: tablet:$0 $1",
+                           _tablet.tablet_id(), _error_msg));
+    }
+    {
+        std::lock_guard rl(_lock);
+        int64_t applied_version = _edit_version_infos[_apply_version_idx]->version.major();
+        if (applied_version != version) {
+            return Status::NotSupported(Substitute("get_rows_by_primary_keys: version $0 is not the applied version $1",
+                                                   version, applied_version));
         }
-        if ((*segment)->num_rows() == 0) {
-            continue;
+    }
+    // the index is only used if it's in the cache already, loading it is more expensive than scanning the tablet.
+    auto manager = StorageEngine::instance()->update_manager();
+    auto index_entry = manager->index_cache().get(_tablet.tablet_id());
+    if (index_entry == nullptr) {
+        return Status::NotSupported("get_rows_by_primary_keys: primary index is not loaded");
+    }
+    DeferOp release_index([&]() { manager->index_cache().release(index_entry); });
+    auto& index = index_entry->value();
+    if (!index.is_loaded()) {
+        return Status::NotSupported("get_rows_by_primary_keys: primary index is not loaded");
+    }
+    std::vector<uint64_t> rss_rowids(keys.size());
+    index.get(keys, &rss_rowids);
+    std::map<uint32_t, std::vector<uint32_t>> rowids_by_rssid;
+    for (uint64_t v : rss_rowids) {
+        uint32_t rssid = v >> 32;
+        if (rssid != (uint32_t)-1) {
+            rowids_by_rssid[rssid].push_back(v & ROWID_MASK);
         }
-        ColumnIteratorOptions iter_opts;
-        OlapReaderStatistics stats;
-        iter_opts.stats = &stats;
-        ASSIGN_OR_RETURN(auto read_file, fs->new_random_access_file((*segment)->file_name()));
-        iter_opts.read_file = read_file.get();
-        for (auto i = 0; i < column_ids.size(); ++i) {
-            ColumnIterator* col_iter_raw_ptr = nullptr;
-            RETURN_IF_ERROR((*segment)->new_column_iterator(column_ids[i], &col_iter_raw_ptr));
-            std::unique_ptr<ColumnIterator> col_iter(col_iter_raw_ptr);
-            RETURN_IF_ERROR(col_iter->init(iter_opts));
-            RETURN_IF_ERROR(col_iter->fetch_values_by_rowid(rowids.data(), rowids.size(), (*columns)[i].get()));
+    }
+
+    std::map<uint32_t, RowsetSharedPtr> rssid_to_rowsets;
+    {
+        std::lock_guard<std::mutex> l(_rowsets_lock);
+        for (const auto& rowset : _rowsets) {
+            rssid_to_rowsets.insert(rowset);
         }
     }
+    OlapReaderStatistics stats;
+    for (auto& [rssid, rowids] : rowids_by_rssid) {
+        // the column iterators read the rows in order of rowid
+        std::sort(rowids.begin(), rowids.end());
+        RETURN_IF_ERROR(_get_column_values_in_segment(rssid_to_rowsets, rssid, column_ids, rowids, &stats, columns));
+    }
     return Status::OK();
 }
 
@@ -209,6 +209,14 @@ public:
                              std::map<uint32_t, std::vector<uint32_t>>& rowids_by_rssid,
                              vector<std::unique_ptr<vectorized::Column>>* columns);
 
+    // Read the |column_ids| columns of the rows of the *encoded* primary keys |keys| at |version| into |columns|,
+    // located by the primary index instead of scanning the segments. The keys not found are skipped.
+    // Return NotSupported if the primary index is not loaded, or |version| is not the latest applied version, which
+    // is the only version the primary index locates the rows of.
+    Status get_rows_by_primary_keys(int64_t version, const vectorized::Column& keys,
+                                    const std::vector<uint32_t>& column_ids,
+                                    vector<std::unique_ptr<vectorized::Column>>* columns);
+
     Status prepare_partial_update_states(Tablet* tablet, const std::vector<ColumnUniquePtr>& upserts,
                                          EditVersion* read_version, uint32_t* next_rowset_id,
                                          std::vector<std::vector<uint64_t>*>* rss_rowids);
@@ -327,6 +335,13 @@ private:
 
     void _check_creation_time_increasing();
 
+    // Append the |column_ids| columns of the rows |rowids| in ascending order of the segment |rssid| to |columns|.
+    // |rssid_to_rowsets| are the rowsets of the tablet by their first rssid.
+    Status _get_column_values_in_segment(const std::map<uint32_t, RowsetSharedPtr>& rssid_to_rowsets,
+                                         uint32_t rssid, const std::vector<uint32_t>& column_ids,
+                                         const std::vector<uint32_t>& rowids, OlapReaderStatistics* stats,
+                                         vector<std::unique_ptr<vectorized::Column>>* columns);
+
     // these functions is only used in ut
     void stop_apply(bool apply_stopped) { _apply_stopped = apply_stopped; }
 
@@ -24,8 +24,12 @@
 #include <fmt/format.h>
 #include <sys/stat.h>
 
+#include <algorithm>
+#include <atomic>
 #include <filesystem>
+#include <mutex>
 #include <set>
+#include <thread>
 
 #include "common/status.h"
 #include "fs/fs.h"
@@ -496,10 +500,19 @@ Status EngineCloneTask::_download_files(DataDir* data_dir, const std::string& re
     }
 
     // Get copy from remote
-    uint64_t total_file_size = 0;
+    // The files except the header are downloaded by several threads in parallel, which share the download
+    // speed limit, the header is downloaded at last.
+    size_t num_threads = std::max<int32_t>(1, config::clone_download_file_thread_num);
+    num_threads = std::min(num_threads, std::max<size_t>(1, file_name_list.size() - 1));
+    const int64_t max_speed_kbps = std::max<int64_t>(1, config::max_download_speed_kbps / num_threads);
+
+    std::atomic<uint64_t> total_file_size{0};
     MonotonicStopWatch watch;
     watch.start();
-    for (int i = 0; i < file_name_list.size(); ++i) {
+    auto download_file = [&](size_t i) -> Status {
+        if (ExecEnv::GetInstance()->storage_engine()->bg_worker_stopped()) {
+            return Status::InternalError("Process is going to quit. The download will stop.");
+        }
         std::string& file_name = file_name_list[i];
         auto remote_file_url = remote_url_prefix + file_name;
 
@@ -522,7 +535,7 @@ Status EngineCloneTask::_download_files(DataDir* data_dir, const std::string& re
             return Status::InternalError("Disk reach capacity limit");
         }
 
-        total_file_size += file_size;
+        total_file_size.fetch_add(file_size);
         uint64_t estimate_timeout = file_size / config::download_low_speed_limit_kbps / 1024;
         if (estimate_timeout < config::download_low_speed_time) {
             estimate_timeout = config::download_low_speed_time;
@@ -533,9 +546,11 @@ Status EngineCloneTask::_download_files(DataDir* data_dir, const std::string& re
         VLOG(1) << "Downloading " << remote_file_url << " to " << local_path << ". bytes=" << file_size
                 << " timeout=" << estimate_timeout;
 
-        auto download_cb = [&remote_file_url, estimate_timeout, &local_file_path, file_size](HttpClient* client) {
+        auto download_cb = [&remote_file_url, estimate_timeout, &local_file_path, file_size,
+                            max_speed_kbps](HttpClient* client) {
             RETURN_IF_ERROR(client->init(remote_file_url));
             client->set_timeout_ms(estimate_timeout * 1000);
+            client->set_max_download_speed_kbps(max_speed_kbps);
             RETURN_IF_ERROR(client->download(local_file_path));
 
             // Check file length
@@ -548,8 +563,41 @@ Status EngineCloneTask::_download_files(DataDir* data_dir, const std::string& re
             chmod(local_file_path.c_str(), S_IRUSR | S_IWUSR);
             return Status::OK();
         };
-        RETURN_IF_ERROR(HttpClient::execute_with_retry(DOWNLOAD_FILE_MAX_RETRY, 1, download_cb));
-    } // Clone files from remote backend
+        return HttpClient::execute_with_retry(DOWNLOAD_FILE_MAX_RETRY, 1, download_cb);
+    };
+
+    if (file_name_list.size() > 1) {
+        std::atomic<size_t> next_file{0};
+        std::mutex status_mutex;
+        Status download_status;
+        auto download_worker = [&]() {
+            for (size_t i = next_file.fetch_add(1); i < file_name_list.size() - 1; i = next_file.fetch_add(1)) {
+                auto st = download_file(i);
+                if (!st.ok()) {
+                    std::lock_guard l(status_mutex);
+                    if (download_status.ok()) {
+                        download_status = std::move(st);
+                    }
+                    // stop the other workers
+                    next_file.store(file_name_list.size());
+                    return;
+                }
+            }
+        };
+        std::vector<std::thread> workers;
+        workers.reserve(num_threads - 1);
+        for (size_t i = 1; i < num_threads; ++i) {
+            workers.emplace_back(download_worker);
+        }
+        download_worker();
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        RETURN_IF_ERROR(download_status);
+    }
+    if (!file_name_list.empty()) {
+        RETURN_IF_ERROR(download_file(file_name_list.size() - 1));
+    }
 
     uint64_t total_time_ms = watch.elapsed_time() / 1000 / 1000;
     total_time_ms = total_time_ms > 0 ? total_time_ms : 0;
@@ -2,10 +2,14 @@
 
 #include "storage/update_compaction_state.h"
 
+#include <algorithm>
+
 #include "storage/chunk_helper.h"
 #include "storage/primary_key_encoder.h"
 #include "storage/rowset/beta_rowset.h"
 #include "storage/rowset/rowset.h"
+#include "storage/rowset/segment.h"
+#include "storage/rowset/segment_options.h"
 #include "storage/storage_engine.h"
 #include "storage/update_manager.h"
 #include "util/stack_util.h"
@@ -41,23 +45,22 @@ Status CompactionState::load(Rowset* rowset) {
 
 static const size_t large_compaction_memory_threshold = 1000000000;
 
-Status CompactionState::_do_load(Rowset* rowset) {
-    auto& schema = rowset->schema();
-    vector<uint32_t> pk_columns;
-    for (size_t i = 0; i < schema.num_key_columns(); i++) {
-        pk_columns.push_back(static_cast<uint32_t>(i));
-    }
-
-    vectorized::Schema pkey_schema = ChunkHelper::convert_schema_to_format_v2(schema, pk_columns);
-
-    std::unique_ptr<vectorized::Column> pk_column;
-    if (!PrimaryKeyEncoder::create_column(pkey_schema, &pk_column).ok()) {
-        CHECK(false) << "create column for primary key encoder failed";
+void CompactionState::_consume_memory(Rowset* rowset, uint32_t segment_id, size_t size, const char* what) {
+    auto update_manager = StorageEngine::instance()->update_manager();
+    auto tracker = update_manager->compaction_state_mem_tracker();
+    _memory_usage += size;
+    tracker->consume(size);
+    if (tracker->any_limit_exceeded()) {
+        // currently we can only log error here, and allow memory over usage
+        LOG(ERROR) << " memory limit exceeded when loading compaction state " << what
+                   << " tablet_id:" << rowset->rowset_meta()->tablet_id() << " rowset #rows:" << rowset->num_rows()
+                   << " size:" << rowset->data_disk_size() << " seg:" << segment_id << " memory:" << _memory_usage
+                   << " stats:" << update_manager->memory_stats();
     }
+}
 
+Status CompactionState::_do_load(Rowset* rowset) {
     ASSIGN_OR_RETURN(auto fs, FileSystem::CreateSharedFromString(rowset->rowset_path()));
-    auto update_manager = StorageEngine::instance()->update_manager();
-    auto tracker = update_manager->compaction_state_mem_tracker();
     segment_states.resize(rowset->num_segments());
     for (auto i = 0; i < rowset->num_segments(); i++) {
         std::string rssid_file = BetaRowset::segment_srcrssid_file_path(rowset->rowset_path(), rowset->rowset_id(), i);
@@ -65,45 +68,51 @@ Status CompactionState::_do_load(Rowset* rowset) {
         ASSIGN_OR_RETURN(auto file_size, read_file->get_size());
         std::vector<uint32_t>& src_rssids = segment_states[i].src_rssids;
         src_rssids.resize(file_size / sizeof(uint32_t));
-        _memory_usage += file_size;
-        tracker->consume(file_size);
-        if (tracker->any_limit_exceeded()) {
-            // currently we can only log error here, and allow memory over usage
-            LOG(ERROR) << " memory limit exceeded when loading compaction state rssid tablet_id:"
-                       << rowset->rowset_meta()->tablet_id() << " rowset #rows:" << rowset->num_rows()
-                       << " size:" << rowset->data_disk_size() << " seg:" << i << " memory:" << _memory_usage
-                       << " stats:" << update_manager->memory_stats();
-        }
+        _consume_memory(rowset, i, file_size, "rssid");
         RETURN_IF_ERROR(read_file->read_at_fully(0, src_rssids.data(), file_size));
     }
+    return Status::OK();
+}
 
-    RowsetReleaseGuard guard(rowset->shared_from_this());
-    OlapReaderStatistics stats;
-    auto beta_rowset = down_cast<BetaRowset*>(rowset);
-    auto res = beta_rowset->get_segment_iterators2(pkey_schema, nullptr, 0, &stats);
-    if (!res.ok()) {
-        return res.status();
+Status CompactionState::load_segment(Rowset* rowset, uint32_t segment_id) {
+    RETURN_IF_ERROR(_status);
+    DCHECK_LT(segment_id, segment_states.size());
+    auto& dest = segment_states[segment_id].pkeys;
+    if (dest != nullptr) {
+        return Status::OK();
+    }
+    auto& schema = rowset->schema();
+    vector<uint32_t> pk_columns;
+    for (size_t i = 0; i < schema.num_key_columns(); i++) {
+        pk_columns.push_back(static_cast<uint32_t>(i));
     }
 
-    auto& itrs = res.value();
-    CHECK(itrs.size() == rowset->num_segments()) << "itrs.size != num_segments";
+    vectorized::Schema pkey_schema = ChunkHelper::convert_schema_to_format_v2(schema, pk_columns);
 
-    // only hold pkey, so can use larger chunk size
-    auto chunk_shared_ptr = ChunkHelper::new_chunk(pkey_schema, config::vector_chunk_size);
-    auto chunk = chunk_shared_ptr.get();
+    std::unique_ptr<vectorized::Column> pk_column;
+    if (!PrimaryKeyEncoder::create_column(pkey_schema, &pk_column).ok()) {
+        CHECK(false) << "create column for primary key encoder failed";
+    }
 
-    for (size_t i = 0; i < itrs.size(); i++) {
-        auto itr = itrs[i].get();
-        if (itr == nullptr) {
-            continue;
-        }
-        auto& dest = segment_states[i].pkeys;
-        auto col = pk_column->clone();
-        auto num_rows = beta_rowset->segments()[i]->num_rows();
-        col->reserve(num_rows);
+    RowsetReleaseGuard guard(rowset->shared_from_this());
+    auto beta_rowset = down_cast<BetaRowset*>(rowset);
+    RETURN_IF_ERROR(beta_rowset->load());
+    auto& segment = beta_rowset->segments()[segment_id];
+    auto num_rows = segment->num_rows();
+    auto col = pk_column->clone();
+    col->reserve(num_rows);
+    if (num_rows > 0) {
+        OlapReaderStatistics stats;
+        vectorized::SegmentReadOptions seg_options;
+        ASSIGN_OR_RETURN(seg_options.fs, FileSystem::CreateSharedFromString(rowset->rowset_path()));
+        seg_options.stats = &stats;
+        ASSIGN_OR_RETURN(auto itr, segment->new_iterator(pkey_schema, seg_options));
+
+        // only hold pkey, so can use larger chunk size
+        auto chunk = ChunkHelper::new_chunk(pkey_schema, config::vector_chunk_size);
         while (true) {
             chunk->reset();
-            auto st = itr->get_next(chunk);
+            auto st = itr->get_next(chunk.get());
             if (st.is_end_of_file()) {
                 break;
             } else if (!st.ok()) {
@@ -113,25 +122,31 @@ Status CompactionState::_do_load(Rowset* rowset) {
             }
         }
         itr->close();
-        CHECK(col->size() == num_rows) << "read segment: iter rows != num rows";
-        dest = std::move(col);
-        _memory_usage += dest->memory_usage();
-        tracker->consume(dest->memory_usage());
-        if (tracker->any_limit_exceeded()) {
-            // currently we can only log error here, and allow memory over usage
-            LOG(ERROR) << " memory limit exceeded when loading compaction state pk tablet_id:"
-                       << rowset->rowset_meta()->tablet_id() << " rowset #rows:" << rowset->num_rows()
-                       << " size:" << rowset->data_disk_size() << " seg:" << i << " memory:" << _memory_usage
-                       << " stats:" << update_manager->memory_stats();
-        }
     }
+    CHECK(col->size() == num_rows) << "read segment: iter rows != num rows";
+    dest = std::move(col);
+    _consume_memory(rowset, segment_id, dest->memory_usage(), "pk");
 
     if (_memory_usage > large_compaction_memory_threshold) {
         LOG(INFO) << " loading large compaction state tablet_id:" << rowset->rowset_meta()->tablet_id()
                   << " rowset #rows:" << rowset->num_rows() << " size:" << rowset->data_disk_size()
-                  << " memory:" << _memory_usage << " stats:" << update_manager->memory_stats();
+                  << " seg:" << segment_id << " memory:" << _memory_usage
+                  << " stats:" << StorageEngine::instance()->update_manager()->memory_stats();
     }
     return Status::OK();
 }
 
+void CompactionState::release_segment(uint32_t segment_id) {
+    auto& sstate = segment_states[segment_id];
+    size_t size = sstate.src_rssids.size() * sizeof(uint32_t);
+    if (sstate.pkeys != nullptr) {
+        size += sstate.pkeys->memory_usage();
+        sstate.pkeys.reset();
+    }
+    std::vector<uint32_t>().swap(sstate.src_rssids);
+    size = std::min(size, _memory_usage);
+    _memory_usage -= size;
+    StorageEngine::instance()->update_manager()->compaction_state_mem_tracker()->release(size);
+}
+
 } // namespace starrocks::vectorized
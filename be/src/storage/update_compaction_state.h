@@ -29,8 +29,16 @@ public:
     CompactionState(const CompactionState&) = delete;
     CompactionState& operator=(const CompactionState&) = delete;
 
+    // Load the source rssids of the segments of |rowset|, the primary keys are loaded by `load_segment()`.
     Status load(Rowset* rowset);
 
+    // Load the encoded primary keys of the segment |segment_id| of |rowset|, which has been loaded by `load()`.
+    // Only the keys of the segment being applied are kept in memory, instead of the keys of the whole rowset.
+    Status load_segment(Rowset* rowset, uint32_t segment_id);
+
+    // Release the memory of the segment |segment_id| after it has been applied.
+    void release_segment(uint32_t segment_id);
+
     size_t memory_usage() const { return _memory_usage; }
 
     std::vector<CompactionSemgentState> segment_states;
@@ -38,6 +46,8 @@ public:
 private:
     Status _do_load(Rowset* rowset);
 
+    void _consume_memory(Rowset* rowset, uint32_t segment_id, size_t size, const char* what);
+
     std::once_flag _load_once_flag;
     Status _status;
     size_t _memory_usage = 0;
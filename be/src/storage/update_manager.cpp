@@ -2,17 +2,21 @@
 
 #include "storage/update_manager.h"
 
+#include <algorithm>
 #include <limits>
 #include <memory>
 #include <numeric>
 
+#include "common/config.h"
 #include "gutil/endian.h"
+#include "runtime/current_thread.h"
 #include "storage/chunk_helper.h"
 #include "storage/del_vector.h"
 #include "storage/kv_store.h"
 #include "storage/rowset_update_state.h"
 #include "storage/tablet.h"
 #include "storage/tablet_meta_manager.h"
+#include "util/countdown_latch.h"
 #include "util/pretty_printer.h"
 #include "util/starrocks_metrics.h"
 #include "util/time.h"
@@ -38,6 +42,9 @@ UpdateManager::~UpdateManager() {
         // should be shutdown.
         _apply_thread_pool->shutdown();
     }
+    if (_parallel_apply_thread_pool != nullptr) {
+        _parallel_apply_thread_pool->shutdown();
+    }
     clear_cache();
     if (_compaction_state_mem_tracker) {
         _compaction_state_mem_tracker.reset();
@@ -54,8 +61,51 @@ UpdateManager::~UpdateManager() {
 }
 
 Status UpdateManager::init() {
-    auto st = ThreadPoolBuilder("update_apply").build(&_apply_thread_pool);
-    return st;
+    RETURN_IF_ERROR(ThreadPoolBuilder("update_apply").build(&_apply_thread_pool));
+    if (config::update_apply_parallel_thread_num > 0) {
+        RETURN_IF_ERROR(ThreadPoolBuilder("update_parallel") // parallel parts of an apply
+                                .set_min_threads(0)
+                                .set_max_threads(config::update_apply_parallel_thread_num)
+                                .set_idle_timeout(MonoDelta::FromMilliseconds(60000))
+                                .build(&_parallel_apply_thread_pool));
+    }
+    return Status::OK();
+}
+
+Status UpdateManager::parallel_apply(size_t n, const std::function<Status(size_t)>& func) {
+    if (n < 2 || _parallel_apply_thread_pool == nullptr) {
+        for (size_t i = 0; i < n; i++) {
+            RETURN_IF_ERROR(func(i));
+        }
+        return Status::OK();
+    }
+    // the items are assigned to the tasks round-robin, the last task is run by the calling thread.
+    const size_t num_tasks = std::min<size_t>(config::update_apply_parallel_thread_num + 1, n);
+    std::vector<Status> statuses(num_tasks);
+    MemTracker* mem_tracker = CurrentThread::mem_tracker();
+    auto run_task = [&](size_t task) {
+        SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(mem_tracker);
+        for (size_t i = task; i < n && statuses[task].ok(); i += num_tasks) {
+            statuses[task] = func(i);
+        }
+    };
+    CountDownLatch latch(num_tasks - 1);
+    for (size_t task = 0; task + 1 < num_tasks; task++) {
+        auto st = _parallel_apply_thread_pool->submit_func([&, task]() {
+            run_task(task);
+            latch.count_down();
+        });
+        if (!st.ok()) {
+            run_task(task);
+            latch.count_down();
+        }
+    }
+    run_task(num_tasks - 1);
+    latch.wait();
+    for (auto& st : statuses) {
+        RETURN_IF_ERROR(st);
+    }
+    return Status::OK();
 }
 
 Status UpdateManager::get_del_vec_in_meta(KVStore* meta, const TabletSegmentId& tsid, int64_t version,
@@ -159,6 +209,60 @@ void UpdateManager::expire_cache() {
 
         _last_clear_expired_cache_millis = MonotonicMillis();
     }
+    evict_index_cache();
+}
+
+int64_t UpdateManager::_index_cache_limit(int32_t percent) const {
+    if (_update_mem_tracker == nullptr || _update_mem_tracker->limit() <= 0) {
+        return -1;
+    }
+    return _update_mem_tracker->limit() * std::clamp(percent, 0, 100) / 100;
+}
+
+void UpdateManager::evict_index_cache() {
+    int64_t limit = _index_cache_limit(config::primary_index_cache_limit_percent);
+    if (limit <= 0 || static_cast<int64_t>(_index_cache.size()) <= limit) {
+        return;
+    }
+    ssize_t orig_size = _index_cache.size();
+    ssize_t orig_obj_size = _index_cache.object_size();
+    if (!_index_cache.try_evict(limit, [](PrimaryIndex& index) { return index.has_persistent_index(); })) {
+        _index_cache.try_evict(limit, [](PrimaryIndex& index) { return true; });
+    }
+    LOG(INFO) << Substitute("index cache evict: limit:$0 before:($1 $2) after:($3 $4)",
+                            PrettyPrinter::print_bytes(limit), orig_obj_size, PrettyPrinter::print_bytes(orig_size),
+                            _index_cache.object_size(), PrettyPrinter::print_bytes(_index_cache.size()));
+}
+
+size_t UpdateManager::prewarm_index_cache(const std::vector<TabletSharedPtr>& tablets,
+                                          const std::function<bool()>& stopped) {
+    int64_t limit = _index_cache_limit(config::primary_index_prewarm_limit_percent);
+    std::vector<TabletSharedPtr> sorted(tablets);
+    std::stable_partition(sorted.begin(), sorted.end(),
+                          [](const TabletSharedPtr& tablet) { return tablet->get_enable_persistent_index(); });
+    size_t loaded = 0;
+    for (auto& tablet : sorted) {
+        if (stopped() || (limit >= 0 && static_cast<int64_t>(_index_cache.size()) >= limit)) {
+            break;
+        }
+        if (tablet->keys_type() != PRIMARY_KEYS || tablet->updates() == nullptr || !tablet->init_succeeded()) {
+            continue;
+        }
+        auto index_entry = _index_cache.get_or_create(tablet->tablet_id());
+        index_entry->update_expire_time(MonotonicMillis() + _cache_expire_ms);
+        auto st = index_entry->value().load(tablet.get());
+        _index_cache.update_object_size(index_entry, index_entry->value().memory_usage());
+        if (st.ok()) {
+            _index_cache.release(index_entry);
+            loaded++;
+        } else {
+            LOG(WARNING) << "prewarm primary index error: " << st << " tablet: " << tablet->tablet_id();
+            _index_cache.remove(index_entry);
+        }
+    }
+    LOG(INFO) << Substitute("index cache prewarm: loaded:$0/$1 size:$2", loaded, tablets.size(),
+                            PrettyPrinter::print_bytes(_index_cache.size()));
+    return loaded;
 }
 
 string UpdateManager::memory_stats() {
@@ -278,6 +382,7 @@ Status UpdateManager::on_rowset_finished(Tablet* tablet, Rowset* rowset) {
             LOG(WARNING) << "load primary index error: " << st << " tablet: " << tablet->tablet_id();
             _index_cache.remove(index_entry);
         }
+        evict_index_cache();
     }
     VLOG(1) << "UpdateManager::on_rowset_finished finish tablet:" << tablet->tablet_id()
             << " rowset:" << rowset_unique_id;
@@ -2,8 +2,11 @@
 
 #pragma once
 
+#include <functional>
+#include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "storage/olap_common.h"
 #include "storage/primary_index.h"
@@ -20,10 +23,11 @@ class MemTracker;
 class KVStore;
 class RowsetUpdateState;
 class Tablet;
+using TabletSharedPtr = std::shared_ptr<Tablet>;
 
 // UpdateManager maintain update feature related data structures, including
-// PrimaryIndexe cache, RowsetUpdateState cache, DelVector cache and
-// async apply thread pool.
+// PrimaryIndexe cache, RowsetUpdateState cache, DelVector cache,
+// async apply thread pool and the pool running the parts of an apply in parallel.
 class UpdateManager {
 public:
     UpdateManager(MemTracker* mem_tracker);
@@ -52,6 +56,11 @@ public:
 
     ThreadPool* apply_thread_pool() { return _apply_thread_pool.get(); }
 
+    // Run |func| for each of [0, n) on the parallel apply pool, the calling thread taking a share of them.
+    // The tasks run one by one in the calling thread if n < 2 or `update_apply_parallel_thread_num` is 0.
+    // Return the first error of the tasks, the remaining tasks of a failed thread are skipped.
+    Status parallel_apply(size_t n, const std::function<Status(size_t)>& func);
+
     DynamicCache<uint64_t, PrimaryIndex>& index_cache() { return _index_cache; }
 
     DynamicCache<string, RowsetUpdateState>& update_state_cache() { return _update_state_cache; }
@@ -64,6 +73,16 @@ public:
 
     void expire_cache();
 
+    // Evict the unused primary indexes in LRU order until the index cache is under
+    // `primary_index_cache_limit_percent` of the update memory limit. The indexes backed by the persistent index
+    // are evicted first, as reloading them reads the index files instead of scanning all the key columns.
+    void evict_index_cache();
+
+    // Load the primary indexes of |tablets|, the ones with the persistent index enabled first, until the index
+    // cache reaches `primary_index_prewarm_limit_percent` of the update memory limit or |stopped| returns true.
+    // Return the number of loaded indexes.
+    size_t prewarm_index_cache(const std::vector<TabletSharedPtr>& tablets, const std::function<bool()>& stopped);
+
     MemTracker* mem_tracker() const { return _update_mem_tracker; }
 
     string memory_stats();
@@ -73,6 +92,9 @@ public:
     string topn_memory_stats(size_t topn);
 
 private:
+    // The bytes of |percent| of the update memory limit, -1 if the limit is not set.
+    int64_t _index_cache_limit(int32_t percent) const;
+
     // default 6min
     int64_t _cache_expire_ms = 360000;
 
@@ -94,6 +116,8 @@ private:
     std::unique_ptr<MemTracker> _del_vec_cache_mem_tracker;
 
     std::unique_ptr<ThreadPool> _apply_thread_pool;
+    // separated from _apply_thread_pool, whose threads wait for the tasks of this pool.
+    std::unique_ptr<ThreadPool> _parallel_apply_thread_pool;
 
     UpdateManager(const UpdateManager&) = delete;
     const UpdateManager& operator=(const UpdateManager&) = delete;
@@ -34,6 +34,7 @@ class RuntimeState;
 class SlotDescriptor;
 class BitmapIndexIterator;
 class BloomFilter;
+class InvertedIndexIterator;
 } // namespace starrocks
 
 namespace starrocks::vectorized {
@@ -143,10 +144,22 @@ public:
     // Return false to filter out a data page.
     virtual bool bloom_filter(const BloomFilter* bf) const { return true; }
 
+    virtual bool support_ngram_bloom_filter() const { return false; }
+
+    // Return false to filter out a data page by its n-gram bloom filter, which has all the grams of |gram_size| bytes
+    // of the values in the page.
+    virtual bool ngram_bloom_filter(const BloomFilter* bf, size_t gram_size) const { return true; }
+
     virtual Status seek_bitmap_dictionary(BitmapIndexIterator* iter, SparseRange* range) const {
         return Status::Cancelled("not implemented");
     }
 
+    // Set |rows| to the rows which may match the predicate by the inverted index, and |exact| to whether they are
+    // exactly the matched rows. Return Cancelled if the predicate can't be evaluated by the inverted index.
+    virtual Status seek_inverted_index(InvertedIndexIterator* iter, Roaring* rows, bool* exact) const {
+        return Status::Cancelled("not implemented");
+    }
+
     // Indicate whether or not the evaluate can be vectorized.
     // If this function return true, evaluate function will be vectorized and can achieve
     // good performance.
@@ -2,6 +2,7 @@
 
 #include "storage/vertical_compaction_task.h"
 
+#include <algorithm>
 #include <vector>
 
 #include "column/schema.h"
@@ -24,7 +25,10 @@ namespace starrocks {
 
 Status VerticalCompactionTask::run_impl() {
     Statistics statistics;
-    RETURN_IF_ERROR(_vertical_compaction_data(&statistics));
+    ASSIGN_OR_RETURN(bool linked, _link_input_rowsets(&statistics));
+    if (!linked) {
+        RETURN_IF_ERROR(_vertical_compaction_data(&statistics));
+    }
     TRACE_COUNTER_INCREMENT("merged_rows", statistics.merged_rows);
     TRACE_COUNTER_INCREMENT("filtered_rows", statistics.filtered_rows);
     TRACE_COUNTER_INCREMENT("output_rows", statistics.output_rows);
@@ -47,9 +51,17 @@ Status VerticalCompactionTask::_vertical_compaction_data(Statistics* statistics)
     RETURN_IF_ERROR(CompactionUtils::construct_output_rowset_writer(
             _tablet.get(), max_rows_per_segment, _task_info.algorithm, _task_info.output_version, &output_rs_writer));
 
+    // the value columns are merged in as few groups as the memory allows without shrinking the chunks read, so that
+    // the row source masks are read fewer times, and each chunk of a wide group is encoded by the column writers in
+    // parallel.
     std::vector<std::vector<uint32_t>> column_groups;
+    ASSIGN_OR_RETURN(auto column_row_sizes, _calculate_column_row_sizes());
+    const int64_t max_group_row_size =
+            std::max<int64_t>(config::compaction_memory_limit_per_worker, 0) /
+            (static_cast<int64_t>(std::max<size_t>(_task_info.input_segments_num, 1)) * config::vector_chunk_size);
     CompactionUtils::split_column_into_groups(_tablet->num_columns(), _tablet->num_key_columns(),
-                                              config::vertical_compaction_max_columns_per_group, &column_groups);
+                                              config::vertical_compaction_max_columns_per_group, column_row_sizes,
+                                              max_group_row_size, &column_groups);
     _task_info.column_group_size = column_groups.size();
 
     auto mask_buffer =
@@ -175,6 +187,36 @@ StatusOr<int32_t> VerticalCompactionTask::_calculate_chunk_size_for_column_group
     return chunk_size;
 }
 
+StatusOr<std::vector<int64_t>> VerticalCompactionTask::_calculate_column_row_sizes() {
+    const size_t num_columns = _tablet->num_columns();
+    int64_t total_num_rows = 0;
+    std::vector<int64_t> total_mem_footprints(num_columns, 0);
+    for (auto& rowset : _input_rowsets) {
+        if (rowset->rowset_meta()->rowset_type() != BETA_ROWSET) {
+            LOG(WARNING) << "unsupported rowset type:" << rowset->rowset_meta()->rowset_type();
+            return Status::InternalError("unsupported rowset type");
+        }
+
+        total_num_rows += rowset->num_rows();
+        auto* beta_rowset = down_cast<BetaRowset*>(rowset.get());
+        for (auto& segment : beta_rowset->segments()) {
+            for (uint32_t column_index = 0; column_index < num_columns; column_index++) {
+                const auto* column_reader = segment->column(column_index);
+                if (column_reader == nullptr) {
+                    continue;
+                }
+                total_mem_footprints[column_index] += column_reader->total_mem_footprint();
+            }
+        }
+    }
+    std::vector<int64_t> column_row_sizes(num_columns);
+    for (size_t i = 0; i < num_columns; i++) {
+        // The result of the division operation be zero, so added one
+        column_row_sizes[i] = (total_mem_footprints[i] + 1) / (total_num_rows + 1) + 1;
+    }
+    return column_row_sizes;
+}
+
 StatusOr<size_t> VerticalCompactionTask::_compact_data(bool is_key, int32_t chunk_size,
                                                        const std::vector<uint32_t>& column_group,
                                                        const vectorized::Schema& schema,
@@ -40,6 +40,9 @@ private:
                                    std::vector<vectorized::RowSourceMask>* source_masks);
 
     StatusOr<int32_t> _calculate_chunk_size_for_column_group(const std::vector<uint32_t>& column_group);
+
+    // The average memory footprint per row of each column of the input rowsets.
+    StatusOr<std::vector<int64_t>> _calculate_column_row_sizes();
 };
 
 } // namespace starrocks
@@ -0,0 +1,466 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+// fragment_replay replays the plan fragments captured by a BE with config::plan_fragment_capture_dir against
+// a test BE at a configurable concurrency, and reports the throughput, the latency percentiles and the time of
+// each operator, so the changes of the scheduler or the memory management can be A/B tested with the same
+// workload, e.g.
+//     starrocks_be fragment_replay --replay_capture_dir=/path/to/capture --replay_be_host=test_be
+//         --replay_concurrency=8 --replay_iterations=10
+//
+// All the fragments of a query are replayed on the test BE, which must have the same tablets as the captured
+// ones. The tool acts as the coordinator of the replayed queries: it fetches the results of the result sink,
+// and receives the reports of the fragment instances by a FrontendService of its own.
+//
+// Limitations: the merge nodes of the global runtime filters are not rewritten, so the global runtime filters
+// are usually not delivered, and the loads are not supported.
+
+#include <brpc/channel.h>
+#include <brpc/controller.h>
+#include <gflags/gflags.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "common/status.h"
+#include "fs/fs.h"
+#include "fs/fs_util.h"
+#include "gen_cpp/FrontendService.h"
+#include "gen_cpp/InternalService_types.h"
+#include "gen_cpp/doris_internal_service.pb.h"
+#include "gutil/strings/substitute.h"
+#include "util/hash_util.hpp"
+#include "util/thrift_server.h"
+#include "util/thrift_util.h"
+#include "util/time.h"
+#include "util/uid_util.h"
+
+DEFINE_string(replay_capture_dir, "", "the capture dir of a BE, each sub-directory of which is a captured query");
+DEFINE_string(replay_be_host, "127.0.0.1", "the host of the BE to replay against");
+DEFINE_int32(replay_be_brpc_port, 8060, "the brpc port of the BE to replay against");
+DEFINE_string(replay_report_host, "127.0.0.1", "the host of this tool, which is reachable by the BE");
+DEFINE_int32(replay_report_port, 9620, "the port of this tool receiving the reports of the fragment instances");
+DEFINE_int32(replay_concurrency, 1, "the number of the queries replayed concurrently");
+DEFINE_int32(replay_iterations, 1, "the number of the queries replayed by each concurrent worker");
+DEFINE_int32(replay_timeout_s, 300, "the timeout of a replayed query in seconds");
+DEFINE_bool(replay_report_profile, true, "whether to collect the profiles for the time of each operator");
+
+namespace starrocks::tools {
+
+struct CapturedQuery {
+    std::string name;
+    // In the order they were received by the captured BE.
+    std::vector<TExecPlanFragmentParams> fragments;
+};
+
+static Status load_fragment(const std::string& path, TExecPlanFragmentParams* fragment) {
+    ASSIGN_OR_RETURN(auto file, fs::new_random_access_file(path));
+    ASSIGN_OR_RETURN(auto size, file->get_size());
+    std::string buf(size, '\0');
+    RETURN_IF_ERROR(file->read_at_fully(0, buf.data(), size));
+    auto len = static_cast<uint32_t>(size);
+    return deserialize_thrift_msg(reinterpret_cast<const uint8_t*>(buf.data()), &len, TProtocolType::BINARY,
+                                  fragment);
+}
+
+static Status load_captured_queries(const std::string& dir, std::vector<CapturedQuery>* queries) {
+    std::set<std::string> query_dirs;
+    std::set<std::string> files;
+    RETURN_IF_ERROR(fs::list_dirs_files(dir, &query_dirs, &files));
+    for (const auto& query_dir : query_dirs) {
+        std::set<std::string> sub_dirs;
+        std::set<std::string> fragment_files;
+        RETURN_IF_ERROR(fs::list_dirs_files(dir + "/" + query_dir, &sub_dirs, &fragment_files));
+        CapturedQuery query;
+        query.name = query_dir;
+        // The file names start with the sequence of the fragments.
+        for (const auto& file : fragment_files) {
+            TExecPlanFragmentParams fragment;
+            RETURN_IF_ERROR(load_fragment(dir + "/" + query_dir + "/" + file, &fragment));
+            query.fragments.emplace_back(std::move(fragment));
+        }
+        if (!query.fragments.empty()) {
+            queries->emplace_back(std::move(query));
+        }
+    }
+    if (queries->empty()) {
+        return Status::NotFound(strings::Substitute("No captured query in $0", dir));
+    }
+    return Status::OK();
+}
+
+// The state of a replayed query, updated by the reports of its fragment instances.
+struct ReplayState {
+    std::mutex mutex;
+    std::condition_variable cv;
+    size_t num_done = 0;
+    Status status;
+    // The sum of OperatorTotalTime of each operator across the fragment instances, in nanoseconds.
+    std::map<std::string, int64_t> operator_times;
+};
+
+// Aggregates OperatorTotalTime in CommonMetrics by the operator, i.e. the parent of CommonMetrics.
+// The profile tree is flattened in pre-order.
+static void aggregate_operator_times(const TRuntimeProfileTree& profile, std::map<std::string, int64_t>* times) {
+    // The name of each ancestor and the number of its children not visited yet.
+    std::vector<std::pair<const std::string*, int>> ancestors;
+    for (const auto& node : profile.nodes) {
+        const std::string* parent = ancestors.empty() ? nullptr : ancestors.back().first;
+        if (!ancestors.empty()) {
+            ancestors.back().second--;
+        }
+        if (node.name == "CommonMetrics" && parent != nullptr) {
+            for (const auto& counter : node.counters) {
+                if (counter.name == "OperatorTotalTime") {
+                    (*times)[*parent] += counter.value;
+                }
+            }
+        }
+        if (node.num_children > 0) {
+            ancestors.emplace_back(&node.name, node.num_children);
+        } else {
+            while (!ancestors.empty() && ancestors.back().second == 0) {
+                ancestors.pop_back();
+            }
+        }
+    }
+}
+
+// The coordinator of the replayed queries, which receives the reports of the fragment instances.
+class ReplayCoordinator : public FrontendServiceNull {
+public:
+    std::shared_ptr<ReplayState> register_query(const TUniqueId& query_id) {
+        auto state = std::make_shared<ReplayState>();
+        std::lock_guard<std::mutex> l(_mutex);
+        _states[query_id] = state;
+        return state;
+    }
+
+    void unregister_query(const TUniqueId& query_id) {
+        std::lock_guard<std::mutex> l(_mutex);
+        _states.erase(query_id);
+    }
+
+    void reportExecStatus(TReportExecStatusResult& result, const TReportExecStatusParams& params) override {
+        Status::OK().set_t_status(&result);
+        std::shared_ptr<ReplayState> state;
+        {
+            std::lock_guard<std::mutex> l(_mutex);
+            auto it = _states.find(params.query_id);
+            if (it == _states.end()) {
+                return;
+            }
+            state = it->second;
+        }
+        std::lock_guard<std::mutex> l(state->mutex);
+        if (params.__isset.status && state->status.ok()) {
+            state->status = Status(params.status);
+        }
+        if (params.__isset.profile) {
+            aggregate_operator_times(params.profile, &state->operator_times);
+        }
+        if (params.__isset.done && params.done) {
+            state->num_done++;
+            state->cv.notify_all();
+        }
+    }
+
+private:
+    std::mutex _mutex;
+    std::unordered_map<TUniqueId, std::shared_ptr<ReplayState>> _states;
+};
+
+struct ReplayResult {
+    Status status;
+    int64_t latency_ns = 0;
+    std::map<std::string, int64_t> operator_times;
+};
+
+class Replayer {
+public:
+    Replayer(ReplayCoordinator* coordinator, doris::PBackendService_Stub* stub)
+            : _coordinator(coordinator), _stub(stub) {
+        _be_addr.__set_hostname(FLAGS_replay_be_host);
+        _be_addr.__set_port(FLAGS_replay_be_brpc_port);
+        _coord_addr.__set_hostname(FLAGS_replay_report_host);
+        _coord_addr.__set_port(FLAGS_replay_report_port);
+    }
+
+    ReplayResult replay(const CapturedQuery& query) {
+        ReplayResult result;
+        std::vector<TExecPlanFragmentParams> fragments = query.fragments;
+        const TUniqueId query_id = _rewrite(&fragments);
+        auto state = _coordinator->register_query(query_id);
+        const int64_t start_ns = MonotonicNanos();
+        result.status = _run(fragments, state.get());
+        result.latency_ns = MonotonicNanos() - start_ns;
+        if (!result.status.ok()) {
+            _cancel(fragments);
+        }
+        _coordinator->unregister_query(query_id);
+        std::lock_guard<std::mutex> l(state->mutex);
+        result.operator_times = state->operator_times;
+        return result;
+    }
+
+private:
+    // Rewrites the ids of the fragment instances, so that the replayed queries don't conflict with each other,
+    // and the addresses, so that all the fragments run on the test BE and report to this tool.
+    TUniqueId _rewrite(std::vector<TExecPlanFragmentParams>* fragments) {
+        const TUniqueId old_query_id = fragments->front().params.query_id;
+        const TUniqueId query_id = generate_uuid();
+        // The ids of the fragment instances are derived from the query id, so they keep the same offsets.
+        auto remap = [&](TUniqueId* id) {
+            if (id->hi == old_query_id.hi) {
+                id->__set_hi(query_id.hi);
+                id->__set_lo(query_id.lo + (id->lo - old_query_id.lo));
+            }
+        };
+        // The descriptor table may be sent only once per query on the captured BE.
+        const TDescriptorTable* desc_tbl = nullptr;
+        for (const auto& fragment : *fragments) {
+            if (fragment.__isset.desc_tbl && !(fragment.desc_tbl.__isset.is_cached && fragment.desc_tbl.is_cached)) {
+                desc_tbl = &fragment.desc_tbl;
+                break;
+            }
+        }
+        const TDescriptorTable full_desc_tbl = desc_tbl != nullptr ? *desc_tbl : TDescriptorTable();
+        for (auto& fragment : *fragments) {
+            auto& params = fragment.params;
+            params.__set_query_id(query_id);
+            remap(&params.fragment_instance_id);
+            for (auto& destination : params.destinations) {
+                remap(&destination.fragment_instance_id);
+                destination.server.__set_hostname(_be_addr.hostname);
+                destination.__set_brpc_server(_be_addr);
+            }
+            if (params.__isset.runtime_filter_params) {
+                for (auto& [_, probers] : params.runtime_filter_params.id_to_prober_params) {
+                    for (auto& prober : probers) {
+                        remap(&prober.fragment_instance_id);
+                        prober.__set_fragment_instance_address(_be_addr);
+                    }
+                }
+            }
+            if (desc_tbl != nullptr && fragment.desc_tbl.__isset.is_cached && fragment.desc_tbl.is_cached) {
+                fragment.__set_desc_tbl(full_desc_tbl);
+                fragment.desc_tbl.__set_is_cached(false);
+            }
+            fragment.__set_coord(_coord_addr);
+            if (FLAGS_replay_report_profile) {
+                fragment.query_options.__set_is_report_success(true);
+            }
+        }
+        return query_id;
+    }
+
+    Status _run(const std::vector<TExecPlanFragmentParams>& fragments, ReplayState* state) {
+        ThriftSerializer serializer(false, 4096);
+        const TUniqueId* result_instance = nullptr;
+        for (const auto& fragment : fragments) {
+            std::string buf;
+            RETURN_IF_ERROR(serializer.serialize(const_cast<TExecPlanFragmentParams*>(&fragment), &buf));
+            brpc::Controller cntl;
+            cntl.set_timeout_ms(FLAGS_replay_timeout_s * 1000L);
+            cntl.request_attachment().append(buf);
+            PExecPlanFragmentRequest request;
+            PExecPlanFragmentResult response;
+            _stub->exec_plan_fragment(&cntl, &request, &response, nullptr);
+            if (cntl.Failed()) {
+                return Status::InternalError("exec_plan_fragment rpc failed: " + cntl.ErrorText());
+            }
+            RETURN_IF_ERROR(Status(response.status()));
+            if (fragment.fragment.__isset.output_sink &&
+                fragment.fragment.output_sink.type == TDataSinkType::RESULT_SINK) {
+                result_instance = &fragment.params.fragment_instance_id;
+            }
+        }
+        if (result_instance != nullptr) {
+            RETURN_IF_ERROR(_fetch_results(*result_instance));
+        }
+
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(FLAGS_replay_timeout_s);
+        std::unique_lock<std::mutex> l(state->mutex);
+        if (!state->cv.wait_until(l, deadline, [&]() {
+                return state->num_done >= fragments.size() || !state->status.ok();
+            })) {
+            return Status::TimedOut(strings::Substitute("$0 of $1 fragment instances are done", state->num_done,
+                                                        fragments.size()));
+        }
+        return state->status;
+    }
+
+    // Drains the results, otherwise the result sink is blocked.
+    Status _fetch_results(const TUniqueId& fragment_instance_id) {
+        PFetchDataRequest request;
+        request.mutable_finst_id()->set_hi(fragment_instance_id.hi);
+        request.mutable_finst_id()->set_lo(fragment_instance_id.lo);
+        while (true) {
+            brpc::Controller cntl;
+            cntl.set_timeout_ms(FLAGS_replay_timeout_s * 1000L);
+            PFetchDataResult response;
+            _stub->fetch_data(&cntl, &request, &response, nullptr);
+            if (cntl.Failed()) {
+                return Status::InternalError("fetch_data rpc failed: " + cntl.ErrorText());
+            }
+            RETURN_IF_ERROR(Status(response.status()));
+            if (response.eos()) {
+                return Status::OK();
+            }
+        }
+    }
+
+    void _cancel(const std::vector<TExecPlanFragmentParams>& fragments) {
+        for (const auto& fragment : fragments) {
+            PCancelPlanFragmentRequest request;
+            request.mutable_finst_id()->set_hi(fragment.params.fragment_instance_id.hi);
+            request.mutable_finst_id()->set_lo(fragment.params.fragment_instance_id.lo);
+            request.mutable_query_id()->set_hi(fragment.params.query_id.hi);
+            request.mutable_query_id()->set_lo(fragment.params.query_id.lo);
+            request.set_is_pipeline(fragment.__isset.is_pipeline && fragment.is_pipeline);
+            request.set_cancel_reason(USER_CANCEL);
+            brpc::Controller cntl;
+            PCancelPlanFragmentResult response;
+            _stub->cancel_plan_fragment(&cntl, &request, &response, nullptr);
+        }
+    }
+
+    ReplayCoordinator* _coordinator;
+    doris::PBackendService_Stub* _stub;
+    TNetworkAddress _be_addr;
+    TNetworkAddress _coord_addr;
+};
+
+static int64_t percentile(const std::vector<int64_t>& sorted, double q) {
+    if (sorted.empty()) {
+        return 0;
+    }
+    size_t index = std::min(sorted.size() - 1, static_cast<size_t>(q * sorted.size()));
+    return sorted[index];
+}
+
+static void print_report(const std::vector<CapturedQuery>& queries, const std::vector<ReplayResult>& results,
+                         const std::vector<size_t>& query_indexes, int64_t elapsed_ns) {
+    std::vector<int64_t> latencies;
+    std::map<std::string, std::vector<int64_t>> query_latencies;
+    std::map<std::string, int64_t> operator_times;
+    size_t num_failed = 0;
+    for (size_t i = 0; i < results.size(); i++) {
+        const auto& result = results[i];
+        if (!result.status.ok()) {
+            num_failed++;
+            std::cout << "Query " << queries[query_indexes[i]].name << " failed: " << result.status << std::endl;
+            continue;
+        }
+        latencies.push_back(result.latency_ns);
+        query_latencies[queries[query_indexes[i]].name].push_back(result.latency_ns);
+        for (const auto& [name, time] : result.operator_times) {
+            operator_times[name] += time;
+        }
+    }
+    std::sort(latencies.begin(), latencies.end());
+    const double elapsed_s = static_cast<double>(elapsed_ns) / NANOS_PER_SEC;
+    auto ms = [](int64_t ns) { return static_cast<double>(ns) / 1000000; };
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "Replayed " << results.size() << " queries in " << elapsed_s << "s with concurrency "
+              << FLAGS_replay_concurrency << ", " << num_failed << " failed" << std::endl;
+    std::cout << "Throughput: " << latencies.size() / std::max(elapsed_s, 1e-9) << " queries/s" << std::endl;
+    std::cout << "Latency(ms): p50=" << ms(percentile(latencies, 0.5)) << " p90=" << ms(percentile(latencies, 0.9))
+              << " p99=" << ms(percentile(latencies, 0.99))
+              << " max=" << ms(latencies.empty() ? 0 : latencies.back()) << std::endl;
+
+    std::cout << std::endl << "Latency of each query(ms):" << std::endl;
+    for (auto& [name, query_latency] : query_latencies) {
+        std::sort(query_latency.begin(), query_latency.end());
+        std::cout << "  " << name << ": runs=" << query_latency.size()
+                  << " p50=" << ms(percentile(query_latency, 0.5)) << " max=" << ms(query_latency.back())
+                  << std::endl;
+    }
+
+    if (!operator_times.empty()) {
+        std::vector<std::pair<std::string, int64_t>> sorted(operator_times.begin(), operator_times.end());
+        std::sort(sorted.begin(), sorted.end(), [](const auto& a, const auto& b) { return a.second > b.second; });
+        std::cout << std::endl
+                  << "OperatorTotalTime of each operator per run(ms), summed across the instances:" << std::endl;
+        for (const auto& [name, time] : sorted) {
+            std::cout << "  " << name << ": " << ms(time / std::max<size_t>(latencies.size(), 1)) << std::endl;
+        }
+    }
+}
+
+static int replay() {
+    std::vector<CapturedQuery> queries;
+    Status st = load_captured_queries(FLAGS_replay_capture_dir, &queries);
+    if (!st.ok()) {
+        std::cout << "Fail to load captured queries: " << st << std::endl;
+        return -1;
+    }
+
+    auto coordinator = std::make_shared<ReplayCoordinator>();
+    std::shared_ptr<apache::thrift::TProcessor> processor(new FrontendServiceProcessor(coordinator));
+    ThriftServer server("fragment_replay_coordinator", processor, FLAGS_replay_report_port);
+    st = server.start();
+    if (!st.ok()) {
+        std::cout << "Fail to start the coordinator on port " << FLAGS_replay_report_port << ": " << st << std::endl;
+        return -1;
+    }
+
+    brpc::Channel channel;
+    brpc::ChannelOptions options;
+    options.timeout_ms = FLAGS_replay_timeout_s * 1000;
+    std::string endpoint = FLAGS_replay_be_host + ":" + std::to_string(FLAGS_replay_be_brpc_port);
+    if (channel.Init(endpoint.c_str(), &options) != 0) {
+        std::cout << "Fail to init brpc channel to " << endpoint << std::endl;
+        return -1;
+    }
+    doris::PBackendService_Stub stub(&channel);
+
+    const size_t num_runs = static_cast<size_t>(FLAGS_replay_concurrency) * FLAGS_replay_iterations;
+    std::vector<ReplayResult> results(num_runs);
+    std::vector<size_t> query_indexes(num_runs);
+    std::atomic<size_t> next_run{0};
+    const int64_t start_ns = MonotonicNanos();
+    std::vector<std::thread> workers;
+    for (int i = 0; i < FLAGS_replay_concurrency; i++) {
+        workers.emplace_back([&]() {
+            Replayer replayer(coordinator.get(), &stub);
+            for (size_t run = next_run++; run < num_runs; run = next_run++) {
+                query_indexes[run] = run % queries.size();
+                results[run] = replayer.replay(queries[query_indexes[run]]);
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    print_report(queries, results, query_indexes, MonotonicNanos() - start_ns);
+    server.stop();
+    return 0;
+}
+
+} // namespace starrocks::tools
+
+int fragment_replay_main(int argc, char** argv) {
+    gflags::SetUsageMessage(
+            "Replay the plan fragments captured by config::plan_fragment_capture_dir against a BE.\n"
+            "Usage: fragment_replay --replay_capture_dir=<dir> --replay_be_host=<host> "
+            "--replay_be_brpc_port=<port> --replay_concurrency=<n> --replay_iterations=<n>");
+    google::ParseCommandLineFlags(&argc, &argv, true);
+    if (FLAGS_replay_capture_dir.empty() || FLAGS_replay_concurrency <= 0 || FLAGS_replay_iterations <= 0) {
+        std::cout << gflags::ProgramUsage() << std::endl;
+        return -1;
+    }
+    return starrocks::tools::replay();
+}
@@ -139,6 +139,42 @@ void BitmapValue::add(uint64_t value) {
     }
 }
 
+void BitmapValue::add_many(size_t n_args, const uint64_t* vals) {
+    if (_type != BITMAP) {
+        size_t size = _type == EMPTY ? 0 : (_type == SINGLE ? 1 : _set->size());
+        if (size + n_args <= 32) {
+            for (size_t i = 0; i < n_args; ++i) {
+                add(vals[i]);
+            }
+            return;
+        }
+        if (_type == SET) {
+            _from_set_to_bitmap();
+        } else {
+            _bitmap = std::make_shared<detail::Roaring64Map>();
+            if (_type == SINGLE) {
+                _bitmap->add(_sv);
+            }
+            _type = BITMAP;
+        }
+    }
+    _bitmap->addMany(n_args, vals);
+    // e.g. all the values are the same
+    _convert_to_smaller_type();
+}
+
+void BitmapValue::union_many(const BitmapValue* values, size_t n) {
+    std::vector<uint64_t> singles;
+    for (size_t i = 0; i < n; ++i) {
+        if (values[i]._type == SINGLE) {
+            singles.emplace_back(values[i]._sv);
+        } else {
+            *this |= values[i];
+        }
+    }
+    add_many(singles.size(), singles.data());
+}
+
 void BitmapValue::_from_set_to_bitmap() {
     _bitmap = std::make_shared<detail::Roaring64Map>();
     for (auto x : *_set) {
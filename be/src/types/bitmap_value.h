@@ -71,6 +71,13 @@ public:
 
     void add(uint64_t value);
 
+    // Add the values in bulk, a bitmap of more than 32 elements adds them to the Roaring bitmap at once.
+    void add_many(size_t n_args, const uint64_t* vals);
+
+    // Compute the union between the current bitmap and the n provided bitmaps. The elements of the
+    // bitmaps with one element are collected and added in bulk.
+    void union_many(const BitmapValue* values, size_t n);
+
     // Note: rhs BitmapValue is only readable after this method
     // Compute the union between the current bitmap and the provided bitmap.
     // Possible type transitions are:
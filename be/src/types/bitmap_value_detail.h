@@ -146,9 +146,20 @@ public:
         }
     }
     void addMany(size_t n_args, const uint64_t* vals) {
-        for (size_t lcv = 0; lcv < n_args; lcv++) {
-            roarings[highBytes(vals[lcv])].add(lowBytes(vals[lcv]));
-            roarings[highBytes(vals[lcv])].setCopyOnWrite(copyOnWrite);
+        // the values in a run with the same high bytes are added to their 32-bit bitmap at once,
+        // instead of looking up the bitmap for every value
+        constexpr size_t kBatchSize = 256;
+        uint32_t lows[kBatchSize];
+        size_t lcv = 0;
+        while (lcv < n_args) {
+            uint32_t high = highBytes(vals[lcv]);
+            size_t n = 0;
+            while (lcv < n_args && n < kBatchSize && highBytes(vals[lcv]) == high) {
+                lows[n++] = lowBytes(vals[lcv++]);
+            }
+            auto& roaring = roarings[high];
+            roaring.addMany(n, lows);
+            roaring.setCopyOnWrite(copyOnWrite);
         }
     }
 
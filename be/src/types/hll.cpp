@@ -25,6 +25,7 @@
 #include <immintrin.h>
 #endif
 
+#include <algorithm>
 #include <cmath>
 #include <map>
 
@@ -162,6 +163,19 @@ void HyperLogLog::update(uint64_t hash_value) {
     }
 }
 
+void HyperLogLog::update_batch(const uint64_t* hash_values, size_t num) {
+    size_t i = 0;
+    // The explicit values are inserted one by one, until they are converted to the registers.
+    for (; i < num && (_type == HLL_DATA_EMPTY || _type == HLL_DATA_EXPLICIT); ++i) {
+        if (hash_values[i] != 0) {
+            update(hash_values[i]);
+        }
+    }
+    if (i < num) {
+        _update_registers_batch(hash_values + i, num - i);
+    }
+}
+
 void HyperLogLog::merge(const HyperLogLog& other) {
     // fast path
     if (other._type == HLL_DATA_EMPTY) {
@@ -230,6 +244,74 @@ void HyperLogLog::merge(const HyperLogLog& other) {
     }
 }
 
+void HyperLogLog::merge(const Slice& slice) {
+    if (slice.data == nullptr || slice.size <= 0 || !is_valid(slice)) {
+        return;
+    }
+    const uint8_t* ptr = (uint8_t*)slice.data;
+    auto other_type = (HllDataType)*ptr++;
+    switch (other_type) {
+    case HLL_DATA_EMPTY:
+        break;
+    case HLL_DATA_EXPLICIT: {
+        uint8_t num_explicits = *ptr++;
+        if (_type == HLL_DATA_EMPTY || _type == HLL_DATA_EXPLICIT) {
+            if (_type == HLL_DATA_EMPTY) {
+                _hash_set = std::make_unique<ElementSet>();
+                _type = HLL_DATA_EXPLICIT;
+            }
+            for (int i = 0; i < num_explicits; ++i) {
+                _hash_set->insert(decode_fixed64_le(ptr));
+                ptr += 8;
+            }
+            // Same as merging HyperLogLog, the max number of explicit values is 2 * 160.
+            if (_hash_set->size() > HLL_EXPLICLIT_INT64_NUM) {
+                _convert_explicit_to_register();
+                _type = HLL_DATA_FULL;
+            }
+        } else {
+            for (int i = 0; i < num_explicits; ++i) {
+                _update_registers(decode_fixed64_le(ptr));
+                ptr += 8;
+            }
+        }
+        break;
+    }
+    case HLL_DATA_SPARSE:
+    case HLL_DATA_FULL: {
+        if (_type == HLL_DATA_EMPTY) {
+            DCHECK_EQ(_registers.data, nullptr);
+            ChunkAllocator::instance()->allocate(HLL_REGISTERS_COUNT, &_registers);
+            DCHECK_NE(_registers.data, nullptr);
+            DCHECK_EQ(_registers.size, HLL_REGISTERS_COUNT);
+            if (other_type == HLL_DATA_FULL) {
+                memcpy(_registers.data, ptr, HLL_REGISTERS_COUNT);
+                _type = HLL_DATA_FULL;
+                break;
+            }
+            memset(_registers.data, 0, HLL_REGISTERS_COUNT);
+            _type = other_type;
+        } else if (_type == HLL_DATA_EXPLICIT) {
+            _convert_explicit_to_register();
+            _type = HLL_DATA_FULL;
+        }
+
+        if (other_type == HLL_DATA_FULL) {
+            _merge_registers(ptr);
+            break;
+        }
+        uint32_t num_registers = decode_fixed32_le(ptr);
+        ptr += 4;
+        for (uint32_t i = 0; i < num_registers; ++i) {
+            uint16_t register_idx = decode_fixed16_le(ptr);
+            ptr += 2;
+            _registers.data[register_idx] = std::max(_registers.data[register_idx], *ptr++);
+        }
+        break;
+    }
+    }
+}
+
 size_t HyperLogLog::max_serialized_size() const {
     switch (_type) {
     case HLL_DATA_EMPTY:
@@ -485,7 +567,7 @@ void HyperLogLog::clear() {
     _hash_set.reset();
 }
 
-void HyperLogLog::_merge_registers(uint8_t* other_registers) {
+void HyperLogLog::_merge_registers(const uint8_t* other_registers) {
 #ifdef __AVX2__
     int loop = HLL_REGISTERS_COUNT / 32;
     uint8_t* dst = _registers.data;
@@ -497,6 +579,17 @@ void HyperLogLog::_merge_registers(uint8_t* other_registers) {
         src += 32;
         dst += 32;
     }
+#elif defined(__SSE2__)
+    int loop = HLL_REGISTERS_COUNT / 16;
+    uint8_t* dst = _registers.data;
+    const uint8_t* src = other_registers;
+    for (int i = 0; i < loop; i++) {
+        __m128i xa = _mm_loadu_si128((const __m128i*)dst);
+        __m128i xb = _mm_loadu_si128((const __m128i*)src);
+        _mm_storeu_si128((__m128i*)dst, _mm_max_epu8(xa, xb));
+        src += 16;
+        dst += 16;
+    }
 #else
     for (int i = 0; i < HLL_REGISTERS_COUNT; i++) {
         _registers.data[i] = std::max(_registers.data[i], other_registers[i]);
@@ -504,4 +597,27 @@ void HyperLogLog::_merge_registers(uint8_t* other_registers) {
 #endif
 }
 
+void HyperLogLog::_update_registers_batch(const uint64_t* hash_values, size_t num) {
+    // The register indexes and the ranks of a block are computed by a loop without any dependency between
+    // the values, which can be vectorized, and then applied to the registers by the max update.
+    constexpr size_t BLOCK_SIZE = 256;
+    uint16_t indexes[BLOCK_SIZE];
+    uint8_t ranks[BLOCK_SIZE];
+    uint8_t* registers = _registers.data;
+    for (size_t start = 0; start < num; start += BLOCK_SIZE) {
+        const size_t block_size = std::min(BLOCK_SIZE, num - start);
+        const uint64_t* values = hash_values + start;
+        for (size_t i = 0; i < block_size; ++i) {
+            uint64_t hash_value = values[i];
+            indexes[i] = hash_value % HLL_REGISTERS_COUNT;
+            uint64_t bits = (hash_value >> HLL_COLUMN_PRECISION) | ((uint64_t)1 << HLL_ZERO_COUNT_BITS);
+            // The rank of a zero hash value is 0, which never changes the register.
+            ranks[i] = (hash_value != 0) * (__builtin_ctzll(bits) + 1);
+        }
+        for (size_t i = 0; i < block_size; ++i) {
+            registers[indexes[i]] = std::max(registers[indexes[i]], ranks[i]);
+        }
+    }
+}
+
 } // namespace starrocks
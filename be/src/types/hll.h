@@ -100,8 +100,17 @@ public:
     // NOTE: input must be a hash_value
     void update(uint64_t hash_value);
 
+    // Add |num| hash values to this HLL value, the zero ones are skipped.
+    // Once the registers are used, they are updated by a branch-free loop over the whole batch instead of
+    // switching on the type for each value.
+    void update_batch(const uint64_t* hash_values, size_t num);
+
     void merge(const HyperLogLog& other);
 
+    // Merge a serialized HLL value without deserializing it into a temporary HyperLogLog, so that no registers
+    // are allocated and copied. An invalid |slice| is merged as an empty HLL value.
+    void merge(const Slice& slice);
+
     // Return max size of serialized binary
     size_t max_serialized_size() const;
 
@@ -146,7 +155,10 @@ private:
     void _convert_explicit_to_register();
 
     // absorb other registers into this registers
-    void _merge_registers(uint8_t* other_registers);
+    void _merge_registers(const uint8_t* other_registers);
+
+    // update a batch of hash values into this registers
+    void _update_registers_batch(const uint64_t* hash_values, size_t num);
 
     // update one hash value into this registers
     void _update_registers(uint64_t hash_value) {
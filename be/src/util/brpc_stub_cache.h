@@ -28,6 +28,7 @@
 #include "gen_cpp/doris_internal_service.pb.h"
 #include "gen_cpp/internal_service.pb.h"
 #include "service/brpc.h"
+#include "common/config.h"
 #include "util/spinlock.h"
 #include "util/starrocks_metrics.h"
 
@@ -38,6 +39,7 @@ class BrpcStubCache {
 public:
     BrpcStubCache() {
         _stub_map.init(239);
+        _large_payload_stub_map.init(239);
         REGISTER_GAUGE_STARROCKS_METRIC(brpc_endpoint_stub_count, [this]() {
             std::lock_guard<SpinLock> l(_lock);
             return _stub_map.size();
@@ -47,6 +49,9 @@ public:
         for (auto& stub : _stub_map) {
             delete stub.second;
         }
+        for (auto& stub : _large_payload_stub_map) {
+            delete stub.second;
+        }
     }
 
     doris::PBackendService_Stub* get_stub(const butil::EndPoint& endpoint) {
@@ -70,6 +75,46 @@ public:
         return stub;
     }
 
+    // The stub of the large payload transport, which doesn't share the connection with the small requests,
+    // so that the large chunks of a shuffle don't block the small requests, e.g. the runtime filters and the eos.
+    // It may use RDMA instead of TCP, see brpc_large_payload_use_rdma.
+    // Fall back to the stub returned by get_stub(), if the transport cannot be initialized.
+    doris::PBackendService_Stub* get_large_payload_stub(const butil::EndPoint& endpoint) {
+        {
+            std::lock_guard<SpinLock> l(_lock);
+            auto stub_ptr = _large_payload_stub_map.seek(endpoint);
+            if (stub_ptr != nullptr) {
+                return *stub_ptr;
+            }
+            brpc::ChannelOptions options;
+            options.connect_timeout_ms = 3000;
+            options.max_retry = 3;
+            options.connection_type = config::brpc_large_payload_connection_type.c_str();
+#ifdef BRPC_WITH_RDMA
+            options.use_rdma = config::brpc_large_payload_use_rdma;
+#endif
+            std::unique_ptr<brpc::Channel> channel(new brpc::Channel());
+            if (channel->Init(endpoint, &options) == 0) {
+                auto stub =
+                        new doris::PBackendService_Stub(channel.release(), google::protobuf::Service::STUB_OWNS_CHANNEL);
+                _large_payload_stub_map.insert(endpoint, stub);
+                return stub;
+            }
+        }
+        LOG(WARNING) << "fail to init the large payload channel, fall back to the default channel, endpoint="
+                     << endpoint;
+        return get_stub(endpoint);
+    }
+
+    doris::PBackendService_Stub* get_large_payload_stub(const TNetworkAddress& taddr) {
+        butil::EndPoint endpoint;
+        if (str2endpoint(taddr.hostname.c_str(), taddr.port, &endpoint)) {
+            LOG(WARNING) << "unknown endpoint, hostname=" << taddr.hostname;
+            return nullptr;
+        }
+        return get_large_payload_stub(endpoint);
+    }
+
     doris::PBackendService_Stub* get_stub(const TNetworkAddress& taddr) {
         butil::EndPoint endpoint;
         if (str2endpoint(taddr.hostname.c_str(), taddr.port, &endpoint)) {
@@ -91,6 +136,7 @@ public:
 private:
     SpinLock _lock;
     butil::FlatMap<butil::EndPoint, doris::PBackendService_Stub*> _stub_map;
+    butil::FlatMap<butil::EndPoint, doris::PBackendService_Stub*> _large_payload_stub_map;
 };
 
 } // namespace starrocks
@@ -34,6 +34,7 @@
 #include <spe.h>
 #endif
 
+#include <pthread.h>
 #include <sched.h>
 #include <sys/sysinfo.h>
 #include <unistd.h>
@@ -307,6 +308,28 @@ int CpuInfo::get_current_core() {
 #endif
 }
 
+bool CpuInfo::bind_current_thread_to_numa_node(int node) {
+#ifdef __linux__
+    const auto& cores = get_cores_of_numa_node(node);
+    if (cores.empty()) {
+        return false;
+    }
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    for (int core : cores) {
+        CPU_SET(core, &cpu_set);
+    }
+    int ret = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set);
+    if (ret != 0) {
+        LOG_FIRST_N(WARNING, 5) << "Failed to bind thread to NUMA node " << node << ", errno=" << ret;
+        return false;
+    }
+    return true;
+#else
+    return false;
+#endif
+}
+
 void CpuInfo::_get_cache_info(long cache_sizes[NUM_CACHE_LEVELS], long cache_line_sizes[NUM_CACHE_LEVELS]) {
 #ifdef __APPLE__
     // On Mac OS X use sysctl() to get the cache sizes
@@ -137,6 +137,11 @@ public:
         return numa_node_core_idx_[core];
     }
 
+    /// Binds the current thread to the cores of the given NUMA node. Returns false, if the node
+    /// has no cores or the affinity cannot be set. 'node' must be in the range
+    /// [0, GetMaxNumNumaNodes()).
+    static bool bind_current_thread_to_numa_node(int node);
+
     /// Returns the model name of the cpu (e.g. Intel i7-2600)
     static std::string model_name() {
         DCHECK(initialized_);
@@ -43,6 +43,8 @@ public:
         }
     }
 
+    const C& context() const { return _ctx; }
+
     brpc::Controller cntl;
     T result;
 
@@ -5,6 +5,7 @@
 #include <glog/logging.h>
 
 #include <atomic>
+#include <functional>
 #include <iostream>
 #include <list>
 #include <mutex>
@@ -238,6 +239,27 @@ public:
         }
     }
 
+    // clear unused objects satisfying |pred| in LRU order until the size is no larger than |target_size|
+    // return false if the size is still larger than |target_size|
+    bool try_evict(size_t target_size, const std::function<bool(T&)>& pred) {
+        std::lock_guard<std::mutex> lg(_lock);
+        auto itr = _list.begin();
+        while (_size > target_size && itr != _list.end()) {
+            Entry* entry = (*itr);
+            if (entry->_ref == 1 && pred(entry->_value)) {
+                _map.erase(entry->key());
+                itr = _list.erase(itr);
+                _object_size--;
+                _size -= entry->_size;
+                if (_mem_tracker) _mem_tracker->release(entry->_size);
+                delete entry;
+            } else {
+                itr++;
+            }
+        }
+        return _size <= target_size;
+    }
+
     size_t object_size() const { return _object_size; }
     size_t size() const { return _size; }
 
@@ -18,13 +18,16 @@ namespace starrocks::vectorized {
 // FixedSizeHashMap
 // Key: KeyType integer type eg: uint8 uint16
 // value shouldn't be nullptr
+// The keys index an array directly, so they must be in [0, TableSize) as unsigned integers.
+// TableSize defaults to the whole range of KeyType, and may be smaller for the keys of a known small range,
+// e.g. the dictionary codes of a low-cardinality column.
 
-template <typename KeyType, typename ValueType>
+template <typename KeyType, typename ValueType, int TableSize = (1 << sizeof(KeyType) * 8)>
 class SmallFixedSizeHashMap {
 public:
     static_assert(std::is_integral_v<KeyType>);
     static_assert(std::is_pointer_v<ValueType>);
-    static constexpr int hash_table_size = 1 << sizeof(KeyType) * 8;
+    static constexpr int hash_table_size = TableSize;
 
     using key_type = KeyType;
     using search_key_type = typename std::make_unsigned<KeyType>::type;
@@ -71,6 +74,7 @@ public:
     template <class F>
     iterator lazy_emplace(KeyType key, F&& f) {
         auto search_key = static_cast<search_key_type>(key);
+        DCHECK_LT(search_key, hash_table_size);
         if (_hash_table[search_key] == nullptr) {
             _size++;
             f([&](KeyType key, ValueType value) {
@@ -83,7 +87,8 @@ public:
 
     iterator find(KeyType key) {
         auto search_key = static_cast<search_key_type>(key);
-        if (_hash_table[search_key] != nullptr) {
+        DCHECK_LT(search_key, hash_table_size);
+        if (_hash_table[search_key] == nullptr) {
             return end();
         }
         return iterator(_hash_table, search_key);
@@ -123,11 +128,11 @@ private:
     ValueType _hash_table[hash_table_size + 1];
 };
 
-template <typename KeyType>
+template <typename KeyType, int TableSize = (1 << sizeof(KeyType) * 8)>
 class SmallFixedSizeHashSet {
 public:
     static_assert(std::is_integral_v<KeyType>);
-    static constexpr int hash_table_size = 1 << sizeof(KeyType) * 8;
+    static constexpr int hash_table_size = TableSize;
 
     using key_type = KeyType;
     using search_key_type = typename std::make_unsigned<KeyType>::type;
@@ -172,6 +177,7 @@ public:
     iterator end() { return iterator(_hash_table, hash_table_size); }
 
     void emplace(KeyType key) {
+        DCHECK_LT(static_cast<search_key_type>(key), hash_table_size);
         _size += _hash_table[static_cast<search_key_type>(key)] == 0;
         _hash_table[static_cast<search_key_type>(key)] = 1;
     }
@@ -0,0 +1,36 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "util/huge_page.h"
+
+#include <sys/mman.h>
+
+#include <cstdint>
+
+#include "common/config.h"
+#include "common/logging.h"
+#include "util/starrocks_metrics.h"
+
+namespace starrocks {
+
+size_t madvise_huge_pages(void* data, size_t size) {
+    if (!config::madvise_huge_pages || data == nullptr) {
+        return 0;
+    }
+    auto begin = (reinterpret_cast<uintptr_t>(data) + HUGE_PAGE_SIZE - 1) & ~(HUGE_PAGE_SIZE - 1);
+    auto end = (reinterpret_cast<uintptr_t>(data) + size) & ~(HUGE_PAGE_SIZE - 1);
+    if (begin >= end) {
+        return 0;
+    }
+#ifdef MADV_HUGEPAGE
+    if (madvise(reinterpret_cast<void*>(begin), end - begin, MADV_HUGEPAGE) != 0) {
+        PLOG_EVERY_N(WARNING, 1000) << "fail to madvise huge pages";
+        return 0;
+    }
+    StarRocksMetrics::instance()->memory_huge_page_advised_bytes.increment(end - begin);
+    return end - begin;
+#else
+    return 0;
+#endif
+}
+
+} // namespace starrocks
@@ -0,0 +1,28 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <cstddef>
+
+namespace starrocks {
+
+static constexpr size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+// Advise the kernel to back the 2MB aligned pages inside [data, data + size) with transparent huge pages if
+// `madvise_huge_pages` is true. It should be called before the memory is touched, the pages touched already are
+// only collapsed into huge pages later by khugepaged.
+// Return the bytes advised, 0 if the range covers no whole huge page.
+size_t madvise_huge_pages(void* data, size_t size);
+
+// Resize |buffer| to |n| elements of |value|, its storage being advised to be backed by huge pages before it
+// is filled. Used for the large arrays accessed randomly, such as the buckets of the join hash tables.
+template <typename Buffer, typename T>
+void resize_on_huge_pages(Buffer* buffer, size_t n, const T& value) {
+    if (n * sizeof(typename Buffer::value_type) >= HUGE_PAGE_SIZE && n > buffer->capacity()) {
+        buffer->reserve(n);
+        madvise_huge_pages(buffer->data(), buffer->capacity() * sizeof(typename Buffer::value_type));
+    }
+    buffer->resize(n, value);
+}
+
+} // namespace starrocks
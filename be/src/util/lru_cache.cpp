@@ -155,6 +155,8 @@ LRUCache::LRUCache() {
     // Make empty circular linked list
     _lru.next = &_lru;
     _lru.prev = &_lru;
+    _protected_lru.next = &_protected_lru;
+    _protected_lru.prev = &_protected_lru;
 }
 
 LRUCache::~LRUCache() {
@@ -181,6 +183,34 @@ void LRUCache::_lru_append(LRUHandle* list, LRUHandle* e) {
     e->next->prev = e;
 }
 
+void LRUCache::_lru_put(LRUHandle* e) {
+    if (e->referenced && !e->in_protected && _protected_capacity > 0) {
+        // promote the entry which is looked up again
+        e->in_protected = true;
+        _protected_usage += e->charge;
+    }
+    e->referenced = false;
+    if (!e->in_protected) {
+        _lru_append(&_lru, e);
+        return;
+    }
+    _lru_append(&_protected_lru, e);
+    // demote the oldest protected entries to the newest probationary ones
+    while (_protected_usage > _protected_capacity && _protected_lru.next != &_protected_lru) {
+        LRUHandle* old = _protected_lru.next;
+        _lru_remove(old);
+        _protected_remove(old);
+        _lru_append(&_lru, old);
+    }
+}
+
+void LRUCache::_protected_remove(LRUHandle* e) {
+    if (e->in_protected) {
+        e->in_protected = false;
+        _protected_usage -= e->charge;
+    }
+}
+
 Cache::Handle* LRUCache::lookup(const CacheKey& key, uint32_t hash) {
     std::lock_guard l(_mutex);
     ++_lookup_count;
@@ -193,6 +223,7 @@ Cache::Handle* LRUCache::lookup(const CacheKey& key, uint32_t hash) {
             _lru_remove(e);
         }
         e->refs++;
+        e->referenced = true;
         ++_hit_count;
     }
     return reinterpret_cast<Cache::Handle*>(e);
@@ -214,13 +245,14 @@ void LRUCache::release(Cache::Handle* handle) {
             if (_usage > _capacity) {
                 // take this opportunity and remove the item
                 _table.remove(e->key(), e->hash);
+                _protected_remove(e);
                 e->in_cache = false;
                 _unref(e);
                 _usage -= e->charge;
                 last_ref = true;
             } else {
                 // put it to LRU free list
-                _lru_append(&_lru, e);
+                _lru_put(e);
             }
         }
     }
@@ -232,30 +264,33 @@ void LRUCache::release(Cache::Handle* handle) {
 }
 
 void LRUCache::_evict_from_lru(size_t charge, std::vector<LRUHandle*>* deleted) {
-    LRUHandle* cur = &_lru;
-    // 1. evict normal cache entries
-    while (_usage + charge > _capacity && cur->next != &_lru) {
+    // 1. evict normal cache entries, the probationary ones first
+    _evict_from_list(&_lru, charge, CachePriority::NORMAL, deleted);
+    _evict_from_list(&_protected_lru, charge, CachePriority::NORMAL, deleted);
+    // 2. evict durable cache entries if need
+    _evict_from_list(&_lru, charge, CachePriority::DURABLE, deleted);
+    _evict_from_list(&_protected_lru, charge, CachePriority::DURABLE, deleted);
+}
+
+void LRUCache::_evict_from_list(LRUHandle* list, size_t charge, CachePriority max_priority,
+                                std::vector<LRUHandle*>* deleted) {
+    LRUHandle* cur = list;
+    while (_usage + charge > _capacity && cur->next != list) {
         LRUHandle* old = cur->next;
-        if (old->priority == CachePriority::DURABLE) {
+        if (old->priority > max_priority) {
             cur = cur->next;
             continue;
         }
         _evict_one_entry(old);
         deleted->push_back(old);
     }
-    // 2. evict durable cache entries if need
-    while (_usage + charge > _capacity && _lru.next != &_lru) {
-        LRUHandle* old = _lru.next;
-        DCHECK(old->priority == CachePriority::DURABLE);
-        _evict_one_entry(old);
-        deleted->push_back(old);
-    }
 }
 
 void LRUCache::_evict_one_entry(LRUHandle* e) {
     DCHECK(e->in_cache);
     DCHECK(e->refs == 1); // LRU list contains elements which may be evicted
     _lru_remove(e);
+    _protected_remove(e);
     _table.remove(e->key(), e->hash);
     e->in_cache = false;
     _unref(e);
@@ -273,6 +308,8 @@ Cache::Handle* LRUCache::insert(const CacheKey& key, uint32_t hash, void* value,
     e->refs = 2; // one for the returned handle, one for LRUCache.
     e->next = e->prev = nullptr;
     e->in_cache = true;
+    e->in_protected = false;
+    e->referenced = false;
     e->priority = priority;
     memcpy(e->key_data, key.data(), key.size());
     std::vector<LRUHandle*> last_ref_list;
@@ -289,6 +326,7 @@ Cache::Handle* LRUCache::insert(const CacheKey& key, uint32_t hash, void* value,
         auto old = _table.insert(e);
         _usage += charge;
         if (old != nullptr) {
+            _protected_remove(old);
             old->in_cache = false;
             if (_unref(old)) {
                 _usage -= old->charge;
@@ -324,6 +362,7 @@ void LRUCache::erase(const CacheKey& key, uint32_t hash) {
                     _lru_remove(e);
                 }
             }
+            _protected_remove(e);
             e->in_cache = false;
         }
     }
@@ -337,16 +376,19 @@ int LRUCache::prune() {
     std::vector<LRUHandle*> last_ref_list;
     {
         std::lock_guard l(_mutex);
-        while (_lru.next != &_lru) {
-            LRUHandle* old = _lru.next;
-            DCHECK(old->in_cache);
-            DCHECK(old->refs == 1); // LRU list contains elements which may be evicted
-            _lru_remove(old);
-            _table.remove(old->key(), old->hash);
-            old->in_cache = false;
-            _unref(old);
-            _usage -= old->charge;
-            last_ref_list.push_back(old);
+        for (LRUHandle* list : {&_lru, &_protected_lru}) {
+            while (list->next != list) {
+                LRUHandle* old = list->next;
+                DCHECK(old->in_cache);
+                DCHECK(old->refs == 1); // LRU list contains elements which may be evicted
+                _lru_remove(old);
+                _protected_remove(old);
+                _table.remove(old->key(), old->hash);
+                old->in_cache = false;
+                _unref(old);
+                _usage -= old->charge;
+                last_ref_list.push_back(old);
+            }
         }
     }
     for (auto entry : last_ref_list) {
@@ -355,6 +397,9 @@ int LRUCache::prune() {
     return last_ref_list.size();
 }
 
+// The share of the protected segment in the capacity of a segmented LRU shard.
+static constexpr size_t kProtectedPercent = 80;
+
 inline uint32_t ShardedLRUCache::_hash_slice(const CacheKey& s) {
     return s.hash(s.data(), s.size(), 0);
 }
@@ -363,11 +408,14 @@ uint32_t ShardedLRUCache::_shard(uint32_t hash) {
     return hash >> (32 - kNumShardBits);
 }
 
-ShardedLRUCache::ShardedLRUCache(size_t capacity) : _last_id(0) {
+ShardedLRUCache::ShardedLRUCache(size_t capacity, CacheEvictionPolicy policy) : _last_id(0) {
     const size_t per_shard = (capacity + (kNumShards - 1)) / kNumShards;
 
     for (auto& _shard : _shards) {
         _shard.set_capacity(per_shard);
+        if (policy == CacheEvictionPolicy::SLRU) {
+            _shard.set_protected_capacity(per_shard * kProtectedPercent / 100);
+        }
     }
 }
 
@@ -456,8 +504,8 @@ void ShardedLRUCache::get_cache_status(rapidjson::Document* document) {
     }
 }
 
-Cache* new_lru_cache(size_t capacity) {
-    return new ShardedLRUCache(capacity);
+Cache* new_lru_cache(size_t capacity, CacheEvictionPolicy policy) {
+    return new ShardedLRUCache(capacity, policy);
 }
 
 } // namespace starrocks
@@ -19,9 +19,18 @@ namespace starrocks {
 class Cache;
 class CacheKey;
 
+enum class CacheEvictionPolicy {
+    // Evict the least recently used entries.
+    LRU,
+    // Segmented LRU: the new entries are kept in a probationary segment, and move to a protected segment when they
+    // are looked up again. The probationary entries are evicted first, so a scan of the entries which are accessed
+    // only once doesn't evict the frequently accessed ones.
+    SLRU
+};
+
 // Create a new cache with a fixed size capacity.  This implementation
-// of Cache uses a least-recently-used eviction policy.
-extern Cache* new_lru_cache(size_t capacity);
+// of Cache uses a least-recently-used eviction policy by default.
+extern Cache* new_lru_cache(size_t capacity, CacheEvictionPolicy policy = CacheEvictionPolicy::LRU);
 
 class CacheKey {
 public:
@@ -190,7 +199,9 @@ typedef struct LRUHandle {
     LRUHandle* prev;
     size_t charge;
     size_t key_length;
-    bool in_cache; // Whether entry is in the cache.
+    bool in_cache;     // Whether entry is in the cache.
+    bool in_protected; // Whether entry is in the protected segment of the cache.
+    bool referenced;   // Whether entry is looked up since it's put into an LRU list.
     uint32_t refs;
     uint32_t hash; // Hash of key(); used for fast sharding and comparisons
     CachePriority priority = CachePriority::NORMAL;
@@ -254,6 +265,9 @@ public:
     // Separate from constructor so caller can easily make an array of LRUCache
     void set_capacity(size_t capacity) { _capacity = capacity; }
 
+    // Set the capacity of the protected segment of the segmented LRU, which is disabled if it's 0.
+    void set_protected_capacity(size_t capacity) { _protected_capacity = capacity; }
+
     // Like Cache methods, but with an extra "hash" parameter.
     Cache::Handle* insert(const CacheKey& key, uint32_t hash, void* value, size_t charge,
                           void (*deleter)(const CacheKey& key, void* value),
@@ -267,12 +281,19 @@ public:
     uint64_t get_hit_count() const { return _hit_count; }
     size_t get_usage() const { return _usage; }
     size_t get_capacity() const { return _capacity; }
+    size_t get_protected_usage() const { return _protected_usage; }
 
 private:
     void _lru_remove(LRUHandle* e);
     void _lru_append(LRUHandle* list, LRUHandle* e);
+    // Put the unused entry |e| into the LRU list of its segment.
+    void _lru_put(LRUHandle* e);
+    // Remove |e| which is leaving the cache from the protected segment.
+    void _protected_remove(LRUHandle* e);
     bool _unref(LRUHandle* e);
     void _evict_from_lru(size_t charge, std::vector<LRUHandle*>* deleted);
+    void _evict_from_list(LRUHandle* list, size_t charge, CachePriority max_priority,
+                          std::vector<LRUHandle*>* deleted);
     void _evict_one_entry(LRUHandle* e);
 
     // Initialized before use.
@@ -283,10 +304,15 @@ private:
     size_t _usage{0};
     uint64_t _last_id{0};
 
+    size_t _protected_capacity{0};
+    size_t _protected_usage{0};
+
     // Dummy head of LRU list.
     // lru.prev is newest entry, lru.next is oldest entry.
     // Entries have refs==1 and in_cache==true.
     LRUHandle _lru;
+    // Dummy head of LRU list of the protected segment, like |_lru|.
+    LRUHandle _protected_lru;
 
     HandleTable _table;
 
@@ -299,7 +325,7 @@ static const int kNumShards = 1 << kNumShardBits;
 
 class ShardedLRUCache : public Cache {
 public:
-    explicit ShardedLRUCache(size_t capacity);
+    explicit ShardedLRUCache(size_t capacity, CacheEvictionPolicy policy = CacheEvictionPolicy::LRU);
     ~ShardedLRUCache() override = default;
     Handle* insert(const CacheKey& key, void* value, size_t charge, void (*deleter)(const CacheKey& key, void* value),
                    CachePriority priority = CachePriority::NORMAL) override;
@@ -21,7 +21,9 @@
 
 #include "util/metrics.h"
 
+#include <array>
 #include <mutex>
+#include <thread>
 
 namespace starrocks {
 
@@ -82,6 +84,81 @@ const char* unit_name(MetricUnit unit) {
     }
 }
 
+// 1, 2, 5, 10, 20, 50, ..., 10^8
+static constexpr std::array<int64_t, HistogramMetric::kNumBounds> make_histogram_bounds() {
+    std::array<int64_t, HistogramMetric::kNumBounds> bounds{};
+    int64_t base = 1;
+    for (int i = 0; i < HistogramMetric::kNumBounds; i++) {
+        bounds[i] = base * (i % 3 == 0 ? 1 : (i % 3 == 1 ? 2 : 5));
+        if (i % 3 == 2) {
+            base *= 10;
+        }
+    }
+    return bounds;
+}
+
+static constexpr std::array<int64_t, HistogramMetric::kNumBounds> kHistogramBounds = make_histogram_bounds();
+static_assert(kHistogramBounds[HistogramMetric::kNumBounds - 1] == 100000000);
+
+HistogramMetric::HistogramMetric(MetricUnit unit) : Metric(MetricType::HISTOGRAM, unit) {
+    size_t num_shards = 8;
+    while (num_shards < std::thread::hardware_concurrency()) {
+        num_shards <<= 1;
+    }
+    _shard_mask = num_shards - 1;
+    _shards = std::make_unique<Shard[]>(num_shards);
+}
+
+const int64_t* HistogramMetric::bounds() {
+    return kHistogramBounds.data();
+}
+
+HistogramMetric::Snapshot HistogramMetric::snapshot() const {
+    Snapshot res;
+    for (size_t i = 0; i <= _shard_mask; i++) {
+        const Shard& shard = _shards[i];
+        for (int j = 0; j < kNumBuckets; j++) {
+            const int64_t count = __atomic_load_n(&shard.counts[j], __ATOMIC_RELAXED);
+            res.counts[j] += count;
+            res.count += count;
+        }
+        res.sum += __atomic_load_n(&shard.sum, __ATOMIC_RELAXED);
+    }
+    return res;
+}
+
+int64_t HistogramMetric::Snapshot::quantile(double q) const {
+    if (count == 0) {
+        return 0;
+    }
+    const auto rank = static_cast<int64_t>(q * count);
+    int64_t cumulative = 0;
+    for (int i = 0; i < kNumBounds; i++) {
+        cumulative += counts[i];
+        if (cumulative > rank) {
+            return kHistogramBounds[i];
+        }
+    }
+    return kHistogramBounds[kNumBounds - 1];
+}
+
+std::string HistogramMetric::to_string() const {
+    const Snapshot s = snapshot();
+    std::stringstream ss;
+    ss << "count=" << s.count << " sum=" << s.sum << " p50=" << s.quantile(0.5) << " p99=" << s.quantile(0.99);
+    return ss.str();
+}
+
+void HistogramMetric::write_value(rj::Value& metric_obj, rj::Document::AllocatorType& allocator) {
+    const Snapshot s = snapshot();
+    metric_obj.AddMember("value", rj::Value(s.count), allocator);
+    metric_obj.AddMember("sum", rj::Value(s.sum), allocator);
+    metric_obj.AddMember("p50", rj::Value(s.quantile(0.5)), allocator);
+    metric_obj.AddMember("p90", rj::Value(s.quantile(0.9)), allocator);
+    metric_obj.AddMember("p99", rj::Value(s.quantile(0.99)), allocator);
+    metric_obj.AddMember("p999", rj::Value(s.quantile(0.999)), allocator);
+}
+
 void Metric::hide() {
     if (_registry == nullptr) {
         return;
@@ -22,6 +22,7 @@
 #pragma once
 
 #include <gperftools/malloc_extension.h>
+#include <sched.h>
 
 #include <shared_mutex>
 
@@ -32,9 +33,11 @@ DIAGNOSTIC_IGNORE("-Wclass-memaccess")
 DIAGNOSTIC_POP
 #include <rapidjson/rapidjson.h>
 
+#include <algorithm>
 #include <atomic>
 #include <functional>
 #include <iomanip>
+#include <memory>
 #include <mutex>
 #include <ostream>
 #include <set>
@@ -213,6 +216,59 @@ public:
     virtual ~LockGauge() = default;
 };
 
+// Histogram of the observed values, e.g. the latencies, in the log-linear buckets of 1, 2, 5, 10, 20, 50, ...
+// up to 10^8 units, plus the bucket of the larger values, which is exported as the cumulative buckets of
+// Prometheus.
+//
+// Each core records into its own cache line of the buckets, so recording is about as cheap as a
+// CoreLocalCounter. A value is counted in the first bucket whose upper bound is not less than it.
+class HistogramMetric : public Metric {
+public:
+    // The upper bounds of the buckets, except the last bucket of the values larger than the max bound.
+    static constexpr int kNumBounds = 25;
+    static constexpr int kNumBuckets = kNumBounds + 1;
+
+    struct Snapshot {
+        int64_t counts[kNumBuckets] = {};
+        int64_t sum = 0;
+        int64_t count = 0;
+
+        // Estimates the quantile by the upper bound of the bucket, the max bound for the last bucket.
+        int64_t quantile(double q) const;
+    };
+
+    explicit HistogramMetric(MetricUnit unit);
+    ~HistogramMetric() override = default;
+
+    static const int64_t* bounds();
+
+    void observe(int64_t value) {
+        Shard& shard = _shards[sched_getcpu() & _shard_mask];
+        __atomic_fetch_add(&shard.counts[_bucket_index(value)], 1, __ATOMIC_RELAXED);
+        __atomic_fetch_add(&shard.sum, value, __ATOMIC_RELAXED);
+    }
+
+    Snapshot snapshot() const;
+
+    // e.g. "count=10 sum=1200 p50=100 p99=500"
+    std::string to_string() const override;
+    void write_value(rj::Value& metric_obj, rj::Document::AllocatorType& allocator) override;
+
+private:
+    struct alignas(CACHE_LINE_SIZE) Shard {
+        int64_t counts[kNumBuckets] = {};
+        int64_t sum = 0;
+    };
+
+    static int _bucket_index(int64_t value) {
+        const int64_t* b = bounds();
+        return static_cast<int>(std::lower_bound(b, b + kNumBounds, value) - b);
+    }
+
+    size_t _shard_mask;
+    std::unique_ptr<Shard[]> _shards;
+};
+
 // one key-value pair used to
 struct MetricLabel {
     std::string name;
@@ -436,5 +492,8 @@ private:
 #define METRIC_DEFINE_DOUBLE_GAUGE(metric_name, unit) \
     starrocks::DoubleGauge metric_name { unit }
 
+#define METRIC_DEFINE_HISTOGRAM(metric_name, unit) \
+    starrocks::HistogramMetric metric_name { unit }
+
 #define METRIC_DEFINE_TCMALLOC_GAUGE(metric_name, tcmalloc_var) \
     starrocks::TcmallocMetric metric_name { tcmalloc_var }
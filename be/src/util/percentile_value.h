@@ -22,6 +22,8 @@ public:
 
     void add(float value) { _tdigest.add(value); }
 
+    void add_many(const float* values, size_t n) { _tdigest.add(values, n); }
+
     void merge(const PercentileValue* other) { _tdigest.merge(&other->_tdigest); }
 
     uint64_t serialize_size() const {
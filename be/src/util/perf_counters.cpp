@@ -0,0 +1,77 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "util/perf_counters.h"
+
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+
+#include "common/logging.h"
+
+namespace starrocks {
+
+static int open_perf_event(uint64_t config, int group_fd) {
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = config;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP;
+    // count the calling thread on any cpu
+    return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, group_fd, 0));
+}
+
+ThreadPerfCounters::ThreadPerfCounters() {
+    static const uint64_t configs[kNumCounters] = {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+                                                    PERF_COUNT_HW_CACHE_MISSES};
+    for (int i = 0; i < kNumCounters; i++) {
+        _fds[i] = open_perf_event(configs[i], i == 0 ? -1 : _fds[0]);
+        if (_fds[i] < 0) {
+            static std::atomic<bool> logged{false};
+            if (!logged.exchange(true)) {
+                LOG(WARNING) << "Hardware counters are not available, perf_event_open failed: " << strerror(errno);
+            }
+            for (int j = 0; j < i; j++) {
+                close(_fds[j]);
+                _fds[j] = -1;
+            }
+            return;
+        }
+    }
+}
+
+ThreadPerfCounters::~ThreadPerfCounters() {
+    for (int fd : _fds) {
+        if (fd >= 0) {
+            close(fd);
+        }
+    }
+}
+
+ThreadPerfCounters* ThreadPerfCounters::get() {
+    thread_local ThreadPerfCounters counters;
+    return counters._fds[0] >= 0 ? &counters : nullptr;
+}
+
+bool ThreadPerfCounters::read(Values* values) const {
+    // the layout of PERF_FORMAT_GROUP without the other read formats
+    struct {
+        uint64_t nr;
+        uint64_t values[kNumCounters];
+    } data;
+    if (::read(_fds[0], &data, sizeof(data)) != sizeof(data) || data.nr != kNumCounters) {
+        return false;
+    }
+    values->cycles = static_cast<int64_t>(data.values[0]);
+    values->instructions = static_cast<int64_t>(data.values[1]);
+    values->llc_misses = static_cast<int64_t>(data.values[2]);
+    return true;
+}
+
+} // namespace starrocks
@@ -0,0 +1,74 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <cstdint>
+
+#include "util/runtime_profile.h"
+
+namespace starrocks {
+
+// The hardware counters of the calling thread, read from a perf_event group of the thread.
+// The counters only count in user space, and are not available if perf_event_open is not permitted,
+// e.g. perf_event_paranoid is too high or the process runs in a container without the capability.
+class ThreadPerfCounters {
+public:
+    struct Values {
+        int64_t cycles = 0;
+        int64_t instructions = 0;
+        int64_t llc_misses = 0;
+    };
+
+    ~ThreadPerfCounters();
+
+    // Returns the counters of the calling thread, which are opened on the first call in the thread,
+    // nullptr if they are not available.
+    static ThreadPerfCounters* get();
+
+    // Reads the current values of the counters, returns false on failure.
+    bool read(Values* values) const;
+
+private:
+    ThreadPerfCounters();
+
+    ThreadPerfCounters(const ThreadPerfCounters&) = delete;
+    const ThreadPerfCounters& operator=(const ThreadPerfCounters&) = delete;
+
+    static constexpr int kNumCounters = 3;
+    // the first one is the group leader
+    int _fds[kNumCounters] = {-1, -1, -1};
+};
+
+// Adds the hardware counters of the calling thread during the scope to the profile counters.
+// It does nothing if the profile counters are nullptr or the hardware counters are not available.
+class ScopedPerfCounters {
+public:
+    ScopedPerfCounters(RuntimeProfile::Counter* cycles, RuntimeProfile::Counter* instructions,
+                       RuntimeProfile::Counter* llc_misses)
+            : _cycles(cycles), _instructions(instructions), _llc_misses(llc_misses) {
+        if (_cycles != nullptr) {
+            _counters = ThreadPerfCounters::get();
+            if (_counters != nullptr && !_counters->read(&_start)) {
+                _counters = nullptr;
+            }
+        }
+    }
+
+    ~ScopedPerfCounters() {
+        ThreadPerfCounters::Values end;
+        if (_counters != nullptr && _counters->read(&end)) {
+            _cycles->update(end.cycles - _start.cycles);
+            _instructions->update(end.instructions - _start.instructions);
+            _llc_misses->update(end.llc_misses - _start.llc_misses);
+        }
+    }
+
+private:
+    RuntimeProfile::Counter* _cycles;
+    RuntimeProfile::Counter* _instructions;
+    RuntimeProfile::Counter* _llc_misses;
+    ThreadPerfCounters* _counters = nullptr;
+    ThreadPerfCounters::Values _start;
+};
+
+} // namespace starrocks
@@ -0,0 +1,193 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+#include "util/faststring.h"
+
+namespace starrocks {
+
+// The implementation of the patched frame-of-reference (PFOR) coding, see
+// "Super-Scalar RAM-CPU Cache Compression" and https://github.com/lemire/FastPFor.
+//
+// The values are split into blocks of BLOCK_SIZE values, and each block is encoded as follows:
+//
+//      BitWidth(1) ExceptionNum(1) MinValue(sizeof(T)) PackedDeltas ExceptionPositions(ExceptionNum)
+//      ExceptionHighBits(sizeof(T) * ExceptionNum)
+//
+// - The delta of a value is its distance to the minimum value of the block.
+// - The lowest BitWidth bits of all the deltas are packed, and the BitWidth is chosen to minimize the block size.
+// - The deltas which don't fit in BitWidth bits are the exceptions, whose high bits are patched after unpacking.
+//
+// Unlike FOR, a few outliers don't widen all the values of their block. The bit width of a block is dispatched to an
+// unpacking loop specialized for it, which is unrolled and vectorized by the compiler.
+//
+// The decoder reads the packed deltas by 8-byte words, so there must be at least 8 readable bytes after each block.
+template <typename T>
+class PForCoding {
+    static_assert(std::is_integral_v<T> && sizeof(T) <= sizeof(uint64_t), "PFOR only supports integers of 64 bits");
+
+public:
+    using UnsignedT = std::make_unsigned_t<T>;
+
+    static constexpr size_t BLOCK_SIZE = 128;
+    static constexpr int MAX_BIT_WIDTH = sizeof(T) * 8;
+    static constexpr size_t PADDING_SIZE = sizeof(uint64_t);
+    static constexpr size_t HEADER_SIZE = 2 + sizeof(T);
+
+    // Append the encoding of the |n| values to |out|, n <= BLOCK_SIZE.
+    static void encode_block(const T* values, size_t n, faststring* out);
+
+    // Decode the block of |n| values at |data| into |out|, n <= BLOCK_SIZE.
+    // Return the bytes of the block, or 0 if the block is corrupted.
+    static size_t decode_block(const uint8_t* data, size_t n, T* out);
+
+private:
+    static constexpr size_t packed_bytes(size_t n, int bit_width) { return (n * bit_width + 7) / 8; }
+
+    template <int BitWidth>
+    static void unpack(const uint8_t* in, size_t n, UnsignedT* out);
+
+    using UnpackFunc = void (*)(const uint8_t*, size_t, UnsignedT*);
+
+    template <size_t... BitWidths>
+    static constexpr std::array<UnpackFunc, sizeof...(BitWidths)> make_unpack_funcs(
+            std::index_sequence<BitWidths...>) {
+        return {&unpack<BitWidths>...};
+    }
+};
+
+template <typename T>
+template <int BitWidth>
+inline void PForCoding<T>::unpack(const uint8_t* in, size_t n, UnsignedT* out) {
+    if constexpr (BitWidth == 0) {
+        memset(out, 0, n * sizeof(UnsignedT));
+    } else {
+        constexpr uint64_t mask = BitWidth == 64 ? ~0ULL : (1ULL << BitWidth) - 1;
+        for (size_t i = 0; i < n; i++) {
+            const size_t bit_pos = i * BitWidth;
+            const size_t shift = bit_pos & 7;
+            uint64_t word;
+            memcpy(&word, in + (bit_pos >> 3), sizeof(word));
+            uint64_t value = word >> shift;
+            // A value of at most 57 bits always fits in the word.
+            if constexpr (BitWidth > 57) {
+                if (shift + BitWidth > 64) {
+                    value |= static_cast<uint64_t>(in[(bit_pos >> 3) + 8]) << (64 - shift);
+                }
+            }
+            out[i] = static_cast<UnsignedT>(value & mask);
+        }
+    }
+}
+
+template <typename T>
+inline void PForCoding<T>::encode_block(const T* values, size_t n, faststring* out) {
+    UnsignedT deltas[BLOCK_SIZE];
+    T min_value = values[0];
+    for (size_t i = 1; i < n; i++) {
+        min_value = std::min(min_value, values[i]);
+    }
+    // The number of the deltas of each bit width.
+    size_t width_counts[MAX_BIT_WIDTH + 1] = {0};
+    for (size_t i = 0; i < n; i++) {
+        deltas[i] = static_cast<UnsignedT>(values[i]) - static_cast<UnsignedT>(min_value);
+        const int width = deltas[i] == 0 ? 0 : 64 - __builtin_clzll(static_cast<uint64_t>(deltas[i]));
+        width_counts[width]++;
+    }
+
+    // Choose the bit width of the smallest block, from the widest to the narrowest.
+    int bit_width = MAX_BIT_WIDTH;
+    size_t num_exceptions = 0;
+    size_t best_size = packed_bytes(n, MAX_BIT_WIDTH);
+    size_t exceptions = 0;
+    for (int width = MAX_BIT_WIDTH - 1; width >= 0; width--) {
+        exceptions += width_counts[width + 1];
+        const size_t size = packed_bytes(n, width) + exceptions * (1 + sizeof(UnsignedT));
+        if (size < best_size) {
+            bit_width = width;
+            num_exceptions = exceptions;
+            best_size = size;
+        }
+    }
+
+    const size_t old_size = out->size();
+    out->resize(old_size + HEADER_SIZE + best_size + PADDING_SIZE);
+    uint8_t* dst = out->data() + old_size;
+    dst[0] = static_cast<uint8_t>(bit_width);
+    dst[1] = static_cast<uint8_t>(num_exceptions);
+    memcpy(dst + 2, &min_value, sizeof(T));
+
+    uint8_t* packed = dst + HEADER_SIZE;
+    const size_t num_packed_bytes = packed_bytes(n, bit_width);
+    memset(packed, 0, num_packed_bytes + PADDING_SIZE);
+    uint8_t* positions = packed + num_packed_bytes;
+    uint8_t* high_bits = positions + num_exceptions;
+    if (bit_width > 0) {
+        const uint64_t mask = bit_width == 64 ? ~0ULL : (1ULL << bit_width) - 1;
+        for (size_t i = 0; i < n; i++) {
+            const uint64_t value = static_cast<uint64_t>(deltas[i]) & mask;
+            const size_t bit_pos = i * bit_width;
+            const size_t shift = bit_pos & 7;
+            uint64_t word;
+            memcpy(&word, packed + (bit_pos >> 3), sizeof(word));
+            word |= value << shift;
+            memcpy(packed + (bit_pos >> 3), &word, sizeof(word));
+            if (shift + bit_width > 64) {
+                packed[(bit_pos >> 3) + 8] |= static_cast<uint8_t>(value >> (64 - shift));
+            }
+        }
+    }
+    if (num_exceptions > 0) {
+        size_t e = 0;
+        for (size_t i = 0; i < n; i++) {
+            const UnsignedT high = deltas[i] >> bit_width;
+            if (high != 0) {
+                positions[e] = static_cast<uint8_t>(i);
+                memcpy(high_bits + e * sizeof(UnsignedT), &high, sizeof(UnsignedT));
+                e++;
+            }
+        }
+    }
+    // Drop the padding, which is either used by the exceptions or appended by the caller.
+    out->resize(old_size + HEADER_SIZE + best_size);
+}
+
+template <typename T>
+inline size_t PForCoding<T>::decode_block(const uint8_t* data, size_t n, T* out) {
+    const int bit_width = data[0];
+    const size_t num_exceptions = data[1];
+    if (bit_width > MAX_BIT_WIDTH || num_exceptions > n || (num_exceptions > 0 && bit_width == MAX_BIT_WIDTH)) {
+        return 0;
+    }
+    UnsignedT min_value;
+    memcpy(&min_value, data + 2, sizeof(T));
+
+    auto* values = reinterpret_cast<UnsignedT*>(out);
+    const uint8_t* packed = data + HEADER_SIZE;
+    static constexpr auto unpack_funcs = make_unpack_funcs(std::make_index_sequence<MAX_BIT_WIDTH + 1>());
+    unpack_funcs[bit_width](packed, n, values);
+
+    const uint8_t* positions = packed + packed_bytes(n, bit_width);
+    const uint8_t* high_bits = positions + num_exceptions;
+    for (size_t e = 0; e < num_exceptions; e++) {
+        if (positions[e] >= n) {
+            return 0;
+        }
+        UnsignedT high;
+        memcpy(&high, high_bits + e * sizeof(UnsignedT), sizeof(UnsignedT));
+        values[positions[e]] |= high << bit_width;
+    }
+    for (size_t i = 0; i < n; i++) {
+        values[i] += min_value;
+    }
+    return HEADER_SIZE + packed_bytes(n, bit_width) + num_exceptions * (1 + sizeof(UnsignedT));
+}
+
+} // namespace starrocks
@@ -0,0 +1,83 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace starrocks {
+
+// SpaceSavingSketch finds the heavy hitters of a stream with the Space-Saving algorithm
+// (Metwally et al., Efficient Computation of Frequent and Top-k Elements in Data Streams).
+//
+// It keeps at most `capacity` counters. When a new key arrives and all the counters are used,
+// the counter with the minimum count is taken over by the new key, and the count of the new key
+// is overestimated by the count of the evicted key, which is recorded as the error.
+// Every key whose frequency is larger than `total / capacity` is guaranteed to be kept.
+//
+// The capacity is expected to be small, e.g. tens of keys, so the counters are kept in a vector.
+template <typename Key>
+class SpaceSavingSketch {
+public:
+    struct Counter {
+        Key key;
+        int64_t count;
+        // The upper bound of the overestimation of count.
+        int64_t error;
+    };
+
+    explicit SpaceSavingSketch(size_t capacity) : _capacity(std::max<size_t>(1, capacity)) {
+        _counters.reserve(_capacity);
+    }
+
+    void add(const Key& key, int64_t count = 1) {
+        _total += count;
+        for (auto& counter : _counters) {
+            if (counter.key == key) {
+                counter.count += count;
+                return;
+            }
+        }
+        if (_counters.size() < _capacity) {
+            _counters.push_back({key, count, 0});
+            return;
+        }
+        auto min_it = std::min_element(_counters.begin(), _counters.end(),
+                                       [](const Counter& lhs, const Counter& rhs) { return lhs.count < rhs.count; });
+        min_it->key = key;
+        min_it->error = min_it->count;
+        min_it->count += count;
+    }
+
+    // Return the counters whose count is at least `min_count`, in descending order of count.
+    std::vector<Counter> top(int64_t min_count = 0) const {
+        std::vector<Counter> result;
+        for (const auto& counter : _counters) {
+            if (counter.count >= min_count) {
+                result.push_back(counter);
+            }
+        }
+        std::sort(result.begin(), result.end(),
+                  [](const Counter& lhs, const Counter& rhs) { return lhs.count > rhs.count; });
+        return result;
+    }
+
+    void clear() {
+        _counters.clear();
+        _total = 0;
+    }
+
+    int64_t total() const { return _total; }
+    size_t size() const { return _counters.size(); }
+    size_t capacity() const { return _capacity; }
+
+private:
+    const size_t _capacity;
+    std::vector<Counter> _counters;
+    int64_t _total = 0;
+};
+
+} // namespace starrocks
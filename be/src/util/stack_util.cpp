@@ -17,6 +17,15 @@
 
 #include "util/stack_util.h"
 
+#include <algorithm>
+
+#include "gutil/strings/substitute.h"
+
+namespace google {
+// Declared in the internal header symbolize.h of glog, and the output is demangled.
+bool Symbolize(void* pc, char* out, int out_size);
+} // namespace google
+
 namespace google::glog_internal_namespace_ {
 void DumpStackTraceToString(std::string* stacktrace);
 } // namespace google::glog_internal_namespace_
@@ -29,4 +38,22 @@ std::string get_stack_trace() {
     return s;
 }
 
+const std::string& FrameSymbolizer::symbolize(void* pc, bool is_return_address) {
+    auto it = _symbols.find(pc);
+    if (it != _symbols.end()) {
+        return it->second;
+    }
+    char buf[1024];
+    void* lookup_pc = is_return_address ? reinterpret_cast<char*>(pc) - 1 : pc;
+    std::string symbol;
+    if (google::Symbolize(lookup_pc, buf, sizeof(buf))) {
+        symbol = buf;
+        // ';' separates the frames in the collapsed stacks.
+        std::replace(symbol.begin(), symbol.end(), ';', ':');
+    } else {
+        symbol = strings::Substitute("$0", pc);
+    }
+    return _symbols.emplace(pc, std::move(symbol)).first->second;
+}
+
 } // namespace starrocks
@@ -18,6 +18,7 @@
 #pragma once
 
 #include <string>
+#include <unordered_map>
 
 namespace starrocks {
 
@@ -26,4 +27,16 @@ namespace starrocks {
 // for recursive calls.
 std::string get_stack_trace();
 
+// Symbolizes the frames of the sampled stacks, and caches the symbols, so it should be used across the samples of
+// an aggregation.
+class FrameSymbolizer {
+public:
+    // The symbol is demangled, or the address if it can't be symbolized. A return address may be the first
+    // instruction of the next function, so it looks up the call instead if |is_return_address|.
+    const std::string& symbolize(void* pc, bool is_return_address);
+
+private:
+    std::unordered_map<void*, std::string> _symbols;
+};
+
 } // namespace starrocks
@@ -45,6 +45,22 @@ StarRocksMetrics::StarRocksMetrics() : _metrics(_s_registry_name) {
 
     REGISTER_STARROCKS_METRIC(memtable_flush_total);
     REGISTER_STARROCKS_METRIC(memtable_flush_duration_us);
+    REGISTER_STARROCKS_METRIC(load_memtable_flush_on_memory_limit_bytes);
+    REGISTER_STARROCKS_METRIC(load_memtable_early_flush_bytes);
+    REGISTER_STARROCKS_METRIC(load_memory_backpressure_duration_us);
+
+    REGISTER_STARROCKS_METRIC(exchange_transmit_rpc_latency_us);
+    REGISTER_STARROCKS_METRIC(scan_task_pending_time_us);
+    REGISTER_STARROCKS_METRIC(scan_task_running_time_us);
+    REGISTER_STARROCKS_METRIC(memtable_flush_latency_us);
+    REGISTER_STARROCKS_METRIC(update_rowset_commit_apply_latency_us);
+    _metrics.register_metric("compaction_task_latency_us", MetricLabels().add("type", "base"),
+                             &base_compaction_task_latency_us);
+    _metrics.register_metric("compaction_task_latency_us", MetricLabels().add("type", "cumulative"),
+                             &cumulative_compaction_task_latency_us);
+    _metrics.register_metric("compaction_task_latency_us", MetricLabels().add("type", "update"),
+                             &update_compaction_task_latency_us);
+    REGISTER_STARROCKS_METRIC(page_read_latency_us);
 
     REGISTER_STARROCKS_METRIC(update_rowset_commit_request_total);
     REGISTER_STARROCKS_METRIC(update_rowset_commit_request_failed);
@@ -121,6 +137,8 @@ StarRocksMetrics::StarRocksMetrics() : _metrics(_s_registry_name) {
                              &update_compaction_outputs_bytes_total);
     _metrics.register_metric("update_compaction_duration_us", MetricLabels().add("type", "update"),
                              &update_compaction_duration_us);
+    REGISTER_STARROCKS_METRIC(compaction_io_throttle_bytes);
+    REGISTER_STARROCKS_METRIC(compaction_io_throttle_duration_us);
 
     _metrics.register_metric("meta_request_total", MetricLabels().add("type", "write"), &meta_write_request_total);
     _metrics.register_metric("meta_request_total", MetricLabels().add("type", "read"), &meta_read_request_total);
@@ -149,6 +167,7 @@ StarRocksMetrics::StarRocksMetrics() : _metrics(_s_registry_name) {
 
     // Gauge
     REGISTER_STARROCKS_METRIC(memory_pool_bytes_total);
+    REGISTER_STARROCKS_METRIC(memory_huge_page_advised_bytes);
     REGISTER_STARROCKS_METRIC(process_thread_num);
     REGISTER_STARROCKS_METRIC(process_fd_num_used);
     REGISTER_STARROCKS_METRIC(process_fd_num_limit_soft);
@@ -179,6 +198,11 @@ StarRocksMetrics::StarRocksMetrics() : _metrics(_s_registry_name) {
     REGISTER_STARROCKS_METRIC(disk_sync_total);
     REGISTER_STARROCKS_METRIC(blocks_open_reading);
     REGISTER_STARROCKS_METRIC(blocks_open_writing);
+
+    REGISTER_STARROCKS_METRIC(block_cache_mem_hit_total);
+    REGISTER_STARROCKS_METRIC(block_cache_disk_hit_total);
+    REGISTER_STARROCKS_METRIC(block_cache_miss_total);
+    REGISTER_STARROCKS_METRIC(block_cache_disk_write_bytes);
 }
 
 void StarRocksMetrics::initialize(const std::vector<std::string>& paths, bool init_system_metrics,
@@ -194,6 +218,8 @@ void StarRocksMetrics::initialize(const std::vector<std::string>& paths, bool in
         _metrics.register_metric("disks_data_used_capacity", MetricLabels().add("path", path), gauge);
         gauge = disks_state.add_metric(path, MetricUnit::NOUNIT);
         _metrics.register_metric("disks_state", MetricLabels().add("path", path), gauge);
+        gauge = disks_compaction_io_rate.add_metric(path, MetricUnit::BYTES);
+        _metrics.register_metric("disks_compaction_io_rate", MetricLabels().add("path", path), gauge);
     }
 
     if (init_system_metrics) {
@@ -112,6 +112,8 @@ public:
     METRIC_DEFINE_INT_COUNTER(update_compaction_outputs_total, MetricUnit::ROWSETS);
     METRIC_DEFINE_INT_COUNTER(update_compaction_outputs_bytes_total, MetricUnit::BYTES);
     METRIC_DEFINE_INT_COUNTER(update_compaction_duration_us, MetricUnit::MICROSECONDS);
+    METRIC_DEFINE_INT_COUNTER(compaction_io_throttle_bytes, MetricUnit::BYTES);
+    METRIC_DEFINE_INT_COUNTER(compaction_io_throttle_duration_us, MetricUnit::MICROSECONDS);
 
     METRIC_DEFINE_INT_COUNTER(publish_task_request_total, MetricUnit::REQUESTS);
     METRIC_DEFINE_INT_COUNTER(publish_task_failed_total, MetricUnit::REQUESTS);
@@ -147,6 +149,20 @@ public:
 
     METRIC_DEFINE_INT_COUNTER(memtable_flush_total, MetricUnit::OPERATIONS);
     METRIC_DEFINE_INT_COUNTER(memtable_flush_duration_us, MetricUnit::MICROSECONDS);
+    METRIC_DEFINE_INT_COUNTER(load_memtable_flush_on_memory_limit_bytes, MetricUnit::BYTES);
+    METRIC_DEFINE_INT_COUNTER(load_memtable_early_flush_bytes, MetricUnit::BYTES);
+    METRIC_DEFINE_INT_COUNTER(load_memory_backpressure_duration_us, MetricUnit::MICROSECONDS);
+
+    // The latencies of the hot paths, the averages of which hide the tail latencies.
+    METRIC_DEFINE_HISTOGRAM(exchange_transmit_rpc_latency_us, MetricUnit::MICROSECONDS);
+    METRIC_DEFINE_HISTOGRAM(scan_task_pending_time_us, MetricUnit::MICROSECONDS);
+    METRIC_DEFINE_HISTOGRAM(scan_task_running_time_us, MetricUnit::MICROSECONDS);
+    METRIC_DEFINE_HISTOGRAM(memtable_flush_latency_us, MetricUnit::MICROSECONDS);
+    METRIC_DEFINE_HISTOGRAM(update_rowset_commit_apply_latency_us, MetricUnit::MICROSECONDS);
+    METRIC_DEFINE_HISTOGRAM(base_compaction_task_latency_us, MetricUnit::MICROSECONDS);
+    METRIC_DEFINE_HISTOGRAM(cumulative_compaction_task_latency_us, MetricUnit::MICROSECONDS);
+    METRIC_DEFINE_HISTOGRAM(update_compaction_task_latency_us, MetricUnit::MICROSECONDS);
+    METRIC_DEFINE_HISTOGRAM(page_read_latency_us, MetricUnit::MICROSECONDS);
 
     METRIC_DEFINE_INT_COUNTER(update_rowset_commit_request_total, MetricUnit::REQUESTS);
     METRIC_DEFINE_INT_COUNTER(update_rowset_commit_request_failed, MetricUnit::REQUESTS);
@@ -162,6 +178,8 @@ public:
 
     // Gauges
     METRIC_DEFINE_INT_GAUGE(memory_pool_bytes_total, MetricUnit::BYTES);
+    // the bytes advised to be backed by transparent huge pages, see `madvise_huge_pages`.
+    METRIC_DEFINE_INT_COUNTER(memory_huge_page_advised_bytes, MetricUnit::BYTES);
     METRIC_DEFINE_INT_GAUGE(process_thread_num, MetricUnit::NOUNIT);
     METRIC_DEFINE_INT_GAUGE(process_fd_num_used, MetricUnit::NOUNIT);
     METRIC_DEFINE_INT_GAUGE(process_fd_num_limit_soft, MetricUnit::NOUNIT);
@@ -170,6 +188,8 @@ public:
     IntGaugeMetricsMap disks_avail_capacity;
     IntGaugeMetricsMap disks_data_used_capacity;
     IntGaugeMetricsMap disks_state;
+    // the compaction read rate of each disk, in bytes per second.
+    IntGaugeMetricsMap disks_compaction_io_rate;
 
     // the max compaction score of all tablets.
     // Record base and cumulative scores separately, because
@@ -201,6 +221,12 @@ public:
     METRIC_DEFINE_INT_GAUGE(blocks_open_reading, MetricUnit::BLOCKS);
     METRIC_DEFINE_INT_GAUGE(blocks_open_writing, MetricUnit::BLOCKS);
 
+    // Metrics related with the BlockCache of the remote files
+    METRIC_DEFINE_INT_COUNTER(block_cache_mem_hit_total, MetricUnit::OPERATIONS);
+    METRIC_DEFINE_INT_COUNTER(block_cache_disk_hit_total, MetricUnit::OPERATIONS);
+    METRIC_DEFINE_INT_COUNTER(block_cache_miss_total, MetricUnit::OPERATIONS);
+    METRIC_DEFINE_INT_COUNTER(block_cache_disk_write_bytes, MetricUnit::BYTES);
+
     // Size of some global containers
     METRIC_DEFINE_UINT_GAUGE(rowset_count_generated_and_in_use, MetricUnit::ROWSETS);
     METRIC_DEFINE_UINT_GAUGE(unused_rowsets_count, MetricUnit::ROWSETS);
@@ -212,6 +212,23 @@ private:
         return true;
     }
 
+    // Returns true if the 8 bytes of the little-endian chunk are all ASCII digits.
+    static inline bool is_8_digits(uint64_t chunk) {
+        return ((chunk & 0xF0F0F0F0F0F0F0F0) | (((chunk + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0) >> 4)) ==
+               0x3333333333333333;
+    }
+
+    // Returns the value of the 8 ASCII digits of the little-endian chunk, the first digit is the lowest byte.
+    static inline uint32_t parse_8_digits(uint64_t chunk) {
+        chunk -= 0x3030303030303030;
+        // combine the pairs of digits, then the pairs of pairs and so on
+        chunk = (chunk * 10) + (chunk >> 8);
+        chunk = (((chunk & 0x000000FF000000FF) * (100 + (1000000ULL << 32))) +
+                 (((chunk >> 16) & 0x000000FF000000FF) * (1 + (10000ULL << 32)))) >>
+                32;
+        return static_cast<uint32_t>(chunk);
+    }
+
 public:
     // Returns the position of the first non-whitespace character in s.
     static inline int skip_leading_whitespace(const char* s, int len) {
@@ -399,14 +416,29 @@ inline T StringParser::string_to_int_no_overflow(const char* s, int len, ParseRe
         *result = PARSE_SUCCESS;
         return val;
     }
+    int i = 0;
+    // Parse 8 digits at a time, the types of less than 4 bytes have less digits.
+    if constexpr (sizeof(T) >= 4) {
+        for (; i + 8 <= len; i += 8) {
+            uint64_t chunk;
+            memcpy(&chunk, s + i, sizeof(chunk));
+            if (!is_8_digits(chunk)) {
+                break;
+            }
+            val = val * 100000000 + parse_8_digits(chunk);
+        }
+    }
     // Factor out the first char for error handling speeds up the loop.
-    if (LIKELY(s[0] >= '0' && s[0] <= '9')) {
-        val = s[0] - '0';
-    } else {
-        *result = PARSE_FAILURE;
-        return 0;
+    if (i == 0) {
+        if (LIKELY(s[0] >= '0' && s[0] <= '9')) {
+            val = s[0] - '0';
+        } else {
+            *result = PARSE_FAILURE;
+            return 0;
+        }
+        i = 1;
     }
-    for (int i = 1; i < len; ++i) {
+    for (; i < len; ++i) {
         if (LIKELY(s[i] >= '0' && s[i] <= '9')) {
             T digit = s[i] - '0';
             val = val * 10 + digit;
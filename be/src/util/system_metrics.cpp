@@ -104,6 +104,9 @@ public:
     METRIC_DEFINE_INT_GAUGE(column_pool_decimal_bytes, MetricUnit::BYTES);
     METRIC_DEFINE_INT_GAUGE(column_pool_date_bytes, MetricUnit::BYTES);
     METRIC_DEFINE_INT_GAUGE(column_pool_datetime_bytes, MetricUnit::BYTES);
+    // the gets of the columns served by the pools, and the ones allocating new columns.
+    METRIC_DEFINE_INT_GAUGE(column_pool_hit_total, MetricUnit::NOUNIT);
+    METRIC_DEFINE_INT_GAUGE(column_pool_miss_total, MetricUnit::NOUNIT);
 };
 
 class DiskMetrics {
@@ -277,6 +280,8 @@ void SystemMetrics::_install_memory_metrics(MetricRegistry* registry) {
     registry->register_metric("decimal_column_pool_bytes", &_memory_metrics->column_pool_decimal_bytes);
     registry->register_metric("date_column_pool_bytes", &_memory_metrics->column_pool_date_bytes);
     registry->register_metric("datetime_column_pool_bytes", &_memory_metrics->column_pool_datetime_bytes);
+    registry->register_metric("column_pool_hit_total", &_memory_metrics->column_pool_hit_total);
+    registry->register_metric("column_pool_miss_total", &_memory_metrics->column_pool_miss_total);
 }
 
 void SystemMetrics::_update_memory_metrics() {
@@ -368,6 +373,10 @@ void SystemMetrics::_update_memory_metrics() {
     UPDATE_COLUMN_POOL_METRIC(_memory_metrics->column_pool_datetime_bytes, TimestampColumn)
 
 #undef UPDATE_COLUMN_POOL_METRIC
+
+    auto [hit_cnt, miss_cnt] = vectorized::column_pool_reuse_counts();
+    _memory_metrics->column_pool_hit_total.set_value(hit_cnt);
+    _memory_metrics->column_pool_miss_total.set_value(miss_cnt);
 #endif
 }
 
@@ -49,6 +49,7 @@
 #include <algorithm>
 #include <cmath>
 #include <iostream>
+#include <iterator>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -354,6 +355,21 @@ void TDigest::add(Value x) {
     add(x, 1);
 }
 
+void TDigest::add(const Value* values, size_t n) {
+    _unprocessed.reserve(std::min<size_t>(_unprocessed.size() + n, _max_unprocessed + 1));
+    for (size_t i = 0; i < n; ++i) {
+        if (std::isnan(values[i])) {
+            continue;
+        }
+        _unprocessed.emplace_back(values[i], 1);
+        _unprocessed_weight += 1;
+        if (_unprocessed.size() > _max_unprocessed) {
+            process();
+        }
+    }
+    processIfNecessary();
+}
+
 void TDigest::compress() {
     process();
 }
@@ -495,6 +511,23 @@ void TDigest::mergeUnprocessed(const std::vector<const TDigest*>& tdigests) {
 void TDigest::mergeProcessed(const std::vector<const TDigest*>& tdigests) {
     if (tdigests.size() == 0) return;
 
+    // merging a single digest is the common case of the merge phase of aggregations,
+    // two sorted lists don't need a priority queue.
+    if (tdigests.size() == 1) {
+        const auto& other = tdigests[0]->_processed;
+        if (other.empty()) return;
+        _processed_weight += tdigests[0]->_processed_weight;
+
+        std::vector<Centroid> sorted;
+        sorted.reserve(_processed.size() + other.size());
+        std::merge(_processed.cbegin(), _processed.cend(), other.cbegin(), other.cend(), std::back_inserter(sorted),
+                   CentroidComparator());
+        _processed = std::move(sorted);
+        _min = std::min(_min, _processed[0].mean());
+        _max = std::max(_max, (_processed.cend() - 1)->mean());
+        return;
+    }
+
     size_t total = 0;
     CentroidListQueue pq(CentroidListComparator{});
     for (auto& td : tdigests) {
@@ -167,6 +167,8 @@ public:
     Value quantileProcessed(Value q) const;
     Value compression() const;
     void add(Value x);
+    // add n values with weight 1 at a time, the NaN values are ignored.
+    void add(const Value* values, size_t n);
     void compress();
     // add a single centroid to the unprocessed vector, processing previously unprocessed sorted if our limit has
     // been reached.
@@ -21,6 +21,8 @@
 
 #include "util/uid_util.h"
 
+#include <cctype>
+
 #include "gutil/endian.h"
 #include "util/uuid_generator.h"
 
@@ -49,6 +51,25 @@ std::string print_id(const PUniqueId& id) {
     return boost::uuids::to_string(uuid);
 }
 
+bool parse_id(const std::string& str, TUniqueId* id) {
+    std::string hex;
+    hex.reserve(32);
+    for (char c : str) {
+        if (c == '-') {
+            continue;
+        }
+        if (!std::isxdigit(static_cast<unsigned char>(c))) {
+            return false;
+        }
+        hex.push_back(static_cast<char>(std::tolower(static_cast<unsigned char>(c))));
+    }
+    if (hex.size() != 32) {
+        return false;
+    }
+    *id = UniqueId(std::string_view(hex).substr(0, 16), std::string_view(hex).substr(16)).to_thrift();
+    return true;
+}
+
 UniqueId UniqueId::gen_uid() {
     UniqueId uid(0, 0);
     auto uuid = ThreadLocalUUIDGenerator::next_uuid();
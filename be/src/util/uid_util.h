@@ -134,6 +134,9 @@ std::ostream& operator<<(std::ostream& os, const UniqueId& uid);
 std::string print_id(const TUniqueId& id);
 std::string print_id(const PUniqueId& id);
 
+// Parses the id printed by print_id(), e.g. 8c3fb5c2-4b3a-11ed-9c4e-00163e0e6c5a.
+bool parse_id(const std::string& str, TUniqueId* id);
+
 } // namespace starrocks
 
 namespace std {
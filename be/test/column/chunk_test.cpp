@@ -8,6 +8,7 @@
 #include "column/field.h"
 #include "column/fixed_length_column.h"
 #include "column/vectorized_fwd.h"
+#include "common/config.h"
 
 namespace starrocks::vectorized {
 
@@ -195,6 +196,21 @@ TEST_F(ChunkTest, test_copy_one_row) {
     }
 }
 
+// NOLINTNEXTLINE
+TEST_F(ChunkTest, test_clone_empty_pooled) {
+    auto chunk = std::make_unique<Chunk>(make_columns(2), make_schema(2));
+    config::enable_pooled_clone_empty = true;
+    std::unique_ptr<Chunk> new_chunk = chunk->clone_empty(chunk->num_rows());
+    config::enable_pooled_clone_empty = false;
+
+    ASSERT_EQ(0, new_chunk->num_rows());
+    ASSERT_EQ(chunk->num_columns(), new_chunk->num_columns());
+    new_chunk->append(*chunk);
+    for (size_t i = 0; i < chunk->num_columns(); ++i) {
+        check_column(down_cast<FixedLengthColumn<int32_t>*>(new_chunk->get_column_by_index(i).get()), i);
+    }
+}
+
 // NOLINTNEXTLINE
 TEST_F(ChunkTest, test_swap_chunk) {
     auto chk1 = std::make_unique<Chunk>(make_columns(2), make_schema(2));
@@ -2,6 +2,7 @@
 
 #include "column/column_pool.h"
 
+#include "column/array_column.h"
 #include "gtest/gtest.h"
 
 namespace starrocks::vectorized {
@@ -76,4 +77,64 @@ TEST_F(ColumnPoolTest, single_thread) {
     delete c4;
 }
 
+// NOLINTNEXTLINE
+TEST_F(ColumnPoolTest, reuse_counts) {
+    auto* pool = ColumnPool<Int64Column>::singleton();
+    int64_t hits = pool->hit_count();
+    int64_t misses = pool->miss_count();
+
+    auto c1 = get_column<Int64Column>();
+    auto c2 = get_column<Int64Column>();
+    return_column<Int64Column>(c1, config::vector_chunk_size);
+    auto c3 = get_column<Int64Column>();
+    ASSERT_EQ(c1, c3);
+    return_column<Int64Column>(c2, config::vector_chunk_size);
+    return_column<Int64Column>(c3, config::vector_chunk_size);
+    // the counts of the thread are flushed when its local pool is destroyed
+    clear_columns<Int64Column>();
+
+    ASSERT_EQ(hits + 1, pool->hit_count());
+    ASSERT_EQ(misses + 2, pool->miss_count());
+    ASSERT_EQ(hits + 1, pool->describe_column_pool().hit_cnt);
+    auto [total_hits, total_misses] = column_pool_reuse_counts();
+    ASSERT_GE(total_hits, hits + 1);
+    ASSERT_GE(total_misses, misses + 2);
+}
+
+// NOLINTNEXTLINE
+TEST_F(ColumnPoolTest, clone_empty_pooled) {
+    auto nullable = NullableColumn::create(Int32Column::create(), NullColumn::create());
+    nullable->append_datum(Datum((int32_t)1));
+    nullable->append_nulls(1);
+    Column* data = nullptr;
+    {
+        auto column = clone_empty_pooled(*nullable, config::vector_chunk_size);
+        ASSERT_TRUE(column->is_nullable());
+        ASSERT_EQ(0, column->size());
+        auto* cloned = down_cast<NullableColumn*>(column.get());
+        ASSERT_FALSE(cloned->has_null());
+        ASSERT_EQ(typeid(Int32Column), typeid(*cloned->data_column()));
+        cloned->data_column()->reserve(config::vector_chunk_size);
+        data = cloned->data_column().get();
+    }
+    // The data column returned to the pool is taken again, with its reserved buffer.
+    auto column = clone_empty_pooled(*nullable, config::vector_chunk_size);
+    auto* cloned = down_cast<NullableColumn*>(column.get());
+    ASSERT_EQ(data, cloned->data_column().get());
+    ASSERT_EQ(0, cloned->data_column()->size());
+    ASSERT_GE(down_cast<Int32Column*>(data)->get_data().capacity(), config::vector_chunk_size);
+
+    auto decimal = Decimal64Column::create(18, 4);
+    auto cloned_decimal = clone_empty_pooled(*decimal, config::vector_chunk_size);
+    ASSERT_EQ(typeid(Decimal64Column), typeid(*cloned_decimal));
+    ASSERT_EQ(18, down_cast<Decimal64Column*>(cloned_decimal.get())->precision());
+    ASSERT_EQ(4, down_cast<Decimal64Column*>(cloned_decimal.get())->scale());
+
+    // No pool of the array columns, but the offsets and the elements are pooled.
+    auto array = ArrayColumn::create(Int32Column::create(), UInt32Column::create());
+    auto cloned_array = clone_empty_pooled(*array, config::vector_chunk_size);
+    ASSERT_EQ(typeid(ArrayColumn), typeid(*cloned_array));
+    ASSERT_EQ(0, cloned_array->size());
+}
+
 } // namespace starrocks::vectorized
@@ -0,0 +1,54 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "exec/pipeline/exchange/adaptive_compression.h"
+
+#include <gtest/gtest.h>
+
+namespace starrocks::pipeline {
+
+TEST(AdaptiveCompressionTest, test_unknown_throughput) {
+    AdaptiveCompression compression;
+    // Compress until both the compression and the network throughput are known.
+    ASSERT_TRUE(compression.should_compress(0));
+    ASSERT_TRUE(compression.should_compress(1.0));
+
+    compression.update(1000, 250, 1000);
+    ASSERT_DOUBLE_EQ(4, compression.compress_ratio());
+    ASSERT_DOUBLE_EQ(1, compression.compress_bytes_per_ns());
+    ASSERT_TRUE(compression.should_compress(0));
+}
+
+TEST(AdaptiveCompressionTest, test_slow_network) {
+    AdaptiveCompression compression;
+    // 1 byte/ns with 4x ratio saves 0.75 byte/ns of network, which is faster than a 0.1 byte/ns network.
+    compression.update(1000, 250, 1000);
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_TRUE(compression.should_compress(0.1));
+    }
+}
+
+TEST(AdaptiveCompressionTest, test_fast_network) {
+    AdaptiveCompression compression;
+    compression.update(1000, 250, 1000);
+    // The chunk is compressed every PROBE_INTERVAL chunks to refresh the estimation.
+    for (int round = 0; round < 3; ++round) {
+        for (int i = 0; i < AdaptiveCompression::PROBE_INTERVAL - 1; ++i) {
+            ASSERT_FALSE(compression.should_compress(10.0));
+        }
+        ASSERT_TRUE(compression.should_compress(10.0));
+    }
+
+    // The data which cannot be compressed is never worth compressing, except probing.
+    AdaptiveCompression incompressible;
+    incompressible.update(1000, 1000, 1);
+    ASSERT_FALSE(incompressible.should_compress(0.001));
+}
+
+TEST(AdaptiveCompressionTest, test_ewma) {
+    AdaptiveCompression compression;
+    compression.update(1000, 500, 1000);
+    compression.update(1000, 100, 1000);
+    ASSERT_DOUBLE_EQ(0.2 * 10 + 0.8 * 2, compression.compress_ratio());
+}
+
+} // namespace starrocks::pipeline
@@ -0,0 +1,75 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "exec/pipeline/aggregate/adaptive_preaggregation.h"
+
+#include <gtest/gtest.h>
+
+namespace starrocks::pipeline {
+
+using Mode = AdaptivePreaggregation::Mode;
+
+TEST(AdaptivePreaggregationTest, test_high_reduction) {
+    AdaptivePreaggregation preagg(4, 2);
+    // Each chunk of 4096 rows inserts only 16 new groups.
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_FALSE(preagg.update(4096, 4096, 16, 2.0, false));
+        ASSERT_EQ(Mode::AGGREGATE, preagg.mode());
+    }
+    ASSERT_EQ(0, preagg.num_switches());
+}
+
+TEST(AdaptivePreaggregationTest, test_poor_reduction) {
+    AdaptivePreaggregation preagg(4, 2);
+    // Almost every row is a new group, so stop growing the hash table at the end of the window.
+    for (int i = 0; i < 3; ++i) {
+        ASSERT_FALSE(preagg.update(4096, 4096, 4000, 2.0, false));
+    }
+    ASSERT_TRUE(preagg.update(4096, 4096, 4000, 2.0, false));
+    ASSERT_EQ(Mode::LIMITED, preagg.mode());
+
+    // Few rows hit the hash table, so pass all the rows through.
+    for (int i = 0; i < 3; ++i) {
+        ASSERT_FALSE(preagg.update(4096, 100, 0, 2.0, false));
+    }
+    ASSERT_TRUE(preagg.update(4096, 100, 0, 2.0, false));
+    ASSERT_EQ(Mode::STREAMING, preagg.mode());
+
+    // Probe the hash table again after 2 windows.
+    for (int i = 0; i < 7; ++i) {
+        ASSERT_FALSE(preagg.update(4096, 0, 0, 2.0, false));
+    }
+    ASSERT_TRUE(preagg.update(4096, 0, 0, 2.0, false));
+    ASSERT_EQ(Mode::LIMITED, preagg.mode());
+    ASSERT_EQ(3, preagg.num_switches());
+}
+
+TEST(AdaptivePreaggregationTest, test_limited) {
+    AdaptivePreaggregation preagg(2, 2);
+    ASSERT_FALSE(preagg.update(4096, 4096, 4096, 2.0, false));
+    ASSERT_TRUE(preagg.update(4096, 4096, 4096, 2.0, false));
+    ASSERT_EQ(Mode::LIMITED, preagg.mode());
+
+    // A third of the rows hit the hash table, which is useful but not enough to grow the hash table.
+    for (int i = 0; i < 10; ++i) {
+        ASSERT_FALSE(preagg.update(3000, 1000, 0, 2.0, false));
+        ASSERT_EQ(Mode::LIMITED, preagg.mode());
+    }
+
+    // Most of the rows hit the hash table, so grow it again.
+    ASSERT_FALSE(preagg.update(3000, 2900, 0, 2.0, false));
+    ASSERT_TRUE(preagg.update(3000, 2900, 0, 2.0, false));
+    ASSERT_EQ(Mode::AGGREGATE, preagg.mode());
+}
+
+TEST(AdaptivePreaggregationTest, test_full_hash_table) {
+    AdaptivePreaggregation preagg(8, 2);
+    // A full hash table switches to LIMITED immediately, and never switches back to AGGREGATE.
+    ASSERT_TRUE(preagg.update(4096, 4096, 16, 2.0, true));
+    ASSERT_EQ(Mode::LIMITED, preagg.mode());
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_FALSE(preagg.update(4096, 4096, 0, 2.0, true));
+        ASSERT_EQ(Mode::LIMITED, preagg.mode());
+    }
+}
+
+} // namespace starrocks::pipeline
@@ -0,0 +1,35 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "exec/pipeline/driver_time_budget.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+namespace starrocks::pipeline {
+
+TEST(DriverTimeBudgetTest, test_not_started) {
+    ASSERT_FALSE(DriverTimeBudget::exhausted());
+}
+
+TEST(DriverTimeBudgetTest, test_exhausted) {
+    DriverTimeBudget::start(1'000'000'000L);
+    ASSERT_FALSE(DriverTimeBudget::exhausted());
+
+    DriverTimeBudget::start(1'000'000L);
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    ASSERT_TRUE(DriverTimeBudget::exhausted());
+
+    DriverTimeBudget::stop();
+    ASSERT_FALSE(DriverTimeBudget::exhausted());
+}
+
+TEST(DriverTimeBudgetTest, test_thread_local) {
+    DriverTimeBudget::start(0);
+    std::thread thread([] { ASSERT_FALSE(DriverTimeBudget::exhausted()); });
+    thread.join();
+    ASSERT_TRUE(DriverTimeBudget::exhausted());
+    DriverTimeBudget::stop();
+}
+
+} // namespace starrocks::pipeline
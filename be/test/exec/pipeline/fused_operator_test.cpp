@@ -0,0 +1,136 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "exec/pipeline/fused_operator.h"
+
+#include "column/chunk.h"
+#include "column/fixed_length_column.h"
+#include "exec/pipeline/limit_operator.h"
+#include "exec/pipeline/noop_sink_operator.h"
+#include "exec/pipeline/project_operator.h"
+#include "exec/pipeline/select_operator.h"
+#include "gtest/gtest.h"
+#include "runtime/runtime_state.h"
+
+namespace starrocks::pipeline {
+
+class FusedOperatorTest : public testing::Test {
+public:
+    FusedOperatorTest() : _runtime_state(TUniqueId(), TQueryOptions(), TQueryGlobals(), nullptr) {}
+
+protected:
+    static OpFactoryPtr _create_project_factory(int32_t id) {
+        return std::make_shared<ProjectOperatorFactory>(id, 0, std::vector<int32_t>{}, std::vector<ExprContext*>{},
+                                                        std::vector<bool>{}, std::vector<int32_t>{},
+                                                        std::vector<ExprContext*>{});
+    }
+
+    static vectorized::ChunkPtr _create_chunk(size_t num_rows) {
+        auto column = vectorized::Int32Column::create();
+        column->append_default(num_rows);
+        auto chunk = std::make_shared<vectorized::Chunk>();
+        chunk->append_column(std::move(column), 0);
+        return chunk;
+    }
+
+    RuntimeState _runtime_state;
+};
+
+TEST_F(FusedOperatorTest, test_fuse_operators) {
+    int32_t next_id = 100;
+    OpFactories factories;
+    factories.emplace_back(std::make_shared<NoopSinkOperatorFactory>(0, 0));
+    factories.emplace_back(_create_project_factory(1));
+    factories.emplace_back(std::make_shared<SelectOperatorFactory>(2, 0, std::vector<ExprContext*>{}));
+    factories.emplace_back(std::make_shared<LimitOperatorFactory>(3, 0, 10));
+    factories.emplace_back(std::make_shared<NoopSinkOperatorFactory>(4, 0));
+    factories.emplace_back(_create_project_factory(5));
+    factories.emplace_back(_create_project_factory(6));
+
+    auto origin_factories = factories;
+    FusedOperatorFactory::fuse_operators(&factories, [&next_id]() { return next_id++; });
+
+    ASSERT_EQ(5, factories.size());
+    ASSERT_EQ(origin_factories[0], factories[0]);
+    ASSERT_NE(nullptr, dynamic_cast<FusedOperatorFactory*>(factories[1].get()));
+    ASSERT_EQ(100, factories[1]->id());
+    // A single fusible operator isn't fused, and the sink operator is never fused.
+    ASSERT_EQ(origin_factories[4], factories[2]);
+    ASSERT_EQ(origin_factories[5], factories[3]);
+    ASSERT_EQ(origin_factories[6], factories[4]);
+    ASSERT_EQ(101, next_id);
+}
+
+TEST_F(FusedOperatorTest, test_fuse_too_short_pipeline) {
+    OpFactories factories;
+    factories.emplace_back(std::make_shared<NoopSinkOperatorFactory>(0, 0));
+    factories.emplace_back(_create_project_factory(1));
+    factories.emplace_back(_create_project_factory(2));
+
+    auto origin_factories = factories;
+    FusedOperatorFactory::fuse_operators(&factories, []() { return 100; });
+    ASSERT_EQ(origin_factories, factories);
+}
+
+TEST_F(FusedOperatorTest, test_select_and_limit) {
+    OpFactories sub_factories;
+    sub_factories.emplace_back(std::make_shared<SelectOperatorFactory>(1, 0, std::vector<ExprContext*>{}));
+    sub_factories.emplace_back(std::make_shared<LimitOperatorFactory>(2, 0, 10));
+    auto factory = std::make_shared<FusedOperatorFactory>(3, std::move(sub_factories));
+    ASSERT_TRUE(factory->prepare(&_runtime_state).ok());
+
+    auto op = factory->create(1, 0);
+    ASSERT_TRUE(op->prepare(&_runtime_state).ok());
+
+    // The small chunks are merged by SelectOperator.
+    ASSERT_TRUE(op->need_input());
+    ASSERT_TRUE(op->push_chunk(&_runtime_state, _create_chunk(3)).ok());
+    ASSERT_FALSE(op->has_output());
+    ASSERT_TRUE(op->push_chunk(&_runtime_state, _create_chunk(4)).ok());
+    ASSERT_FALSE(op->has_output());
+
+    ASSERT_TRUE(op->push_chunk(&_runtime_state, _create_chunk(_runtime_state.chunk_size())).ok());
+    ASSERT_TRUE(op->has_output());
+    ASSERT_FALSE(op->need_input());
+    auto chunk = op->pull_chunk(&_runtime_state);
+    ASSERT_TRUE(chunk.ok());
+    ASSERT_EQ(7, chunk.value()->num_rows());
+    ASSERT_FALSE(op->has_output());
+    ASSERT_TRUE(op->need_input());
+
+    // The chunk buffered by SelectOperator is flushed through LimitOperator when finishing.
+    ASSERT_TRUE(op->set_finishing(&_runtime_state).ok());
+    ASSERT_TRUE(op->has_output());
+    chunk = op->pull_chunk(&_runtime_state);
+    ASSERT_TRUE(chunk.ok());
+    ASSERT_EQ(3, chunk.value()->num_rows());
+    ASSERT_FALSE(op->has_output());
+    ASSERT_TRUE(op->is_finished());
+
+    op->close(&_runtime_state);
+    factory->close(&_runtime_state);
+}
+
+TEST_F(FusedOperatorTest, test_limit_reached) {
+    OpFactories sub_factories;
+    sub_factories.emplace_back(std::make_shared<LimitOperatorFactory>(1, 0, 5));
+    sub_factories.emplace_back(std::make_shared<SelectOperatorFactory>(2, 0, std::vector<ExprContext*>{}));
+    auto factory = std::make_shared<FusedOperatorFactory>(3, std::move(sub_factories));
+    ASSERT_TRUE(factory->prepare(&_runtime_state).ok());
+
+    auto op = factory->create(1, 0);
+    ASSERT_TRUE(op->prepare(&_runtime_state).ok());
+
+    // The 5 rows are buffered by SelectOperator after LimitOperator, and flushed once the limit is reached.
+    ASSERT_TRUE(op->push_chunk(&_runtime_state, _create_chunk(100)).ok());
+    ASSERT_FALSE(op->need_input());
+    ASSERT_TRUE(op->has_output());
+    auto chunk = op->pull_chunk(&_runtime_state);
+    ASSERT_TRUE(chunk.ok());
+    ASSERT_EQ(5, chunk.value()->num_rows());
+    ASSERT_TRUE(op->is_finished());
+
+    op->close(&_runtime_state);
+    factory->close(&_runtime_state);
+}
+
+} // namespace starrocks::pipeline
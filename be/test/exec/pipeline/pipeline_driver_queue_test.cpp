@@ -151,6 +151,141 @@ PARALLEL_TEST(QuerySharedDriverQueueTest, test_take_close) {
     consumer_thread->join();
 }
 
+PARALLEL_TEST(WorkStealingDriverQueueTest, test_basic) {
+    // With only one local queue, it behaves the same as QuerySharedDriverQueue.
+    WorkStealingDriverQueue queue(1);
+
+    // Prepare drivers.
+    QueryContext query_context;
+    auto driver71 = std::make_shared<PipelineDriver>(_gen_operators(), &query_context, nullptr, -1);
+    _set_driver_level(driver71.get(), 7);
+    driver71->driver_acct().update_last_time_spent(5'000'000L * 1);
+
+    auto driver61 = std::make_shared<PipelineDriver>(_gen_operators(), &query_context, nullptr, -1);
+    _set_driver_level(driver61.get(), 6);
+    driver61->driver_acct().update_last_time_spent(30'000'000L * QuerySharedDriverQueue::RATIO_OF_ADJACENT_QUEUE);
+
+    auto driver51 = std::make_shared<PipelineDriver>(_gen_operators(), &query_context, nullptr, -1);
+    _set_driver_level(driver51.get(), 5);
+    driver51->driver_acct().update_last_time_spent(20'000'000L * QuerySharedDriverQueue::RATIO_OF_ADJACENT_QUEUE *
+                                                   QuerySharedDriverQueue::RATIO_OF_ADJACENT_QUEUE);
+
+    std::vector<DriverRawPtr> in_drivers = {driver71.get(), driver61.get(), driver51.get()};
+    std::vector<DriverRawPtr> out_drivers = {driver71.get(), driver51.get(), driver61.get()};
+
+    for (auto* in_driver : in_drivers) {
+        queue.update_statistics(in_driver);
+        queue.put_back(in_driver);
+    }
+    ASSERT_EQ(3, queue.size());
+
+    for (auto* out_driver : out_drivers) {
+        auto maybe_driver = queue.take(0);
+        ASSERT_TRUE(maybe_driver.ok());
+        ASSERT_EQ(out_driver, maybe_driver.value());
+    }
+    ASSERT_EQ(0, queue.size());
+}
+
+PARALLEL_TEST(WorkStealingDriverQueueTest, test_steal) {
+    WorkStealingDriverQueue queue(4);
+    ASSERT_EQ(4, queue.num_local_queues());
+
+    std::vector<DriverPtr> drivers;
+    std::unordered_set<DriverRawPtr> in_drivers;
+    for (int i = 0; i < 8; ++i) {
+        drivers.emplace_back(std::make_shared<PipelineDriver>(_gen_operators(), nullptr, nullptr, -1));
+        in_drivers.emplace(drivers.back().get());
+        // The drivers are dispatched to all the local queues in round-robin.
+        queue.put_back(drivers.back().get());
+    }
+
+    // The worker 0 takes the drivers from its own local queue and steals the others.
+    std::unordered_set<DriverRawPtr> out_drivers;
+    for (int i = 0; i < 8; ++i) {
+        auto maybe_driver = queue.take(0);
+        ASSERT_TRUE(maybe_driver.ok());
+        ASSERT_FALSE(maybe_driver.value()->is_in_ready_queue());
+        out_drivers.emplace(maybe_driver.value());
+    }
+    ASSERT_EQ(in_drivers, out_drivers);
+    ASSERT_EQ(0, queue.size());
+}
+
+PARALLEL_TEST(WorkStealingDriverQueueTest, test_steal_numa) {
+    // The number of local queues is rounded up to a multiple of the number of NUMA nodes.
+    WorkStealingDriverQueue queue(3, 2);
+    ASSERT_EQ(4, queue.num_local_queues());
+    ASSERT_EQ(2, queue.num_numa_nodes());
+
+    std::vector<DriverPtr> drivers;
+    for (int i = 0; i < 4; ++i) {
+        drivers.emplace_back(std::make_shared<PipelineDriver>(_gen_operators(), nullptr, nullptr, -1));
+        queue.put_back(drivers.back().get());
+    }
+
+    // The local queue 0 and 2 are on the NUMA node 0, and the local queue 1 and 3 are on the NUMA node 1.
+    // The worker 0 steals from the same NUMA node first.
+    std::vector<DriverRawPtr> out_drivers = {drivers[0].get(), drivers[2].get(), drivers[1].get(), drivers[3].get()};
+    for (auto* out_driver : out_drivers) {
+        auto maybe_driver = queue.take(0);
+        ASSERT_TRUE(maybe_driver.ok());
+        ASSERT_EQ(out_driver, maybe_driver.value());
+        ASSERT_EQ(0, maybe_driver.value()->get_local_driver_queue_idx());
+    }
+}
+
+PARALLEL_TEST(WorkStealingDriverQueueTest, test_cancel) {
+    WorkStealingDriverQueue queue(2);
+
+    std::vector<DriverPtr> drivers;
+    for (int i = 0; i < 4; ++i) {
+        drivers.emplace_back(std::make_shared<PipelineDriver>(_gen_operators(), nullptr, nullptr, -1));
+        _set_driver_level(drivers.back().get(), 1);
+        queue.put_back(drivers.back().get());
+    }
+    // drivers[0] and drivers[2] are in the local queue 0, drivers[1] and drivers[3] are in the local queue 1.
+    queue.cancel(drivers[2].get());
+    queue.cancel(drivers[3].get());
+
+    std::vector<DriverRawPtr> out_drivers = {drivers[2].get(), drivers[0].get(), drivers[3].get(), drivers[1].get()};
+    for (auto* out_driver : out_drivers) {
+        auto maybe_driver = queue.take(0);
+        ASSERT_TRUE(maybe_driver.ok());
+        ASSERT_EQ(out_driver, maybe_driver.value());
+    }
+}
+
+PARALLEL_TEST(WorkStealingDriverQueueTest, test_take_block) {
+    WorkStealingDriverQueue queue(4);
+
+    auto driver1 = std::make_shared<PipelineDriver>(_gen_operators(), nullptr, nullptr, -1);
+    auto consumer_thread = std::make_shared<std::thread>([&queue, &driver1] {
+        auto maybe_driver = queue.take(3);
+        ASSERT_TRUE(maybe_driver.ok());
+        ASSERT_EQ(driver1.get(), maybe_driver.value());
+    });
+
+    sleep(1);
+    queue.put_back(driver1.get());
+
+    consumer_thread->join();
+}
+
+PARALLEL_TEST(WorkStealingDriverQueueTest, test_take_close) {
+    WorkStealingDriverQueue queue(4);
+
+    auto consumer_thread = std::make_shared<std::thread>([&queue] {
+        auto maybe_driver = queue.take(0);
+        ASSERT_TRUE(maybe_driver.status().is_cancelled());
+    });
+
+    sleep(1);
+    queue.close();
+
+    consumer_thread->join();
+}
+
 class DriverQueueWithWorkGroupTest : public ::testing::Test {
 public:
     void SetUp() override {
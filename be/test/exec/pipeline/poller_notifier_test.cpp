@@ -0,0 +1,47 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "exec/pipeline/poller_notifier.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include "util/stopwatch.hpp"
+
+namespace starrocks::pipeline {
+
+TEST(PollerNotifierTest, test_wait_timeout) {
+    auto* notifier = PollerNotifier::instance();
+    uint64_t epoch = notifier->epoch();
+
+    MonotonicStopWatch watch;
+    watch.start();
+    notifier->wait_for(epoch, 10'000);
+    // Other tests may notify concurrently, so only check it doesn't wait longer than the timeout too much.
+    ASSERT_LT(watch.elapsed_time(), 5'000'000'000UL);
+}
+
+TEST(PollerNotifierTest, test_wait_notified) {
+    auto* notifier = PollerNotifier::instance();
+    uint64_t epoch = notifier->epoch();
+
+    // The event happened before waiting is not missed.
+    notifier->notify();
+    MonotonicStopWatch watch;
+    watch.start();
+    notifier->wait_for(epoch, 60'000'000);
+    ASSERT_LT(watch.elapsed_time(), 30'000'000'000UL);
+
+    epoch = notifier->epoch();
+    std::thread notify_thread([notifier] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        notifier->notify();
+    });
+    watch.reset();
+    notifier->wait_for(epoch, 60'000'000);
+    ASSERT_LT(watch.elapsed_time(), 30'000'000'000UL);
+    ASSERT_NE(epoch, notifier->epoch());
+    notify_thread.join();
+}
+
+} // namespace starrocks::pipeline
@@ -0,0 +1,94 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "exec/pipeline/project_operator.h"
+
+#include "column/chunk.h"
+#include "column/fixed_length_column.h"
+#include "common/object_pool.h"
+#include "exprs/expr.h"
+#include "exprs/expr_context.h"
+#include "gtest/gtest.h"
+#include "runtime/runtime_state.h"
+
+namespace starrocks::pipeline {
+
+// Returns the values of the first column plus an offset, and counts its evaluations.
+class CountingExpr final : public Expr {
+public:
+    explicit CountingExpr(int32_t offset) : Expr(TypeDescriptor(TYPE_INT), false), _offset(offset) {}
+
+    Expr* clone(ObjectPool* pool) const override { return pool->add(new CountingExpr(*this)); }
+
+    ColumnPtr evaluate(ExprContext* context, vectorized::Chunk* ptr) override {
+        ++num_evaluations;
+        const auto& input = down_cast<vectorized::Int32Column*>(ptr->get_column_by_index(0).get())->get_data();
+        auto column = vectorized::Int32Column::create();
+        for (auto v : input) {
+            column->append(v + _offset);
+        }
+        return column;
+    }
+
+    int num_evaluations = 0;
+
+private:
+    int32_t _offset;
+};
+
+class ProjectOperatorTest : public testing::Test {
+public:
+    ProjectOperatorTest() : _runtime_state(TUniqueId(), TQueryOptions(), TQueryGlobals(), nullptr) {}
+
+protected:
+    static vectorized::ChunkPtr _create_chunk(size_t num_rows) {
+        auto column = vectorized::Int32Column::create();
+        for (size_t i = 0; i < num_rows; ++i) {
+            column->append(static_cast<int32_t>(i));
+        }
+        auto chunk = std::make_shared<vectorized::Chunk>();
+        chunk->append_column(std::move(column), 0);
+        return chunk;
+    }
+
+    RuntimeState _runtime_state;
+    ObjectPool _pool;
+};
+
+TEST_F(ProjectOperatorTest, test_same_exprs) {
+    auto* expr0 = _pool.add(new CountingExpr(10));
+    auto* expr1 = _pool.add(new CountingExpr(10));
+    auto* expr2 = _pool.add(new CountingExpr(20));
+    std::vector<ExprContext*> expr_ctxs{_pool.add(new ExprContext(expr0)), _pool.add(new ExprContext(expr1)),
+                                        _pool.add(new ExprContext(expr2))};
+
+    // the output 2 has the same expression as the output 1
+    auto factory = std::make_shared<ProjectOperatorFactory>(
+            1, 0, std::vector<int32_t>{1, 2, 3}, std::move(expr_ctxs), std::vector<bool>{false, false, false},
+            std::vector<int32_t>{}, std::vector<ExprContext*>{}, std::vector<int32_t>{-1, 0, -1});
+    ASSERT_TRUE(factory->prepare(&_runtime_state).ok());
+    auto op = factory->create(1, 0);
+    ASSERT_TRUE(op->prepare(&_runtime_state).ok());
+
+    ASSERT_TRUE(op->push_chunk(&_runtime_state, _create_chunk(5)).ok());
+    auto chunk = op->pull_chunk(&_runtime_state);
+    ASSERT_TRUE(chunk.ok());
+    ASSERT_EQ(1, expr0->num_evaluations);
+    ASSERT_EQ(0, expr1->num_evaluations);
+    ASSERT_EQ(1, expr2->num_evaluations);
+
+    const auto& column1 = chunk.value()->get_column_by_slot_id(1);
+    const auto& column2 = chunk.value()->get_column_by_slot_id(2);
+    const auto& column3 = chunk.value()->get_column_by_slot_id(3);
+    // the outputs don't share the column, so filtering the chunk filters each of them once
+    ASSERT_NE(column1.get(), column2.get());
+    for (int i = 0; i < 5; ++i) {
+        ASSERT_EQ(i + 10, column1->get(i).get_int32());
+        ASSERT_EQ(i + 10, column2->get(i).get_int32());
+        ASSERT_EQ(i + 20, column3->get(i).get_int32());
+    }
+
+    op->close(&_runtime_state);
+    factory->close(&_runtime_state);
+}
+
+} // namespace starrocks::pipeline
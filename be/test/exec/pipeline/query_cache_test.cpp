@@ -0,0 +1,51 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "exec/pipeline/query_cache.h"
+
+#include <gtest/gtest.h>
+
+#include "column/chunk.h"
+#include "column/fixed_length_column.h"
+
+namespace starrocks::pipeline {
+
+static vectorized::ChunkPtr create_chunk(int32_t value) {
+    auto column = vectorized::Int32Column::create();
+    column->append(value);
+    auto chunk = std::make_shared<vectorized::Chunk>();
+    chunk->append_column(std::move(column), 0);
+    return chunk;
+}
+
+TEST(QueryCacheTest, LookupAndInsert) {
+    QueryCache cache(nullptr, 1024 * 1024);
+    ASSERT_EQ(nullptr, cache.lookup("digest", 10001, 5));
+
+    cache.insert("digest", 10001, 5, {create_chunk(1)});
+    auto entry = cache.lookup("digest", 10001, 5);
+    ASSERT_NE(nullptr, entry);
+    ASSERT_EQ(5, entry->version);
+    ASSERT_EQ(1, entry->chunks.size());
+    ASSERT_EQ(1, entry->chunks[0]->get_column_by_slot_id(0)->get(0).get_int32());
+
+    // the versions after 5 are computed by the caller and merged with the cached result
+    entry = cache.lookup("digest", 10001, 7);
+    ASSERT_NE(nullptr, entry);
+    ASSERT_EQ(5, entry->version);
+
+    // the tablet is read at an older version, another tablet, or by another fragment
+    ASSERT_EQ(nullptr, cache.lookup("digest", 10001, 4));
+    ASSERT_EQ(nullptr, cache.lookup("digest", 10002, 5));
+    ASSERT_EQ(nullptr, cache.lookup("digest2", 10001, 5));
+
+    // the result of an older version doesn't replace the newer one
+    cache.insert("digest", 10001, 7, {create_chunk(3)});
+    cache.insert("digest", 10001, 6, {create_chunk(2)});
+    entry = cache.lookup("digest", 10001, 7);
+    ASSERT_NE(nullptr, entry);
+    ASSERT_EQ(7, entry->version);
+    ASSERT_EQ(3, entry->chunks[0]->get_column_by_slot_id(0)->get(0).get_int32());
+    ASSERT_EQ(nullptr, cache.lookup("digest", 10001, 6));
+}
+
+} // namespace starrocks::pipeline
@@ -0,0 +1,99 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "exec/pipeline/query_trace.h"
+
+#include <gtest/gtest.h>
+#include <rapidjson/document.h>
+
+#include <string>
+
+#include "common/config.h"
+#include "util/time.h"
+
+namespace starrocks::pipeline {
+
+static TUniqueId make_id(int64_t hi, int64_t lo) {
+    TUniqueId id;
+    id.__set_hi(hi);
+    id.__set_lo(lo);
+    return id;
+}
+
+TEST(QueryTraceTest, test_to_json) {
+    QueryTrace trace(make_id(1, 2), 100);
+    int64_t pid = trace.process_id(make_id(1, 3));
+    ASSERT_EQ(pid, trace.process_id(make_id(1, 3)));
+    ASSERT_NE(pid, trace.process_id(make_id(1, 4)));
+    trace.set_thread_name(pid, 0, "PipelineDriver (id=0)");
+
+    int64_t now = MonotonicNanos();
+    trace.add_span("RUNNING", "driver", pid, 0, now, now + 2000);
+    trace.add_async_span("TransmitChunk", "exchange", pid, 7, now + 1000, now + 5000);
+    ASSERT_EQ(2, trace.num_events());
+
+    rapidjson::Document doc;
+    doc.Parse(trace.to_json().c_str());
+    ASSERT_FALSE(doc.HasParseError());
+    const auto& events = doc["traceEvents"];
+    ASSERT_TRUE(events.IsArray());
+    // 2 process names, 1 thread name, 1 complete event, and the begin and end of 1 async event
+    ASSERT_EQ(6, events.Size());
+
+    int num_complete_events = 0;
+    int num_async_events = 0;
+    for (const auto& event : events.GetArray()) {
+        std::string phase = event["ph"].GetString();
+        if (phase == "X") {
+            num_complete_events++;
+            ASSERT_STREQ("RUNNING", event["name"].GetString());
+            ASSERT_EQ(pid, event["pid"].GetInt64());
+            ASSERT_EQ(0, event["tid"].GetInt64());
+            ASSERT_DOUBLE_EQ(2.0, event["dur"].GetDouble());
+        } else if (phase == "b" || phase == "e") {
+            num_async_events++;
+            ASSERT_STREQ("exchange", event["cat"].GetString());
+            ASSERT_EQ(7, event["id"].GetInt64());
+        } else {
+            ASSERT_EQ("M", phase);
+        }
+    }
+    ASSERT_EQ(1, num_complete_events);
+    ASSERT_EQ(2, num_async_events);
+}
+
+TEST(QueryTraceTest, test_max_events) {
+    QueryTrace trace(make_id(1, 2), 2);
+    for (int i = 0; i < 5; i++) {
+        trace.add_span("READY", "driver", 1, 0, i, i + 1);
+    }
+    ASSERT_EQ(2, trace.num_events());
+    ASSERT_EQ(3, trace.num_dropped_events());
+
+    rapidjson::Document doc;
+    doc.Parse(trace.to_json().c_str());
+    ASSERT_FALSE(doc.HasParseError());
+    ASSERT_EQ(3, doc["otherData"]["dropped_events"].GetUint64());
+}
+
+TEST(QueryTraceTest, test_manager_evicts_oldest) {
+    int32_t old_max_num = config::pipeline_query_trace_max_num;
+    config::pipeline_query_trace_max_num = 2;
+    auto* manager = QueryTraceManager::instance();
+    auto trace1 = manager->create(make_id(10, 1));
+    auto trace2 = manager->create(make_id(10, 2));
+    ASSERT_EQ(trace1, manager->get(make_id(10, 1)));
+    ASSERT_EQ(trace2, manager->get(make_id(10, 2)));
+
+    auto trace3 = manager->create(make_id(10, 3));
+    ASSERT_EQ(nullptr, manager->get(make_id(10, 1)));
+    ASSERT_EQ(trace2, manager->get(make_id(10, 2)));
+    ASSERT_EQ(trace3, manager->get(make_id(10, 3)));
+
+    // The trace of the same query is replaced.
+    auto trace4 = manager->create(make_id(10, 3));
+    ASSERT_EQ(trace4, manager->get(make_id(10, 3)));
+    ASSERT_EQ(trace2, manager->get(make_id(10, 2)));
+    config::pipeline_query_trace_max_num = old_max_num;
+}
+
+} // namespace starrocks::pipeline
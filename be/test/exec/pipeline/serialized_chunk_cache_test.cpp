@@ -0,0 +1,51 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "exec/pipeline/exchange/serialized_chunk_cache.h"
+
+#include "column/chunk.h"
+#include "gtest/gtest.h"
+
+namespace starrocks::pipeline {
+
+TEST(SerializedChunkCacheTest, test_share_among_consumers) {
+    SerializedChunkCache cache(3);
+    auto chunk = std::make_shared<vectorized::Chunk>();
+    ChunkPB pchunk;
+    pchunk.set_data_size(5);
+    butil::IOBuf data;
+    data.append("hello");
+
+    ChunkPB dst;
+    butil::IOBuf attachment;
+    ASSERT_FALSE(cache.get(chunk.get(), true, &dst, &attachment));
+    cache.put(chunk, true, pchunk, data);
+
+    // The meta of the first chunk is only cached for the first chunk.
+    ASSERT_FALSE(cache.get(chunk.get(), false, &dst, &attachment));
+
+    ASSERT_TRUE(cache.get(chunk.get(), true, &dst, &attachment));
+    ASSERT_EQ(5, dst.data_size());
+    ASSERT_EQ("hello", attachment.to_string());
+    ASSERT_TRUE(cache.get(chunk.get(), true, &dst, &attachment));
+    ASSERT_EQ("hellohello", attachment.to_string());
+
+    // All the other consumers have got the chunk.
+    ASSERT_FALSE(cache.get(chunk.get(), true, &dst, &attachment));
+}
+
+TEST(SerializedChunkCacheTest, test_evict_oldest) {
+    SerializedChunkCache cache(2);
+    std::vector<vectorized::ChunkPtr> chunks;
+    for (size_t i = 0; i <= SerializedChunkCache::MAX_NUM_ENTRIES; ++i) {
+        chunks.emplace_back(std::make_shared<vectorized::Chunk>());
+        cache.put(chunks.back(), false, ChunkPB(), butil::IOBuf());
+    }
+
+    ChunkPB dst;
+    butil::IOBuf attachment;
+    ASSERT_FALSE(cache.get(chunks[0].get(), false, &dst, &attachment));
+    ASSERT_TRUE(cache.get(chunks[1].get(), false, &dst, &attachment));
+    ASSERT_TRUE(cache.get(chunks.back().get(), false, &dst, &attachment));
+}
+
+} // namespace starrocks::pipeline
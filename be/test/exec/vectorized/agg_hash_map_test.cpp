@@ -238,6 +238,122 @@ TEST(HashMapTest, Insert) {
     }
 }
 
+TEST(HashMapTest, FixedSize32Key) {
+    // The nullable int, nullable bigint, bigint and nullable smallint keys take 25 bytes.
+    const int chunk_size = 64;
+    using TestAggHashMapKey = AggHashMapWithSerializedKeyFixedSize<FixedSize32SliceAggHashMap<PhmapSeed1>>;
+    TestAggHashMapKey key(chunk_size);
+    key.has_null_column = true;
+    key.fixed_byte_size = 0;
+    MemPool pool;
+
+    std::vector<std::pair<PrimitiveType, bool>> types = {
+            {TYPE_INT, true}, {TYPE_BIGINT, true}, {TYPE_BIGINT, false}, {TYPE_SMALLINT, true}};
+    Columns key_columns;
+    for (auto type : types) {
+        key_columns.emplace_back(ColumnHelper::create_column(TypeDescriptor(type.first), type.second));
+    }
+    for (int i = 0; i < chunk_size; ++i) {
+        const int v = i % 8;
+        if (v == 0) {
+            key_columns[0]->append_nulls(1);
+        } else {
+            key_columns[0]->append_datum(Datum(static_cast<int32_t>(v)));
+        }
+        key_columns[1]->append_datum(Datum(static_cast<int64_t>(v % 4)));
+        key_columns[2]->append_datum(Datum(static_cast<int64_t>(v)));
+        key_columns[3]->append_datum(Datum(static_cast<int16_t>(v % 2)));
+    }
+
+    Buffer<AggDataPtr> agg_states(chunk_size);
+    key.compute_agg_states(
+            chunk_size, key_columns, &pool, [&]() { return pool.allocate(16); }, &agg_states);
+    ASSERT_EQ(8, key.hash_map.size());
+    for (int i = 8; i < chunk_size; ++i) {
+        ASSERT_EQ(agg_states[i % 8], agg_states[i]);
+    }
+
+    std::vector<SliceKey32> resv;
+    for (auto [k, _] : key.hash_map) {
+        resv.emplace_back(k);
+    }
+    Columns res_columns;
+    for (auto type : types) {
+        res_columns.emplace_back(ColumnHelper::create_column(TypeDescriptor(type.first), type.second));
+    }
+    key.insert_keys_to_columns(resv, res_columns, resv.size());
+
+    std::set<int64_t> values;
+    for (size_t i = 0; i < resv.size(); ++i) {
+        const int64_t v = res_columns[2]->get(i).get_int64();
+        values.insert(v);
+        if (v == 0) {
+            ASSERT_TRUE(res_columns[0]->is_null(i));
+        } else {
+            ASSERT_EQ(v, res_columns[0]->get(i).get_int32());
+        }
+        ASSERT_EQ(v % 4, res_columns[1]->get(i).get_int64());
+        ASSERT_EQ(v % 2, res_columns[3]->get(i).get_int16());
+    }
+    ASSERT_EQ(8, values.size());
+}
+
+TEST(HashMapTest, SortedRuns) {
+    const int chunk_size = 64;
+    AggHashMapWithOneNumberKey<TYPE_INT, Int32AggHashMap<PhmapSeed1>> key(chunk_size);
+    MemPool pool;
+    Columns key_columns{ColumnHelper::create_column(TypeDescriptor(TYPE_INT), false)};
+    std::vector<int32_t> values = {1, 1, 1, 2, 2, 1, 3, 3, 3, 3};
+    for (int32_t v : values) {
+        key_columns[0]->append_datum(Datum(v));
+    }
+
+    // The runs of the same key share one agg state, and the keys out of order are still found in the hash map.
+    size_t num_allocated = 0;
+    Buffer<AggDataPtr> agg_states(values.size());
+    key.compute_agg_states(
+            values.size(), key_columns, &pool,
+            [&]() {
+                num_allocated++;
+                return pool.allocate(16);
+            },
+            &agg_states);
+    ASSERT_EQ(3, num_allocated);
+    ASSERT_EQ(3, key.hash_map.size());
+    for (size_t i = 0; i < values.size(); i++) {
+        ASSERT_EQ(key.hash_map[values[i]], agg_states[i]);
+    }
+}
+
+TEST(HashMapTest, DictCodeHashMap) {
+    DictCodeAggHashMap<PhmapSeed1> hash_map;
+    ASSERT_EQ(DICT_DECODE_MAX_SIZE + 1, hash_map.bucket_count());
+    ASSERT_TRUE(hash_map.begin() == hash_map.end());
+
+    std::vector<int64_t> values(DICT_DECODE_MAX_SIZE + 1);
+    for (int32_t code = 0; code <= DICT_DECODE_MAX_SIZE; code += 2) {
+        hash_map.lazy_emplace(code, [&](const auto& ctor) { ctor(code, reinterpret_cast<AggDataPtr>(&values[code])); });
+    }
+    ASSERT_EQ(DICT_DECODE_MAX_SIZE / 2 + 1, hash_map.size());
+
+    for (int32_t code = 0; code <= DICT_DECODE_MAX_SIZE; code++) {
+        auto iter = hash_map.find(code);
+        if (code % 2 == 0) {
+            ASSERT_TRUE(iter != hash_map.end());
+            ASSERT_EQ(reinterpret_cast<AggDataPtr>(&values[code]), iter->second);
+        } else {
+            ASSERT_TRUE(iter == hash_map.end());
+        }
+    }
+
+    int32_t expected_code = 0;
+    for (auto iter = hash_map.begin(); iter != hash_map.end(); ++iter) {
+        ASSERT_EQ(expected_code, iter->first);
+        expected_code += 2;
+    }
+    ASSERT_EQ(DICT_DECODE_MAX_SIZE + 2, expected_code);
+}
+
 TEST(HashMapTest, TwoLevelConvert) {
     std::vector<std::string> keys(1000);
     for (int i = 0; i < 1000; i++) {
@@ -0,0 +1,142 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "exec/vectorized/chunk_spill_file.h"
+
+#include <gtest/gtest.h>
+
+#include "column/chunk.h"
+#include "column/column_helper.h"
+#include "column/fixed_length_column.h"
+#include "column/nullable_column.h"
+#include "common/config.h"
+#include "common/object_pool.h"
+#include "fs/fs_util.h"
+#include "runtime/descriptor_helper.h"
+#include "runtime/descriptors.h"
+#include "storage/olap_define.h"
+
+namespace starrocks::vectorized {
+
+class ChunkSpillFileTest : public testing::Test {
+protected:
+    void SetUp() override {
+        // create tmp dir
+        std::stringstream tmp_dir_s;
+        tmp_dir_s << config::storage_root_path << TMP_PREFIX;
+        _tmp_dir = tmp_dir_s.str();
+        fs::create_directories(_tmp_dir);
+
+        TDescriptorTableBuilder table_desc_builder;
+        TTupleDescriptorBuilder tuple_desc_builder;
+        tuple_desc_builder.add_slot(
+                TSlotDescriptorBuilder().type(TYPE_INT).column_name("c0").column_pos(0).nullable(false).build());
+        tuple_desc_builder.add_slot(
+                TSlotDescriptorBuilder().type(TYPE_INT).column_name("c1").column_pos(1).nullable(true).build());
+        tuple_desc_builder.build(&table_desc_builder);
+
+        DescriptorTbl* tbl = nullptr;
+        ASSERT_TRUE(DescriptorTbl::create(&_pool, table_desc_builder.desc_tbl(), &tbl, config::vector_chunk_size).ok());
+        _row_desc = std::make_unique<RowDescriptor>(*tbl, std::vector<TTupleId>{0}, std::vector<bool>{false});
+    }
+
+    void TearDown() override {
+        // remove tmp dir
+        if (!_tmp_dir.empty()) {
+            fs::remove(_tmp_dir);
+        }
+    }
+
+    static ChunkPtr create_chunk(int32_t start, int32_t num_rows) {
+        auto c0 = Int32Column::create();
+        auto c1 = NullableColumn::create(Int32Column::create(), NullColumn::create());
+        for (int32_t i = 0; i < num_rows; i++) {
+            c0->append(start + i);
+            if (i % 3 == 0) {
+                c1->append_nulls(1);
+            } else {
+                c1->append_datum(Datum(start + i));
+            }
+        }
+        auto chunk = std::make_shared<Chunk>();
+        chunk->append_column(std::move(c0), 0);
+        chunk->append_column(std::move(c1), 1);
+        return chunk;
+    }
+
+    static void check_chunk(const ChunkPtr& chunk, int32_t start, int32_t num_rows) {
+        ASSERT_NE(nullptr, chunk);
+        ASSERT_EQ(static_cast<size_t>(num_rows), chunk->num_rows());
+        const auto& c0 = chunk->get_column_by_slot_id(0);
+        const auto& c1 = chunk->get_column_by_slot_id(1);
+        ASSERT_TRUE(c1->is_nullable());
+        for (int32_t i = 0; i < num_rows; i++) {
+            ASSERT_EQ(start + i, c0->get(i).get_int32());
+            if (i % 3 == 0) {
+                ASSERT_TRUE(c1->is_null(i));
+            } else {
+                ASSERT_EQ(start + i, c1->get(i).get_int32());
+            }
+        }
+    }
+
+    ObjectPool _pool;
+    std::unique_ptr<RowDescriptor> _row_desc;
+    std::string _tmp_dir;
+};
+
+// NOLINTNEXTLINE
+TEST_F(ChunkSpillFileTest, write_and_read) {
+    ChunkSpillFile file(config::storage_root_path, "test");
+    ASSERT_TRUE(file.write(*create_chunk(0, 100)).ok());
+    ASSERT_TRUE(file.write(*create_chunk(0, 0)).ok());
+    ASSERT_TRUE(file.write(*create_chunk(100, 4096)).ok());
+    ASSERT_EQ(2, file.num_chunks());
+    ASSERT_EQ(4196, file.num_rows());
+    ASSERT_GT(file.num_bytes(), 0);
+
+    ASSERT_TRUE(file.flip_to_read().ok());
+    for (int round = 0; round < 2; round++) {
+        auto chunk = file.read(*_row_desc);
+        ASSERT_TRUE(chunk.ok());
+        check_chunk(chunk.value(), 0, 100);
+        chunk = file.read(*_row_desc);
+        ASSERT_TRUE(chunk.ok());
+        check_chunk(chunk.value(), 100, 4096);
+        chunk = file.read(*_row_desc);
+        ASSERT_TRUE(chunk.ok());
+        ASSERT_EQ(nullptr, chunk.value());
+
+        // The chunks can be read again after flipping to read.
+        ASSERT_TRUE(file.flip_to_read().ok());
+    }
+}
+
+// NOLINTNEXTLINE
+TEST_F(ChunkSpillFileTest, const_column) {
+    auto chunk = create_chunk(0, 10);
+    chunk->get_column_by_slot_id(1) = ColumnHelper::create_const_column<TYPE_INT>(7, 10);
+
+    ChunkSpillFile file(config::storage_root_path, "test");
+    ASSERT_TRUE(file.write(*chunk).ok());
+    ASSERT_TRUE(file.flip_to_read().ok());
+
+    auto res = file.read(*_row_desc);
+    ASSERT_TRUE(res.ok());
+    ASSERT_EQ(10, res.value()->num_rows());
+    const auto& column = res.value()->get_column_by_slot_id(1);
+    ASSERT_FALSE(column->is_constant());
+    for (size_t i = 0; i < 10; i++) {
+        ASSERT_EQ(7, column->get(i).get_int32());
+    }
+}
+
+// NOLINTNEXTLINE
+TEST_F(ChunkSpillFileTest, empty_file) {
+    ChunkSpillFile file(config::storage_root_path, "test");
+    ASSERT_TRUE(file.flip_to_read().ok());
+    auto chunk = file.read(*_row_desc);
+    ASSERT_TRUE(chunk.ok());
+    ASSERT_EQ(nullptr, chunk.value());
+}
+
+} // namespace starrocks::vectorized
@@ -15,6 +15,7 @@
 #include "column/datum.h"
 #include "column/vectorized_fwd.h"
 #include "common/object_pool.h"
+#include "exec/vectorized/topn_runtime_filter.h"
 #include "exprs/expr_context.h"
 #include "exprs/vectorized/column_ref.h"
 #include "runtime/primitive_type.h"
@@ -300,4 +301,38 @@ TEST_F(ChunksSorterHeapSortTest, single_column_order_by_nullable_test) {
     }
 }
 
+TEST_F(ChunksSorterHeapSortTest, topn_runtime_filter_test) {
+    std::vector<bool> is_asc = {false};
+    std::vector<bool> null_first = {false};
+
+    std::vector<TypeDescriptor*> type_descs = {_pool.add(new TypeDescriptor(TYPE_INT))};
+    std::vector<BuildOptions> build_options = {{{5, 2, 5, 3, 1, 4, 7, 8, 3, 9}, false, false}};
+    FakeChunks fake_chunks(&_pool, type_descs, build_options);
+
+    std::vector<ExprContext*> sort_exprs;
+    sort_exprs.push_back(_pool.add(new ExprContext(fake_chunks.slot_refs()[0])));
+    ChunksSorterHeapSort sorter(_runtime_state.get(), &sort_exprs, &is_asc, &null_first, "", 0, 3);
+    sorter.setup_runtime(_pool.add(new RuntimeProfile("")));
+    auto filter = std::make_shared<TopnRuntimeFilter>("c0", TYPE_INT, false);
+    sorter.set_topn_runtime_filter(filter);
+
+    // The bound is published once the heap is full, i.e. the third largest value.
+    sorter.update(nullptr, fake_chunks.next_chunk(2));
+    ASSERT_EQ(0, filter->version());
+    sorter.update(nullptr, fake_chunks.next_chunk(10));
+    ASSERT_GT(filter->version(), 0);
+    TCondition condition;
+    ASSERT_GT(filter->get_condition(&condition), 0);
+    ASSERT_EQ("c0", condition.column_name);
+    ASSERT_EQ(">=", condition.condition_op);
+    ASSERT_EQ(std::vector<std::string>{"7"}, condition.condition_values);
+
+    // A looser bound of another sorter doesn't change it.
+    int64_t version = filter->version();
+    auto looser = Int32Column::create();
+    looser->append(3);
+    filter->update(*looser, 0);
+    ASSERT_EQ(version, filter->version());
+}
+
 } // namespace starrocks::vectorized
@@ -1212,6 +1212,8 @@ TEST_F(JoinHashMapTest, SerializedJoinBuildProbeFunc) {
         auto data = table_items.build_slice;
         while (probe_index != 0) {
             if (JoinHashMapHelper::get_hash_key(*probe_state.key_columns, i, buffer.data()) == data[probe_index]) {
+                // The equal keys must have the same hash tag.
+                ASSERT_EQ(table_items.build_slice_hash[probe_index], probe_state.probe_slice_hash[i]);
                 found_count++;
             }
             probe_index = table_items.next[probe_index];
@@ -1631,6 +1633,65 @@ TEST_F(JoinHashMapTest, ProbeFromHtForRightAntiJoinWithOtherConjunct) {
     this->check_probe_state(table_items, probe_state, JoinMatchFlag::NORMAL, 1, match_count, probe_row_count, false);
 }
 
+// NOLINTNEXTLINE
+TEST_F(JoinHashMapTest, RangeDirectMappingJoinHashTable) {
+    TDescriptorTableBuilder row_desc_builder;
+    add_tuple_descriptor(&row_desc_builder, PrimitiveType::TYPE_BIGINT, false, 1);
+    add_tuple_descriptor(&row_desc_builder, PrimitiveType::TYPE_BIGINT, false, 1);
+
+    auto row_desc = create_row_desc(_object_pool, &row_desc_builder, false);
+    auto probe_row_desc = create_probe_desc(_object_pool, &row_desc_builder, false);
+    auto build_row_desc = create_build_desc(_object_pool, &row_desc_builder, false);
+
+    TypeDescriptor bigint_type(TYPE_BIGINT);
+    HashTableParam param;
+    param.need_create_tuple_columns = false;
+    param.with_other_conjunct = false;
+    param.join_type = TJoinOp::INNER_JOIN;
+    param.row_desc = row_desc.get();
+    param.probe_row_desc = probe_row_desc.get();
+    param.build_row_desc = build_row_desc.get();
+    param.output_slots.emplace(1);
+    param.join_keys.emplace_back(JoinKeyDesc{&bigint_type, false, nullptr});
+    param.search_ht_timer = ADD_TIMER(_runtime_profile, "search_ht");
+    param.output_build_column_timer = ADD_TIMER(_runtime_profile, "output_build_column");
+    param.output_probe_column_timer = ADD_TIMER(_runtime_profile, "output_probe_column");
+    param.output_tuple_column_timer = ADD_TIMER(_runtime_profile, "output_tuple_column");
+
+    JoinHashTable ht;
+
+    // The dense build keys, with a duplicated key.
+    auto build_chunk = std::make_shared<Chunk>();
+    auto build_column = Int64Column::create();
+    down_cast<Int64Column*>(build_column.get())->append({1000, 1001, 1002, 1003, 1003, 1005});
+    build_chunk->append_column(build_column, 1);
+
+    // The probe keys out of the range of the build keys must not be matched.
+    auto probe_chunk = std::make_shared<Chunk>();
+    auto probe_column = Int64Column::create();
+    down_cast<Int64Column*>(probe_column.get())
+            ->append({std::numeric_limits<int64_t>::min(), 0, 999, 1000, 1003, 1004, 1005, 1006,
+                      std::numeric_limits<int64_t>::max()});
+    probe_chunk->append_column(probe_column, 0);
+    Columns probe_key_columns = {probe_column};
+
+    ChunkPtr result_chunk = std::make_shared<Chunk>();
+    bool eos = false;
+
+    ht.create(param);
+    Columns key_columns{build_chunk->columns()[0]};
+    ht.append_chunk(_runtime_state.get(), build_chunk, key_columns);
+    ASSERT_TRUE(ht.build(_runtime_state.get()).ok());
+    // The buckets are the range of the build keys.
+    ASSERT_EQ(6, ht.get_bucket_size());
+    ASSERT_TRUE(ht.probe(_runtime_state.get(), probe_key_columns, &probe_chunk, &result_chunk, &eos).ok());
+
+    auto result_data = down_cast<Int64Column*>(result_chunk->get_column_by_slot_id(1).get())->get_data();
+    std::sort(result_data.begin(), result_data.end());
+    Buffer<int64_t> check_data = {1000, 1003, 1003, 1005};
+    ASSERT_TRUE(result_data == check_data);
+}
+
 // NOLINTNEXTLINE
 TEST_F(JoinHashMapTest, OneKeyJoinHashTable) {
     auto runtime_profile = create_runtime_profile();
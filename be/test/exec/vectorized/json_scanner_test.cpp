@@ -429,6 +429,37 @@ TEST_F(JsonScannerTest, test_ndjson_with_jsonpath) {
     EXPECT_EQ("['v5', 'server', '10.10.0.5', 50]", chunk->debug_row(4));
 }
 
+TEST_F(JsonScannerTest, test_ndjson_with_jsonpath_out_of_order) {
+    std::vector<TypeDescriptor> types;
+    types.emplace_back(TYPE_INT);
+    types.emplace_back(TYPE_INT);
+    types.emplace_back(TYPE_INT);
+    types.emplace_back(TypeDescriptor::create_varchar_type(20));
+
+    std::vector<TBrokerRangeDesc> ranges;
+    TBrokerRangeDesc range;
+    range.format_type = TFileFormatType::FORMAT_JSON;
+    range.strip_outer_array = false;
+    range.__isset.strip_outer_array = false;
+    range.__isset.jsonpaths = true;
+    // the top-level jsonpaths are extracted in the key order of the first object.
+    range.jsonpaths = "[\"$.e\", \"$.c.d\", \"$.a\", \"$.b\"]";
+    range.__isset.json_root = false;
+    range.__set_path("./be/test/exec/test_data/json_scanner/test_jsonpath_out_of_order.json");
+    ranges.emplace_back(range);
+
+    auto scanner = create_json_scanner(types, ranges, {"e", "d", "a", "b"});
+    ASSERT_OK(scanner->open());
+
+    ChunkPtr chunk = scanner->get_next().value();
+    EXPECT_EQ(4, chunk->num_columns());
+    EXPECT_EQ(3, chunk->num_rows());
+
+    EXPECT_EQ("[3, 2, 1, 'x']", chunk->debug_row(0));
+    EXPECT_EQ("[6, 5, 4, 'y']", chunk->debug_row(1));
+    EXPECT_EQ("[9, NULL, 7, NULL]", chunk->debug_row(2));
+}
+
 TEST_F(JsonScannerTest, test_multi_type) {
     std::vector<TypeDescriptor> types;
     types.emplace_back(TYPE_BOOLEAN);
@@ -299,5 +299,26 @@ TEST_F(RepeatNodeTest, repeat_node_test) {
     ASSERT_TRUE(rows == 9);
 }
 
+TEST_F(RepeatNodeTest, repeat_node_share_columns) {
+    RepeatNode repeat_node(&_obj_pool, _tnode, *_desc_tbl);
+    MockExchangeNode exchange_node(&_obj_pool, _tnode, *_desc_tbl);
+    repeat_node._children.push_back(&exchange_node);
+
+    bool eos = false;
+    ChunkPtr first_chunk = nullptr;
+    ChunkPtr second_chunk = nullptr;
+    ChunkPtr third_chunk = nullptr;
+    repeat_node.get_next(&_runtime_state, &first_chunk, &eos);
+    repeat_node.get_next(&_runtime_state, &second_chunk, &eos);
+    repeat_node.get_next(&_runtime_state, &third_chunk, &eos);
+    ASSERT_FALSE(eos);
+
+    // Without conjuncts and runtime filters, the repeated chunks share the input columns instead of copying them.
+    ASSERT_EQ(second_chunk->get_column_by_slot_id(0).get(), third_chunk->get_column_by_slot_id(0).get());
+    ASSERT_TRUE(first_chunk->get_column_by_slot_id(0)->only_null());
+    ASSERT_TRUE(second_chunk->get_column_by_slot_id(1)->only_null());
+    ASSERT_EQ(22, third_chunk->get_column_by_slot_id(1)->get(2).get_int32());
+}
+
 } // namespace vectorized
 } // namespace starrocks
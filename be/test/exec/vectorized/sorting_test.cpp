@@ -9,6 +9,7 @@
 
 #include "column/chunk.h"
 #include "column/column_helper.h"
+#include "common/config.h"
 #include "exec/vectorized/sorting/merge.h"
 #include "exec/vectorized/sorting/sort_helper.h"
 #include "exprs/expr_context.h"
@@ -185,6 +186,59 @@ TEST(SortingTest, append_by_permutation_int) {
     ASSERT_EQ(2048, merged->get(1).get_int32());
 }
 
+TEST(SortingTest, sort_by_normalized_keys) {
+    std::mt19937 rng(0);
+    const size_t num_rows = 1000;
+    auto c0 = NullableColumn::create(Int32Column::create(), NullColumn::create());
+    auto c1 = DoubleColumn::create();
+    auto c2 = Int16Column::create();
+    auto c3 = BinaryColumn::create();
+    for (size_t i = 0; i < num_rows; i++) {
+        if (rng() % 5 == 0) {
+            c0->append_nulls(1);
+        } else {
+            c0->append_datum(Datum(static_cast<int32_t>(rng() % 7) - 3));
+        }
+        c1->append((static_cast<int>(rng() % 5) - 2) * 0.5);
+        c2->append(static_cast<int16_t>(rng() % 3));
+        c3->append_string(std::to_string(rng() % 4));
+    }
+    Columns columns{c0, c1, c2, c3};
+    Chunk::SlotHashMap slot_map{{0, 0}, {1, 1}, {2, 2}, {3, 3}};
+    ChunkPtr chunk = std::make_shared<Chunk>(columns, slot_map);
+
+    for (int orders = 0; orders < 8; orders++) {
+        std::vector<int> sort_orders{(orders & 1) ? 1 : -1, (orders & 2) ? 1 : -1, (orders & 4) ? 1 : -1, 1};
+        for (int null_first : {-1, 1}) {
+            std::vector<int> null_firsts{null_first, null_first, null_first, null_first};
+
+            // The normalized keys cover the three leading columns, and the binary column is sorted by the ties.
+            SmallPermutation small_perm = create_small_permutation(num_rows);
+            Tie tie(num_rows, 1);
+            auto res = sort_and_tie_columns_by_normalized_keys(false, columns, sort_orders, null_firsts, small_perm,
+                                                               tie);
+            ASSERT_OK(res.status());
+            ASSERT_EQ(3, res.value());
+
+            Permutation expected;
+            config::enable_sort_normalized_key = false;
+            ASSERT_OK(sort_and_tie_columns(false, columns, sort_orders, null_firsts, &expected));
+            Permutation actual;
+            config::enable_sort_normalized_key = true;
+            ASSERT_OK(sort_and_tie_columns(false, columns, sort_orders, null_firsts, &actual));
+
+            ChunkPtr expected_chunk = chunk->clone_empty(num_rows);
+            append_by_permutation(expected_chunk.get(), {chunk}, expected);
+            ChunkPtr actual_chunk = chunk->clone_empty(num_rows);
+            append_by_permutation(actual_chunk.get(), {chunk}, actual);
+            SortDescs sort_desc(sort_orders, null_firsts);
+            for (size_t i = 0; i < num_rows; i++) {
+                ASSERT_EQ(0, compare_chunk_row(sort_desc, expected_chunk->columns(), actual_chunk->columns(), i, i));
+            }
+        }
+    }
+}
+
 TEST(SortingTest, steal_chunk) {
     ColumnPtr col1 = build_sorted_column(TypeDescriptor(TYPE_INT), 0, 0, 100, 1);
     ColumnPtr col2 = build_sorted_column(TypeDescriptor(TYPE_INT), 1, 0, 100, 1);
@@ -0,0 +1,81 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present StarRocks Limited.
+
+#include "exec/workgroup/scan_task_queue.h"
+
+#include <gtest/gtest.h>
+
+#include "common/config.h"
+#include "util/time.h"
+
+namespace starrocks::workgroup {
+
+static ScanTask create_task(int id, std::vector<int>* executed_ids, int64_t scan_time_ns,
+                            int64_t deadline_ns = std::numeric_limits<int64_t>::max()) {
+    ScanTask task(nullptr, [id, executed_ids](int) { executed_ids->emplace_back(id); });
+    task.query_scan_time_ns = scan_time_ns;
+    task.query_deadline_ns = deadline_ns;
+    return task;
+}
+
+TEST(PriorityScanTaskQueueTest, test_compute_level) {
+    ASSERT_EQ(0, PriorityScanTaskQueue::compute_level(0));
+    ASSERT_EQ(0, PriorityScanTaskQueue::compute_level(199'999'999L));
+    ASSERT_EQ(1, PriorityScanTaskQueue::compute_level(200'000'000L));
+    ASSERT_EQ(2, PriorityScanTaskQueue::compute_level(600'000'000L));
+    ASSERT_EQ(6, PriorityScanTaskQueue::compute_level(5'000'000'000L));
+    ASSERT_EQ(PriorityScanTaskQueue::NUM_LEVELS - 1, PriorityScanTaskQueue::compute_level(3600'000'000'000L));
+}
+
+TEST(PriorityScanTaskQueueTest, test_prefer_less_scan_time) {
+    PriorityScanTaskQueue queue;
+    std::vector<int> executed_ids;
+    queue.try_offer(create_task(1, &executed_ids, 10'000'000'000L));
+    queue.try_offer(create_task(2, &executed_ids, 10'000'000'000L));
+    queue.try_offer(create_task(3, &executed_ids, 0));
+    queue.try_offer(create_task(4, &executed_ids, 300'000'000L));
+    queue.try_offer(create_task(5, &executed_ids, 0));
+    ASSERT_EQ(5, queue.size());
+
+    while (queue.size() > 0) {
+        auto task = queue.take(0);
+        ASSERT_TRUE(task.ok());
+        task.value().work_function(0);
+    }
+    ASSERT_EQ(std::vector<int>({3, 5, 4, 1, 2}), executed_ids);
+}
+
+TEST(PriorityScanTaskQueueTest, test_urgent_deadline) {
+    const int64_t old_urgent_deadline_ms = config::pipeline_scan_task_urgent_deadline_ms;
+    config::pipeline_scan_task_urgent_deadline_ms = 1000;
+
+    PriorityScanTaskQueue queue;
+    std::vector<int> executed_ids;
+    const int64_t now = MonotonicNanos();
+    queue.try_offer(create_task(1, &executed_ids, 0, now + 3600'000'000'000L));
+    queue.try_offer(create_task(2, &executed_ids, 10'000'000'000L, now + 200'000'000L));
+    queue.try_offer(create_task(3, &executed_ids, 10'000'000'000L, now + 100'000'000L));
+    queue.try_offer(create_task(4, &executed_ids, 0));
+
+    while (queue.size() > 0) {
+        auto task = queue.take(0);
+        ASSERT_TRUE(task.ok());
+        task.value().work_function(0);
+    }
+    ASSERT_EQ(std::vector<int>({3, 2, 1, 4}), executed_ids);
+
+    // The deadlines aren't considered, when pipeline_scan_task_urgent_deadline_ms is 0.
+    config::pipeline_scan_task_urgent_deadline_ms = 0;
+    executed_ids.clear();
+    queue.try_offer(create_task(1, &executed_ids, 10'000'000'000L, now));
+    queue.try_offer(create_task(2, &executed_ids, 0));
+    while (queue.size() > 0) {
+        auto task = queue.take(0);
+        ASSERT_TRUE(task.ok());
+        task.value().work_function(0);
+    }
+    ASSERT_EQ(std::vector<int>({2, 1}), executed_ids);
+
+    config::pipeline_scan_task_urgent_deadline_ms = old_urgent_deadline_ms;
+}
+
+} // namespace starrocks::workgroup
@@ -10,6 +10,7 @@
 #include "column/fixed_length_column.h"
 #include "column/nullable_column.h"
 #include "column/vectorized_fwd.h"
+#include "common/config.h"
 #include "exprs/agg/aggregate_factory.h"
 #include "exprs/agg/any_value.h"
 #include "exprs/agg/maxmin.h"
@@ -722,6 +723,158 @@ TEST_F(AggregateTest, test_min) {
 //    test_agg_function<int64_t, int64_t>(ctx, func, 1024, 1000, 2024);
 //}
 
+// Update two states in batch with runs of the same state, and compare the results with updating them row by row
+// selectively.
+static void test_update_batch_runs(FunctionContext* ctx, const AggregateFunction* func,
+                                   const ColumnPtr& result_column) {
+    auto data_column = Int32Column::create();
+    for (int i = 0; i < 100; i++) {
+        data_column->append(i * 7 % 31);
+    }
+    const Column* row_column = data_column.get();
+
+    auto state0 = ManagedAggrState::create(ctx, func);
+    auto state1 = ManagedAggrState::create(ctx, func);
+    auto expected_state0 = ManagedAggrState::create(ctx, func);
+    auto expected_state1 = ManagedAggrState::create(ctx, func);
+    std::vector<AggDataPtr> states(data_column->size());
+    std::vector<AggDataPtr> expected_states(data_column->size());
+    for (size_t i = 0; i < data_column->size(); i++) {
+        // Runs of 10 rows, and runs of a single row in [50, 60).
+        const bool first = i >= 50 && i < 60 ? i % 2 == 0 : (i / 10) % 2 == 0;
+        states[i] = first ? state0->state() : state1->state();
+        expected_states[i] = first ? expected_state0->state() : expected_state1->state();
+    }
+    func->update_batch(ctx, data_column->size(), 0, &row_column, states.data());
+    std::vector<uint8_t> filter(data_column->size(), 0);
+    func->update_batch_selectively(ctx, data_column->size(), 0, &row_column, expected_states.data(), filter);
+
+    func->finalize_to_column(ctx, state0->state(), result_column.get());
+    func->finalize_to_column(ctx, state1->state(), result_column.get());
+    func->finalize_to_column(ctx, expected_state0->state(), result_column.get());
+    func->finalize_to_column(ctx, expected_state1->state(), result_column.get());
+    ASSERT_EQ(0, result_column->compare_at(0, 2, *result_column, 1));
+    ASSERT_EQ(0, result_column->compare_at(1, 3, *result_column, 1));
+}
+
+TEST_F(AggregateTest, test_update_batch_runs) {
+    test_update_batch_runs(ctx, get_aggregate_function("sum", TYPE_INT, TYPE_BIGINT, false), Int64Column::create());
+    test_update_batch_runs(ctx, get_aggregate_function("count", TYPE_BIGINT, TYPE_BIGINT, false),
+                           Int64Column::create());
+    test_update_batch_runs(ctx, get_aggregate_function("count", TYPE_BIGINT, TYPE_BIGINT, true),
+                           Int64Column::create());
+    test_update_batch_runs(ctx, get_aggregate_function("max", TYPE_INT, TYPE_INT, false), Int32Column::create());
+    test_update_batch_runs(ctx, get_aggregate_function("min", TYPE_INT, TYPE_INT, false), Int32Column::create());
+    test_update_batch_runs(ctx, get_aggregate_function("avg", TYPE_INT, TYPE_DOUBLE, false), DoubleColumn::create());
+    // The nullable function updates the nested states in batch if the input column has no null.
+    test_update_batch_runs(ctx, get_aggregate_function("sum", TYPE_INT, TYPE_BIGINT, true),
+                           NullableColumn::create(Int64Column::create(), NullColumn::create()));
+}
+
+// Slide the frame of `ROWS BETWEEN 3 PRECEDING AND 1 FOLLOWING` over the rows like Analytor::update_sliding_frame,
+// and compare the results with resetting the state and updating it by all the rows in the frame.
+static void test_sliding_frame(FunctionContext* ctx, const AggregateFunction* func, const ColumnPtr& result_column) {
+    ASSERT_TRUE(func->is_removable());
+    auto data_column = Int32Column::create();
+    auto null_column = NullColumn::create();
+    for (int i = 0; i < 100; i++) {
+        // Descending in [0, 30), so that max removes its maximum, and all null in [60, 70).
+        data_column->append(i < 30 ? 30 - i : i * 7 % 31);
+        null_column->append((i >= 60 && i < 70) || i % 9 == 0);
+    }
+    auto column = NullableColumn::create(std::move(data_column), std::move(null_column));
+    const Column* row_column = column.get();
+    const int64_t num_rows = column->size();
+
+    auto state = ManagedAggrState::create(ctx, func);
+    auto expected_state = ManagedAggrState::create(ctx, func);
+    int64_t prev_start = 0;
+    int64_t prev_end = 0;
+    for (int64_t i = 0; i < num_rows; i++) {
+        int64_t start = std::max<int64_t>(i - 3, 0);
+        int64_t end = std::min<int64_t>(i + 2, num_rows);
+        func->update_batch_single_state(ctx, state->state(), &row_column, 0, num_rows, prev_end, end);
+        if (!func->remove_batch_single_state(ctx, state->state(), &row_column, prev_start, start, end)) {
+            func->reset(ctx, {}, state->state());
+            func->update_batch_single_state(ctx, state->state(), &row_column, 0, num_rows, start, end);
+        }
+        prev_start = start;
+        prev_end = end;
+
+        func->reset(ctx, {}, expected_state->state());
+        func->update_batch_single_state(ctx, expected_state->state(), &row_column, 0, num_rows, start, end);
+        func->finalize_to_column(ctx, state->state(), result_column.get());
+        func->finalize_to_column(ctx, expected_state->state(), result_column.get());
+        ASSERT_EQ(0, result_column->compare_at(2 * i, 2 * i + 1, *result_column, 1)) << "row " << i;
+    }
+}
+
+TEST_F(AggregateTest, test_sliding_frame) {
+    auto nullable_int64 = [] { return NullableColumn::create(Int64Column::create(), NullColumn::create()); };
+    test_sliding_frame(ctx, get_aggregate_function("sum", TYPE_INT, TYPE_BIGINT, true), nullable_int64());
+    test_sliding_frame(ctx, get_aggregate_function("count", TYPE_BIGINT, TYPE_BIGINT, true), Int64Column::create());
+    test_sliding_frame(ctx, get_aggregate_function("max", TYPE_INT, TYPE_INT, true),
+                       NullableColumn::create(Int32Column::create(), NullColumn::create()));
+    test_sliding_frame(ctx, get_aggregate_function("min", TYPE_INT, TYPE_INT, true),
+                       NullableColumn::create(Int32Column::create(), NullColumn::create()));
+    test_sliding_frame(ctx, get_aggregate_function("avg", TYPE_INT, TYPE_DOUBLE, true),
+                       NullableColumn::create(DoubleColumn::create(), NullColumn::create()));
+    // The float sums are not removable.
+    ASSERT_FALSE(get_aggregate_function("sum", TYPE_DOUBLE, TYPE_DOUBLE, true)->is_removable());
+}
+
+static void test_batch_serialize(FunctionContext* ctx, const AggregateFunction* func, const ColumnPtr& serde_column) {
+    auto data_column = Int32Column::create();
+    for (int i = 0; i < 1000; i++) {
+        data_column->append(i % 300);
+    }
+    const Column* row_column = data_column.get();
+
+    // The last state is not updated.
+    std::vector<std::unique_ptr<ManagedAggrState>> managed_states;
+    Buffer<AggDataPtr> agg_states;
+    for (int i = 0; i < 5; i++) {
+        managed_states.emplace_back(ManagedAggrState::create(ctx, func));
+        agg_states.push_back(managed_states.back()->state());
+    }
+    std::vector<AggDataPtr> row_states;
+    for (int i = 0; i < 1000; i++) {
+        row_states.push_back(agg_states[i * 4 / 1000]);
+    }
+    func->update_batch(ctx, row_states.size(), 0, &row_column, row_states.data());
+
+    ColumnPtr batch_column = serde_column->clone_empty();
+    ColumnPtr row_by_row_column = serde_column->clone_empty();
+    func->batch_serialize(ctx, agg_states.size(), agg_states, 0, batch_column.get());
+    for (auto state : agg_states) {
+        func->serialize_to_column(ctx, state, row_by_row_column.get());
+    }
+    ASSERT_EQ(agg_states.size(), batch_column->size());
+    ASSERT_EQ(agg_states.size(), row_by_row_column->size());
+
+    auto result_column = Int64Column::create();
+    for (size_t i = 0; i < agg_states.size(); i++) {
+        ASSERT_EQ(row_by_row_column->is_null(i), batch_column->is_null(i));
+        auto batch_state = ManagedAggrState::create(ctx, func);
+        auto row_by_row_state = ManagedAggrState::create(ctx, func);
+        func->merge_batch_single_state(ctx, i + 1, batch_column.get(), batch_state->state());
+        func->merge_batch_single_state(ctx, i + 1, row_by_row_column.get(), row_by_row_state->state());
+        func->finalize_to_column(ctx, batch_state->state(), result_column.get());
+        func->finalize_to_column(ctx, row_by_row_state->state(), result_column.get());
+        ASSERT_GT(result_column->get_data()[2 * i], 0);
+        ASSERT_EQ(result_column->get_data()[2 * i], result_column->get_data()[2 * i + 1]);
+    }
+}
+
+TEST_F(AggregateTest, test_batch_serialize) {
+    test_batch_serialize(ctx, get_aggregate_function("ndv", TYPE_INT, TYPE_BIGINT, false), BinaryColumn::create());
+    test_batch_serialize(ctx, get_aggregate_function("multi_distinct_count", TYPE_INT, TYPE_BIGINT, false),
+                         BinaryColumn::create());
+    // The null rows of the nullable function are serialized as empty values.
+    test_batch_serialize(ctx, get_aggregate_function("ndv", TYPE_INT, TYPE_BIGINT, true),
+                         NullableColumn::create(BinaryColumn::create(), NullColumn::create()));
+}
+
 TEST_F(AggregateTest, test_count_distinct) {
     const AggregateFunction* func = get_aggregate_function("multi_distinct_count", TYPE_SMALLINT, TYPE_BIGINT, false);
     test_agg_function<int16_t, int64_t>(ctx, func, 1024, 1000, 2024);
@@ -754,6 +907,51 @@ TEST_F(AggregateTest, test_count_distinct) {
     test_agg_function<DateValue, int64_t>(ctx, func, 20, 21, 40);
 }
 
+TEST_F(AggregateTest, test_distinct_bitmap) {
+    const int64_t old_threshold = config::distinct_agg_bitmap_threshold;
+    // Both states are switched to bitmaps.
+    config::distinct_agg_bitmap_threshold = 100;
+    const AggregateFunction* func = get_aggregate_function("multi_distinct_count", TYPE_SMALLINT, TYPE_BIGINT, false);
+    test_agg_function<int16_t, int64_t>(ctx, func, 1024, 1000, 2024);
+
+    func = get_aggregate_function("multi_distinct_count", TYPE_INT, TYPE_BIGINT, false);
+    test_agg_function<int32_t, int64_t>(ctx, func, 1024, 1000, 2024);
+
+    func = get_aggregate_function("multi_distinct_count", TYPE_BIGINT, TYPE_BIGINT, false);
+    test_agg_function<int64_t, int64_t>(ctx, func, 1024, 1000, 2024);
+
+    func = get_aggregate_function("multi_distinct_sum", TYPE_INT, TYPE_BIGINT, false);
+    test_agg_function<int32_t, int64_t>(ctx, func, 523776, 2499500, 3023276);
+
+    // The bitmap of 1024 values is merged into the hash set of 1000 values.
+    config::distinct_agg_bitmap_threshold = 1010;
+    func = get_aggregate_function("multi_distinct_count", TYPE_INT, TYPE_BIGINT, false);
+    test_agg_function<int32_t, int64_t>(ctx, func, 1024, 1000, 2024);
+
+    // The hash set of negative values is merged into the bitmap.
+    func = get_aggregate_function("multi_distinct_sum", TYPE_BIGINT, TYPE_BIGINT, false);
+    auto negative_column = Int64Column::create();
+    for (int64_t i = 1; i <= 10; i++) {
+        negative_column->append(-i);
+    }
+    auto bitmap_state = ManagedAggrState::create(ctx, func);
+    auto set_state = ManagedAggrState::create(ctx, func);
+    ColumnPtr column = gen_input_column1<int64_t>();
+    const Column* row_column = column.get();
+    func->update_batch_single_state(ctx, row_column->size(), &row_column, bitmap_state->state());
+    row_column = negative_column.get();
+    func->update_batch_single_state(ctx, row_column->size(), &row_column, set_state->state());
+
+    auto serde_column = BinaryColumn::create();
+    func->serialize_to_column(ctx, set_state->state(), serde_column.get());
+    func->merge(ctx, serde_column.get(), bitmap_state->state(), 0);
+    auto result_column = Int64Column::create();
+    func->finalize_to_column(ctx, bitmap_state->state(), result_column.get());
+    ASSERT_EQ(523776 - 55, result_column->get_data()[0]);
+
+    config::distinct_agg_bitmap_threshold = old_threshold;
+}
+
 TEST_F(AggregateTest, test_sum_distinct) {
     const AggregateFunction* func = get_aggregate_function("multi_distinct_sum", TYPE_SMALLINT, TYPE_BIGINT, false);
     test_agg_function<int16_t, int64_t>(ctx, func, 523776, 2499500, 3023276);
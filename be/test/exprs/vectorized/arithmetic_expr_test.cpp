@@ -612,5 +612,56 @@ TEST_F(VectorizedArithmeticExprTest, constModN128Expr) {
     }
 }
 
+TEST_F(VectorizedArithmeticExprTest, nestedInPlaceExpr) {
+    // (3 * 4) + nullable(1)
+    expr_node.opcode = TExprOpcode::MULTIPLY;
+    std::unique_ptr<Expr> mul(VectorizedArithmeticExprFactory::from_thrift(expr_node));
+    expr_node.opcode = TExprOpcode::ADD;
+    std::unique_ptr<Expr> add(VectorizedArithmeticExprFactory::from_thrift(expr_node));
+
+    MockVectorizedExpr<TYPE_INT> col1(expr_node, 10, 3);
+    MockVectorizedExpr<TYPE_INT> col2(expr_node, 10, 4);
+    MockNullVectorizedExpr<TYPE_INT> col3(expr_node, 10, 1);
+
+    mul->_children.push_back(&col1);
+    mul->_children.push_back(&col2);
+    add->_children.push_back(mul.get());
+    add->_children.push_back(&col3);
+
+    ColumnPtr ptr = add->evaluate(nullptr, nullptr);
+    ASSERT_TRUE(ptr->is_nullable());
+    ASSERT_EQ(10, ptr->size());
+    auto data = std::static_pointer_cast<Int32Column>(std::static_pointer_cast<NullableColumn>(ptr)->data_column());
+    for (int j = 0; j < ptr->size(); ++j) {
+        ASSERT_EQ(j % 2 == 1, ptr->is_null(j));
+        if (!ptr->is_null(j)) {
+            ASSERT_EQ(13, data->get_data()[j]);
+        }
+    }
+}
+
+TEST_F(VectorizedArithmeticExprTest, sharedColumnNotModified) {
+    // the columns shared with the others, e.g. the columns of the chunk, must not be written in place
+    expr_node.opcode = TExprOpcode::ADD;
+    std::unique_ptr<Expr> expr(VectorizedArithmeticExprFactory::from_thrift(expr_node));
+
+    auto column = Int32Column::create();
+    column->append(1);
+    column->append(2);
+    MockExpr col1(expr_node, column);
+    MockConstVectorizedExpr<TYPE_INT> col2(expr_node, 10);
+
+    expr->_children.push_back(&col1);
+    expr->_children.push_back(&col2);
+
+    ColumnPtr ptr = expr->evaluate(nullptr, nullptr);
+    ASSERT_NE(column.get(), ptr.get());
+    auto v = std::static_pointer_cast<Int32Column>(ptr);
+    ASSERT_EQ(11, v->get_data()[0]);
+    ASSERT_EQ(12, v->get_data()[1]);
+    ASSERT_EQ(1, column->get_data()[0]);
+    ASSERT_EQ(2, column->get_data()[1]);
+}
+
 } // namespace vectorized
 } // namespace starrocks
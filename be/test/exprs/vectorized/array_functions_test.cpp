@@ -3735,6 +3735,30 @@ TEST_F(ArrayFunctionsTest, array_concat_varchar_not_nullable) {
     ASSERT_EQ(Slice("1"), dest_column->get(3).get_array()[7].get_slice());
 }
 
+TEST_F(ArrayFunctionsTest, array_distinct_int_with_nullable) {
+    auto src_column = ColumnHelper::create_column(TYPE_ARRAY_INT, true);
+    src_column->append_datum(DatumArray{5, 3, 5, 3, 6});
+    src_column->append_datum(DatumArray{});
+    src_column->append_datum(Datum());
+    src_column->append_datum(DatumArray{4, Datum(), 4, Datum()});
+
+    auto dest_column = ArrayDistinct<PrimitiveType::TYPE_INT>::process(nullptr, {src_column});
+    ASSERT_EQ(4, dest_column->size());
+
+    auto sorted = [](const Datum& datum) {
+        std::vector<int32_t> values;
+        for (const auto& item : datum.get_array()) {
+            values.push_back(item.is_null() ? -1 : item.get_int32());
+        }
+        std::sort(values.begin(), values.end());
+        return values;
+    };
+    ASSERT_EQ((std::vector<int32_t>{3, 5, 6}), sorted(dest_column->get(0)));
+    ASSERT_TRUE(sorted(dest_column->get(1)).empty());
+    ASSERT_TRUE(dest_column->is_null(2));
+    ASSERT_EQ((std::vector<int32_t>{-1, 4}), sorted(dest_column->get(3)));
+}
+
 TEST_F(ArrayFunctionsTest, array_overlap_tinyint_with_nullable) {
     auto src_column = ColumnHelper::create_column(TYPE_ARRAY_TINYINT, true);
     src_column->append_datum(DatumArray{(int8_t)5, (int8_t)3, (int8_t)6});
@@ -5,10 +5,13 @@
 #include <glog/logging.h>
 #include <gtest/gtest.h>
 
+#include <limits>
+
 #include "butil/time.h"
 #include "column/binary_column.h"
 #include "column/column_helper.h"
 #include "column/fixed_length_column.h"
+#include "common/object_pool.h"
 #include "exprs/vectorized/mock_vectorized_expr.h"
 
 namespace starrocks {
@@ -257,5 +260,42 @@ TEST_F(VectorizedInPredicateTest, inConstPred) {
     }
 }
 
+TEST_F(VectorizedInPredicateTest, intInDenseRange) {
+    expr_node.child_type = TPrimitiveType::INT;
+    expr_node.opcode = TExprOpcode::FILTER_IN;
+    expr_node.type = gen_type_desc(TPrimitiveType::INT);
+    expr_node.in_predicate.is_not_in = false;
+
+    auto expr = std::unique_ptr<Expr>(VectorizedInPredicateFactory::from_thrift(expr_node));
+
+    auto column = Int32Column::create();
+    for (int32_t v = -100; v < 100; ++v) {
+        column->append(v);
+    }
+    column->append(std::numeric_limits<int32_t>::min());
+    column->append(std::numeric_limits<int32_t>::max());
+    MockExpr col0(expr_node, column);
+    expr->_children.push_back(&col0);
+
+    // the even values in [-40, 40), dense enough to be looked up in a table
+    ObjectPool pool;
+    for (int32_t v = -40; v < 40; v += 2) {
+        expr->_children.push_back(pool.add(new MockConstVectorizedExpr<TYPE_INT>(expr_node, v)));
+    }
+
+    ASSERT_TRUE(expr->prepare(nullptr, nullptr).ok());
+    ASSERT_TRUE(expr->open(nullptr, nullptr, FunctionContext::FunctionStateScope::THREAD_LOCAL).ok());
+    ColumnPtr ptr = expr->evaluate(nullptr, nullptr);
+    ASSERT_EQ(column->size(), ptr->size());
+
+    auto v = ColumnHelper::cast_to_raw<TYPE_BOOLEAN>(ptr);
+    for (int j = 0; j < 200; ++j) {
+        int32_t value = j - 100;
+        ASSERT_EQ(value >= -40 && value < 40 && value % 2 == 0, v->get_data()[j]) << value;
+    }
+    ASSERT_FALSE(v->get_data()[200]);
+    ASSERT_FALSE(v->get_data()[201]);
+}
+
 } // namespace vectorized
 } // namespace starrocks
@@ -93,6 +93,32 @@ TEST_F(JsonFunctionsTest, get_json_intTest) {
                         .ok());
 }
 
+TEST_F(JsonFunctionsTest, get_json_int_const_path) {
+    std::unique_ptr<FunctionContext> ctx(FunctionContext::create_test_context());
+    Columns columns;
+    auto jsons = BinaryColumn::create();
+    jsons->append("{\"k1\":1, \"k2\":{\"my.key\":[1, 2, 3]}}");
+    jsons->append("{\"k1\":\"v1\"}");
+    jsons->append("{\"k2\":{\"my.key\":[4, 5]}}");
+    auto path = ColumnHelper::create_const_column<TYPE_VARCHAR>(Slice("$.k2.\"my.key\"[1]"), jsons->size());
+
+    columns.emplace_back(jsons);
+    columns.emplace_back(path);
+
+    // the path is parsed once by json_path_prepare
+    ctx.get()->impl()->set_constant_columns(columns);
+    ASSERT_TRUE(JsonFunctions::json_path_prepare(ctx.get(), FunctionContext::FunctionStateScope::FRAGMENT_LOCAL).ok());
+    ASSERT_NE(nullptr, ctx->get_function_state(FunctionContext::FRAGMENT_LOCAL));
+
+    ColumnPtr result = JsonFunctions::get_json_int(ctx.get(), columns);
+    ASSERT_EQ(3, result->size());
+    ASSERT_EQ(2, result->get(0).get_int32());
+    ASSERT_TRUE(result->is_null(1));
+    ASSERT_EQ(5, result->get(2).get_int32());
+
+    ASSERT_TRUE(JsonFunctions::json_path_close(ctx.get(), FunctionContext::FunctionStateScope::FRAGMENT_LOCAL).ok());
+}
+
 TEST_F(JsonFunctionsTest, get_json_doubleTest) {
     std::unique_ptr<FunctionContext> ctx(FunctionContext::create_test_context());
     Columns columns;
@@ -547,5 +547,33 @@ TEST_F(LikeTest, constValueRegexp) {
                         .ok());
 }
 
+TEST_F(LikeTest, multiPatternMatcher) {
+    std::vector<Slice> like_patterns{"abc%", "%x_z"};
+    std::vector<Slice> regex_patterns{"[0-9]{3}"};
+    auto matcher = LikePredicate::MultiPatternMatcher::create(like_patterns, regex_patterns);
+    ASSERT_TRUE(matcher.ok());
+
+    auto str = BinaryColumn::create();
+    auto null = NullColumn::create();
+    std::vector<std::string> values{"abcd", "dabc", "wxyz", "xyzw", "a123", "a12", "", "abc"};
+    for (const auto& value : values) {
+        str->append(value);
+        null->append(0);
+    }
+    str->append("abc");
+    null->append(1);
+
+    auto result = matcher.value()->evaluate(NullableColumn::create(str, null));
+    ASSERT_EQ(values.size() + 1, result->size());
+    std::vector<bool> expects{true, false, true, false, true, false, false, true};
+    for (size_t i = 0; i < expects.size(); ++i) {
+        ASSERT_FALSE(result->is_null(i));
+        ASSERT_EQ(expects[i], result->get(i).get_uint8() != 0);
+    }
+    ASSERT_TRUE(result->is_null(values.size()));
+
+    ASSERT_FALSE(LikePredicate::MultiPatternMatcher::create({}, {"("}).ok());
+}
+
 } // namespace vectorized
 } // namespace starrocks
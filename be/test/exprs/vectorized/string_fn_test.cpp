@@ -1098,6 +1098,25 @@ PARALLEL_TEST(VecStringFunctionsTest, utf8LengthChineseTest) {
     }
 }
 
+PARALLEL_TEST(VecStringFunctionsTest, utf8LengthNullableTest) {
+    std::unique_ptr<FunctionContext> ctx(FunctionContext::create_test_context());
+    for (bool ascii : {true, false}) {
+        Columns columns;
+        auto str = NullableColumn::create(BinaryColumn::create(), NullColumn::create());
+        str->append_datum(Slice("abc"));
+        str->append_nulls(1);
+        str->append_datum(Slice(ascii ? "abcdefghijklmnopqrstuvwxyz0123456789" : "中文abc"));
+        columns.emplace_back(str);
+
+        ColumnPtr result = StringFunctions::utf8_length(ctx.get(), columns);
+        ASSERT_EQ(3, result->size());
+        ASSERT_TRUE(result->is_null(1));
+        auto v = ColumnHelper::cast_to<TYPE_INT>(ColumnHelper::as_column<NullableColumn>(result)->data_column());
+        ASSERT_EQ(3, v->get_data()[0]);
+        ASSERT_EQ(ascii ? 36 : 5, v->get_data()[2]);
+    }
+}
+
 PARALLEL_TEST(VecStringFunctionsTest, upperTest) {
     std::unique_ptr<FunctionContext> ctx(FunctionContext::create_test_context());
     Columns columns;
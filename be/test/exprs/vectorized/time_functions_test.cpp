@@ -1626,6 +1626,48 @@ TEST_F(TimeFunctionsTest, convertTzConstTest) {
                     .ok());
 }
 
+TEST_F(TimeFunctionsTest, convertTzConstDaylightSavingTest) {
+    auto tc = TimestampColumn::create();
+    tc->append(TimestampValue::create(2019, 3, 10, 9, 30, 0));
+    tc->append(TimestampValue::create(2019, 3, 10, 9, 59, 59));
+    tc->append(TimestampValue::create(2019, 3, 10, 10, 0, 0));
+    tc->append(TimestampValue::create(2019, 3, 10, 10, 30, 0));
+    tc->append(TimestampValue::create(2019, 11, 3, 8, 30, 0));
+    tc->append(TimestampValue::create(2019, 11, 3, 9, 30, 0));
+    tc->append(TimestampValue::create(2019, 11, 3, 10, 30, 0));
+
+    auto tc_from = ColumnHelper::create_const_column<TYPE_VARCHAR>("UTC", 1);
+    auto tc_to = ColumnHelper::create_const_column<TYPE_VARCHAR>("America/Los_Angeles", 1);
+
+    TimestampValue res[] = {
+            TimestampValue::create(2019, 3, 10, 1, 30, 0), TimestampValue::create(2019, 3, 10, 1, 59, 59),
+            TimestampValue::create(2019, 3, 10, 3, 0, 0),  TimestampValue::create(2019, 3, 10, 3, 30, 0),
+            TimestampValue::create(2019, 11, 3, 1, 30, 0), TimestampValue::create(2019, 11, 3, 1, 30, 0),
+            TimestampValue::create(2019, 11, 3, 2, 30, 0)};
+    Columns columns;
+    columns.emplace_back(tc);
+    columns.emplace_back(tc_from);
+    columns.emplace_back(tc_to);
+
+    _utils->get_fn_ctx()->impl()->set_constant_columns(columns);
+    _utils->get_fn_ctx()->impl()->_arg_types.emplace_back(FunctionContext::TypeDesc{TYPE_DATETIME});
+    _utils->get_fn_ctx()->impl()->_arg_types.emplace_back(FunctionContext::TypeDesc{TYPE_VARCHAR});
+    _utils->get_fn_ctx()->impl()->_arg_types.emplace_back(FunctionContext::TypeDesc{TYPE_VARCHAR});
+
+    ASSERT_TRUE(
+            TimeFunctions::convert_tz_prepare(_utils->get_fn_ctx(), FunctionContext::FunctionStateScope::FRAGMENT_LOCAL)
+                    .ok());
+
+    ColumnPtr result = TimeFunctions::convert_tz(_utils->get_fn_ctx(), columns);
+
+    auto datetimes = ColumnHelper::cast_to<TYPE_DATETIME>(result);
+    for (int i = 0; i < sizeof(res) / sizeof(res[0]); ++i) ASSERT_EQ(res[i], datetimes->get_data()[i]);
+
+    ASSERT_TRUE(
+            TimeFunctions::convert_tz_close(_utils->get_fn_ctx(), FunctionContext::FunctionStateScope::FRAGMENT_LOCAL)
+                    .ok());
+}
+
 TEST_F(TimeFunctionsTest, utctimestampTest) {
     {
         ColumnPtr ptr = TimeFunctions::utc_timestamp(_utils->get_fn_ctx(), Columns());
@@ -0,0 +1,49 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "formats/csv/csv_reader.h"
+
+#include <gtest/gtest.h>
+
+namespace starrocks::vectorized {
+
+static std::vector<std::string> split(const CSVReader& reader, const std::string& record) {
+    CSVReader::Fields fields;
+    reader.split_record(CSVReader::Record(record), &fields);
+    std::vector<std::string> res;
+    for (const auto& field : fields) {
+        res.emplace_back(field.to_string());
+    }
+    return res;
+}
+
+// NOLINTNEXTLINE
+TEST(CSVReaderTest, test_split_record) {
+    CSVReader reader("\n", ",");
+    EXPECT_EQ(std::vector<std::string>({""}), split(reader, ""));
+    EXPECT_EQ(std::vector<std::string>({"", ""}), split(reader, ","));
+    EXPECT_EQ(std::vector<std::string>({"a", "bc", ""}), split(reader, "a,bc,"));
+
+    // the records longer than a SIMD block, with the separators at the block boundaries.
+    for (size_t num_fields : {1, 7, 16, 33, 100}) {
+        for (size_t field_size : {0, 1, 15, 31, 32, 63}) {
+            std::vector<std::string> expected;
+            std::string record;
+            for (size_t i = 0; i < num_fields; i++) {
+                expected.emplace_back(field_size, static_cast<char>('a' + i % 26));
+                if (i > 0) {
+                    record.push_back(',');
+                }
+                record.append(expected.back());
+            }
+            EXPECT_EQ(expected, split(reader, record)) << num_fields << " fields of " << field_size << " bytes";
+        }
+    }
+}
+
+// NOLINTNEXTLINE
+TEST(CSVReaderTest, test_split_record_multi_bytes_separator) {
+    CSVReader reader("\n", "||");
+    EXPECT_EQ(std::vector<std::string>({"a", "b|c", ""}), split(reader, "a||b|c||"));
+}
+
+} // namespace starrocks::vectorized
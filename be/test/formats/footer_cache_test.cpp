@@ -0,0 +1,25 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "formats/footer_cache.h"
+
+#include <gtest/gtest.h>
+
+namespace starrocks {
+
+TEST(FooterCacheTest, LookupAndInsert) {
+    FooterCache cache(nullptr, 1024 * 1024);
+    std::string key = FooterCache::encode_key("orc", "/path/file", 100, 1);
+    ASSERT_EQ(nullptr, cache.lookup<std::string>(key));
+
+    cache.insert<std::string>(key, std::make_shared<const std::string>("tail"), 4);
+    auto tail = cache.lookup<std::string>(key);
+    ASSERT_NE(nullptr, tail);
+    ASSERT_EQ("tail", *tail);
+
+    // the file is rewritten, or is read in another format
+    ASSERT_EQ(nullptr, cache.lookup<std::string>(FooterCache::encode_key("orc", "/path/file", 100, 2)));
+    ASSERT_EQ(nullptr, cache.lookup<std::string>(FooterCache::encode_key("orc", "/path/file", 101, 1)));
+    ASSERT_EQ(nullptr, cache.lookup<std::string>(FooterCache::encode_key("parquet", "/path/file", 100, 1)));
+}
+
+} // namespace starrocks
@@ -0,0 +1,75 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "formats/parquet/bloom_filter.h"
+
+#include <gtest/gtest.h>
+
+#include "fs/fs.h"
+#include "gen_cpp/parquet_types.h"
+#include "io/string_input_stream.h"
+#include "util/thrift_util.h"
+
+namespace starrocks::parquet {
+
+class ParquetBloomFilterTest : public testing::Test {
+public:
+    ParquetBloomFilterTest() = default;
+    ~ParquetBloomFilterTest() override = default;
+};
+
+TEST_F(ParquetBloomFilterTest, InsertAndTest) {
+    SplitBlockBloomFilter bloom_filter;
+    ASSERT_FALSE(bloom_filter.init(0).ok());
+    ASSERT_FALSE(bloom_filter.init(100).ok());
+    ASSERT_TRUE(bloom_filter.init(1024).ok());
+    ASSERT_EQ(1024, bloom_filter.num_bytes());
+
+    for (int32_t i = 0; i < 100; i++) {
+        bloom_filter.insert_hash(SplitBlockBloomFilter::hash(&i, sizeof(i)));
+    }
+    for (int32_t i = 0; i < 100; i++) {
+        ASSERT_TRUE(bloom_filter.test_hash(SplitBlockBloomFilter::hash(&i, sizeof(i))));
+    }
+    int num_false_positives = 0;
+    for (int32_t i = 100; i < 10100; i++) {
+        num_false_positives += bloom_filter.test_hash(SplitBlockBloomFilter::hash(&i, sizeof(i)));
+    }
+    ASSERT_LT(num_false_positives, 100);
+}
+
+TEST_F(ParquetBloomFilterTest, Read) {
+    SplitBlockBloomFilter expected;
+    ASSERT_TRUE(expected.init(256).ok());
+    std::string value = "starrocks";
+    expected.insert_hash(SplitBlockBloomFilter::hash(value.data(), value.size()));
+
+    // header and bitset follow the magic number
+    std::string buffer = "PAR1";
+    tparquet::BloomFilterHeader header;
+    header.numBytes = 256;
+    header.algorithm.__set_BLOCK(tparquet::SplitBlockAlgorithm());
+    header.hash.__set_XXHASH(tparquet::XxHash());
+    header.compression.__set_UNCOMPRESSED(tparquet::Uncompressed());
+    ThriftSerializer ser(true, 100);
+    uint32_t len = 0;
+    uint8_t* header_ser = nullptr;
+    ser.serialize(&header, &len, &header_ser);
+    buffer.append((char*)header_ser, len);
+    buffer.append((const char*)expected.data(), expected.num_bytes());
+    int64_t file_size = buffer.size();
+
+    RandomAccessFile file(std::make_shared<io::StringInputStream>(std::move(buffer)), "string-file");
+
+    SplitBlockBloomFilter bloom_filter;
+    ASSERT_TRUE(bloom_filter.read(&file, 4, file_size).ok());
+    ASSERT_EQ(256, bloom_filter.num_bytes());
+    ASSERT_EQ(0, memcmp(expected.data(), bloom_filter.data(), 256));
+    ASSERT_TRUE(bloom_filter.test_hash(SplitBlockBloomFilter::hash(value.data(), value.size())));
+
+    // bitset exceeds the file
+    SplitBlockBloomFilter truncated;
+    ASSERT_FALSE(truncated.read(&file, 4, file_size - 1).ok());
+    ASSERT_FALSE(truncated.read(&file, file_size, file_size).ok());
+}
+
+} // namespace starrocks::parquet
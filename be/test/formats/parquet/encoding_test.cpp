@@ -361,4 +361,160 @@ TEST_F(ParquetEncodingTest, Boolean) {
     }
 }
 
+TEST_F(ParquetEncodingTest, Skip) {
+    std::vector<int32_t> values;
+    for (int i = 0; i < 20; i++) {
+        values.push_back(i);
+    }
+
+    const EncodingInfo* plain_encoding = nullptr;
+    EncodingInfo::get(tparquet::Type::INT32, tparquet::Encoding::PLAIN, &plain_encoding);
+    ASSERT_TRUE(plain_encoding != nullptr);
+    std::unique_ptr<Encoder> plain_encoder;
+    auto st = plain_encoding->create_encoder(&plain_encoder);
+    ASSERT_TRUE(st.ok());
+    st = plain_encoder->append(reinterpret_cast<uint8_t*>(&values[0]), 20);
+    ASSERT_TRUE(st.ok());
+    // plain
+    {
+        std::unique_ptr<Decoder> decoder;
+        st = plain_encoding->create_decoder(&decoder);
+        ASSERT_TRUE(st.ok());
+        decoder->set_data(plain_encoder->build());
+
+        ASSERT_TRUE(decoder->skip(5).ok());
+        auto column = vectorized::FixedLengthColumn<int32_t>::create();
+        ASSERT_TRUE(decoder->next_batch(5, ColumnContentType::VALUE, column.get()).ok());
+        ASSERT_TRUE(decoder->skip(5).ok());
+        ASSERT_TRUE(decoder->next_batch(5, ColumnContentType::VALUE, column.get()).ok());
+        ASSERT_FALSE(decoder->skip(1).ok());
+
+        ASSERT_EQ(10, column->size());
+        for (int i = 0; i < 5; i++) {
+            ASSERT_EQ(5 + i, column->get_data()[i]);
+            ASSERT_EQ(15 + i, column->get_data()[5 + i]);
+        }
+    }
+
+    const EncodingInfo* dict_encoding = nullptr;
+    EncodingInfo::get(tparquet::Type::INT32, tparquet::Encoding::RLE_DICTIONARY, &dict_encoding);
+    ASSERT_TRUE(dict_encoding != nullptr);
+    // dict
+    {
+        std::unique_ptr<Decoder> decoder;
+        st = dict_encoding->create_decoder(&decoder);
+        ASSERT_TRUE(st.ok());
+
+        std::unique_ptr<Encoder> encoder;
+        st = dict_encoding->create_encoder(&encoder);
+        ASSERT_TRUE(st.ok());
+        st = encoder->append(reinterpret_cast<uint8_t*>(&values[0]), 20);
+        ASSERT_TRUE(st.ok());
+
+        std::unique_ptr<Encoder> dict_encoder;
+        st = plain_encoding->create_encoder(&dict_encoder);
+        ASSERT_TRUE(st.ok());
+        size_t num_dicts = 0;
+        st = encoder->encode_dict(dict_encoder.get(), &num_dicts);
+        ASSERT_TRUE(st.ok());
+
+        std::unique_ptr<Decoder> dict_decoder;
+        st = plain_encoding->create_decoder(&dict_decoder);
+        ASSERT_TRUE(st.ok());
+        dict_decoder->set_data(dict_encoder->build());
+        // the indexes are skipped in batches of the chunk size
+        st = decoder->set_dict(4, num_dicts, dict_decoder.get());
+        ASSERT_TRUE(st.ok());
+        decoder->set_data(encoder->build());
+
+        ASSERT_TRUE(decoder->skip(7).ok());
+        auto column = vectorized::FixedLengthColumn<int32_t>::create();
+        ASSERT_TRUE(decoder->next_batch(3, ColumnContentType::VALUE, column.get()).ok());
+        ASSERT_TRUE(decoder->skip(6).ok());
+        ASSERT_TRUE(decoder->next_batch(4, ColumnContentType::VALUE, column.get()).ok());
+
+        ASSERT_EQ(7, column->size());
+        for (int i = 0; i < 3; i++) {
+            ASSERT_EQ(7 + i, column->get_data()[i]);
+        }
+        for (int i = 0; i < 4; i++) {
+            ASSERT_EQ(16 + i, column->get_data()[3 + i]);
+        }
+    }
+}
+
+TEST_F(ParquetEncodingTest, NextBatchWithNulls) {
+    std::vector<int32_t> values;
+    for (int i = 0; i < 20; i++) {
+        values.push_back(i);
+    }
+    // the 10 values are at the even rows, and the last row is null
+    std::vector<uint8_t> is_nulls(21);
+    for (int i = 0; i < 21; i++) {
+        is_nulls[i] = (i % 2 == 1) || i >= 20;
+    }
+
+    const EncodingInfo* plain_encoding = nullptr;
+    EncodingInfo::get(tparquet::Type::INT32, tparquet::Encoding::PLAIN, &plain_encoding);
+    ASSERT_TRUE(plain_encoding != nullptr);
+    std::unique_ptr<Encoder> plain_encoder;
+    ASSERT_TRUE(plain_encoding->create_encoder(&plain_encoder).ok());
+    ASSERT_TRUE(plain_encoder->append(reinterpret_cast<uint8_t*>(&values[0]), 10).ok());
+
+    auto check = [&](const vectorized::NullableColumn& column) {
+        ASSERT_EQ(21, column.size());
+        ASSERT_TRUE(column.has_null());
+        const auto* data = reinterpret_cast<const int32_t*>(column.data_column()->raw_data());
+        for (int i = 0; i < 21; i++) {
+            ASSERT_EQ(is_nulls[i], column.is_null(i));
+            if (!is_nulls[i]) {
+                ASSERT_EQ(i / 2, data[i]);
+            }
+        }
+    };
+
+    // plain
+    {
+        std::unique_ptr<Decoder> decoder;
+        ASSERT_TRUE(plain_encoding->create_decoder(&decoder).ok());
+        decoder->set_data(plain_encoder->build());
+
+        auto column = vectorized::NullableColumn::create(vectorized::Int32Column::create(),
+                                                         vectorized::NullColumn::create());
+        ASSERT_TRUE(decoder->next_batch_with_nulls(21, is_nulls.data(), ColumnContentType::VALUE, column.get()).ok());
+        check(*column);
+        // out-of-bounds access
+        ASSERT_FALSE(decoder->next_batch_with_nulls(2, is_nulls.data(), ColumnContentType::VALUE, column.get()).ok());
+    }
+
+    // dict
+    {
+        const EncodingInfo* dict_encoding = nullptr;
+        EncodingInfo::get(tparquet::Type::INT32, tparquet::Encoding::RLE_DICTIONARY, &dict_encoding);
+        ASSERT_TRUE(dict_encoding != nullptr);
+        std::unique_ptr<Decoder> decoder;
+        ASSERT_TRUE(dict_encoding->create_decoder(&decoder).ok());
+
+        std::unique_ptr<Encoder> encoder;
+        ASSERT_TRUE(dict_encoding->create_encoder(&encoder).ok());
+        ASSERT_TRUE(encoder->append(reinterpret_cast<uint8_t*>(&values[0]), 10).ok());
+
+        std::unique_ptr<Encoder> dict_encoder;
+        ASSERT_TRUE(plain_encoding->create_encoder(&dict_encoder).ok());
+        size_t num_dicts = 0;
+        ASSERT_TRUE(encoder->encode_dict(dict_encoder.get(), &num_dicts).ok());
+
+        std::unique_ptr<Decoder> dict_decoder;
+        ASSERT_TRUE(plain_encoding->create_decoder(&dict_decoder).ok());
+        dict_decoder->set_data(dict_encoder->build());
+        ASSERT_TRUE(decoder->set_dict(config::vector_chunk_size, num_dicts, dict_decoder.get()).ok());
+        decoder->set_data(encoder->build());
+
+        auto column = vectorized::NullableColumn::create(vectorized::Int32Column::create(),
+                                                         vectorized::NullColumn::create());
+        ASSERT_TRUE(decoder->next_batch_with_nulls(21, is_nulls.data(), ColumnContentType::VALUE, column.get()).ok());
+        check(*column);
+    }
+}
+
 } // namespace starrocks::parquet
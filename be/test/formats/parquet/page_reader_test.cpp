@@ -82,4 +82,44 @@ TEST_F(ParquetPageReaderTest, Normal) {
     ASSERT_FALSE(st.ok());
 }
 
+TEST_F(ParquetPageReaderTest, SkipBytes) {
+    std::string buffer;
+    for (int32_t page_size : {100, 200}) {
+        tparquet::PageHeader page_header;
+        page_header.type = tparquet::PageType::DATA_PAGE;
+        page_header.uncompressed_page_size = page_size;
+        page_header.compressed_page_size = page_size;
+
+        ThriftSerializer ser(true, 100);
+        uint32_t len = 0;
+        uint8_t* header_ser = nullptr;
+        ser.serialize(&page_header, &len, &header_ser);
+        buffer.append((char*)header_ser, len);
+
+        buffer.resize(buffer.size() + page_header.compressed_page_size);
+    }
+
+    size_t total_size = buffer.size();
+
+    RandomAccessFile file(std::make_shared<io::StringInputStream>(std::move(buffer)), "string-file");
+
+    PageReader reader(&file, 0, total_size);
+
+    // skip page 1 without reading it
+    ASSERT_TRUE(reader.next_header().ok());
+    ASSERT_EQ(100, reader.current_header()->compressed_page_size);
+    ASSERT_FALSE(reader.skip_bytes(101).ok());
+    ASSERT_TRUE(reader.skip_bytes(100).ok());
+
+    // read page 2 after skipping
+    ASSERT_TRUE(reader.next_header().ok());
+    ASSERT_EQ(200, reader.current_header()->compressed_page_size);
+    const uint8_t* data;
+    ASSERT_TRUE(reader.skip_bytes(50).ok());
+    ASSERT_TRUE(reader.read_bytes(&data, 150).ok());
+
+    auto st = reader.next_header();
+    ASSERT_TRUE(st.is_end_of_file());
+}
+
 } // namespace starrocks::parquet
@@ -0,0 +1,67 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "formats/parquet/shared_buffered_input_stream.h"
+
+#include <gtest/gtest.h>
+
+#include "exec/vectorized/hdfs_scanner.h"
+#include "io/string_input_stream.h"
+#include "testutil/assert.h"
+
+namespace starrocks::parquet {
+
+class SharedBufferedInputStreamTest : public testing::Test {
+public:
+    SharedBufferedInputStreamTest() = default;
+    ~SharedBufferedInputStreamTest() override = default;
+
+protected:
+    static std::string make_contents(size_t size) {
+        std::string contents;
+        for (size_t i = 0; i < size; i++) {
+            contents.push_back(static_cast<char>('a' + i % 26));
+        }
+        return contents;
+    }
+};
+
+TEST_F(SharedBufferedInputStreamTest, CoalesceRanges) {
+    std::string contents = make_contents(1000);
+    auto file = std::make_shared<io::StringInputStream>(contents);
+    vectorized::HdfsScanStats stats;
+    SharedBufferedInputStream stream(file, 10, 200, &stats);
+
+    // [0, 50) and [55, 100) are merged, [300, 400) is too far, and [500, 800) is too large
+    ASSERT_TRUE(stream.set_io_ranges({{300, 100}, {55, 45}, {0, 50}, {500, 300}}).ok());
+    ASSERT_EQ(2, stats.shared_io_count);
+    ASSERT_EQ(200, stats.shared_io_bytes);
+
+    char buf[300];
+    // served by the shared buffers
+    ASSERT_TRUE(stream.read_at_fully(40, buf, 30).ok());
+    ASSERT_EQ(contents.substr(40, 30), std::string(buf, 30));
+    ASSIGN_OR_ABORT(auto nread, stream.read_at(350, buf, 50));
+    ASSERT_EQ(50, nread);
+    ASSERT_EQ(contents.substr(350, 50), std::string(buf, 50));
+    // served by the underlying stream
+    ASSERT_TRUE(stream.read_at_fully(500, buf, 300).ok());
+    ASSERT_EQ(contents.substr(500, 300), std::string(buf, 300));
+    ASSERT_TRUE(stream.read_at_fully(390, buf, 20).ok());
+    ASSERT_EQ(contents.substr(390, 20), std::string(buf, 20));
+
+    // read by position
+    ASSERT_TRUE(stream.seek(95).ok());
+    ASSIGN_OR_ABORT(nread, stream.read(buf, 10));
+    ASSERT_EQ(10, nread);
+    ASSERT_EQ(contents.substr(95, 10), std::string(buf, 10));
+    ASSERT_EQ(105, *stream.position());
+    ASSERT_EQ(1000, *stream.get_size());
+
+    // the buffers are released by the next ranges
+    ASSERT_TRUE(stream.set_io_ranges({}).ok());
+    ASSERT_EQ(2, stats.shared_io_count);
+    ASSERT_TRUE(stream.read_at_fully(0, buf, 50).ok());
+    ASSERT_EQ(contents.substr(0, 50), std::string(buf, 50));
+}
+
+} // namespace starrocks::parquet
@@ -23,6 +23,7 @@
 
 #include <algorithm>
 
+#include "common/config.h"
 #include "common/logging.h"
 #include "fs/fs.h"
 #include "fs/fs_util.h"
@@ -186,4 +187,31 @@ TEST_F(PosixFileSystemTest, create_dir_recursive) {
     ASSERT_TRUE(FileSystem::Default()->path_exists(dir_path).is_not_found());
 }
 
+TEST_F(PosixFileSystemTest, direct_io_write) {
+    const std::string fname = "./ut_dir/fs_posix/direct_io_write";
+    const std::string old_paths = config::direct_io_write_storage_paths;
+    config::direct_io_write_storage_paths = "./ut_dir/fs_posix";
+
+    // more than one aligned buffer with an unaligned tail.
+    std::string content;
+    for (int i = 0; i < 3 * 1024 * 1024 + 100; i++) {
+        content.push_back(static_cast<char>(i % 251));
+    }
+    auto fs = FileSystem::Default();
+    WritableFileOptions opts{.sync_on_close = true, .mode = FileSystem::MUST_CREATE, .direct_io = true};
+    ASSIGN_OR_ABORT(auto wfile, fs->new_writable_file(opts, fname));
+    ASSERT_OK(wfile->pre_allocate(4 * 1024 * 1024));
+    Slice slices[2]{Slice(content.data(), 1000), Slice(content.data() + 1000, content.size() - 1000)};
+    ASSERT_OK(wfile->appendv(slices, 2));
+    ASSERT_EQ(content.size(), wfile->size());
+    ASSERT_OK(wfile->close());
+    config::direct_io_write_storage_paths = old_paths;
+
+    ASSERT_EQ(content.size(), *fs->get_file_size(fname));
+    ASSIGN_OR_ABORT(auto rfile, fs->new_random_access_file(fname));
+    std::string buf(content.size(), '\0');
+    ASSERT_OK(rfile->read_at_fully(0, buf.data(), buf.size()));
+    ASSERT_EQ(content, buf);
+}
+
 } // namespace starrocks
@@ -23,6 +23,7 @@
 #include "geo/geo_types.h"
 #include "geo/wkt_parse.h"
 #include "geo/wkt_parse_ctx.h"
+#include "gutil/casts.h"
 #include "s2/s2debug.h"
 
 namespace starrocks {
@@ -153,6 +154,25 @@ TEST_F(GeoTypesTest, polygon_parse_fail) {
     }
 }
 
+TEST_F(GeoTypesTest, polygon_contains_with_covering) {
+    const char* wkt = "POLYGON ((10 10, 50 10, 50 50, 30 20, 10 50, 10 10))";
+    GeoParseStatus status;
+    std::unique_ptr<GeoShape> polygon(GeoShape::from_wkt(wkt, strlen(wkt), &status));
+    ASSERT_NE(nullptr, polygon.get());
+    std::unique_ptr<GeoShape> covered(GeoShape::from_wkt(wkt, strlen(wkt), &status));
+    ASSERT_NE(nullptr, covered.get());
+    down_cast<GeoPolygon*>(covered.get())->build_covering();
+
+    // the covering only rejects points, so the results are the same as the exact test
+    for (int x = 0; x <= 60; x += 3) {
+        for (int y = 0; y <= 60; y += 3) {
+            GeoPoint point;
+            point.from_coord(x + 0.5, y + 0.5);
+            ASSERT_EQ(polygon->contains(&point), covered->contains(&point)) << x << "," << y;
+        }
+    }
+}
+
 TEST_F(GeoTypesTest, polygon_hole_contains) {
     const char* wkt = "POLYGON ((10 10, 50 10, 50 50, 10 50, 10 10), (20 20, 40 20, 40 40, 20 40, 20 20))";
     GeoParseStatus status;
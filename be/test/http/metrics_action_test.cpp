@@ -71,6 +71,28 @@ TEST_F(MetricsActionTest, prometheus_output) {
     action.handle(&request);
 }
 
+TEST_F(MetricsActionTest, prometheus_histogram) {
+    MetricRegistry registry("test");
+    HistogramMetric latency(MetricUnit::MICROSECONDS);
+    latency.observe(3);
+    latency.observe(150);
+    registry.register_metric("latency_us", MetricLabels().add("type", "put"), &latency);
+    std::string expected = "# TYPE test_latency_us histogram\n";
+    const int64_t* bounds = HistogramMetric::bounds();
+    for (int i = 0; i < HistogramMetric::kNumBounds; i++) {
+        int64_t cumulative = (bounds[i] >= 3) + (bounds[i] >= 150);
+        expected += "test_latency_us_bucket{type=\"put\",le=\"" + std::to_string(bounds[i]) + "\"} " +
+                    std::to_string(cumulative) + "\n";
+    }
+    expected += "test_latency_us_bucket{type=\"put\",le=\"+Inf\"} 2\n";
+    expected += "test_latency_us_sum{type=\"put\"} 153\n";
+    expected += "test_latency_us_count{type=\"put\"} 2\n";
+    s_expect_response = expected.c_str();
+    HttpRequest request(_evhttp_req);
+    MetricsAction action(&registry);
+    action.handle(&request);
+}
+
 TEST_F(MetricsActionTest, prometheus_no_prefix) {
     MetricRegistry registry("");
     IntGauge cpu_idle(MetricUnit::PERCENT);
@@ -0,0 +1,124 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "io/block_cache.h"
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+
+#include "io/cache_input_stream.h"
+#include "io/string_input_stream.h"
+#include "testutil/assert.h"
+
+namespace starrocks::io {
+
+class CountedStringInputStream final : public SeekableInputStreamWrapper {
+public:
+    explicit CountedStringInputStream(std::string contents)
+            : SeekableInputStreamWrapper(&_stream, kDontTakeOwnership), _stream(std::move(contents)) {}
+
+    Status read_at_fully(int64_t offset, void* out, int64_t count) override {
+        _read_count++;
+        return _stream.read_at_fully(offset, out, count);
+    }
+
+    int64_t read_count() const { return _read_count; }
+
+private:
+    StringInputStream _stream;
+    int64_t _read_count = 0;
+};
+
+class BlockCacheTest : public ::testing::Test {
+protected:
+    void SetUp() override { _disk_path = std::filesystem::temp_directory_path() / "block_cache_test"; }
+
+    void TearDown() override { std::filesystem::remove_all(_disk_path); }
+
+    std::string _disk_path;
+};
+
+TEST_F(BlockCacheTest, MemCache) {
+    BlockCacheOptions options;
+    options.mem_capacity = 1024 * 1024;
+    options.block_size = 16;
+    BlockCache cache(options);
+    ASSERT_OK(cache.init());
+
+    std::string key1 = BlockCache::encode_key("file", 1, 0);
+    std::string key2 = BlockCache::encode_key("file", 2, 0);
+    ASSERT_EQ(nullptr, cache.lookup(key1));
+    cache.insert(key1, std::make_shared<std::string>("block"));
+    auto block = cache.lookup(key1);
+    ASSERT_NE(nullptr, block);
+    ASSERT_EQ("block", *block);
+    // another version of the file
+    ASSERT_EQ(nullptr, cache.lookup(key2));
+}
+
+TEST_F(BlockCacheTest, DiskCache) {
+    BlockCacheOptions options;
+    options.disk_path = _disk_path;
+    options.disk_capacity = 32 * 1024;
+    options.block_size = 16;
+    BlockCache cache(options);
+    ASSERT_OK(cache.init());
+
+    std::string key = BlockCache::encode_key("file", 1, 3);
+    cache.insert(key, std::make_shared<std::string>("block"));
+    cache.wait_for_populating();
+    auto block = cache.lookup(key);
+    ASSERT_NE(nullptr, block);
+    ASSERT_EQ("block", *block);
+
+    // the blocks least recently used are evicted out of the capacity
+    for (int i = 0; i < 500; i++) {
+        cache.insert(BlockCache::encode_key("file", 1, 100 + i), std::make_shared<std::string>(256, 'a'));
+        cache.wait_for_populating();
+    }
+    cache.wait_for_populating();
+    ASSERT_EQ(nullptr, cache.lookup(key));
+    size_t num_files = std::distance(std::filesystem::directory_iterator(_disk_path), {});
+    ASSERT_LT(num_files, 500);
+}
+
+TEST_F(BlockCacheTest, CacheInputStream) {
+    BlockCacheOptions options;
+    options.mem_capacity = 1024 * 1024;
+    options.block_size = 16;
+    BlockCache cache(options);
+    ASSERT_OK(cache.init());
+
+    std::string contents;
+    for (int i = 0; i < 100; i++) {
+        contents.push_back(static_cast<char>('a' + i % 26));
+    }
+    auto stream = std::make_shared<CountedStringInputStream>(contents);
+    CacheInputStream cache_stream(stream, &cache, "file", 1, contents.size());
+
+    std::string buf(40, '\0');
+    ASSERT_OK(cache_stream.read_at_fully(10, buf.data(), buf.size()));
+    ASSERT_EQ(contents.substr(10, 40), buf);
+    // blocks 0, 1, 2, 3
+    ASSERT_EQ(4, stream->read_count());
+
+    ASSERT_OK(cache_stream.read_at_fully(20, buf.data(), 20));
+    ASSERT_EQ(contents.substr(20, 20), buf.substr(0, 20));
+    ASSERT_EQ(4, stream->read_count());
+
+    // the last block is shorter than the block size
+    ASSERT_OK(cache_stream.seek(90));
+    ASSIGN_OR_ABORT(auto n, cache_stream.read(buf.data(), buf.size()));
+    ASSERT_EQ(10, n);
+    ASSERT_EQ(contents.substr(90), buf.substr(0, 10));
+    // blocks 5, 6
+    ASSERT_EQ(6, stream->read_count());
+    ASSERT_FALSE(cache_stream.read_at_fully(90, buf.data(), 20).ok());
+
+    ASSIGN_OR_ABORT(auto stats, cache_stream.get_numeric_statistics());
+    ASSERT_EQ(3, stats->size());
+    ASSERT_EQ("BlockCacheHitCount", stats->name(0));
+    ASSERT_EQ(4, stats->value(0));
+}
+
+} // namespace starrocks::io
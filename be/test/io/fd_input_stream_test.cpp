@@ -7,9 +7,13 @@
 #include <sys/stat.h>
 #include <sys/types.h>
 
+#include <atomic>
 #include <cstdlib>
+#include <thread>
+#include <vector>
 
 #include "common/logging.h"
+#include "io/io_profiler.h"
 #include "testutil/assert.h"
 #include "testutil/parallel_test.h"
 
@@ -166,7 +170,76 @@ PARALLEL_TEST(FdInputStreamTest, test_op_after_close) {
     res = in.get_size();
     ASSERT_ERROR(res.status());
 
+    ASSERT_ERROR(in.prefetch(0, 10));
+
     ASSERT_ERROR(in.close());
 }
 
+// NOLINTNEXTLINE
+PARALLEL_TEST(FdInputStreamTest, test_prefetch) {
+    int fd = open_temp_file();
+    pwrite_or_die(fd, "0123456789", 10, 0);
+
+    FdInputStream in(fd);
+    in.set_close_on_delete(true);
+    ASSERT_OK(in.prefetch(2, 5));
+    // the range beyond the end of the file is ignored by the kernel.
+    ASSERT_OK(in.prefetch(5, 100));
+    ASSERT_ERROR(in.prefetch(-1, 5));
+    ASSERT_EQ(0, *in.position());
+
+    char buff[5];
+    ASSERT_EQ(5, *in.read_at(2, buff, 5));
+    ASSERT_EQ("23456", std::string(buff, 5));
+}
+
+// NOLINTNEXTLINE
+PARALLEL_TEST(FdInputStreamTest, test_concurrent_read_at) {
+    int fd = open_temp_file();
+    std::string content;
+    for (int i = 0; i < 4096; i++) {
+        content.push_back(static_cast<char>('a' + i % 26));
+    }
+    pwrite_or_die(fd, content.data(), content.size(), 0);
+
+    FdInputStream in(fd);
+    in.set_close_on_delete(true);
+    std::vector<std::thread> threads;
+    std::atomic<int> failures{0};
+    for (int t = 0; t < 4; t++) {
+        threads.emplace_back([&, t]() {
+            char buff[64];
+            for (int i = 0; i < 1000; i++) {
+                int64_t offset = (t * 1000 + i) % (content.size() - sizeof(buff));
+                if (!in.read_at_fully(offset, buff, sizeof(buff)).ok() ||
+                    content.compare(offset, sizeof(buff), buff, sizeof(buff)) != 0) {
+                    failures++;
+                }
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    ASSERT_EQ(0, failures.load());
+}
+
+// NOLINTNEXTLINE
+PARALLEL_TEST(FdInputStreamTest, test_read_is_profiled) {
+    int fd = open_temp_file();
+    pwrite_or_die(fd, "0123456789", 10, 0);
+
+    FdInputStream in(fd);
+    in.set_close_on_delete(true);
+    const IOStats start = IOProfiler::thread_stats();
+    char buff[10];
+    ASSERT_EQ(4, *in.read_at(6, buff, 10));
+    ASSERT_EQ(6, *in.read_at(0, buff, 6));
+
+    IOStats stats = IOProfiler::thread_stats() - start;
+    ASSERT_EQ(2, stats.read_count[IO_TIER_LOCAL_DISK]);
+    ASSERT_EQ(10, stats.read_bytes[IO_TIER_LOCAL_DISK]);
+    ASSERT_EQ(0, stats.read_count[IO_TIER_REMOTE]);
+}
+
 } // namespace starrocks::io
@@ -0,0 +1,59 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "io/io_profiler.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+namespace starrocks::io {
+
+TEST(IOProfilerTest, test_record_read) {
+    const IOStats start = IOProfiler::thread_stats();
+    IOProfiler::record_read(IO_TIER_LOCAL_DISK, 100, 2000);
+    IOProfiler::record_read(IO_TIER_LOCAL_DISK, 50, 1000);
+    IOProfiler::record_read(IO_TIER_REMOTE, 10, 5000);
+
+    IOStats stats = IOProfiler::thread_stats() - start;
+    ASSERT_EQ(150, stats.read_bytes[IO_TIER_LOCAL_DISK]);
+    ASSERT_EQ(2, stats.read_count[IO_TIER_LOCAL_DISK]);
+    ASSERT_EQ(3000, stats.read_ns[IO_TIER_LOCAL_DISK]);
+    ASSERT_EQ(10, stats.read_bytes[IO_TIER_REMOTE]);
+    ASSERT_EQ(1, stats.read_count[IO_TIER_REMOTE]);
+    ASSERT_EQ(0, stats.read_count[IO_TIER_PAGE_CACHE]);
+    ASSERT_EQ(0, stats.read_count[IO_TIER_BLOCK_CACHE]);
+}
+
+TEST(IOProfilerTest, test_thread_stats_are_per_thread) {
+    const IOStats start = IOProfiler::thread_stats();
+    std::thread t([]() { IOProfiler::record_read(IO_TIER_REMOTE, 100, 1000); });
+    t.join();
+    IOStats stats = IOProfiler::thread_stats() - start;
+    ASSERT_EQ(0, stats.read_count[IO_TIER_REMOTE]);
+    ASSERT_EQ(0, stats.read_bytes[IO_TIER_REMOTE]);
+}
+
+TEST(IOProfilerTest, test_scoped_io_read) {
+    const IOStats start = IOProfiler::thread_stats();
+    {
+        ScopedIORead io_read(IO_TIER_LOCAL_DISK);
+        io_read.set_bytes(10);
+    }
+    {
+        // the failed read without the bytes is not recorded
+        ScopedIORead io_read(IO_TIER_LOCAL_DISK);
+    }
+    IOStats stats = IOProfiler::thread_stats() - start;
+    ASSERT_EQ(1, stats.read_count[IO_TIER_LOCAL_DISK]);
+    ASSERT_EQ(10, stats.read_bytes[IO_TIER_LOCAL_DISK]);
+    ASSERT_GE(stats.read_ns[IO_TIER_LOCAL_DISK], 0);
+}
+
+TEST(IOProfilerTest, test_io_tier_name) {
+    ASSERT_STREQ("page_cache", io_tier_name(IO_TIER_PAGE_CACHE));
+    ASSERT_STREQ("local_disk", io_tier_name(IO_TIER_LOCAL_DISK));
+    ASSERT_STREQ("remote", io_tier_name(IO_TIER_REMOTE));
+    ASSERT_STREQ("block_cache", io_tier_name(IO_TIER_BLOCK_CACHE));
+}
+
+} // namespace starrocks::io
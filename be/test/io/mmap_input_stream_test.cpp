@@ -0,0 +1,81 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "io/mmap_input_stream.h"
+
+#include <fcntl.h>
+#include <gtest/gtest.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <cstdlib>
+
+#include "common/logging.h"
+#include "testutil/assert.h"
+#include "testutil/parallel_test.h"
+
+namespace starrocks::io {
+
+static int open_temp_file() {
+    char tmpl[] = "/tmp/mmap_input_stream_testXXXXXX";
+    int fd = ::mkstemp(tmpl);
+    if (fd < 0) {
+        PLOG(FATAL) << "mkstemp() failed";
+    }
+    if (::unlink(tmpl) < 0) {
+        PLOG(FATAL) << "unlink() failed";
+    }
+    return fd;
+}
+
+// NOLINTNEXTLINE
+PARALLEL_TEST(MmapInputStreamTest, test_open_empty) {
+    int fd = open_temp_file();
+    auto st = MmapInputStream::open(fd);
+    ::close(fd);
+    ASSERT_TRUE(st.status().is_not_supported()) << st.status();
+}
+
+// NOLINTNEXTLINE
+PARALLEL_TEST(MmapInputStreamTest, test_read) {
+    int fd = open_temp_file();
+    ASSERT_EQ(10, ::pwrite(fd, "0123456789", 10, 0));
+    ASSIGN_OR_ABORT(auto in, MmapInputStream::open(fd));
+    // the mapping outlives the descriptor.
+    ::close(fd);
+
+    ASSERT_EQ(10, in->size());
+    ASSERT_EQ(10, *in->get_size());
+    ASSERT_EQ("0123456789", std::string(in->data(), in->size()));
+
+    char buff[4];
+    ASSERT_EQ(4, *in->read_at(3, buff, sizeof(buff)));
+    ASSERT_EQ("3456", std::string(buff, 4));
+    ASSERT_EQ(4, *in->read(buff, sizeof(buff)));
+    ASSERT_EQ("0123", std::string(buff, 4));
+    ASSERT_EQ(4, *in->position());
+
+    // the writes into the mapping are private.
+    in->data()[0] = 'x';
+    char c;
+    ASSERT_EQ(1, *in->read_at(0, &c, 1));
+    ASSERT_EQ('x', c);
+}
+
+// NOLINTNEXTLINE
+PARALLEL_TEST(MmapInputStreamTest, test_advise) {
+    int fd = open_temp_file();
+    ASSERT_EQ(10, ::pwrite(fd, "0123456789", 10, 0));
+    ASSIGN_OR_ABORT(auto in, MmapInputStream::open(fd));
+    ::close(fd);
+
+    ASSERT_OK(in->advise(3, 7, MADV_WILLNEED));
+    ASSERT_OK(in->advise(0, 0, MADV_SEQUENTIAL));
+    ASSERT_FALSE(in->advise(5, 6, MADV_WILLNEED).ok());
+    ASSERT_FALSE(in->advise(-1, 2, MADV_WILLNEED).ok());
+
+    // the prefetched range is clamped by the end of the file.
+    ASSERT_OK(in->prefetch(5, 100));
+    ASSERT_OK(in->prefetch(20, 5));
+}
+
+} // namespace starrocks::io
@@ -195,4 +195,16 @@ TEST_F(S3InputStreamTest, test_read_at) {
     ASSERT_FALSE(f->read_at(-1, buf, sizeof(buf)).ok());
 }
 
+TEST_F(S3InputStreamTest, test_read_at_fully_by_parts) {
+    auto f = new_random_access_file();
+    auto part_size = config::object_storage_download_part_size;
+    config::object_storage_download_part_size = 3;
+    char buf[8];
+    ASSERT_OK(f->read_at_fully(1, buf, sizeof(buf)));
+    ASSERT_EQ("12345678", std::string_view(buf, sizeof(buf)));
+    ASSERT_EQ(9, *f->position());
+    ASSERT_FALSE(f->read_at_fully(3, buf, sizeof(buf)).ok());
+    config::object_storage_download_part_size = part_size;
+}
+
 } // namespace starrocks::io
@@ -141,6 +141,29 @@ TEST_F(S3OutputStreamTest, test_multipart_upload) {
     delete_object(kObjectName);
 }
 
+TEST_F(S3OutputStreamTest, test_parallel_multipart_upload) {
+    const char* kObjectName = "test_parallel_multipart_upload";
+    delete_object(kObjectName);
+    const int64_t part_size = /*5MB=*/5 * 1024 * 1024;
+    S3OutputStream os(g_s3client, kBucketName, kObjectName, 12, part_size);
+    S3InputStream is(g_s3client, kBucketName, kObjectName);
+
+    // the parts are uploaded concurrently, and assembled in order.
+    std::string contents;
+    for (int i = 0; i < 4; i++) {
+        std::string part(i < 3 ? part_size : 100, static_cast<char>('a' + i));
+        ASSERT_OK(os.write(part.data(), part.size()));
+        contents.append(part);
+    }
+    ASSERT_OK(os.close());
+
+    std::string buff(contents.size(), '\0');
+    ASSERT_OK(is.read_at_fully(0, buff.data(), buff.size()));
+    ASSERT_EQ(contents, buff);
+
+    delete_object(kObjectName);
+}
+
 TEST_F(S3OutputStreamTest, test_skip) {
     char buff[32];
     const char* kObjectName = "test_multipart_upload";
@@ -0,0 +1,116 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "runtime/alloc_sampler.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "runtime/current_thread.h"
+#include "runtime/mem_tracker.h"
+
+namespace starrocks {
+
+class AllocSamplerTest : public testing::Test {
+public:
+    static void SetUpTestCase() {
+        // Every allocation is sampled with the interval of 1 byte, and the weight is its size.
+        ASSERT_TRUE(AllocSampler::instance()->start(1, 1024).ok());
+    }
+
+    static void TearDownTestCase() { AllocSampler::instance()->stop(); }
+
+protected:
+    // The addresses are never dereferenced.
+    static void* _fake_ptr(uintptr_t i) { return reinterpret_cast<void*>((i + 1) << 16); }
+
+    // The first sampled allocation of each thread only draws the distance.
+    static void _init_thread() {
+        AllocSampler::instance()->record_alloc(_fake_ptr(1 << 20), 1);
+        AllocSampler::on_free(_fake_ptr(1 << 20));
+    }
+};
+
+TEST_F(AllocSamplerTest, invalid_args) {
+    ASSERT_FALSE(AllocSampler::instance()->start(0, 1024).ok());
+    ASSERT_FALSE(AllocSampler::instance()->start(1, 0).ok());
+}
+
+TEST_F(AllocSamplerTest, record_and_free) {
+    auto* sampler = AllocSampler::instance();
+    _init_thread();
+    MemTracker process(-1, "process");
+    MemTracker query_pool(-1, "query_pool", &process);
+    MemTracker query(-1, "query_1", &query_pool);
+    {
+        CurrentThreadMemTrackerSetter setter(&query);
+        sampler->record_alloc(_fake_ptr(1), 1000);
+        sampler->record_alloc(_fake_ptr(2), 2000);
+    }
+    {
+        CurrentThreadMemTrackerSetter setter(&query_pool);
+        sampler->record_alloc(_fake_ptr(3), 3000);
+    }
+    ASSERT_EQ(3, sampler->num_live_samples());
+
+    auto samples = sampler->get_live_samples();
+    ASSERT_EQ(3, samples.size());
+    int64_t total_size = 0;
+    for (const auto& sample : samples) {
+        ASSERT_STREQ("query_pool", sample.subsystem);
+        ASSERT_GE(sample.weight, sample.size);
+        ASSERT_GT(sample.depth, 0);
+        total_size += sample.size;
+    }
+    ASSERT_EQ(6000, total_size);
+
+    auto breakdown = AllocSampler::to_tracker_breakdown(samples);
+    ASSERT_NE(std::string::npos, breakdown.find("query_pool: ")) << breakdown;
+    ASSERT_NE(std::string::npos, breakdown.find("    query_1: ")) << breakdown;
+    auto top = AllocSampler::to_top_sites(samples, 1);
+    ASSERT_NE(std::string::npos, top.find("Live samples: 3")) << top;
+    auto collapsed = AllocSampler::to_collapsed_stacks(samples);
+    ASSERT_EQ(0, collapsed.find("query_pool;")) << collapsed;
+
+    AllocSampler::on_free(_fake_ptr(2));
+    // Not sampled.
+    AllocSampler::on_free(_fake_ptr(4));
+    ASSERT_EQ(2, sampler->num_live_samples());
+    AllocSampler::on_free(_fake_ptr(1));
+    AllocSampler::on_free(_fake_ptr(3));
+    ASSERT_EQ(0, sampler->num_live_samples());
+    ASSERT_TRUE(sampler->get_live_samples().empty());
+}
+
+TEST_F(AllocSamplerTest, multi_thread) {
+    auto* sampler = AllocSampler::instance();
+    constexpr int kNumThreads = 4;
+    constexpr int kNumAllocs = 100;
+    const int64_t num_dropped = sampler->num_dropped_samples();
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kNumThreads; t++) {
+        threads.emplace_back([t, sampler]() {
+            _init_thread();
+            for (int i = 0; i < kNumAllocs; i++) {
+                sampler->record_alloc(_fake_ptr(t * kNumAllocs + i), 64);
+                if (i % 2 == 0) {
+                    AllocSampler::on_free(_fake_ptr(t * kNumAllocs + i));
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    // The samples beyond the probes are dropped, which is unlikely.
+    ASSERT_LE(sampler->num_live_samples(), kNumThreads * kNumAllocs / 2);
+    ASSERT_GE(sampler->num_live_samples() + sampler->num_dropped_samples() - num_dropped, kNumThreads * kNumAllocs / 2);
+    for (int i = 0; i < kNumThreads * kNumAllocs; i++) {
+        AllocSampler::on_free(_fake_ptr(i));
+    }
+    ASSERT_EQ(0, sampler->num_live_samples());
+}
+
+} // namespace starrocks
@@ -0,0 +1,111 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "runtime/cpu_sampler.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <string>
+
+#include "runtime/current_thread.h"
+#include "util/time.h"
+
+namespace starrocks {
+
+static TUniqueId make_id(int64_t hi, int64_t lo) {
+    TUniqueId id;
+    id.__set_hi(hi);
+    id.__set_lo(lo);
+    return id;
+}
+
+class CpuSamplerTest : public testing::Test {
+public:
+    static void SetUpTestCase() {
+        // Set a query id before starting the sampler, so the timer of this thread isn't created and
+        // the samples are only taken by the tests.
+        tls_thread_status.set_query_id(make_id(0, 1));
+        ASSERT_TRUE(CpuSampler::instance()->start(1, kCapacity).ok());
+    }
+
+    static void TearDownTestCase() {
+        CpuSampler::instance()->stop();
+        tls_thread_status.set_query_id(TUniqueId());
+    }
+
+protected:
+    static constexpr size_t kCapacity = 8;
+
+    void _take_samples(const TUniqueId& query_id, int64_t workgroup_id, const char* operator_name, int num) {
+        tls_thread_status.set_query_id(query_id);
+        tls_thread_status.set_workgroup_id(workgroup_id);
+        CurrentThreadOperatorSetter operator_setter(3, operator_name);
+        for (int i = 0; i < num; i++) {
+            CpuSampler::instance()->take_sample(nullptr);
+        }
+    }
+};
+
+TEST_F(CpuSamplerTest, test_filter) {
+    CpuSampler::Filter since;
+    since.since_ns = MonotonicNanos();
+    _take_samples(make_id(1, 1), 1, "AGGREGATE_BLOCKING_SINK", 2);
+    _take_samples(make_id(1, 2), 2, "HASH_JOIN_PROBE", 3);
+
+    auto* sampler = CpuSampler::instance();
+    ASSERT_EQ(5, sampler->get_samples(since).size());
+
+    CpuSampler::Filter by_query = since;
+    by_query.query_id_hi = 1;
+    by_query.query_id_lo = 1;
+    auto samples = sampler->get_samples(by_query);
+    ASSERT_EQ(2, samples.size());
+    ASSERT_STREQ("AGGREGATE_BLOCKING_SINK", samples[0].operator_name);
+    ASSERT_EQ(3, samples[0].plan_node_id);
+    ASSERT_GT(samples[0].depth, 0);
+
+    CpuSampler::Filter by_workgroup = since;
+    by_workgroup.workgroup_id = 2;
+    samples = sampler->get_samples(by_workgroup);
+    ASSERT_EQ(3, samples.size());
+    ASSERT_EQ(2, samples[0].query_id_lo);
+}
+
+TEST_F(CpuSamplerTest, test_keep_latest_samples) {
+    auto* sampler = CpuSampler::instance();
+    _take_samples(make_id(2, 1), -1, "OLAP_SCAN", kCapacity);
+    _take_samples(make_id(2, 2), -1, "OLAP_SCAN", 3);
+
+    CpuSampler::Filter filter;
+    auto samples = sampler->get_samples(filter);
+    ASSERT_EQ(kCapacity, samples.size());
+    // the oldest 3 samples are overwritten
+    for (size_t i = 0; i < samples.size(); i++) {
+        ASSERT_EQ(i < kCapacity - 3 ? 1 : 2, samples[i].query_id_lo);
+        if (i > 0) {
+            ASSERT_LE(samples[i - 1].timestamp_ns, samples[i].timestamp_ns);
+        }
+    }
+}
+
+TEST_F(CpuSamplerTest, test_aggregate) {
+    CpuSampler::Filter filter;
+    filter.since_ns = MonotonicNanos();
+    _take_samples(make_id(3, 1), -1, "PROJECT", 4);
+    auto samples = CpuSampler::instance()->get_samples(filter);
+    ASSERT_EQ(4, samples.size());
+
+    // the same call site, so all the samples have the same stack
+    std::string collapsed = CpuSampler::to_collapsed_stacks(samples, true);
+    ASSERT_EQ(0, collapsed.find("PROJECT_3;")) << collapsed;
+    ASSERT_NE(std::string::npos, collapsed.find(" 4\n")) << collapsed;
+    collapsed = CpuSampler::to_collapsed_stacks(samples, false);
+    ASSERT_EQ(std::string::npos, collapsed.find("PROJECT_3")) << collapsed;
+
+    std::string top = CpuSampler::to_top_functions(samples, 1);
+    ASSERT_EQ(0, top.find("Total samples: 4\n")) << top;
+    // the header and the top function
+    ASSERT_EQ(3, std::count(top.begin(), top.end(), '\n')) << top;
+}
+
+} // namespace starrocks
@@ -0,0 +1,77 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "runtime/descriptor_tbl_cache.h"
+
+#include <gtest/gtest.h>
+
+#include "runtime/descriptor_helper.h"
+#include "runtime/descriptors.h"
+
+namespace starrocks {
+
+static TDescriptorTable create_desc_tbl(const std::string& column_name) {
+    TDescriptorTableBuilder table_builder;
+    TTupleDescriptorBuilder tuple_builder;
+    tuple_builder.add_slot(TSlotDescriptorBuilder().type(TYPE_INT).column_name(column_name).column_pos(0).build());
+    tuple_builder.build(&table_builder);
+    return table_builder.desc_tbl();
+}
+
+TEST(DescriptorTblCacheTest, test_hit) {
+    DescriptorTblCache cache(4);
+    auto t_desc_tbl = create_desc_tbl("c0");
+
+    DescriptorTbl* tbl1 = nullptr;
+    DescriptorTblCache::Handle handle1;
+    ASSERT_TRUE(cache.get_or_create(t_desc_tbl, 4096, &tbl1, &handle1).ok());
+    ASSERT_NE(nullptr, tbl1);
+    ASSERT_NE(nullptr, tbl1->get_tuple_descriptor(0));
+
+    DescriptorTbl* tbl2 = nullptr;
+    DescriptorTblCache::Handle handle2;
+    ASSERT_TRUE(cache.get_or_create(t_desc_tbl, 4096, &tbl2, &handle2).ok());
+    ASSERT_EQ(tbl1, tbl2);
+    ASSERT_EQ(1, cache.hit_count());
+    ASSERT_EQ(1, cache.miss_count());
+
+    DescriptorTbl* tbl3 = nullptr;
+    DescriptorTblCache::Handle handle3;
+    ASSERT_TRUE(cache.get_or_create(create_desc_tbl("c1"), 4096, &tbl3, &handle3).ok());
+    ASSERT_NE(tbl1, tbl3);
+    ASSERT_EQ(2, cache.size());
+}
+
+TEST(DescriptorTblCacheTest, test_evict) {
+    DescriptorTblCache cache(2);
+
+    DescriptorTbl* evicted_tbl = nullptr;
+    DescriptorTblCache::Handle evicted_handle;
+    ASSERT_TRUE(cache.get_or_create(create_desc_tbl("c0"), 4096, &evicted_tbl, &evicted_handle).ok());
+    for (int i = 1; i <= 2; ++i) {
+        DescriptorTbl* tbl = nullptr;
+        DescriptorTblCache::Handle handle;
+        ASSERT_TRUE(cache.get_or_create(create_desc_tbl("c" + std::to_string(i)), 4096, &tbl, &handle).ok());
+    }
+    ASSERT_EQ(2, cache.size());
+
+    // The evicted DescriptorTbl is still valid, since the handle is alive.
+    ASSERT_EQ("c0", evicted_tbl->get_tuple_descriptor(0)->slots()[0]->col_name());
+
+    DescriptorTbl* tbl = nullptr;
+    DescriptorTblCache::Handle handle;
+    ASSERT_TRUE(cache.get_or_create(create_desc_tbl("c0"), 4096, &tbl, &handle).ok());
+    ASSERT_NE(evicted_tbl, tbl);
+    ASSERT_EQ(0, cache.hit_count());
+}
+
+TEST(DescriptorTblCacheTest, test_is_cacheable) {
+    auto t_desc_tbl = create_desc_tbl("c0");
+    ASSERT_TRUE(DescriptorTblCache::is_cacheable(t_desc_tbl));
+
+    TTableDescriptor t_table_desc;
+    t_table_desc.__set_tableType(TTableType::HDFS_TABLE);
+    t_desc_tbl.tableDescriptors.push_back(t_table_desc);
+    ASSERT_FALSE(DescriptorTblCache::is_cacheable(t_desc_tbl));
+}
+
+} // namespace starrocks
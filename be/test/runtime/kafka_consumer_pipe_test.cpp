@@ -67,4 +67,32 @@ TEST_F(KafkaConsumerPipeTest, append_read) {
     ASSERT_EQ(eof, true);
 }
 
+TEST_F(KafkaConsumerPipeTest, append_json) {
+    KafkaConsumerPipe k_pipe(1024 * 1024, 64 * 1024);
+
+    std::string obj1 = R"({"k1": 1})";
+    std::string obj2 = R"( {"k1": 2})";
+    std::string array = R"([{"k1": 3}])";
+    std::string obj3 = R"({"k1": 4})";
+
+    char row_delimiter = '\n';
+    ASSERT_TRUE(k_pipe.append_json(obj1.c_str(), obj1.length(), row_delimiter).ok());
+    ASSERT_TRUE(k_pipe.append_json(obj2.c_str(), obj2.length(), row_delimiter).ok());
+    ASSERT_TRUE(k_pipe.append_json(array.c_str(), array.length(), row_delimiter).ok());
+    ASSERT_TRUE(k_pipe.append_json(obj3.c_str(), obj3.length(), row_delimiter).ok());
+    ASSERT_TRUE(k_pipe.finish().ok());
+
+    // the consecutive objects are read as one stream of documents.
+    auto read_message = [&]() {
+        auto buf = k_pipe.read();
+        EXPECT_TRUE(buf.ok());
+        EXPECT_GE(buf.value()->capacity, buf.value()->remaining() + simdjson::SIMDJSON_PADDING);
+        return std::string(buf.value()->ptr, buf.value()->remaining());
+    };
+    ASSERT_EQ(obj1 + "\n" + obj2 + "\n", read_message());
+    ASSERT_EQ(array, read_message());
+    ASSERT_EQ(obj3 + "\n", read_message());
+    ASSERT_TRUE(k_pipe.read().status().is_end_of_file());
+}
+
 } // namespace starrocks
@@ -0,0 +1,48 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "runtime/runtime_state.h"
+
+#include <gtest/gtest.h>
+
+namespace starrocks {
+
+// NOLINTNEXTLINE
+TEST(RuntimeStateTest, update_join_statistics) {
+    TQueryGlobals globals;
+    RuntimeState state(globals);
+    ASSERT_TRUE(state.join_statistics().empty());
+
+    // The builder of join node 1.
+    TJoinStatistics build_stats;
+    build_stats.__set_plan_node_id(1);
+    build_stats.__set_build_rows(100);
+    build_stats.__set_build_key_ndv(10);
+    build_stats.__set_probe_rows(1000);
+    build_stats.__set_output_rows(200);
+    state.update_join_statistics(build_stats);
+
+    // A readonly prober of join node 1.
+    TJoinStatistics probe_stats;
+    probe_stats.__set_plan_node_id(1);
+    probe_stats.__set_probe_rows(500);
+    probe_stats.__set_output_rows(50);
+    state.update_join_statistics(probe_stats);
+
+    TJoinStatistics other_stats;
+    other_stats.__set_plan_node_id(2);
+    other_stats.__set_probe_rows(7);
+    state.update_join_statistics(other_stats);
+
+    auto stats = state.join_statistics();
+    ASSERT_EQ(2, stats.size());
+    ASSERT_EQ(1, stats[0].plan_node_id);
+    ASSERT_EQ(100, stats[0].build_rows);
+    ASSERT_EQ(10, stats[0].build_key_ndv);
+    ASSERT_EQ(1500, stats[0].probe_rows);
+    ASSERT_EQ(250, stats[0].output_rows);
+    ASSERT_EQ(2, stats[1].plan_node_id);
+    ASSERT_FALSE(stats[1].__isset.build_rows);
+    ASSERT_EQ(7, stats[1].probe_rows);
+}
+
+} // namespace starrocks
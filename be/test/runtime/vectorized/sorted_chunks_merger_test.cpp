@@ -10,6 +10,7 @@
 #include "exprs/expr_context.h"
 #include "exprs/vectorized/column_ref.h"
 #include "runtime/runtime_state.h"
+#include "testutil/assert.h"
 
 namespace starrocks::vectorized {
 
@@ -303,4 +304,57 @@ TEST_F(SortedChunksMergerTest, three_suppliers) {
     }
 }
 
+TEST_F(SortedChunksMergerTest, long_runs) {
+    // The runs of the suppliers are longer than a chunk, so they are output across the chunks.
+    auto make_chunk = [](const std::vector<std::pair<int32_t, int32_t>>& ranges) {
+        ColumnPtr column = ColumnHelper::create_column(TypeDescriptor(TYPE_INT), false);
+        for (auto [begin, end] : ranges) {
+            for (int32_t v = begin; v < end; ++v) {
+                column->append_datum(v);
+            }
+        }
+        Chunk::SlotHashMap map;
+        map[0] = 0;
+        return std::make_shared<Chunk>(Columns{column}, map);
+    };
+    std::vector<ChunkPtr> chunks = {make_chunk({{0, 1000}, {2000, 2500}}), make_chunk({{1000, 2000}})};
+
+    ChunkSuppliers suppliers;
+    ChunkProbeSuppliers probe_suppliers;
+    ChunkHasSuppliers has_suppliers;
+    for (size_t i = 0; i < chunks.size(); ++i) {
+        auto supplier = [&chunks, i](Chunk** cnk) -> Status {
+            *cnk = chunks[i] != nullptr ? chunks[i]->clone_unique().release() : nullptr;
+            chunks[i] = nullptr;
+            return Status::OK();
+        };
+        suppliers.push_back(supplier);
+        probe_suppliers.push_back([](Chunk** cnk) -> bool { return false; });
+        has_suppliers.push_back([]() -> bool { return false; });
+    }
+
+    ColumnRef expr(TypeDescriptor(TYPE_INT), 0);
+    ExprContext expr_ctx(&expr);
+    std::vector<ExprContext*> sort_exprs = {&expr_ctx};
+    std::vector<bool> is_asc = {true};
+    std::vector<bool> is_null_first = {true};
+    SortedChunksMerger merger(_runtime_state.get(), false);
+    merger.init(suppliers, probe_suppliers, has_suppliers, &sort_exprs, &is_asc, &is_null_first);
+
+    int32_t expected = 0;
+    bool eos = false;
+    while (true) {
+        ChunkPtr page;
+        ASSERT_OK(merger.get_next(&page, &eos));
+        if (eos) {
+            break;
+        }
+        ASSERT_LE(page->num_rows(), _runtime_state->chunk_size());
+        for (size_t i = 0; i < page->num_rows(); ++i) {
+            ASSERT_EQ(expected++, page->get(i).get(0).get_int32());
+        }
+    }
+    ASSERT_EQ(2500, expected);
+}
+
 } // namespace starrocks::vectorized
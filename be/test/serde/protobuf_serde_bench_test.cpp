@@ -0,0 +1,92 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <string>
+
+#include "column/binary_column.h"
+#include "column/chunk.h"
+#include "column/fixed_length_column.h"
+#include "column/nullable_column.h"
+#include "common/logging.h"
+#include "runtime/types.h"
+#include "serde/protobuf_serde.h"
+
+// Run with --benchmark_format=json to get the results in a machine-readable form.
+namespace starrocks::serde {
+
+// A chunk of |num_rows| rows with an INT column, a nullable BIGINT column with 10% nulls and a VARCHAR column
+// of strings of 8 to 32 bytes.
+static vectorized::ChunkPtr make_chunk(size_t num_rows) {
+    std::mt19937 rng(0);
+    std::uniform_int_distribution<int32_t> uniform_int;
+    std::uniform_int_distribution<int> null_dist(0, 9);
+    std::uniform_int_distribution<size_t> length_dist(8, 32);
+
+    auto c0 = vectorized::Int32Column::create();
+    auto c1 = vectorized::NullableColumn::create(vectorized::Int64Column::create(), vectorized::NullColumn::create());
+    auto c2 = vectorized::BinaryColumn::create();
+    for (size_t i = 0; i < num_rows; i++) {
+        c0->append(uniform_int(rng));
+        if (null_dist(rng) == 0) {
+            c1->append_nulls(1);
+        } else {
+            c1->append_datum(vectorized::Datum(static_cast<int64_t>(uniform_int(rng))));
+        }
+        c2->append(Slice(std::string(length_dist(rng), 'a' + i % 26)));
+    }
+
+    auto chunk = std::make_shared<vectorized::Chunk>();
+    chunk->append_column(std::move(c0), 0);
+    chunk->append_column(std::move(c1), 1);
+    chunk->append_column(std::move(c2), 2);
+    return chunk;
+}
+
+static ProtobufChunkMeta make_meta() {
+    ProtobufChunkMeta meta;
+    meta.types = {TypeDescriptor(TYPE_INT), TypeDescriptor(TYPE_BIGINT), TypeDescriptor::create_varchar_type(32)};
+    meta.is_nulls = {false, true, false};
+    meta.is_consts = {false, false, false};
+    for (int i = 0; i < 3; i++) {
+        meta.slot_id_to_index[i] = i;
+    }
+    return meta;
+}
+
+static void BM_protobuf_chunk_serialize(benchmark::State& state) {
+    auto chunk = make_chunk(state.range(0));
+    size_t serialized_size = 0;
+    for (auto _ : state) {
+        auto res = ProtobufChunkSerde::serialize_without_meta(*chunk);
+        CHECK(res.ok());
+        serialized_size = res->serialized_size();
+        benchmark::DoNotOptimize(res);
+    }
+    state.SetItemsProcessed(state.iterations() * chunk->num_rows());
+    state.SetBytesProcessed(state.iterations() * serialized_size);
+}
+
+static void BM_protobuf_chunk_deserialize(benchmark::State& state) {
+    auto chunk = make_chunk(state.range(0));
+    auto res = ProtobufChunkSerde::serialize_without_meta(*chunk);
+    CHECK(res.ok());
+    const std::string& data = res->data();
+    ProtobufChunkMeta meta = make_meta();
+    ProtobufChunkDeserializer deserializer(meta);
+    for (auto _ : state) {
+        auto chunk_or = deserializer.deserialize(data);
+        CHECK(chunk_or.ok());
+        benchmark::DoNotOptimize(chunk_or);
+    }
+    state.SetItemsProcessed(state.iterations() * chunk->num_rows());
+    state.SetBytesProcessed(state.iterations() * res->serialized_size());
+}
+
+BENCHMARK(BM_protobuf_chunk_serialize)->RangeMultiplier(4)->Range(1024, 64 * 1024);
+BENCHMARK(BM_protobuf_chunk_deserialize)->RangeMultiplier(4)->Range(1024, 64 * 1024);
+
+} // namespace starrocks::serde
+
+BENCHMARK_MAIN();
@@ -2,6 +2,7 @@
 
 #include "serde/protobuf_serde.h"
 
+#include <butil/iobuf.h>
 #include <gtest/gtest.h>
 
 #include "column/chunk.h"
@@ -83,4 +84,54 @@ PARALLEL_TEST(ProtobufChunkSerde, test_serde) {
     }
 }
 
+// NOLINTNEXTLINE
+PARALLEL_TEST(ProtobufChunkSerde, test_serde_to_iobuf) {
+    vectorized::Chunk::SlotHashMap slot_map;
+    slot_map[0] = 0;
+    slot_map[1] = 1;
+    auto chunk = std::make_unique<vectorized::Chunk>(make_columns(2), slot_map);
+
+    butil::IOBuf buf;
+    buf.append("prefix");
+    ChunkPB chunk_pb;
+    auto res = serde::ProtobufChunkSerde::serialize_without_meta_to_iobuf(*chunk, &chunk_pb, &buf);
+    ASSERT_TRUE(res.ok()) << res.status();
+    ASSERT_FALSE(chunk_pb.has_data());
+    ASSERT_EQ(res->size, chunk_pb.data_size());
+    ASSERT_EQ(res->size, chunk_pb.serialized_size());
+    ASSERT_EQ(6 + chunk_pb.data_size(), buf.size());
+
+    // The serialized data is the same as serialize_without_meta(), except the unused tail.
+    StatusOr<ChunkPB> expected = serde::ProtobufChunkSerde::serialize_without_meta(*chunk);
+    ASSERT_TRUE(expected.ok()) << expected.status();
+    ASSERT_EQ(expected->data().substr(0, expected->serialized_size()), res->to_string());
+
+    std::string serialized_data;
+    buf.copy_to(&serialized_data, chunk_pb.data_size(), 6);
+
+    serde::ProtobufChunkSerde::serialize_meta(*chunk, &chunk_pb);
+    ASSERT_EQ(2, chunk_pb.is_nulls_size());
+    ASSERT_EQ(4, chunk_pb.slot_id_map_size());
+
+    ProtobufChunkMeta meta;
+    meta.slot_id_to_index[0] = 0;
+    meta.slot_id_to_index[1] = 1;
+    meta.is_nulls.resize(2, false);
+    meta.is_consts.resize(2, false);
+    meta.types.resize(2);
+    meta.types[0] = TypeDescriptor(PrimitiveType::TYPE_INT);
+    meta.types[1] = TypeDescriptor(PrimitiveType::TYPE_INT);
+
+    ProtobufChunkDeserializer deserializer(meta);
+    auto chunk_or = deserializer.deserialize(serialized_data);
+    ASSERT_TRUE(chunk_or.ok()) << chunk_or.status();
+    vectorized::Chunk& new_chunk = *chunk_or;
+    ASSERT_EQ(new_chunk.num_rows(), chunk->num_rows());
+    for (size_t i = 0; i < chunk->columns().size(); ++i) {
+        for (size_t j = 0; j < chunk->columns()[i]->size(); ++j) {
+            ASSERT_EQ(chunk->columns()[i]->get(j).get_int32(), new_chunk.columns()[i]->get(j).get_int32());
+        }
+    }
+}
+
 } // namespace starrocks::serde
@@ -0,0 +1,91 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "simd/filter.h"
+
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace starrocks::vectorized {
+
+// The filters of the given density, with the nonzero values other than 1.
+static std::vector<uint8_t> make_filter(size_t size, double density, std::mt19937* rng) {
+    std::bernoulli_distribution selected(density);
+    std::vector<uint8_t> filter(size);
+    for (size_t i = 0; i < size; i++) {
+        filter[i] = selected(*rng) ? static_cast<uint8_t>(1 + (*rng)() % 255) : 0;
+    }
+    return filter;
+}
+
+template <typename T>
+static void test_filter_range() {
+    std::mt19937 rng(0);
+    for (double density : {0.0, 0.05, 0.5, 0.95, 1.0}) {
+        for (size_t size : {0, 1, 31, 32, 33, 100, 4096}) {
+            for (size_t from : {size_t(0), size / 3}) {
+                auto filter = make_filter(size, density, &rng);
+                std::vector<T> data(size);
+                for (size_t i = 0; i < size; i++) {
+                    data[i] = static_cast<T>(i * 7 + 3);
+                }
+                std::vector<T> expected(data.begin(), data.begin() + from);
+                for (size_t i = from; i < size; i++) {
+                    if (filter[i]) {
+                        expected.push_back(data[i]);
+                    }
+                }
+                size_t result = SIMD::filter_range<T>(filter.data(), data.data(), from, size);
+                ASSERT_EQ(expected.size(), result) << "density=" << density << " size=" << size;
+                data.resize(result);
+                ASSERT_EQ(expected, data) << "density=" << density << " size=" << size;
+            }
+        }
+    }
+}
+
+TEST(SIMDFilterTest, filter_range) {
+    test_filter_range<uint8_t>();
+    test_filter_range<int16_t>();
+    test_filter_range<int32_t>();
+    test_filter_range<int64_t>();
+    test_filter_range<float>();
+    test_filter_range<double>();
+    test_filter_range<__int128>();
+}
+
+TEST(SIMDFilterTest, filter_mask32) {
+    std::vector<uint8_t> filter(32, 0);
+    ASSERT_EQ(0, SIMD::filter_mask32(filter.data()));
+    filter[0] = 1;
+    filter[7] = 128;
+    filter[31] = 255;
+    ASSERT_EQ((1u << 0) | (1u << 7) | (1u << 31), SIMD::filter_mask32(filter.data()));
+    std::fill(filter.begin(), filter.end(), 2);
+    ASSERT_EQ(0xffffffff, SIMD::filter_mask32(filter.data()));
+}
+
+TEST(SIMDFilterTest, for_each_selected) {
+    std::mt19937 rng(0);
+    for (double density : {0.0, 0.5, 1.0}) {
+        auto filter = make_filter(100, density, &rng);
+        std::vector<size_t> expected;
+        for (size_t i = 10; i < filter.size(); i++) {
+            if (filter[i]) {
+                expected.push_back(i);
+            }
+        }
+        std::vector<size_t> selected;
+        SIMD::for_each_selected(
+                filter.data(), 10, filter.size(), [&](size_t i) { selected.push_back(i); },
+                [&](size_t start) {
+                    for (size_t i = start; i < start + SIMD::kFilterBatchSize; i++) {
+                        selected.push_back(i);
+                    }
+                });
+        ASSERT_EQ(expected, selected) << "density=" << density;
+    }
+}
+
+} // namespace starrocks::vectorized
@@ -2,6 +2,7 @@
 
 #include "storage/chunk_helper.h"
 
+#include "column/array_column.h"
 #include "column/binary_column.h"
 #include "column/chunk.h"
 #include "column/column.h"
@@ -11,6 +12,7 @@
 #include "common/object_pool.h"
 #include "gtest/gtest.h"
 #include "runtime/descriptor_helper.h"
+#include "storage/array_type_info.h"
 #include "storage/schema.h"
 #include "util/logging.h"
 
@@ -227,5 +229,26 @@ TEST_F(ChunkHelperTest, NewChunkWithTuple) {
     ASSERT_EQ(chunk->get_column_by_slot_id(8)->get_name(), "binary");
 }
 
+TEST_F(ChunkHelperTest, NewChunkPooledWithArray) {
+    auto array_field = std::make_shared<Field>(0, "c0", get_array_type_info(get_type_info(OLAP_FIELD_TYPE_INT)), true);
+    array_field->add_sub_field(Field(1, "element", get_type_info(OLAP_FIELD_TYPE_INT), true));
+    Schema schema(Fields{array_field});
+
+    for (int round = 0; round < 2; round++) {
+        ChunkUniquePtr chunk(ChunkHelper::new_chunk_pooled(schema, 1024, true));
+        ASSERT_EQ(1, chunk->num_columns());
+        auto* column = chunk->get_column_by_index(0).get();
+        ASSERT_TRUE(column->is_nullable());
+        auto* array = down_cast<ArrayColumn*>(down_cast<NullableColumn*>(column)->data_column().get());
+        // the elements returned to the pool in the first round are reset
+        ASSERT_EQ(0, array->elements_column()->size());
+        ASSERT_TRUE(array->elements_column()->is_nullable());
+
+        column->append_datum(DatumArray{Datum(1), Datum(), Datum(3)});
+        ASSERT_EQ(1, column->size());
+        ASSERT_EQ(3, array->elements_column()->size());
+    }
+}
+
 } // namespace vectorized
 } // namespace starrocks
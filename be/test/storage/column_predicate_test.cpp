@@ -2010,6 +2010,7 @@ TEST(ColumnPredicateTest, zone_map_filter) {
     EXPECT_TRUE(in_90_100->ZMF(Datum(90), Datum(99)));
     EXPECT_FALSE(in_90_100->ZMF(Datum(80), Datum(89)));
     EXPECT_FALSE(in_90_100->ZMF(Datum(101), Datum(110)));
+    EXPECT_FALSE(in_90_100->ZMF(Datum(91), Datum(99)));
 
     EXPECT_TRUE(not_in_90_100->ZMF(Datum(), Datum(100)));
     EXPECT_TRUE(not_in_90_100->ZMF(Datum(100), Datum(110)));
@@ -0,0 +1,81 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "storage/compaction_io_controller.h"
+
+#include <gtest/gtest.h>
+
+#include "common/config.h"
+
+namespace starrocks {
+
+class CompactionIOControllerTest : public testing::Test {
+public:
+    void SetUp() override {
+        _max_rate = config::compaction_io_max_bytes_per_second;
+        _min_rate = config::compaction_io_min_bytes_per_second;
+        _target_latency_us = config::compaction_io_target_latency_us;
+        config::compaction_io_max_bytes_per_second = 1000;
+        config::compaction_io_min_bytes_per_second = 100;
+        config::compaction_io_target_latency_us = 10000;
+    }
+
+    void TearDown() override {
+        config::compaction_io_max_bytes_per_second = _max_rate;
+        config::compaction_io_min_bytes_per_second = _min_rate;
+        config::compaction_io_target_latency_us = _target_latency_us;
+    }
+
+protected:
+    static constexpr int64_t kSecondUs = 1000000;
+
+    int64_t _max_rate = 0;
+    int64_t _min_rate = 0;
+    int64_t _target_latency_us = 0;
+};
+
+TEST_F(CompactionIOControllerTest, test_token_bucket) {
+    CompactionIOController controller("/tmp");
+    ASSERT_EQ(-1, controller.rate());
+
+    // the bucket starts full of the tokens of one second.
+    ASSERT_EQ(0, controller.reserve(600, kSecondUs));
+    ASSERT_EQ(1000, controller.rate());
+    ASSERT_EQ(200 * 1000, controller.reserve(600, kSecondUs));
+    // the waiting reservations are served in turn.
+    ASSERT_EQ(700 * 1000, controller.reserve(500, kSecondUs));
+    ASSERT_EQ(200 * 1000, controller.reserve(0, kSecondUs + 500 * 1000));
+    ASSERT_EQ(0, controller.reserve(200, kSecondUs + 900 * 1000));
+}
+
+TEST_F(CompactionIOControllerTest, test_adjust_rate) {
+    CompactionIOController controller("/tmp");
+    int64_t now_us = kSecondUs;
+    ASSERT_EQ(0, controller.reserve(0, now_us));
+    ASSERT_EQ(1000, controller.rate());
+
+    // the queries wait for their I/Os longer than the target.
+    for (int64_t expected_rate : {500, 250, 125, 100, 100}) {
+        controller.add_foreground_io(2 * 20 * 1000 * 1000, 2);
+        now_us += kSecondUs;
+        controller.reserve(0, now_us);
+        ASSERT_EQ(expected_rate, controller.rate());
+    }
+
+    // the queries are fast or idle.
+    controller.add_foreground_io(2 * 1000 * 1000, 2);
+    now_us += kSecondUs;
+    controller.reserve(0, now_us);
+    ASSERT_EQ(200, controller.rate());
+    for (int i = 0; i < 10; i++) {
+        now_us += kSecondUs;
+        controller.reserve(0, now_us);
+    }
+    ASSERT_EQ(1000, controller.rate());
+
+    // the rate is not adjusted within a second.
+    controller.add_foreground_io(20 * 1000 * 1000, 1);
+    controller.reserve(0, now_us + kSecondUs / 2);
+    ASSERT_EQ(1000, controller.rate());
+}
+
+} // namespace starrocks
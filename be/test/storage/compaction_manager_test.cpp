@@ -72,6 +72,44 @@ TEST(CompactionManagerTest, test_candidates) {
     }
 }
 
+TEST(CompactionManagerTest, test_candidates_by_scan_heat) {
+    std::vector<TabletSharedPtr> tablets;
+    DataDir data_dir("./data_dir");
+    for (int i = 0; i < 2; i++) {
+        TabletSharedPtr tablet = std::make_shared<Tablet>();
+        TabletMetaSharedPtr tablet_meta = std::make_shared<TabletMeta>();
+        tablet_meta->set_tablet_id(i);
+        tablet->set_tablet_meta(tablet_meta);
+        tablet->set_data_dir(&data_dir);
+        std::unique_ptr<CompactionContext> compaction_context = std::make_unique<CompactionContext>();
+        compaction_context->tablet = tablet;
+        compaction_context->cumulative_score = 5;
+        // the tablet 1 is queried, and compacted first.
+        compaction_context->scan_heat_weight = 1 + i;
+        tablet->set_compaction_context(compaction_context);
+        tablets.push_back(tablet);
+    }
+    tablets[1]->add_scan_heat(1024);
+    ASSERT_NEAR(1024, tablets[1]->scan_heat(), 1);
+    ASSERT_EQ(0, tablets[0]->scan_heat());
+
+    for (auto& tablet : tablets) {
+        StorageEngine::instance()->compaction_manager()->update_tablet(tablet, false, false);
+    }
+    ASSERT_EQ(2, StorageEngine::instance()->compaction_manager()->candidates_size());
+    CompactionCandidate candidate = StorageEngine::instance()->compaction_manager()->pick_candidate();
+    ASSERT_EQ(1, candidate.tablet->tablet_id());
+    ASSERT_EQ(10, candidate.tablet->compaction_priority(CUMULATIVE_COMPACTION));
+    ASSERT_EQ(5, candidate.tablet->compaction_score(CUMULATIVE_COMPACTION));
+    candidate = StorageEngine::instance()->compaction_manager()->pick_candidate();
+    ASSERT_EQ(0, candidate.tablet->tablet_id());
+
+    for (auto& tablet : tablets) {
+        std::unique_ptr<CompactionContext> compaction_context;
+        tablet->set_compaction_context(compaction_context);
+    }
+}
+
 class MockCompactionTask : public CompactionTask {
     MockCompactionTask() : CompactionTask(HORIZONTAL_COMPACTION) {}
 
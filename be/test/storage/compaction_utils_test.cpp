@@ -82,6 +82,31 @@ TEST(CompactionUtilsTest, test_split_column_into_groups) {
     ASSERT_EQ(1, column_groups[4].size());
 }
 
+TEST(CompactionUtilsTest, test_split_column_into_groups_by_row_size) {
+    size_t num_columns = 17;
+    size_t num_key_columns = 1;
+    int64_t max_columns_per_group = 5;
+    std::vector<int64_t> column_row_sizes(num_columns, 8);
+    column_row_sizes[10] = 100;
+    std::vector<std::vector<uint32_t>> column_groups;
+    // a group grows over 5 columns up to 64 bytes per row, and the group of the large column stops at 5 columns.
+    CompactionUtils::split_column_into_groups(num_columns, num_key_columns, max_columns_per_group, column_row_sizes,
+                                              64, &column_groups);
+    ASSERT_EQ(4, column_groups.size());
+    ASSERT_EQ(1, column_groups[0].size());
+    ASSERT_EQ(8, column_groups[1].size());
+    ASSERT_EQ(5, column_groups[2].size());
+    ASSERT_EQ(3, column_groups[3].size());
+    ASSERT_EQ(10, column_groups[2][1]);
+
+    // no memory to grow the groups.
+    column_groups.clear();
+    CompactionUtils::split_column_into_groups(num_columns, num_key_columns, max_columns_per_group, column_row_sizes,
+                                              0, &column_groups);
+    ASSERT_EQ(5, column_groups.size());
+    ASSERT_EQ(5, column_groups[1].size());
+}
+
 TEST(CompactionUtilsTest, test_choose_compaction_algorithm) {
     size_t num_columns = 17;
     int64_t max_columns_per_group = 5;
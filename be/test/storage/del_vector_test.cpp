@@ -41,4 +41,32 @@ TEST(DelVector, testLoadSave) {
     ASSERT_EQ(dv2.cardinality(), dels.size());
 };
 
+// NOLINTNEXTLINE
+TEST(DelVector, testConsecutiveDels) {
+    std::vector<uint32_t> dels;
+    for (uint32_t i = 0; i < 60000; i++) {
+        dels.push_back(i);
+    }
+    DelVector dv;
+    dv.init(1, dels.data(), dels.size());
+    ASSERT_EQ(dels.size(), dv.cardinality());
+    // one run container instead of an 8KB bitset container.
+    ASSERT_LT(dv.memory_usage(), 1024);
+    ASSERT_LT(dv.save().size(), 1024);
+
+    std::shared_ptr<DelVector> ndv;
+    dv.add_dels_as_new_version({70000, 70001, 70002}, 2, &ndv);
+    ASSERT_EQ(dels.size() + 3, ndv->cardinality());
+    ASSERT_EQ(2, ndv->version());
+    ASSERT_TRUE(ndv->roaring()->contains(59999));
+    ASSERT_TRUE(ndv->roaring()->contains(70001));
+    ASSERT_FALSE(ndv->roaring()->contains(60000));
+    ASSERT_LT(ndv->memory_usage(), 1024);
+
+    std::string raw = ndv->save();
+    DelVector loaded;
+    ASSERT_TRUE(loaded.load(2, raw.data(), raw.size()).ok());
+    ASSERT_EQ(ndv->cardinality(), loaded.cardinality());
+}
+
 } // namespace starrocks
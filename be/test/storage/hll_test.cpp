@@ -19,6 +19,9 @@
 
 #include <gtest/gtest.h>
 
+#include <string>
+#include <vector>
+
 #include "util/hash_util.hpp"
 #include "util/phmap/phmap.h"
 #include "util/slice.h"
@@ -205,4 +208,72 @@ TEST_F(TestHll, InvalidPtr) {
     }
 }
 
+static std::string serialize(const HyperLogLog& hll) {
+    std::string buf;
+    buf.resize(hll.max_serialized_size());
+    buf.resize(hll.serialize((uint8_t*)buf.data()));
+    return buf;
+}
+
+TEST_F(TestHll, UpdateBatch) {
+    for (size_t num : {0, 1, 10, 160, 161, 1000, 10000}) {
+        std::vector<uint64_t> hash_values;
+        for (size_t i = 0; i < num; ++i) {
+            // Zero hash values and duplicates are mixed in.
+            hash_values.push_back(i % 7 == 0 ? 0 : hash(i % 5000));
+        }
+
+        HyperLogLog expected;
+        for (auto value : hash_values) {
+            if (value != 0) {
+                expected.update(value);
+            }
+        }
+        HyperLogLog hll;
+        hll.update_batch(hash_values.data(), hash_values.size());
+        ASSERT_EQ(serialize(expected), serialize(hll)) << num;
+        ASSERT_EQ(expected.estimate_cardinality(), hll.estimate_cardinality()) << num;
+
+        // Update in several batches.
+        HyperLogLog split_hll;
+        size_t half = num / 2;
+        split_hll.update_batch(hash_values.data(), half);
+        split_hll.update_batch(hash_values.data() + half, num - half);
+        ASSERT_EQ(serialize(expected), serialize(split_hll)) << num;
+    }
+}
+
+TEST_F(TestHll, MergeSerialized) {
+    // empty, explicit, sparse, full
+    std::vector<HyperLogLog> hlls(4);
+    for (int i = 0; i < 10; ++i) {
+        hlls[1].update(hash(i));
+    }
+    for (int i = 0; i < 1000; ++i) {
+        hlls[2].update(hash(i + 100));
+    }
+    for (int i = 0; i < 100000; ++i) {
+        hlls[3].update(hash(i + 200));
+    }
+
+    for (const auto& dst : hlls) {
+        for (const auto& src : hlls) {
+            HyperLogLog expected(dst);
+            expected.merge(src);
+            HyperLogLog actual(dst);
+            std::string buf = serialize(src);
+            actual.merge(Slice(buf));
+            ASSERT_EQ(serialize(expected), serialize(actual));
+            ASSERT_EQ(expected.estimate_cardinality(), actual.estimate_cardinality());
+        }
+    }
+
+    // An invalid slice is merged as an empty HLL.
+    HyperLogLog hll(hlls[1]);
+    uint8_t buf[64] = {60};
+    hll.merge(Slice(buf, 1));
+    hll.merge(Slice((char*)nullptr, 0));
+    ASSERT_EQ(serialize(hlls[1]), serialize(hll));
+}
+
 } // namespace starrocks
@@ -19,6 +19,7 @@
 #include "storage/rowset/rowset_writer_context.h"
 #include "storage/schema.h"
 #include "testutil/assert.h"
+#include "util/defer_op.h"
 
 namespace starrocks::vectorized {
 
@@ -408,4 +409,120 @@ TEST_F(MemTableTest, testPrimaryKeysSizeLimitCompositePK) {
     ASSERT_FALSE(_mem_table->finalize().ok());
 }
 
+TEST_F(MemTableTest, testUniqKeysMergeSortedRuns) {
+    const string path = "./ut_dir/MemTableTest_testUniqKeysMergeSortedRuns";
+    auto write_buffer_size = config::write_buffer_size;
+    // merge the inserted rows into a sorted run on each insert.
+    config::write_buffer_size = 1;
+    DeferOp reset_config([&]() { config::write_buffer_size = write_buffer_size; });
+    MySetUp("pk int,v int", "pk int,v int", 1, KeysType::UNIQUE_KEYS, path);
+
+    const int n = 1000;
+    const int num_batches = 10;
+    std::vector<int> expected(n, -1);
+    for (int batch = 0; batch < num_batches; batch++) {
+        shared_ptr<Chunk> chunk = ChunkHelper::new_chunk(*_slots, n);
+        vector<uint32_t> indexes;
+        for (int i = 0; i < n; i++) {
+            if (rand() % 2 == 0) {
+                continue;
+            }
+            indexes.emplace_back(chunk->num_rows());
+            chunk->get_column_by_index(0)->append_datum(Datum(i));
+            chunk->get_column_by_index(1)->append_datum(Datum(batch));
+            expected[i] = batch;
+        }
+        std::random_shuffle(indexes.begin(), indexes.end());
+        _mem_table->insert(*chunk, indexes.data(), 0, indexes.size());
+    }
+    ASSERT_OK(_mem_table->finalize());
+    ASSERT_OK(_mem_table->flush());
+    RowsetSharedPtr rowset = *_writer->build();
+
+    unique_ptr<Schema> read_schema = create_schema("pk int,v int", 1);
+    OlapReaderStatistics stats;
+    vectorized::RowsetReadOptions rs_opts;
+    rs_opts.sorted = false;
+    rs_opts.use_page_cache = false;
+    rs_opts.stats = &stats;
+    auto itr = rowset->new_iterator(*read_schema, rs_opts);
+    ASSERT_TRUE(itr.ok()) << itr.status().to_string();
+    std::shared_ptr<vectorized::Chunk> chunk = vectorized::ChunkHelper::new_chunk(*read_schema, 4096);
+    std::vector<int> actual(n, -1);
+    int last_pk = -1;
+    while (true) {
+        Status st = (*itr)->get_next(chunk.get());
+        if (st.is_end_of_file()) {
+            break;
+        }
+        ASSERT_OK(st);
+        for (size_t i = 0; i < chunk->num_rows(); i++) {
+            int pk = chunk->get(i)[0].get_int32();
+            ASSERT_LT(last_pk, pk);
+            last_pk = pk;
+            actual[pk] = chunk->get(i)[1].get_int32();
+        }
+        chunk->reset();
+    }
+    ASSERT_EQ(expected, actual);
+}
+
+TEST_F(MemTableTest, testUniqKeysInsertByReference) {
+    const string path = "./ut_dir/MemTableTest_testUniqKeysInsertByReference";
+    MySetUp("pk int,v int", "pk int,v int", 1, KeysType::UNIQUE_KEYS, path);
+
+    const int n = 1000;
+    // the batches referenced and copied alternately, the last one of which wins.
+    std::vector<int> expected(n, -1);
+    for (int batch = 0; batch < 4; batch++) {
+        shared_ptr<Chunk> chunk = ChunkHelper::new_chunk(*_slots, n);
+        vector<uint32_t> indexes;
+        for (int i = 0; i < n; i++) {
+            if (batch > 0 && i % (batch + 1) == 0) {
+                continue;
+            }
+            indexes.emplace_back(chunk->num_rows());
+            chunk->get_column_by_index(0)->append_datum(Datum(i));
+            chunk->get_column_by_index(1)->append_datum(Datum(batch));
+            expected[i] = batch;
+        }
+        std::random_shuffle(indexes.begin(), indexes.end());
+        if (batch % 2 == 0) {
+            _mem_table->insert(chunk, indexes.data(), 0, indexes.size());
+        } else {
+            _mem_table->insert(*chunk, indexes.data(), 0, indexes.size());
+        }
+    }
+    ASSERT_OK(_mem_table->finalize());
+    ASSERT_OK(_mem_table->flush());
+    RowsetSharedPtr rowset = *_writer->build();
+
+    unique_ptr<Schema> read_schema = create_schema("pk int,v int", 1);
+    OlapReaderStatistics stats;
+    vectorized::RowsetReadOptions rs_opts;
+    rs_opts.sorted = false;
+    rs_opts.use_page_cache = false;
+    rs_opts.stats = &stats;
+    auto itr = rowset->new_iterator(*read_schema, rs_opts);
+    ASSERT_TRUE(itr.ok()) << itr.status().to_string();
+    std::shared_ptr<vectorized::Chunk> chunk = vectorized::ChunkHelper::new_chunk(*read_schema, 4096);
+    std::vector<int> actual(n, -1);
+    int last_pk = -1;
+    while (true) {
+        Status st = (*itr)->get_next(chunk.get());
+        if (st.is_end_of_file()) {
+            break;
+        }
+        ASSERT_OK(st);
+        for (size_t i = 0; i < chunk->num_rows(); i++) {
+            int pk = chunk->get(i)[0].get_int32();
+            ASSERT_LT(last_pk, pk);
+            last_pk = pk;
+            actual[pk] = chunk->get(i)[1].get_int32();
+        }
+        chunk->reset();
+    }
+    ASSERT_EQ(expected, actual);
+}
+
 } // namespace starrocks::vectorized
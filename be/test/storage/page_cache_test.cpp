@@ -40,8 +40,8 @@ private:
 TEST_F(StoragePageCacheTest, normal) {
     StoragePageCache cache(_mem_tracker.get(), kNumShards * 2048);
 
-    StoragePageCache::CacheKey key("abc", 0);
-    StoragePageCache::CacheKey memory_key("mem", 0);
+    StoragePageCache::CacheKey key(1, 0);
+    StoragePageCache::CacheKey memory_key(2, 0);
 
     {
         // insert normal page
@@ -72,7 +72,7 @@ TEST_F(StoragePageCacheTest, normal) {
 
     // put too many page to eliminate first page
     for (int i = 0; i < 10 * kNumShards; ++i) {
-        StoragePageCache::CacheKey key("bcd", i);
+        StoragePageCache::CacheKey key(3, i);
         PageCacheHandle handle;
         Slice data(new char[1024], 1024);
         cache.insert(key, data, &handle, false);
@@ -81,7 +81,7 @@ TEST_F(StoragePageCacheTest, normal) {
     // cache miss
     {
         PageCacheHandle handle;
-        StoragePageCache::CacheKey miss_key("abc", 1);
+        StoragePageCache::CacheKey miss_key(1, 1);
         auto found = cache.lookup(miss_key, &handle);
         ASSERT_FALSE(found);
     }
@@ -94,4 +94,25 @@ TEST_F(StoragePageCacheTest, normal) {
     }
 }
 
+// NOLINTNEXTLINE
+TEST_F(StoragePageCacheTest, file_id) {
+    ASSERT_EQ(0u, StoragePageCache::find_file_id("/file_id/a"));
+    uint64_t id = StoragePageCache::acquire_file_id("/file_id/a");
+    ASSERT_NE(0u, id);
+    ASSERT_EQ(id, StoragePageCache::acquire_file_id("/file_id/a"));
+    ASSERT_EQ(id, StoragePageCache::find_file_id("/file_id/a"));
+    ASSERT_NE(id, StoragePageCache::acquire_file_id("/file_id/b"));
+
+    StoragePageCache::release_file_id("/file_id/a");
+    ASSERT_EQ(id, StoragePageCache::find_file_id("/file_id/a"));
+    StoragePageCache::release_file_id("/file_id/a");
+    ASSERT_EQ(0u, StoragePageCache::find_file_id("/file_id/a"));
+    StoragePageCache::release_file_id("/file_id/b");
+
+    // the ids are not reused, so the pages of the released id are not found again
+    uint64_t new_id = StoragePageCache::acquire_file_id("/file_id/a");
+    ASSERT_NE(id, new_id);
+    StoragePageCache::release_file_id("/file_id/a");
+}
+
 } // namespace starrocks
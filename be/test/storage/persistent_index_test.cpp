@@ -4,6 +4,7 @@
 
 #include <gtest/gtest.h>
 
+#include "common/config.h"
 #include "fs/fs_memory.h"
 #include "fs/fs_util.h"
 #include "storage/chunk_helper.h"
@@ -18,6 +19,7 @@
 #include "testutil/assert.h"
 #include "testutil/parallel_test.h"
 #include "util/coding.h"
+#include "util/defer_op.h"
 #include "util/faststring.h"
 
 namespace starrocks {
@@ -243,6 +245,8 @@ PARALLEL_TEST(PersistentIndexTest, test_mutable_flush_to_immutable) {
     }
     ASSERT_TRUE(st_load.ok());
     auto& idx_loaded = st_load.value();
+    // the bloom filters of the shards are loaded
+    ASSERT_GT(idx_loaded->memory_usage(), 0);
     KeysInfo keys_info;
     for (size_t i = 0; i < N; i++) {
         keys_info.key_idxes.emplace_back(i);
@@ -511,4 +515,137 @@ PARALLEL_TEST(PersistentIndexTest, test_replace) {
     ASSERT_TRUE(fs::remove_all(kPersistentIndexDir).ok());
 }
 
+PARALLEL_TEST(PersistentIndexTest, test_multi_level) {
+    FileSystem* fs = FileSystem::Default();
+    const std::string kPersistentIndexDir = "./PersistentIndexTest_test_multi_level";
+    const std::string kIndexFile = "./PersistentIndexTest_test_multi_level/index.l0.0.0";
+    bool created;
+    ASSERT_OK(fs->create_dir_if_missing(kPersistentIndexDir, &created));
+    auto merge_ratio = config::persistent_index_l2_merge_ratio;
+    DeferOp reset_config([&]() { config::persistent_index_l2_merge_ratio = merge_ratio; });
+
+    using Key = uint64_t;
+    PersistentIndexMetaPB index_meta;
+    int N = 1000000;
+    vector<Key> keys(N);
+    vector<IndexValue> values(N);
+    for (int i = 0; i < N; i++) {
+        keys[i] = i;
+        values[i] = i * 2;
+    }
+
+    {
+        ASSIGN_OR_ABORT(auto wfile, FileSystem::Default()->new_writable_file(kIndexFile));
+        ASSERT_OK(wfile->close());
+    }
+    EditVersion version(0, 0);
+    index_meta.set_key_size(sizeof(Key));
+    index_meta.set_size(0);
+    version.to_pb(index_meta.mutable_version());
+    MutableIndexMetaPB* l0_meta = index_meta.mutable_l0_meta();
+    IndexSnapshotMetaPB* snapshot_meta = l0_meta->mutable_snapshot();
+    version.to_pb(snapshot_meta->mutable_version());
+
+    auto check_values = [&](PersistentIndex& index) {
+        std::vector<IndexValue> get_values(N);
+        ASSERT_OK(index.get(N, keys.data(), get_values.data()));
+        for (int i = 0; i < N; i++) {
+            ASSERT_EQ(values[i], get_values[i]);
+        }
+    };
+
+    {
+        PersistentIndex index(kPersistentIndexDir);
+        ASSERT_OK(index.load(index_meta));
+        // flush l0 into l1
+        ASSERT_OK(index.prepare(EditVersion(1, 0)));
+        ASSERT_OK(index.insert(N, keys.data(), values.data(), false));
+        ASSERT_OK(index.commit(&index_meta));
+        ASSERT_OK(index.on_commited());
+        ASSERT_TRUE(index_meta.has_l1_version());
+        ASSERT_FALSE(index_meta.has_l2_version());
+
+        // push l1 down as l2, and flush the deleted keys into l1
+        config::persistent_index_l2_merge_ratio = 1;
+        std::vector<IndexValue> old_values(N / 2, NullIndexValue);
+        ASSERT_OK(index.prepare(EditVersion(2, 0)));
+        ASSERT_OK(index.erase(N / 2, keys.data(), old_values.data()));
+        ASSERT_OK(index.commit(&index_meta));
+        ASSERT_OK(index.on_commited());
+        ASSERT_EQ(EditVersion(2, 0), EditVersion(index_meta.l1_version()));
+        ASSERT_EQ(EditVersion(1, 0), EditVersion(index_meta.l2_version()));
+        for (int i = 0; i < N / 2; i++) {
+            ASSERT_EQ(i * 2, old_values[i]);
+            values[i] = NullIndexValue;
+        }
+        ASSERT_EQ(N / 2, index.size());
+        check_values(index);
+
+        // merge l0 into l1 only, the upserted keys are found in l2
+        std::vector<IndexValue> new_values(N / 2);
+        for (int i = 0; i < N / 2; i++) {
+            new_values[i] = (N / 2 + i) * 3;
+        }
+        old_values.assign(N / 2, NullIndexValue);
+        ASSERT_OK(index.prepare(EditVersion(3, 0)));
+        ASSERT_OK(index.upsert(N / 2, keys.data() + N / 2, new_values.data(), old_values.data()));
+        ASSERT_OK(index.commit(&index_meta));
+        ASSERT_OK(index.on_commited());
+        ASSERT_EQ(EditVersion(3, 0), EditVersion(index_meta.l1_version()));
+        ASSERT_EQ(EditVersion(1, 0), EditVersion(index_meta.l2_version()));
+        for (int i = 0; i < N / 2; i++) {
+            ASSERT_EQ((N / 2 + i) * 2, old_values[i]);
+            values[N / 2 + i] = new_values[i];
+        }
+        ASSERT_EQ(N / 2, index.size());
+        check_values(index);
+    }
+
+    {
+        PersistentIndex index(kPersistentIndexDir);
+        ASSERT_OK(index.load(index_meta));
+        ASSERT_EQ(N / 2, index.size());
+        check_values(index);
+
+        // the keys deleted in l1 are not found in l2, and l1 is merged into l2
+        config::persistent_index_l2_merge_ratio = 10;
+        std::vector<IndexValue> new_values(N / 2);
+        for (int i = 0; i < N / 2; i++) {
+            new_values[i] = i * 4;
+        }
+        std::vector<IndexValue> old_values(N / 2, 0);
+        ASSERT_OK(index.prepare(EditVersion(4, 0)));
+        ASSERT_OK(index.upsert(N / 2, keys.data(), new_values.data(), old_values.data()));
+        ASSERT_OK(index.commit(&index_meta));
+        ASSERT_OK(index.on_commited());
+        ASSERT_FALSE(index_meta.has_l1_version());
+        ASSERT_EQ(EditVersion(4, 0), EditVersion(index_meta.l2_version()));
+        for (int i = 0; i < N / 2; i++) {
+            ASSERT_EQ(NullIndexValue, old_values[i]);
+            values[i] = new_values[i];
+        }
+        ASSERT_EQ(N, index.size());
+        check_values(index);
+
+        // insert the keys not existing in l2
+        vector<Key> new_keys(10);
+        vector<IndexValue> new_keys_values(10);
+        for (int i = 0; i < 10; i++) {
+            new_keys[i] = N + i;
+            new_keys_values[i] = i;
+        }
+        ASSERT_OK(index.prepare(EditVersion(5, 0)));
+        ASSERT_OK(index.insert(10, new_keys.data(), new_keys_values.data(), true));
+        ASSERT_TRUE(index.insert(1, keys.data(), values.data(), true).is_already_exist());
+    }
+
+    {
+        PersistentIndex index(kPersistentIndexDir);
+        ASSERT_OK(index.load(index_meta));
+        ASSERT_EQ(N, index.size());
+        check_values(index);
+    }
+    ASSERT_TRUE(fs::remove_all(kPersistentIndexDir).ok());
+}
+
 } // namespace starrocks
@@ -7,10 +7,12 @@
 #include "column/binary_column.h"
 #include "column/fixed_length_column.h"
 #include "column/schema.h"
+#include "common/config.h"
 #include "gutil/strings/substitute.h"
 #include "storage/chunk_helper.h"
 #include "storage/primary_key_encoder.h"
 #include "testutil/parallel_test.h"
+#include "util/defer_op.h"
 
 using namespace starrocks::vectorized;
 
@@ -255,6 +257,66 @@ PARALLEL_TEST(PrimaryIndexTest, test_varchar) {
     test_binary_pk<OLAP_FIELD_TYPE_VARCHAR>();
 }
 
+static void test_long_varchar_pk(bool compact, size_t* memory_usage) {
+    auto f = std::make_shared<vectorized::Field>(0, "c0", OLAP_FIELD_TYPE_VARCHAR, false);
+    f->set_is_key(true);
+    auto schema = std::make_shared<vectorized::Schema>(Fields{f});
+    bool old_compact = config::enable_compact_primary_index;
+    config::enable_compact_primary_index = compact;
+    DeferOp defer([&]() { config::enable_compact_primary_index = old_compact; });
+    auto pk_index = TEST_create_primary_index(*schema);
+
+    constexpr int kSegmentSize = 40000;
+    const std::string prefix(64, 'k');
+    auto make_keys = [&](int begin, int step) {
+        auto col = BinaryColumn::create();
+        for (int i = 0; i < kSegmentSize; i++) {
+            col->append(strings::Substitute("$0_$1", prefix, begin + i * step));
+        }
+        return col;
+    };
+    auto all_keys = make_keys(0, 1);
+    ASSERT_TRUE(pk_index->insert(0, 0, *all_keys).ok());
+    ASSERT_EQ(kSegmentSize, pk_index->size());
+    *memory_usage = pk_index->memory_usage();
+
+    // erase 3/4 of the keys, which makes the compact index rewrite its key arena.
+    auto erased_keys = BinaryColumn::create();
+    for (int i = 0; i < kSegmentSize; i++) {
+        if (i % 4 != 0) {
+            erased_keys->append(all_keys->get_slice(i));
+        }
+    }
+    PrimaryIndex::DeletesMap deletes;
+    pk_index->erase(*erased_keys, &deletes);
+    ASSERT_EQ(kSegmentSize / 4 * 3, deletes[0].size());
+    ASSERT_EQ(kSegmentSize / 4, pk_index->size());
+
+    // upsert the even keys, some of them are erased above and inserted again.
+    deletes.clear();
+    auto even_keys = make_keys(0, 2);
+    pk_index->upsert(1, 0, *even_keys, &deletes);
+    ASSERT_EQ(kSegmentSize / 4, deletes[0].size());
+
+    std::vector<uint64_t> rowids(kSegmentSize);
+    pk_index->get(*all_keys, &rowids);
+    for (uint32_t i = 0; i < kSegmentSize; i++) {
+        if (i % 2 == 0) {
+            ASSERT_EQ((1UL << 32) + i / 2, rowids[i]);
+        } else {
+            ASSERT_EQ(static_cast<uint64_t>(-1), rowids[i]);
+        }
+    }
+}
+
+PARALLEL_TEST(PrimaryIndexTest, test_long_varchar) {
+    size_t compact_memory_usage = 0;
+    size_t memory_usage = 0;
+    test_long_varchar_pk(true, &compact_memory_usage);
+    test_long_varchar_pk(false, &memory_usage);
+    ASSERT_LT(compact_memory_usage, memory_usage);
+}
+
 PARALLEL_TEST(PrimaryIndexTest, test_composite_key) {
     auto f1 = std::make_shared<vectorized::Field>(0, "c0", OLAP_FIELD_TYPE_TINYINT, false);
     f1->set_is_key(true);
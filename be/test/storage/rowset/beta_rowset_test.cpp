@@ -302,6 +302,86 @@ TEST_F(BetaRowsetTest, FinalMergeTest) {
     }
 }
 
+TEST_F(BetaRowsetTest, FlushOrderedChunksTest) {
+    TabletSchema tablet_schema;
+    create_tablet_schema(&tablet_schema);
+    auto schema = vectorized::ChunkHelper::convert_schema_to_format_v2(tablet_schema);
+
+    // flush the chunks of the rows [begin, begin + 100) as segments.
+    auto build_rowset = [&](const std::vector<int32_t>& begins) {
+        RowsetWriterContext writer_context(kDataFormatV2, kDataFormatV2);
+        create_rowset_writer_context(&tablet_schema, &writer_context);
+        writer_context.segments_overlap = OVERLAPPING;
+        std::unique_ptr<RowsetWriter> rowset_writer;
+        CHECK_OK(RowsetFactory::create_rowset_writer(writer_context, &rowset_writer));
+        for (int32_t begin : begins) {
+            auto chunk = vectorized::ChunkHelper::new_chunk(schema, 100);
+            auto& cols = chunk->columns();
+            for (int32_t i = begin; i < begin + 100; i++) {
+                cols[0]->append_datum(vectorized::Datum(i));
+                cols[1]->append_datum(vectorized::Datum(i));
+                cols[2]->append_datum(vectorized::Datum(i));
+            }
+            CHECK_OK(rowset_writer->flush_chunk(*chunk));
+        }
+        return rowset_writer->build().value();
+    };
+
+    auto rowset = build_rowset({0, 100, 200});
+    ASSERT_EQ(3, rowset->rowset_meta()->num_segments());
+    ASSERT_EQ(NONOVERLAPPING, rowset->rowset_meta()->segments_overlap());
+
+    // the equal keys of the last and first rows of two segments are in the order of duplicate keys.
+    rowset = build_rowset({0, 99});
+    ASSERT_EQ(NONOVERLAPPING, rowset->rowset_meta()->segments_overlap());
+
+    rowset = build_rowset({0, 200, 100});
+    ASSERT_EQ(3, rowset->rowset_meta()->num_segments());
+    ASSERT_EQ(OVERLAPPING, rowset->rowset_meta()->segments_overlap());
+}
+
+TEST_F(BetaRowsetTest, AddRowsetsTest) {
+    TabletSchema tablet_schema;
+    create_tablet_schema(&tablet_schema);
+    auto schema = vectorized::ChunkHelper::convert_schema_to_format_v2(tablet_schema);
+
+    auto build_rowset = [&](int64_t id, int32_t num_segments) {
+        RowsetWriterContext writer_context(kDataFormatV2, kDataFormatV2);
+        create_rowset_writer_context(&tablet_schema, &writer_context);
+        writer_context.rowset_id.init(id);
+        std::unique_ptr<RowsetWriter> rowset_writer;
+        CHECK_OK(RowsetFactory::create_rowset_writer(writer_context, &rowset_writer));
+        for (int32_t seg = 0; seg < num_segments; seg++) {
+            auto chunk = vectorized::ChunkHelper::new_chunk(schema, 100);
+            auto& cols = chunk->columns();
+            for (int32_t i = 0; i < 100; i++) {
+                cols[0]->append_datum(vectorized::Datum(static_cast<int32_t>(id * 1000 + seg * 100 + i)));
+                cols[1]->append_datum(vectorized::Datum(i));
+                cols[2]->append_datum(vectorized::Datum(i));
+            }
+            CHECK_OK(rowset_writer->flush_chunk(*chunk));
+        }
+        return rowset_writer->build().value();
+    };
+    auto rowset1 = build_rowset(10001, 2);
+    auto rowset2 = build_rowset(10002, 1);
+
+    // the segments of the rowsets added are linked after the segments added before.
+    RowsetWriterContext writer_context(kDataFormatV2, kDataFormatV2);
+    create_rowset_writer_context(&tablet_schema, &writer_context);
+    std::unique_ptr<RowsetWriter> rowset_writer;
+    ASSERT_OK(RowsetFactory::create_rowset_writer(writer_context, &rowset_writer));
+    ASSERT_OK(rowset_writer->add_rowset(rowset1));
+    ASSERT_OK(rowset_writer->add_rowset(rowset2));
+    auto rowset = rowset_writer->build().value();
+    ASSERT_EQ(3, rowset->num_segments());
+    ASSERT_EQ(300, rowset->num_rows());
+    for (int seg = 0; seg < 3; seg++) {
+        ASSERT_TRUE(fs::path_exist(BetaRowset::segment_file_path(writer_context.rowset_path_prefix,
+                                                                 writer_context.rowset_id, seg)));
+    }
+}
+
 TEST_F(BetaRowsetTest, VerticalWriteTest) {
     TabletSchema tablet_schema;
     create_tablet_schema(&tablet_schema);
@@ -30,6 +30,7 @@
 #include "storage/rowset/bloom_filter.h"
 #include "storage/rowset/bloom_filter_index_reader.h"
 #include "storage/rowset/bloom_filter_index_writer.h"
+#include "storage/rowset/ngram.h"
 #include "storage/types.h"
 #include "testutil/assert.h"
 
@@ -274,4 +275,65 @@ TEST_F(BloomFilterIndexReaderWriterTest, test_decimal) {
     delete[] val;
 }
 
+TEST_F(BloomFilterIndexReaderWriterTest, test_ngram) {
+    std::vector<std::string> pages[2] = {{"/api/v1/users", "/api/v1/orders"}, {"Mozilla/5.0", "curl/7.68.0", "ab"}};
+    std::string fname = kTestDir + "/bloom_filter_ngram";
+    ColumnIndexMetaPB meta;
+    {
+        ASSIGN_OR_ABORT(auto wfile, _fs->new_writable_file(fname));
+        std::unique_ptr<BloomFilterIndexWriter> writer;
+        ASSERT_OK(BloomFilterIndexWriter::create_ngram(BloomFilterOptions(), 3, &writer));
+        for (auto& values : pages) {
+            std::vector<Slice> slices(values.begin(), values.end());
+            writer->add_values(slices.data(), slices.size());
+            ASSERT_OK(writer->flush());
+        }
+        ASSERT_OK(writer->finish(wfile.get(), &meta));
+        ASSERT_OK(wfile->close());
+    }
+    ASSERT_EQ(NGRAM_BLOOM_FILTER_INDEX, meta.type());
+    ASSERT_EQ(3, meta.ngram_bloom_filter_index().gram_size());
+
+    BloomFilterIndexReader reader;
+    ASSIGN_OR_ABORT(auto loaded, reader.load(_fs.get(), fname, meta.ngram_bloom_filter_index(), true, false));
+    ASSERT_TRUE(loaded);
+    std::unique_ptr<BloomFilterIndexIterator> iter;
+    ASSERT_OK(reader.new_iterator(&iter));
+
+    auto may_match = [](const BloomFilter* bf, const std::string& pattern) {
+        for (const std::string& literal : like_pattern_literals(pattern)) {
+            auto test = [bf](const Slice& gram) { return bf->test_bytes(gram.data, gram.size); };
+            if (!for_each_ngram(literal, 3, test)) {
+                return false;
+            }
+        }
+        return true;
+    };
+    for (int pid = 0; pid < 2; pid++) {
+        std::unique_ptr<BloomFilter> bf;
+        ASSERT_OK(iter->read_bloom_filter(pid, &bf));
+        // all the substrings of the values must be matched
+        for (const std::string& value : pages[pid]) {
+            for (size_t begin = 0; begin < value.size(); begin++) {
+                for (size_t end = begin + 1; end <= value.size(); end++) {
+                    ASSERT_TRUE(may_match(bf.get(), "%" + value.substr(begin, end - begin) + "%"));
+                }
+            }
+        }
+    }
+    std::unique_ptr<BloomFilter> bf;
+    ASSERT_OK(iter->read_bloom_filter(0, &bf));
+    ASSERT_FALSE(may_match(bf.get(), "%Mozilla%"));
+    ASSERT_FALSE(may_match(bf.get(), "%/v1/%/carts%"));
+    // too short to have a gram
+    ASSERT_TRUE(may_match(bf.get(), "%zz%"));
+}
+
+TEST_F(BloomFilterIndexReaderWriterTest, test_like_pattern_literals) {
+    ASSERT_EQ(std::vector<std::string>({"abc"}), like_pattern_literals("%abc%"));
+    ASSERT_EQ(std::vector<std::string>({"a", "bc", "d"}), like_pattern_literals("a_bc%%d"));
+    ASSERT_EQ(std::vector<std::string>({"10%", "off"}), like_pattern_literals("%10\\%%off"));
+    ASSERT_TRUE(like_pattern_literals("%_%").empty());
+}
+
 } // namespace starrocks
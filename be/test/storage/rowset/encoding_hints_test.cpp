@@ -0,0 +1,50 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "storage/rowset/encoding_hints.h"
+
+#include <gtest/gtest.h>
+
+#include "common/config.h"
+#include "util/defer_op.h"
+
+namespace starrocks {
+
+// NOLINTNEXTLINE
+TEST(EncodingHintsTest, test_hint_segments) {
+    auto hint_segments = config::dictionary_encoding_hint_segments;
+    config::dictionary_encoding_hint_segments = 2;
+    DeferOp reset_config([&]() { config::dictionary_encoding_hint_segments = hint_segments; });
+
+    EncodingHints hints;
+    ASSERT_EQ(DEFAULT_ENCODING, hints.get(1));
+    hints.update(1, DEFAULT_ENCODING, DICT_ENCODING);
+    ASSERT_EQ(DEFAULT_ENCODING, hints.get(2));
+
+    // the speculated encoding is used for 2 segments.
+    ASSERT_EQ(DICT_ENCODING, hints.get(1));
+    hints.update(1, DICT_ENCODING, DICT_ENCODING);
+    ASSERT_EQ(DICT_ENCODING, hints.get(1));
+    hints.update(1, DICT_ENCODING, DICT_ENCODING);
+    ASSERT_EQ(DEFAULT_ENCODING, hints.get(1));
+
+    // the dictionary got full in a segment encoded by the hint.
+    hints.update(1, DEFAULT_ENCODING, DICT_ENCODING);
+    ASSERT_EQ(DICT_ENCODING, hints.get(1));
+    hints.update(1, DICT_ENCODING, PLAIN_ENCODING);
+    ASSERT_EQ(PLAIN_ENCODING, hints.get(1));
+    ASSERT_EQ(PLAIN_ENCODING, hints.get(1));
+    ASSERT_EQ(DEFAULT_ENCODING, hints.get(1));
+}
+
+// NOLINTNEXTLINE
+TEST(EncodingHintsTest, test_disabled) {
+    auto hint_segments = config::dictionary_encoding_hint_segments;
+    config::dictionary_encoding_hint_segments = 0;
+    DeferOp reset_config([&]() { config::dictionary_encoding_hint_segments = hint_segments; });
+
+    EncodingHints hints;
+    hints.update(1, DEFAULT_ENCODING, PLAIN_ENCODING);
+    ASSERT_EQ(DEFAULT_ENCODING, hints.get(1));
+}
+
+} // namespace starrocks
@@ -0,0 +1,143 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "fs/fs_memory.h"
+#include "runtime/mem_tracker.h"
+#include "storage/page_cache.h"
+#include "storage/rowset/bitmap_index_reader.h"
+#include "storage/rowset/inverted_index_reader.h"
+#include "storage/rowset/inverted_index_writer.h"
+#include "testutil/assert.h"
+
+namespace starrocks {
+
+class InvertedIndexTest : public testing::Test {
+public:
+    const std::string kTestDir = "/inverted_index_test";
+
+protected:
+    void SetUp() override {
+        StoragePageCache::create_global_cache(&_tracker, 1000000000);
+        _fs = std::make_shared<MemoryFileSystem>();
+        ASSERT_TRUE(_fs->create_dir(kTestDir).ok());
+    }
+    void TearDown() override { StoragePageCache::release_global_cache(); }
+
+    // Write the index of |values|, followed by |null_count| nulls, and open an iterator of it.
+    void write_and_open(const std::vector<std::string>& values, size_t null_count) {
+        std::string file_name = kTestDir + "/index";
+        ColumnIndexMetaPB meta;
+        {
+            ASSIGN_OR_ABORT(auto wfile, _fs->new_writable_file(file_name));
+            std::vector<Slice> slices(values.begin(), values.end());
+            InvertedIndexWriter writer;
+            writer.add_values(slices.data(), slices.size());
+            writer.add_nulls(null_count);
+            ASSERT_OK(writer.finish(wfile.get(), &meta));
+            ASSERT_EQ(INVERTED_INDEX, meta.type());
+            ASSERT_OK(wfile->close());
+        }
+        _reader = std::make_unique<BitmapIndexReader>();
+        ASSIGN_OR_ABORT(auto loaded, _reader->load(_fs.get(), file_name, meta.inverted_index(), true, false));
+        ASSERT_TRUE(loaded);
+        BitmapIndexIterator* bitmap_iter = nullptr;
+        ASSERT_OK(_reader->new_iterator(&bitmap_iter));
+        _iter = std::make_unique<InvertedIndexIterator>(bitmap_iter);
+    }
+
+    void assert_like(const std::string& pattern, const Roaring& expected, bool expected_exact) {
+        Roaring rows;
+        bool exact = false;
+        ASSERT_OK(_iter->read_like(pattern, &rows, &exact));
+        ASSERT_EQ(expected, rows) << pattern;
+        ASSERT_EQ(expected_exact, exact) << pattern;
+    }
+
+    std::shared_ptr<MemoryFileSystem> _fs;
+    MemTracker _tracker;
+    std::unique_ptr<BitmapIndexReader> _reader;
+    std::unique_ptr<InvertedIndexIterator> _iter;
+};
+
+TEST_F(InvertedIndexTest, parse_like_pattern) {
+    using Term = InvertedIndexTerm;
+    std::vector<Term> terms;
+    bool exact = false;
+
+    ASSERT_TRUE(InvertedIndexIterator::parse_like_pattern("%timeout%", &terms, &exact));
+    ASSERT_EQ(std::vector<Term>({Term("timeout", Term::kContains)}), terms);
+    ASSERT_TRUE(exact);
+
+    ASSERT_TRUE(InvertedIndexIterator::parse_like_pattern("%GET /api/%", &terms, &exact));
+    ASSERT_EQ(std::vector<Term>({Term("GET", Term::kSuffix), Term("api", Term::kEqual)}), terms);
+    ASSERT_FALSE(exact);
+
+    ASSERT_TRUE(InvertedIndexIterator::parse_like_pattern("error%", &terms, &exact));
+    ASSERT_EQ(std::vector<Term>({Term("error", Term::kPrefix)}), terms);
+    ASSERT_FALSE(exact);
+
+    ASSERT_TRUE(InvertedIndexIterator::parse_like_pattern("%a_c%", &terms, &exact));
+    ASSERT_EQ(std::vector<Term>({Term("a", Term::kContains), Term("c", Term::kContains)}), terms);
+    ASSERT_FALSE(exact);
+
+    ASSERT_FALSE(InvertedIndexIterator::parse_like_pattern("%", &terms, &exact));
+    ASSERT_FALSE(InvertedIndexIterator::parse_like_pattern("% - %", &terms, &exact));
+    ASSERT_FALSE(InvertedIndexIterator::parse_like_pattern("%100\\%%", &terms, &exact));
+}
+
+TEST_F(InvertedIndexTest, read_like) {
+    std::vector<std::string> values = {
+            "GET /api/v1/users 200",   // 0
+            "POST /api/v1/orders 500", // 1
+            "GET /static/app.js 200",  // 2
+            "connection timeout",      // 3
+            "",                        // 4
+            "timeouts: 3, GET",        // 5
+    };
+    write_and_open(values, 2);
+    ASSERT_TRUE(_iter->has_null_bitmap());
+
+    assert_like("%GET%", Roaring::bitmapOf(3, 0, 2, 5), true);
+    assert_like("%time%", Roaring::bitmapOf(2, 3, 5), true);
+    assert_like("%api%", Roaring::bitmapOf(2, 0, 1), true);
+    assert_like("%404%", Roaring(), true);
+    assert_like("%/api/%", Roaring::bitmapOf(2, 0, 1), false);
+    assert_like("timeout%", Roaring::bitmapOf(2, 3, 5), false);
+    assert_like("%app.js%", Roaring::bitmapOf(1, 2), false);
+    assert_like("%GET /api%", Roaring::bitmapOf(1, 0), false);
+    assert_like("%v1/users 200", Roaring::bitmapOf(1, 0), false);
+
+    Roaring rows;
+    bool exact = false;
+    ASSERT_TRUE(_iter->read_like("%/%", &rows, &exact).is_cancelled());
+}
+
+TEST_F(InvertedIndexTest, many_tokens) {
+    // The dictionary is read by batches.
+    std::vector<std::string> values;
+    for (int i = 0; i < 5000; i++) {
+        values.emplace_back("id" + std::to_string(i) + " key" + std::to_string(i % 7));
+    }
+    write_and_open(values, 0);
+
+    Roaring expected;
+    for (int i = 0; i < 5000; i++) {
+        if (std::to_string(i).find("49") != std::string::npos) {
+            expected.add(i);
+        }
+    }
+    assert_like("%49%", expected, true);
+
+    expected = Roaring();
+    for (int i = 0; i < 5000; i += 7) {
+        expected.add(i);
+    }
+    assert_like("%key0", expected, false);
+}
+
+} // namespace starrocks
@@ -0,0 +1,208 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "column/binary_column.h"
+#include "column/fixed_length_column.h"
+#include "common/logging.h"
+#include "storage/rowset/encoding_info.h"
+#include "storage/rowset/options.h"
+#include "storage/rowset/page_builder.h"
+#include "storage/rowset/page_decoder.h"
+#include "util/slice.h"
+
+// Run with --benchmark_format=json (or --benchmark_out=<file> --benchmark_out_format=json) to get the
+// results in a machine-readable form.
+namespace starrocks {
+
+inline constexpr size_t kNumValues = 1 << 20;
+
+enum Distribution {
+    // 0, 1, 2, ...
+    kSequential = 0,
+    // uniform over the whole domain
+    kUniform = 1,
+    // uniform over 16 distinct values
+    kLowCardinality = 2,
+};
+
+static std::vector<int32_t> gen_int32_values(Distribution distribution, size_t n) {
+    std::vector<int32_t> values(n);
+    std::mt19937 rng(0);
+    switch (distribution) {
+    case kSequential:
+        std::iota(values.begin(), values.end(), 0);
+        break;
+    case kUniform: {
+        std::uniform_int_distribution<int32_t> uniform;
+        std::generate(values.begin(), values.end(), [&]() { return uniform(rng); });
+        break;
+    }
+    case kLowCardinality: {
+        std::uniform_int_distribution<int32_t> uniform(0, 15);
+        std::generate(values.begin(), values.end(), [&]() { return uniform(rng); });
+        break;
+    }
+    }
+    return values;
+}
+
+static std::vector<std::string> gen_string_values(Distribution distribution, size_t n) {
+    std::vector<int32_t> ints = gen_int32_values(distribution, n);
+    std::vector<std::string> values;
+    values.reserve(n);
+    for (int32_t v : ints) {
+        values.emplace_back("value_" + std::to_string(v));
+    }
+    return values;
+}
+
+template <typename T>
+static std::vector<OwnedSlice> encode_pages(const EncodingInfo* encoding_info, const std::vector<T>& values) {
+    PageBuilderOptions options;
+    options.data_page_size = 64 * 1024;
+    PageBuilder* raw_builder = nullptr;
+    CHECK(encoding_info->create_page_builder(options, &raw_builder).ok());
+    std::unique_ptr<PageBuilder> builder(raw_builder);
+
+    std::vector<OwnedSlice> pages;
+    size_t offset = 0;
+    while (offset < values.size()) {
+        size_t added = builder->add(reinterpret_cast<const uint8_t*>(values.data() + offset), values.size() - offset);
+        CHECK_GT(added, 0);
+        offset += added;
+        pages.emplace_back(builder->finish()->build());
+        builder->reset();
+    }
+    return pages;
+}
+
+static size_t pages_size(const std::vector<OwnedSlice>& pages) {
+    size_t size = 0;
+    for (const auto& page : pages) {
+        size += page.slice().size;
+    }
+    return size;
+}
+
+static void decode_pages(const EncodingInfo* encoding_info, const std::vector<OwnedSlice>& pages,
+                         vectorized::Column* column) {
+    PageDecoderOptions options;
+    for (const auto& page : pages) {
+        PageDecoder* raw_decoder = nullptr;
+        CHECK(encoding_info->create_page_decoder(page.slice(), options, &raw_decoder).ok());
+        std::unique_ptr<PageDecoder> decoder(raw_decoder);
+        CHECK(decoder->init().ok());
+        size_t n = decoder->count();
+        CHECK(decoder->next_batch(&n, column).ok());
+    }
+}
+
+static const EncodingInfo* get_encoding_info(FieldType type, int64_t encoding) {
+    const EncodingInfo* encoding_info = nullptr;
+    CHECK(EncodingInfo::get(type, static_cast<EncodingTypePB>(encoding), &encoding_info).ok());
+    return encoding_info;
+}
+
+static void BM_int32_page_encode(benchmark::State& state) {
+    const EncodingInfo* encoding_info = get_encoding_info(OLAP_FIELD_TYPE_INT, state.range(0));
+    auto values = gen_int32_values(static_cast<Distribution>(state.range(1)), kNumValues);
+
+    size_t encoded_size = 0;
+    for (auto _ : state) {
+        auto pages = encode_pages(encoding_info, values);
+        encoded_size = pages_size(pages);
+        benchmark::DoNotOptimize(pages);
+    }
+    state.SetItemsProcessed(state.iterations() * values.size());
+    state.SetBytesProcessed(state.iterations() * values.size() * sizeof(int32_t));
+    state.counters["compression_ratio"] = static_cast<double>(values.size() * sizeof(int32_t)) / encoded_size;
+}
+
+static void BM_int32_page_decode(benchmark::State& state) {
+    const EncodingInfo* encoding_info = get_encoding_info(OLAP_FIELD_TYPE_INT, state.range(0));
+    auto values = gen_int32_values(static_cast<Distribution>(state.range(1)), kNumValues);
+    auto pages = encode_pages(encoding_info, values);
+
+    auto column = vectorized::Int32Column::create();
+    column->reserve(values.size());
+    for (auto _ : state) {
+        column->reset_column();
+        decode_pages(encoding_info, pages, column.get());
+        benchmark::DoNotOptimize(column->raw_data());
+    }
+    CHECK_EQ(values.size(), column->size());
+    state.SetItemsProcessed(state.iterations() * values.size());
+    state.SetBytesProcessed(state.iterations() * values.size() * sizeof(int32_t));
+}
+
+static void int32_page_args(benchmark::internal::Benchmark* b) {
+    for (auto encoding : {PLAIN_ENCODING, BIT_SHUFFLE, FOR_ENCODING, PFOR_ENCODING}) {
+        for (auto distribution : {kSequential, kUniform, kLowCardinality}) {
+            b->Args({encoding, distribution});
+        }
+    }
+    b->ArgNames({"encoding", "distribution"});
+}
+
+BENCHMARK(BM_int32_page_encode)->Apply(int32_page_args);
+BENCHMARK(BM_int32_page_decode)->Apply(int32_page_args);
+
+static void BM_binary_page_encode(benchmark::State& state) {
+    const EncodingInfo* encoding_info = get_encoding_info(OLAP_FIELD_TYPE_VARCHAR, state.range(0));
+    auto strings = gen_string_values(static_cast<Distribution>(state.range(1)), kNumValues);
+    std::vector<Slice> values(strings.begin(), strings.end());
+
+    size_t raw_size = 0;
+    for (const auto& s : strings) {
+        raw_size += s.size();
+    }
+    size_t encoded_size = 0;
+    for (auto _ : state) {
+        auto pages = encode_pages(encoding_info, values);
+        encoded_size = pages_size(pages);
+        benchmark::DoNotOptimize(pages);
+    }
+    state.SetItemsProcessed(state.iterations() * values.size());
+    state.SetBytesProcessed(state.iterations() * raw_size);
+    state.counters["compression_ratio"] = static_cast<double>(raw_size) / encoded_size;
+}
+
+static void BM_binary_page_decode(benchmark::State& state) {
+    const EncodingInfo* encoding_info = get_encoding_info(OLAP_FIELD_TYPE_VARCHAR, state.range(0));
+    auto strings = gen_string_values(static_cast<Distribution>(state.range(1)), kNumValues);
+    std::vector<Slice> values(strings.begin(), strings.end());
+    auto pages = encode_pages(encoding_info, values);
+
+    auto column = vectorized::BinaryColumn::create();
+    for (auto _ : state) {
+        column->reset_column();
+        decode_pages(encoding_info, pages, column.get());
+        benchmark::DoNotOptimize(column->get_bytes().data());
+    }
+    CHECK_EQ(values.size(), column->size());
+    state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+static void binary_page_args(benchmark::internal::Benchmark* b) {
+    for (auto encoding : {PLAIN_ENCODING, PREFIX_ENCODING}) {
+        for (auto distribution : {kSequential, kUniform, kLowCardinality}) {
+            b->Args({encoding, distribution});
+        }
+    }
+    b->ArgNames({"encoding", "distribution"});
+}
+
+BENCHMARK(BM_binary_page_encode)->Apply(binary_page_args);
+BENCHMARK(BM_binary_page_decode)->Apply(binary_page_args);
+
+} // namespace starrocks
+
+BENCHMARK_MAIN();
@@ -0,0 +1,140 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "storage/rowset/pfor_page.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <random>
+
+#include "column/fixed_length_column.h"
+#include "storage/range.h"
+#include "testutil/assert.h"
+
+namespace starrocks {
+
+class PForPageTest : public testing::Test {
+public:
+    template <FieldType Type>
+    void test_encode_decode(const std::vector<typename TypeTraits<Type>::CppType>& src) {
+        using CppType = typename TypeTraits<Type>::CppType;
+        PageBuilderOptions builder_options;
+        builder_options.data_page_size = 256 * 1024;
+        PForPageBuilder<Type> builder(builder_options);
+        ASSERT_EQ(src.size(), builder.add(reinterpret_cast<const uint8_t*>(src.data()), src.size()));
+        OwnedSlice s = builder.finish()->build();
+        ASSERT_EQ(src.size(), builder.count());
+
+        if (!src.empty()) {
+            CppType first;
+            CppType last;
+            ASSERT_OK(builder.get_first_value(&first));
+            ASSERT_OK(builder.get_last_value(&last));
+            ASSERT_EQ(src.front(), first);
+            ASSERT_EQ(src.back(), last);
+        }
+
+        PageDecoderOptions decoder_options;
+        PForPageDecoder<Type> decoder(s.slice(), decoder_options);
+        ASSERT_OK(decoder.init());
+        ASSERT_EQ(src.size(), decoder.count());
+        ASSERT_EQ(0, decoder.current_index());
+
+        // Read all the values by batches.
+        auto column = vectorized::FixedLengthColumn<CppType>::create();
+        size_t n = 100;
+        while (decoder.current_index() < decoder.count()) {
+            size_t to_read = n;
+            ASSERT_OK(decoder.next_batch(&to_read, column.get()));
+            ASSERT_GT(to_read, 0);
+        }
+        ASSERT_EQ(src, column->get_data());
+
+        // Read the sparse ranges.
+        if (src.size() > 300) {
+            vectorized::SparseRange range;
+            range.add(vectorized::Range(1, 129));
+            range.add(vectorized::Range(200, 300));
+            range.add(vectorized::Range(src.size() - 10, src.size()));
+            column->reset_column();
+            ASSERT_OK(decoder.seek_to_position_in_page(1));
+            ASSERT_OK(decoder.next_batch(range, column.get()));
+            ASSERT_EQ(range.span_size(), column->size());
+            size_t i = 0;
+            for (size_t r = 0; r < range.size(); r++) {
+                for (size_t row = range[r].begin(); row < range[r].end(); row++) {
+                    ASSERT_EQ(src[row], column->get_data()[i++]);
+                }
+            }
+        }
+
+        // Seek and read one value.
+        for (int i = 0; i < 100 && !src.empty(); i++) {
+            size_t pos = random() % src.size();
+            ASSERT_OK(decoder.seek_to_position_in_page(pos));
+            column->reset_column();
+            size_t one = 1;
+            ASSERT_OK(decoder.next_batch(&one, column.get()));
+            ASSERT_EQ(1, one);
+            ASSERT_EQ(src[pos], column->get_data()[0]);
+        }
+    }
+};
+
+TEST_F(PForPageTest, empty) {
+    test_encode_decode<OLAP_FIELD_TYPE_INT>({});
+}
+
+TEST_F(PForPageTest, int_with_outliers) {
+    std::mt19937 rng(42);
+    std::vector<int32_t> src;
+    for (int i = 0; i < 10000; i++) {
+        src.push_back(i % 37 == 0 ? static_cast<int32_t>(rng()) : static_cast<int32_t>(rng() % 1000) - 500);
+    }
+    test_encode_decode<OLAP_FIELD_TYPE_INT>(src);
+}
+
+TEST_F(PForPageTest, bigint) {
+    std::mt19937_64 rng(42);
+    std::vector<int64_t> src;
+    for (int i = 0; i < 10001; i++) {
+        switch (i % 3) {
+        case 0:
+            src.push_back(static_cast<int64_t>(rng()));
+            break;
+        case 1:
+            src.push_back(std::numeric_limits<int64_t>::min());
+            break;
+        default:
+            src.push_back(i);
+        }
+    }
+    test_encode_decode<OLAP_FIELD_TYPE_BIGINT>(src);
+}
+
+TEST_F(PForPageTest, small_integers) {
+    std::vector<int8_t> tinyints;
+    std::vector<int16_t> smallints;
+    for (int i = 0; i < 1000; i++) {
+        tinyints.push_back(static_cast<int8_t>(i % 7 == 0 ? -128 : i % 5));
+        smallints.push_back(static_cast<int16_t>(i * 31));
+    }
+    test_encode_decode<OLAP_FIELD_TYPE_TINYINT>(tinyints);
+    test_encode_decode<OLAP_FIELD_TYPE_SMALLINT>(smallints);
+}
+
+TEST_F(PForPageTest, outliers_are_patched) {
+    std::vector<int64_t> src;
+    for (int i = 0; i < 1024; i++) {
+        src.push_back(i % 100 == 0 ? (1LL << 50) : i % 16);
+    }
+    PageBuilderOptions builder_options;
+    builder_options.data_page_size = 256 * 1024;
+    PForPageBuilder<OLAP_FIELD_TYPE_BIGINT> builder(builder_options);
+    builder.add(reinterpret_cast<const uint8_t*>(src.data()), src.size());
+    // Most of the values take 4 bits, and the outliers don't widen their blocks.
+    ASSERT_LT(builder.finish()->size(), src.size());
+    test_encode_decode<OLAP_FIELD_TYPE_BIGINT>(src);
+}
+
+} // namespace starrocks
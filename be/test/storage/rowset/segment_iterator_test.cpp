@@ -10,6 +10,7 @@
 #include "fs/fs_memory.h"
 #include "gtest/gtest.h"
 #include "storage/chunk_helper.h"
+#include "storage/decoded_column_cache.h"
 #include "storage/olap_common.h"
 #include "storage/rowset/column_iterator.h"
 #include "storage/rowset/segment.h"
@@ -304,4 +305,227 @@ TEST_F(SegmentIteratorTest, TestGlobalDictNoLocalDict) {
     res_chunk->reset();
 }
 
+TEST_F(SegmentIteratorTest, TestDecodedColumnCache) {
+    TabletSchema tablet_schema = create_schema({create_int_key(1), create_int_value(2)});
+
+    SegmentWriterOptions opts;
+    opts.num_rows_per_block = 100;
+
+    std::string file_name = kSegmentDir + "/decoded_column_cache";
+    ASSIGN_OR_ABORT(auto wfile, _fs->new_writable_file(file_name));
+
+    SegmentWriter writer(std::move(wfile), 0, &tablet_schema, opts);
+    ASSERT_OK(writer.init());
+
+    const int32_t num_rows = 2000;
+    auto schema = vectorized::ChunkHelper::convert_schema_to_format_v2(tablet_schema);
+    auto chunk = vectorized::ChunkHelper::new_chunk(schema, num_rows);
+    for (int32_t i = 0; i < num_rows; i++) {
+        chunk->get_column_by_index(0)->append_datum(vectorized::Datum(i));
+        chunk->get_column_by_index(1)->append_datum(vectorized::Datum(i * 10));
+    }
+    ASSERT_OK(writer.append_chunk(*chunk));
+    uint64_t file_size = 0;
+    uint64_t index_size;
+    uint64_t footer_position;
+    ASSERT_OK(writer.finalize(&file_size, &index_size, &footer_position));
+
+    auto segment = *Segment::open(_tablet_meta_mem_tracker.get(), _fs, file_name, 0, &tablet_schema);
+    ASSERT_EQ(segment->num_rows(), num_rows);
+
+    DecodedColumnCache::create_global_cache(_page_cache_mem_tracker.get(), 1000000000);
+    DeferOp defer([]() { DecodedColumnCache::release_global_cache(); });
+    auto* cache = DecodedColumnCache::instance();
+
+    ObjectPool pool;
+    auto* pred = pool.add(vectorized::new_column_lt_predicate(get_type_info(OLAP_FIELD_TYPE_INT), 0, "500"));
+    // The first scan fills the cache, and the second one reads the cached columns.
+    for (int round = 0; round < 2; round++) {
+        for (bool with_predicate : {false, true}) {
+            vectorized::SegmentReadOptions seg_opts;
+            OlapReaderStatistics stats;
+            seg_opts.fs = _fs;
+            seg_opts.stats = &stats;
+            if (with_predicate) {
+                seg_opts.predicates[0].push_back(pred);
+            }
+            auto chunk_iter = new_segment_iterator(segment, schema, seg_opts);
+            int32_t count = 0;
+            while (true) {
+                chunk->reset();
+                auto st = chunk_iter->get_next(chunk.get());
+                if (st.is_end_of_file()) {
+                    break;
+                }
+                ASSERT_OK(st);
+                for (size_t i = 0; i < chunk->num_rows(); i++, count++) {
+                    ASSERT_EQ(count, chunk->get(i)[0].get_int32());
+                    ASSERT_EQ(count * 10, chunk->get(i)[1].get_int32());
+                }
+            }
+            chunk_iter->close();
+            ASSERT_EQ(with_predicate ? 500 : num_rows, count);
+        }
+        for (ColumnId cid : {0, 1}) {
+            auto column = cache->lookup(DecodedColumnCache::encode_key(file_name, cid, true));
+            ASSERT_TRUE(column != nullptr);
+            ASSERT_EQ(num_rows, column->size());
+        }
+    }
+    ASSERT_GT(cache->memory_usage(), 0);
+
+    // The segments of more rows are not cached.
+    auto max_segment_rows = config::decoded_column_cache_max_segment_rows;
+    config::decoded_column_cache_max_segment_rows = num_rows - 1;
+    DeferOp reset_config([&]() { config::decoded_column_cache_max_segment_rows = max_segment_rows; });
+    DecodedColumnCache::release_global_cache();
+    DecodedColumnCache::create_global_cache(_page_cache_mem_tracker.get(), 1000000000);
+    vectorized::SegmentReadOptions seg_opts;
+    OlapReaderStatistics stats;
+    seg_opts.fs = _fs;
+    seg_opts.stats = &stats;
+    auto chunk_iter = new_segment_iterator(segment, schema, seg_opts);
+    chunk->reset();
+    ASSERT_OK(chunk_iter->get_next(chunk.get()));
+    chunk_iter->close();
+    ASSERT_TRUE(DecodedColumnCache::instance()->lookup(DecodedColumnCache::encode_key(file_name, 0, true)) ==
+                nullptr);
+}
+
+
+TEST_F(SegmentIteratorTest, TestPredicateColumnCascade) {
+    TabletSchema tablet_schema = create_schema({create_int_key(1), create_int_value(2), create_int_value(3)});
+
+    SegmentWriterOptions opts;
+    opts.num_rows_per_block = 100;
+
+    std::string file_name = kSegmentDir + "/predicate_column_cascade";
+    ASSIGN_OR_ABORT(auto wfile, _fs->new_writable_file(file_name));
+
+    SegmentWriter writer(std::move(wfile), 0, &tablet_schema, opts);
+    ASSERT_OK(writer.init());
+
+    const int32_t num_rows = 10000;
+    auto schema = vectorized::ChunkHelper::convert_schema_to_format_v2(tablet_schema);
+    auto chunk = vectorized::ChunkHelper::new_chunk(schema, num_rows);
+    for (int32_t i = 0; i < num_rows; i++) {
+        chunk->get_column_by_index(0)->append_datum(vectorized::Datum(i));
+        chunk->get_column_by_index(1)->append_datum(vectorized::Datum(i % 10));
+        chunk->get_column_by_index(2)->append_datum(vectorized::Datum(i * 10));
+    }
+    ASSERT_OK(writer.append_chunk(*chunk));
+    uint64_t file_size = 0;
+    uint64_t index_size;
+    uint64_t footer_position;
+    ASSERT_OK(writer.finalize(&file_size, &index_size, &footer_position));
+
+    auto segment = *Segment::open(_tablet_meta_mem_tracker.get(), _fs, file_name, 0, &tablet_schema);
+    ASSERT_EQ(segment->num_rows(), num_rows);
+
+    auto enable_cascade = config::enable_segment_predicate_column_cascade;
+    DeferOp reset_config([&]() { config::enable_segment_predicate_column_cascade = enable_cascade; });
+
+    ObjectPool pool;
+    auto* pred1 = pool.add(vectorized::new_column_lt_predicate(get_type_info(OLAP_FIELD_TYPE_INT), 1, "3"));
+    auto* pred2 = pool.add(vectorized::new_column_lt_predicate(get_type_info(OLAP_FIELD_TYPE_INT), 2, "65000"));
+    for (bool cascade : {false, true}) {
+        config::enable_segment_predicate_column_cascade = cascade;
+        vectorized::SegmentReadOptions seg_opts;
+        OlapReaderStatistics stats;
+        seg_opts.fs = _fs;
+        seg_opts.stats = &stats;
+        seg_opts.predicates[1].push_back(pred1);
+        seg_opts.predicates[2].push_back(pred2);
+        auto chunk_iter = new_segment_iterator(segment, schema, seg_opts);
+        std::vector<int32_t> rows;
+        while (true) {
+            chunk->reset();
+            auto st = chunk_iter->get_next(chunk.get());
+            if (st.is_end_of_file()) {
+                break;
+            }
+            ASSERT_OK(st);
+            for (size_t i = 0; i < chunk->num_rows(); i++) {
+                int32_t v = chunk->get(i)[0].get_int32();
+                ASSERT_EQ(v % 10, chunk->get(i)[1].get_int32());
+                ASSERT_EQ(v * 10, chunk->get(i)[2].get_int32());
+                rows.push_back(v);
+            }
+        }
+        chunk_iter->close();
+
+        std::vector<int32_t> expected;
+        for (int32_t i = 0; i < 6500; i++) {
+            if (i % 10 < 3) {
+                expected.push_back(i);
+            }
+        }
+        ASSERT_EQ(expected, rows);
+    }
+}
+
+TEST_F(SegmentIteratorTest, TestDeletePredicateByZoneMap) {
+    TabletSchema tablet_schema = create_schema({create_int_key(1), create_int_value(2), create_int_value(3)});
+
+    SegmentWriterOptions opts;
+    opts.num_rows_per_block = 100;
+
+    std::string file_name = kSegmentDir + "/delete_predicate_by_zone_map";
+    ASSIGN_OR_ABORT(auto wfile, _fs->new_writable_file(file_name));
+
+    SegmentWriter writer(std::move(wfile), 0, &tablet_schema, opts);
+    ASSERT_OK(writer.init());
+
+    const int32_t num_rows = 100000;
+    auto schema = vectorized::ChunkHelper::convert_schema_to_format_v2(tablet_schema);
+    auto chunk = vectorized::ChunkHelper::new_chunk(schema, num_rows);
+    for (int32_t i = 0; i < num_rows; i++) {
+        chunk->get_column_by_index(0)->append_datum(vectorized::Datum(i));
+        chunk->get_column_by_index(1)->append_datum(vectorized::Datum(i % 10));
+        chunk->get_column_by_index(2)->append_datum(vectorized::Datum(i * 10));
+    }
+    ASSERT_OK(writer.append_chunk(*chunk));
+    uint64_t file_size = 0;
+    uint64_t index_size;
+    uint64_t footer_position;
+    ASSERT_OK(writer.finalize(&file_size, &index_size, &footer_position));
+
+    auto segment = *Segment::open(_tablet_meta_mem_tracker.get(), _fs, file_name, 0, &tablet_schema);
+    ASSERT_EQ(segment->num_rows(), num_rows);
+    ASSERT_GT(segment->column(0)->num_data_pages(), 2);
+
+    // delete the rows `c1 < 50000 and c2 >= 0`.
+    ObjectPool pool;
+    vectorized::ConjunctivePredicates del_pred;
+    del_pred.add(pool.add(vectorized::new_column_lt_predicate(get_type_info(OLAP_FIELD_TYPE_INT), 0, "50000")));
+    del_pred.add(pool.add(vectorized::new_column_ge_predicate(get_type_info(OLAP_FIELD_TYPE_INT), 1, "0")));
+
+    vectorized::SegmentReadOptions seg_opts;
+    OlapReaderStatistics stats;
+    seg_opts.fs = _fs;
+    seg_opts.stats = &stats;
+    seg_opts.delete_predicates.add(del_pred);
+    auto chunk_iter = new_segment_iterator(segment, schema, seg_opts);
+    int32_t next = 50000;
+    while (true) {
+        chunk->reset();
+        auto st = chunk_iter->get_next(chunk.get());
+        if (st.is_end_of_file()) {
+            break;
+        }
+        ASSERT_OK(st);
+        for (size_t i = 0; i < chunk->num_rows(); i++) {
+            ASSERT_EQ(next, chunk->get(i)[0].get_int32());
+            ASSERT_EQ(next * 10, chunk->get(i)[2].get_int32());
+            next++;
+        }
+    }
+    chunk_iter->close();
+    ASSERT_EQ(num_rows, next);
+    ASSERT_EQ(50000, stats.rows_del_filtered);
+    // only the rows of the page across the boundary are read and deleted one by one.
+    ASSERT_LT(stats.raw_rows_read, num_rows);
+    ASSERT_GE(stats.raw_rows_read, 50000);
+}
+
 } // namespace starrocks
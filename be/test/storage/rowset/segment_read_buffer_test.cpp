@@ -0,0 +1,78 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "storage/rowset/segment_read_buffer.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "fs/fs_memory.h"
+#include "storage/olap_common.h"
+#include "testutil/assert.h"
+
+namespace starrocks {
+
+class SegmentReadBufferTest : public testing::Test {
+protected:
+    void SetUp() override {
+        _fs = std::make_shared<MemoryFileSystem>();
+        ASSERT_OK(_fs->create_dir("/segment_read_buffer_test"));
+        for (int i = 0; i < 1000; i++) {
+            _content.push_back(static_cast<char>(i % 127));
+        }
+        ASSIGN_OR_ABORT(auto wfile, _fs->new_writable_file(_filename));
+        ASSERT_OK(wfile->append(Slice(_content)));
+        ASSERT_OK(wfile->close());
+        ASSIGN_OR_ABORT(_rfile, _fs->new_random_access_file(_filename));
+    }
+
+    void check_read(const SegmentReadBuffer& buffer, const PagePointer& pp, bool expect_loaded) {
+        std::string page(pp.size, '\0');
+        ASSERT_EQ(expect_loaded, buffer.read(pp, page.data()));
+        if (expect_loaded) {
+            ASSERT_EQ(_content.substr(pp.offset, pp.size), page);
+        }
+    }
+
+    const std::string _filename = "/segment_read_buffer_test/file";
+    std::shared_ptr<MemoryFileSystem> _fs;
+    std::unique_ptr<RandomAccessFile> _rfile;
+    std::string _content;
+};
+
+TEST_F(SegmentReadBufferTest, coalesce) {
+    OlapReaderStatistics stats;
+    SegmentReadBuffer buffer(_rfile.get(), 10, 300);
+
+    // [0, 100) and [105, 200) are merged, [400, 450) is alone, [600, 700) and [700, 950) exceed the max range bytes.
+    std::vector<PagePointer> pages{{105, 95}, {600, 100}, {0, 100}, {400, 50}, {700, 250}};
+    ASSERT_OK(buffer.load(&pages, &stats));
+    ASSERT_EQ(200, stats.compressed_bytes_read);
+
+    check_read(buffer, {0, 100}, true);
+    check_read(buffer, {105, 95}, true);
+    check_read(buffer, {50, 100}, true);
+    check_read(buffer, {150, 100}, false);
+    check_read(buffer, {400, 50}, false);
+    check_read(buffer, {600, 100}, false);
+    check_read(buffer, {700, 250}, false);
+
+    buffer.clear();
+    check_read(buffer, {0, 100}, false);
+}
+
+TEST_F(SegmentReadBufferTest, reload) {
+    OlapReaderStatistics stats;
+    SegmentReadBuffer buffer(_rfile.get(), 0, 1000);
+
+    std::vector<PagePointer> pages{{0, 100}, {100, 100}};
+    ASSERT_OK(buffer.load(&pages, &stats));
+    pages = {{500, 100}, {600, 100}, {700, 100}};
+    ASSERT_OK(buffer.load(&pages, &stats));
+    ASSERT_EQ(500, stats.compressed_bytes_read);
+
+    check_read(buffer, {0, 100}, false);
+    check_read(buffer, {500, 300}, true);
+}
+
+} // namespace starrocks
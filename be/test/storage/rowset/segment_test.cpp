@@ -42,7 +42,10 @@
 #include "storage/rowset/segment_writer.h"
 #include "storage/tablet_schema.h"
 #include "storage/tablet_schema_helper.h"
+#include "storage/vectorized_column_predicate.h"
+#include "storage/zone_map_detail.h"
 #include "testutil/assert.h"
+#include "util/defer_op.h"
 
 namespace starrocks {
 
@@ -257,6 +260,55 @@ TEST_F(SegmentReaderWriterTest, TestHorizontalWrite) {
     EXPECT_EQ(count, num_rows);
 }
 
+TEST_F(SegmentReaderWriterTest, TestParallelColumnWrite) {
+    auto min_columns = config::segment_write_parallel_min_columns;
+    auto min_rows = config::segment_write_parallel_min_rows;
+    config::segment_write_parallel_min_columns = 2;
+    config::segment_write_parallel_min_rows = 1;
+    DeferOp reset_config([&]() {
+        config::segment_write_parallel_min_columns = min_columns;
+        config::segment_write_parallel_min_rows = min_rows;
+    });
+
+    const int num_columns = 40;
+    std::vector<TabletColumn> columns{create_int_key(0)};
+    for (int cid = 1; cid < num_columns; ++cid) {
+        columns.emplace_back(create_int_value(cid));
+    }
+    TabletSchema tablet_schema = create_schema(columns);
+
+    SegmentWriterOptions opts;
+    opts.num_rows_per_block = 10;
+    const size_t num_rows = 10000;
+    shared_ptr<Segment> segment;
+    build_segment(opts, tablet_schema, tablet_schema, num_rows, DefaultIntGenerator, &segment);
+
+    auto schema = vectorized::ChunkHelper::convert_schema_to_format_v2(tablet_schema);
+    vectorized::SegmentReadOptions seg_options;
+    seg_options.fs = _fs;
+    OlapReaderStatistics stats;
+    seg_options.stats = &stats;
+    ASSIGN_OR_ABORT(auto seg_iterator, segment->new_iterator(schema, seg_options));
+
+    auto chunk = vectorized::ChunkHelper::new_chunk(schema, config::vector_chunk_size);
+    size_t rid = 0;
+    while (true) {
+        chunk->reset();
+        auto st = seg_iterator->get_next(chunk.get());
+        if (st.is_end_of_file()) {
+            break;
+        }
+        ASSERT_OK(st);
+        for (size_t i = 0; i < chunk->num_rows(); ++i, ++rid) {
+            auto row = chunk->get(i);
+            for (int cid = 0; cid < num_columns; ++cid) {
+                ASSERT_EQ(static_cast<int32_t>(rid * 10 + cid), row[cid].get_int32());
+            }
+        }
+    }
+    ASSERT_EQ(num_rows, rid);
+}
+
 TEST_F(SegmentReaderWriterTest, TestVerticalWrite) {
     TabletSchema tablet_schema =
             create_schema({create_int_key(1), create_int_key(2), create_int_value(3), create_int_value(4)});
@@ -473,4 +525,54 @@ TEST_F(SegmentReaderWriterTest, TestReadMultipleTypesColumn) {
     EXPECT_EQ(count, num_rows);
 }
 
+
+TEST_F(SegmentReaderWriterTest, TestClassifyPagesByZoneMap) {
+    TabletSchema schema = create_schema({create_int_key(1), create_int_value(2)});
+
+    SegmentWriterOptions opts;
+    shared_ptr<Segment> segment;
+    const size_t num_rows = 100000;
+    build_segment(opts, schema, schema, num_rows, DefaultIntGenerator, &segment);
+    ASSERT_GT(segment->column(0)->num_data_pages(), 2);
+
+    ColumnIterator* raw_iter = nullptr;
+    ASSERT_OK(segment->new_column_iterator(0, &raw_iter));
+    std::unique_ptr<ColumnIterator> iter(raw_iter);
+    ASSIGN_OR_ABORT(auto read_file, _fs->new_random_access_file(segment->file_name()));
+    OlapReaderStatistics stats;
+    ColumnIteratorOptions iter_opts;
+    iter_opts.read_file = read_file.get();
+    iter_opts.stats = &stats;
+    ASSERT_OK(iter->init(iter_opts));
+
+    // the rows [30000, 70000) satisfy the predicates.
+    auto type_info = get_type_info(OLAP_FIELD_TYPE_INT);
+    std::unique_ptr<vectorized::ColumnPredicate> ge(vectorized::new_column_ge_predicate(type_info, 0, "300000"));
+    std::unique_ptr<vectorized::ColumnPredicate> lt(vectorized::new_column_lt_predicate(type_info, 0, "700000"));
+    vectorized::SparseRange full_ranges;
+    vectorized::SparseRange partial_ranges;
+    vectorized::ZoneMapDetail full_zone_map;
+    ASSERT_OK(iter->classify_pages_by_zone_map({ge.get(), lt.get()}, &full_ranges, &partial_ranges, &full_zone_map));
+
+    ASSERT_FALSE(full_ranges.empty());
+    ASSERT_FALSE(partial_ranges.empty());
+    ASSERT_TRUE((full_ranges & partial_ranges).empty());
+    ASSERT_GE(full_ranges.begin(), 30000u);
+    ASSERT_LE(full_ranges.end(), 70000u);
+    ASSERT_EQ(static_cast<int32_t>(full_ranges.begin() * 10), full_zone_map.min_value().get_int32());
+    ASSERT_EQ(static_cast<int32_t>((full_ranges.end() - 1) * 10), full_zone_map.max_value().get_int32());
+    // the pages of the boundaries are only partially satisfied.
+    vectorized::SparseRange satisfied(30000, 70000);
+    ASSERT_EQ(satisfied, (full_ranges | partial_ranges) & satisfied);
+    ASSERT_EQ(satisfied.span_size(), full_ranges.span_size() + (partial_ranges & satisfied).span_size());
+
+    // the pages of the other predicates are never full.
+    std::unique_ptr<vectorized::ColumnPredicate> ne(vectorized::new_column_ne_predicate(type_info, 0, "0"));
+    full_ranges.clear();
+    partial_ranges.clear();
+    ASSERT_OK(iter->classify_pages_by_zone_map({ne.get()}, &full_ranges, &partial_ranges, &full_zone_map));
+    ASSERT_TRUE(full_ranges.empty());
+    ASSERT_EQ(vectorized::SparseRange(0, num_rows), partial_ranges);
+}
+
 } // namespace starrocks
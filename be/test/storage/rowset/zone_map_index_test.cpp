@@ -168,4 +168,81 @@ TEST_F(ColumnZoneMapTest, NormalTestCharPage) {
     delete field;
 }
 
+// Test for the zone maps of the blocks inside the pages
+TEST_F(ColumnZoneMapTest, BlockZoneMaps) {
+    std::string filename = kTestDir + "/BlockZoneMaps";
+
+    TabletColumn int_column = create_int_key(0);
+    Field* field = FieldFactory::create(int_column);
+
+    std::unique_ptr<ZoneMapIndexWriter> builder = ZoneMapIndexWriter::create(field, 4);
+    // Page 0: rows [0, 6), blocks [0, 4) and [4, 8)
+    std::vector<int> values1 = {1, 2, 3, 4, 50, 60};
+    builder->add_values((const uint8_t*)values1.data(), values1.size());
+    builder->flush();
+    // Page 1: rows [6, 14), blocks [4, 8), [8, 12) and [12, 16)
+    std::vector<int> values2 = {70, 80, 9, 10, 11, 12};
+    builder->add_values((const uint8_t*)values2.data(), values2.size());
+    builder->add_nulls(3);
+    builder->flush();
+
+    ColumnIndexMetaPB index_meta;
+    {
+        ASSIGN_OR_ABORT(auto file, _fs->new_writable_file(filename));
+        ASSERT_OK(builder->finish(file.get(), &index_meta));
+        ASSERT_OK(file->close());
+    }
+
+    ZoneMapIndexReader column_zone_map;
+    ASSIGN_OR_ABORT(auto r, column_zone_map.load(_fs.get(), filename, index_meta.zone_map_index(), true, false));
+    ASSERT_TRUE(r);
+    ASSERT_EQ(2, column_zone_map.num_pages());
+    ASSERT_EQ(4, column_zone_map.block_num_rows());
+    const std::vector<ZoneMapPB>& zone_maps = column_zone_map.block_zone_maps();
+    ASSERT_EQ(4, zone_maps.size());
+
+    ASSERT_EQ("1", zone_maps[0].min());
+    ASSERT_EQ("4", zone_maps[0].max());
+    ASSERT_FALSE(zone_maps[0].has_null());
+
+    ASSERT_EQ("50", zone_maps[1].min());
+    ASSERT_EQ("80", zone_maps[1].max());
+
+    ASSERT_EQ("9", zone_maps[2].min());
+    ASSERT_EQ("12", zone_maps[2].max());
+    ASSERT_FALSE(zone_maps[2].has_null());
+
+    ASSERT_TRUE(zone_maps[3].has_null());
+    ASSERT_FALSE(zone_maps[3].has_not_null());
+    delete field;
+}
+
+// Test for the index without block zone maps
+TEST_F(ColumnZoneMapTest, NoBlockZoneMaps) {
+    std::string filename = kTestDir + "/NoBlockZoneMaps";
+
+    TabletColumn int_column = create_int_key(0);
+    Field* field = FieldFactory::create(int_column);
+
+    std::unique_ptr<ZoneMapIndexWriter> builder = ZoneMapIndexWriter::create(field);
+    std::vector<int> values = {1, 2, 3};
+    builder->add_values((const uint8_t*)values.data(), values.size());
+    builder->flush();
+
+    ColumnIndexMetaPB index_meta;
+    {
+        ASSIGN_OR_ABORT(auto file, _fs->new_writable_file(filename));
+        ASSERT_OK(builder->finish(file.get(), &index_meta));
+        ASSERT_OK(file->close());
+    }
+    ASSERT_FALSE(index_meta.zone_map_index().has_block_zone_maps());
+
+    ZoneMapIndexReader column_zone_map;
+    ASSIGN_OR_ABORT(auto r, column_zone_map.load(_fs.get(), filename, index_meta.zone_map_index(), true, false));
+    ASSERT_TRUE(r);
+    ASSERT_EQ(0, column_zone_map.block_num_rows());
+    ASSERT_TRUE(column_zone_map.block_zone_maps().empty());
+    delete field;
+}
+
 } // namespace starrocks
@@ -0,0 +1,186 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "storage/shared_tablet_scan.h"
+
+#include <gtest/gtest.h>
+
+#include "column/chunk.h"
+#include "storage/chunk_helper.h"
+#include "storage/rowset/rowset_factory.h"
+#include "storage/rowset/rowset_writer.h"
+#include "storage/rowset/rowset_writer_context.h"
+#include "storage/storage_engine.h"
+#include "storage/tablet_manager.h"
+#include "testutil/assert.h"
+#include "util/defer_op.h"
+
+namespace starrocks::vectorized {
+
+class SharedTabletScanTest : public testing::Test {
+public:
+    void SetUp() override {
+        srand(GetCurrentTimeMicros());
+        create_tablet(rand(), rand());
+        std::vector<int64_t> keys(kNumRows);
+        for (int64_t i = 0; i < kNumRows; i++) {
+            keys[i] = i;
+        }
+        ASSERT_OK(_tablet->rowset_commit(2, create_rowset(keys)));
+        _schema = ChunkHelper::convert_schema_to_format_v2(_tablet->tablet_schema());
+        _params.chunk_size = kChunkSize;
+    }
+
+    void TearDown() override {
+        if (_tablet) {
+            StorageEngine::instance()->tablet_manager()->drop_tablet(_tablet->tablet_id());
+            _tablet.reset();
+        }
+    }
+
+protected:
+    static constexpr int64_t kNumRows = 10000;
+    static constexpr int kChunkSize = 100;
+
+    RowsetSharedPtr create_rowset(const std::vector<int64_t>& keys) {
+        RowsetWriterContext writer_context(kDataFormatV2, config::storage_format_version);
+        writer_context.rowset_id = StorageEngine::instance()->next_rowset_id();
+        writer_context.tablet_id = _tablet->tablet_id();
+        writer_context.tablet_schema_hash = _tablet->schema_hash();
+        writer_context.partition_id = 0;
+        writer_context.rowset_type = BETA_ROWSET;
+        writer_context.rowset_path_prefix = _tablet->schema_hash_path();
+        writer_context.rowset_state = COMMITTED;
+        writer_context.tablet_schema = &_tablet->tablet_schema();
+        writer_context.version.first = 0;
+        writer_context.version.second = 0;
+        writer_context.segments_overlap = NONOVERLAPPING;
+        std::unique_ptr<RowsetWriter> writer;
+        EXPECT_TRUE(RowsetFactory::create_rowset_writer(writer_context, &writer).ok());
+        auto schema = ChunkHelper::convert_schema_to_format_v2(_tablet->tablet_schema());
+        auto chunk = ChunkHelper::new_chunk(schema, keys.size());
+        auto& cols = chunk->columns();
+        for (int64_t key : keys) {
+            cols[0]->append_datum(Datum(key));
+            cols[1]->append_datum(Datum(static_cast<int32_t>(key * 2)));
+        }
+        CHECK_OK(writer->flush_chunk(*chunk));
+        return *writer->build();
+    }
+
+    void create_tablet(int64_t tablet_id, int32_t schema_hash) {
+        TCreateTabletReq request;
+        request.tablet_id = tablet_id;
+        request.__set_version(1);
+        request.__set_version_hash(0);
+        request.tablet_schema.schema_hash = schema_hash;
+        request.tablet_schema.short_key_column_count = 1;
+        request.tablet_schema.keys_type = TKeysType::PRIMARY_KEYS;
+        request.tablet_schema.storage_type = TStorageType::COLUMN;
+
+        TColumn k1;
+        k1.column_name = "pk";
+        k1.__set_is_key(true);
+        k1.column_type.type = TPrimitiveType::BIGINT;
+        request.tablet_schema.columns.push_back(k1);
+
+        TColumn v1;
+        v1.column_name = "v1";
+        v1.__set_is_key(false);
+        v1.column_type.type = TPrimitiveType::INT;
+        request.tablet_schema.columns.push_back(v1);
+        auto st = StorageEngine::instance()->create_tablet(request);
+        ASSERT_TRUE(st.ok()) << st.to_string();
+        _tablet = StorageEngine::instance()->tablet_manager()->get_tablet(tablet_id);
+        ASSERT_TRUE(_tablet);
+    }
+
+    ChunkIteratorPtr new_iterator() {
+        return new_shared_tablet_scan_iterator(_tablet, Version(0, 2), _schema, _params);
+    }
+
+    // Read at most |max_chunks| chunks from |iter| into |keys|, return false at the end of the scan.
+    bool read(const ChunkIteratorPtr& iter, size_t max_chunks, std::vector<int64_t>* keys) {
+        auto chunk = ChunkHelper::new_chunk(_schema, kChunkSize);
+        for (size_t i = 0; i < max_chunks; i++) {
+            chunk->reset();
+            auto st = iter->get_next(chunk.get());
+            if (st.is_end_of_file()) {
+                return false;
+            }
+            EXPECT_OK(st);
+            for (size_t row = 0; row < chunk->num_rows(); row++) {
+                int64_t key = chunk->get(row)[0].get_int64();
+                EXPECT_EQ(key * 2, chunk->get(row)[1].get_int32());
+                keys->push_back(key);
+            }
+        }
+        return true;
+    }
+
+    void assert_all_rows(std::vector<int64_t> keys) {
+        std::sort(keys.begin(), keys.end());
+        ASSERT_EQ(kNumRows, keys.size());
+        for (int64_t i = 0; i < kNumRows; i++) {
+            ASSERT_EQ(i, keys[i]);
+        }
+    }
+
+    TabletSharedPtr _tablet;
+    Schema _schema;
+    TabletReaderParams _params;
+};
+
+TEST_F(SharedTabletScanTest, interleaved_scans) {
+    auto iter1 = new_iterator();
+    auto iter2 = new_iterator();
+    std::vector<int64_t> keys1;
+    std::vector<int64_t> keys2;
+    bool more1 = true;
+    bool more2 = true;
+    while (more1 || more2) {
+        more1 = more1 && read(iter1, 1, &keys1);
+        more2 = more2 && read(iter2, 3, &keys2);
+    }
+    assert_all_rows(keys1);
+    assert_all_rows(keys2);
+}
+
+TEST_F(SharedTabletScanTest, wrap_around) {
+    auto iter1 = new_iterator();
+    std::vector<int64_t> keys1;
+    ASSERT_TRUE(read(iter1, 60, &keys1));
+
+    // attached in the middle of the tablet, and reads the beginning after the end.
+    auto iter2 = new_iterator();
+    std::vector<int64_t> keys2;
+    ASSERT_TRUE(read(iter2, 1, &keys2));
+    ASSERT_GT(keys2[0], 0);
+    while (read(iter2, 1, &keys2)) {
+    }
+    while (read(iter1, 1, &keys1)) {
+    }
+    assert_all_rows(keys1);
+    assert_all_rows(keys2);
+}
+
+TEST_F(SharedTabletScanTest, fall_behind) {
+    auto max_buffered_chunks = config::shared_tablet_scan_max_buffered_chunks;
+    config::shared_tablet_scan_max_buffered_chunks = 2;
+    DeferOp reset_config([&]() { config::shared_tablet_scan_max_buffered_chunks = max_buffered_chunks; });
+
+    auto iter1 = new_iterator();
+    auto iter2 = new_iterator();
+    std::vector<int64_t> keys1;
+    std::vector<int64_t> keys2;
+    ASSERT_TRUE(read(iter2, 5, &keys2));
+    ASSERT_TRUE(read(iter1, 30, &keys1));
+    // the chunks evicted are read by a private reader of |iter2|.
+    while (read(iter2, 1, &keys2)) {
+    }
+    while (read(iter1, 1, &keys1)) {
+    }
+    assert_all_rows(keys1);
+    assert_all_rows(keys2);
+}
+
+} // namespace starrocks::vectorized
@@ -0,0 +1,100 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "storage/size_tiered_compaction_policy.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include "storage/compaction_context.h"
+#include "storage/rowset/beta_rowset.h"
+#include "storage/tablet.h"
+#include "storage/tablet_schema_helper.h"
+#include "util/defer_op.h"
+#include "util/time.h"
+
+namespace starrocks {
+
+class SizeTieredCompactionPolicyTest : public testing::Test {
+public:
+    void SetUp() override {
+        TabletSharedPtr tablet = std::make_shared<Tablet>();
+        TabletMetaSharedPtr tablet_meta = std::make_shared<TabletMeta>();
+        tablet_meta->set_tablet_id(100);
+        tablet->set_tablet_meta(tablet_meta);
+        _compaction_context = std::make_unique<CompactionContext>();
+        _compaction_context->tablet = tablet;
+        create_tablet_schema(&_tablet_schema);
+    }
+
+protected:
+    static constexpr int64_t kMB = 1024 * 1024;
+
+    void add_rowset(int level, int64_t start_version, int64_t end_version, int64_t size, int64_t creation_time) {
+        RowsetMetaSharedPtr rowset_meta = std::make_shared<RowsetMeta>();
+        rowset_meta->set_start_version(start_version);
+        rowset_meta->set_end_version(end_version);
+        rowset_meta->set_creation_time(creation_time);
+        rowset_meta->set_segments_overlap(NONOVERLAPPING);
+        rowset_meta->set_num_segments(1);
+        rowset_meta->set_total_disk_size(size);
+        rowset_meta->set_empty(false);
+        RowsetSharedPtr rowset = std::make_shared<BetaRowset>(
+                &_tablet_schema, "./rowset_" + std::to_string(start_version), rowset_meta);
+        _compaction_context->rowset_levels[level].insert(rowset.get());
+        _rowsets.emplace_back(std::move(rowset));
+    }
+
+    TabletSchema _tablet_schema;
+    std::unique_ptr<CompactionContext> _compaction_context;
+    std::vector<RowsetSharedPtr> _rowsets;
+    int64_t _base_time = UnixSeconds() - 100 * 60;
+};
+
+TEST_F(SizeTieredCompactionPolicyTest, test_small_rowsets) {
+    add_rowset(2, 0, 9, 10 * 1024 * kMB, _base_time);
+    for (int i = 10; i < 20; i++) {
+        add_rowset(0, i, i, kMB, _base_time + i);
+    }
+    SizeTieredCompactionPolicy policy(_compaction_context.get());
+    ASSERT_TRUE(policy.need_compaction());
+    // the ten small rowsets are merged, removing 9 sources at the cost of 10MB.
+    ASSERT_DOUBLE_EQ(9.0, _compaction_context->cumulative_score);
+    // the base rowset is far larger than the others.
+    ASSERT_DOUBLE_EQ(0.0, _compaction_context->base_score);
+}
+
+TEST_F(SizeTieredCompactionPolicyTest, test_large_rowsets) {
+    add_rowset(2, 0, 9, 10 * 1024 * kMB, _base_time);
+    for (int i = 1; i <= 4; i++) {
+        add_rowset(1, i * 10, i * 10 + 9, 1024 * kMB, _base_time + i);
+    }
+    {
+        // rewriting 4GB to remove 3 sources exceeds the write budget.
+        SizeTieredCompactionPolicy policy(_compaction_context.get());
+        ASSERT_FALSE(policy.need_compaction());
+        ASSERT_GT(_compaction_context->cumulative_score, 0);
+    }
+    {
+        auto max_read_amplification = config::size_tiered_compaction_max_read_amplification;
+        config::size_tiered_compaction_max_read_amplification = 4;
+        DeferOp reset_config(
+                [&]() { config::size_tiered_compaction_max_read_amplification = max_read_amplification; });
+        SizeTieredCompactionPolicy policy(_compaction_context.get());
+        ASSERT_TRUE(policy.need_compaction());
+        ASSERT_DOUBLE_EQ(5.0 / 4, _compaction_context->cumulative_score);
+    }
+}
+
+TEST_F(SizeTieredCompactionPolicyTest, test_recent_rowsets) {
+    add_rowset(2, 0, 9, 10 * 1024 * kMB, _base_time);
+    for (int i = 10; i < 20; i++) {
+        add_rowset(0, i, i, kMB, UnixSeconds());
+    }
+    SizeTieredCompactionPolicy policy(_compaction_context.get());
+    ASSERT_FALSE(policy.need_compaction());
+    _compaction_context->chosen_compaction_type = CUMULATIVE_COMPACTION;
+    ASSERT_EQ(nullptr, policy.create_compaction());
+}
+
+} // namespace starrocks
@@ -291,4 +291,31 @@ TEST_F(TabletMgrTest, GetNextBatchTabletsTest) {
     ASSERT_GE(num, 20);
 }
 
+TEST_F(TabletMgrTest, TabletsInfoFingerprint) {
+    std::map<TTabletId, TTablet> tablets_info;
+    for (int64_t tablet_id = 1; tablet_id <= 3; tablet_id++) {
+        TTabletInfo info;
+        info.__set_tablet_id(tablet_id);
+        info.__set_schema_hash(3333);
+        info.__set_version(10);
+        info.__set_row_count(100);
+        info.__set_data_size(1000);
+        tablets_info[tablet_id].tablet_infos.push_back(info);
+    }
+    auto fingerprint = TabletManager::tablets_info_fingerprint(tablets_info);
+    ASSERT_EQ(fingerprint, TabletManager::tablets_info_fingerprint(tablets_info));
+
+    auto changed = tablets_info;
+    changed[2].tablet_infos[0].__set_version(11);
+    ASSERT_NE(fingerprint, TabletManager::tablets_info_fingerprint(changed));
+
+    changed = tablets_info;
+    changed[3].tablet_infos[0].__set_transaction_ids({100});
+    ASSERT_NE(fingerprint, TabletManager::tablets_info_fingerprint(changed));
+
+    changed = tablets_info;
+    changed.erase(1);
+    ASSERT_NE(fingerprint, TabletManager::tablets_info_fingerprint(changed));
+}
+
 } // namespace starrocks
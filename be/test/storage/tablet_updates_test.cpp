@@ -401,6 +401,7 @@ public:
     void test_issue_4181(bool enable_persistent_index);
     void test_snapshot_with_empty_rowset(bool enable_persistent_index);
     void test_get_column_values(bool enable_persistent_index);
+    void test_get_rows_by_primary_keys(bool enable_persistent_index);
     void test_get_missing_version_ranges(const std::vector<int64_t>& versions,
                                          const std::vector<int64_t>& expected_missing_ranges);
     void test_get_rowsets_for_incremental_snapshot(const std::vector<int64_t>& versions,
@@ -2338,6 +2339,54 @@ TEST_F(TabletUpdatesTest, get_column_values_with_persistent_index) {
     test_get_column_values(true);
 }
 
+void TabletUpdatesTest::test_get_rows_by_primary_keys(bool enable_persistent_index) {
+    srand(GetCurrentTimeMicros());
+    auto tablet = create_tablet(rand(), rand());
+    DeferOp del_tablet([&]() {
+        auto tablet_mgr = StorageEngine::instance()->tablet_manager();
+        (void)tablet_mgr->drop_tablet(tablet->tablet_id());
+        (void)fs::remove_all(tablet->schema_hash_path());
+    });
+    tablet->set_enable_persistent_index(enable_persistent_index);
+    const int N = 8000;
+    std::vector<int64_t> keys;
+    for (int i = 0; i < N; i++) {
+        keys.push_back(i);
+    }
+    ASSERT_TRUE(tablet->rowset_commit(2, create_rowsets(tablet, keys, 1000)).ok());
+    ASSERT_TRUE(tablet->rowset_commit(3, create_rowsets(tablet, keys, 1000)).ok());
+    ASSERT_EQ(N, read_tablet(tablet, 3));
+
+    auto lookup_keys = vectorized::Int64Column::create();
+    for (int64_t key : {7999, 5, 100, 9000}) {
+        lookup_keys->append(key);
+    }
+    std::vector<uint32_t> read_column_ids = {0, 1};
+    std::vector<std::unique_ptr<vectorized::Column>> read_columns(read_column_ids.size());
+    for (auto i = 0; i < read_column_ids.size(); i++) {
+        auto tablet_column = tablet->tablet_schema().column(read_column_ids[i]);
+        read_columns[i] = vectorized::ChunkHelper::column_from_field_type(tablet_column.type(),
+                                                                          tablet_column.is_nullable())
+                                  ->clone_empty();
+    }
+    // only the latest applied version is served by the primary index.
+    auto st = tablet->updates()->get_rows_by_primary_keys(2, *lookup_keys, read_column_ids, &read_columns);
+    ASSERT_TRUE(st.is_not_supported()) << st;
+
+    ASSERT_OK(tablet->updates()->get_rows_by_primary_keys(3, *lookup_keys, read_column_ids, &read_columns));
+    // the rows are read in order of the segments and rowids, and the absent keys are skipped.
+    ASSERT_EQ("[5, 100, 7999]", read_columns[0]->debug_string());
+    ASSERT_EQ("[6, 1, 100]", read_columns[1]->debug_string());
+}
+
+TEST_F(TabletUpdatesTest, get_rows_by_primary_keys) {
+    test_get_rows_by_primary_keys(false);
+}
+
+TEST_F(TabletUpdatesTest, get_rows_by_primary_keys_with_persistent_index) {
+    test_get_rows_by_primary_keys(true);
+}
+
 void TabletUpdatesTest::test_get_missing_version_ranges(const std::vector<int64_t>& versions,
                                                         const std::vector<int64_t>& expected_missing_ranges) {
     auto tablet = create_tablet(rand(), rand());
@@ -183,4 +183,50 @@ TEST_F(UpdateManagerTest, testExpireEntry) {
     ASSERT_EQ(peak_size - expiring_size, remaining_size);
 }
 
+TEST_F(UpdateManagerTest, testParallelApply) {
+    ASSERT_TRUE(_update_manager->init().ok());
+    const size_t N = 100;
+    std::vector<int> done(N, 0);
+    auto st = _update_manager->parallel_apply(N, [&](size_t i) {
+        done[i]++;
+        return Status::OK();
+    });
+    ASSERT_TRUE(st.ok());
+    ASSERT_EQ(std::vector<int>(N, 1), done);
+
+    st = _update_manager->parallel_apply(N, [&](size_t i) {
+        return i % 10 == 7 ? Status::NotFound("injected error") : Status::OK();
+    });
+    ASSERT_TRUE(st.is_not_found());
+}
+
+TEST_F(UpdateManagerTest, testPrewarmAndEvictIndexCache) {
+    srand(time(NULL));
+    create_tablet(rand(), rand());
+    ASSERT_EQ(0, _update_manager->prewarm_index_cache({_tablet}, [] { return true; }));
+    ASSERT_EQ(1, _update_manager->prewarm_index_cache({_tablet}, [] { return false; }));
+    auto index_entry = _update_manager->index_cache().get(_tablet->tablet_id());
+    ASSERT_TRUE(index_entry != nullptr);
+    ASSERT_TRUE(index_entry->value().is_loaded());
+    _update_manager->index_cache().release(index_entry);
+
+    // the update memory limit is 1000 bytes, the index cache is limited to 800 bytes
+    MemTracker limited_tracker(1000, "limited_update");
+    auto limited_manager = std::make_unique<UpdateManager>(&limited_tracker);
+    auto& cache = limited_manager->index_cache();
+    for (uint64_t tablet_id = 1; tablet_id <= 3; tablet_id++) {
+        auto entry = cache.get_or_create(tablet_id);
+        cache.update_object_size(entry, 400);
+        cache.release(entry);
+    }
+    auto pinned = cache.get(1);
+    limited_manager->evict_index_cache();
+    ASSERT_EQ(800, cache.size());
+    ASSERT_TRUE(cache.get(2) == nullptr);
+    auto entry = cache.get(3);
+    ASSERT_TRUE(entry != nullptr);
+    cache.release(entry);
+    cache.release(pinned);
+}
+
 } // namespace starrocks
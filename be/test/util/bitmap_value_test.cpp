@@ -68,6 +68,46 @@ TEST(BitmapValueTest, bitmap_union) {
     ASSERT_EQ(5, bitmap2.cardinality());
 }
 
+TEST(BitmapValueTest, bitmap_add_many) {
+    std::vector<uint64_t> values;
+    for (uint64_t i = 0; i < 100; ++i) {
+        values.emplace_back(i * 3);
+        values.emplace_back((i << 32) + i);
+    }
+
+    BitmapValue bitmap;
+    bitmap.add_many(values.size(), values.data());
+    BitmapValue expected;
+    for (auto v : values) {
+        expected.add(v);
+    }
+    ASSERT_EQ(expected.to_string(), bitmap.to_string());
+
+    // few values stay in the smaller types
+    std::vector<uint64_t> same(100, 7);
+    BitmapValue single;
+    single.add_many(same.size(), same.data());
+    ASSERT_EQ(1, single.cardinality());
+    ASSERT_EQ(BitmapValue(7).getSizeInBytes(), single.getSizeInBytes());
+}
+
+TEST(BitmapValueTest, bitmap_union_many) {
+    std::vector<BitmapValue> values;
+    BitmapValue expected;
+    for (uint64_t i = 0; i < 100; ++i) {
+        values.emplace_back(i);
+        expected.add(i);
+    }
+    values.emplace_back(std::vector<uint64_t>{1000, 2000, 3000});
+    values.emplace_back();
+    expected |= values[100];
+
+    BitmapValue bitmap(5000);
+    bitmap.union_many(values.data(), values.size());
+    expected.add(5000);
+    ASSERT_EQ(expected.to_string(), bitmap.to_string());
+}
+
 TEST(BitmapValueTest, bitmap_intersect) {
     BitmapValue empty;
     BitmapValue single(1024);
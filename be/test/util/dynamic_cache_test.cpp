@@ -56,4 +56,30 @@ TEST(DynamicCacheTest, cache) {
     ASSERT_TRUE(cache.get(19) == nullptr);
 }
 
+TEST(DynamicCacheTest, try_evict) {
+    DynamicCache<int32_t, int64_t> cache(100);
+    for (int i = 0; i < 10; i++) {
+        auto e = cache.get_or_create(i);
+        e->value() = i;
+        cache.update_object_size(e, 1);
+        cache.release(e);
+    }
+    auto pinned = cache.get(1);
+    // evict the unused odd values in LRU order first: 3, 5, 7
+    ASSERT_TRUE(cache.try_evict(7, [](int64_t& v) { return v % 2 == 1; }));
+    ASSERT_EQ(7, cache.size());
+    for (int i : {3, 5, 7}) {
+        ASSERT_TRUE(cache.get(i) == nullptr);
+    }
+    // the pinned one is kept
+    ASSERT_FALSE(cache.try_evict(0, [](int64_t& v) { return v % 2 == 1; }));
+    ASSERT_EQ(6, cache.size());
+    ASSERT_TRUE(cache.try_evict(2, [](int64_t& v) { return true; }));
+    ASSERT_EQ(2, cache.size());
+    cache.release(pinned);
+    auto e = cache.get(8);
+    ASSERT_TRUE(e != nullptr);
+    cache.release(e);
+}
+
 } // namespace starrocks
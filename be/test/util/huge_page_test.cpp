@@ -0,0 +1,64 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "util/huge_page.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <vector>
+
+#include "common/config.h"
+
+namespace starrocks {
+
+class HugePageTest : public testing::Test {
+public:
+    void SetUp() override { _madvise_huge_pages = config::madvise_huge_pages; }
+    void TearDown() override { config::madvise_huge_pages = _madvise_huge_pages; }
+
+private:
+    bool _madvise_huge_pages = false;
+};
+
+TEST_F(HugePageTest, test_madvise) {
+    void* data = nullptr;
+    ASSERT_EQ(0, posix_memalign(&data, HUGE_PAGE_SIZE, 2 * HUGE_PAGE_SIZE));
+
+    config::madvise_huge_pages = false;
+    ASSERT_EQ(0, madvise_huge_pages(data, 2 * HUGE_PAGE_SIZE));
+
+    config::madvise_huge_pages = true;
+    // no whole huge page in the range
+    ASSERT_EQ(0, madvise_huge_pages(data, HUGE_PAGE_SIZE - 1));
+    ASSERT_EQ(0, madvise_huge_pages(static_cast<char*>(data) + 1, HUGE_PAGE_SIZE));
+    // 0 if the kernel does not support transparent huge pages
+    size_t advised = madvise_huge_pages(data, 2 * HUGE_PAGE_SIZE);
+    ASSERT_TRUE(advised == 0 || advised == 2 * HUGE_PAGE_SIZE);
+    advised = madvise_huge_pages(static_cast<char*>(data) + 1, 2 * HUGE_PAGE_SIZE - 1);
+    ASSERT_TRUE(advised == 0 || advised == HUGE_PAGE_SIZE);
+    free(data);
+}
+
+TEST_F(HugePageTest, test_resize_on_huge_pages) {
+    config::madvise_huge_pages = true;
+    std::vector<uint32_t> small;
+    resize_on_huge_pages(&small, 100, 7);
+    ASSERT_EQ(std::vector<uint32_t>(100, 7), small);
+
+    const size_t n = 2 * HUGE_PAGE_SIZE / sizeof(uint32_t) + 1;
+    std::vector<uint32_t> large;
+    resize_on_huge_pages(&large, n, 0);
+    ASSERT_EQ(n, large.size());
+    for (size_t i = 0; i < n; i++) {
+        ASSERT_EQ(0, large[i]);
+    }
+    // the existing elements are kept
+    large[0] = 1;
+    resize_on_huge_pages(&large, 2 * n, 2);
+    ASSERT_EQ(2 * n, large.size());
+    ASSERT_EQ(1, large[0]);
+    ASSERT_EQ(0, large[n - 1]);
+    ASSERT_EQ(2, large[n]);
+}
+
+} // namespace starrocks
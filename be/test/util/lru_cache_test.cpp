@@ -255,6 +255,60 @@ TEST_F(CacheTest, Usage) {
     ASSERT_EQ(950, cache.get_usage());
 }
 
+TEST_F(CacheTest, SegmentedLRU) {
+    delete _cache;
+    _cache = new_lru_cache(kCacheSize, CacheEvictionPolicy::SLRU);
+
+    // The entries looked up again are protected from a scan.
+    for (int i = 0; i < 10; i++) {
+        Insert(100 + i, 200 + i, 1);
+        ASSERT_EQ(200 + i, Lookup(100 + i));
+    }
+    Insert(300, 301, 1);
+    for (int i = 0; i < 2 * kCacheSize; i++) {
+        Insert(1000 + i, 2000 + i, 1);
+    }
+    for (int i = 0; i < 10; i++) {
+        ASSERT_EQ(200 + i, Lookup(100 + i));
+    }
+    ASSERT_EQ(-1, Lookup(300));
+    ASSERT_EQ(-1, Lookup(1000));
+}
+
+static void lookup_LRUCache(LRUCache& cache, const CacheKey& key) {
+    uint32_t hash = key.hash(key.data(), key.size(), 0);
+    auto* handle = cache.lookup(key, hash);
+    ASSERT_TRUE(handle != nullptr);
+    cache.release(handle);
+}
+
+TEST_F(CacheTest, ProtectedUsage) {
+    LRUCache cache;
+    cache.set_capacity(100);
+    cache.set_protected_capacity(50);
+
+    CacheKey key1("30");
+    insert_LRUCache(cache, key1, 30, CachePriority::NORMAL);
+    CacheKey key2("31");
+    insert_LRUCache(cache, key2, 31, CachePriority::NORMAL);
+    ASSERT_EQ(0, cache.get_protected_usage());
+
+    lookup_LRUCache(cache, key1);
+    ASSERT_EQ(30, cache.get_protected_usage());
+    // key1 is demoted to the probationary segment
+    lookup_LRUCache(cache, key2);
+    ASSERT_EQ(31, cache.get_protected_usage());
+
+    // the probationary entries are evicted first
+    CacheKey key3("40");
+    insert_LRUCache(cache, key3, 40, CachePriority::NORMAL);
+    ASSERT_EQ(71, cache.get_usage());
+    lookup_LRUCache(cache, key2);
+    ASSERT_EQ(31, cache.get_protected_usage());
+    uint32_t hash = key1.hash(key1.data(), key1.size(), 0);
+    ASSERT_TRUE(cache.lookup(key1, hash) == nullptr);
+}
+
 TEST_F(CacheTest, HeavyEntries) {
     // Add a bunch of light and heavy entries and then count the combined
     // size of items still in the cache, which must be approximately the
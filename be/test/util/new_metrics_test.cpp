@@ -181,6 +181,54 @@ TEST_F(MetricsTest, Gauge) {
     }
 }
 
+TEST_F(MetricsTest, Histogram) {
+    HistogramMetric histogram(MetricUnit::MICROSECONDS);
+    ASSERT_EQ(0, histogram.snapshot().count);
+    ASSERT_EQ(0, histogram.snapshot().quantile(0.99));
+
+    const int64_t* bounds = HistogramMetric::bounds();
+    ASSERT_EQ(1, bounds[0]);
+    ASSERT_EQ(2, bounds[1]);
+    ASSERT_EQ(5, bounds[2]);
+    ASSERT_EQ(10, bounds[3]);
+    ASSERT_EQ(100000000, bounds[HistogramMetric::kNumBounds - 1]);
+
+    // 0 and 1 in the bucket (, 1], 3 and 5 in (2, 5], 200000000 in (10^8, +Inf)
+    for (int64_t v : {0, 1, 3, 5, 200000000}) {
+        histogram.observe(v);
+    }
+    auto snapshot = histogram.snapshot();
+    ASSERT_EQ(5, snapshot.count);
+    ASSERT_EQ(200000009, snapshot.sum);
+    ASSERT_EQ(2, snapshot.counts[0]);
+    ASSERT_EQ(0, snapshot.counts[1]);
+    ASSERT_EQ(2, snapshot.counts[2]);
+    ASSERT_EQ(1, snapshot.counts[HistogramMetric::kNumBuckets - 1]);
+    ASSERT_EQ(1, snapshot.quantile(0.2));
+    ASSERT_EQ(5, snapshot.quantile(0.5));
+    ASSERT_EQ(100000000, snapshot.quantile(0.99));
+    ASSERT_EQ("count=5 sum=200000009 p50=5 p99=100000000", histogram.to_string());
+}
+
+TEST_F(MetricsTest, HistogramMultiThread) {
+    HistogramMetric histogram(MetricUnit::MICROSECONDS);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 8; ++i) {
+        threads.emplace_back([&histogram]() {
+            for (int j = 0; j < 100000; ++j) {
+                histogram.observe(j % 100);
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    auto snapshot = histogram.snapshot();
+    ASSERT_EQ(800000, snapshot.count);
+    ASSERT_EQ(8 * 1000 * 4950, snapshot.sum);
+    ASSERT_EQ(100, snapshot.quantile(0.999));
+}
+
 TEST_F(MetricsTest, MetricLabel) {
     std::string put("put");
     MetricLabel label("type", put);
@@ -0,0 +1,36 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "util/perf_counters.h"
+
+#include <gtest/gtest.h>
+
+namespace starrocks {
+
+// The hardware counters may be unavailable in the test environment, e.g. in containers.
+TEST(PerfCountersTest, ScopedPerfCounters) {
+    RuntimeProfile profile("test");
+    auto* cycles = ADD_COUNTER(&profile, "CpuCycles", TUnit::UNIT);
+    auto* instructions = ADD_COUNTER(&profile, "Instructions", TUnit::UNIT);
+    auto* llc_misses = ADD_COUNTER(&profile, "LLCMisses", TUnit::UNIT);
+
+    volatile int64_t sum = 0;
+    {
+        ScopedPerfCounters perf_counters(cycles, instructions, llc_misses);
+        for (int i = 0; i < 1000000; i++) {
+            sum = sum + i;
+        }
+    }
+    if (ThreadPerfCounters::get() == nullptr) {
+        ASSERT_EQ(0, cycles->value());
+        ASSERT_EQ(0, instructions->value());
+        GTEST_SKIP() << "hardware counters are not available";
+    }
+    ASSERT_GT(cycles->value(), 0);
+    ASSERT_GT(instructions->value(), 1000000);
+    ASSERT_GE(llc_misses->value(), 0);
+
+    // nothing is counted without the profile counters
+    ScopedPerfCounters perf_counters(nullptr, nullptr, nullptr);
+}
+
+} // namespace starrocks
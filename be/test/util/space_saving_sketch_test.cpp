@@ -0,0 +1,56 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "util/space_saving_sketch.h"
+
+#include <gtest/gtest.h>
+
+namespace starrocks {
+
+TEST(SpaceSavingSketchTest, test_exact_when_not_full) {
+    SpaceSavingSketch<uint32_t> sketch(4);
+    sketch.add(1);
+    sketch.add(2, 3);
+    sketch.add(1);
+    sketch.add(3);
+
+    ASSERT_EQ(3, sketch.size());
+    ASSERT_EQ(6, sketch.total());
+    auto top = sketch.top();
+    ASSERT_EQ(3, top.size());
+    ASSERT_EQ(2, top[0].key);
+    ASSERT_EQ(3, top[0].count);
+    ASSERT_EQ(1, top[1].key);
+    ASSERT_EQ(2, top[1].count);
+    ASSERT_EQ(0, top[1].error);
+    ASSERT_EQ(3, top[2].key);
+
+    auto frequent = sketch.top(2);
+    ASSERT_EQ(2, frequent.size());
+
+    sketch.clear();
+    ASSERT_EQ(0, sketch.size());
+    ASSERT_EQ(0, sketch.total());
+}
+
+TEST(SpaceSavingSketchTest, test_heavy_hitter) {
+    SpaceSavingSketch<uint32_t> sketch(8);
+    // Key 0 occupies a third of the stream, and the other keys are distinct.
+    for (uint32_t i = 1; i <= 3000; ++i) {
+        if (i % 3 == 0) {
+            sketch.add(0);
+        } else {
+            sketch.add(i);
+        }
+    }
+    ASSERT_EQ(8, sketch.size());
+    ASSERT_EQ(3000, sketch.total());
+
+    auto top = sketch.top(sketch.total() / 8 + 1);
+    ASSERT_EQ(1, top.size());
+    ASSERT_EQ(0, top[0].key);
+    // The count is overestimated by at most the error.
+    ASSERT_GE(top[0].count, 1000);
+    ASSERT_LE(top[0].count - top[0].error, 1000);
+}
+
+} // namespace starrocks
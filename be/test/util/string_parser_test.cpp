@@ -225,6 +225,18 @@ TEST(StringToInt, InvalidLeadingTrailing) {
     test_int_value<int8_t>("   ", 0, StringParser::PARSE_FAILURE);
 }
 
+TEST(StringToInt, EightDigitsAtATime) {
+    test_int_value<int32_t>("123456789", 123456789, StringParser::PARSE_SUCCESS);
+    test_int_value<int32_t>("-012345678", -12345678, StringParser::PARSE_SUCCESS);
+    test_int_value<int32_t>("12345678 ", 12345678, StringParser::PARSE_SUCCESS);
+    test_int_value<int32_t>("1234567x9", 0, StringParser::PARSE_FAILURE);
+    test_int_value<int32_t>("12345678x", 0, StringParser::PARSE_FAILURE);
+    test_int_value<int64_t>("123456789012345678", 123456789012345678, StringParser::PARSE_SUCCESS);
+    test_int_value<int64_t>("12345678 9012", 0, StringParser::PARSE_FAILURE);
+    test_int_value<int64_t>("1234567890123 ", 1234567890123, StringParser::PARSE_SUCCESS);
+    test_int_value<int64_t>("-1234567890123456", -1234567890123456, StringParser::PARSE_SUCCESS);
+}
+
 TEST(StringToInt, Limit) {
     test_int_value<int8_t>("127", 127, StringParser::PARSE_SUCCESS);
     test_int_value<int8_t>("-128", -128, StringParser::PARSE_SUCCESS);
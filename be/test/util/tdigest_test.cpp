@@ -23,6 +23,7 @@
 
 #include <gtest/gtest.h>
 
+#include <limits>
 #include <random>
 
 namespace starrocks {
@@ -179,6 +180,37 @@ TEST_F(TDigestTest, MergeTest) {
     digest2.add(std::vector<const TDigest*>{&digest1});
 }
 
+TEST_F(TDigestTest, BatchAddAndMerge) {
+    std::vector<Value> values;
+    for (int i = 0; i < 100000; ++i) {
+        values.push_back(static_cast<Value>(i));
+    }
+    values.push_back(std::numeric_limits<Value>::quiet_NaN());
+
+    TDigest one_by_one(1000);
+    for (auto v : values) {
+        one_by_one.add(v);
+    }
+    TDigest batch(1000);
+    batch.add(values.data(), values.size());
+    EXPECT_EQ(one_by_one.totalWeight(), batch.totalWeight());
+    EXPECT_EQ(100000, batch.totalWeight());
+
+    // merge two halves into a digest
+    TDigest lower(1000);
+    lower.add(values.data(), 50000);
+    TDigest upper(1000);
+    upper.add(values.data() + 50000, 50000);
+    upper.compress();
+    lower.merge(&upper);
+    EXPECT_EQ(100000, lower.totalWeight());
+
+    for (double q : {0.01, 0.25, 0.5, 0.75, 0.99}) {
+        EXPECT_NEAR(q * 100000, batch.quantile(q), 100) << "q = " << q;
+        EXPECT_NEAR(q * 100000, lower.quantile(q), 100) << "q = " << q;
+    }
+}
+
 TEST_F(TDigestTest, TestSorted) {
     TDigest digest(1000);
     std::uniform_real_distribution<> reals(0.0, 1.0);
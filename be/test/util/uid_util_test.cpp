@@ -90,6 +90,21 @@ TEST_F(UidUtilTest, UniqueId) {
     }
 }
 
+TEST_F(UidUtilTest, ParseId) {
+    TUniqueId tuid;
+    tuid.__set_hi(0x0c3fb5c24b3a11ed);
+    tuid.__set_lo(0x1c4e00163e0e6c5a);
+    TUniqueId parsed;
+    ASSERT_TRUE(parse_id(print_id(tuid), &parsed));
+    ASSERT_EQ(tuid, parsed);
+    ASSERT_TRUE(parse_id("0C3FB5C24B3A11ED1C4E00163E0E6C5A", &parsed));
+    ASSERT_EQ(tuid, parsed);
+
+    ASSERT_FALSE(parse_id("", &parsed));
+    ASSERT_FALSE(parse_id("0c3fb5c2-4b3a-11ed-1c4e-00163e0e6c5", &parsed));
+    ASSERT_FALSE(parse_id("0c3fb5c2-4b3a-11ed-1c4e-00163e0e6c5x", &parsed));
+}
+
 TEST_F(UidUtilTest, Hash) {
     std::hash<UniqueId> hasher;
     UniqueId uid(1, 2);
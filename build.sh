@@ -107,6 +107,9 @@ fi
 if [[ -z ${USE_SSE4_2} ]]; then
     USE_SSE4_2=ON
 fi
+if [[ -z ${USE_AVX512} ]]; then
+    USE_AVX512=OFF
+fi
 
 
 HELP=0
@@ -161,6 +164,7 @@ echo "Get params:
     WITH_GCOV           -- $WITH_GCOV
     USE_STAROS          -- $USE_STAROS
     USE_AVX2            -- $USE_AVX2
+    USE_AVX512          -- $USE_AVX512
     PARALLEL            -- $PARALLEL
 "
 
@@ -203,7 +207,7 @@ if [ ${BUILD_BE} -eq 1 ] ; then
                     -DCMAKE_CXX_COMPILER_LAUNCHER=ccache \
                     -DCMAKE_BUILD_TYPE=${CMAKE_BUILD_TYPE} \
                     -DMAKE_TEST=OFF -DWITH_GCOV=${WITH_GCOV}\
-                    -DUSE_AVX2=$USE_AVX2 -DUSE_SSE4_2=$USE_SSE4_2 \
+                    -DUSE_AVX2=$USE_AVX2 -DUSE_AVX512=$USE_AVX512 -DUSE_SSE4_2=$USE_SSE4_2 \
                     -DCMAKE_EXPORT_COMPILE_COMMANDS=ON \
                     -DUSE_STAROS=${USE_STAROS} \
                     -Dprotobuf_DIR=${STARROCKS_THIRDPARTY}/installed/starlet/third_party/grpc_install/lib64/cmake/protobuf \
@@ -217,7 +221,7 @@ if [ ${BUILD_BE} -eq 1 ] ; then
                     -DCMAKE_CXX_COMPILER_LAUNCHER=ccache \
                     -DCMAKE_BUILD_TYPE=${CMAKE_BUILD_TYPE} \
                     -DMAKE_TEST=OFF -DWITH_GCOV=${WITH_GCOV}\
-                    -DUSE_AVX2=$USE_AVX2 -DUSE_SSE4_2=$USE_SSE4_2 \
+                    -DUSE_AVX2=$USE_AVX2 -DUSE_AVX512=$USE_AVX512 -DUSE_SSE4_2=$USE_SSE4_2 \
                     -DCMAKE_EXPORT_COMPILE_COMMANDS=ON  ..
     fi
     time ${BUILD_SYSTEM} -j${PARALLEL}
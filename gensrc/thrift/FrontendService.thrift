@@ -424,6 +424,9 @@ struct TReportExecStatusParams {
   15: optional i64 loaded_rows
 
   16: optional i64 backend_id
+
+  // The actual statistics of the hash joins, one per join node of the fragment instance.
+  17: optional list<Types.TJoinStatistics> join_statistics
 }
 
 struct TFeResult {
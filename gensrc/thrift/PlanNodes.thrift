@@ -103,6 +103,9 @@ struct TInternalScanRange {
   7: optional list<TKeyRange> partition_column_ranges
   8: optional string index_name
   9: optional string table_name
+  // Read only the rowsets of the versions in [begin_version, version] instead of [0, version],
+  // e.g. to refresh the materialized views by the rows loaded since the last refresh.
+  10: optional i64 begin_version
 }
 
 enum TFileFormatType {
@@ -224,6 +227,9 @@ struct THdfsScanRange {
     
     // for iceberg table scanrange should contains the full path of file
     8: optional string full_path
+
+    // the modification time of the hdfs file, to identify the version of the file in the block cache
+    9: optional i64 modification_time
 }
 
 // Specification of an individual data range which is held in its entirety
@@ -318,6 +324,8 @@ struct TOlapScanNode {
   23: optional map<i32, i32> dict_string_id_to_int_ids
   // which columns only be used to filter data in the stage of scan data
   24: optional list<string> unused_output_column_name
+  // false if the scan is a one-off full scan, whose pages should not be inserted into the page cache
+  25: optional bool fill_page_cache
 }
 
 struct TJDBCScanNode {
@@ -404,6 +404,18 @@ struct TTabletCommitInfo {
     4: optional list<string> valid_dict_cache_columns
 }
 
+// The actual statistics of a hash join in a fragment instance, reported to FE so that the optimizer can
+// correct the join order and the distribution mode for the recurring queries.
+struct TJoinStatistics {
+    1: optional i32 plan_node_id
+    // The rows and the estimated number of distinct keys of the hash table.
+    2: optional i64 build_rows
+    3: optional i64 build_key_ndv
+    // The rows probing the hash table, and the rows output by the join.
+    4: optional i64 probe_rows
+    5: optional i64 output_rows
+}
+
 enum TLoadType {
     MANUAL_LOAD,
     ROUTINE_LOAD,
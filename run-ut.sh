@@ -102,6 +102,9 @@ CMAKE_BUILD_TYPE="${CMAKE_BUILD_TYPE^^}"
 if [[ -z ${USE_SSE4_2} ]]; then
     USE_SSE4_2=ON
 fi
+if [[ -z ${USE_AVX512} ]]; then
+    USE_AVX512=OFF
+fi
 if [[ -z ${USE_AVX2} ]]; then
     USE_AVX2=ON
 fi
@@ -131,7 +134,7 @@ if [ "${USE_STAROS}" == "ON"  ]; then
               -DSTARROCKS_HOME=${STARROCKS_HOME} \
               -DCMAKE_CXX_COMPILER_LAUNCHER=ccache \
               -DMAKE_TEST=ON -DCMAKE_BUILD_TYPE=${CMAKE_BUILD_TYPE} \
-              -DUSE_AVX2=$USE_AVX2 -DUSE_SSE4_2=$USE_SSE4_2 \
+              -DUSE_AVX2=$USE_AVX2 -DUSE_AVX512=$USE_AVX512 -DUSE_SSE4_2=$USE_SSE4_2 \
               -DCMAKE_EXPORT_COMPILE_COMMANDS=ON -DWITH_BENCH=${WITH_BENCH}  \
               -DUSE_STAROS=${USE_STAROS} \
               -Dprotobuf_DIR=${STARROCKS_THIRDPARTY}/installed/starlet/third_party/grpc_install/lib64/cmake/protobuf \
@@ -144,7 +147,7 @@ else
               -DSTARROCKS_HOME=${STARROCKS_HOME} \
               -DCMAKE_CXX_COMPILER_LAUNCHER=ccache \
               -DMAKE_TEST=ON -DCMAKE_BUILD_TYPE=${CMAKE_BUILD_TYPE} \
-              -DUSE_AVX2=$USE_AVX2 -DUSE_SSE4_2=$USE_SSE4_2 \
+              -DUSE_AVX2=$USE_AVX2 -DUSE_AVX512=$USE_AVX512 -DUSE_SSE4_2=$USE_SSE4_2 \
               -DCMAKE_EXPORT_COMPILE_COMMANDS=ON -DWITH_BENCH=${WITH_BENCH} ../
 fi
 time ${BUILD_SYSTEM} -j${PARALLEL}